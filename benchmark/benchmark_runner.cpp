@@ -11,10 +11,17 @@
 #include "catch.hpp"
 #include "re2/re2.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <fstream>
 #include <sstream>
 #include <thread>
 
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
 using namespace duckdb;
 
 void BenchmarkRunner::RegisterBenchmark(Benchmark *benchmark) {
@@ -165,6 +172,139 @@ void BenchmarkRunner::RunBenchmark(Benchmark *benchmark) {
 	benchmark->Finalize();
 }
 
+struct ResourceUsage {
+	//! User and system CPU time of the process (in seconds)
+	double cpu_time = 0;
+	//! Peak resident set size of the process (in bytes)
+	idx_t peak_memory = 0;
+
+	static ResourceUsage Get() {
+		ResourceUsage result;
+#ifndef _WIN32
+		struct rusage usage;
+		if (getrusage(RUSAGE_SELF, &usage) == 0) {
+			result.cpu_time = double(usage.ru_utime.tv_sec) + double(usage.ru_stime.tv_sec) +
+			                  double(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+#ifdef __APPLE__
+			result.peak_memory = idx_t(usage.ru_maxrss);
+#else
+			result.peak_memory = idx_t(usage.ru_maxrss) * 1024;
+#endif
+		}
+#endif
+		return result;
+	}
+};
+
+//! The latencies (in seconds) and errors of the queries of one benchmark in throughput mode
+struct ThroughputResult {
+	vector<double> latencies;
+	idx_t errors = 0;
+
+	void Append(const ThroughputResult &other) {
+		latencies.insert(latencies.end(), other.latencies.begin(), other.latencies.end());
+		errors += other.errors;
+	}
+
+	//! Nearest-rank percentile of the latencies, which must be sorted
+	double Percentile(double percentile) const {
+		if (latencies.empty()) {
+			return 0;
+		}
+		auto rank = idx_t(std::ceil(percentile * double(latencies.size())));
+		return latencies[MaxValue<idx_t>(rank, 1) - 1];
+	}
+
+	string ToString(const string &name, double elapsed) {
+		std::sort(latencies.begin(), latencies.end());
+		return StringUtil::Format("%s\t%llu\t%llu\t%f\t%f\t%f\t%f", name, latencies.size(), errors,
+		                          double(latencies.size()) / elapsed, Percentile(0.5), Percentile(0.95),
+		                          Percentile(0.99));
+	}
+};
+
+void BenchmarkRunner::RunThroughput(const vector<Benchmark *> &mix) {
+	auto clients = configuration.clients;
+	// initialize every benchmark of the mix once, and verify a warm-up run of it
+	vector<unique_ptr<BenchmarkState>> states;
+	for (auto &benchmark : mix) {
+		auto state = benchmark->Initialize(configuration);
+		benchmark->Run(state.get());
+		auto verify = benchmark->Verify(state.get());
+		if (!verify.empty()) {
+			LogLine(benchmark->name + "\tINCORRECT RESULT: " + verify);
+			exit(1);
+		}
+		states.push_back(std::move(state));
+	}
+	// every client gets its own connection to the database of every benchmark
+	vector<vector<unique_ptr<BenchmarkState>>> client_states(clients);
+	for (idx_t client = 0; client < clients; client++) {
+		for (idx_t i = 0; i < mix.size(); i++) {
+			auto client_state = mix[i]->InitializeClient(states[i].get());
+			if (!client_state) {
+				LogLine(mix[i]->name + "\tdoes not support concurrent clients");
+				exit(1);
+			}
+			client_states[client].push_back(std::move(client_state));
+		}
+	}
+
+	// each client cycles through the mix, starting at a different benchmark, until the duration has passed
+	vector<vector<ThroughputResult>> client_results(clients, vector<ThroughputResult>(mix.size()));
+	auto run_client = [&](idx_t client) {
+		auto &results = client_results[client];
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(configuration.throughput_duration);
+		for (idx_t iteration = client; std::chrono::steady_clock::now() < deadline; iteration++) {
+			auto i = iteration % mix.size();
+			auto start = std::chrono::steady_clock::now();
+			try {
+				mix[i]->RunClient(client_states[client][i].get());
+			} catch (std::exception &) {
+				results[i].errors++;
+				continue;
+			}
+			auto end = std::chrono::steady_clock::now();
+			results[i].latencies.push_back(std::chrono::duration<double>(end - start).count());
+		}
+	};
+
+	auto usage_before = ResourceUsage::Get();
+	auto start = std::chrono::steady_clock::now();
+	vector<std::thread> client_threads;
+	for (idx_t client = 0; client < clients; client++) {
+		client_threads.emplace_back(run_client, client);
+	}
+	for (auto &thread : client_threads) {
+		thread.join();
+	}
+	auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	auto usage_after = ResourceUsage::Get();
+
+	LogLine(StringUtil::Format("clients\t%llu\tduration\t%f", clients, elapsed));
+	LogLine("name\tqueries\terrors\tqps\tp50\tp95\tp99");
+	ThroughputResult total;
+	for (idx_t i = 0; i < mix.size(); i++) {
+		ThroughputResult result;
+		for (idx_t client = 0; client < clients; client++) {
+			result.Append(client_results[client][i]);
+		}
+		total.Append(result);
+		LogResult(result.ToString(mix[i]->name, elapsed));
+	}
+	if (mix.size() > 1) {
+		LogResult(total.ToString("total", elapsed));
+	}
+	auto cpu_time = usage_after.cpu_time - usage_before.cpu_time;
+	LogResult(StringUtil::Format("cpu_time\t%f\tcpu_utilization\t%f\tpeak_memory\t%s", cpu_time,
+	                             cpu_time / elapsed, StringUtil::BytesToHumanReadableString(usage_after.peak_memory)));
+
+	for (idx_t i = 0; i < mix.size(); i++) {
+		mix[i]->Cleanup(states[i].get());
+		mix[i]->Finalize();
+	}
+}
+
 void BenchmarkRunner::RunBenchmarks() {
 	LogLine("Starting benchmark run.");
 	LogLine("name\trun\ttiming");
@@ -188,12 +328,16 @@ void print_help() {
 	                "look for the 'benchmarks' directory\n");
 	fprintf(stderr, "              --disable-timeout      Disables killing the run after a certain amount of time has "
 	                "passed (30 seconds by default)\n");
+	fprintf(stderr, "              --clients=n            Measures the throughput of n concurrent clients that cycle "
+	                "through the matching benchmarks\n");
+	fprintf(stderr, "              --duration=n           Sets how long throughput is measured in seconds (default: "
+	                "10)\n");
 	fprintf(stderr,
 	        "              [name_pattern]         Run only the benchmark which names match the specified name pattern, "
 	        "e.g., DS.* for TPC-DS benchmarks\n");
 }
 
-enum ConfigurationError { None, BenchmarkNotFound, InfoWithoutBenchmarkName };
+enum ConfigurationError { None, BenchmarkNotFound, InfoWithoutBenchmarkName, ThroughputWithoutBenchmarkName };
 
 void LoadInterpretedBenchmarks(FileSystem &fs) {
 	// load interpreted benchmarks
@@ -260,6 +404,16 @@ void parse_arguments(const int arg_counter, char const *const *arg_values) {
 			instance.configuration.meta = BenchmarkMetaType::QUERY;
 		} else if (arg == "--disable-timeout") {
 			instance.configuration.timeout_duration = optional_idx();
+		} else if (StringUtil::StartsWith(arg, "--clients=") || StringUtil::StartsWith(arg, "--duration=")) {
+			auto splits = StringUtil::Split(arg, '=');
+			auto value = Value(splits[1]).DefaultCastAs(LogicalType::UBIGINT).GetValue<uint64_t>();
+			if (value == 0) {
+				fprintf(stderr, "%s must be greater than zero\n", splits[0].c_str());
+				exit(1);
+			}
+			auto &setting = StringUtil::StartsWith(arg, "--clients=") ? instance.configuration.clients
+			                                                           : instance.configuration.throughput_duration;
+			setting = value;
 		} else if (StringUtil::StartsWith(arg, "--out=") || StringUtil::StartsWith(arg, "--log=")) {
 			auto splits = StringUtil::Split(arg, '=');
 			if (splits.size() != 2) {
@@ -327,6 +481,12 @@ ConfigurationError run_benchmarks() {
 				}
 				fprintf(stdout, "%s\n", query.c_str());
 			}
+		} else if (instance.configuration.clients > 0) {
+			vector<Benchmark *> mix;
+			for (const auto &benchmark_index : benchmark_indices) {
+				mix.push_back(benchmarks[benchmark_index]);
+			}
+			instance.RunThroughput(mix);
 		} else {
 			instance.LogLine("name\trun\ttiming");
 			for (const auto &benchmark_index : benchmark_indices) {
@@ -337,6 +497,9 @@ ConfigurationError run_benchmarks() {
 		if (instance.configuration.meta != BenchmarkMetaType::NONE) {
 			return ConfigurationError::InfoWithoutBenchmarkName;
 		}
+		if (instance.configuration.clients > 0) {
+			return ConfigurationError::ThroughputWithoutBenchmarkName;
+		}
 		// default: run all benchmarks
 		instance.RunBenchmarks();
 	}
@@ -351,6 +514,9 @@ void print_error_message(const ConfigurationError &error) {
 	case ConfigurationError::InfoWithoutBenchmarkName:
 		fprintf(stderr, "Info requires benchmark name pattern.\n");
 		break;
+	case ConfigurationError::ThroughputWithoutBenchmarkName:
+		fprintf(stderr, "Throughput mode requires benchmark name pattern.\n");
+		break;
 	case ConfigurationError::None:
 		break;
 	}
@@ -64,6 +64,14 @@ public:
 	virtual string Subgroup() {
 		return string();
 	}
+	//! Create the state of an additional client that runs the benchmark concurrently against the database of the
+	//! given state, used by the throughput mode. Returns nullptr if the benchmark cannot run concurrently.
+	virtual duckdb::unique_ptr<BenchmarkState> InitializeClient(BenchmarkState *state) {
+		return nullptr;
+	}
+	//! Run the benchmark on a client state created by InitializeClient
+	virtual void RunClient(BenchmarkState *client_state) {
+	}
 	//! Interrupt the benchmark because of a timeout
 	virtual void Interrupt(BenchmarkState *state) = 0;
 	//! Returns information about the benchmark
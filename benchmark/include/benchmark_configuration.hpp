@@ -22,12 +22,17 @@ enum class BenchmarkProfileInfo { NONE, NORMAL, DETAILED };
 struct BenchmarkConfiguration {
 public:
 	constexpr static size_t DEFAULT_TIMEOUT = 30;
+	constexpr static idx_t DEFAULT_THROUGHPUT_DURATION = 10;
 
 public:
 	string name_pattern {};
 	BenchmarkMetaType meta = BenchmarkMetaType::NONE;
 	BenchmarkProfileInfo profile_info = BenchmarkProfileInfo::NONE;
 	optional_idx timeout_duration = optional_idx(DEFAULT_TIMEOUT);
+	//! The amount of concurrent clients in throughput mode, or 0 to measure the latency of single runs
+	idx_t clients = 0;
+	//! How long the throughput mode runs (in seconds)
+	idx_t throughput_duration = DEFAULT_THROUGHPUT_DURATION;
 };
 
 } // namespace duckdb
@@ -45,6 +45,8 @@ public:
 
 	void RunBenchmark(Benchmark *benchmark);
 	void RunBenchmarks();
+	//! Run a mix of benchmarks on concurrent clients for a fixed duration, and report the throughput
+	void RunThroughput(const vector<Benchmark *> &mix);
 
 	vector<Benchmark *> benchmarks;
 	ofstream out_file;
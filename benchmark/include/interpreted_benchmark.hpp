@@ -14,6 +14,7 @@
 
 namespace duckdb {
 struct BenchmarkFileReader;
+class Connection;
 class MaterializedQueryResult;
 
 const string DEFAULT_DB_PATH = "duckdb_benchmark_db.db";
@@ -33,6 +34,9 @@ public:
 	//! Verify that the output of the benchmark was correct
 	string Verify(BenchmarkState *state) override;
 
+	duckdb::unique_ptr<BenchmarkState> InitializeClient(BenchmarkState *state) override;
+	void RunClient(BenchmarkState *client_state) override;
+
 	string GetQuery() override;
 	//! Interrupt the benchmark because of a timeout
 	void Interrupt(BenchmarkState *state) override;
@@ -62,6 +66,7 @@ public:
 	}
 
 private:
+	duckdb::unique_ptr<MaterializedQueryResult> RunQuery(Connection &con);
 	string VerifyInternal(BenchmarkState *state_p, MaterializedQueryResult &result);
 
 	void ReadResultFromFile(BenchmarkFileReader &reader, const string &file);
@@ -58,6 +58,14 @@ struct InterpretedBenchmarkState : public BenchmarkState {
 	}
 };
 
+//! An additional connection to the database of a benchmark, used to run it on concurrent clients
+struct InterpretedBenchmarkClientState : public BenchmarkState {
+	explicit InterpretedBenchmarkClientState(DuckDB &db) : con(db) {
+	}
+
+	Connection con;
+};
+
 struct BenchmarkFileReader {
 	BenchmarkFileReader(string path_, unordered_map<std::string, std::string> replacement_map)
 	    : path(path_), infile(path), linenr(0), replacements(replacement_map) {
@@ -474,9 +482,8 @@ ScopedConfigSetting PrepareResultCollector(ClientConfig &config, InterpretedBenc
 	return ScopedConfigSetting(config);
 }
 
-void InterpretedBenchmark::Run(BenchmarkState *state_p) {
-	auto &state = (InterpretedBenchmarkState &)*state_p;
-	auto &context = state.con.context;
+unique_ptr<MaterializedQueryResult> InterpretedBenchmark::RunQuery(Connection &con) {
+	auto &context = con.context;
 
 	auto &config = ClientConfig::GetConfig(*context);
 	auto result_collector_setting = PrepareResultCollector(config, *this);
@@ -488,12 +495,34 @@ void InterpretedBenchmark::Run(BenchmarkState *state_p) {
 	}
 	if (temp_result->type == QueryResultType::STREAM_RESULT) {
 		auto &stream_query = temp_result->Cast<StreamQueryResult>();
-		state.result = stream_query.Materialize();
+		return stream_query.Materialize();
 	} else if (temp_result->type == QueryResultType::ARROW_RESULT) {
 		/* no-op, this is only used to test the overhead of the result collector */
-		state.result = nullptr;
+		return nullptr;
 	} else {
-		state.result = unique_ptr_cast<duckdb::QueryResult, duckdb::MaterializedQueryResult>(std::move(temp_result));
+		return unique_ptr_cast<duckdb::QueryResult, duckdb::MaterializedQueryResult>(std::move(temp_result));
+	}
+}
+
+void InterpretedBenchmark::Run(BenchmarkState *state_p) {
+	auto &state = (InterpretedBenchmarkState &)*state_p;
+	state.result = RunQuery(state.con);
+}
+
+unique_ptr<BenchmarkState> InterpretedBenchmark::InitializeClient(BenchmarkState *state_p) {
+	auto &state = (InterpretedBenchmarkState &)*state_p;
+	if (require_reinit || queries.find("cleanup") != queries.end()) {
+		// the run modifies the database, so it cannot be repeated concurrently
+		return nullptr;
+	}
+	return make_uniq<InterpretedBenchmarkClientState>(state.db);
+}
+
+void InterpretedBenchmark::RunClient(BenchmarkState *client_state_p) {
+	auto &client_state = (InterpretedBenchmarkClientState &)*client_state_p;
+	auto result = RunQuery(client_state.con);
+	if (result && result->HasError()) {
+		result->ThrowError();
 	}
 }
 
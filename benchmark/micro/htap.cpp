@@ -0,0 +1,278 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+#include "duckdb/main/appender.hpp"
+#include "duckdb/common/random_engine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+using namespace duckdb;
+
+//! The number of transactions each appender and updater thread commits
+#define HTAP_TRANSACTIONS_PER_WRITER 100
+#define HTAP_ROWS_PER_APPEND         1000
+#define HTAP_ROWS_PER_UPDATE         100
+#define HTAP_CHECKPOINT_INTERVAL_MS  100
+//! The number of scans each reader runs at least, e.g., when there are no writers
+#define HTAP_MIN_SCANS_PER_READER    10
+
+//! An HTAP-style workload on a single table: appender and updater threads commit small transactions, while reader
+//! threads scan the table and a checkpointer thread checkpoints it until all writers are done.
+struct HTAPWorkload {
+	HTAPWorkload(DuckDB &db, idx_t rows, idx_t appenders, idx_t updaters, idx_t readers)
+	    : db(db), rows(rows), appenders(appenders), updaters(updaters), readers(readers) {
+	}
+
+	static constexpr const char *SCAN_QUERY = "SELECT grp % 10, SUM(val), COUNT(*) FROM htap GROUP BY ALL";
+
+	static void Load(Connection &con, idx_t rows) {
+		con.Query("CREATE TABLE htap(id BIGINT, grp INTEGER, val DOUBLE, payload VARCHAR)");
+		con.Query("INSERT INTO htap SELECT i, i % 1000, i / 7, concat('payload-', i) FROM range(" +
+		          to_string(rows) + ") t(i)");
+		con.Query("CHECKPOINT");
+	}
+
+	//! Time a scan of the table without concurrent writers
+	static double BaselineScanTime(Connection &con) {
+		auto start = std::chrono::steady_clock::now();
+		con.Query(SCAN_QUERY);
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	//! Remove the appended rows, so every run starts from the same table
+	static void Reset(Connection &con, idx_t rows) {
+		con.Query("DELETE FROM htap WHERE id >= " + to_string(rows));
+		con.Query("CHECKPOINT");
+	}
+
+	void Run() {
+		vector<std::thread> writer_threads;
+		for (idx_t i = 0; i < appenders; i++) {
+			writer_threads.emplace_back(&HTAPWorkload::RunAppender, this, i);
+		}
+		for (idx_t i = 0; i < updaters; i++) {
+			writer_threads.emplace_back(&HTAPWorkload::RunUpdater, this, i);
+		}
+		vector<std::thread> reader_threads;
+		for (idx_t i = 0; i < readers; i++) {
+			reader_threads.emplace_back(&HTAPWorkload::RunReader, this);
+		}
+		std::thread checkpointer(&HTAPWorkload::RunCheckpointer, this);
+		for (auto &thread : writer_threads) {
+			thread.join();
+		}
+		writers_done = true;
+		for (auto &thread : reader_threads) {
+			thread.join();
+		}
+		readers_done = true;
+		checkpointer.join();
+	}
+
+	static double Percentile(vector<double> &values, double percentile) {
+		if (values.empty()) {
+			return 0;
+		}
+		std::sort(values.begin(), values.end());
+		auto rank = idx_t(percentile * double(values.size() - 1));
+		return values[rank];
+	}
+
+	static double Mean(const vector<double> &values) {
+		double sum = 0;
+		for (auto &value : values) {
+			sum += value;
+		}
+		return values.empty() ? 0 : sum / double(values.size());
+	}
+
+	string Summary(double baseline_scan_time) {
+		string result;
+		result += StringUtil::Format("commits\t%llu\tconflicts\t%llu\n", commit_latencies.size(), conflicts.load());
+		result += StringUtil::Format("commit_latency_p50\t%f\tcommit_latency_p99\t%f\tcommit_latency_max\t%f\n",
+		                             Percentile(commit_latencies, 0.5), Percentile(commit_latencies, 0.99),
+		                             Percentile(commit_latencies, 1));
+		auto scan_time = Mean(scan_times);
+		auto slowdown = baseline_scan_time > 0 ? scan_time / baseline_scan_time : 0;
+		result += StringUtil::Format("scans\t%llu\tscan_time_mean\t%f\tscan_slowdown\t%f\n", scan_times.size(),
+		                             scan_time, slowdown);
+		result += StringUtil::Format("checkpoints\t%llu\tcheckpoint_stall_p99\t%f\tcheckpoint_stall_max\t%f\n",
+		                             checkpoint_times.size(), Percentile(checkpoint_times, 0.99),
+		                             Percentile(checkpoint_times, 1));
+		return result;
+	}
+
+	//! The first error a thread ran into, if any
+	string error;
+
+private:
+	void RecordError(const string &message) {
+		lock_guard<mutex> guard(lock);
+		if (error.empty()) {
+			error = message;
+		}
+	}
+
+	void RecordTime(vector<double> &times, std::chrono::steady_clock::time_point start) {
+		auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		lock_guard<mutex> guard(lock);
+		times.push_back(elapsed);
+	}
+
+	//! Commit the transaction of the connection, and record the commit latency. Returns false on a conflict.
+	bool Commit(Connection &con) {
+		auto start = std::chrono::steady_clock::now();
+		auto result = con.Query("COMMIT");
+		if (result->HasError()) {
+			conflicts++;
+			return false;
+		}
+		RecordTime(commit_latencies, start);
+		return true;
+	}
+
+	void RunAppender(idx_t thread_idx) {
+		Connection con(db);
+		// appended ids are above the loaded ids, and distinct per thread
+		auto next_id = int64_t(rows + thread_idx * HTAP_TRANSACTIONS_PER_WRITER * HTAP_ROWS_PER_APPEND);
+		for (idx_t t = 0; t < HTAP_TRANSACTIONS_PER_WRITER; t++) {
+			con.Query("BEGIN TRANSACTION");
+			try {
+				Appender appender(con, "htap");
+				for (idx_t i = 0; i < HTAP_ROWS_PER_APPEND; i++) {
+					appender.BeginRow();
+					appender.Append<int64_t>(next_id);
+					appender.Append<int32_t>(int32_t(next_id % 1000));
+					appender.Append<double>(double(next_id) / 7);
+					appender.Append<const char *>("appended");
+					appender.EndRow();
+					next_id++;
+				}
+				appender.Close();
+			} catch (std::exception &ex) {
+				con.Query("ROLLBACK");
+				RecordError(ex.what());
+				return;
+			}
+			Commit(con);
+		}
+	}
+
+	void RunUpdater(idx_t thread_idx) {
+		Connection con(db);
+		RandomEngine random(thread_idx);
+		// every updater updates its own stripe of the table, so updaters only conflict with checkpoints
+		auto stripe_size = MaxValue<idx_t>(rows / updaters, HTAP_ROWS_PER_UPDATE);
+		auto stripe_start = thread_idx * stripe_size;
+		for (idx_t t = 0; t < HTAP_TRANSACTIONS_PER_WRITER; t++) {
+			auto first = stripe_start + idx_t(random.NextRandom(0, double(stripe_size - HTAP_ROWS_PER_UPDATE)));
+			con.Query("BEGIN TRANSACTION");
+			auto result = con.Query(StringUtil::Format("UPDATE htap SET val = val + 1 WHERE id BETWEEN %llu AND %llu",
+			                                           first, first + HTAP_ROWS_PER_UPDATE - 1));
+			if (result->HasError()) {
+				con.Query("ROLLBACK");
+				if (result->GetErrorType() != ExceptionType::TRANSACTION) {
+					RecordError(result->GetError());
+					return;
+				}
+				conflicts++;
+				continue;
+			}
+			Commit(con);
+		}
+	}
+
+	void RunReader() {
+		Connection con(db);
+		for (idx_t scans = 0; scans < HTAP_MIN_SCANS_PER_READER || !writers_done; scans++) {
+			auto start = std::chrono::steady_clock::now();
+			auto result = con.Query(SCAN_QUERY);
+			if (result->HasError()) {
+				RecordError(result->GetError());
+				return;
+			}
+			RecordTime(scan_times, start);
+		}
+	}
+
+	void RunCheckpointer() {
+		Connection con(db);
+		while (!writers_done || !readers_done) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(HTAP_CHECKPOINT_INTERVAL_MS));
+			auto start = std::chrono::steady_clock::now();
+			auto result = con.Query("CHECKPOINT");
+			if (result->HasError()) {
+				// the checkpoint was skipped because of concurrent transactions
+				continue;
+			}
+			RecordTime(checkpoint_times, start);
+		}
+	}
+
+private:
+	DuckDB &db;
+	idx_t rows;
+	idx_t appenders;
+	idx_t updaters;
+	idx_t readers;
+
+	atomic<bool> writers_done {false};
+	atomic<bool> readers_done {false};
+	atomic<idx_t> conflicts {0};
+	mutex lock;
+	vector<double> commit_latencies;
+	vector<double> scan_times;
+	vector<double> checkpoint_times;
+};
+
+#define HTAP_BENCHMARK(ROWS, APPENDERS, UPDATERS, READERS)                                                             \
+	double baseline_scan_time = 0;                                                                                     \
+	string summary;                                                                                                    \
+	string error;                                                                                                      \
+	bool InMemory() override {                                                                                         \
+		return false;                                                                                                  \
+	}                                                                                                                  \
+	void Load(DuckDBBenchmarkState *state) override {                                                                  \
+		HTAPWorkload::Load(state->conn, ROWS);                                                                         \
+		baseline_scan_time = HTAPWorkload::BaselineScanTime(state->conn);                                              \
+	}                                                                                                                  \
+	void RunBenchmark(DuckDBBenchmarkState *state) override {                                                          \
+		HTAPWorkload workload(state->db, ROWS, APPENDERS, UPDATERS, READERS);                                          \
+		workload.Run();                                                                                                \
+		summary = workload.Summary(baseline_scan_time);                                                                \
+		error = workload.error;                                                                                        \
+	}                                                                                                                  \
+	void Cleanup(DuckDBBenchmarkState *state) override {                                                               \
+		HTAPWorkload::Reset(state->conn, ROWS);                                                                        \
+	}                                                                                                                  \
+	string VerifyResult(QueryResult *result) override {                                                                \
+		return error;                                                                                                  \
+	}                                                                                                                  \
+	string GetLogOutput(BenchmarkState *state) override {                                                              \
+		return summary;                                                                                                \
+	}                                                                                                                  \
+	string BenchmarkInfo() override {                                                                                  \
+		return StringUtil::Format("Run %d appenders, %d updaters and %d readers with checkpoints on %d rows",          \
+		                          APPENDERS, UPDATERS, READERS, ROWS);                                                 \
+	}                                                                                                                  \
+	optional_idx Timeout(const BenchmarkConfiguration &config) override {                                              \
+		return 600;                                                                                                    \
+	}
+
+// readers only, the baseline for the scan slowdown
+DUCKDB_BENCHMARK(HTAP1MReadOnly, "[htap]")
+HTAP_BENCHMARK(1000000, 0, 0, 4);
+FINISH_BENCHMARK(HTAP1MReadOnly)
+
+DUCKDB_BENCHMARK(HTAP1MMixed, "[htap]")
+HTAP_BENCHMARK(1000000, 2, 2, 4);
+FINISH_BENCHMARK(HTAP1MMixed)
+
+DUCKDB_BENCHMARK(HTAP10MAppendHeavy, "[htap]")
+HTAP_BENCHMARK(10000000, 4, 1, 2);
+FINISH_BENCHMARK(HTAP10MAppendHeavy)
+
+DUCKDB_BENCHMARK(HTAP10MUpdateHeavy, "[htap]")
+HTAP_BENCHMARK(10000000, 1, 4, 2);
+FINISH_BENCHMARK(HTAP10MUpdateHeavy)
@@ -0,0 +1 @@
+SELECT COUNT(*), SUM(c), MAX(p) FROM (SELECT val, COUNT(*) AS c, MAX(payload) AS p FROM facts GROUP BY val);
@@ -0,0 +1 @@
+SELECT COUNT(*), SUM(f1.val), MAX(f2.payload) FROM facts f1 JOIN facts f2 ON f1.id = f2.val;
@@ -0,0 +1 @@
+CREATE TABLE facts AS SELECT i AS id, i % 1000000 AS grp, (i * 7919) % 10000000 AS val, concat('payload-', i) AS payload FROM range(10000000) t(i);
@@ -0,0 +1 @@
+SELECT id, val, payload FROM facts ORDER BY payload OFFSET 9999999;
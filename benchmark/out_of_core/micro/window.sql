@@ -0,0 +1 @@
+SELECT MAX(r), SUM(r), MAX(p) FROM (SELECT row_number() OVER (PARTITION BY grp ORDER BY val) AS r, payload AS p FROM facts);
@@ -14,6 +14,13 @@ static void LoadInternal(DatabaseInstance &instance) {
 	for (const auto &function : DeltaFunctions::GetTableFunctions(instance)) {
 		ExtensionUtil::RegisterFunction(instance, function);
 	}
+
+	auto &config = DBConfig::GetConfig(instance);
+	config.AddExtensionOption("delta_snapshot_cache_ttl",
+	                          "The number of seconds for which the snapshot of a Delta table is reused without "
+	                          "checking for new commits; older snapshots are reused if no new commit was written "
+	                          "(0 = disabled)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
 }
 
 void DeltaExtension::Load(DuckDB &db) {
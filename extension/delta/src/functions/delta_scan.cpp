@@ -15,6 +15,8 @@
 #include "duckdb/planner/binder.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 
+#include <chrono>
+
 #include <string>
 #include <numeric>
 
@@ -42,8 +44,9 @@ static void visit_callback(ffi::NullableCvoid engine_context, struct ffi::Kernel
 	context->metadata.back()->file_number = context->resolved_files.size() - 1;
 
 	// Fetch the deletion vector
+	auto &extern_engine = context->kernel_snapshot->extern_engine;
 	auto selection_vector_res =
-	    ffi::selection_vector_from_dv(dv_info, context->extern_engine.get(), context->global_state.get());
+	    ffi::selection_vector_from_dv(dv_info, extern_engine.get(), context->global_state.get());
 	auto selection_vector =
 	    KernelUtils::UnpackResult(selection_vector_res, "selection_vector_from_dv for path " + context->GetPath());
 	if (selection_vector.ptr) {
@@ -166,7 +169,7 @@ void DeltaSnapshot::Bind(vector<LogicalType> &return_types, vector<string> &name
 	if (!initialized) {
 		InitializeFiles();
 	}
-	auto schema = SchemaVisitor::VisitSnapshotSchema(snapshot.get());
+	auto schema = SchemaVisitor::VisitSnapshotSchema(kernel_snapshot->snapshot.get());
 	for (const auto &field : *schema) {
 		names.push_back(field.first);
 		return_types.push_back(field.second);
@@ -208,25 +211,72 @@ string DeltaSnapshot::GetFile(idx_t i) {
 	return resolved_files[i];
 }
 
-void DeltaSnapshot::InitializeFiles() {
+static int64_t CurrentTimeSeconds() {
+	return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
+	    .count();
+}
+
+bool DeltaSnapshot::HasNewerCommit(idx_t version) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto commit_file = StringUtil::Format("%s_delta_log/%020llu.json", ToDuckDBPath(paths[0]), version + 1);
+	return fs.FileExists(commit_file);
+}
+
+shared_ptr<DeltaKernelSnapshot> DeltaSnapshot::GetKernelSnapshot() {
+	idx_t cache_ttl = 0;
+	Value cache_ttl_setting;
+	if (context.TryGetCurrentSetting("delta_snapshot_cache_ttl", cache_ttl_setting) && !cache_ttl_setting.IsNull()) {
+		cache_ttl = UBigIntValue::Get(cache_ttl_setting);
+	}
+	auto &cache = ObjectCache::GetObjectCache(context);
+	auto cache_key = "delta_snapshot:" + paths[0];
+	auto now = CurrentTimeSeconds();
+	if (cache_ttl > 0) {
+		auto cached_snapshot = cache.Get<DeltaKernelSnapshot>(cache_key);
+		if (cached_snapshot) {
+			if (now < cached_snapshot->validated_time + int64_t(cache_ttl)) {
+				return cached_snapshot;
+			}
+			// The snapshot is older than the staleness tolerance: it is still the latest snapshot if no new commit
+			// was written, which is much cheaper to check than replaying the log
+			if (!HasNewerCommit(cached_snapshot->version)) {
+				cached_snapshot->validated_time = now;
+				return cached_snapshot;
+			}
+		}
+	}
+
+	auto result = make_shared_ptr<DeltaKernelSnapshot>();
 	auto path_slice = KernelUtils::ToDeltaString(paths[0]);
 
 	// Register engine
 	auto interface_builder = CreateBuilder(context, paths[0]);
-	extern_engine = TryUnpackKernelResult(ffi::builder_build(interface_builder));
+	result->extern_engine = TryUnpackKernelResult(ffi::builder_build(interface_builder));
 
 	// Initialize Snapshot
-	snapshot = TryUnpackKernelResult(ffi::snapshot(path_slice, extern_engine.get()));
+	result->snapshot = TryUnpackKernelResult(ffi::snapshot(path_slice, result->extern_engine.get()));
+	result->version = ffi::version(result->snapshot.get());
+	result->validated_time = now;
+
+	if (cache_ttl > 0) {
+		cache.Put(cache_key, result);
+	}
+	return result;
+}
+
+void DeltaSnapshot::InitializeFiles() {
+	kernel_snapshot = GetKernelSnapshot();
+	auto &extern_engine = kernel_snapshot->extern_engine;
 
 	// Create Scan
 	PredicateVisitor visitor(names, &table_filters);
-	scan = TryUnpackKernelResult(ffi::scan(snapshot.get(), extern_engine.get(), &visitor));
+	scan = TryUnpackKernelResult(ffi::scan(kernel_snapshot->snapshot.get(), extern_engine.get(), &visitor));
 
 	// Create GlobalState
 	global_state = ffi::get_global_scan_state(scan.get());
 
 	// Set version
-	this->version = ffi::version(snapshot.get());
+	this->version = kernel_snapshot->version;
 
 	// Create scan data iterator
 	scan_data_iterator = TryUnpackKernelResult(ffi::kernel_scan_data_init(extern_engine.get(), scan.get()));
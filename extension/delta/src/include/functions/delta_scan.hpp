@@ -10,9 +10,26 @@
 
 #include "delta_utils.hpp"
 #include "duckdb/common/multi_file_reader.hpp"
+#include "duckdb/storage/object_cache.hpp"
 
 namespace duckdb {
 
+//! A kernel snapshot of a Delta table, which is shared between scans of the same table through the object cache
+struct DeltaKernelSnapshot : public ObjectCacheEntry {
+	KernelExternEngine extern_engine;
+	KernelSnapshot snapshot;
+	idx_t version = DConstants::INVALID_INDEX;
+	//! The last time (in seconds since epoch) at which the snapshot was known to be the latest version of the table
+	atomic<int64_t> validated_time {0};
+
+	static string ObjectType() {
+		return "delta_kernel_snapshot";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+};
+
 struct DeltaFileMetaData {
 	DeltaFileMetaData() {};
 
@@ -55,6 +72,10 @@ protected:
 protected:
 	// TODO: How to guarantee we only call this after the filter pushdown?
 	void InitializeFiles();
+	//! Returns the cached snapshot of the table if it is recent enough, or creates a new snapshot otherwise
+	shared_ptr<DeltaKernelSnapshot> GetKernelSnapshot();
+	//! Whether a commit newer than the given version was written to the log of the table
+	bool HasNewerCommit(idx_t version);
 
 	template <class T>
 	T TryUnpackKernelResult(ffi::ExternResult<T> result) {
@@ -67,8 +88,7 @@ public:
 	idx_t version;
 
 	//! Delta Kernel Structures
-	KernelSnapshot snapshot;
-	KernelExternEngine extern_engine;
+	shared_ptr<DeltaKernelSnapshot> kernel_snapshot;
 	KernelScan scan;
 	KernelGlobalScanState global_state;
 	KernelScanDataIterator scan_data_iterator;
@@ -12,7 +12,13 @@ include_directories = [
 ]
 # source files
 source_files = [
-    os.path.sep.join(x.split('/')) for x in ['extension/fts/fts_extension.cpp', 'extension/fts/fts_indexing.cpp']
+    os.path.sep.join(x.split('/'))
+    for x in [
+        'extension/fts/fts_extension.cpp',
+        'extension/fts/fts_index.cpp',
+        'extension/fts/fts_indexing.cpp',
+        'extension/fts/fts_search.cpp',
+    ]
 ]
 # snowball
 source_files += [
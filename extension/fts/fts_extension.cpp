@@ -8,6 +8,7 @@
 #include "duckdb/function/scalar_function.hpp"
 #include "duckdb/main/extension_util.hpp"
 #include "fts_indexing.hpp"
+#include "fts_search.hpp"
 #include "libstemmer.h"
 
 namespace duckdb {
@@ -66,6 +67,8 @@ static void LoadInternal(DuckDB &db) {
 	ExtensionUtil::RegisterFunction(db_instance, stem_func);
 	ExtensionUtil::RegisterFunction(db_instance, create_fts_index_func);
 	ExtensionUtil::RegisterFunction(db_instance, drop_fts_index_func);
+	ExtensionUtil::RegisterFunction(db_instance, FTSSearch::GetMatchFunction());
+	ExtensionUtil::RegisterFunction(db_instance, FTSSearch::GetSearchFunction());
 }
 
 void FtsExtension::Load(DuckDB &db) {
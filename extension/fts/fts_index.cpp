@@ -0,0 +1,638 @@
+#include "fts_index.hpp"
+
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/parser/qualified_name.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Posting Lists
+//===--------------------------------------------------------------------===//
+static void PackValues(vector<data_t> &data, uint32_t *values, idx_t count, bitpacking_width_t width) {
+	if (width == 0) {
+		return;
+	}
+	auto offset = data.size();
+	data.resize(offset + BitpackingPrimitives::GetRequiredSize(count, width));
+	BitpackingPrimitives::PackBuffer<uint32_t, false>(data.data() + offset, values, count, width);
+}
+
+FTSPostingList::FTSPostingList(const vector<pair<uint32_t, uint32_t>> &postings, const vector<uint32_t> &doc_lengths)
+    : max_tf(0), min_len(NumericLimits<uint32_t>::Maximum()) {
+	D_ASSERT(!postings.empty());
+	uint32_t deltas[FTS_POSTING_BLOCK_SIZE];
+	uint32_t tfs[FTS_POSTING_BLOCK_SIZE];
+	for (idx_t block_start = 0; block_start < postings.size(); block_start += FTS_POSTING_BLOCK_SIZE) {
+		auto count = MinValue<idx_t>(FTS_POSTING_BLOCK_SIZE, postings.size() - block_start);
+		FTSPostingBlock block;
+		block.max_tf = 0;
+		block.min_len = NumericLimits<uint32_t>::Maximum();
+		// the first document is stored relative to the last document of the previous block
+		uint32_t previous = blocks.empty() ? 0 : blocks.back().last_doc + 1;
+		for (idx_t i = 0; i < count; i++) {
+			auto &posting = postings[block_start + i];
+			deltas[i] = posting.first - previous;
+			previous = posting.first + 1;
+			tfs[i] = posting.second - 1;
+			block.max_tf = MaxValue(block.max_tf, posting.second);
+			block.min_len = MinValue(block.min_len, doc_lengths[posting.first]);
+		}
+		block.last_doc = postings[block_start + count - 1].first;
+		block.offset = NumericCast<uint32_t>(data.size());
+		block.count = NumericCast<uint16_t>(count);
+		block.doc_width = BitpackingPrimitives::MinimumBitWidth<uint32_t>(deltas, count);
+		block.tf_width = BitpackingPrimitives::MinimumBitWidth<uint32_t>(tfs, count);
+		PackValues(data, deltas, count, block.doc_width);
+		PackValues(data, tfs, count, block.tf_width);
+
+		max_tf = MaxValue(max_tf, block.max_tf);
+		min_len = MinValue(min_len, block.min_len);
+		blocks.push_back(block);
+	}
+	data.shrink_to_fit();
+}
+
+FTSPostingCursor::FTSPostingCursor(const FTSPostingList &list)
+    : list(list), block_idx(0), position(0), shallow_block_idx(0) {
+	DecodeBlock();
+}
+
+static void UnpackValues(const FTSPostingList &list, idx_t offset, uint32_t *values, idx_t count,
+                         bitpacking_width_t width) {
+	if (width == 0) {
+		memset(values, 0, count * sizeof(uint32_t));
+		return;
+	}
+	auto src = const_cast<data_ptr_t>(list.data.data() + offset);
+	BitpackingPrimitives::UnPackBuffer<uint32_t>(data_ptr_cast(values), src, count, width);
+}
+
+void FTSPostingCursor::DecodeBlock() {
+	position = 0;
+	if (Done()) {
+		return;
+	}
+	auto &block = list.blocks[block_idx];
+	// the unpacking works on groups of values, the buffers are large enough to hold the padding of the last group
+	UnpackValues(list, block.offset, docs, block.count, block.doc_width);
+	auto tf_offset = block.offset + BitpackingPrimitives::GetRequiredSize(block.count, block.doc_width);
+	UnpackValues(list, tf_offset, tfs, block.count, block.tf_width);
+
+	uint32_t previous = block_idx == 0 ? 0 : list.blocks[block_idx - 1].last_doc + 1;
+	for (idx_t i = 0; i < block.count; i++) {
+		docs[i] += previous;
+		previous = docs[i] + 1;
+		tfs[i]++;
+	}
+}
+
+void FTSPostingCursor::Next() {
+	position++;
+	if (position >= list.blocks[block_idx].count) {
+		block_idx++;
+		DecodeBlock();
+	}
+}
+
+void FTSPostingCursor::Seek(uint32_t target) {
+	if (Done() || Doc() >= target) {
+		return;
+	}
+	// skip the blocks that end before the target without decompressing them
+	if (list.blocks[block_idx].last_doc < target) {
+		while (block_idx < list.blocks.size() && list.blocks[block_idx].last_doc < target) {
+			block_idx++;
+		}
+		DecodeBlock();
+		if (Done()) {
+			return;
+		}
+	}
+	while (Doc() < target) {
+		position++;
+	}
+}
+
+optional_ptr<const FTSPostingBlock> FTSPostingCursor::ShallowSeek(uint32_t target) {
+	shallow_block_idx = MaxValue(shallow_block_idx, block_idx);
+	while (shallow_block_idx < list.blocks.size() && list.blocks[shallow_block_idx].last_doc < target) {
+		shallow_block_idx++;
+	}
+	if (shallow_block_idx >= list.blocks.size()) {
+		return nullptr;
+	}
+	return &list.blocks[shallow_block_idx];
+}
+
+//===--------------------------------------------------------------------===//
+// Index Construction
+//===--------------------------------------------------------------------===//
+static void ParseFTSSchema(const string &fts_schema, string &catalog, string &schema) {
+	auto qname = QualifiedName::Parse(fts_schema);
+	catalog = qname.schema == INVALID_SCHEMA ? INVALID_CATALOG : qname.schema;
+	schema = qname.name;
+}
+
+static void ScanTable(ClientContext &context, TableCatalogEntry &table, const vector<string> &columns,
+                      const std::function<void(DataChunk &chunk)> &callback) {
+	if (!table.IsDuckTable()) {
+		throw InvalidInputException("FTS index table \"%s\" is not stored in a DuckDB database", table.name);
+	}
+	auto &storage = table.GetStorage();
+	auto &transaction = DuckTransaction::Get(context, table.catalog);
+	vector<column_t> column_ids;
+	vector<LogicalType> types;
+	for (auto &name : columns) {
+		auto &column = table.GetColumn(name);
+		column_ids.push_back(column.StorageOid());
+		types.push_back(column.Type());
+	}
+	TableScanState state;
+	storage.InitializeScan(transaction, state, column_ids);
+
+	DataChunk chunk;
+	chunk.Initialize(context, types);
+	while (true) {
+		chunk.Reset();
+		storage.Scan(transaction, chunk, state);
+		if (chunk.size() == 0) {
+			break;
+		}
+		// the id and count columns are BIGINT, but older versions of the extension created them as INTEGER
+		for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+			auto &type = chunk.data[col_idx].GetType();
+			if (type.IsIntegral() && type.id() != LogicalTypeId::BIGINT) {
+				Vector bigint_vector(LogicalType::BIGINT, chunk.size());
+				VectorOperations::Cast(context, chunk.data[col_idx], bigint_vector, chunk.size());
+				chunk.data[col_idx].Reference(bigint_vector);
+			}
+		}
+		callback(chunk);
+	}
+}
+
+template <class T>
+static const T *GetColumnData(Vector &vector, idx_t count, UnifiedVectorFormat &format) {
+	vector.ToUnifiedFormat(count, format);
+	return UnifiedVectorFormat::GetData<T>(format);
+}
+
+shared_ptr<FTSIndex> FTSIndex::Get(ClientContext &context, const string &fts_schema) {
+	string catalog_name, schema_name;
+	ParseFTSSchema(fts_schema, catalog_name, schema_name);
+	auto &docs = Catalog::GetEntry<TableCatalogEntry>(context, catalog_name, schema_name, "docs");
+	auto &terms = Catalog::GetEntry<TableCatalogEntry>(context, catalog_name, schema_name, "terms");
+	auto &dict = Catalog::GetEntry<TableCatalogEntry>(context, catalog_name, schema_name, "dict");
+	auto &stats = Catalog::GetEntry<TableCatalogEntry>(context, catalog_name, schema_name, "stats");
+	auto &fields = Catalog::GetEntry<TableCatalogEntry>(context, catalog_name, schema_name, "fields");
+	vector<idx_t> table_oids {docs.oid, terms.oid, dict.oid, stats.oid, fields.oid};
+
+	// the tables get new oids whenever the FTS schema is recreated, so an index with the same oids is up-to-date
+	auto &cache = ObjectCache::GetObjectCache(context);
+	auto cache_key = "fts_index_" + docs.catalog.GetName() + "." + schema_name;
+	auto cached = cache.Get<FTSIndex>(cache_key);
+	if (cached && cached->table_oids == table_oids) {
+		return cached;
+	}
+
+	auto result = make_shared_ptr<FTSIndex>();
+	result->table_oids = std::move(table_oids);
+	result->name_type = docs.GetColumn("name").Type();
+
+	// the documents, the ids of the index are the positions of the documents in docid order
+	vector<pair<int64_t, pair<Value, uint32_t>>> doc_entries;
+	ScanTable(context, docs, {"docid", "name", "len"}, [&](DataChunk &chunk) {
+		UnifiedVectorFormat docid_format, len_format;
+		auto docids = GetColumnData<int64_t>(chunk.data[0], chunk.size(), docid_format);
+		auto lens = GetColumnData<int64_t>(chunk.data[2], chunk.size(), len_format);
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			auto docid_idx = docid_format.sel->get_index(i);
+			auto len_idx = len_format.sel->get_index(i);
+			auto len = len_format.validity.RowIsValid(len_idx) ? NumericCast<uint32_t>(lens[len_idx]) : 0;
+			doc_entries.emplace_back(docids[docid_idx], make_pair(chunk.data[1].GetValue(i), len));
+		}
+	});
+	std::sort(doc_entries.begin(), doc_entries.end(),
+	          [](const pair<int64_t, pair<Value, uint32_t>> &a, const pair<int64_t, pair<Value, uint32_t>> &b) {
+		          return a.first < b.first;
+	          });
+	unordered_map<int64_t, uint32_t> docid_map;
+	for (auto &entry : doc_entries) {
+		auto doc = NumericCast<uint32_t>(result->doc_names.size());
+		docid_map[entry.first] = doc;
+		auto &name = entry.second.first;
+		if (!name.IsNull() && result->doc_map.find(name) == result->doc_map.end()) {
+			result->doc_map[name] = doc;
+		}
+		result->doc_names.push_back(std::move(name));
+		result->doc_lengths.push_back(entry.second.second);
+	}
+	doc_entries.clear();
+
+	ScanTable(context, stats, {"num_docs", "avgdl"}, [&](DataChunk &chunk) {
+		auto num_docs = chunk.data[0].GetValue(0);
+		auto avgdl = chunk.data[1].GetValue(0);
+		result->num_docs = num_docs.IsNull() ? 0 : num_docs.GetValue<double>();
+		result->avgdl = avgdl.IsNull() ? 0 : avgdl.GetValue<double>();
+	});
+
+	ScanTable(context, fields, {"fieldid", "field"}, [&](DataChunk &chunk) {
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			auto fieldid = chunk.data[0].GetValue(i);
+			auto field = chunk.data[1].GetValue(i);
+			if (!fieldid.IsNull() && !field.IsNull()) {
+				result->field_map[field.GetValue<string>()] = fieldid.GetValue<idx_t>();
+			}
+		}
+	});
+
+	unordered_map<int64_t, idx_t> termid_map;
+	ScanTable(context, dict, {"termid", "term", "df"}, [&](DataChunk &chunk) {
+		UnifiedVectorFormat termid_format, df_format;
+		auto termids = GetColumnData<int64_t>(chunk.data[0], chunk.size(), termid_format);
+		auto dfs = GetColumnData<int64_t>(chunk.data[2], chunk.size(), df_format);
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			auto termid_idx = termid_format.sel->get_index(i);
+			auto df_idx = df_format.sel->get_index(i);
+			auto term = chunk.data[1].GetValue(i);
+			if (!termid_format.validity.RowIsValid(termid_idx) || term.IsNull()) {
+				continue;
+			}
+			auto term_idx = result->document_frequencies.size();
+			termid_map[termids[termid_idx]] = term_idx;
+			result->term_map[term.GetValue<string>()] = term_idx;
+			auto df = df_format.validity.RowIsValid(df_idx) ? NumericCast<idx_t>(dfs[df_idx]) : 0;
+			result->document_frequencies.push_back(df);
+		}
+	});
+
+	// collect the documents per term and field, every occurrence of a term in a document is a row of the terms table
+	vector<unordered_map<idx_t, vector<uint32_t>>> occurrences(result->document_frequencies.size());
+	ScanTable(context, terms, {"docid", "fieldid", "termid"}, [&](DataChunk &chunk) {
+		UnifiedVectorFormat docid_format, fieldid_format, termid_format;
+		auto docids = GetColumnData<int64_t>(chunk.data[0], chunk.size(), docid_format);
+		auto fieldids = GetColumnData<int64_t>(chunk.data[1], chunk.size(), fieldid_format);
+		auto termids = GetColumnData<int64_t>(chunk.data[2], chunk.size(), termid_format);
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			auto docid_idx = docid_format.sel->get_index(i);
+			auto fieldid_idx = fieldid_format.sel->get_index(i);
+			auto termid_idx = termid_format.sel->get_index(i);
+			if (!docid_format.validity.RowIsValid(docid_idx) || !fieldid_format.validity.RowIsValid(fieldid_idx) ||
+			    !termid_format.validity.RowIsValid(termid_idx)) {
+				continue;
+			}
+			auto doc_entry = docid_map.find(docids[docid_idx]);
+			auto term_entry = termid_map.find(termids[termid_idx]);
+			if (doc_entry == docid_map.end() || term_entry == termid_map.end()) {
+				continue;
+			}
+			occurrences[term_entry->second][NumericCast<idx_t>(fieldids[fieldid_idx])].push_back(doc_entry->second);
+		}
+	});
+
+	// compress the occurrences into posting lists of (doc, tf)
+	result->postings.resize(occurrences.size());
+	vector<pair<uint32_t, uint32_t>> term_postings;
+	for (idx_t term_idx = 0; term_idx < occurrences.size(); term_idx++) {
+		for (auto &field_entry : occurrences[term_idx]) {
+			auto &docs_of_term = field_entry.second;
+			std::sort(docs_of_term.begin(), docs_of_term.end());
+			term_postings.clear();
+			for (auto &doc : docs_of_term) {
+				if (!term_postings.empty() && term_postings.back().first == doc) {
+					term_postings.back().second++;
+				} else {
+					term_postings.emplace_back(doc, 1);
+				}
+			}
+			result->postings[term_idx][field_entry.first] =
+			    make_uniq<FTSPostingList>(term_postings, result->doc_lengths);
+			// free the occurrences as we go, they are much larger than the compressed postings
+			vector<uint32_t>().swap(docs_of_term);
+		}
+	}
+
+	cache.Put(cache_key, result);
+	return result;
+}
+
+void FTSIndex::Invalidate(ClientContext &context, const string &fts_schema) {
+	string catalog_name, schema_name;
+	ParseFTSSchema(fts_schema, catalog_name, schema_name);
+	auto &catalog = Catalog::GetCatalog(context, catalog_name);
+	ObjectCache::GetObjectCache(context).Delete("fts_index_" + catalog.GetName() + "." + schema_name);
+}
+
+optional_idx FTSIndex::FindDocument(const Value &name) const {
+	auto entry = doc_map.find(name);
+	if (entry == doc_map.end()) {
+		return optional_idx();
+	}
+	return entry->second;
+}
+
+//===--------------------------------------------------------------------===//
+// Query Evaluation
+//===--------------------------------------------------------------------===//
+struct FTSIndex::QueryTerm {
+	double idf;
+	//! The posting lists of the term in the searched fields
+	vector<reference<const FTSPostingList>> lists;
+};
+
+bool FTSIndex::GetQueryTerms(const FTSQuery &query, vector<QueryTerm> &result) const {
+	vector<idx_t> field_ids;
+	for (auto &field : query.fields) {
+		auto entry = field_map.find(field);
+		if (entry != field_map.end()) {
+			field_ids.push_back(entry->second);
+		}
+	}
+	if (!query.fields.empty() && field_ids.empty()) {
+		return false;
+	}
+	for (auto &term : query.terms) {
+		auto entry = term_map.find(term);
+		if (entry == term_map.end()) {
+			continue;
+		}
+		QueryTerm query_term;
+		auto df = double(document_frequencies[entry->second]);
+		query_term.idf = std::log10(((num_docs - df + 0.5) / (df + 0.5)) + 1);
+		auto &term_postings = postings[entry->second];
+		for (auto &posting_entry : term_postings) {
+			if (query.fields.empty() ||
+			    std::find(field_ids.begin(), field_ids.end(), posting_entry.first) != field_ids.end()) {
+				query_term.lists.push_back(*posting_entry.second);
+			}
+		}
+		if (!query_term.lists.empty()) {
+			result.push_back(std::move(query_term));
+		}
+	}
+	if (query.conjunctive && result.size() < query.terms.size()) {
+		// a query term that is not in the searched fields of any document
+		return false;
+	}
+	return !result.empty();
+}
+
+double FTSIndex::Score(const FTSQuery &query, double idf, uint32_t tf, uint32_t doc) const {
+	auto len = double(doc_lengths[doc]);
+	return idf * ((tf * (query.k + 1)) / (tf + query.k * (1 - query.b + query.b * (len / avgdl))));
+}
+
+vector<FTSMatch> FTSIndex::Match(const FTSQuery &query) const {
+	vector<FTSMatch> result;
+	vector<QueryTerm> query_terms;
+	if (!GetQueryTerms(query, query_terms)) {
+		return result;
+	}
+	// doc -> (score, number of matched terms)
+	unordered_map<uint32_t, pair<double, idx_t>> scores;
+	unordered_map<uint32_t, uint32_t> term_frequencies;
+	for (auto &query_term : query_terms) {
+		term_frequencies.clear();
+		for (auto &list : query_term.lists) {
+			for (FTSPostingCursor cursor(list); !cursor.Done(); cursor.Next()) {
+				term_frequencies[cursor.Doc()] += cursor.TermFrequency();
+			}
+		}
+		for (auto &entry : term_frequencies) {
+			auto &score = scores[entry.first];
+			score.first += Score(query, query_term.idf, entry.second, entry.first);
+			score.second++;
+		}
+	}
+	for (auto &entry : scores) {
+		if (query.conjunctive && entry.second.second < query.terms.size()) {
+			continue;
+		}
+		result.push_back(FTSMatch {entry.first, entry.second.first});
+	}
+	return result;
+}
+
+namespace {
+
+//! Iterates over the documents that contain a query term in any of the searched fields
+class FTSTermCursor {
+public:
+	FTSTermCursor(const vector<reference<const FTSPostingList>> &lists, double idf) : idf(idf), max_tf(0) {
+		min_len = NumericLimits<uint32_t>::Maximum();
+		for (auto &list : lists) {
+			cursors.emplace_back(list);
+			max_tf += list.get().max_tf;
+			min_len = MinValue(min_len, list.get().min_len);
+		}
+		UpdateDoc();
+	}
+
+	bool Done() const {
+		return doc == NumericLimits<uint32_t>::Maximum();
+	}
+	uint32_t Doc() const {
+		return doc;
+	}
+	uint32_t TermFrequency() const {
+		uint32_t tf = 0;
+		for (auto &cursor : cursors) {
+			if (!cursor.Done() && cursor.Doc() == doc) {
+				tf += cursor.TermFrequency();
+			}
+		}
+		return tf;
+	}
+	void Seek(uint32_t target) {
+		for (auto &cursor : cursors) {
+			cursor.Seek(target);
+		}
+		UpdateDoc();
+	}
+	void Next() {
+		Seek(doc + 1);
+	}
+	//! Bounds the term frequency and document length of the documents >= target up to the returned block end
+	uint32_t ShallowSeek(uint32_t target, uint32_t &block_max_tf, uint32_t &block_min_len) {
+		uint32_t block_end = NumericLimits<uint32_t>::Maximum();
+		block_max_tf = 0;
+		block_min_len = NumericLimits<uint32_t>::Maximum();
+		for (auto &cursor : cursors) {
+			auto block = cursor.ShallowSeek(target);
+			if (!block) {
+				continue;
+			}
+			block_end = MinValue(block_end, block->last_doc);
+			block_max_tf += block->max_tf;
+			block_min_len = MinValue(block_min_len, block->min_len);
+		}
+		return block_end;
+	}
+
+	double idf;
+	//! The bounds of the term over all documents
+	uint32_t max_tf;
+	uint32_t min_len;
+	double upper_bound = 0;
+
+private:
+	void UpdateDoc() {
+		doc = NumericLimits<uint32_t>::Maximum();
+		for (auto &cursor : cursors) {
+			if (!cursor.Done()) {
+				doc = MinValue(doc, cursor.Doc());
+			}
+		}
+	}
+
+private:
+	vector<FTSPostingCursor> cursors;
+	uint32_t doc;
+};
+
+struct FTSMatchCompare {
+	//! Orders the worst match first: the lowest score, and the highest document among equal scores
+	bool operator()(const FTSMatch &a, const FTSMatch &b) const {
+		if (a.score != b.score) {
+			return a.score > b.score;
+		}
+		return a.doc < b.doc;
+	}
+};
+
+} // namespace
+
+vector<FTSMatch> FTSIndex::Search(const FTSQuery &query, idx_t top_k) const {
+	vector<FTSMatch> result;
+	vector<QueryTerm> query_terms;
+	if (top_k == 0 || !GetQueryTerms(query, query_terms)) {
+		return result;
+	}
+	// the score is monotonic in the term frequency and document length only for the usual parameters
+	bool prune = query.k >= 0 && query.b >= 0 && query.b <= 1;
+	auto upper_bound = [&](const FTSTermCursor &term, uint32_t max_tf, uint32_t min_len) {
+		if (!prune) {
+			return NumericLimits<double>::Maximum();
+		}
+		auto len = double(min_len);
+		return term.idf * ((max_tf * (query.k + 1)) / (max_tf + query.k * (1 - query.b + query.b * (len / avgdl))));
+	};
+
+	vector<unique_ptr<FTSTermCursor>> terms;
+	for (auto &query_term : query_terms) {
+		auto term = make_uniq<FTSTermCursor>(query_term.lists, query_term.idf);
+		term->upper_bound = upper_bound(*term, term->max_tf, term->min_len);
+		terms.push_back(std::move(term));
+	}
+
+	std::priority_queue<FTSMatch, vector<FTSMatch>, FTSMatchCompare> heap;
+	auto threshold = [&]() {
+		return heap.size() < top_k ? -NumericLimits<double>::Maximum() : heap.top().score;
+	};
+	vector<reference<FTSTermCursor>> order;
+	while (true) {
+		// order the terms by their current document
+		order.clear();
+		for (auto &term : terms) {
+			if (!term->Done()) {
+				order.push_back(*term);
+			}
+		}
+		if (order.empty()) {
+			break;
+		}
+		std::sort(order.begin(), order.end(), [](const FTSTermCursor &a, const FTSTermCursor &b) {
+			return a.Doc() < b.Doc();
+		});
+
+		// find the pivot: the first document whose terms can reach the top-k
+		double bound_sum = 0;
+		optional_idx pivot;
+		for (idx_t i = 0; i < order.size(); i++) {
+			bound_sum += order[i].get().upper_bound;
+			if (bound_sum >= threshold()) {
+				pivot = i;
+				break;
+			}
+		}
+		if (!pivot.IsValid()) {
+			break;
+		}
+		auto pivot_idx = pivot.GetIndex();
+		auto pivot_doc = order[pivot_idx].get().Doc();
+		// include the terms after the pivot that are on the same document
+		while (pivot_idx + 1 < order.size() && order[pivot_idx + 1].get().Doc() == pivot_doc) {
+			pivot_idx++;
+		}
+
+		// check the bound of the blocks that hold the pivot before decompressing them
+		double block_bound = 0;
+		uint32_t next_doc = NumericLimits<uint32_t>::Maximum();
+		for (idx_t i = 0; i <= pivot_idx; i++) {
+			uint32_t block_max_tf, block_min_len;
+			auto block_end = order[i].get().ShallowSeek(pivot_doc, block_max_tf, block_min_len);
+			block_bound += upper_bound(order[i], block_max_tf, block_min_len);
+			next_doc = MinValue(next_doc, block_end);
+		}
+		if (block_bound < threshold()) {
+			// no document up to the end of the first of these blocks can reach the top-k
+			if (next_doc != NumericLimits<uint32_t>::Maximum()) {
+				next_doc++;
+			}
+			if (pivot_idx + 1 < order.size()) {
+				next_doc = MinValue(next_doc, order[pivot_idx + 1].get().Doc());
+			}
+			next_doc = MaxValue(next_doc, pivot_doc + 1);
+			for (idx_t i = 0; i <= pivot_idx; i++) {
+				order[i].get().Seek(next_doc);
+			}
+			continue;
+		}
+
+		if (order[0].get().Doc() != pivot_doc) {
+			// move the terms before the pivot to the pivot document
+			for (idx_t i = 0; i < pivot_idx; i++) {
+				order[i].get().Seek(pivot_doc);
+			}
+			continue;
+		}
+
+		// all terms of the pivot are on the pivot document: score it
+		double score = 0;
+		idx_t matched_terms = 0;
+		for (idx_t i = 0; i <= pivot_idx; i++) {
+			auto &term = order[i].get();
+			score += Score(query, term.idf, term.TermFrequency(), pivot_doc);
+			matched_terms++;
+			term.Next();
+		}
+		if (query.conjunctive && matched_terms < query.terms.size()) {
+			continue;
+		}
+		FTSMatch match {pivot_doc, score};
+		if (heap.size() < top_k) {
+			heap.push(match);
+		} else if (FTSMatchCompare()(match, heap.top())) {
+			heap.pop();
+			heap.push(match);
+		}
+	}
+
+	while (!heap.empty()) {
+		result.push_back(heap.top());
+		heap.pop();
+	}
+	std::reverse(result.begin(), result.end());
+	return result;
+}
+
+} // namespace duckdb
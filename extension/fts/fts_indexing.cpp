@@ -7,6 +7,7 @@
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/parser/qualified_name.hpp"
+#include "fts_index.hpp"
 
 namespace duckdb {
 
@@ -34,6 +35,7 @@ string FTSIndexing::DropFTSIndexQuery(ClientContext &context, const FunctionPara
 		    qname.name);
 	}
 
+	FTSIndex::Invalidate(context, fts_schema);
 	return StringUtil::Format("DROP SCHEMA %s CASCADE;", fts_schema);
 }
 
@@ -149,69 +151,11 @@ static string IndexingScript(ClientContext &context, QualifiedName &qname, const
             FROM %fts_schema%.docs AS docs
         );
 
-        CREATE MACRO %fts_schema%.match_bm25(docname, query_string, fields := NULL, k := 1.2, b := 0.75, conjunctive := false) AS (
-            WITH tokens AS (
-                SELECT DISTINCT stem(unnest(%fts_schema%.tokenize(query_string)), '%stemmer%') AS t
-            ),
-            fieldids AS (
-                SELECT fieldid
-                FROM %fts_schema%.fields
-                WHERE CASE WHEN fields IS NULL THEN 1 ELSE field IN (SELECT * FROM (SELECT UNNEST(string_split(fields, ','))) AS fsq) END
-            ),
-            qtermids AS (
-                SELECT termid
-                FROM %fts_schema%.dict AS dict,
-                     tokens
-                WHERE dict.term = tokens.t
-            ),
-            qterms AS (
-                SELECT termid,
-                       docid
-                FROM %fts_schema%.terms AS terms
-                WHERE CASE WHEN fields IS NULL THEN 1 ELSE fieldid IN (SELECT * FROM fieldids) END
-                  AND termid IN (SELECT qtermids.termid FROM qtermids)
-            ),
-			term_tf AS (
-				SELECT termid,
-				   	   docid,
-                       COUNT(*) AS tf
-				FROM qterms
-				GROUP BY docid,
-						 termid
-			),
-			cdocs AS (
-				SELECT docid
-				FROM qterms
-				GROUP BY docid
-				HAVING CASE WHEN conjunctive THEN COUNT(DISTINCT termid) = (SELECT COUNT(*) FROM tokens) ELSE 1 END
-			),
-            subscores AS (
-                SELECT docs.docid,
-                       len,
-                       term_tf.termid,
-                       tf,
-                       df,
-                       (log(((SELECT num_docs FROM %fts_schema%.stats) - df + 0.5) / (df + 0.5) + 1) * ((tf * (k + 1)/(tf + k * (1 - b + b * (len / (SELECT avgdl FROM %fts_schema%.stats))))))) AS subscore
-                FROM term_tf,
-					 cdocs,
-					 %fts_schema%.docs AS docs,
-					 %fts_schema%.dict AS dict
-				WHERE term_tf.docid = cdocs.docid
-				  AND term_tf.docid = docs.docid
-                  AND term_tf.termid = dict.termid
-            ),
-			scores AS (
-				SELECT docid,
-					   sum(subscore) AS score
-				FROM subscores
-				GROUP BY docid
-			)
-            SELECT score
-            FROM scores,
-				 %fts_schema%.docs AS docs
-            WHERE scores.docid = docs.docid
-              AND docs.name = docname
-        );
+        CREATE MACRO %fts_schema%.match_bm25(docname, query_string, fields := NULL, k := 1.2, b := 0.75, conjunctive := false) AS
+            fts_match_bm25('%fts_schema%', docname, %fts_schema%.tokenize(query_string), '%stemmer%', fields, k, b, conjunctive);
+
+        CREATE MACRO %fts_schema%.search_bm25(query_string, top_k := 10, fields := NULL, k := 1.2, b := 0.75, conjunctive := false) AS TABLE
+            SELECT * FROM fts_search_bm25('%fts_schema%', %fts_schema%.tokenize(query_string), '%stemmer%', fields, k, b, conjunctive, top_k);
     )";
 
     // we may have more than 1 input field, therefore we union over the fields, retaining information which field it came from
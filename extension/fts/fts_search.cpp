@@ -0,0 +1,268 @@
+#include "fts_search.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "fts_index.hpp"
+#include "libstemmer.h"
+
+namespace duckdb {
+
+//! Builds a query from the (unstemmed) tokens of the tokenize macro and the parameters of the BM25 macros
+static FTSQuery CreateQuery(const Value &tokens, const string &stemmer, const Value &fields, const Value &k,
+                            const Value &b, const Value &conjunctive) {
+	FTSQuery query;
+	struct sb_stemmer *s = nullptr;
+	if (stemmer != "none") {
+		s = sb_stemmer_new(stemmer.c_str(), "UTF_8");
+		if (!s) {
+			throw InvalidInputException("Unrecognized stemmer '%s'", stemmer);
+		}
+	}
+	unordered_set<string> distinct_terms;
+	for (auto &token : ListValue::GetChildren(tokens)) {
+		if (token.IsNull()) {
+			continue;
+		}
+		auto term = StringValue::Get(token);
+		if (s) {
+			auto stemmed = sb_stemmer_stem(s, reinterpret_cast<const sb_symbol *>(term.c_str()),
+			                               NumericCast<int>(term.size()));
+			term = string(const_char_ptr_cast(stemmed), NumericCast<idx_t>(sb_stemmer_length(s)));
+		}
+		if (distinct_terms.insert(term).second) {
+			query.terms.push_back(std::move(term));
+		}
+	}
+	if (s) {
+		sb_stemmer_delete(s);
+	}
+	if (!fields.IsNull()) {
+		// the fields are separated by commas, as in the SQL index
+		query.fields = StringUtil::Split(StringValue::Get(fields), ',');
+		if (query.fields.empty()) {
+			query.fields.emplace_back();
+		}
+	}
+	query.k = k.GetValue<double>();
+	query.b = b.GetValue<double>();
+	query.conjunctive = !conjunctive.IsNull() && BooleanValue::Get(conjunctive);
+	return query;
+}
+
+static shared_ptr<FTSIndex> GetIndex(ClientContext &context, Expression &fts_schema_expr, const string &function) {
+	if (!fts_schema_expr.IsFoldable()) {
+		throw BinderException("%s: the FTS schema must be a constant", function);
+	}
+	auto fts_schema = ExpressionExecutor::EvaluateScalar(context, fts_schema_expr);
+	if (fts_schema.IsNull()) {
+		throw BinderException("%s: the FTS schema cannot be NULL", function);
+	}
+	return FTSIndex::Get(context, StringValue::Get(fts_schema));
+}
+
+//===--------------------------------------------------------------------===//
+// fts_match_bm25
+//===--------------------------------------------------------------------===//
+struct FTSMatchBindData : public FunctionData {
+	explicit FTSMatchBindData(shared_ptr<FTSIndex> index_p) : index(std::move(index_p)) {
+	}
+
+	shared_ptr<FTSIndex> index;
+
+public:
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<FTSMatchBindData>(index);
+	}
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<FTSMatchBindData>();
+		return index == other.index;
+	}
+};
+
+struct FTSMatchLocalState : public FunctionLocalState {
+	//! The query parameters the scores were computed for
+	vector<Value> query_parameters;
+	//! Whether the query has a NULL parameter, in which case all scores are NULL
+	bool null_query = false;
+	unordered_map<idx_t, double> scores;
+};
+
+static unique_ptr<FunctionData> FTSMatchBind(ClientContext &context, ScalarFunction &bound_function,
+                                             vector<unique_ptr<Expression>> &arguments) {
+	auto index = GetIndex(context, *arguments[0], bound_function.name);
+	// the document names are compared as the type of the name column of the index
+	bound_function.arguments[1] = index->GetNameType();
+	return make_uniq<FTSMatchBindData>(std::move(index));
+}
+
+static unique_ptr<FunctionLocalState> FTSMatchInitLocalState(ExpressionState &state,
+                                                             const BoundFunctionExpression &expr,
+                                                             FunctionData *bind_data) {
+	return make_uniq<FTSMatchLocalState>();
+}
+
+static void UpdateQueryScores(const FTSIndex &index, FTSMatchLocalState &lstate, DataChunk &args, idx_t row) {
+	vector<Value> query_parameters;
+	for (idx_t col_idx = 2; col_idx < args.ColumnCount(); col_idx++) {
+		query_parameters.push_back(args.data[col_idx].GetValue(row));
+	}
+	if (query_parameters.size() == lstate.query_parameters.size()) {
+		bool same_query = true;
+		for (idx_t i = 0; i < query_parameters.size(); i++) {
+			if (!Value::NotDistinctFrom(query_parameters[i], lstate.query_parameters[i])) {
+				same_query = false;
+				break;
+			}
+		}
+		if (same_query) {
+			return;
+		}
+	}
+	// the query is evaluated on the index once, after which the score of every document is a lookup
+	lstate.query_parameters = std::move(query_parameters);
+	lstate.scores.clear();
+	auto &tokens = lstate.query_parameters[0];
+	auto &stemmer = lstate.query_parameters[1];
+	auto &k = lstate.query_parameters[3];
+	auto &b = lstate.query_parameters[4];
+	lstate.null_query = tokens.IsNull() || stemmer.IsNull() || k.IsNull() || b.IsNull();
+	if (lstate.null_query) {
+		return;
+	}
+	auto query = CreateQuery(tokens, StringValue::Get(stemmer), lstate.query_parameters[2], k, b,
+	                         lstate.query_parameters[5]);
+	for (auto &match : index.Match(query)) {
+		lstate.scores[match.doc] = match.score;
+	}
+}
+
+static void FTSMatchFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &index = *func_expr.bind_info->Cast<FTSMatchBindData>().index;
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<FTSMatchLocalState>();
+
+	// the query is usually constant, in which case it is only compared once per chunk
+	bool constant_query = true;
+	for (idx_t col_idx = 2; col_idx < args.ColumnCount(); col_idx++) {
+		if (args.data[col_idx].GetVectorType() != VectorType::CONSTANT_VECTOR) {
+			constant_query = false;
+		}
+	}
+	auto &docnames = args.data[1];
+	auto count = args.size();
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<double>(result);
+	auto &result_validity = FlatVector::Validity(result);
+	for (idx_t i = 0; i < count; i++) {
+		if (!constant_query || i == 0) {
+			UpdateQueryScores(index, lstate, args, i);
+		}
+		auto docname = docnames.GetValue(i);
+		if (lstate.null_query || docname.IsNull()) {
+			result_validity.SetInvalid(i);
+			continue;
+		}
+		auto doc = index.FindDocument(docname);
+		if (!doc.IsValid()) {
+			result_validity.SetInvalid(i);
+			continue;
+		}
+		auto entry = lstate.scores.find(doc.GetIndex());
+		if (entry == lstate.scores.end()) {
+			result_validity.SetInvalid(i);
+			continue;
+		}
+		result_data[i] = entry->second;
+	}
+	if (args.AllConstant()) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+ScalarFunction FTSSearch::GetMatchFunction() {
+	ScalarFunction function("fts_match_bm25",
+	                        {LogicalType::VARCHAR, LogicalType::ANY, LogicalType::LIST(LogicalType::VARCHAR),
+	                         LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::DOUBLE, LogicalType::DOUBLE,
+	                         LogicalType::BOOLEAN},
+	                        LogicalType::DOUBLE, FTSMatchFunction, FTSMatchBind, nullptr, nullptr,
+	                        FTSMatchInitLocalState);
+	// the fields are NULL to search all fields
+	function.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	return function;
+}
+
+//===--------------------------------------------------------------------===//
+// fts_search_bm25
+//===--------------------------------------------------------------------===//
+struct FTSSearchBindData : public TableFunctionData {
+	shared_ptr<FTSIndex> index;
+	//! Whether the query has a NULL parameter, in which case no documents match
+	bool null_query = false;
+	FTSQuery query;
+	idx_t top_k = 0;
+};
+
+struct FTSSearchGlobalState : public GlobalTableFunctionState {
+	vector<FTSMatch> matches;
+	idx_t offset = 0;
+};
+
+static unique_ptr<FunctionData> FTSSearchBind(ClientContext &context, TableFunctionBindInput &input,
+                                              vector<LogicalType> &return_types, vector<string> &names) {
+	auto result = make_uniq<FTSSearchBindData>();
+	auto &inputs = input.inputs;
+	if (inputs[0].IsNull()) {
+		throw BinderException("fts_search_bm25: the FTS schema cannot be NULL");
+	}
+	result->index = FTSIndex::Get(context, StringValue::Get(inputs[0]));
+	auto &top_k = inputs[7];
+	if (!top_k.IsNull() && top_k.GetValue<int64_t>() < 0) {
+		throw BinderException("fts_search_bm25: top_k must be positive");
+	}
+	result->null_query =
+	    inputs[1].IsNull() || inputs[2].IsNull() || inputs[4].IsNull() || inputs[5].IsNull() || top_k.IsNull();
+	if (!result->null_query) {
+		result->query = CreateQuery(inputs[1], StringValue::Get(inputs[2]), inputs[3], inputs[4], inputs[5], inputs[6]);
+		result->top_k = top_k.GetValue<idx_t>();
+	}
+
+	names.emplace_back("name");
+	return_types.push_back(result->index->GetNameType());
+	names.emplace_back("score");
+	return_types.emplace_back(LogicalType::DOUBLE);
+	return std::move(result);
+}
+
+static unique_ptr<GlobalTableFunctionState> FTSSearchInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<FTSSearchBindData>();
+	auto result = make_uniq<FTSSearchGlobalState>();
+	if (!bind_data.null_query) {
+		result->matches = bind_data.index->Search(bind_data.query, bind_data.top_k);
+	}
+	return std::move(result);
+}
+
+static void FTSSearchFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<FTSSearchBindData>();
+	auto &state = data_p.global_state->Cast<FTSSearchGlobalState>();
+	idx_t count = 0;
+	while (state.offset < state.matches.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &match = state.matches[state.offset++];
+		output.SetValue(0, count, bind_data.index->GetDocumentName(match.doc));
+		output.SetValue(1, count, Value::DOUBLE(match.score));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+TableFunction FTSSearch::GetSearchFunction() {
+	return TableFunction("fts_search_bm25",
+	                     {LogicalType::VARCHAR, LogicalType::LIST(LogicalType::VARCHAR), LogicalType::VARCHAR,
+	                      LogicalType::VARCHAR, LogicalType::DOUBLE, LogicalType::DOUBLE, LogicalType::BOOLEAN,
+	                      LogicalType::BIGINT},
+	                     FTSSearchFunction, FTSSearchBind, FTSSearchInit);
+}
+
+} // namespace duckdb
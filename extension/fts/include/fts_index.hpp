@@ -0,0 +1,155 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// fts_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/types/value_map.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+
+//! The number of postings that are compressed together in a block of a posting list
+static constexpr const idx_t FTS_POSTING_BLOCK_SIZE = 128;
+
+//! A block of a posting list. The documents are stored as bitpacked deltas and the term frequencies as bitpacked
+//! (tf - 1) values. The largest term frequency and the shortest document of the block bound the BM25 score of the
+//! documents in the block, which is used to skip blocks during top-k evaluation (Block-Max WAND)
+struct FTSPostingBlock {
+	//! The last document of the block
+	uint32_t last_doc;
+	uint32_t max_tf;
+	uint32_t min_len;
+	//! The offset of the compressed block in the data of the posting list
+	uint32_t offset;
+	uint16_t count;
+	bitpacking_width_t doc_width;
+	bitpacking_width_t tf_width;
+};
+
+//! The (compressed) documents of one field that contain a term, ordered by document
+class FTSPostingList {
+public:
+	//! Compresses the postings (doc, tf), which must be ordered by document
+	FTSPostingList(const vector<pair<uint32_t, uint32_t>> &postings, const vector<uint32_t> &doc_lengths);
+
+	vector<FTSPostingBlock> blocks;
+	vector<data_t> data;
+	//! The largest term frequency and the shortest document of the list
+	uint32_t max_tf;
+	uint32_t min_len;
+};
+
+//! Iterates over the postings of a posting list, decompressing a block at a time
+class FTSPostingCursor {
+public:
+	explicit FTSPostingCursor(const FTSPostingList &list);
+
+	bool Done() const {
+		return block_idx >= list.blocks.size();
+	}
+	uint32_t Doc() const {
+		return docs[position];
+	}
+	uint32_t TermFrequency() const {
+		return tfs[position];
+	}
+	void Next();
+	//! Moves to the first posting with a document >= target
+	void Seek(uint32_t target);
+	//! Returns the block that holds the documents >= target without decompressing it, or nullptr if there is none
+	optional_ptr<const FTSPostingBlock> ShallowSeek(uint32_t target);
+
+private:
+	void DecodeBlock();
+
+private:
+	const FTSPostingList &list;
+	idx_t block_idx;
+	idx_t position;
+	//! The block that is moved to by ShallowSeek
+	idx_t shallow_block_idx;
+	uint32_t docs[FTS_POSTING_BLOCK_SIZE];
+	uint32_t tfs[FTS_POSTING_BLOCK_SIZE];
+};
+
+//! The parameters of a BM25 query
+struct FTSQuery {
+	//! The distinct (stemmed) query terms
+	vector<string> terms;
+	//! The fields to search, or all fields if empty
+	vector<string> fields;
+	double k = 1.2;
+	double b = 0.75;
+	//! Whether documents must contain all query terms
+	bool conjunctive = false;
+};
+
+//! A document and its BM25 score
+struct FTSMatch {
+	idx_t doc;
+	double score;
+};
+
+//! The FTSIndex is a native inverted index of the tables that 'create_fts_index' creates in the FTS schema of a table.
+//! It holds a compressed posting list per term and field, and evaluates BM25 queries on them instead of running the
+//! joins and aggregates of the SQL index per query. It is built on first use, and cached until the FTS schema is
+//! (re)created or dropped.
+class FTSIndex : public ObjectCacheEntry {
+public:
+	//! Returns the index of an FTS schema, building it from the tables of the schema if it is not cached yet
+	static shared_ptr<FTSIndex> Get(ClientContext &context, const string &fts_schema);
+	//! Removes the index of an FTS schema from the cache
+	static void Invalidate(ClientContext &context, const string &fts_schema);
+
+	//! Scores all documents that match the query
+	vector<FTSMatch> Match(const FTSQuery &query) const;
+	//! Returns the top_k documents with the highest score, ordered by descending score, using Block-Max WAND
+	vector<FTSMatch> Search(const FTSQuery &query, idx_t top_k) const;
+
+	//! Finds the document with a name
+	optional_idx FindDocument(const Value &name) const;
+	const Value &GetDocumentName(idx_t doc) const {
+		return doc_names[doc];
+	}
+	const LogicalType &GetNameType() const {
+		return name_type;
+	}
+
+public:
+	static string ObjectType() {
+		return "fts_index";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	struct QueryTerm;
+	//! Resolves the posting lists of the query terms, returns false if the query can match no document
+	bool GetQueryTerms(const FTSQuery &query, vector<QueryTerm> &result) const;
+	double Score(const FTSQuery &query, double idf, uint32_t tf, uint32_t doc) const;
+
+private:
+	//! The oids of the tables the index was built from, to detect that the FTS schema was recreated
+	vector<idx_t> table_oids;
+	LogicalType name_type;
+	vector<Value> doc_names;
+	value_map_t<idx_t> doc_map;
+	vector<uint32_t> doc_lengths;
+	double num_docs = 0;
+	double avgdl = 0;
+	unordered_map<string, idx_t> field_map;
+	//! The terms, their document frequency and their posting list per field
+	unordered_map<string, idx_t> term_map;
+	vector<idx_t> document_frequencies;
+	vector<unordered_map<idx_t, unique_ptr<FTSPostingList>>> postings;
+};
+
+} // namespace duckdb
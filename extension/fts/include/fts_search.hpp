@@ -0,0 +1,24 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// fts_search.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/function/table_function.hpp"
+
+namespace duckdb {
+
+//! The functions that evaluate BM25 queries on the native FTS index, used by the match_bm25 and search_bm25 macros
+struct FTSSearch {
+	//! fts_match_bm25(fts_schema, docname, tokens, stemmer, fields, k, b, conjunctive): the score of a document
+	static ScalarFunction GetMatchFunction();
+	//! fts_search_bm25(fts_schema, tokens, stemmer, fields, k, b, conjunctive, top_k): the top-k documents
+	static TableFunction GetSearchFunction();
+};
+
+} // namespace duckdb
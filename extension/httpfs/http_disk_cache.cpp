@@ -0,0 +1,209 @@
+#include "http_disk_cache.hpp"
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "httpfs.hpp"
+
+namespace duckdb {
+
+// Cached blocks consist of a header that identifies the block, followed by the data of the block:
+// "HTDC" | key length (4 bytes) | key | data
+static constexpr const char *BLOCK_CACHE_MAGIC = "HTDC";
+static constexpr const idx_t BLOCK_CACHE_MAGIC_SIZE = 4;
+static constexpr const char *BLOCK_CACHE_PREFIX = "http_block_";
+static constexpr const char *BLOCK_CACHE_TEMP_SUFFIX = ".tmp";
+
+HTTPDiskCache::HTTPDiskCache(string directory_p, idx_t maximum_size)
+    : fs(FileSystem::CreateLocal()), directory(std::move(directory_p)), maximum_size(maximum_size) {
+}
+
+bool HTTPDiskCache::CanCache(HTTPFileHandle &handle) {
+	// without a version, a changed file cannot be told apart from the cached one
+	return !handle.etag.empty() || handle.last_modified != 0;
+}
+
+string HTTPDiskCache::GetBlockKey(HTTPFileHandle &handle, idx_t block_idx) {
+	return handle.path + "\n" + handle.etag + "\n" + to_string(handle.last_modified) + "\n" +
+	       to_string(handle.length) + "\n" + to_string(block_idx);
+}
+
+string HTTPDiskCache::GetBlockPath(const string &key) const {
+	auto key_hash = Hash(key.c_str(), key.size());
+	return fs->JoinPath(directory, BLOCK_CACHE_PREFIX + to_string(key_hash));
+}
+
+static idx_t BlockHeaderSize(const string &key) {
+	return BLOCK_CACHE_MAGIC_SIZE + sizeof(uint32_t) + key.size();
+}
+
+bool HTTPDiskCache::TryRead(const string &key, data_ptr_t buffer, idx_t block_size) {
+	auto file_path = GetBlockPath(key);
+	auto header_size = BlockHeaderSize(key);
+	{
+		lock_guard<mutex> guard(lock);
+		LoadEntries();
+	}
+	unique_ptr<FileHandle> cache_handle;
+	try {
+		cache_handle = fs->OpenFile(file_path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+	} catch (std::exception &) {
+	}
+	if (!cache_handle) {
+		// the block might have been evicted by another process
+		lock_guard<mutex> guard(lock);
+		RemoveEntry(file_path);
+		return false;
+	}
+	if (cache_handle->GetFileSize() != header_size + block_size) {
+		return false;
+	}
+	auto header = unique_ptr<data_t[]>(new data_t[header_size]);
+	cache_handle->Read(header.get(), header_size, 0);
+	if (memcmp(header.get(), BLOCK_CACHE_MAGIC, BLOCK_CACHE_MAGIC_SIZE) != 0 ||
+	    Load<uint32_t>(header.get() + BLOCK_CACHE_MAGIC_SIZE) != key.size() ||
+	    memcmp(header.get() + BLOCK_CACHE_MAGIC_SIZE + sizeof(uint32_t), key.c_str(), key.size()) != 0) {
+		// a different block with the same hash
+		return false;
+	}
+	cache_handle->Read(buffer, block_size, header_size);
+
+	lock_guard<mutex> guard(lock);
+	TouchEntry(file_path, header_size + block_size);
+	return true;
+}
+
+void HTTPDiskCache::Write(const string &key, const_data_ptr_t buffer, idx_t block_size) {
+	auto file_path = GetBlockPath(key);
+	auto header_size = BlockHeaderSize(key);
+	auto header = unique_ptr<data_t[]>(new data_t[header_size]);
+	memcpy(header.get(), BLOCK_CACHE_MAGIC, BLOCK_CACHE_MAGIC_SIZE);
+	Store<uint32_t>(NumericCast<uint32_t>(key.size()), header.get() + BLOCK_CACHE_MAGIC_SIZE);
+	memcpy(header.get() + BLOCK_CACHE_MAGIC_SIZE + sizeof(uint32_t), key.c_str(), key.size());
+
+	// the cache is best-effort: failing to write it does not fail the query
+	auto temp_path = file_path + "." + UUID::ToString(UUID::GenerateRandomUUID()) + BLOCK_CACHE_TEMP_SUFFIX;
+	try {
+		if (!fs->DirectoryExists(directory)) {
+			fs->CreateDirectory(directory);
+		}
+		{
+			auto cache_handle =
+			    fs->OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
+			cache_handle->Write(header.get(), header_size, 0);
+			cache_handle->Write(const_cast<data_ptr_t>(buffer), block_size, header_size);
+		}
+		// move the complete block into place, so that concurrent readers never see a partially written block
+		fs->MoveFile(temp_path, file_path);
+	} catch (std::exception &) {
+		try {
+			fs->RemoveFile(temp_path);
+		} catch (std::exception &) {
+		}
+		return;
+	}
+
+	vector<string> evicted_files;
+	{
+		lock_guard<mutex> guard(lock);
+		LoadEntries();
+		TouchEntry(file_path, header_size + block_size);
+		evicted_files = EvictEntries();
+	}
+	RemoveFiles(evicted_files);
+}
+
+void HTTPDiskCache::SetMaximumSize(idx_t maximum_size_p) {
+	vector<string> evicted_files;
+	{
+		lock_guard<mutex> guard(lock);
+		if (maximum_size == maximum_size_p) {
+			return;
+		}
+		maximum_size = maximum_size_p;
+		if (loaded) {
+			evicted_files = EvictEntries();
+		}
+	}
+	RemoveFiles(evicted_files);
+}
+
+void HTTPDiskCache::LoadEntries() {
+	if (loaded) {
+		return;
+	}
+	loaded = true;
+	vector<pair<time_t, pair<string, idx_t>>> cached_files;
+	try {
+		if (!fs->DirectoryExists(directory)) {
+			return;
+		}
+		fs->ListFiles(directory, [&](const string &name, bool is_directory) {
+			if (is_directory || !StringUtil::StartsWith(name, BLOCK_CACHE_PREFIX) ||
+			    StringUtil::EndsWith(name, BLOCK_CACHE_TEMP_SUFFIX)) {
+				return;
+			}
+			auto file_path = fs->JoinPath(directory, name);
+			auto cache_handle =
+			    fs->OpenFile(file_path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+			if (!cache_handle) {
+				return;
+			}
+			auto size = NumericCast<idx_t>(cache_handle->GetFileSize());
+			cached_files.emplace_back(fs->GetLastModifiedTime(*cache_handle), make_pair(file_path, size));
+		});
+	} catch (std::exception &) {
+		// an unreadable directory is an empty cache
+	}
+	std::sort(cached_files.begin(), cached_files.end());
+	for (auto &cached_file : cached_files) {
+		TouchEntry(cached_file.second.first, cached_file.second.second);
+	}
+}
+
+void HTTPDiskCache::TouchEntry(const string &file_path, idx_t size) {
+	auto entry = entries.find(file_path);
+	if (entry != entries.end()) {
+		total_size -= entry->second.size;
+		lru.erase(entry->second.lru_position);
+		entries.erase(entry);
+	}
+	lru.push_front(file_path);
+	entries[file_path] = CacheEntry {lru.begin(), size};
+	total_size += size;
+}
+
+void HTTPDiskCache::RemoveEntry(const string &file_path) {
+	auto entry = entries.find(file_path);
+	if (entry == entries.end()) {
+		return;
+	}
+	total_size -= entry->second.size;
+	lru.erase(entry->second.lru_position);
+	entries.erase(entry);
+}
+
+vector<string> HTTPDiskCache::EvictEntries() {
+	vector<string> evicted_files;
+	while (total_size > maximum_size && !lru.empty()) {
+		auto &evicted_file = lru.back();
+		auto evicted_entry = entries.find(evicted_file);
+		D_ASSERT(evicted_entry != entries.end());
+		total_size -= evicted_entry->second.size;
+		entries.erase(evicted_entry);
+		evicted_files.push_back(std::move(evicted_file));
+		lru.pop_back();
+	}
+	return evicted_files;
+}
+
+void HTTPDiskCache::RemoveFiles(const vector<string> &file_paths) {
+	for (auto &file_path : file_paths) {
+		try {
+			fs->RemoveFile(file_path);
+		} catch (std::exception &) {
+		}
+	}
+}
+
+} // namespace duckdb
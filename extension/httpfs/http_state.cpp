@@ -54,6 +54,8 @@ void HTTPState::Reset() {
 	post_count = 0;
 	total_bytes_received = 0;
 	total_bytes_sent = 0;
+	disk_cache_hits = 0;
+	disk_cache_misses = 0;
 
 	// Reset cached files
 	cached_files.clear();
@@ -78,6 +80,8 @@ void HTTPState::WriteProfilingInformation(std::ostream &ss) {
 	string get = "#GET: " + to_string(get_count);
 	string put = "#PUT: " + to_string(put_count);
 	string post = "#POST: " + to_string(post_count);
+	string disk_cache_hit = "disk cache hits: " + to_string(disk_cache_hits);
+	string disk_cache_miss = "disk cache misses: " + to_string(disk_cache_misses);
 
 	constexpr idx_t TOTAL_BOX_WIDTH = 39;
 	ss << "┌─────────────────────────────────────┐\n";
@@ -90,6 +94,10 @@ void HTTPState::WriteProfilingInformation(std::ostream &ss) {
 	ss << "││" + QueryProfiler::DrawPadded(get, TOTAL_BOX_WIDTH - 4) + "││\n";
 	ss << "││" + QueryProfiler::DrawPadded(put, TOTAL_BOX_WIDTH - 4) + "││\n";
 	ss << "││" + QueryProfiler::DrawPadded(post, TOTAL_BOX_WIDTH - 4) + "││\n";
+	if (disk_cache_hits + disk_cache_misses > 0) {
+		ss << "││" + QueryProfiler::DrawPadded(disk_cache_hit, TOTAL_BOX_WIDTH - 4) + "││\n";
+		ss << "││" + QueryProfiler::DrawPadded(disk_cache_miss, TOTAL_BOX_WIDTH - 4) + "││\n";
+	}
 	ss << "│└───────────────────────────────────┘│\n";
 	ss << "└─────────────────────────────────────┘\n";
 }
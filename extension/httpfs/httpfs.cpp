@@ -5,6 +5,7 @@
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/http_util.hpp"
+#include "duckdb/common/io_profiler.hpp"
 #include "duckdb/common/thread.hpp"
 #include "duckdb/common/types/hash.hpp"
 #include "duckdb/function/scalar/strftime_format.hpp"
@@ -59,6 +60,13 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener, optional_ptr<Fi
 	                                 info);
 	FileOpener::TryGetCurrentSetting(opener, "ca_cert_file", result.ca_cert_file, info);
 	FileOpener::TryGetCurrentSetting(opener, "hf_max_per_page", result.hf_max_per_page, info);
+	FileOpener::TryGetCurrentSetting(opener, "http_parallel_range_requests", result.parallel_range_requests, info);
+	FileOpener::TryGetCurrentSetting(opener, "http_disk_cache_directory", result.disk_cache_directory, info);
+	if (!result.disk_cache_directory.empty()) {
+		string disk_cache_size = HTTPDiskCache::DEFAULT_MAXIMUM_SIZE;
+		FileOpener::TryGetCurrentSetting(opener, "http_disk_cache_size", disk_cache_size, info);
+		result.disk_cache_size = DBConfig::ParseMemoryLimit(disk_cache_size);
+	}
 
 	// HTTP Secret lookups
 	KeyValueSecretReader settings_reader(*opener, info, "http");
@@ -439,7 +447,8 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 }
 
 HTTPFileHandle::HTTPFileHandle(FileSystem &fs, const string &path, FileOpenFlags flags, const HTTPParams &http_params)
-    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), buffer_available(0), buffer_idx(0),
+    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), last_modified(0), buffer_available(0),
+      buffer_idx(0),
       file_offset(0), buffer_start(0), buffer_end(0) {
 }
 
@@ -491,11 +500,75 @@ unique_ptr<FileHandle> HTTPFileSystem::OpenFile(const string &path, FileOpenFlag
 	return std::move(handle);
 }
 
-// Buffered read from http file.
-// Note that buffering is disabled when FileFlags::FILE_FLAGS_DIRECT_IO is set
+void HTTPFileSystem::ParallelGetRangeRequest(HTTPFileHandle &hfh, idx_t file_offset, char *buffer_out,
+                                             idx_t buffer_out_len) {
+	const auto part_len = HTTPFileHandle::PARALLEL_RANGE_LEN;
+	const auto part_count = (buffer_out_len + part_len - 1) / part_len;
+	const auto max_concurrency = hfh.http_params.parallel_range_requests;
+	const auto concurrency = MinValue<idx_t>(MinValue<idx_t>(hfh.range_concurrency, max_concurrency), part_count);
+	if (concurrency <= 1) {
+		GetRangeRequest(hfh, hfh.path, {}, file_offset, buffer_out, buffer_out_len);
+		return;
+	}
+
+	// Every request uses its own client from the client cache, and the parts are written to their place in the buffer
+	auto start_time = std::chrono::steady_clock::now();
+	atomic<idx_t> next_part {0};
+	atomic<bool> has_error {false};
+	std::exception_ptr request_exception;
+	mutex exception_lock;
+	auto fetch_parts = [&]() {
+		while (!has_error) {
+			auto part_idx = next_part++;
+			if (part_idx >= part_count) {
+				return;
+			}
+			auto part_offset = part_idx * part_len;
+			auto part_size = MinValue<idx_t>(part_len, buffer_out_len - part_offset);
+			try {
+				GetRangeRequest(hfh, hfh.path, {}, file_offset + part_offset, buffer_out + part_offset, part_size);
+			} catch (...) {
+				lock_guard<mutex> guard(exception_lock);
+				if (!has_error) {
+					request_exception = std::current_exception();
+					has_error = true;
+				}
+			}
+		}
+	};
+	vector<thread> request_threads;
+	for (idx_t thread_idx = 1; thread_idx < concurrency; thread_idx++) {
+		request_threads.emplace_back(fetch_parts);
+	}
+	fetch_parts();
+	for (auto &request_thread : request_threads) {
+		request_thread.join();
+	}
+	if (has_error) {
+		std::rethrow_exception(request_exception);
+	}
+
+	// Add connections while that increases the throughput, and remove them when the throughput drops
+	auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+	auto throughput = double(buffer_out_len) / MaxValue<double>(elapsed, 1e-6);
+	auto previous_throughput = hfh.range_throughput.load();
+	if (throughput > previous_throughput * 1.1) {
+		hfh.range_concurrency = MinValue<idx_t>(concurrency * 2, max_concurrency);
+	} else if (throughput < previous_throughput * 0.9) {
+		hfh.range_concurrency = MaxValue<idx_t>(concurrency / 2, 2);
+	}
+	hfh.range_throughput = throughput;
+}
+
 void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
-	auto &hfh = handle.Cast<HTTPFileHandle>();
+	auto read_start = std::chrono::steady_clock::now();
+	ReadInternal(handle.Cast<HTTPFileHandle>(), buffer, nr_bytes, location);
+	IOProfiler::RecordRead(NumericCast<idx_t>(nr_bytes), read_start, true);
+}
 
+// Buffered read from http file.
+// Note that buffering is disabled when FileFlags::FILE_FLAGS_DIRECT_IO is set
+void HTTPFileSystem::ReadInternal(HTTPFileHandle &hfh, void *buffer, int64_t nr_bytes, idx_t location) {
 	D_ASSERT(hfh.state);
 	if (hfh.cached_file_handle) {
 		if (!hfh.cached_file_handle->Initialized()) {
@@ -505,6 +578,11 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 		hfh.file_offset = location + nr_bytes;
 		return;
 	}
+	if (hfh.disk_cache) {
+		ReadThroughDiskCache(hfh, data_ptr_cast(buffer), NumericCast<idx_t>(nr_bytes), location);
+		hfh.file_offset = location + nr_bytes;
+		return;
+	}
 
 	idx_t to_read = nr_bytes;
 	idx_t buffer_offset = 0;
@@ -512,7 +590,7 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	// Don't buffer when DirectIO is set or when we are doing parallel reads
 	bool skip_buffer = hfh.flags.DirectIO() || hfh.flags.RequireParallelAccess();
 	if (skip_buffer && to_read > 0) {
-		GetRangeRequest(hfh, hfh.path, {}, location, (char *)buffer, to_read);
+		ParallelGetRangeRequest(hfh, location, (char *)buffer, to_read);
 		hfh.buffer_available = 0;
 		hfh.buffer_idx = 0;
 		hfh.file_offset = location + nr_bytes;
@@ -548,7 +626,7 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 
 			// Bypass buffer if we read more than buffer size
 			if (to_read > new_buffer_available) {
-				GetRangeRequest(hfh, hfh.path, {}, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
+				ParallelGetRangeRequest(hfh, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
 				hfh.buffer_available = 0;
 				hfh.buffer_idx = 0;
 				hfh.file_offset += to_read;
@@ -565,6 +643,72 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	}
 }
 
+void HTTPFileSystem::ReadThroughDiskCache(HTTPFileHandle &hfh, data_ptr_t buffer, idx_t nr_bytes, idx_t location) {
+	auto &disk_cache = *hfh.disk_cache;
+	if (nr_bytes == 0) {
+		return;
+	}
+	const auto block_size = HTTPDiskCache::BLOCK_SIZE;
+	const auto first_block = location / block_size;
+	const auto last_block = (location + nr_bytes - 1) / block_size;
+
+	// find the blocks that are not cached, and read the cached blocks that are partially read into a buffer
+	vector<bool> cached(last_block - first_block + 1);
+	unique_ptr<data_t[]> block_buffer;
+	for (idx_t block_idx = first_block; block_idx <= last_block; block_idx++) {
+		auto block_start = block_idx * block_size;
+		auto block_length = MinValue<idx_t>(block_size, hfh.length - block_start);
+		auto read_start = MaxValue<idx_t>(block_start, location);
+		auto read_end = MinValue<idx_t>(block_start + block_length, location + nr_bytes);
+		auto key = HTTPDiskCache::GetBlockKey(hfh, block_idx);
+		bool is_cached;
+		if (read_start == block_start && read_end == block_start + block_length) {
+			is_cached = disk_cache.TryRead(key, buffer + (block_start - location), block_length);
+		} else {
+			if (!block_buffer) {
+				block_buffer = unique_ptr<data_t[]>(new data_t[block_size]);
+			}
+			is_cached = disk_cache.TryRead(key, block_buffer.get(), block_length);
+			if (is_cached) {
+				memcpy(buffer + (read_start - location), block_buffer.get() + (read_start - block_start),
+				       read_end - read_start);
+			}
+		}
+		cached[block_idx - first_block] = is_cached;
+		if (is_cached) {
+			hfh.state->disk_cache_hits++;
+		} else {
+			hfh.state->disk_cache_misses++;
+		}
+	}
+
+	// fetch consecutive blocks that are not cached with a single request, and write them to the cache
+	idx_t block_idx = first_block;
+	while (block_idx <= last_block) {
+		if (cached[block_idx - first_block]) {
+			block_idx++;
+			continue;
+		}
+		auto run_start = block_idx;
+		while (block_idx <= last_block && !cached[block_idx - first_block]) {
+			block_idx++;
+		}
+		auto fetch_start = run_start * block_size;
+		auto fetch_end = MinValue<idx_t>(block_idx * block_size, hfh.length);
+		auto fetched = unique_ptr<data_t[]>(new data_t[fetch_end - fetch_start]);
+		ParallelGetRangeRequest(hfh, fetch_start, char_ptr_cast(fetched.get()), fetch_end - fetch_start);
+		for (idx_t fetched_block = run_start; fetched_block < block_idx; fetched_block++) {
+			auto block_start = fetched_block * block_size;
+			auto block_length = MinValue<idx_t>(block_size, hfh.length - block_start);
+			auto block_key = HTTPDiskCache::GetBlockKey(hfh, fetched_block);
+			disk_cache.Write(block_key, fetched.get() + (block_start - fetch_start), block_length);
+		}
+		auto read_start = MaxValue<idx_t>(fetch_start, location);
+		auto read_end = MinValue<idx_t>(fetch_end, location + nr_bytes);
+		memcpy(buffer + (read_start - location), fetched.get() + (read_start - fetch_start), read_end - read_start);
+	}
+}
+
 int64_t HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	auto &hfh = (HTTPFileHandle &)handle;
 	idx_t max_read = hfh.length - hfh.file_offset;
@@ -632,6 +776,27 @@ optional_ptr<HTTPMetadataCache> HTTPFileSystem::GetGlobalCache() {
 	return global_metadata_cache.get();
 }
 
+shared_ptr<HTTPDiskCache> HTTPFileSystem::GetDiskCache(const string &directory, idx_t maximum_size) {
+	lock_guard<mutex> lock(global_cache_lock);
+	if (!disk_cache || disk_cache->GetDirectory() != directory) {
+		disk_cache = make_shared_ptr<HTTPDiskCache>(directory, maximum_size);
+	} else {
+		disk_cache->SetMaximumSize(maximum_size);
+	}
+	return disk_cache;
+}
+
+// Use the disk cache for reading files of which the version is known
+static void InitializeDiskCache(HTTPFileHandle &handle, HTTPFileSystem &hfs) {
+	auto &params = handle.http_params;
+	if (params.disk_cache_directory.empty() || params.force_download || handle.cached_file_handle ||
+	    !handle.flags.OpenForReading() || handle.flags.OpenForWriting() || handle.length == 0 ||
+	    !HTTPDiskCache::CanCache(handle)) {
+		return;
+	}
+	handle.disk_cache = hfs.GetDiskCache(params.disk_cache_directory, params.disk_cache_size);
+}
+
 // Get either the local, global, or no cache depending on settings
 static optional_ptr<HTTPMetadataCache> TryGetMetadataCache(optional_ptr<FileOpener> opener, HTTPFileSystem &httpfs) {
 	auto db = FileOpener::TryGetDatabase(opener);
@@ -672,10 +837,12 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		if (found) {
 			last_modified = value.last_modified;
 			length = value.length;
+			etag = value.etag;
 
 			if (flags.OpenForReading()) {
 				read_buffer = duckdb::unique_ptr<data_t[]>(new data_t[READ_BUFFER_LEN]);
 			}
+			InitializeDiskCache(*this, hfs);
 			return;
 		}
 
@@ -749,7 +916,14 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 	if (state && (length == 0 || http_params.force_download)) {
 		auto &cache_entry = state->GetCachedFile(path);
 		cached_file_handle = cache_entry->GetHandle();
-		if (!cached_file_handle->Initialized()) {
+		if (!cached_file_handle->Initialized() && length > PARALLEL_RANGE_LEN &&
+		    http_params.parallel_range_requests > 1) {
+			// Download large files of which the length is known with concurrent range requests
+			cached_file_handle->AllocateBuffer(length);
+			hfs.ParallelGetRangeRequest(*this, 0, cached_file_handle->GetWriteBuffer(), length);
+			cached_file_handle->SetInitialized(length);
+			should_write_cache = false;
+		} else if (!cached_file_handle->Initialized()) {
 			// Try to fully download the file first
 			auto full_download_result = hfs.GetRequest(*this, path, {});
 			if (full_download_result->code != 200) {
@@ -781,10 +955,12 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		tm.tm_isdst = 0;
 		last_modified = mktime(&tm);
 	}
+	etag = res->headers["ETag"];
 
 	if (should_write_cache) {
-		current_cache->Insert(path, {length, last_modified});
+		current_cache->Insert(path, {length, last_modified, etag});
 	}
+	InitializeDiskCache(*this, hfs);
 }
 
 unique_ptr<duckdb_httplib_openssl::Client> HTTPFileHandle::GetClient(optional_ptr<ClientContext> context) {
@@ -39,6 +39,15 @@ static void LoadInternal(DatabaseInstance &instance) {
 	                          LogicalType::BOOLEAN, Value(false));
 	config.AddExtensionOption("ca_cert_file", "Path to a custom certificate file for self-signed certificates.",
 	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_parallel_range_requests",
+	                          "Maximum number of concurrent range requests large reads of remote files are split into",
+	                          LogicalType::UBIGINT, Value::UBIGINT(HTTPParams::DEFAULT_PARALLEL_RANGE_REQUESTS));
+	config.AddExtensionOption("http_disk_cache_directory",
+	                          "Directory in which blocks of remote files are cached across queries and processes, "
+	                          "empty to disable the disk cache",
+	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_disk_cache_size", "Maximum size of the disk cache of remote files",
+	                          LogicalType::VARCHAR, Value(HTTPDiskCache::DEFAULT_MAXIMUM_SIZE));
 	// Global S3 config
 	config.AddExtensionOption("s3_region", "S3 Region", LogicalType::VARCHAR, Value("us-east-1"));
 	config.AddExtensionOption("s3_access_key_id", "S3 Access Key ID", LogicalType::VARCHAR);
@@ -49,6 +58,9 @@ static void LoadInternal(DatabaseInstance &instance) {
 	config.AddExtensionOption("s3_use_ssl", "S3 use SSL", LogicalType::BOOLEAN, Value(true));
 	config.AddExtensionOption("s3_url_compatibility_mode", "Disable Globs and Query Parameters on S3 URLs",
 	                          LogicalType::BOOLEAN, Value(false));
+	config.AddExtensionOption("s3_list_cache_ttl",
+	                          "Number of seconds the results of S3 globs are cached across queries, 0 to disable",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
 
 	// S3 Uploader config
 	config.AddExtensionOption("s3_uploader_max_filesize", "S3 Uploader max filesize (between 50GB and 5TB)",
@@ -57,6 +69,10 @@ static void LoadInternal(DatabaseInstance &instance) {
 	                          LogicalType::UBIGINT, Value(10000));
 	config.AddExtensionOption("s3_uploader_thread_limit", "S3 Uploader global thread limit", LogicalType::UBIGINT,
 	                          Value(50));
+	config.AddExtensionOption("s3_uploader_max_buffer_memory",
+	                          "S3 Uploader memory limit for the buffers of all uploads, half of the memory limit if "
+	                          "empty",
+	                          LogicalType::VARCHAR, Value(""));
 
 	// HuggingFace options
 	config.AddExtensionOption("hf_max_per_page", "Debug option to limit number of items returned in list requests",
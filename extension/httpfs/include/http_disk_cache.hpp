@@ -0,0 +1,70 @@
+#pragma once
+
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/string.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+
+class HTTPFileHandle;
+
+//! A cache of blocks of remote files in a local directory, which is shared between queries and processes. Blocks are
+//! identified by the URL, the version (ETag and last modified time) and the size of the file they belong to, so that
+//! changed files are never read from the cache. When the cache exceeds its maximum size, the least recently used
+//! blocks are evicted
+class HTTPDiskCache {
+public:
+	//! Files are cached in blocks of this size, the last block of a file can be smaller
+	static constexpr idx_t BLOCK_SIZE = 1 << 20;
+	static constexpr const char *DEFAULT_MAXIMUM_SIZE = "4GB";
+
+	HTTPDiskCache(string directory, idx_t maximum_size);
+
+	//! Whether the blocks of a file can be cached, i.e., whether its version is known
+	static bool CanCache(HTTPFileHandle &handle);
+	//! The identifier of a block of a file
+	static string GetBlockKey(HTTPFileHandle &handle, idx_t block_idx);
+
+	//! Reads a cached block of the given size, returns false if it is not cached
+	bool TryRead(const string &key, data_ptr_t buffer, idx_t block_size);
+	//! Writes a block to the cache, failing to write it does not throw
+	void Write(const string &key, const_data_ptr_t buffer, idx_t block_size);
+
+	const string &GetDirectory() const {
+		return directory;
+	}
+	void SetMaximumSize(idx_t maximum_size);
+
+private:
+	struct CacheEntry {
+		list<string>::iterator lru_position;
+		idx_t size;
+	};
+
+	string GetBlockPath(const string &key) const;
+	//! Loads the blocks that were cached by earlier processes, oldest first
+	void LoadEntries();
+	//! Marks a block as most recently used
+	void TouchEntry(const string &file_path, idx_t size);
+	void RemoveEntry(const string &file_path);
+	//! Returns the blocks that have to be evicted to stay within the maximum size
+	vector<string> EvictEntries();
+	void RemoveFiles(const vector<string> &file_paths);
+
+private:
+	//! The local file system the blocks are cached in
+	unique_ptr<FileSystem> fs;
+	const string directory;
+
+	mutex lock;
+	bool loaded = false;
+	idx_t maximum_size;
+	idx_t total_size = 0;
+	//! The cached blocks, most recently used first
+	list<string> lru;
+	unordered_map<string, CacheEntry> entries;
+};
+
+} // namespace duckdb
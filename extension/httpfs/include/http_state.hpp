@@ -54,6 +54,11 @@ public:
 	const char *GetData() {
 		return file->data.get();
 	}
+	//! The buffer to write to, which has to be allocated first
+	char *GetWriteBuffer() {
+		D_ASSERT(!file->initialized && lock);
+		return file->data.get();
+	}
 	uint64_t GetCapacity() {
 		return file->capacity;
 	}
@@ -80,7 +85,7 @@ public:
 
 	bool IsEmpty() {
 		return head_count == 0 && get_count == 0 && put_count == 0 && post_count == 0 && total_bytes_received == 0 &&
-		       total_bytes_sent == 0;
+		       total_bytes_sent == 0 && disk_cache_hits == 0 && disk_cache_misses == 0;
 	}
 
 	atomic<idx_t> head_count {0};
@@ -89,6 +94,9 @@ public:
 	atomic<idx_t> post_count {0};
 	atomic<idx_t> total_bytes_received {0};
 	atomic<idx_t> total_bytes_sent {0};
+	//! Blocks of remote files that were (not) found in the disk cache
+	atomic<idx_t> disk_cache_hits {0};
+	atomic<idx_t> disk_cache_misses {0};
 
 	//! Called by the ClientContext when the current query ends
 	void QueryEnd(ClientContext &context) override {
@@ -7,6 +7,7 @@
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "http_metadata_cache.hpp"
+#include "http_disk_cache.hpp"
 
 namespace duckdb_httplib_openssl {
 struct Response;
@@ -45,6 +46,7 @@ struct HTTPParams {
 	static constexpr bool DEFAULT_KEEP_ALIVE = true;
 	static constexpr bool DEFAULT_ENABLE_SERVER_CERT_VERIFICATION = false;
 	static constexpr uint64_t DEFAULT_HF_MAX_PER_PAGE = 0;
+	static constexpr uint64_t DEFAULT_PARALLEL_RANGE_REQUESTS = 8;
 
 	uint64_t timeout = DEFAULT_TIMEOUT;
 	uint64_t retries = DEFAULT_RETRIES;
@@ -54,6 +56,8 @@ struct HTTPParams {
 	bool keep_alive = DEFAULT_KEEP_ALIVE;
 	bool enable_server_cert_verification = DEFAULT_ENABLE_SERVER_CERT_VERIFICATION;
 	idx_t hf_max_per_page = DEFAULT_HF_MAX_PER_PAGE;
+	//! The maximum number of concurrent range requests a large read is split into
+	idx_t parallel_range_requests = DEFAULT_PARALLEL_RANGE_REQUESTS;
 
 	string ca_cert_file;
 	string http_proxy;
@@ -63,6 +67,10 @@ struct HTTPParams {
 	string bearer_token;
 	unordered_map<string, string> extra_headers;
 
+	//! The directory remote files are cached in, empty if they are not cached on disk
+	string disk_cache_directory;
+	idx_t disk_cache_size = 0;
+
 	static HTTPParams ReadFrom(optional_ptr<FileOpener> opener, optional_ptr<FileOpenerInfo> info);
 };
 
@@ -98,9 +106,12 @@ public:
 	FileOpenFlags flags;
 	idx_t length;
 	time_t last_modified;
+	string etag;
 
 	// When using full file download, the full file will be written to a cached file handle
 	unique_ptr<CachedFileHandle> cached_file_handle;
+	// When caching remote files on disk, blocks of the file are read from and written to the disk cache
+	shared_ptr<HTTPDiskCache> disk_cache;
 
 	// Read info
 	idx_t buffer_available;
@@ -113,6 +124,12 @@ public:
 	duckdb::unique_ptr<data_t[]> read_buffer;
 	constexpr static idx_t READ_BUFFER_LEN = 1000000;
 
+	// Large reads are split into concurrent range requests of this size
+	constexpr static idx_t PARALLEL_RANGE_LEN = 8388608;
+	// The number of concurrent range requests, which adapts to the throughput of previous reads
+	atomic<idx_t> range_concurrency {2};
+	atomic<double> range_throughput {0};
+
 	shared_ptr<HTTPState> state;
 
 	void AddHeaders(HeaderMap &map);
@@ -151,6 +168,8 @@ public:
 	virtual duckdb::unique_ptr<ResponseWrapper> GetRangeRequest(FileHandle &handle, string url, HeaderMap header_map,
 	                                                            idx_t file_offset, char *buffer_out,
 	                                                            idx_t buffer_out_len);
+	// Get Request that splits the range into concurrent range requests if it is large
+	void ParallelGetRangeRequest(HTTPFileHandle &handle, idx_t file_offset, char *buffer_out, idx_t buffer_out_len);
 	// Get Request without a range (i.e., downloads full file)
 	virtual duckdb::unique_ptr<ResponseWrapper> GetRequest(FileHandle &handle, string url, HeaderMap header_map);
 	// Post Request that can handle variable sized responses without a content-length header (needed for s3 multipart)
@@ -191,11 +210,18 @@ public:
 	static void Verify();
 
 	optional_ptr<HTTPMetadataCache> GetGlobalCache();
+	//! Get the disk cache of remote files in the given directory
+	shared_ptr<HTTPDiskCache> GetDiskCache(const string &directory, idx_t maximum_size);
 
 protected:
 	virtual duckdb::unique_ptr<HTTPFileHandle> CreateHandle(const string &path, FileOpenFlags flags,
 	                                                        optional_ptr<FileOpener> opener);
 
+	//! Read from the file, through the read buffer or the caches where possible
+	void ReadInternal(HTTPFileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
+	//! Read from the file through the disk cache, fetching all blocks that are not cached yet
+	void ReadThroughDiskCache(HTTPFileHandle &handle, data_ptr_t buffer, idx_t nr_bytes, idx_t location);
+
 	static duckdb::unique_ptr<ResponseWrapper>
 	RunRequestWithRetry(const std::function<duckdb_httplib_openssl::Result(void)> &request, string &url, string method,
 	                    const HTTPParams &params, const std::function<void(void)> &retry_cb = {});
@@ -204,6 +230,7 @@ private:
 	// Global cache
 	mutex global_cache_lock;
 	duckdb::unique_ptr<HTTPMetadataCache> global_metadata_cache;
+	shared_ptr<HTTPDiskCache> disk_cache;
 };
 
 } // namespace duckdb
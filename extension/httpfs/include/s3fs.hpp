@@ -73,6 +73,8 @@ struct S3ConfigParams {
 	uint64_t max_file_size;
 	uint64_t max_parts_per_file;
 	uint64_t max_upload_threads;
+	//! The maximum memory of the buffers of all uploads, 0 to use half of the memory limit
+	uint64_t max_buffer_memory;
 
 	static S3ConfigParams ReadFrom(optional_ptr<FileOpener> opener);
 };
@@ -82,12 +84,13 @@ class S3FileSystem;
 // Holds the buffered data for 1 part of an S3 Multipart upload
 class S3WriteBuffer {
 public:
-	explicit S3WriteBuffer(idx_t buffer_start, size_t buffer_size, BufferHandle buffer_p)
-	    : idx(0), buffer_start(buffer_start), buffer(std::move(buffer_p)) {
+	explicit S3WriteBuffer(S3FileSystem &s3fs, idx_t buffer_start, size_t buffer_size, BufferHandle buffer_p)
+	    : idx(0), buffer_start(buffer_start), buffer(std::move(buffer_p)), s3fs(s3fs) {
 		buffer_end = buffer_start + buffer_size;
 		part_no = buffer_start / buffer_size;
 		uploading = false;
 	}
+	~S3WriteBuffer();
 
 	void *Ptr() {
 		return buffer.Ptr();
@@ -101,6 +104,10 @@ public:
 	idx_t buffer_end;
 	BufferHandle buffer;
 	atomic<bool> uploading;
+
+private:
+	//! The file system that accounts for the memory of the buffer
+	S3FileSystem &s3fs;
 };
 
 class S3FileHandle : public HTTPFileHandle {
@@ -211,12 +218,17 @@ public:
 	// Note: caller is responsible to not call this method twice on the same buffer
 	static void UploadBuffer(S3FileHandle &file_handle, shared_ptr<S3WriteBuffer> write_buffer);
 
+	//! The maximum number of concurrent requests to list the directories of a glob
+	static constexpr idx_t PARALLEL_LIST_REQUESTS = 16;
+
 	vector<string> Glob(const string &glob_pattern, FileOpener *opener = nullptr) override;
 	bool ListFiles(const string &directory, const std::function<void(const string &, bool)> &callback,
 	               FileOpener *opener = nullptr) override;
 
-	//! Wrapper around BufferManager::Allocate to limit the number of buffers
-	BufferHandle Allocate(idx_t part_size, uint16_t max_threads);
+	//! Wrapper around BufferManager::Allocate to limit the memory of the buffers of all uploads
+	BufferHandle Allocate(idx_t part_size, idx_t max_buffer_memory);
+	//! Called when an upload buffer is freed
+	void ReleaseBuffer(idx_t part_size);
 
 	//! S3 is object storage so directories effectively always exist
 	bool DirectoryExists(const string &directory, optional_ptr<FileOpener> opener = nullptr) override {
@@ -233,6 +245,18 @@ protected:
 
 	// helper for ReadQueryParams
 	void GetQueryParam(const string &key, string &param, CPPHTTPLIB_NAMESPACE::Params &query_params);
+
+private:
+	//! The memory of the upload buffers of all files: writers wait for uploads to finish when it is exceeded
+	mutex upload_buffers_lock;
+	std::condition_variable upload_buffers_cv;
+	idx_t upload_buffer_memory = 0;
+	//! The number of buffers that are being uploaded, which free their memory once they are uploaded
+	idx_t uploading_buffers = 0;
+
+	//! The results of recent globs, and when they were listed
+	mutex list_cache_lock;
+	unordered_map<string, pair<std::chrono::steady_clock::time_point, vector<string>>> list_cache;
 };
 
 // Helper class to do s3 ListObjectV2 api call https://docs.aws.amazon.com/AmazonS3/latest/API/API_ListObjectsV2.html
@@ -226,6 +226,7 @@ S3ConfigParams S3ConfigParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	uint64_t uploader_max_filesize;
 	uint64_t max_parts_per_file;
 	uint64_t max_upload_threads;
+	uint64_t max_buffer_memory = 0;
 	Value value;
 
 	if (FileOpener::TryGetCurrentSetting(opener, "s3_uploader_max_filesize", value)) {
@@ -246,7 +247,12 @@ S3ConfigParams S3ConfigParams::ReadFrom(optional_ptr<FileOpener> opener) {
 		max_upload_threads = S3ConfigParams::DEFAULT_MAX_UPLOAD_THREADS;
 	}
 
-	return {uploader_max_filesize, max_parts_per_file, max_upload_threads};
+	if (FileOpener::TryGetCurrentSetting(opener, "s3_uploader_max_buffer_memory", value) && !value.IsNull() &&
+	    !value.GetValue<string>().empty()) {
+		max_buffer_memory = DBConfig::ParseMemoryLimit(value.GetValue<string>());
+	}
+
+	return {uploader_max_filesize, max_parts_per_file, max_upload_threads, max_buffer_memory};
 }
 
 void S3FileHandle::Close() {
@@ -332,6 +338,13 @@ void S3FileSystem::UploadBuffer(S3FileHandle &file_handle, shared_ptr<S3WriteBuf
 			file_handle.upload_exception = std::current_exception();
 		}
 
+		write_buffer.reset();
+		{
+			lock_guard<mutex> lck(s3fs.upload_buffers_lock);
+			s3fs.uploading_buffers--;
+		}
+		s3fs.upload_buffers_cv.notify_all();
+
 		NotifyUploadsInProgress(file_handle);
 
 		return;
@@ -347,6 +360,11 @@ void S3FileSystem::UploadBuffer(S3FileHandle &file_handle, shared_ptr<S3WriteBuf
 
 	// Free up space for another thread to acquire an S3WriteBuffer
 	write_buffer.reset();
+	{
+		lock_guard<mutex> lck(s3fs.upload_buffers_lock);
+		s3fs.uploading_buffers--;
+	}
+	s3fs.upload_buffers_cv.notify_all();
 
 	NotifyUploadsInProgress(file_handle);
 }
@@ -383,6 +401,11 @@ void S3FileSystem::FlushBuffer(S3FileHandle &file_handle, shared_ptr<S3WriteBuff
 		}
 		file_handle.uploads_in_progress++;
 	}
+	{
+		auto &s3fs = file_handle.file_system.Cast<S3FileSystem>();
+		lock_guard<mutex> lck(s3fs.upload_buffers_lock);
+		s3fs.uploading_buffers++;
+	}
 
 	thread upload_thread(UploadBuffer, std::ref(file_handle), write_buffer);
 	upload_thread.detach();
@@ -446,9 +469,40 @@ void S3FileSystem::FinalizeMultipartUpload(S3FileHandle &file_handle) {
 	}
 }
 
-// Wrapper around the BufferManager::Allocate to that allows limiting the number of buffers that will be handed out
-BufferHandle S3FileSystem::Allocate(idx_t part_size, uint16_t max_threads) {
-	return buffer_manager.Allocate(MemoryTag::EXTENSION, part_size);
+// Wrapper around the BufferManager::Allocate that limits the memory of the buffers of all uploads. Writers wait for
+// uploads to free their buffers when the limit is reached, which applies back-pressure to the writing operator. If no
+// buffer is being uploaded, waiting could never end, so the buffer is allocated anyway
+BufferHandle S3FileSystem::Allocate(idx_t part_size, idx_t max_buffer_memory) {
+	if (max_buffer_memory == 0) {
+		max_buffer_memory = buffer_manager.GetMaxMemory() / 2;
+	}
+	{
+		unique_lock<mutex> lck(upload_buffers_lock);
+		upload_buffers_cv.wait(lck, [&] {
+			return upload_buffer_memory + part_size <= max_buffer_memory || uploading_buffers == 0;
+		});
+		upload_buffer_memory += part_size;
+	}
+	try {
+		return buffer_manager.Allocate(MemoryTag::EXTENSION, part_size);
+	} catch (...) {
+		ReleaseBuffer(part_size);
+		throw;
+	}
+}
+
+void S3FileSystem::ReleaseBuffer(idx_t part_size) {
+	{
+		lock_guard<mutex> lck(upload_buffers_lock);
+		upload_buffer_memory -= part_size;
+	}
+	upload_buffers_cv.notify_all();
+}
+
+S3WriteBuffer::~S3WriteBuffer() {
+	auto buffer_size = buffer_end - buffer_start;
+	buffer.Destroy();
+	s3fs.ReleaseBuffer(buffer_size);
 }
 
 shared_ptr<S3WriteBuffer> S3FileHandle::GetBuffer(uint16_t write_buffer_idx) {
@@ -464,9 +518,9 @@ shared_ptr<S3WriteBuffer> S3FileHandle::GetBuffer(uint16_t write_buffer_idx) {
 		}
 	}
 
-	auto buffer_handle = s3fs.Allocate(part_size, config_params.max_upload_threads);
+	auto buffer_handle = s3fs.Allocate(part_size, config_params.max_buffer_memory);
 	auto new_write_buffer =
-	    make_shared_ptr<S3WriteBuffer>(write_buffer_idx * part_size, part_size, std::move(buffer_handle));
+	    make_shared_ptr<S3WriteBuffer>(s3fs, write_buffer_idx * part_size, part_size, std::move(buffer_handle));
 	{
 		unique_lock<mutex> lck(write_buffers_lock);
 		auto lookup_result = write_buffers.find(write_buffer_idx);
@@ -878,6 +932,64 @@ static bool Match(vector<string>::const_iterator key, vector<string>::const_iter
 	return key == key_end && pattern == pattern_end;
 }
 
+//! Runs the tasks on up to max_threads threads, and rethrows the first error
+static void RunParallel(idx_t task_count, idx_t max_threads, const std::function<void(idx_t)> &task) {
+	atomic<idx_t> next_task {0};
+	atomic<bool> has_error {false};
+	std::exception_ptr task_exception;
+	mutex exception_lock;
+	auto run_tasks = [&]() {
+		while (!has_error) {
+			auto task_idx = next_task++;
+			if (task_idx >= task_count) {
+				return;
+			}
+			try {
+				task(task_idx);
+			} catch (...) {
+				lock_guard<mutex> guard(exception_lock);
+				if (!has_error) {
+					task_exception = std::current_exception();
+					has_error = true;
+				}
+			}
+		}
+	};
+	vector<thread> threads;
+	for (idx_t thread_idx = 1; thread_idx < MinValue<idx_t>(task_count, max_threads); thread_idx++) {
+		threads.emplace_back(run_tasks);
+	}
+	run_tasks();
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	if (has_error) {
+		std::rethrow_exception(task_exception);
+	}
+}
+
+//! Lists the keys or the common prefixes (i.e., the directories) that start with the prefix
+static void ListPrefix(string prefix_path, HTTPParams &http_params, S3AuthParams &s3_auth_params,
+                       optional_ptr<HTTPState> state, bool list_directories, vector<string> &result) {
+	string continuation_token;
+	do {
+		auto response = AWSListObjectV2::Request(prefix_path, http_params, s3_auth_params,
+		                                         continuation_token, state, list_directories);
+		if (list_directories) {
+			auto prefixes = AWSListObjectV2::ParseCommonPrefix(response);
+			result.insert(result.end(), prefixes.begin(), prefixes.end());
+		} else {
+			AWSListObjectV2::ParseKey(response, result);
+		}
+		continuation_token = AWSListObjectV2::ParseContinuationToken(response);
+	} while (!continuation_token.empty());
+}
+
+//! The part of a pattern component before its first wildcard, which every matching key starts with
+static string LiteralPrefix(const string &pattern_component) {
+	return pattern_component.substr(0, pattern_component.find_first_of("*[\\"));
+}
+
 vector<string> S3FileSystem::Glob(const string &glob_pattern, FileOpener *opener) {
 	if (opener == nullptr) {
 		throw InternalException("Cannot S3 Glob without FileOpener");
@@ -902,60 +1014,88 @@ vector<string> S3FileSystem::Glob(const string &glob_pattern, FileOpener *opener
 		return {glob_pattern};
 	}
 
-	string shared_path = parsed_glob_url.substr(0, first_wildcard_pos);
 	auto http_params = HTTPParams::ReadFrom(opener, info);
 
-	ReadQueryParams(parsed_s3_url.query_param, s3_auth_params);
-
-	// Do main listobjectsv2 request
-	vector<string> s3_keys;
-	string main_continuation_token;
-
-	// Main paging loop
-	do {
-		// main listobject call, may
-		string response_str = AWSListObjectV2::Request(shared_path, http_params, s3_auth_params,
-		                                               main_continuation_token, HTTPState::TryGetState(opener).get());
-		main_continuation_token = AWSListObjectV2::ParseContinuationToken(response_str);
-		AWSListObjectV2::ParseKey(response_str, s3_keys);
-
-		// Repeat requests until the keys of all common prefixes are parsed.
-		auto common_prefixes = AWSListObjectV2::ParseCommonPrefix(response_str);
-		while (!common_prefixes.empty()) {
-			auto prefix_path = parsed_s3_url.prefix + parsed_s3_url.bucket + '/' + common_prefixes.back();
-			common_prefixes.pop_back();
-
-			// TODO we could optimize here by doing a match on the prefix, if it doesn't match we can skip this prefix
-			// Paging loop for common prefix requests
-			string common_prefix_continuation_token;
-			do {
-				auto prefix_res =
-				    AWSListObjectV2::Request(prefix_path, http_params, s3_auth_params, common_prefix_continuation_token,
-				                             HTTPState::TryGetState(opener).get());
-				AWSListObjectV2::ParseKey(prefix_res, s3_keys);
-				auto more_prefixes = AWSListObjectV2::ParseCommonPrefix(prefix_res);
-				common_prefixes.insert(common_prefixes.end(), more_prefixes.begin(), more_prefixes.end());
-				common_prefix_continuation_token = AWSListObjectV2::ParseContinuationToken(prefix_res);
-			} while (!common_prefix_continuation_token.empty());
+	// Listings are cached across queries for the configured amount of seconds
+	idx_t list_cache_ttl = 0;
+	FileOpener::TryGetCurrentSetting(opener, "s3_list_cache_ttl", list_cache_ttl, info);
+	auto list_cache_key = s3_auth_params.endpoint + "\n" + glob_pattern;
+	if (list_cache_ttl > 0) {
+		lock_guard<mutex> guard(list_cache_lock);
+		auto entry = list_cache.find(list_cache_key);
+		if (entry != list_cache.end()) {
+			if (entry->second.first + std::chrono::seconds(list_cache_ttl) > std::chrono::steady_clock::now()) {
+				return entry->second.second;
+			}
+			list_cache.erase(entry);
 		}
-	} while (!main_continuation_token.empty());
+	}
+
+	ReadQueryParams(parsed_s3_url.query_param, s3_auth_params);
+	auto state = HTTPState::TryGetState(opener).get();
+	auto bucket_path = parsed_s3_url.prefix + parsed_s3_url.bucket + '/';
 
+	// Directories are listed one level at a time while the pattern has directories with wildcards, so that only the
+	// directories that match the pattern are listed, and the directories of a level are listed in parallel
 	vector<string> pattern_splits = StringUtil::Split(parsed_s3_url.key, "/");
-	vector<string> result;
-	for (const auto &s3_key : s3_keys) {
+	idx_t level = 0;
+	string literal_directories;
+	while (level + 1 < pattern_splits.size() && pattern_splits[level].find_first_of("*[\\") == string::npos) {
+		literal_directories += pattern_splits[level++] + "/";
+	}
+	vector<string> directories {literal_directories};
+	while (level + 1 < pattern_splits.size() && pattern_splits[level] != "**" && !directories.empty()) {
+		auto &pattern_component = pattern_splits[level];
+		auto literal_prefix = LiteralPrefix(pattern_component);
+		vector<vector<string>> sub_directories(directories.size());
+		RunParallel(directories.size(), PARALLEL_LIST_REQUESTS, [&](idx_t directory_idx) {
+			ListPrefix(bucket_path + directories[directory_idx] + literal_prefix, http_params, s3_auth_params, state,
+			           true, sub_directories[directory_idx]);
+		});
+		directories.clear();
+		for (auto &directory_sub_directories : sub_directories) {
+			for (auto &encoded_sub_directory : directory_sub_directories) {
+				// common prefixes end with the delimiter
+				auto sub_directory = S3FileSystem::UrlDecode(encoded_sub_directory);
+				auto name = sub_directory.substr(0, sub_directory.size() - 1);
+				name = name.substr(name.find_last_of('/') + 1);
+				if (LikeFun::Glob(name.c_str(), name.size(), pattern_component.c_str(), pattern_component.size())) {
+					directories.push_back(std::move(sub_directory));
+				}
+			}
+		}
+		level++;
+	}
 
-		vector<string> key_splits = StringUtil::Split(s3_key, "/");
-		bool is_match = Match(key_splits.begin(), key_splits.end(), pattern_splits.begin(), pattern_splits.end());
+	// List all keys below the remaining directories, in order
+	string key_prefix = level < pattern_splits.size() ? LiteralPrefix(pattern_splits[level]) : string();
+	vector<vector<string>> directory_keys(directories.size());
+	RunParallel(directories.size(), PARALLEL_LIST_REQUESTS, [&](idx_t directory_idx) {
+		ListPrefix(bucket_path + directories[directory_idx] + key_prefix, http_params, s3_auth_params, state, false,
+		           directory_keys[directory_idx]);
+	});
 
-		if (is_match) {
-			auto result_full_url = parsed_s3_url.prefix + parsed_s3_url.bucket + "/" + s3_key;
-			// if a ? char was present, we re-add it here as the url parsing will have trimmed it.
-			if (!parsed_s3_url.query_param.empty()) {
-				result_full_url += '?' + parsed_s3_url.query_param;
+	vector<string> result;
+	for (auto &keys : directory_keys) {
+		for (const auto &s3_key : keys) {
+			vector<string> key_splits = StringUtil::Split(s3_key, "/");
+			bool is_match = Match(key_splits.begin(), key_splits.end(), pattern_splits.begin(), pattern_splits.end());
+
+			if (is_match) {
+				auto result_full_url = bucket_path + s3_key;
+				// if a ? char was present, we re-add it here as the url parsing will have trimmed it.
+				if (!parsed_s3_url.query_param.empty()) {
+					result_full_url += '?' + parsed_s3_url.query_param;
+				}
+				result.push_back(result_full_url);
 			}
-			result.push_back(result_full_url);
 		}
 	}
+
+	if (list_cache_ttl > 0) {
+		lock_guard<mutex> guard(list_cache_lock);
+		list_cache[list_cache_key] = make_pair(std::chrono::steady_clock::now(), result);
+	}
 	return result;
 }
 
@@ -1,16 +1,23 @@
 #include "include/icu-datefunc.hpp"
 
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/operator/add.hpp"
 #include "duckdb/common/operator/multiply.hpp"
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/common/exception/conversion_exception.hpp"
+#include "unicode/basictz.h"
+#include "unicode/tzrule.h"
+#include "unicode/tztrans.h"
 #include "unicode/ucal.h"
 
 namespace duckdb {
 
 ICUDateFunc::BindData::BindData(const BindData &other)
-    : tz_setting(other.tz_setting), cal_setting(other.cal_setting), calendar(other.calendar->clone()) {
+    : tz_setting(other.tz_setting), cal_setting(other.cal_setting), calendar(other.calendar->clone()),
+      offsets(other.offsets) {
 }
 
 ICUDateFunc::BindData::BindData(const string &tz_setting_p, const string &cal_setting_p)
@@ -55,6 +62,8 @@ void ICUDateFunc::BindData::InitCalendar() {
 	//	The only error here is if we have a non-Gregorian calendar,
 	//	and we just ignore that and hope for the best...
 	ucal_setGregorianChange((UCalendar *)calendar.get(), U_DATE_MIN, &success); // NOLINT
+
+	offsets = GetTimeZoneOffsets(*calendar);
 }
 
 bool ICUDateFunc::BindData::Equals(const FunctionData &other_p) const {
@@ -71,6 +80,109 @@ unique_ptr<FunctionData> ICUDateFunc::Bind(ClientContext &context, ScalarFunctio
 	return make_uniq<BindData>(context);
 }
 
+bool ICUDateFunc::TimeZoneOffsets::TryGetOffset(timestamp_t instant, int64_t &offset) const {
+	if (instant.value < lower || instant.value >= upper) {
+		return false;
+	}
+	const auto next = std::upper_bound(starts.begin(), starts.end(), instant.value);
+	offset = offsets[idx_t(next - starts.begin()) - 1];
+	return true;
+}
+
+bool ICUDateFunc::TimeZoneOffsets::TryToLocal(timestamp_t instant, timestamp_t &local) const {
+	int64_t offset;
+	if (!TryGetOffset(instant, offset)) {
+		return false;
+	}
+	local = timestamp_t(instant.value + offset);
+	return true;
+}
+
+bool ICUDateFunc::TimeZoneOffsets::TryFromLocal(timestamp_t local, timestamp_t &instant) const {
+	//	Offsets are less than a day, so the instant is within a day of the local time.
+	//	If the offset does not change within that span, it is the only one that can apply.
+	const auto first = local.value - Interval::MICROS_PER_DAY;
+	const auto last = local.value + Interval::MICROS_PER_DAY;
+	if (first < lower || last >= upper) {
+		return false;
+	}
+	const auto next = std::upper_bound(starts.begin(), starts.end(), first);
+	if (next != starts.end() && *next <= last) {
+		return false;
+	}
+	instant = timestamp_t(local.value - offsets[idx_t(next - starts.begin()) - 1]);
+	return true;
+}
+
+static ICUDateFunc::TimeZoneOffsetsPtr BuildTimeZoneOffsets(const icu::BasicTimeZone &tz) {
+	//	Cover the years where time zone rules are well defined and most data lives.
+	//	Everything else goes through the calendar.
+	const auto lower = Timestamp::FromDatetime(Date::FromDate(1800, 1, 1), dtime_t(0)).value;
+	const auto upper = Timestamp::FromDatetime(Date::FromDate(2200, 1, 1), dtime_t(0)).value;
+	const auto lower_millis = UDate(lower / Interval::MICROS_PER_MSEC);
+	const auto upper_millis = UDate(upper / Interval::MICROS_PER_MSEC);
+
+	UErrorCode status = U_ZERO_ERROR;
+	int32_t raw_offset_ms;
+	int32_t dst_offset_ms;
+	tz.getOffset(lower_millis, false, raw_offset_ms, dst_offset_ms, status);
+	if (U_FAILURE(status)) {
+		return nullptr;
+	}
+
+	auto result = make_shared_ptr<ICUDateFunc::TimeZoneOffsets>();
+	result->lower = lower;
+	result->upper = upper;
+	result->starts.emplace_back(lower);
+	result->offsets.emplace_back((raw_offset_ms + dst_offset_ms) * Interval::MICROS_PER_MSEC);
+
+	icu::TimeZoneTransition transition;
+	auto base = lower_millis;
+	while (tz.getNextTransition(base, false, transition) && transition.getTime() < upper_millis) {
+		base = transition.getTime();
+		const auto rule = transition.getTo();
+		if (!rule) {
+			return nullptr;
+		}
+		//	Skip transitions that only change the name or the split between raw and DST offsets
+		const auto offset = (rule->getRawOffset() + rule->getDSTSavings()) * Interval::MICROS_PER_MSEC;
+		if (offset != result->offsets.back()) {
+			result->starts.emplace_back(int64_t(base) * Interval::MICROS_PER_MSEC);
+			result->offsets.emplace_back(offset);
+		}
+	}
+
+	return std::move(result);
+}
+
+ICUDateFunc::TimeZoneOffsetsPtr ICUDateFunc::GetTimeZoneOffsets(icu::Calendar &calendar) {
+	//	Other calendars have different field semantics, so they always use ICU.
+	if (strcmp(calendar.getType(), "gregorian") != 0) {
+		return nullptr;
+	}
+	auto tz = dynamic_cast<const icu::BasicTimeZone *>(&calendar.getTimeZone());
+	if (!tz) {
+		return nullptr;
+	}
+
+	std::string tz_id;
+	icu::UnicodeString tz_name;
+	tz->getID(tz_name).toUTF8String(tz_id);
+
+	//	Building the table walks all the transitions, so share it between all bindings of the zone.
+	static mutex cache_lock;
+	static unordered_map<string, TimeZoneOffsetsPtr> cache;
+
+	lock_guard<mutex> guard(cache_lock);
+	auto entry = cache.find(tz_id);
+	if (entry != cache.end()) {
+		return entry->second;
+	}
+	auto result = BuildTimeZoneOffsets(*tz);
+	cache[tz_id] = result;
+	return result;
+}
+
 void ICUDateFunc::SetTimeZone(icu::Calendar *calendar, const string_t &tz_id) {
 	auto tz = icu_66::TimeZone::createTimeZone(icu::UnicodeString::fromUTF8(icu::StringPiece(tz_id.GetString())));
 	if (*tz == icu::TimeZone::getUnknown()) {
@@ -213,6 +213,153 @@ struct ICUDatePart : public ICUDateFunc {
 		}
 	}
 
+	//	Local time adapters for the Gregorian window of the time zone offset table
+	typedef int64_t (*part_local_t)(timestamp_t local, int64_t offset);
+
+	static int64_t LocalEra(timestamp_t local, int64_t offset) {
+		return Date::ExtractYear(Timestamp::GetDate(local)) > 0 ? 1 : 0;
+	}
+
+	static int64_t LocalYear(timestamp_t local, int64_t offset) {
+		return Date::ExtractYear(Timestamp::GetDate(local));
+	}
+
+	static int64_t LocalDecade(timestamp_t local, int64_t offset) {
+		return LocalYear(local, offset) / 10;
+	}
+
+	static int64_t LocalCentury(timestamp_t local, int64_t offset) {
+		return ((LocalYear(local, offset) - 1) / 100) + 1;
+	}
+
+	static int64_t LocalMillenium(timestamp_t local, int64_t offset) {
+		return ((LocalYear(local, offset) - 1) / 1000) + 1;
+	}
+
+	static int64_t LocalMonth(timestamp_t local, int64_t offset) {
+		return Date::ExtractMonth(Timestamp::GetDate(local));
+	}
+
+	static int64_t LocalQuarter(timestamp_t local, int64_t offset) {
+		return (LocalMonth(local, offset) - 1) / Interval::MONTHS_PER_QUARTER + 1;
+	}
+
+	static int64_t LocalDay(timestamp_t local, int64_t offset) {
+		return Date::ExtractDay(Timestamp::GetDate(local));
+	}
+
+	static int64_t LocalDayOfWeek(timestamp_t local, int64_t offset) {
+		// [Sun(0), Sat(6)]
+		return Date::ExtractISODayOfTheWeek(Timestamp::GetDate(local)) % 7;
+	}
+
+	static int64_t LocalISODayOfWeek(timestamp_t local, int64_t offset) {
+		// [Mon(1), Sun(7)]
+		return Date::ExtractISODayOfTheWeek(Timestamp::GetDate(local));
+	}
+
+	static int64_t LocalWeek(timestamp_t local, int64_t offset) {
+		return Date::ExtractISOWeekNumber(Timestamp::GetDate(local));
+	}
+
+	static int64_t LocalISOYear(timestamp_t local, int64_t offset) {
+		return Date::ExtractISOYearNumber(Timestamp::GetDate(local));
+	}
+
+	static int64_t LocalYearWeek(timestamp_t local, int64_t offset) {
+		int32_t iyyy;
+		int32_t ww;
+		Date::ExtractISOYearWeek(Timestamp::GetDate(local), iyyy, ww);
+		return iyyy * 100 + ((iyyy > 0) ? ww : -ww);
+	}
+
+	static int64_t LocalDayOfYear(timestamp_t local, int64_t offset) {
+		return Date::ExtractDayOfTheYear(Timestamp::GetDate(local));
+	}
+
+	static int64_t LocalHour(timestamp_t local, int64_t offset) {
+		return Timestamp::GetTime(local).micros / Interval::MICROS_PER_HOUR;
+	}
+
+	static int64_t LocalMinute(timestamp_t local, int64_t offset) {
+		return (Timestamp::GetTime(local).micros % Interval::MICROS_PER_HOUR) / Interval::MICROS_PER_MINUTE;
+	}
+
+	static int64_t LocalMicrosecond(timestamp_t local, int64_t offset) {
+		return Timestamp::GetTime(local).micros % Interval::MICROS_PER_MINUTE;
+	}
+
+	static int64_t LocalMillisecond(timestamp_t local, int64_t offset) {
+		return LocalMicrosecond(local, offset) / Interval::MICROS_PER_MSEC;
+	}
+
+	static int64_t LocalSecond(timestamp_t local, int64_t offset) {
+		return LocalMicrosecond(local, offset) / Interval::MICROS_PER_SEC;
+	}
+
+	static int64_t LocalTimezone(timestamp_t local, int64_t offset) {
+		return offset / Interval::MICROS_PER_SEC;
+	}
+
+	static int64_t LocalTimezoneHour(timestamp_t local, int64_t offset) {
+		return LocalTimezone(local, offset) / Interval::SECS_PER_HOUR;
+	}
+
+	static int64_t LocalTimezoneMinute(timestamp_t local, int64_t offset) {
+		return (LocalTimezone(local, offset) % Interval::SECS_PER_HOUR) / Interval::SECS_PER_MINUTE;
+	}
+
+	static part_local_t PartCodeLocalFactory(DatePartSpecifier part) {
+		switch (part) {
+		case DatePartSpecifier::YEAR:
+			return LocalYear;
+		case DatePartSpecifier::MONTH:
+			return LocalMonth;
+		case DatePartSpecifier::DAY:
+			return LocalDay;
+		case DatePartSpecifier::DECADE:
+			return LocalDecade;
+		case DatePartSpecifier::CENTURY:
+			return LocalCentury;
+		case DatePartSpecifier::MILLENNIUM:
+			return LocalMillenium;
+		case DatePartSpecifier::MICROSECONDS:
+			return LocalMicrosecond;
+		case DatePartSpecifier::MILLISECONDS:
+			return LocalMillisecond;
+		case DatePartSpecifier::SECOND:
+			return LocalSecond;
+		case DatePartSpecifier::MINUTE:
+			return LocalMinute;
+		case DatePartSpecifier::HOUR:
+			return LocalHour;
+		case DatePartSpecifier::DOW:
+			return LocalDayOfWeek;
+		case DatePartSpecifier::ISODOW:
+			return LocalISODayOfWeek;
+		case DatePartSpecifier::WEEK:
+			return LocalWeek;
+		case DatePartSpecifier::ISOYEAR:
+			return LocalISOYear;
+		case DatePartSpecifier::DOY:
+			return LocalDayOfYear;
+		case DatePartSpecifier::QUARTER:
+			return LocalQuarter;
+		case DatePartSpecifier::YEARWEEK:
+			return LocalYearWeek;
+		case DatePartSpecifier::ERA:
+			return LocalEra;
+		case DatePartSpecifier::TIMEZONE:
+			return LocalTimezone;
+		case DatePartSpecifier::TIMEZONE_HOUR:
+			return LocalTimezoneHour;
+		case DatePartSpecifier::TIMEZONE_MINUTE:
+			return LocalTimezoneMinute;
+		default:
+			return nullptr;
+		}
+	}
+
 	static date_t MakeLastDay(icu::Calendar *calendar, const uint64_t micros) {
 		// Set the calendar to midnight on the last day of the month
 		calendar->set(UCAL_MILLISECOND, 0);
@@ -253,15 +400,19 @@ struct ICUDatePart : public ICUDateFunc {
 		using result_t = RESULT_TYPE;
 		typedef result_t (*adapter_t)(icu::Calendar *calendar, const uint64_t micros);
 		using adapters_t = vector<adapter_t>;
+		typedef result_t (*local_adapter_t)(timestamp_t local, int64_t offset);
 
 		BindAdapterData(ClientContext &context, adapter_t adapter_p) : BindData(context), adapters(1, adapter_p) {
 		}
 		BindAdapterData(ClientContext &context, adapters_t &adapters_p) : BindData(context), adapters(adapters_p) {
 		}
-		BindAdapterData(const BindAdapterData &other) : BindData(other), adapters(other.adapters) {
+		BindAdapterData(const BindAdapterData &other)
+		    : BindData(other), adapters(other.adapters), local_adapter(other.local_adapter) {
 		}
 
 		adapters_t adapters;
+		//! Computes the part from the local time when the offset table covers the value
+		local_adapter_t local_adapter = nullptr;
 
 		bool Equals(const FunctionData &other_p) const override {
 			const auto &other = other_p.Cast<BindAdapterData>();
@@ -284,16 +435,22 @@ struct ICUDatePart : public ICUDateFunc {
 		CalendarPtr calendar_ptr(info.calendar->clone());
 		auto calendar = calendar_ptr.get();
 
-		UnaryExecutor::ExecuteWithNulls<INPUT_TYPE, RESULT_TYPE>(date_arg, result, args.size(),
-		                                                         [&](INPUT_TYPE input, ValidityMask &mask, idx_t idx) {
-			                                                         if (Timestamp::IsFinite(input)) {
-				                                                         const auto micros = SetTime(calendar, input);
-				                                                         return info.adapters[0](calendar, micros);
-			                                                         } else {
-				                                                         mask.SetInvalid(idx);
-				                                                         return RESULT_TYPE();
-			                                                         }
-		                                                         });
+		//	Only BIGINT parts have local adapters
+		auto offsets = info.local_adapter ? info.offsets.get() : nullptr;
+		UnaryExecutor::ExecuteWithNulls<INPUT_TYPE, RESULT_TYPE>(
+		    date_arg, result, args.size(), [&](INPUT_TYPE input, ValidityMask &mask, idx_t idx) {
+			    if (Timestamp::IsFinite(input)) {
+				    int64_t offset;
+				    if (offsets && offsets->TryGetOffset(input, offset)) {
+					    return info.local_adapter(timestamp_t(input.value + offset), offset);
+				    }
+				    const auto micros = SetTime(calendar, input);
+				    return info.adapters[0](calendar, micros);
+			    } else {
+				    mask.SetInvalid(idx);
+				    return RESULT_TYPE();
+			    }
+		    });
 	}
 
 	template <typename INPUT_TYPE, typename RESULT_TYPE>
@@ -307,13 +464,22 @@ struct ICUDatePart : public ICUDateFunc {
 		auto &info = func_expr.bind_info->Cast<BIND_TYPE>();
 		CalendarPtr calendar_ptr(info.calendar->clone());
 		auto calendar = calendar_ptr.get();
+		auto offsets = info.offsets.get();
 
 		BinaryExecutor::ExecuteWithNulls<string_t, INPUT_TYPE, RESULT_TYPE>(
 		    part_arg, date_arg, result, args.size(),
 		    [&](string_t specifier, INPUT_TYPE input, ValidityMask &mask, idx_t idx) {
 			    if (Timestamp::IsFinite(input)) {
+				    const auto part_code = GetDatePartSpecifier(specifier.GetString());
+				    int64_t offset;
+				    if (offsets && offsets->TryGetOffset(input, offset)) {
+					    auto local_adapter = PartCodeLocalFactory(part_code);
+					    if (local_adapter) {
+						    return RESULT_TYPE(local_adapter(timestamp_t(input.value + offset), offset));
+					    }
+				    }
 				    const auto micros = SetTime(calendar, input);
-				    auto adapter = PartCodeBigintFactory(GetDatePartSpecifier(specifier.GetString()));
+				    auto adapter = PartCodeBigintFactory(part_code);
 				    return adapter(calendar, micros);
 			    } else {
 				    mask.SetInvalid(idx);
@@ -470,7 +636,9 @@ struct ICUDatePart : public ICUDateFunc {
 		if (IsBigintDatepart(part_code)) {
 			using data_t = BindAdapterData<int64_t>;
 			auto adapter = PartCodeBigintFactory(part_code);
-			return BindAdapter<data_t>(context, bound_function, arguments, adapter);
+			auto result = make_uniq<data_t>(context, adapter);
+			result->local_adapter = PartCodeLocalFactory(part_code);
+			return std::move(result);
 		} else {
 			using data_t = BindAdapterData<double>;
 			auto adapter = PartCodeDoubleFactory(part_code);
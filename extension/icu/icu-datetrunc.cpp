@@ -126,6 +126,113 @@ struct ICUDateTrunc : public ICUDateFunc {
 		calendar->set(UCAL_ERA, era);
 	}
 
+	//	Local time truncations for the Gregorian window of the time zone offset table
+	typedef timestamp_t (*local_trunc_t)(timestamp_t local);
+
+	template <int64_t UNIT>
+	static timestamp_t LocalTruncTime(timestamp_t local) {
+		const auto time = Timestamp::GetTime(local);
+		return Timestamp::FromDatetime(Timestamp::GetDate(local), dtime_t(time.micros - time.micros % UNIT));
+	}
+
+	static timestamp_t LocalTruncDay(timestamp_t local) {
+		return Timestamp::FromDatetime(Timestamp::GetDate(local), dtime_t(0));
+	}
+
+	static timestamp_t LocalTruncWeek(timestamp_t local) {
+		return Timestamp::FromDatetime(Date::GetMondayOfCurrentWeek(Timestamp::GetDate(local)), dtime_t(0));
+	}
+
+	static timestamp_t LocalTruncISOYear(timestamp_t local) {
+		const auto iyyy = Date::ExtractISOYearNumber(Timestamp::GetDate(local));
+		return LocalTruncWeek(Timestamp::FromDatetime(Date::FromDate(iyyy, 1, 4), dtime_t(0)));
+	}
+
+	template <int32_t MONTHS>
+	static timestamp_t LocalTruncMonths(timestamp_t local) {
+		int32_t yyyy;
+		int32_t mm;
+		int32_t dd;
+		Date::Convert(Timestamp::GetDate(local), yyyy, mm, dd);
+		mm = ((mm - 1) / MONTHS) * MONTHS + 1;
+		return Timestamp::FromDatetime(Date::FromDate(yyyy, mm, 1), dtime_t(0));
+	}
+
+	template <int32_t YEARS>
+	static timestamp_t LocalTruncYears(timestamp_t local) {
+		const auto yyyy = Date::ExtractYear(Timestamp::GetDate(local));
+		return Timestamp::FromDatetime(Date::FromDate((yyyy / YEARS) * YEARS, 1, 1), dtime_t(0));
+	}
+
+	static local_trunc_t LocalTruncationFactory(DatePartSpecifier type) {
+		switch (type) {
+		case DatePartSpecifier::MILLENNIUM:
+			return LocalTruncYears<1000>;
+		case DatePartSpecifier::CENTURY:
+			return LocalTruncYears<100>;
+		case DatePartSpecifier::DECADE:
+			return LocalTruncYears<10>;
+		case DatePartSpecifier::YEAR:
+			return LocalTruncYears<1>;
+		case DatePartSpecifier::QUARTER:
+			return LocalTruncMonths<Interval::MONTHS_PER_QUARTER>;
+		case DatePartSpecifier::MONTH:
+			return LocalTruncMonths<1>;
+		case DatePartSpecifier::WEEK:
+		case DatePartSpecifier::YEARWEEK:
+			return LocalTruncWeek;
+		case DatePartSpecifier::ISOYEAR:
+			return LocalTruncISOYear;
+		case DatePartSpecifier::DAY:
+		case DatePartSpecifier::DOW:
+		case DatePartSpecifier::ISODOW:
+		case DatePartSpecifier::DOY:
+		case DatePartSpecifier::JULIAN_DAY:
+			return LocalTruncDay;
+		case DatePartSpecifier::HOUR:
+			return LocalTruncTime<Interval::MICROS_PER_HOUR>;
+		case DatePartSpecifier::MINUTE:
+			return LocalTruncTime<Interval::MICROS_PER_MINUTE>;
+		case DatePartSpecifier::SECOND:
+		case DatePartSpecifier::EPOCH:
+			return LocalTruncTime<Interval::MICROS_PER_SEC>;
+		case DatePartSpecifier::MILLISECONDS:
+			return LocalTruncTime<Interval::MICROS_PER_MSEC>;
+		case DatePartSpecifier::MICROSECONDS:
+			return LocalTruncTime<1>;
+		default:
+			return nullptr;
+		}
+	}
+
+	//! Sub-hour truncations keep the offset of the input (see PreserveOffsets)
+	static bool PreservesOffsets(DatePartSpecifier type) {
+		switch (type) {
+		case DatePartSpecifier::MINUTE:
+		case DatePartSpecifier::SECOND:
+		case DatePartSpecifier::EPOCH:
+		case DatePartSpecifier::MILLISECONDS:
+		case DatePartSpecifier::MICROSECONDS:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	static bool TryTruncLocal(const TimeZoneOffsets *offsets, local_trunc_t truncator, bool preserve,
+	                          timestamp_t input, timestamp_t &result) {
+		int64_t offset;
+		if (!offsets || !truncator || !offsets->TryGetOffset(input, offset)) {
+			return false;
+		}
+		const auto truncated = truncator(timestamp_t(input.value + offset));
+		if (preserve) {
+			result = timestamp_t(truncated.value - offset);
+			return true;
+		}
+		return offsets->TryFromLocal(truncated, result);
+	}
+
 	template <typename T>
 	static void ICUDateTruncFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 		D_ASSERT(args.ColumnCount() == 2);
@@ -135,6 +242,7 @@ struct ICUDateTrunc : public ICUDateFunc {
 		auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
 		auto &info = func_expr.bind_info->Cast<BindData>();
 		CalendarPtr calendar(info.calendar->clone());
+		auto offsets = info.offsets.get();
 
 		if (part_arg.GetVectorType() == VectorType::CONSTANT_VECTOR) {
 			// Common case of constant part.
@@ -143,9 +251,16 @@ struct ICUDateTrunc : public ICUDateFunc {
 				ConstantVector::SetNull(result, true);
 			} else {
 				const auto specifier = ConstantVector::GetData<string_t>(part_arg)->GetString();
-				auto truncator = TruncationFactory(GetDatePartSpecifier(specifier));
+				const auto part_code = GetDatePartSpecifier(specifier);
+				auto truncator = TruncationFactory(part_code);
+				auto local_truncator = LocalTruncationFactory(part_code);
+				const auto preserve = PreservesOffsets(part_code);
 				UnaryExecutor::Execute<T, timestamp_t>(date_arg, result, args.size(), [&](T input) {
 					if (Timestamp::IsFinite(input)) {
+						timestamp_t truncated;
+						if (TryTruncLocal(offsets, local_truncator, preserve, input, truncated)) {
+							return truncated;
+						}
 						auto micros = SetTime(calendar.get(), input);
 						truncator(calendar.get(), micros);
 						return GetTimeUnsafe(calendar.get(), micros);
@@ -158,7 +273,14 @@ struct ICUDateTrunc : public ICUDateFunc {
 			BinaryExecutor::Execute<string_t, T, timestamp_t>(
 			    part_arg, date_arg, result, args.size(), [&](string_t specifier, T input) {
 				    if (Timestamp::IsFinite(input)) {
-					    auto truncator = TruncationFactory(GetDatePartSpecifier(specifier.GetString()));
+					    const auto part_code = GetDatePartSpecifier(specifier.GetString());
+					    auto local_truncator = LocalTruncationFactory(part_code);
+					    const auto preserve = PreservesOffsets(part_code);
+					    timestamp_t truncated;
+					    if (TryTruncLocal(offsets, local_truncator, preserve, input, truncated)) {
+						    return truncated;
+					    }
+					    auto truncator = TruncationFactory(part_code);
 					    auto micros = SetTime(calendar.get(), input);
 					    truncator(calendar.get(), micros);
 					    return GetTimeUnsafe(calendar.get(), micros);
@@ -140,6 +140,14 @@ struct ICUFromNaiveTimestamp : public ICUDateFunc {
 		return GetTime(calendar, micros);
 	}
 
+	static inline timestamp_t Operation(icu::Calendar *calendar, const TimeZoneOffsets *offsets, timestamp_t naive) {
+		timestamp_t instant;
+		if (offsets && ICUIsFinite(naive) && offsets->TryFromLocal(naive, instant)) {
+			return instant;
+		}
+		return Operation(calendar, naive);
+	}
+
 	struct CastTimestampUsToUs {
 		template <class SRC, class DST>
 		static inline DST Operation(SRC input) {
@@ -154,8 +162,10 @@ struct ICUFromNaiveTimestamp : public ICUDateFunc {
 		auto &info = cast_data.info->Cast<BindData>();
 		CalendarPtr calendar(info.calendar->clone());
 
+		auto offsets = info.offsets.get();
+
 		UnaryExecutor::Execute<timestamp_t, timestamp_t>(source, result, count, [&](timestamp_t input) {
-			return Operation(calendar.get(), OP::template Operation<timestamp_t, timestamp_t>(input));
+			return Operation(calendar.get(), offsets, OP::template Operation<timestamp_t, timestamp_t>(input));
 		});
 		return true;
 	}
@@ -227,13 +237,23 @@ struct ICUToNaiveTimestamp : public ICUDateFunc {
 		return naive;
 	}
 
+	static inline timestamp_t Operation(icu::Calendar *calendar, const TimeZoneOffsets *offsets, timestamp_t instant) {
+		timestamp_t naive;
+		if (offsets && ICUIsFinite(instant) && offsets->TryToLocal(instant, naive)) {
+			return naive;
+		}
+		return Operation(calendar, instant);
+	}
+
 	static bool CastToNaive(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
 		auto &cast_data = parameters.cast_data->Cast<CastData>();
 		auto &info = cast_data.info->Cast<BindData>();
 		CalendarPtr calendar(info.calendar->clone());
 
+		auto offsets = info.offsets.get();
+
 		UnaryExecutor::Execute<timestamp_t, timestamp_t>(
-		    source, result, count, [&](timestamp_t input) { return Operation(calendar.get(), input); });
+		    source, result, count, [&](timestamp_t input) { return Operation(calendar.get(), offsets, input); });
 		return true;
 	}
 
@@ -339,6 +359,10 @@ struct ICUToTimeTZ : public ICUDateFunc {
 		time = Interval::Add(time, {0, 0, offset * Interval::MICROS_PER_SEC}, date);
 		return dtime_tz_t(time, offset);
 	}
+
+	static inline dtime_tz_t Operation(icu::Calendar *calendar, const TimeZoneOffsets *offsets, dtime_tz_t timetz) {
+		return Operation(calendar, timetz);
+	}
 };
 
 struct ICUTimeZoneFunc : public ICUDateFunc {
@@ -359,8 +383,10 @@ struct ICUTimeZoneFunc : public ICUDateFunc {
 				ConstantVector::SetNull(result, true);
 			} else {
 				SetTimeZone(calendar, *ConstantVector::GetData<string_t>(tz_vec));
+				auto offsets_ptr = GetTimeZoneOffsets(*calendar);
+				auto offsets = offsets_ptr.get();
 				UnaryExecutor::Execute<T, T>(ts_vec, result, input.size(),
-				                             [&](T ts) { return OP::Operation(calendar, ts); });
+				                             [&](T ts) { return OP::Operation(calendar, offsets, ts); });
 			}
 		} else {
 			BinaryExecutor::Execute<string_t, T, T>(tz_vec, ts_vec, result, input.size(), [&](string_t tz_id, T ts) {
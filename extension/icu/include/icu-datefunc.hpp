@@ -19,6 +19,28 @@ namespace duckdb {
 struct ICUDateFunc {
 	using CalendarPtr = duckdb::unique_ptr<icu::Calendar>;
 
+	//! The UTC offset transitions of a time zone over a window of years.
+	//! Within the window, conversions between instants and local times are
+	//! arithmetic plus a binary search instead of ICU calendar calls.
+	struct TimeZoneOffsets {
+		//! The instants (µs) bounding the window
+		int64_t lower;
+		int64_t upper;
+		//! The instants (µs) from which each total UTC offset applies
+		vector<int64_t> starts;
+		//! The total UTC offsets (µs)
+		vector<int64_t> offsets;
+
+		//! Gets the offset at the instant, returning false if it is outside the window
+		bool TryGetOffset(timestamp_t instant, int64_t &offset) const;
+		//! Converts an instant to local time, returning false if it is outside the window
+		bool TryToLocal(timestamp_t instant, timestamp_t &local) const;
+		//! Converts a local time to an instant, returning false if it is outside the window
+		//! or close enough to a transition that it might be skipped or repeated
+		bool TryFromLocal(timestamp_t local, timestamp_t &instant) const;
+	};
+	using TimeZoneOffsetsPtr = shared_ptr<const TimeZoneOffsets>;
+
 	struct BindData : public FunctionData {
 		explicit BindData(ClientContext &context);
 		BindData(const string &tz_setting, const string &cal_setting);
@@ -27,6 +49,8 @@ struct ICUDateFunc {
 		string tz_setting;
 		string cal_setting;
 		CalendarPtr calendar;
+		//! The cached offsets of the calendar's time zone (nullptr if they can't be used)
+		TimeZoneOffsetsPtr offsets;
 
 		bool Equals(const FunctionData &other_p) const override;
 		duckdb::unique_ptr<FunctionData> Copy() const override;
@@ -49,6 +73,8 @@ struct ICUDateFunc {
 	static duckdb::unique_ptr<FunctionData> Bind(ClientContext &context, ScalarFunction &bound_function,
 	                                             vector<duckdb::unique_ptr<Expression>> &arguments);
 
+	//! Gets the cached offsets of the calendar's time zone, or nullptr if the calendar is not Gregorian
+	static TimeZoneOffsetsPtr GetTimeZoneOffsets(icu::Calendar &calendar);
 	//! Sets the time zone for the calendar.
 	static void SetTimeZone(icu::Calendar *calendar, const string_t &tz_id);
 	//! Gets the timestamp from the calendar, throwing if it is not in range.
@@ -287,6 +287,67 @@ public:
 	//! Validate JSON Path ($.field[index]... syntax), returns true if there are wildcards in the path
 	static JSONPathType ValidatePath(const char *ptr, const idx_t &len, const bool binder);
 
+	//! A key or array index of a JSON path that is looked up in JSON text
+	struct JSONPathComponent {
+		bool is_key;
+		string key;
+		idx_t array_index;
+	};
+	//! Converts a (validated, non-wildcard) JSON path to components that can be looked up in JSON text, returns false
+	//! if the path can only be looked up in a parsed document
+	static bool GetLookupPath(const char *ptr, const idx_t &len, vector<JSONPathComponent> &components);
+	//! Looks up a path in the text of a JSON document, and parses only the value that was found. Returns false if the
+	//! document has to be parsed as a whole to look up the path, or to report that it is malformed
+	static bool TryLookupPath(const string_t &input, const vector<JSONPathComponent> &components, yyjson_alc *alc,
+	                          yyjson_val *&val);
+
+	//! Skips over the JSON string starting at ptr[pos], returns false if it is malformed or does not end before end
+	static inline bool SkipString(const char *ptr, idx_t &pos, const idx_t end, bool &escaped) {
+		D_ASSERT(ptr[pos] == '"');
+		for (pos++; pos < end; pos++) {
+			const auto c = static_cast<unsigned char>(ptr[pos]);
+			if (c == '\\') {
+				escaped = true;
+				if (++pos == end) {
+					return false;
+				}
+				switch (ptr[pos]) {
+				case '"':
+				case '\\':
+				case '/':
+				case 'b':
+				case 'f':
+				case 'n':
+				case 'r':
+				case 't':
+					break;
+				case 'u':
+					if (end - pos <= 4) {
+						return false;
+					}
+					for (idx_t i = 0; i < 4; i++) {
+						if (!StringUtil::CharacterIsHex(ptr[++pos])) {
+							return false;
+						}
+					}
+					break;
+				default:
+					return false;
+				}
+			} else if (c == '"') {
+				pos++;
+				return true;
+			} else if (c < 0x20) {
+				// Control characters must be escaped
+				return false;
+			}
+		}
+		return false;
+	}
+	//! Skips over the JSON value starting at ptr[pos], returns false if it is malformed, does not end before end, or is
+	//! nested too deeply to be checked (so it is left to yyjson)
+	static bool SkipValue(const char *ptr, idx_t &pos, const idx_t end);
+
 private:
 	//! Get JSON pointer (/field/index/... syntax)
 	static inline yyjson_val *GetPointer(yyjson_val *val, const char *ptr, const idx_t &len) {
@@ -45,11 +45,17 @@ public:
 			const char *ptr = info.ptr;
 			const idx_t &len = info.len;
 			if (info.path_type == JSONCommon::JSONPathType::REGULAR) {
+				// Values of the JSON type are valid JSON, so we can find the path without parsing the entire document
+				vector<JSONCommon::JSONPathComponent> lookup_path;
+				const bool lookup = inputs.GetType().IsJSONType() && JSONCommon::GetLookupPath(ptr, len, lookup_path);
 				UnaryExecutor::ExecuteWithNulls<string_t, T>(
 				    inputs, result, args.size(), [&](string_t input, ValidityMask &mask, idx_t idx) {
-					    auto doc =
-					        JSONCommon::ReadDocument(input, JSONCommon::READ_FLAG, lstate.json_allocator.GetYYAlc());
-					    auto val = JSONCommon::GetUnsafe(doc->root, ptr, len);
+					    yyjson_val *val;
+					    if (!lookup || !JSONCommon::TryLookupPath(input, lookup_path, alc, val)) {
+						    auto doc = JSONCommon::ReadDocument(input, JSONCommon::READ_FLAG,
+						                                        lstate.json_allocator.GetYYAlc());
+						    val = JSONCommon::GetUnsafe(doc->root, ptr, len);
+					    }
 					    if (SET_NULL_IF_NOT_FOUND && !val) {
 						    mask.SetInvalid(idx);
 						    return T {};
@@ -0,0 +1,27 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// json_optimizer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/optimizer_extension.hpp"
+
+namespace duckdb {
+
+//! Optimizes the extraction of paths from JSON:
+//! - Extractions of keys from a STRUCT that is cast to JSON are rewritten into extractions from the STRUCT
+//! - Extractions of different paths from the same JSON are fused into a single extraction of all paths, so that every
+//!   document is parsed once instead of once per path
+struct JSONOptimizerExtension {
+public:
+	static OptimizerExtension GetOptimizerExtension();
+
+private:
+	static void Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan);
+};
+
+} // namespace duckdb
@@ -77,6 +77,20 @@ public:
 		return candidate_formats.find(type)->second.back();
 	}
 
+	//! Combines the formats that remained after detecting the formats of different samples with copies of one map
+	void Combine(const DateFormatMap &other) {
+		for (auto &entry : candidate_formats) {
+			auto other_entry = other.candidate_formats.find(entry.first);
+			if (other_entry == other.candidate_formats.end()) {
+				continue;
+			}
+			// Formats are only ever removed from the back, so both are a prefix of the same list
+			while (entry.second.size() > other_entry->second.size()) {
+				entry.second.pop_back();
+			}
+		}
+	}
+
 private:
 	type_id_map_t<vector<StrpTimeFormat>> candidate_formats;
 };
@@ -180,6 +194,8 @@ public:
 	//! Column names that we're actually reading (after projection pushdown)
 	vector<string> names;
 	vector<column_t> column_indices;
+	//! If only some of the keys of the records are read: the keys (pointing into names) that are parsed
+	json_key_set_t projected_keys;
 
 	//! Buffer manager allocator
 	Allocator &allocator;
@@ -246,6 +262,7 @@ private:
 	void ParseNextChunk(JSONScanGlobalState &gstate);
 
 	void ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining);
+	bool ProjectJSONObject(char *const json_start, const idx_t json_size, idx_t &projected_size);
 	void ThrowObjectSizeError(const idx_t object_size);
 
 	//! Must hold the lock
@@ -279,6 +296,11 @@ private:
 
 	//! Buffer to reconstruct split values
 	AllocatedData reconstruct_buffer;
+
+	//! The keys of the records that are parsed, if the other keys are removed before parsing
+	optional_ptr<const json_key_set_t> projected_keys;
+	//! The [start, end) offsets of the members of a record that are kept when projecting it
+	vector<pair<idx_t, idx_t>> projected_members;
 };
 
 struct JSONGlobalTableFunctionState : public GlobalTableFunctionState {
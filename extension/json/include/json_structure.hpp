@@ -84,6 +84,8 @@ public:
 struct JSONStructure {
 public:
 	static void ExtractStructure(yyjson_val *val, JSONStructureNode &node, bool ignore_errors);
+	//! Merges the structure (and candidate types) of a node that was extracted from other values into a node
+	static void MergeStructure(JSONStructureNode &node, JSONStructureNode &other);
 	static LogicalType StructureToType(ClientContext &context, const JSONStructureNode &node, idx_t max_depth,
 	                                   double field_appearance_threshold, idx_t map_inference_threshold,
 	                                   idx_t depth = 0, const LogicalType &null_type = LogicalType::JSON());
@@ -249,6 +249,312 @@ JSONPathType JSONCommon::ValidatePath(const char *ptr, const idx_t &len, const b
 	return path_type;
 }
 
+static inline void SkipLookupWhitespace(const char *ptr, idx_t &pos, const idx_t end) {
+	while (pos < end && StringUtil::CharacterIsSpace(ptr[pos])) {
+		pos++;
+	}
+}
+
+static inline bool SkipDigits(const char *ptr, idx_t &pos, const idx_t end) {
+	const auto start = pos;
+	while (pos < end && StringUtil::CharacterIsDigit(ptr[pos])) {
+		pos++;
+	}
+	return pos != start;
+}
+
+static bool SkipNumber(const char *ptr, idx_t &pos, const idx_t end) {
+	// Infinity and NaN (allowed by READ_FLAG) are not accepted here, so they are left to yyjson
+	if (ptr[pos] == '-') {
+		pos++;
+	}
+	if (pos == end) {
+		return false;
+	}
+	if (ptr[pos] == '0') {
+		pos++;
+	} else if (!SkipDigits(ptr, pos, end)) {
+		return false;
+	}
+	if (pos < end && ptr[pos] == '.') {
+		pos++;
+		if (!SkipDigits(ptr, pos, end)) {
+			return false;
+		}
+	}
+	if (pos < end && (ptr[pos] == 'e' || ptr[pos] == 'E')) {
+		pos++;
+		if (pos < end && (ptr[pos] == '+' || ptr[pos] == '-')) {
+			pos++;
+		}
+		if (!SkipDigits(ptr, pos, end)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static inline bool SkipLiteral(const char *ptr, idx_t &pos, const idx_t end, const char *literal, idx_t len) {
+	if (end - pos < len || memcmp(ptr + pos, literal, len) != 0) {
+		return false;
+	}
+	pos += len;
+	return true;
+}
+
+//! Containers that are nested deeper than this are not skipped, but left to yyjson
+static constexpr idx_t MAXIMUM_SKIP_DEPTH = 128;
+
+static bool SkipValueInternal(const char *ptr, idx_t &pos, const idx_t end, idx_t depth);
+
+//! Skips over the members or elements of the container that ptr[pos] is in, up to and including its closing bracket
+static bool SkipMembers(const char *ptr, idx_t &pos, const idx_t end, const char close, idx_t depth) {
+	while (true) {
+		SkipLookupWhitespace(ptr, pos, end);
+		if (pos == end) {
+			return false;
+		}
+		if (ptr[pos] == close) {
+			// Also ends the container after a trailing comma, as allowed by READ_FLAG
+			pos++;
+			return true;
+		}
+		if (close == '}') {
+			bool escaped;
+			if (ptr[pos] != '"' || !JSONCommon::SkipString(ptr, pos, end, escaped)) {
+				return false;
+			}
+			SkipLookupWhitespace(ptr, pos, end);
+			if (pos == end || ptr[pos++] != ':') {
+				return false;
+			}
+			SkipLookupWhitespace(ptr, pos, end);
+			if (pos == end) {
+				return false;
+			}
+		}
+		if (!SkipValueInternal(ptr, pos, end, depth)) {
+			return false;
+		}
+		SkipLookupWhitespace(ptr, pos, end);
+		if (pos == end) {
+			return false;
+		}
+		if (ptr[pos] == ',') {
+			pos++;
+		} else if (ptr[pos] != close) {
+			return false;
+		}
+	}
+}
+
+static bool SkipValueInternal(const char *ptr, idx_t &pos, const idx_t end, idx_t depth) {
+	switch (ptr[pos]) {
+	case '"': {
+		bool escaped;
+		return JSONCommon::SkipString(ptr, pos, end, escaped);
+	}
+	case '{':
+	case '[': {
+		if (depth == MAXIMUM_SKIP_DEPTH) {
+			return false;
+		}
+		const auto close = ptr[pos++] == '{' ? '}' : ']';
+		return SkipMembers(ptr, pos, end, close, depth + 1);
+	}
+	case 't':
+		return SkipLiteral(ptr, pos, end, "true", 4);
+	case 'f':
+		return SkipLiteral(ptr, pos, end, "false", 5);
+	case 'n':
+		return SkipLiteral(ptr, pos, end, "null", 4);
+	default:
+		return SkipNumber(ptr, pos, end);
+	}
+}
+
+bool JSONCommon::SkipValue(const char *ptr, idx_t &pos, const idx_t end) {
+	return SkipValueInternal(ptr, pos, end, 0);
+}
+
+bool JSONCommon::GetLookupPath(const char *ptr, const idx_t &len, vector<JSONPathComponent> &components) {
+	// Path has been validated at this point
+	components.clear();
+	if (len == 0 || *ptr != '$') {
+		return false;
+	}
+	const char *const end = ptr + len;
+	ptr++; // Skip past '$'
+	while (ptr != end) {
+		const auto &c = *ptr++;
+		D_ASSERT(ptr != end);
+		switch (c) {
+		case '.': {
+			auto key_result = ReadKey(ptr, end);
+			if (!key_result.IsValid() || key_result.IsWildCard() || key_result.recursive) {
+				return false;
+			}
+			ptr += key_result.chars_read;
+			components.push_back({true, std::move(key_result.key), 0});
+			break;
+		}
+		case '[': {
+			idx_t array_index;
+			bool from_back;
+			// Indexes from the back of an array need its length
+			if (!ReadArrayIndex(ptr, end, array_index, from_back) || from_back ||
+			    array_index == DConstants::INVALID_INDEX) {
+				return false;
+			}
+			components.push_back({false, string(), array_index});
+			break;
+		}
+		default:
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Skips over the rest of the containers that the first depth components of a lookup path entered, and checks that
+//! only whitespace follows the document
+static bool SkipEnclosingContainers(const char *ptr, idx_t &pos, const idx_t end,
+                                    const vector<JSONCommon::JSONPathComponent> &components, idx_t depth) {
+	while (depth-- > 0) {
+		const auto close = components[depth].is_key ? '}' : ']';
+		SkipLookupWhitespace(ptr, pos, end);
+		if (pos == end) {
+			return false;
+		}
+		if (ptr[pos] == ',') {
+			pos++;
+		} else if (ptr[pos] != close) {
+			return false;
+		}
+		if (!SkipMembers(ptr, pos, end, close, depth + 1)) {
+			return false;
+		}
+	}
+	SkipLookupWhitespace(ptr, pos, end);
+	return pos == end;
+}
+
+bool JSONCommon::TryLookupPath(const string_t &input, const vector<JSONPathComponent> &components, yyjson_alc *alc,
+                               yyjson_val *&val) {
+	const auto ptr = input.GetData();
+	const auto end = input.GetSize();
+	idx_t pos = 0;
+	SkipLookupWhitespace(ptr, pos, end);
+	for (idx_t component_idx = 0; component_idx < components.size(); component_idx++) {
+		auto &component = components[component_idx];
+		if (pos == end) {
+			return false;
+		}
+		if (component.is_key) {
+			if (ptr[pos] != '{') {
+				// The path does not exist, but the rest of the document must still be valid
+				val = nullptr;
+				return SkipValue(ptr, pos, end) && SkipEnclosingContainers(ptr, pos, end, components, component_idx);
+			}
+			pos++;
+			while (true) {
+				SkipLookupWhitespace(ptr, pos, end);
+				if (pos == end) {
+					return false;
+				}
+				if (ptr[pos] == '}') {
+					pos++;
+					val = nullptr;
+					return SkipEnclosingContainers(ptr, pos, end, components, component_idx);
+				}
+				if (ptr[pos] != '"') {
+					return false;
+				}
+				const auto key_start = pos + 1;
+				bool escaped = false;
+				if (!SkipString(ptr, pos, end, escaped) || escaped) {
+					// Keys with escapes can only be compared after unescaping them
+					return false;
+				}
+				const auto key_len = pos - key_start - 1;
+				SkipLookupWhitespace(ptr, pos, end);
+				if (pos == end || ptr[pos++] != ':') {
+					return false;
+				}
+				SkipLookupWhitespace(ptr, pos, end);
+				if (pos == end) {
+					return false;
+				}
+				if (key_len == component.key.size() && memcmp(ptr + key_start, component.key.c_str(), key_len) == 0) {
+					break; // Found it, the value starts at pos
+				}
+				if (!SkipValue(ptr, pos, end)) {
+					return false;
+				}
+				SkipLookupWhitespace(ptr, pos, end);
+				if (pos == end) {
+					return false;
+				}
+				if (ptr[pos] == ',') {
+					pos++;
+				} else if (ptr[pos] != '}') {
+					return false;
+				}
+			}
+		} else {
+			if (ptr[pos] != '[') {
+				// The path does not exist, but the rest of the document must still be valid
+				val = nullptr;
+				return SkipValue(ptr, pos, end) && SkipEnclosingContainers(ptr, pos, end, components, component_idx);
+			}
+			pos++;
+			for (idx_t element_idx = 0;; element_idx++) {
+				SkipLookupWhitespace(ptr, pos, end);
+				if (pos == end) {
+					return false;
+				}
+				if (ptr[pos] == ']') {
+					pos++;
+					val = nullptr;
+					return SkipEnclosingContainers(ptr, pos, end, components, component_idx);
+				}
+				if (element_idx == component.array_index) {
+					break; // Found it, the value starts at pos
+				}
+				if (!SkipValue(ptr, pos, end)) {
+					return false;
+				}
+				SkipLookupWhitespace(ptr, pos, end);
+				if (pos == end) {
+					return false;
+				}
+				if (ptr[pos] == ',') {
+					pos++;
+				} else if (ptr[pos] != ']') {
+					return false;
+				}
+			}
+		}
+	}
+	SkipLookupWhitespace(ptr, pos, end);
+	const auto val_start = pos;
+	if (pos == end || !SkipValue(ptr, pos, end)) {
+		return false;
+	}
+	const auto val_end = pos;
+	if (!SkipEnclosingContainers(ptr, pos, end, components, components.size())) {
+		return false;
+	}
+	// Only parse the value that was found
+	yyjson_read_err error;
+	auto doc = ReadDocumentUnsafe(const_cast<char *>(ptr) + val_start, val_end - val_start, READ_FLAG, alc, &error);
+	if (error.code != YYJSON_READ_SUCCESS) {
+		return false;
+	}
+	val = doc->root;
+	return true;
+}
+
 yyjson_val *JSONCommon::GetPath(yyjson_val *val, const char *ptr, const idx_t &len) {
 	// Path has been validated at this point
 	const char *const end = ptr + len;
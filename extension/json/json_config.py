@@ -11,6 +11,7 @@ source_files = [
         'extension/json/json_extension.cpp',
         'extension/json/json_common.cpp',
         'extension/json/json_functions.cpp',
+        'extension/json/json_optimizer.cpp',
         'extension/json/json_scan.cpp',
         'extension/json/json_functions/copy_json.cpp',
         'extension/json/json_functions/json_array_length.cpp',
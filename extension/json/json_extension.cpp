@@ -13,6 +13,7 @@
 #include "duckdb/parser/tableref/table_function_ref.hpp"
 #include "json_common.hpp"
 #include "json_functions.hpp"
+#include "json_optimizer.hpp"
 
 namespace duckdb {
 
@@ -61,6 +62,9 @@ void JsonExtension::Load(DuckDB &db) {
 	auto &config = DBConfig::GetConfig(*db.instance);
 	config.replacement_scans.emplace_back(JSONFunctions::ReadJSONReplacement);
 
+	// JSON optimizer
+	config.optimizer_extensions.push_back(JSONOptimizerExtension::GetOptimizerExtension());
+
 	// JSON copy function
 	auto copy_fun = JSONFunctions::GetJSONCopyFunction();
 	ExtensionUtil::RegisterFunction(db_instance, std::move(copy_fun));
@@ -384,6 +384,46 @@ JSONStructureNode &JSONStructureDescription::GetOrCreateChild(yyjson_val *key, y
 	return child;
 }
 
+void JSONStructure::MergeStructure(JSONStructureNode &node, JSONStructureNode &other) {
+	node.count += other.count;
+	node.null_count += other.null_count;
+	for (auto &other_description : other.descriptions) {
+		const auto was_initialized = node.initialized;
+		auto &description = node.GetOrCreateDescription(other_description.type);
+		if (description.type != other_description.type) {
+			// Merged numerics, or a NULL that was not added
+			continue;
+		}
+		switch (description.type) {
+		case LogicalTypeId::LIST:
+			if (!other_description.children.empty()) {
+				MergeStructure(description.GetOrCreateChild(), other_description.children[0]);
+			}
+			break;
+		case LogicalTypeId::STRUCT:
+			for (auto &other_child : other_description.children) {
+				auto &child = description.GetOrCreateChild(other_child.key->c_str(), other_child.key->length());
+				MergeStructure(child, other_child);
+			}
+			break;
+		case LogicalTypeId::VARCHAR:
+			if (!other.initialized) {
+				break;
+			}
+			if (!was_initialized) {
+				description.candidate_types = other_description.candidate_types;
+				node.initialized = true;
+			} else if (description.candidate_types != other_description.candidate_types) {
+				// The candidate types were refined with different values, we don't know which type fits both
+				description.candidate_types.clear();
+			}
+			break;
+		default:
+			break;
+		}
+	}
+}
+
 static void ExtractStructureArray(yyjson_val *arr, JSONStructureNode &node, const bool ignore_errors) {
 	D_ASSERT(yyjson_is_arr(arr));
 	auto &description = node.GetOrCreateDescription(LogicalTypeId::LIST);
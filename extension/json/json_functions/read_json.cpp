@@ -4,6 +4,8 @@
 #include "json_structure.hpp"
 #include "json_transform.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 namespace duckdb {
 
@@ -36,64 +38,130 @@ static inline LogicalType RemoveDuplicateStructKeys(const LogicalType &type, con
 	}
 }
 
-void JSONScan::AutoDetect(ClientContext &context, JSONScanData &bind_data, vector<LogicalType> &return_types,
-                          vector<string> &names) {
-	// Change scan type during detection
-	bind_data.type = JSONScanType::SAMPLE;
+//! Samples values of a file, and refines the detected structure with them
+static void SampleJSONFile(ClientContext &context, JSONScanData &bind_data, BufferedJSONReader &reader,
+                           JSONStructureNode &node, DateFormatMap &date_format_map, idx_t &remaining,
+                           idx_t &avg_tuple_size) {
+	// Create global/local state and place the reader in the right field
+	JSONScanGlobalState gstate(context, bind_data);
+	JSONScanLocalState lstate(context, gstate);
+	gstate.json_readers.emplace_back(&reader);
 
-	// These are used across files (if union_by_name)
-	JSONStructureNode node;
 	ArenaAllocator allocator(BufferAllocator::Get(context));
 	Vector string_vector(LogicalType::VARCHAR);
 
-	// Loop through the files (if union_by_name, else sample up to sample_size rows or maximum_sample_files files)
-	idx_t remaining = bind_data.sample_size;
-	for (idx_t file_idx = 0; file_idx < bind_data.files.size(); file_idx++) {
-		// Create global/local state and place the reader in the right field
-		JSONScanGlobalState gstate(context, bind_data);
-		JSONScanLocalState lstate(context, gstate);
-		if (file_idx == 0) {
-			gstate.json_readers.emplace_back(bind_data.initial_reader.get());
-		} else {
-			gstate.json_readers.emplace_back(bind_data.union_readers[file_idx - 1].get());
+	// Read and detect schema
+	while (remaining != 0) {
+		allocator.Reset();
+		auto read_count = lstate.ReadNext(gstate);
+		if (read_count == 0) {
+			break;
 		}
 
-		// Read and detect schema
-		while (remaining != 0) {
-			allocator.Reset();
-			auto read_count = lstate.ReadNext(gstate);
-			if (read_count == 0) {
-				break;
+		idx_t next = MinValue<idx_t>(read_count, remaining);
+		for (idx_t i = 0; i < next; i++) {
+			const auto &val = lstate.values[i];
+			if (val) {
+				JSONStructure::ExtractStructure(val, node, true);
 			}
+		}
+		if (!node.ContainsVarchar()) { // Can't refine non-VARCHAR types
+			continue;
+		}
+		node.InitializeCandidateTypes(bind_data.max_depth, bind_data.convert_strings_to_integers);
+		node.RefineCandidateTypes(lstate.values, next, string_vector, allocator, date_format_map);
+		remaining -= next;
+	}
 
-			idx_t next = MinValue<idx_t>(read_count, remaining);
-			for (idx_t i = 0; i < next; i++) {
-				const auto &val = lstate.values[i];
-				if (val) {
-					JSONStructure::ExtractStructure(val, node, true);
-				}
-			}
-			if (!node.ContainsVarchar()) { // Can't refine non-VARCHAR types
-				continue;
-			}
-			node.InitializeCandidateTypes(bind_data.max_depth, bind_data.convert_strings_to_integers);
-			node.RefineCandidateTypes(lstate.values, next, string_vector, allocator, bind_data.date_format_map);
-			remaining -= next;
+	if (lstate.total_tuple_count != 0) {
+		avg_tuple_size = lstate.total_read_size / lstate.total_tuple_count;
+	}
+}
+
+//! Samples a single file with its own structure, so that files can be sampled in parallel
+class JSONSampleFileTask : public BaseExecutorTask {
+public:
+	JSONSampleFileTask(TaskExecutor &executor, ClientContext &context, JSONScanData &bind_data,
+	                   BufferedJSONReader &reader, JSONStructureNode &node, DateFormatMap &date_format_map,
+	                   idx_t &avg_tuple_size)
+	    : BaseExecutorTask(executor), context(context), bind_data(bind_data), reader(reader), node(node),
+	      date_format_map(date_format_map), avg_tuple_size(avg_tuple_size) {
+	}
+
+	void ExecuteTask() override {
+		idx_t remaining = bind_data.sample_size;
+		SampleJSONFile(context, bind_data, reader, node, date_format_map, remaining, avg_tuple_size);
+	}
+
+private:
+	ClientContext &context;
+	JSONScanData &bind_data;
+	BufferedJSONReader &reader;
+	JSONStructureNode &node;
+	DateFormatMap &date_format_map;
+	idx_t &avg_tuple_size;
+};
+
+static BufferedJSONReader &GetSampleReader(JSONScanData &bind_data, idx_t file_idx) {
+	return file_idx == 0 ? *bind_data.initial_reader : *bind_data.union_readers[file_idx - 1];
+}
+
+void JSONScan::AutoDetect(ClientContext &context, JSONScanData &bind_data, vector<LogicalType> &return_types,
+                          vector<string> &names) {
+	// Change scan type during detection
+	bind_data.type = JSONScanType::SAMPLE;
+
+	// These are used across files (if union_by_name)
+	JSONStructureNode node;
+	idx_t avg_tuple_size = 0;
+
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	if (bind_data.options.file_options.union_by_name && bind_data.files.size() > 1 &&
+	    scheduler.NumberOfThreads() > 1) {
+		// When union_by_name=true we sample sample_size per file, so we can sample the files in parallel
+		vector<JSONStructureNode> file_nodes(bind_data.files.size());
+		vector<DateFormatMap> file_date_format_maps(bind_data.files.size(), bind_data.date_format_map);
+		vector<idx_t> file_avg_tuple_sizes(bind_data.files.size(), 0);
+		TaskExecutor executor(context);
+		for (idx_t file_idx = 0; file_idx < bind_data.files.size(); file_idx++) {
+			auto task = make_uniq<JSONSampleFileTask>(executor, context, bind_data,
+			                                          GetSampleReader(bind_data, file_idx), file_nodes[file_idx],
+			                                          file_date_format_maps[file_idx], file_avg_tuple_sizes[file_idx]);
+			executor.ScheduleTask(std::move(task));
 		}
+		executor.WorkOnTasks();
 
-		if (file_idx == 0 && lstate.total_tuple_count != 0) {
-			bind_data.avg_tuple_size = lstate.total_read_size / lstate.total_tuple_count;
+		// Merge the structures in file order, so columns are ordered as if the files were sampled one by one
+		for (idx_t file_idx = 0; file_idx < bind_data.files.size(); file_idx++) {
+			JSONStructure::MergeStructure(node, file_nodes[file_idx]);
+			bind_data.date_format_map.Combine(file_date_format_maps[file_idx]);
 		}
+		avg_tuple_size = file_avg_tuple_sizes[0];
+	} else {
+		// Loop through the files (if union_by_name, else sample up to sample_size rows or maximum_sample_files files)
+		idx_t remaining = bind_data.sample_size;
+		for (idx_t file_idx = 0; file_idx < bind_data.files.size(); file_idx++) {
+			idx_t file_avg_tuple_size = 0;
+			SampleJSONFile(context, bind_data, GetSampleReader(bind_data, file_idx), node, bind_data.date_format_map,
+			               remaining, file_avg_tuple_size);
+			if (file_idx == 0) {
+				avg_tuple_size = file_avg_tuple_size;
+			}
 
-		// Close the file and stop detection if not union_by_name
-		if (bind_data.options.file_options.union_by_name) {
-			// When union_by_name=true we sample sample_size per file
-			remaining = bind_data.sample_size;
-		} else if (remaining == 0 || file_idx == bind_data.maximum_sample_files - 1) {
-			// When union_by_name=false, we sample sample_size in total (across the first maximum_sample_files files)
-			break;
+			// Close the file and stop detection if not union_by_name
+			if (bind_data.options.file_options.union_by_name) {
+				// When union_by_name=true we sample sample_size per file
+				remaining = bind_data.sample_size;
+			} else if (remaining == 0 || file_idx == bind_data.maximum_sample_files - 1) {
+				// When union_by_name=false, we sample sample_size in total (across the first maximum_sample_files
+				// files)
+				break;
+			}
 		}
 	}
+	if (avg_tuple_size != 0) {
+		bind_data.avg_tuple_size = avg_tuple_size;
+	}
 
 	// Restore the scan type
 	bind_data.type = JSONScanType::READ_JSON;
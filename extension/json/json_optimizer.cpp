@@ -0,0 +1,328 @@
+#include "json_optimizer.hpp"
+
+#include "json_common.hpp"
+
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/parser/expression_map.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/expression/bound_case_expression.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+//! The extractions of different paths from the same JSON by the same function
+struct JSONExtractionGroup {
+	//! Name of the function that extracts a list of paths
+	string function_name;
+	//! The JSON that the paths are extracted from
+	unique_ptr<Expression> input;
+	//! The paths, and their index in the list of paths
+	vector<Value> paths;
+	unordered_map<string, idx_t> path_indexes;
+	//! The column index of the fused extraction in the projection
+	idx_t column_index;
+};
+
+struct JSONExtractionState {
+	//! Groups per function, indexed by the JSON they extract from
+	expression_map_t<idx_t> extract_groups;
+	expression_map_t<idx_t> extract_string_groups;
+	vector<JSONExtractionGroup> groups;
+};
+
+//! Returns the function that extracts a list of paths, if expr extracts a single (non-wildcard) path
+static const char *GetMultiPathFunction(const Expression &expr) {
+	if (expr.expression_class != ExpressionClass::BOUND_FUNCTION) {
+		return nullptr;
+	}
+	auto &func_expr = expr.Cast<BoundFunctionExpression>();
+	if (func_expr.children.size() != 2 || func_expr.children[1]->expression_class != ExpressionClass::BOUND_CONSTANT ||
+	    func_expr.children[1]->return_type.id() != LogicalTypeId::VARCHAR ||
+	    func_expr.children[1]->Cast<BoundConstantExpression>().value.IsNull() || func_expr.children[0]->IsVolatile()) {
+		return nullptr;
+	}
+	// extractions of a wildcard path return a list
+	const auto &name = func_expr.function.name;
+	if ((name == "json_extract" || name == "json_extract_path") && func_expr.return_type.IsJSONType()) {
+		return "json_extract";
+	}
+	if ((name == "json_extract_string" || name == "json_extract_path_text" || name == "->>") &&
+	    func_expr.return_type == LogicalType::VARCHAR) {
+		return "json_extract_string";
+	}
+	return nullptr;
+}
+
+static void CollectExtractions(Expression &expr, JSONExtractionState &state) {
+	switch (expr.expression_class) {
+	case ExpressionClass::BOUND_COLUMN_REF:
+	case ExpressionClass::BOUND_CONSTANT:
+	// the children of conjunctions and case are not evaluated for every row, they might not be valid JSON
+	case ExpressionClass::BOUND_CONJUNCTION:
+	case ExpressionClass::BOUND_CASE:
+		return;
+	case ExpressionClass::BOUND_OPERATOR:
+		if (expr.type == ExpressionType::OPERATOR_COALESCE) {
+			return;
+		}
+		break;
+	default:
+		break;
+	}
+	auto function_name = GetMultiPathFunction(expr);
+	if (!function_name) {
+		ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { CollectExtractions(child, state); });
+		return;
+	}
+	auto &func_expr = expr.Cast<BoundFunctionExpression>();
+	auto &groups = string(function_name) == "json_extract" ? state.extract_groups : state.extract_string_groups;
+	auto &input = *func_expr.children[0];
+	auto entry = groups.find(input);
+	if (entry == groups.end()) {
+		JSONExtractionGroup group;
+		group.function_name = function_name;
+		group.input = input.Copy();
+		state.groups.push_back(std::move(group));
+		entry = groups.emplace(*state.groups.back().input, state.groups.size() - 1).first;
+	}
+	auto &group = state.groups[entry->second];
+	auto &path = func_expr.children[1]->Cast<BoundConstantExpression>().value;
+	if (group.path_indexes.find(StringValue::Get(path)) == group.path_indexes.end()) {
+		group.path_indexes[StringValue::Get(path)] = group.paths.size();
+		group.paths.push_back(path);
+	}
+}
+
+//! Replaces the fused extractions with a lookup in the list of extracted paths, and moves the other references to the
+//! projection
+static void ReplaceExtractions(ClientContext &context, unique_ptr<Expression> &expr, JSONExtractionState &state,
+                               const column_binding_map_t<idx_t> &column_map, idx_t projection_index) {
+	auto function_name = GetMultiPathFunction(*expr);
+	if (function_name) {
+		auto &func_expr = expr->Cast<BoundFunctionExpression>();
+		auto &groups = string(function_name) == "json_extract" ? state.extract_groups : state.extract_string_groups;
+		auto entry = groups.find(*func_expr.children[0]);
+		auto &path = func_expr.children[1]->Cast<BoundConstantExpression>().value;
+		if (entry != groups.end() && state.groups[entry->second].paths.size() > 1 &&
+		    state.groups[entry->second].path_indexes.count(StringValue::Get(path))) {
+			auto &group = state.groups[entry->second];
+			auto path_index = group.path_indexes[StringValue::Get(path)];
+
+			auto list_type = LogicalType::LIST(expr->return_type);
+			vector<unique_ptr<Expression>> children;
+			children.push_back(make_uniq<BoundColumnRefExpression>(
+			    list_type, ColumnBinding(projection_index, group.column_index)));
+			children.push_back(make_uniq<BoundConstantExpression>(Value::BIGINT(NumericCast<int64_t>(path_index + 1))));
+			ErrorData error;
+			FunctionBinder binder(context);
+			auto alias = expr->alias;
+			auto return_type = expr->return_type;
+			auto list_extract = binder.BindScalarFunction(DEFAULT_SCHEMA, "list_extract", std::move(children), error);
+			if (!list_extract) {
+				error.Throw();
+			}
+			D_ASSERT(list_extract->return_type == return_type);
+			list_extract->return_type = return_type;
+			list_extract->alias = alias;
+			expr = std::move(list_extract);
+			return;
+		}
+	}
+	if (expr->expression_class == ExpressionClass::BOUND_COLUMN_REF) {
+		auto &colref = expr->Cast<BoundColumnRefExpression>();
+		auto column_entry = column_map.find(colref.binding);
+		if (column_entry != column_map.end()) {
+			colref.binding = ColumnBinding(projection_index, column_entry->second);
+		}
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<Expression> &child) {
+		ReplaceExtractions(context, child, state, column_map, projection_index);
+	});
+}
+
+static void FuseExtractions(ClientContext &context, Binder &binder, LogicalProjection &proj) {
+	JSONExtractionState state;
+	for (auto &expr : proj.expressions) {
+		CollectExtractions(*expr, state);
+	}
+	bool fuse = false;
+	for (auto &group : state.groups) {
+		fuse = fuse || group.paths.size() > 1;
+	}
+	if (!fuse) {
+		return;
+	}
+
+	// extract all paths in a projection under this one, which also passes through all columns
+	auto &child = proj.children[0];
+	child->ResolveOperatorTypes();
+	auto bindings = child->GetColumnBindings();
+	const auto projection_index = binder.GenerateTableIndex();
+	column_binding_map_t<idx_t> column_map;
+	vector<unique_ptr<Expression>> expressions;
+	for (idx_t col_idx = 0; col_idx < bindings.size(); col_idx++) {
+		column_map[bindings[col_idx]] = col_idx;
+		expressions.push_back(make_uniq<BoundColumnRefExpression>(child->types[col_idx], bindings[col_idx]));
+	}
+	for (auto &group : state.groups) {
+		if (group.paths.size() == 1) {
+			continue;
+		}
+		vector<unique_ptr<Expression>> children;
+		children.push_back(group.input->Copy());
+		children.push_back(make_uniq<BoundConstantExpression>(Value::LIST(LogicalType::VARCHAR, group.paths)));
+		ErrorData error;
+		FunctionBinder function_binder(context);
+		auto extraction =
+		    function_binder.BindScalarFunction(DEFAULT_SCHEMA, group.function_name, std::move(children), error);
+		if (!extraction) {
+			error.Throw();
+		}
+		group.column_index = expressions.size();
+		expressions.push_back(std::move(extraction));
+	}
+
+	for (auto &expr : proj.expressions) {
+		ReplaceExtractions(context, expr, state, column_map, projection_index);
+	}
+
+	auto projection = make_uniq<LogicalProjection>(projection_index, std::move(expressions));
+	if (child->has_estimated_cardinality) {
+		projection->SetEstimatedCardinality(child->estimated_cardinality);
+	}
+	projection->children.push_back(std::move(child));
+	proj.children[0] = std::move(projection);
+}
+
+static void FuseExtractionsRecursive(ClientContext &context, Binder &binder, LogicalOperator &op) {
+	for (auto &child : op.children) {
+		FuseExtractionsRecursive(context, binder, *child);
+	}
+	if (op.type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		FuseExtractions(context, binder, op.Cast<LogicalProjection>());
+	}
+}
+
+static unique_ptr<Expression> BindFunction(ClientContext &context, const string &name,
+                                           vector<unique_ptr<Expression>> children) {
+	ErrorData error;
+	FunctionBinder binder(context);
+	auto result = binder.BindScalarFunction(DEFAULT_SCHEMA, name, std::move(children), error);
+	if (!result) {
+		error.Throw();
+	}
+	return result;
+}
+
+//! Rewrites an extraction of a path of keys from a STRUCT that is cast to JSON into an extraction from the STRUCT, so
+//! that the STRUCT is neither converted to JSON nor parsed again. Returns nullptr if it cannot be rewritten
+static unique_ptr<Expression> TryExtractFromStruct(ClientContext &context, BoundFunctionExpression &func_expr,
+                                                   const char *function_name) {
+	auto &input = *func_expr.children[0];
+	if (input.expression_class != ExpressionClass::BOUND_CAST || !input.return_type.IsJSONType()) {
+		return nullptr;
+	}
+	auto &cast = input.Cast<BoundCastExpression>();
+	if (cast.child->return_type.id() != LogicalTypeId::STRUCT || cast.child->IsVolatile()) {
+		return nullptr;
+	}
+	auto &path = StringValue::Get(func_expr.children[1]->Cast<BoundConstantExpression>().value);
+	vector<JSONCommon::JSONPathComponent> components;
+	if (!JSONCommon::GetLookupPath(path.c_str(), path.size(), components) || components.empty()) {
+		return nullptr;
+	}
+
+	// The keys of the JSON are the (case-sensitive) names of the STRUCT
+	unique_ptr<Expression> parent;
+	auto value = cast.child->Copy();
+	for (auto &component : components) {
+		if (!component.is_key || value->return_type.id() != LogicalTypeId::STRUCT) {
+			return nullptr;
+		}
+		bool found = false;
+		for (auto &child_type : StructType::GetChildTypes(value->return_type)) {
+			found = found || child_type.first == component.key;
+		}
+		if (!found) {
+			return nullptr;
+		}
+		parent = value->Copy();
+		vector<unique_ptr<Expression>> children;
+		children.push_back(std::move(value));
+		children.push_back(make_uniq<BoundConstantExpression>(Value(component.key)));
+		value = BindFunction(context, "struct_extract", std::move(children));
+	}
+
+	const auto &return_type = func_expr.return_type;
+	const auto extract_string = string(function_name) == "json_extract_string";
+	if (extract_string && value->return_type.IsJSONType()) {
+		// JSON strings would have to be unquoted
+		return nullptr;
+	}
+	if (!extract_string || value->return_type.id() != LogicalTypeId::VARCHAR) {
+		// Strings are extracted as they are, everything else is extracted as JSON
+		vector<unique_ptr<Expression>> children;
+		children.push_back(std::move(value));
+		value = BindFunction(context, "to_json", std::move(children));
+		if (value->return_type != return_type) {
+			value = BoundCastExpression::AddCastToType(context, std::move(value), return_type);
+		}
+	}
+
+	// A NULL field is a JSON null, but the path is not found if the STRUCT that contains it is NULL
+	auto coalesce = make_uniq<BoundOperatorExpression>(ExpressionType::OPERATOR_COALESCE, return_type);
+	coalesce->children.push_back(std::move(value));
+	coalesce->children.push_back(
+	    BoundCastExpression::AddCastToType(context, make_uniq<BoundConstantExpression>(Value("null")), return_type));
+	auto parent_is_null = make_uniq<BoundOperatorExpression>(ExpressionType::OPERATOR_IS_NULL, LogicalType::BOOLEAN);
+	parent_is_null->children.push_back(std::move(parent));
+	auto result = make_uniq<BoundCaseExpression>(std::move(parent_is_null),
+	                                             make_uniq<BoundConstantExpression>(Value(return_type)),
+	                                             std::move(coalesce));
+	result->alias = func_expr.alias;
+	return std::move(result);
+}
+
+static void ExtractFromStructs(ClientContext &context, unique_ptr<Expression> &expr) {
+	auto function_name = GetMultiPathFunction(*expr);
+	if (function_name) {
+		auto result = TryExtractFromStruct(context, expr->Cast<BoundFunctionExpression>(), function_name);
+		if (result) {
+			expr = std::move(result);
+			return;
+		}
+	}
+	ExpressionIterator::EnumerateChildren(*expr,
+	                                      [&](unique_ptr<Expression> &child) { ExtractFromStructs(context, child); });
+}
+
+static void ExtractFromStructsRecursive(ClientContext &context, LogicalOperator &op) {
+	for (auto &child : op.children) {
+		ExtractFromStructsRecursive(context, *child);
+	}
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    op, [&](unique_ptr<Expression> *expr) { ExtractFromStructs(context, *expr); });
+}
+
+void JSONOptimizerExtension::Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
+	ExtractFromStructsRecursive(input.context, *plan);
+	FuseExtractionsRecursive(input.context, input.optimizer.binder, *plan);
+}
+
+OptimizerExtension JSONOptimizerExtension::GetOptimizerExtension() {
+	OptimizerExtension extension;
+	extension.optimize_function = Optimize;
+	return extension;
+}
+
+} // namespace duckdb
@@ -155,6 +155,9 @@ JSONScanLocalState::JSONScanLocalState(ClientContext &context, JSONScanGlobalSta
     : scan_count(0), batch_index(DConstants::INVALID_INDEX), total_read_size(0), total_tuple_count(0),
       bind_data(gstate.bind_data), allocator(BufferAllocator::Get(context)), is_last(false),
       fs(FileSystem::GetFileSystem(context)), buffer_size(0), buffer_offset(0), prev_buffer_remainder(0) {
+	if (!gstate.projected_keys.empty()) {
+		projected_keys = &gstate.projected_keys;
+	}
 }
 
 JSONGlobalTableFunctionState::JSONGlobalTableFunctionState(ClientContext &context, TableFunctionInitInput &input)
@@ -196,6 +199,14 @@ unique_ptr<GlobalTableFunctionState> JSONGlobalTableFunctionState::Init(ClientCo
 		gstate.transform_options.error_unknown_key = false;
 	}
 
+	if (bind_data.type == JSONScanType::READ_JSON && bind_data.options.record_type == JSONRecordType::RECORDS &&
+	    !gstate.names.empty() && gstate.names.size() < bind_data.names.size()) {
+		// Only some keys of the records are read, so we remove the other keys before parsing the records
+		for (const auto &name : gstate.names) {
+			gstate.projected_keys.insert({name.c_str(), name.length()});
+		}
+	}
+
 	// Place readers where they belong
 	if (bind_data.initial_reader) {
 		bind_data.initial_reader->Reset();
@@ -380,13 +391,92 @@ static inline void TrimWhitespace(JSONString &line) {
 	}
 }
 
+bool JSONScanLocalState::ProjectJSONObject(char *const json_start, const idx_t json_size, idx_t &projected_size) {
+	// First we find the members that are kept, without modifying the record, so we can still parse it as a whole if
+	// it turns out to be something other than a well-formed object
+	projected_members.clear();
+	idx_t pos = 0;
+	SkipWhitespace(json_start, pos, json_size);
+	if (pos == json_size || json_start[pos] != '{') {
+		return false;
+	}
+	const auto object_start = pos++;
+	while (true) {
+		SkipWhitespace(json_start, pos, json_size);
+		if (pos == json_size) {
+			return false;
+		}
+		if (json_start[pos] == '}') {
+			break;
+		}
+		if (json_start[pos] != '"') {
+			return false;
+		}
+		const auto member_start = pos;
+		bool escaped = false;
+		if (!JSONCommon::SkipString(json_start, pos, json_size, escaped)) {
+			return false;
+		}
+		// Keys with escapes are kept, as we can only compare them after yyjson unescapes them
+		const auto keep = escaped || projected_keys->find({json_start + member_start + 1, pos - member_start - 2}) !=
+		                                 projected_keys->end();
+		SkipWhitespace(json_start, pos, json_size);
+		if (pos == json_size || json_start[pos++] != ':') {
+			return false;
+		}
+		SkipWhitespace(json_start, pos, json_size);
+		if (pos == json_size || !JSONCommon::SkipValue(json_start, pos, json_size)) {
+			return false;
+		}
+		if (keep) {
+			projected_members.emplace_back(member_start, pos);
+		}
+		SkipWhitespace(json_start, pos, json_size);
+		if (pos == json_size) {
+			return false;
+		}
+		if (json_start[pos] == ',') {
+			pos++;
+		} else if (json_start[pos] != '}') {
+			return false;
+		}
+	}
+	// Only whitespace may follow the record
+	idx_t end = pos + 1;
+	SkipWhitespace(json_start, end, json_size);
+	if (end != json_size) {
+		return false;
+	}
+
+	// Now move the members that are kept to the front, the skipped members are never seen by yyjson
+	projected_size = object_start + 1;
+	for (const auto &member : projected_members) {
+		if (projected_size != object_start + 1) {
+			json_start[projected_size++] = ',';
+		}
+		const auto member_size = member.second - member.first;
+		memmove(json_start + projected_size, json_start + member.first, member_size);
+		projected_size += member_size;
+	}
+	json_start[projected_size++] = '}';
+	return true;
+}
+
 void JSONScanLocalState::ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining) {
 	yyjson_doc *doc;
 	yyjson_read_err err;
+	idx_t parse_size = json_size;
 	if (bind_data.type == JSONScanType::READ_JSON_OBJECTS) { // If we return strings, we cannot parse INSITU
 		doc = JSONCommon::ReadDocumentUnsafe(json_start, json_size, JSONCommon::READ_STOP_FLAG, allocator.GetYYAlc(),
 		                                     &err);
 	} else {
+		if (projected_keys) {
+			// Skip the keys that are not read, so that yyjson does not allocate (or even parse) their values
+			idx_t projected_size;
+			if (ProjectJSONObject(json_start, json_size, projected_size)) {
+				parse_size = projected_size;
+			}
+		}
 		doc = JSONCommon::ReadDocumentUnsafe(json_start, remaining, JSONCommon::READ_INSITU_FLAG, allocator.GetYYAlc(),
 		                                     &err);
 	}
@@ -396,16 +486,16 @@ void JSONScanLocalState::ParseJSON(char *const json_start, const idx_t json_size
 
 	// We parse with YYJSON_STOP_WHEN_DONE, so we need to check this by hand
 	const auto read_size = yyjson_doc_get_read_size(doc);
-	if (read_size > json_size) {
+	if (read_size > parse_size) {
 		// Can't go past the boundary, even with ignore_errors
 		err.code = YYJSON_READ_ERROR_UNEXPECTED_END;
 		err.msg = "unexpected end of data";
-		err.pos = json_size;
+		err.pos = parse_size;
 		current_reader->ThrowParseError(current_buffer_handle->buffer_index, lines_or_objects_in_buffer, err,
 		                                "Try auto-detecting the JSON format");
-	} else if (!bind_data.ignore_errors && read_size < json_size) {
+	} else if (!bind_data.ignore_errors && read_size < parse_size) {
 		idx_t off = read_size;
-		idx_t rem = json_size;
+		idx_t rem = parse_size;
 		SkipWhitespace(json_start, off, rem);
 		if (off != rem) { // Between end of document and boundary should be whitespace only
 			err.code = YYJSON_READ_ERROR_UNEXPECTED_CONTENT;
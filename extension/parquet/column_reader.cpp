@@ -27,6 +27,14 @@
 #include "duckdb/common/types/blob.hpp"
 #endif
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DUCKDB_PARQUET_UNPACK_AVX2
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define DUCKDB_PARQUET_UNPACK_NEON
+#include <arm_neon.h>
+#endif
+
 namespace duckdb {
 
 using duckdb_parquet::format::CompressionCodec;
@@ -105,6 +113,99 @@ const uint64_t ParquetDecodeUtils::BITPACK_MASKS_SIZE = sizeof(ParquetDecodeUtil
 
 const uint8_t ParquetDecodeUtils::BITPACK_DLEN = 8;
 
+#if defined(DUCKDB_PARQUET_UNPACK_AVX2) || defined(DUCKDB_PARQUET_UNPACK_NEON)
+#ifdef DUCKDB_PARQUET_UNPACK_AVX2
+#define DUCKDB_PARQUET_UNPACK_TARGET __attribute__((target("avx2")))
+
+static bool HasSIMDBitUnpack() {
+	static const bool supported = []() {
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+	}();
+	return supported;
+}
+#else
+#define DUCKDB_PARQUET_UNPACK_TARGET
+
+static bool HasSIMDBitUnpack() {
+	return true;
+}
+#endif
+
+//! Unpacks groups of 32 values of at most 14 bits. Every eight values take up exactly width bytes, so they are
+//! unpacked from a single 16-byte load: each value is shuffled into its own 32-bit lane, then shifted and masked
+DUCKDB_PARQUET_UNPACK_TARGET static uint32_t BitUnpackGroupsKernel(const_data_ptr_t src, const idx_t src_len,
+                                                                   uint32_t *dest, const uint32_t group_count,
+                                                                   const uint8_t width) {
+	static constexpr idx_t VALUES_PER_LOAD = 8;
+	static constexpr idx_t LOAD_SIZE = 16;
+	static constexpr idx_t LOADS_PER_GROUP = BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE / VALUES_PER_LOAD;
+	// value j of every eight values starts at bit j * width: its 32-bit lane takes the four bytes from the byte it
+	// starts in, and is shifted right by its offset in that byte
+	uint8_t shuffle_bytes[VALUES_PER_LOAD * sizeof(uint32_t)];
+	uint32_t shifts[VALUES_PER_LOAD];
+	for (idx_t value_idx = 0; value_idx < VALUES_PER_LOAD; value_idx++) {
+		for (idx_t byte_idx = 0; byte_idx < sizeof(uint32_t); byte_idx++) {
+			shuffle_bytes[value_idx * sizeof(uint32_t) + byte_idx] =
+			    UnsafeNumericCast<uint8_t>(value_idx * width / 8 + byte_idx);
+		}
+		shifts[value_idx] = UnsafeNumericCast<uint32_t>(value_idx * width % 8);
+	}
+	const auto mask_value = static_cast<uint32_t>(ParquetDecodeUtils::BITPACK_MASKS[width]);
+#ifdef DUCKDB_PARQUET_UNPACK_AVX2
+	// the shuffle indexes into each 128-bit half, which both hold the loaded bytes
+	const auto shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(shuffle_bytes));
+	const auto shift = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(shifts));
+	const auto mask = _mm256_set1_epi32(static_cast<int32_t>(mask_value));
+#else
+	const auto shuffle_low = vld1q_u8(shuffle_bytes);
+	const auto shuffle_high = vld1q_u8(shuffle_bytes + LOAD_SIZE);
+	// NEON shifts right by shifting left with a negative amount
+	const auto shift_low = vnegq_s32(vreinterpretq_s32_u32(vld1q_u32(shifts)));
+	const auto shift_high = vnegq_s32(vreinterpretq_s32_u32(vld1q_u32(shifts + 4)));
+	const auto mask = vdupq_n_u32(mask_value);
+#endif
+	const idx_t group_bytes = BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE * width / 8;
+	uint32_t group_idx = 0;
+	for (; group_idx < group_count; group_idx++) {
+		// the last load of a group reads past its end, stop before it would read past the end of the buffer
+		if ((group_idx + 1) * group_bytes - width + LOAD_SIZE > src_len) {
+			break;
+		}
+		for (idx_t load_idx = 0; load_idx < LOADS_PER_GROUP; load_idx++) {
+			const auto load_src = src + group_idx * group_bytes + load_idx * width;
+			const auto load_dest = dest + group_idx * BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE +
+			                       load_idx * VALUES_PER_LOAD;
+#ifdef DUCKDB_PARQUET_UNPACK_AVX2
+			auto bytes = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(load_src)));
+			auto values = _mm256_and_si256(_mm256_srlv_epi32(_mm256_shuffle_epi8(bytes, shuffle), shift), mask);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(load_dest), values);
+#else
+			auto bytes = vld1q_u8(load_src);
+			auto low = vreinterpretq_u32_u8(vqtbl1q_u8(bytes, shuffle_low));
+			auto high = vreinterpretq_u32_u8(vqtbl1q_u8(bytes, shuffle_high));
+			vst1q_u32(load_dest, vandq_u32(vshlq_u32(low, shift_low), mask));
+			vst1q_u32(load_dest + 4, vandq_u32(vshlq_u32(high, shift_high), mask));
+#endif
+		}
+	}
+	return group_idx;
+}
+#endif
+
+uint32_t ParquetDecodeUtils::BitUnpackGroupsSIMD(ByteBuffer &buffer, uint32_t *dest, uint32_t group_count,
+                                                 uint8_t width) {
+	D_ASSERT(width > 0 && width <= BITPACK_SIMD_MAX_WIDTH);
+#if defined(DUCKDB_PARQUET_UNPACK_AVX2) || defined(DUCKDB_PARQUET_UNPACK_NEON)
+	if (HasSIMDBitUnpack()) {
+		auto unpacked_groups = BitUnpackGroupsKernel(buffer.ptr, buffer.len, dest, group_count, width);
+		buffer.unsafe_inc(unpacked_groups * BITPACK_GROUP_SIZE * width / 8);
+		return unpacked_groups;
+	}
+#endif
+	return 0;
+}
+
 ColumnReader::ColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p, idx_t file_idx_p,
                            idx_t max_define_p, idx_t max_repeat_p)
     : schema(schema_p), file_idx(file_idx_p), max_define(max_define_p), max_repeat(max_repeat_p), reader(reader),
@@ -217,6 +318,9 @@ void ColumnReader::DeltaByteArray(uint8_t *defines, idx_t num_values, // NOLINT
 
 void ColumnReader::DictReference(Vector &result) {
 }
+bool ColumnReader::DictionaryEntries(idx_t num_entries, Vector &result) { // NOLINT
+	return false;
+}
 void ColumnReader::PlainReference(shared_ptr<ByteBuffer>, Vector &result) { // NOLINT
 }
 
@@ -238,6 +342,73 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	offset_index.reset();
+	dictionary_size = 0;
+	dictionary_vector.reset();
+	dictionary_filter = nullptr;
+}
+
+void ColumnReader::EnableDictionaryOutput() {
+	dictionary_output = true;
+}
+
+idx_t ColumnReader::DictionarySize() const {
+	return dictionary_size;
+}
+
+const bool *ColumnReader::GetDictionaryFilterMatches(const TableFilter &filter) const {
+	if (dictionary_filter.get() != &filter) {
+		return nullptr;
+	}
+	return dictionary_filter_matches.get();
+}
+
+bool *ColumnReader::InitializeDictionaryFilterMatches(const TableFilter &filter) {
+	D_ASSERT(dictionary_vector);
+	dictionary_filter = &filter;
+	dictionary_filter_matches = make_unsafe_uniq_array<bool>(dictionary_size + 1);
+	return dictionary_filter_matches.get();
+}
+
+bool ColumnReader::PrepareDictionaryVector() {
+	if (!dictionary_output || HasRepeats() || dictionary_size == 0) {
+		return false;
+	}
+	if (dictionary_vector) {
+		return true;
+	}
+	// the dictionary is only worth referencing if its entries are repeated, otherwise we decode the values directly
+	if (dictionary_size * 2 > NumericCast<idx_t>(chunk->meta_data.num_values)) {
+		return false;
+	}
+	auto entries = make_uniq<Vector>(type, dictionary_size + 1);
+	if (!DictionaryEntries(dictionary_size, *entries)) {
+		// this reader cannot produce its dictionary as a vector
+		dictionary_output = false;
+		return false;
+	}
+	FlatVector::Validity(*entries).SetInvalid(dictionary_size);
+	dictionary_vector = std::move(entries);
+	return true;
+}
+
+void ColumnReader::DictionaryVectorOffsets(const uint32_t *offsets, const uint8_t *defines, idx_t num_values,
+                                           Vector &result) {
+	SelectionVector sel(num_values);
+	idx_t offset_idx = 0;
+	for (idx_t row_idx = 0; row_idx < num_values; row_idx++) {
+		if (defines && defines[row_idx] != max_define) {
+			// NULL values point to the NULL entry at the end of the dictionary
+			sel.set_index(row_idx, dictionary_size);
+			continue;
+		}
+		auto offset = offsets[offset_idx++];
+		if (offset >= dictionary_size) {
+			throw IOException("Parquet file is likely corrupted, dictionary offset out of range");
+		}
+		sel.set_index(row_idx, offset);
+	}
+	result.Slice(*dictionary_vector, sel, num_values);
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -257,10 +428,18 @@ void ColumnReader::PrepareRead(parquet_filter_t &filter) {
 		PreparePage(page_hdr);
 		PrepareDataPage(page_hdr);
 		break;
-	case PageType::DICTIONARY_PAGE:
+	case PageType::DICTIONARY_PAGE: {
 		PreparePage(page_hdr);
-		Dictionary(std::move(block), page_hdr.dictionary_page_header.num_values);
+		auto num_entries = page_hdr.dictionary_page_header.num_values;
+		if (num_entries < 0) {
+			throw std::runtime_error("Invalid dictionary page header (num_values < 0)");
+		}
+		Dictionary(std::move(block), NumericCast<idx_t>(num_entries));
+		dictionary_size = NumericCast<idx_t>(num_entries);
+		dictionary_vector.reset();
+		dictionary_filter = nullptr;
 		break;
+	}
 	default:
 		break; // ignore INDEX page type and any other custom extensions
 	}
@@ -518,21 +697,26 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 
 		idx_t null_count = 0;
 
-		if ((dict_decoder || dbp_decoder || rle_decoder || bss_decoder) && HasDefines()) {
-			// we need the null count because the dictionary offsets have no entries for nulls
+		if (HasDefines()) {
+			// we need the null count because the decoders (e.g. for dictionary offsets) have no entries for nulls
 			for (idx_t i = 0; i < read_now; i++) {
-				if (define_out[i + result_offset] != max_define) {
-					null_count++;
-				}
+				null_count += define_out[i + result_offset] != max_define;
 			}
 		}
+		// if all values are valid we skip the per-value NULL handling while decoding them
+		auto defines = null_count > 0 ? define_out : nullptr;
 
 		if (dict_decoder) {
 			offset_buffer.resize(reader.allocator, sizeof(uint32_t) * (read_now - null_count));
 			dict_decoder->GetBatch<uint32_t>(offset_buffer.ptr, read_now - null_count);
-			DictReference(result);
-			Offsets(reinterpret_cast<uint32_t *>(offset_buffer.ptr), define_out, read_now, filter, result_offset,
-			        result);
+			if (result_offset == 0 && read_now == num_values && PrepareDictionaryVector()) {
+				// the whole vector comes from this page: reference the dictionary instead of decoding the values
+				DictionaryVectorOffsets(reinterpret_cast<uint32_t *>(offset_buffer.ptr), defines, read_now, result);
+			} else {
+				DictReference(result);
+				Offsets(reinterpret_cast<uint32_t *>(offset_buffer.ptr), defines, read_now, filter, result_offset,
+				        result);
+			}
 		} else if (dbp_decoder) {
 			// TODO keep this in the state
 			auto read_buf = make_shared_ptr<ResizeableBuffer>();
@@ -552,14 +736,14 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 				throw std::runtime_error("DELTA_BINARY_PACKED should only be INT32 or INT64");
 			}
 			// Plain() will put NULLs in the right place
-			Plain(read_buf, define_out, read_now, filter, result_offset, result);
+			Plain(read_buf, defines, read_now, filter, result_offset, result);
 		} else if (rle_decoder) {
 			// RLE encoding for boolean
 			D_ASSERT(type.id() == LogicalTypeId::BOOLEAN);
 			auto read_buf = make_shared_ptr<ResizeableBuffer>();
 			read_buf->resize(reader.allocator, sizeof(bool) * (read_now - null_count));
 			rle_decoder->GetBatch<uint8_t>(read_buf->ptr, read_now - null_count);
-			PlainTemplated<bool, TemplatedParquetValueConversion<bool>>(read_buf, define_out, read_now, filter,
+			PlainTemplated<bool, TemplatedParquetValueConversion<bool>>(read_buf, defines, read_now, filter,
 			                                                            result_offset, result);
 		} else if (byte_array_data) {
 			// DELTA_BYTE_ARRAY or DELTA_LENGTH_BYTE_ARRAY
@@ -580,10 +764,10 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 				throw std::runtime_error("BYTE_STREAM_SPLIT encoding is only supported for FLOAT or DOUBLE data");
 			}
 
-			Plain(read_buf, define_out, read_now, filter, result_offset, result);
+			Plain(read_buf, defines, read_now, filter, result_offset, result);
 		} else {
 			PlainReference(block, result);
-			Plain(block, define_out, read_now, filter, result_offset, result);
+			Plain(block, defines, read_now, filter, result_offset, result);
 		}
 
 		result_offset += read_now;
@@ -600,8 +784,52 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	if (HasRepeats() || num_values <= page_rows_available || !chunk->__isset.offset_index_offset ||
+	    reader.parquet_options.encryption_config) {
+		return num_values;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	if (!offset_index) {
+		offset_index = make_uniq<duckdb_parquet::format::OffsetIndex>();
+		trans.SetLocation(NumericCast<idx_t>(chunk->offset_index_offset));
+		reader.Read(*offset_index, *protocol);
+		trans.SetLocation(chunk_read_offset);
+	}
+	// find the last page that starts at or before the row we skip to
+	auto &page_locations = offset_index->page_locations;
+	auto current_row = NumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available;
+	auto target_row = current_row + num_values;
+	idx_t target_page = page_locations.size();
+	for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+		if (NumericCast<idx_t>(page_locations[page_idx].first_row_index) > target_row) {
+			break;
+		}
+		target_page = page_idx;
+	}
+	if (target_page == page_locations.size() ||
+	    NumericCast<idx_t>(page_locations[target_page].first_row_index) <= current_row) {
+		// we do not skip past the start of another page
+		return num_values;
+	}
+	if (chunk_read_offset < NumericCast<idx_t>(chunk->meta_data.data_page_offset)) {
+		// the dictionary page has not been read yet: read it before jumping over the data pages
+		while (page_rows_available == 0 && trans.GetLocation() < NumericCast<idx_t>(page_locations[0].offset)) {
+			PrepareRead(none_filter);
+		}
+	}
+	auto &location = page_locations[target_page];
+	auto skipped_rows = NumericCast<idx_t>(location.first_row_index) - current_row;
+	chunk_read_offset = NumericCast<idx_t>(location.offset);
+	trans.SetLocation(chunk_read_offset);
+	group_rows_available -= skipped_rows;
+	page_rows_available = 0;
+	return num_values - skipped_rows;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
+	num_values = SkipPages(num_values);
 
 	dummy_define.zero();
 	dummy_repeat.zero();
@@ -836,11 +1064,18 @@ idx_t ListColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data
 		ApplyPendingSkips(pending_skips);
 	}
 
+	// if none of the lists are needed (e.g. when skipping rows) we do not decode the values of the child column
+	// every list has at least one child entry, so if we read at most as many child entries as there are lists left,
+	// all of the (undecoded) child entries belong to these lists and none of them end up in the overflow
+	const bool skip_child_values = filter.none();
+	auto list_starts = reinterpret_cast<uint32_t *>(child_starts.ptr);
+
 	D_ASSERT(ListVector::GetListSize(result_out) == 0);
 	// if an individual list is longer than STANDARD_VECTOR_SIZE we actually have to loop the child read to fill it
 	bool finished = false;
 	while (!finished) {
 		idx_t child_actual_num_values = 0;
+		bool child_values_skipped = false;
 
 		// check if we have any overflow from a previous read
 		if (overflow_child_count == 0) {
@@ -853,9 +1088,16 @@ idx_t ListColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data
 			// if we have read enough, we leave any unhandled elements in the overflow vector for a subsequent read
 			auto child_req_num_values =
 			    MinValue<idx_t>(STANDARD_VECTOR_SIZE, child_column_reader->GroupRowsAvailable());
+			// once all lists have started, the remaining entries of the last list are read (and decoded) as usual,
+			// because the entries that follow them belong to the next read
+			child_values_skipped = skip_child_values && result_offset < num_values;
+			if (child_values_skipped) {
+				child_req_num_values = MinValue<idx_t>(child_req_num_values, num_values - result_offset);
+			}
 			read_vector.ResetFromCache(read_cache);
-			child_actual_num_values = child_column_reader->Read(child_req_num_values, child_filter, child_defines_ptr,
-			                                                    child_repeats_ptr, read_vector);
+			child_actual_num_values =
+			    child_column_reader->Read(child_req_num_values, child_values_skipped ? skip_child_filter : child_filter,
+			                              child_defines_ptr, child_repeats_ptr, read_vector);
 		} else {
 			// we do: use the overflow values
 			child_actual_num_values = overflow_child_count;
@@ -866,60 +1108,99 @@ idx_t ListColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data
 			// no more elements available: we are done
 			break;
 		}
-		read_vector.Verify(child_actual_num_values);
+		if (!child_values_skipped) {
+			read_vector.Verify(child_actual_num_values);
+		}
 		idx_t current_chunk_offset = ListVector::GetListSize(result_out);
 
 		// hard-won piece of code this, modify at your own risk
 		// the intuition is that we have to only collapse values into lists that are repeated *on this level*
 		// the rest is pretty much handed up as-is as a single-valued list or NULL
-		idx_t child_idx;
-		for (child_idx = 0; child_idx < child_actual_num_values; child_idx++) {
-			if (child_repeats_ptr[child_idx] == max_repeat) {
-				// value repeats on this level, append
-				D_ASSERT(result_offset > 0);
-				result_ptr[result_offset - 1].length++;
-				continue;
-			}
 
-			if (result_offset >= num_values) {
-				// we ran out of output space
-				finished = true;
-				break;
+		// values that repeat on this level before the first new list belong to the last list of the previous read
+		idx_t child_idx = 0;
+		while (child_idx < child_actual_num_values && child_repeats_ptr[child_idx] == max_repeat) {
+			child_idx++;
+		}
+		if (child_idx > 0 && !child_values_skipped) {
+			D_ASSERT(result_offset > 0);
+			result_ptr[result_offset - 1].length += child_idx;
+		}
+
+		// find where every new list starts
+		idx_t list_count = 0;
+		for (; child_idx < child_actual_num_values; child_idx++) {
+			list_starts[list_count] = UnsafeNumericCast<uint32_t>(child_idx);
+			list_count += child_repeats_ptr[child_idx] != max_repeat;
+		}
+		// stop at the first list that does not fit into the result anymore
+		idx_t child_end = child_actual_num_values;
+		if (list_count > num_values - result_offset) {
+			list_count = num_values - result_offset;
+			child_end = list_starts[list_count];
+			finished = true;
+		}
+		list_starts[list_count] = UnsafeNumericCast<uint32_t>(child_end);
+
+		bool all_valid = !child_values_skipped;
+		for (idx_t list_idx = 0; list_idx < list_count; list_idx++) {
+			auto list_start = list_starts[list_idx];
+			repeat_out[result_offset + list_idx] = child_repeats_ptr[list_start];
+			define_out[result_offset + list_idx] = child_defines_ptr[list_start];
+			all_valid = all_valid && child_defines_ptr[list_start] >= max_define;
+		}
+		if (all_valid) {
+			// no NULL or empty lists: every list spans the entries up to the start of the next list
+			for (idx_t list_idx = 0; list_idx < list_count; list_idx++) {
+				auto &entry = result_ptr[result_offset + list_idx];
+				entry.offset = list_starts[list_idx] + current_chunk_offset;
+				entry.length = list_starts[list_idx + 1] - list_starts[list_idx];
 			}
-			if (child_defines_ptr[child_idx] >= max_define) {
-				// value has been defined down the stack, hence its NOT NULL
-				result_ptr[result_offset].offset = child_idx + current_chunk_offset;
-				result_ptr[result_offset].length = 1;
-			} else if (child_defines_ptr[child_idx] == max_define - 1) {
-				// empty list
-				result_ptr[result_offset].offset = child_idx + current_chunk_offset;
-				result_ptr[result_offset].length = 0;
-			} else {
-				// value is NULL somewhere up the stack
-				result_mask.SetInvalid(result_offset);
-				result_ptr[result_offset].offset = 0;
-				result_ptr[result_offset].length = 0;
+		} else {
+			for (idx_t list_idx = 0; list_idx < list_count; list_idx++) {
+				auto list_start = list_starts[list_idx];
+				auto &entry = result_ptr[result_offset + list_idx];
+				if (child_defines_ptr[list_start] < max_define - 1) {
+					// value is NULL somewhere up the stack
+					result_mask.SetInvalid(result_offset + list_idx);
+					entry.offset = 0;
+					entry.length = 0;
+				} else if (child_values_skipped) {
+					// the child entries were not read, so the list cannot refer to them
+					entry.offset = 0;
+					entry.length = 0;
+				} else if (child_defines_ptr[list_start] >= max_define) {
+					// value has been defined down the stack, hence its NOT NULL
+					entry.offset = list_start + current_chunk_offset;
+					entry.length = list_starts[list_idx + 1] - list_start;
+				} else {
+					// empty list
+					entry.offset = list_start + current_chunk_offset;
+					entry.length = 0;
+				}
 			}
+		}
+		result_offset += list_count;
 
-			repeat_out[result_offset] = child_repeats_ptr[child_idx];
-			define_out[result_offset] = child_defines_ptr[child_idx];
-
-			result_offset++;
+		if (child_values_skipped) {
+			D_ASSERT(!finished);
+			continue;
 		}
 		// actually append the required elements to the child list
-		ListVector::Append(result_out, read_vector, child_idx);
+		ListVector::Append(result_out, read_vector, child_end);
 
 		// we have read more values from the child reader than we can fit into the result for this read
-		// we have to pass everything from child_idx to child_actual_num_values into the next call
-		if (child_idx < child_actual_num_values && result_offset == num_values) {
-			read_vector.Slice(read_vector, child_idx, child_actual_num_values);
-			overflow_child_count = child_actual_num_values - child_idx;
+		// we have to pass everything from child_end to child_actual_num_values into the next call
+		if (child_end < child_actual_num_values) {
+			D_ASSERT(result_offset == num_values);
+			read_vector.Slice(read_vector, child_end, child_actual_num_values);
+			overflow_child_count = child_actual_num_values - child_end;
 			read_vector.Verify(overflow_child_count);
 
-			// move values in the child repeats and defines *backward* by child_idx
+			// move values in the child repeats and defines *backward* by child_end
 			for (idx_t repdef_idx = 0; repdef_idx < overflow_child_count; repdef_idx++) {
-				child_defines_ptr[repdef_idx] = child_defines_ptr[child_idx + repdef_idx];
-				child_repeats_ptr[repdef_idx] = child_repeats_ptr[child_idx + repdef_idx];
+				child_defines_ptr[repdef_idx] = child_defines_ptr[child_end + repdef_idx];
+				child_repeats_ptr[repdef_idx] = child_repeats_ptr[child_end + repdef_idx];
 			}
 		}
 	}
@@ -938,8 +1219,11 @@ ListColumnReader::ListColumnReader(ParquetReader &reader, LogicalType type_p, co
 	child_repeats.resize(reader.allocator, STANDARD_VECTOR_SIZE);
 	child_defines_ptr = (uint8_t *)child_defines.ptr;
 	child_repeats_ptr = (uint8_t *)child_repeats.ptr;
+	// one extra entry marks the end of the last list
+	child_starts.resize(reader.allocator, (STANDARD_VECTOR_SIZE + 1) * sizeof(uint32_t));
 
 	child_filter.set();
+	skip_child_filter.reset();
 }
 
 void ListColumnReader::ApplyPendingSkips(idx_t num_values) {
@@ -1187,6 +1471,17 @@ idx_t StructColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, da
 		}
 	}
 	// set the validity mask for this level
+	if (max_define == 0) {
+		// a required struct without nullable parents can not be NULL
+		return read_count;
+	}
+	idx_t null_count = 0;
+	for (idx_t i = 0; i < read_count; i++) {
+		null_count += define_out[i] < max_define;
+	}
+	if (null_count == 0) {
+		return read_count;
+	}
 	auto &validity = FlatVector::Validity(result);
 	for (idx_t i = 0; i < read_count; i++) {
 		if (define_out[i] < max_define) {
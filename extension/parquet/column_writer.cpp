@@ -30,12 +30,14 @@ namespace duckdb {
 using namespace duckdb_parquet; // NOLINT
 using namespace duckdb_miniz;   // NOLINT
 
+using duckdb_parquet::format::BoundaryOrder;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::Encoding;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileMetaData;
 using duckdb_parquet::format::PageHeader;
+using duckdb_parquet::format::PageLocation;
 using duckdb_parquet::format::PageType;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::Type;
@@ -88,6 +90,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -327,6 +332,7 @@ struct PageInformation {
 	idx_t offset = 0;
 	idx_t row_count = 0;
 	idx_t empty_count = 0;
+	idx_t null_count = 0;
 	idx_t estimated_page_size = 0;
 };
 
@@ -334,6 +340,11 @@ struct PageWriteInformation {
 	PageHeader page_header;
 	unique_ptr<MemoryStream> temp_writer;
 	unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of this page - only tracked when writing a page index
+	unique_ptr<ColumnWriterStatistics> page_stats;
+	//! The index of the first row of this page within the column chunk, and the amount of NULL values in the page
+	idx_t first_row_index = 0;
+	idx_t null_count = 0;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -355,6 +366,8 @@ public:
 	vector<PageInformation> page_info;
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
+	//! The hashes of the distinct values of the column chunk, if a Bloom filter is written for it
+	unique_ptr<unordered_set<uint64_t>> bloom_filter_hashes;
 	idx_t current_page = 0;
 };
 
@@ -366,7 +379,8 @@ class BasicColumnWriter : public ColumnWriter {
 public:
 	BasicColumnWriter(ParquetWriter &writer, idx_t schema_idx, vector<string> schema_path, idx_t max_repeat,
 	                  idx_t max_define, bool can_have_nulls)
-	    : ColumnWriter(writer, schema_idx, std::move(schema_path), max_repeat, max_define, can_have_nulls) {
+	    : ColumnWriter(writer, schema_idx, std::move(schema_path), max_repeat, max_define, can_have_nulls),
+	      estimated_page_bytes(0), compressed_page_bytes(0) {
 	}
 
 	~BasicColumnWriter() override = default;
@@ -374,6 +388,8 @@ public:
 	//! We limit the uncompressed page size to 100MB
 	//! The max size in Parquet is 2GB, but we choose a more conservative limit
 	static constexpr const idx_t MAX_UNCOMPRESSED_PAGE_SIZE = 100000000;
+	//! When writing a page index we limit the uncompressed page size to 1MB, so that pages can be skipped selectively
+	static constexpr const idx_t MAX_UNCOMPRESSED_INDEXED_PAGE_SIZE = 1000000;
 	//! Dictionary pages must be below 2GB. Unlike data pages, there's only one dictionary page.
 	//! For this reason we go with a much higher, but still a conservative upper bound of 1GB;
 	static constexpr const idx_t MAX_UNCOMPRESSED_DICT_PAGE_SIZE = 1e9;
@@ -416,6 +432,13 @@ protected:
 	//! Writes a (subset of a) vector to the specified serializer. Only used for scalar types.
 	virtual void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
 	                         Vector &vector, idx_t chunk_start, idx_t chunk_end) = 0;
+	//! Whether or not this writer can hash its values for a Bloom filter. Only used for scalar types.
+	virtual bool SupportsBloomFilter() const {
+		return false;
+	}
+	//! Adds the hashes of the (PLAIN encoded) values of a vector to the Bloom filter hashes of the column chunk
+	virtual void UpdateBloomFilter(unordered_set<uint64_t> &hashes, Vector &vector, idx_t chunk_start,
+	                               idx_t chunk_end);
 
 	virtual bool HasDictionary(BasicColumnWriterState &state_p) {
 		return false;
@@ -426,7 +449,27 @@ protected:
 	virtual void FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats);
 
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
+	void AddToPageIndex(ParquetColumnPageIndex &page_index, PageWriteInformation &write_info, idx_t page_start,
+	                    idx_t page_end);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
+
+	//! Whether or not the ColumnIndex and OffsetIndex are written for this column
+	bool WritePageIndex() const {
+		// only flat columns have one value per row, which the page index requires
+		return writer.WritePageIndex() && max_repeat == 0;
+	}
+	//! Whether or not a Bloom filter is written for this column
+	bool WriteBloomFilter() const {
+		return SupportsBloomFilter() && writer.WriteBloomFilter(schema_path);
+	}
+	//! The estimated size at which a new page is started
+	idx_t MaximumPageSize() const;
+
+private:
+	//! The estimated and the compressed size of the pages that were written so far, which are used to size pages by
+	//! their compressed size (row groups can be prepared concurrently)
+	atomic<idx_t> estimated_page_bytes;
+	atomic<idx_t> compressed_page_bytes;
 };
 
 unique_ptr<ColumnWriterState> BasicColumnWriter::InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) {
@@ -464,6 +507,7 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 	HandleDefineLevels(state, parent, validity, count, max_define, max_define - 1);
 
 	idx_t vector_index = 0;
+	auto max_page_size = MaximumPageSize();
 	reference<PageInformation> page_info_ref = state.page_info.back();
 	for (idx_t i = start; i < vcount; i++) {
 		auto &page_info = page_info_ref.get();
@@ -473,9 +517,12 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 			page_info.empty_count++;
 			continue;
 		}
+		if (state.definition_levels[parent_index + i] != max_define) {
+			page_info.null_count++;
+		}
 		if (validity.RowIsValid(vector_index)) {
 			page_info.estimated_page_size += GetRowSize(vector, vector_index, state);
-			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE) {
+			if (page_info.estimated_page_size >= max_page_size) {
 				PageInformation new_info;
 				new_info.offset = page_info.offset + page_info.row_count;
 				state.page_info.push_back(new_info);
@@ -486,6 +533,21 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 	}
 }
 
+idx_t BasicColumnWriter::MaximumPageSize() const {
+	auto target_page_size = writer.TargetPageSize(schema_path);
+	if (target_page_size == 0) {
+		return WritePageIndex() ? MAX_UNCOMPRESSED_INDEXED_PAGE_SIZE : MAX_UNCOMPRESSED_PAGE_SIZE;
+	}
+	// estimate the size that compresses to the target size from the pages of this column that were written so far
+	idx_t estimated = estimated_page_bytes;
+	idx_t compressed = compressed_page_bytes;
+	if (estimated > 0 && compressed > 0) {
+		auto max_page_size = double(target_page_size) * double(estimated) / double(compressed);
+		return idx_t(MinValue<double>(max_page_size, double(MAX_UNCOMPRESSED_PAGE_SIZE)));
+	}
+	return target_page_size;
+}
+
 duckdb_parquet::format::Encoding::type BasicColumnWriter::GetEncoding(BasicColumnWriterState &state) {
 	return Encoding::PLAIN;
 }
@@ -495,6 +557,9 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	if (WriteBloomFilter()) {
+		state.bloom_filter_hashes = make_uniq<unordered_set<uint64_t>>();
+	}
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -520,6 +585,11 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
 		write_info.page_state = InitializePageState(state);
+		if (WritePageIndex()) {
+			write_info.page_stats = InitializeStatsState();
+			write_info.first_row_index = page_info.offset;
+			write_info.null_count = page_info.null_count;
+		}
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -590,6 +660,9 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	auto &hdr = write_info.page_header;
 
 	FlushPageState(temp_writer, write_info.page_state.get());
+	if (write_info.page_stats) {
+		state.stats_state->Merge(*write_info.page_stats);
+	}
 
 	// now that we have finished writing the data we know the uncompressed size
 	if (temp_writer.GetPosition() > idx_t(NumericLimits<int32_t>::Maximum())) {
@@ -603,6 +676,8 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	hdr.compressed_page_size = UnsafeNumericCast<int32_t>(write_info.compressed_size);
 	D_ASSERT(hdr.uncompressed_page_size > 0);
 	D_ASSERT(hdr.compressed_page_size > 0);
+	estimated_page_bytes += state.page_info[state.current_page - 1].estimated_page_size;
+	compressed_page_bytes += write_info.compressed_size;
 
 	if (write_info.compressed_buf) {
 		// if the data has been compressed, we no longer need the uncompressed data
@@ -634,8 +709,12 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
-		            offset + write_count);
+		// when writing a page index the statistics are gathered per page, and merged into the column statistics
+		auto stats = write_info.page_stats ? write_info.page_stats.get() : state.stats_state.get();
+		WriteVector(temp_writer, stats, write_info.page_state.get(), vector, offset, offset + write_count);
+		if (state.bloom_filter_hashes) {
+			UpdateBloomFilter(*state.bloom_filter_hashes, vector, offset, offset + write_count);
+		}
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -710,6 +789,8 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	ParquetColumnPageIndex page_index;
+	page_index.column_idx = state.col_idx;
 	for (auto &write_info : state.write_info) {
 		// set the data page offset whenever we see the *first* data page
 		if (column_chunk.meta_data.data_page_offset == 0 && (write_info.page_header.type == PageType::DATA_PAGE ||
@@ -724,10 +805,56 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+		if (write_info.page_stats) {
+			AddToPageIndex(page_index, write_info, header_start_offset, column_writer.GetTotalWritten());
+		}
 	}
 	column_chunk.meta_data.total_compressed_size =
 	    UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten() - start_offset);
 	column_chunk.meta_data.total_uncompressed_size = UnsafeNumericCast<int64_t>(total_uncompressed_size);
+	if (!page_index.offset_index.page_locations.empty()) {
+		page_index.column_index.__set_null_counts(std::move(page_index.null_counts));
+		page_index.column_index.boundary_order = BoundaryOrder::UNORDERED;
+		writer.AddPageIndex(std::move(page_index));
+	}
+	if (state.bloom_filter_hashes && !state.bloom_filter_hashes->empty()) {
+		// now that we know the amount of distinct values we can size the Bloom filter
+		auto &hashes = *state.bloom_filter_hashes;
+		ParquetColumnBloomFilter bloom_filter;
+		bloom_filter.column_idx = state.col_idx;
+		bloom_filter.bloom_filter = make_uniq<ParquetBloomFilter>(Allocator::DefaultAllocator(), hashes.size(),
+		                                                          writer.BloomFilterFalsePositiveRatio());
+		for (auto &hash : hashes) {
+			bloom_filter.bloom_filter->FilterInsert(hash);
+		}
+		writer.AddBloomFilter(std::move(bloom_filter));
+	}
+}
+
+void BasicColumnWriter::AddToPageIndex(ParquetColumnPageIndex &page_index, PageWriteInformation &write_info,
+                                       idx_t page_start, idx_t page_end) {
+	PageLocation location;
+	location.offset = NumericCast<int64_t>(page_start);
+	location.compressed_page_size = NumericCast<int32_t>(page_end - page_start);
+	location.first_row_index = NumericCast<int64_t>(write_info.first_row_index);
+	page_index.offset_index.page_locations.push_back(location);
+
+	auto &column_index = page_index.column_index;
+	auto &page_stats = *write_info.page_stats;
+	bool null_page = write_info.null_count == write_info.max_write_count;
+	column_index.null_pages.push_back(null_page);
+	column_index.min_values.push_back(null_page ? string() : page_stats.GetMinValue());
+	column_index.max_values.push_back(null_page ? string() : page_stats.GetMaxValue());
+	page_index.null_counts.push_back(NumericCast<int64_t>(write_info.null_count));
+	if (!null_page && !page_stats.HasStats()) {
+		// the ColumnIndex requires the bounds of every page - we can only write the OffsetIndex
+		page_index.has_column_index = false;
+	}
+}
+
+void BasicColumnWriter::UpdateBloomFilter(unordered_set<uint64_t> &hashes, Vector &vector, idx_t chunk_start,
+                                          idx_t chunk_end) {
+	throw InternalException("This column writer does not support Bloom filters");
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -797,6 +924,16 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -920,6 +1057,23 @@ public:
 		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
 	}
 
+	bool SupportsBloomFilter() const override {
+		return true;
+	}
+
+	void UpdateBloomFilter(unordered_set<uint64_t> &hashes, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &mask = FlatVector::Validity(input_column);
+		const auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			// the hash is computed over the value as it is written to the file
+			hashes.insert(ParquetBloomFilter::Hash(OP::template Operation<SRC, TGT>(ptr[r])));
+		}
+	}
+
 	idx_t GetRowSize(const Vector &vector, const idx_t index, const BasicColumnWriterState &state) const override {
 		return sizeof(TGT);
 	}
@@ -953,6 +1107,12 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(const_char_ptr_cast(&max), sizeof(bool)) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -1084,6 +1244,14 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
 };
 
 class FixedDecimalColumnWriter : public BasicColumnWriter {
@@ -1307,6 +1475,21 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? max : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (other.values_too_big) {
+			values_too_big = true;
+			has_stats = false;
+			min = string();
+			max = string();
+			return;
+		}
+		if (other.has_stats) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
+	}
 };
 
 class StringColumnWriterState : public BasicColumnWriterState {
@@ -1450,6 +1633,10 @@ public:
 					continue;
 				}
 				auto value_index = page_state.dictionary.at(ptr[r]);
+				if (WritePageIndex()) {
+					// the column statistics are gathered from the dictionary, but the page index needs them per page
+					stats.Update(ptr[r]);
+				}
 				if (!page_state.written_value) {
 					// first value
 					// write the bit-width as a one-byte entry
@@ -1474,6 +1661,22 @@ public:
 		}
 	}
 
+	bool SupportsBloomFilter() const override {
+		return true;
+	}
+
+	void UpdateBloomFilter(unordered_set<uint64_t> &hashes, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			hashes.insert(ParquetBloomFilter::Hash(ptr[r]));
+		}
+	}
+
 	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
 		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
@@ -26,6 +26,7 @@
 
 namespace duckdb {
 class ParquetReader;
+class TableFilter;
 
 using duckdb_apache::thrift::protocol::TProtocol;
 
@@ -70,10 +71,22 @@ public:
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
 
+	//! Emit dictionary vectors that reference the dictionary of the column chunk for dictionary-encoded pages,
+	//! instead of decoding every value. Only used for top-level columns, NULL values point to a trailing NULL entry
+	void EnableDictionaryOutput();
+	//! The amount of entries in the dictionary of the current column chunk
+	idx_t DictionarySize() const;
+	//! For every entry of the current dictionary (including the trailing NULL entry) whether or not it passes the
+	//! filter, or nullptr if the filter was not evaluated against the current dictionary yet
+	const bool *GetDictionaryFilterMatches(const TableFilter &filter) const;
+	//! Allocates the matches of a filter against the current dictionary, these are filled in by the caller
+	bool *InitializeDictionaryFilterMatches(const TableFilter &filter);
+
 	template <class VALUE_TYPE, class CONVERSION>
 	void PlainTemplated(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, uint64_t num_values,
 	                    parquet_filter_t &filter, idx_t result_offset, Vector &result) {
-		if (HasDefines()) {
+		// "defines" is nullptr if all values are valid
+		if (HasDefines() && defines) {
 			if (CONVERSION::PlainAvailable(*plain_data, num_values)) {
 				PlainTemplatedInternal<VALUE_TYPE, CONVERSION, true, true>(*plain_data, defines, num_values, filter,
 				                                                           result_offset, result);
@@ -116,7 +129,7 @@ private:
 
 protected:
 	Allocator &GetAllocator();
-	// readers that use the default Read() need to implement those
+	// readers that use the default Read() need to implement those, "defines" is nullptr if all values are valid
 	virtual void Plain(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, idx_t num_values, parquet_filter_t &filter,
 	                   idx_t result_offset, Vector &result);
 	virtual void Dictionary(shared_ptr<ResizeableBuffer> dictionary_data, idx_t num_entries);
@@ -126,6 +139,8 @@ protected:
 	// these are nops for most types, but not for strings
 	virtual void DictReference(Vector &result);
 	virtual void PlainReference(shared_ptr<ByteBuffer>, Vector &result);
+	//! Writes the entries of the current dictionary to "result", returns false if the reader does not support this
+	virtual bool DictionaryEntries(idx_t num_entries, Vector &result);
 
 	virtual void PrepareDeltaLengthByteArray(ResizeableBuffer &buffer);
 	virtual void PrepareDeltaByteArray(ResizeableBuffer &buffer);
@@ -163,9 +178,13 @@ private:
 	void AllocateBlock(idx_t size);
 	void AllocateCompressed(idx_t size);
 	void PrepareRead(parquet_filter_t &filter);
+	//! Uses the OffsetIndex to jump over the pages that are skipped entirely, returns the amount of values left to skip
+	idx_t SkipPages(idx_t num_values);
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
+	bool PrepareDictionaryVector();
+	void DictionaryVectorOffsets(const uint32_t *offsets, const uint8_t *defines, idx_t num_values, Vector &result);
 	void DecompressInternal(CompressionCodec::type codec, const_data_ptr_t src, idx_t src_size, data_ptr_t dst,
 	                        idx_t dst_size);
 
@@ -175,6 +194,8 @@ private:
 	idx_t page_rows_available;
 	idx_t group_rows_available;
 	idx_t chunk_read_offset;
+	//! The OffsetIndex of the current column chunk, loaded the first time that pages can be skipped
+	unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index;
 
 	shared_ptr<ResizeableBuffer> block;
 
@@ -188,6 +209,14 @@ private:
 	unique_ptr<RleBpDecoder> rle_decoder;
 	unique_ptr<BssDecoder> bss_decoder;
 
+	bool dictionary_output = false;
+	idx_t dictionary_size = 0;
+	//! The entries of the dictionary followed by a NULL entry, created when the first dictionary vector is emitted
+	unique_ptr<Vector> dictionary_vector;
+	//! The filter that was last evaluated against the entries of the dictionary, and the entries that passed it
+	optional_ptr<const TableFilter> dictionary_filter;
+	unsafe_unique_array<bool> dictionary_filter_matches;
+
 	// dummies for Skip()
 	parquet_filter_t none_filter;
 	ResizeableBuffer dummy_define;
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "resizable_buffer.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/bitpacking.hpp"
+#endif
 
 namespace duckdb {
 class ParquetDecodeUtils {
@@ -22,9 +25,13 @@ public:
 			                            "the file might be corrupted.",
 			                            width, ParquetDecodeUtils::BITPACK_MASKS_SIZE);
 		}
+		uint32_t unpacked = 0;
+		if (count >= BITPACK_GROUP_SIZE && BitUnpackGroupsSupported<T>(width)) {
+			unpacked = BitUnpackGroups<T>(buffer, bitpack_pos, dest, count, width);
+		}
 		auto mask = BITPACK_MASKS[width];
 
-		for (uint32_t i = 0; i < count; i++) {
+		for (uint32_t i = unpacked; i < count; i++) {
 			T val = (buffer.get<uint8_t>() >> bitpack_pos) & mask;
 			bitpack_pos += width;
 			while (bitpack_pos > BITPACK_DLEN) {
@@ -54,5 +61,64 @@ public:
 		}
 		return result;
 	}
+
+private:
+	//! The amount of values that the Parquet bit-packing packs together, this is a multiple of 8 so groups of values
+	//! always end on a byte boundary
+	static constexpr const uint32_t BITPACK_GROUP_SIZE = BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+
+	template <typename T>
+	static bool BitUnpackGroupsSupported(uint8_t width) {
+		return std::is_integral<T>::value && !std::is_same<T, bool>::value && sizeof(T) <= sizeof(uint64_t) &&
+		       width > 0 && width <= sizeof(T) * 8;
+	}
+
+	//! The maximum width that BitUnpackGroupsSIMD supports: eight values are unpacked from a single 16-byte load
+	static constexpr const uint8_t BITPACK_SIMD_MAX_WIDTH = 14;
+
+	//! Unpacks whole groups of values of at most BITPACK_SIMD_MAX_WIDTH bits into 32-bit values with AVX2 or NEON
+	//! kernels, if they are available. Returns the amount of groups that were unpacked
+	static uint32_t BitUnpackGroupsSIMD(ByteBuffer &buffer, uint32_t *dest, uint32_t group_count, uint8_t width);
+
+	//! Unpacks as many whole groups of values as possible with the (vectorized) bit-packing primitives, which use the
+	//! same little-endian bit order as Parquet. Returns the amount of values that were unpacked
+	template <typename T>
+	static uint32_t BitUnpackGroups(ByteBuffer &buffer, uint8_t &bitpack_pos, T *dest, uint32_t count, uint8_t width) {
+		if (bitpack_pos == BITPACK_DLEN) {
+			// the current byte was consumed entirely
+			buffer.inc(1);
+			bitpack_pos = 0;
+		}
+		if (bitpack_pos != 0) {
+			return 0;
+		}
+		const uint32_t group_bytes = BITPACK_GROUP_SIZE * width / 8;
+		const uint32_t group_count = MinValue<uint32_t>(count / BITPACK_GROUP_SIZE, buffer.len / group_bytes);
+		uint32_t group_idx = 0;
+		if (sizeof(T) == sizeof(uint32_t) && width <= BITPACK_SIMD_MAX_WIDTH) {
+			// dictionary offsets
+			group_idx = BitUnpackGroupsSIMD(buffer, reinterpret_cast<uint32_t *>(dest), group_count, width);
+		}
+		for (; group_idx < group_count; group_idx++) {
+			auto group_dest = data_ptr_cast(dest + group_idx * BITPACK_GROUP_SIZE);
+			switch (sizeof(T)) {
+			case sizeof(uint8_t):
+				BitpackingPrimitives::UnPackBlock<uint8_t>(group_dest, buffer.ptr, width);
+				break;
+			case sizeof(uint16_t):
+				BitpackingPrimitives::UnPackBlock<uint16_t>(group_dest, buffer.ptr, width);
+				break;
+			case sizeof(uint32_t):
+				BitpackingPrimitives::UnPackBlock<uint32_t>(group_dest, buffer.ptr, width);
+				break;
+			default:
+				D_ASSERT(sizeof(T) == sizeof(uint64_t));
+				BitpackingPrimitives::UnPackBlock<uint64_t>(group_dest, buffer.ptr, width);
+				break;
+			}
+			buffer.unsafe_inc(group_bytes);
+		}
+		return group_count * BITPACK_GROUP_SIZE;
+	}
 };
 } // namespace duckdb
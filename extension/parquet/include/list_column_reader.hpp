@@ -48,11 +48,15 @@ private:
 	ResizeableBuffer child_repeats;
 	uint8_t *child_defines_ptr;
 	uint8_t *child_repeats_ptr;
+	//! The positions of the child entries that start a new list
+	ResizeableBuffer child_starts;
 
 	VectorCache read_cache;
 	Vector read_vector;
 
 	parquet_filter_t child_filter;
+	//! The filter used to read the child entries of lists that are not needed, which skips decoding their values
+	parquet_filter_t skip_child_filter;
 
 	idx_t overflow_child_count;
 };
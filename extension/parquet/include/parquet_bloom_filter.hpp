@@ -0,0 +1,60 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/allocator.hpp"
+#include "duckdb/common/types/string_type.hpp"
+#endif
+
+namespace duckdb {
+
+//! A split block Bloom filter, as defined by the Parquet format. The filter consists of blocks of 256 bits, a value
+//! sets (or checks) one bit in each of the eight 32-bit words of the block that is selected by its hash
+class ParquetBloomFilter {
+public:
+	//! The size of a block in bytes
+	static constexpr const idx_t BLOCK_SIZE = 32;
+	//! The Parquet format recommends to not write Bloom filters larger than 128MB
+	static constexpr const idx_t MAXIMUM_BYTES = 128ULL * 1024ULL * 1024ULL;
+
+public:
+	//! Creates an empty filter that can hold "num_entries" distinct values with the given false positive ratio
+	ParquetBloomFilter(Allocator &allocator, idx_t num_entries, double false_positive_ratio);
+	//! Wraps the bitset of a filter that was read from a file
+	ParquetBloomFilter(AllocatedData data, idx_t num_bytes);
+
+public:
+	void FilterInsert(uint64_t hash);
+	bool FilterCheck(uint64_t hash) const;
+
+	data_ptr_t Data() {
+		return data.get();
+	}
+	idx_t NumBytes() const {
+		return block_count * BLOCK_SIZE;
+	}
+
+	//! Hashes the PLAIN encoding of a value with XXH64, as required by the Parquet format
+	static uint64_t Hash(const_data_ptr_t value, idx_t size);
+	template <class T>
+	static uint64_t Hash(const T &value) {
+		return Hash(const_data_ptr_cast(&value), sizeof(T));
+	}
+	static uint64_t Hash(const string_t &value) {
+		return Hash(const_data_ptr_cast(value.GetData()), value.GetSize());
+	}
+
+private:
+	AllocatedData data;
+	idx_t block_count;
+};
+
+} // namespace duckdb
@@ -32,11 +32,15 @@ public:
 
 		buffer_.available((value_offset_ + batch_size) * sizeof(T));
 
-		for (uint32_t byte_offset = 0; byte_offset < sizeof(T); ++byte_offset) {
-			data_ptr_t input_bytes = buffer_.ptr + byte_offset * num_buffer_values + value_offset_;
-			for (uint32_t i = 0; i < batch_size; ++i) {
-				values_target_ptr[byte_offset + i * sizeof(T)] = *(input_bytes + i);
+		// assemble every value from its bytes in each of the streams, this writes the output sequentially and has a
+		// fixed-size inner loop that the compiler can unroll and vectorize
+		const_data_ptr_t input_bytes = buffer_.ptr + value_offset_;
+		for (uint32_t i = 0; i < batch_size; ++i) {
+			data_t value_bytes[sizeof(T)];
+			for (uint32_t byte_offset = 0; byte_offset < sizeof(T); ++byte_offset) {
+				value_bytes[byte_offset] = input_bytes[byte_offset * num_buffer_values + i];
 			}
+			memcpy(values_target_ptr + i * sizeof(T), value_bytes, sizeof(T));
 		}
 		value_offset_ += batch_size;
 	}
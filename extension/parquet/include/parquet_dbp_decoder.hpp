@@ -80,8 +80,10 @@ public:
 			auto read_now = MinValue(values_left_in_miniblock, (idx_t)batch_size - value_offset);
 			ParquetDecodeUtils::BitUnpack<T>(buffer_, bitpack_pos, &values[value_offset], read_now,
 			                                 miniblock_bit_widths[miniblock_offset]);
+			auto previous_value = uint64_t(value_offset == 0 ? T(start_value) : values[value_offset - 1]);
 			for (idx_t i = value_offset; i < value_offset + read_now; i++) {
-				values[i] = T(uint64_t((i == 0) ? start_value : values[i - 1]) + min_delta + uint64_t(values[i]));
+				values[i] = T(previous_value + uint64_t(min_delta) + uint64_t(values[i]));
+				previous_value = uint64_t(values[i]);
 			}
 			value_offset += read_now;
 			values_left_in_miniblock -= read_now;
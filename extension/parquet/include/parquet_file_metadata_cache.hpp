@@ -9,6 +9,9 @@
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/allocator.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/storage/object_cache.hpp"
 #include "geo_parquet.hpp"
 #endif
@@ -36,6 +39,9 @@ public:
 	//! GeoParquet metadata
 	unique_ptr<GeoParquetFileMetadata> geo_metadata;
 
+	//! The size of the (serialized) footer in bytes, which is used to bound the size of the cache
+	idx_t footer_size = 0;
+
 public:
 	static string ObjectType() {
 		return "parquet_metadata";
@@ -45,4 +51,55 @@ public:
 		return ObjectType();
 	}
 };
+
+//! Tracks the Parquet metadata that is kept in the object cache, and evicts the least recently used metadata once the
+//! footers of the cached files exceed the "parquet_metadata_cache_size" setting
+class ParquetMetadataCacheEviction : public ObjectCacheEntry {
+public:
+	static constexpr const idx_t DEFAULT_MAXIMUM_SIZE = 1ULL << 30; // 1 GiB
+
+	static ParquetMetadataCacheEviction &Get(ClientContext &context);
+
+	//! Looks up the metadata of a file in the object cache, and marks it as most recently used
+	static shared_ptr<ParquetFileMetadataCache> GetMetadata(ClientContext &context, const string &file_name);
+	//! Adds (or replaces) the metadata of a file in the object cache, evicting the least recently used metadata
+	static void PutMetadata(ClientContext &context, const string &file_name,
+	                        shared_ptr<ParquetFileMetadataCache> metadata);
+
+	static string ObjectType() {
+		return "parquet_metadata_eviction";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	struct CacheEntry {
+		list<string>::iterator lru_position;
+		idx_t size;
+	};
+
+	mutex lock;
+	//! The cached files, from most to least recently used
+	list<string> lru;
+	unordered_map<string, CacheEntry> entries;
+	idx_t total_size = 0;
+};
+
+//! An on-disk cache of Parquet footers that survives restarts, enabled by setting "parquet_metadata_cache_directory".
+//! Footers are stored as they appear in the file, and are only used if the path, size and last modification time of
+//! the file are unchanged. Only unencrypted footers are cached
+class ParquetFooterDiskCache {
+public:
+	//! Returns the cache directory, or an empty string if the cache is disabled
+	static string GetDirectory(ClientContext &context);
+	//! Reads the cached footer of a file, returns false if it is not cached or the file was changed since
+	static bool TryRead(ClientContext &context, const string &directory, FileHandle &file_handle,
+	                    AllocatedData &footer, idx_t &footer_size);
+	//! Writes the footer of a file to the cache
+	static void Write(ClientContext &context, const string &directory, FileHandle &file_handle,
+	                  const_data_ptr_t footer, idx_t footer_size);
+};
+
 } // namespace duckdb
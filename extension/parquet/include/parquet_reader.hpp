@@ -64,6 +64,14 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! The row ranges [start, end) of the current row group that cannot pass the filters according to the page index
+	vector<pair<idx_t, idx_t>> skipped_ranges;
+	idx_t skipped_range_idx = 0;
+
+	//! If only part of a (single) row group is scanned: the rows [start, end) of the row group that are scanned
+	bool scan_row_range = false;
+	pair<idx_t, idx_t> row_range;
 };
 
 struct ParquetColumnDefinition {
@@ -143,6 +151,12 @@ public:
 
 public:
 	void InitializeScan(ClientContext &context, ParquetReaderScanState &state, vector<idx_t> groups_to_read);
+	//! Initializes a scan of the rows [start, end) of a single row group
+	void InitializeScan(ClientContext &context, ParquetReaderScanState &state, idx_t group_idx,
+	                    pair<idx_t, idx_t> row_range);
+	//! Splits a row group into row ranges that can be scanned in parallel. Large row groups of local files are split
+	//! if all of their column chunks have an OffsetIndex, so that the scan of a range can jump to its first page
+	vector<pair<idx_t, idx_t>> GetRowGroupScanRanges(idx_t group_idx);
 	void Scan(ParquetReaderScanState &state, DataChunk &output);
 
 	static unique_ptr<ParquetUnionData> StoreUnionReader(unique_ptr<ParquetReader> reader_p, idx_t file_idx) {
@@ -166,6 +180,9 @@ public:
 	idx_t NumRows();
 	idx_t NumRowGroups();
 
+	//! The amount of rows of the ranges in which large row groups are split
+	static constexpr const idx_t ROW_GROUP_SCAN_RANGE_SIZE = Storage::ROW_GROUP_SIZE;
+
 	const duckdb_parquet::format::FileMetaData *GetFileMetadata();
 
 	uint32_t Read(duckdb_apache::thrift::TBase &object, TProtocol &iprot);
@@ -209,6 +226,11 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Uses the page index of a filtered column to find the row ranges of the current row group that can be skipped
+	void PrunePages(ParquetReaderScanState &state, const ColumnReader &column_reader, TableFilter &filter);
+	//! Checks the equality and IN filters of a column against the Bloom filter of its column chunk, returns true if no
+	//! row of the current row group can pass the filter
+	bool BloomFilterExcludes(ParquetReaderScanState &state, const ColumnReader &column_reader, TableFilter &filter);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
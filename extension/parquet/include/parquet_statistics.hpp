@@ -9,6 +9,7 @@
 namespace duckdb {
 
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::SchemaElement;
 
 struct LogicalType;
@@ -18,6 +19,12 @@ struct ParquetStatisticsUtils {
 
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
 	                                                            const vector<ColumnChunk> &columns);
+	static unique_ptr<BaseStatistics> TransformStatistics(const ColumnReader &reader,
+	                                                      const duckdb_parquet::format::Statistics &parquet_stats);
+	//! Transforms the statistics of a single data page, as stored in the page index of a column chunk
+	static unique_ptr<BaseStatistics> TransformPageStatistics(const ColumnReader &reader,
+	                                                          const ColumnIndex &column_index, idx_t page_idx);
+	static duckdb_parquet::format::Statistics GetPageStatistics(const ColumnIndex &column_index, idx_t page_idx);
 
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
@@ -10,6 +10,7 @@
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/encryption_state.hpp"
 #include "duckdb/common/exception.hpp"
@@ -20,6 +21,7 @@
 #endif
 
 #include "column_writer.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_types.h"
 #include "geo_parquet.hpp"
 #include "thrift/protocol/TCompactProtocol.h"
@@ -32,6 +34,23 @@ class ParquetEncryptionConfig;
 class Serializer;
 class Deserializer;
 
+//! The page index (ColumnIndex and OffsetIndex) of a single column chunk
+struct ParquetColumnPageIndex {
+	idx_t row_group_idx = 0;
+	idx_t column_idx = 0;
+	//! The ColumnIndex is only written if the bounds of all (non-NULL) pages are known
+	bool has_column_index = true;
+	vector<int64_t> null_counts;
+	duckdb_parquet::format::ColumnIndex column_index;
+	duckdb_parquet::format::OffsetIndex offset_index;
+};
+
+//! The Bloom filter of a single column chunk
+struct ParquetColumnBloomFilter {
+	idx_t column_idx = 0;
+	unique_ptr<ParquetBloomFilter> bloom_filter;
+};
+
 struct PreparedRowGroup {
 	duckdb_parquet::format::RowGroup row_group;
 	vector<unique_ptr<ColumnWriterState>> states;
@@ -67,13 +86,20 @@ public:
 	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level, bool debug_use_openssl);
+	              optional_idx compression_level, bool debug_use_openssl, bool write_page_index,
+	              const vector<string> &bloom_filter_columns, double bloom_filter_false_positive_ratio,
+	              const vector<string> &row_group_sort_columns, idx_t page_size_compressed);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
+	//! Analyzes, prepares and encodes the columns [col_idx, col_idx + count) of a row group
+	void PrepareColumns(ColumnDataCollection &buffer, vector<unique_ptr<ColumnWriterState>> &states, idx_t col_idx,
+	                    idx_t count);
 	void FlushRowGroup(PreparedRowGroup &row_group);
 	void Flush(ColumnDataCollection &buffer);
 	void Finalize();
+	void WritePageIndexes();
+	void WriteBloomFilters(duckdb_parquet::format::RowGroup &row_group);
 
 	static duckdb_parquet::format::Type::type DuckDBTypeToParquetType(const LogicalType &duckdb_type);
 	static void SetSchemaProperties(const LogicalType &duckdb_type, duckdb_parquet::format::SchemaElement &schema_ele);
@@ -103,6 +129,24 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	bool WritePageIndex() const {
+		return write_page_index;
+	}
+	//! Adds the page index of a column chunk of the row group that is being flushed
+	void AddPageIndex(ParquetColumnPageIndex page_index);
+	//! Whether or not a Bloom filter is written for the column with the given path
+	bool WriteBloomFilter(const vector<string> &schema_path) const;
+	double BloomFilterFalsePositiveRatio() const {
+		return bloom_filter_false_positive_ratio;
+	}
+	//! Adds the Bloom filter of a column chunk of the row group that is being flushed
+	void AddBloomFilter(ParquetColumnBloomFilter bloom_filter);
+	//! The compressed size that data pages of the column with the given path should have, or 0 if pages are sized
+	//! by their uncompressed size
+	idx_t TargetPageSize(const vector<string> &schema_path) const;
+	//! Estimates the compressed size of a row group from its in-memory size, using the compression ratio of the row
+	//! groups that were written so far
+	idx_t EstimateCompressedSize(idx_t in_memory_size) const;
 	idx_t NumberOfRowGroups() {
 		lock_guard<mutex> glock(lock);
 		return file_meta_data.row_groups.size();
@@ -117,6 +161,12 @@ public:
 	                              optional_ptr<duckdb_parquet::format::Type::type> type = nullptr);
 
 private:
+	//! Sorts the rows of a row group by the sort columns
+	unique_ptr<ColumnDataCollection> SortRowGroup(ColumnDataCollection &buffer);
+	void PrepareRowGroupInternal(ColumnDataCollection &buffer, PreparedRowGroup &result);
+
+private:
+	ClientContext &context;
 	string file_name;
 	vector<LogicalType> sql_types;
 	vector<string> column_names;
@@ -126,6 +176,18 @@ private:
 	double dictionary_compression_ratio_threshold;
 	optional_idx compression_level;
 	bool debug_use_openssl;
+	bool write_page_index;
+	case_insensitive_set_t bloom_filter_columns;
+	double bloom_filter_false_positive_ratio;
+	//! The columns by which the rows within a row group are sorted
+	vector<idx_t> row_group_sort_columns;
+	//! The compressed size of data pages (0 = pages are sized by their uncompressed size)
+	idx_t page_size_compressed;
+	//! The columns that are likely to be filtered on (sort and Bloom filter columns), which get smaller pages
+	case_insensitive_set_t filter_columns;
+	//! The in-memory and the compressed size of the row groups that were written so far
+	atomic<idx_t> row_groups_in_memory_size;
+	atomic<idx_t> row_groups_compressed_size;
 	shared_ptr<EncryptionUtil> encryption_util;
 
 	unique_ptr<BufferedFileWriter> writer;
@@ -134,6 +196,10 @@ private:
 	std::mutex lock;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
+	//! The page indexes of all column chunks, which are written in front of the footer
+	vector<ParquetColumnPageIndex> page_indexes;
+	//! The Bloom filters of the row group that is being flushed, which are written after its column chunks
+	vector<ParquetColumnBloomFilter> bloom_filters;
 
 	unique_ptr<GeoParquetFileMetadata> geoparquet_data;
 };
@@ -72,7 +72,7 @@ public:
 			throw IOException(
 			    "Parquet file is likely corrupted, cannot have dictionary offsets without seeing a dictionary first.");
 		}
-		if (HasDefines()) {
+		if (HasDefines() && defines) {
 			OffsetsInternal<true>(*dict, offsets, defines, num_values, filter, result_offset, result);
 		} else {
 			OffsetsInternal<false>(*dict, offsets, defines, num_values, filter, result_offset, result);
@@ -85,12 +85,32 @@ public:
 		                                             result);
 	}
 
+	bool DictionaryEntries(idx_t num_entries, Vector &result) override {
+		if (!dict || Type().id() == LogicalTypeId::BOOLEAN) {
+			return false;
+		}
+		const auto result_ptr = FlatVector::GetData<VALUE_TYPE>(result);
+		for (uint32_t entry_idx = 0; entry_idx < num_entries; entry_idx++) {
+			auto offset = entry_idx;
+			result_ptr[entry_idx] = VALUE_CONVERSION::DictRead(*dict, offset, *this);
+		}
+		DictReference(result);
+		return true;
+	}
+
 private:
 	template <bool HAS_DEFINES>
 	void OffsetsInternal(ResizeableBuffer &dict_ref, uint32_t *__restrict offsets, const uint8_t *__restrict defines,
 	                     const uint64_t num_values, const parquet_filter_t &filter, const idx_t result_offset,
 	                     Vector &result) {
 		const auto result_ptr = FlatVector::GetData<VALUE_TYPE>(result);
+		if (!HAS_DEFINES && filter.all()) {
+			// every value is valid and selected: a plain gather from the dictionary
+			for (idx_t i = 0; i < num_values; i++) {
+				result_ptr[result_offset + i] = VALUE_CONVERSION::DictRead(dict_ref, offsets[i], *this);
+			}
+			return;
+		}
 		auto &result_mask = FlatVector::Validity(result);
 		idx_t offset_idx = 0;
 		for (idx_t row_idx = result_offset; row_idx < result_offset + num_values; row_idx++) {
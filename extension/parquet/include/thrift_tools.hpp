@@ -31,16 +31,33 @@ struct ReadHead {
 	}
 };
 
-// Comparator for ReadHeads that are either overlapping, adjacent, or within ALLOW_GAP bytes from each other
+// Options for coalescing the ranges that are prefetched, e.g. from object stores where every request has a high latency
+struct ReadAheadOptions {
+	static constexpr uint64_t DEFAULT_MERGE_GAP = 1 << 14;          // 16 KiB
+	static constexpr uint64_t DEFAULT_MAX_MERGED_SIZE = 1ULL << 25; // 32 MiB
+
+	// Ranges that are at most this many bytes apart are merged into a single read
+	uint64_t merge_gap = DEFAULT_MERGE_GAP;
+	// Ranges are not merged beyond this size, so that large reads are split over several requests
+	uint64_t max_merged_size = DEFAULT_MAX_MERGED_SIZE;
+	// The maximum amount of bytes that is prefetched at once (0 = unlimited), ranges beyond this are read on first use
+	uint64_t max_prefetch_size = 0;
+};
+
+// Comparator for ReadHeads that are either overlapping, adjacent, or within allow_gap bytes from each other
 struct ReadHeadComparator {
-	static constexpr uint64_t ALLOW_GAP = 1 << 14; // 16 KiB
+	explicit ReadHeadComparator(uint64_t allow_gap = ReadAheadOptions::DEFAULT_MERGE_GAP) : allow_gap(allow_gap) {
+	}
+
+	uint64_t allow_gap;
+
 	bool operator()(const ReadHead *a, const ReadHead *b) const {
 		auto a_start = a->location;
 		auto a_end = a->location + a->size;
 		auto b_start = b->location;
 
-		if (a_end <= NumericLimits<idx_t>::Maximum() - ALLOW_GAP) {
-			a_end += ALLOW_GAP;
+		if (a_end <= NumericLimits<idx_t>::Maximum() - allow_gap) {
+			a_end += allow_gap;
 		}
 
 		return a_start < b_start && a_end < b_start;
@@ -51,7 +68,8 @@ struct ReadHeadComparator {
 // 1: register all ranges that will be read, merging ranges that are consecutive
 // 2: prefetch all registered ranges
 struct ReadAheadBuffer {
-	ReadAheadBuffer(Allocator &allocator, FileHandle &handle) : allocator(allocator), handle(handle) {
+	ReadAheadBuffer(Allocator &allocator, FileHandle &handle, const ReadAheadOptions &options = ReadAheadOptions())
+	    : merge_set(ReadHeadComparator(options.merge_gap)), allocator(allocator), handle(handle), options(options) {
 	}
 
 	// The list of read heads
@@ -61,6 +79,7 @@ struct ReadAheadBuffer {
 
 	Allocator &allocator;
 	FileHandle &handle;
+	ReadAheadOptions options;
 
 	idx_t total_size = 0;
 
@@ -74,9 +93,15 @@ struct ReadAheadBuffer {
 				auto existing_head = *lookup_set;
 				auto new_start = MinValue<idx_t>(existing_head->location, new_read_head.location);
 				auto new_length = MaxValue<idx_t>(existing_head->GetEnd(), new_read_head.GetEnd()) - new_start;
-				existing_head->location = new_start;
-				existing_head->size = new_length;
-				return;
+				auto overlapping = new_read_head.location < existing_head->GetEnd() &&
+				                   existing_head->location < new_read_head.GetEnd();
+				if (overlapping || new_length <= options.max_merged_size) {
+					existing_head->location = new_start;
+					existing_head->size = new_length;
+					return;
+				}
+				// the merged read would become too large: read this range separately
+				merge_buffers = false;
 			}
 		}
 
@@ -103,17 +128,34 @@ struct ReadAheadBuffer {
 		return nullptr;
 	}
 
-	// Prefetch all read heads
+	// Reads the data of a read head, if this did not happen yet
+	void Fetch(ReadHead &read_head) {
+		if (read_head.data_isset) {
+			return;
+		}
+		read_head.Allocate(allocator);
+
+		if (read_head.GetEnd() > handle.GetFileSize()) {
+			throw std::runtime_error("Prefetch registered requested for bytes outside file");
+		}
+
+		handle.Read(read_head.data.get(), read_head.size, read_head.location);
+		read_head.data_isset = true;
+	}
+
+	// Prefetch all read heads, up to the maximum prefetch size (the other read heads are fetched on their first read)
 	void Prefetch() {
+		idx_t prefetched_size = 0;
 		for (auto &read_head : read_heads) {
-			read_head.Allocate(allocator);
-
-			if (read_head.GetEnd() > handle.GetFileSize()) {
-				throw std::runtime_error("Prefetch registered requested for bytes outside file");
+			if (read_head.data_isset) {
+				continue;
 			}
-
-			handle.Read(read_head.data.get(), read_head.size, read_head.location);
-			read_head.data_isset = true;
+			if (options.max_prefetch_size > 0 && prefetched_size > 0 &&
+			    prefetched_size + read_head.size > options.max_prefetch_size) {
+				continue;
+			}
+			Fetch(read_head);
+			prefetched_size += read_head.size;
 		}
 	}
 };
@@ -122,9 +164,10 @@ class ThriftFileTransport : public duckdb_apache::thrift::transport::TVirtualTra
 public:
 	static constexpr uint64_t PREFETCH_FALLBACK_BUFFERSIZE = 1000000;
 
-	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p)
-	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(ReadAheadBuffer(allocator, handle_p)),
-	      prefetch_mode(prefetch_mode_p) {
+	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p,
+	                    const ReadAheadOptions &read_ahead_options = ReadAheadOptions())
+	    : handle(handle_p), location(0), allocator(allocator),
+	      ra_buffer(ReadAheadBuffer(allocator, handle_p, read_ahead_options)), prefetch_mode(prefetch_mode_p) {
 	}
 
 	uint32_t read(uint8_t *buf, uint32_t len) {
@@ -132,17 +175,14 @@ public:
 		if (prefetch_buffer != nullptr && location - prefetch_buffer->location + len <= prefetch_buffer->size) {
 			D_ASSERT(location - prefetch_buffer->location + len <= prefetch_buffer->size);
 
-			if (!prefetch_buffer->data_isset) {
-				prefetch_buffer->Allocate(allocator);
-				handle.Read(prefetch_buffer->data.get(), prefetch_buffer->size, prefetch_buffer->location);
-				prefetch_buffer->data_isset = true;
-			}
+			ra_buffer.Fetch(*prefetch_buffer);
 			memcpy(buf, prefetch_buffer->data.get() + location - prefetch_buffer->location, len);
 		} else {
 			if (prefetch_mode && len < PREFETCH_FALLBACK_BUFFERSIZE && len > 0) {
 				Prefetch(location, MinValue<uint64_t>(PREFETCH_FALLBACK_BUFFERSIZE, handle.GetFileSize() - location));
 				auto prefetch_buffer_fallback = ra_buffer.GetReadHead(location);
 				D_ASSERT(location - prefetch_buffer_fallback->location + len <= prefetch_buffer_fallback->size);
+				ra_buffer.Fetch(*prefetch_buffer_fallback);
 				memcpy(buf, prefetch_buffer_fallback->data.get() + location - prefetch_buffer_fallback->location, len);
 			} else {
 				handle.Read(buf, len, location);
@@ -0,0 +1,66 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "zstd/common/xxhash.h"
+
+#include <cmath>
+
+namespace duckdb {
+
+//! The salts that derive the bits of a block from the hash of a value, as defined by the Parquet format
+static constexpr const uint32_t BLOOM_FILTER_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+static idx_t BloomFilterBytes(idx_t num_entries, double false_positive_ratio) {
+	// the optimal amount of bits for a split block Bloom filter with eight bits set per value
+	auto num_bits = -8.0 * double(num_entries) / std::log(1.0 - std::pow(false_positive_ratio, 1.0 / 8.0));
+	auto num_bytes = idx_t(num_bits / 8.0);
+	num_bytes = MinValue<idx_t>(num_bytes, ParquetBloomFilter::MAXIMUM_BYTES);
+	num_bytes = MaxValue<idx_t>(num_bytes, ParquetBloomFilter::BLOCK_SIZE);
+	return NextPowerOfTwo(num_bytes);
+}
+
+ParquetBloomFilter::ParquetBloomFilter(Allocator &allocator, idx_t num_entries, double false_positive_ratio) {
+	D_ASSERT(false_positive_ratio > 0 && false_positive_ratio < 1);
+	auto num_bytes = BloomFilterBytes(num_entries, false_positive_ratio);
+	block_count = num_bytes / BLOCK_SIZE;
+	data = allocator.Allocate(num_bytes);
+	memset(data.get(), 0, num_bytes);
+}
+
+ParquetBloomFilter::ParquetBloomFilter(AllocatedData data_p, idx_t num_bytes)
+    : data(std::move(data_p)), block_count(num_bytes / BLOCK_SIZE) {
+	D_ASSERT(num_bytes > 0 && num_bytes % BLOCK_SIZE == 0);
+}
+
+static inline idx_t BloomFilterBlockOffset(idx_t block_count, uint64_t hash) {
+	// the upper 32 bits of the hash select the block
+	return (((hash >> 32) * block_count) >> 32) * ParquetBloomFilter::BLOCK_SIZE;
+}
+
+static inline uint32_t BloomFilterMask(uint64_t hash, idx_t word_idx) {
+	// the lower 32 bits of the hash select a bit in each word of the block
+	return 1U << ((uint32_t(hash) * BLOOM_FILTER_SALT[word_idx]) >> 27);
+}
+
+void ParquetBloomFilter::FilterInsert(uint64_t hash) {
+	auto block = reinterpret_cast<uint32_t *>(data.get() + BloomFilterBlockOffset(block_count, hash));
+	for (idx_t word_idx = 0; word_idx < 8; word_idx++) {
+		block[word_idx] |= BloomFilterMask(hash, word_idx);
+	}
+}
+
+bool ParquetBloomFilter::FilterCheck(uint64_t hash) const {
+	auto block = reinterpret_cast<const uint32_t *>(data.get() + BloomFilterBlockOffset(block_count, hash));
+	for (idx_t word_idx = 0; word_idx < 8; word_idx++) {
+		if (!(block[word_idx] & BloomFilterMask(hash, word_idx))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t value, idx_t size) {
+	return duckdb_zstd::XXH64(value, size, 0);
+}
+
+} // namespace duckdb
@@ -11,12 +11,14 @@
 #include "duckdb/planner/query_node/bound_select_node.hpp"
 #include "geo_parquet.hpp"
 #include "parquet_crypto.hpp"
+#include "parquet_file_metadata_cache.hpp"
 #include "parquet_metadata.hpp"
 #include "parquet_reader.hpp"
 #include "parquet_writer.hpp"
 #include "struct_column_reader.hpp"
 #include "zstd_file_system.hpp"
 
+#include <condition_variable>
 #include <fstream>
 #include <iostream>
 #include <numeric>
@@ -32,7 +34,9 @@
 #include "duckdb/common/multi_file_reader.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/common/type_visitor.hpp"
+#include "duckdb/common/types/hash.hpp"
 #include "duckdb/function/copy_function.hpp"
 #include "duckdb/function/pragma_function.hpp"
 #include "duckdb/function/table_function.hpp"
@@ -48,6 +52,7 @@
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/table/row_group.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
 #endif
 
 namespace duckdb {
@@ -69,6 +74,7 @@ struct ParquetReadBindData : public TableFunctionData {
 
 	// These come from the initial_reader, but need to be stored in case the initial_reader is removed by a filter
 	idx_t initial_file_cardinality;
+	//! The amount of row groups (or ranges of large row groups) that can be scanned in parallel
 	idx_t initial_file_row_groups;
 	ParquetOptions parquet_options;
 
@@ -77,7 +83,10 @@ struct ParquetReadBindData : public TableFunctionData {
 	void Initialize(shared_ptr<ParquetReader> reader) {
 		initial_reader = std::move(reader);
 		initial_file_cardinality = initial_reader->NumRows();
-		initial_file_row_groups = initial_reader->NumRowGroups();
+		initial_file_row_groups = 0;
+		for (idx_t group_idx = 0; group_idx < initial_reader->NumRowGroups(); group_idx++) {
+			initial_file_row_groups += initial_reader->GetRowGroupScanRanges(group_idx).size();
+		}
 		parquet_options = initial_reader->parquet_options;
 	}
 	void Initialize(ClientContext &, unique_ptr<ParquetUnionData> &union_data) {
@@ -132,11 +141,23 @@ struct ParquetFileReaderData {
 };
 
 struct ParquetReadGlobalState : public GlobalTableFunctionState {
+	static constexpr idx_t DEFAULT_FILE_PREFETCH_COUNT = 4;
+
 	explicit ParquetReadGlobalState(MultiFileList &file_list_p) : file_list(file_list_p) {
 	}
 	explicit ParquetReadGlobalState(unique_ptr<MultiFileList> owned_file_list_p)
 	    : file_list(*owned_file_list_p), owned_file_list(std::move(owned_file_list_p)) {
 	}
+	~ParquetReadGlobalState() override {
+		{
+			lock_guard<mutex> guard(lock);
+			prefetch_finished = true;
+		}
+		prefetch_cv.notify_all();
+		for (auto &prefetch_thread : prefetch_threads) {
+			prefetch_thread.join();
+		}
+	}
 
 	//! The file list to scan
 	MultiFileList &file_list;
@@ -155,10 +176,21 @@ struct ParquetReadGlobalState : public GlobalTableFunctionState {
 	//! Signal to other threads that a file failed to open, letting every thread abort.
 	bool error_opening_file = false;
 
+	//! Background threads that open the files after the current file, so that scanning does not wait for them
+	vector<thread> prefetch_threads;
+	//! The number of files, starting at the current file, that are opened in the background
+	idx_t prefetch_count = 0;
+	//! Signals the prefetch threads that the scan moved on to the next file, or that the scan is finished
+	std::condition_variable prefetch_cv;
+	bool prefetch_finished = false;
+
 	//! Index of file currently up for scanning
 	atomic<idx_t> file_index;
 	//! Index of row group within file currently up for scanning
 	idx_t row_group_index;
+	//! The row ranges in which the current row group is scanned, and the index of the range up for scanning
+	vector<pair<idx_t, idx_t>> row_group_ranges;
+	idx_t row_group_range_index = 0;
 	//! Batch index of the next row group to be scanned
 	idx_t batch_index;
 
@@ -167,6 +199,8 @@ struct ParquetReadGlobalState : public GlobalTableFunctionState {
 	vector<LogicalType> scanned_types;
 	vector<column_t> column_ids;
 	optional_ptr<TableFilterSet> filters;
+	//! The system sample that is pushed into the scan (if any), which skips the row group ranges outside of the sample
+	shared_ptr<ScanSamplingInfo> sampling;
 
 	idx_t MaxThreads() const override {
 		return max_threads;
@@ -198,6 +232,20 @@ struct ParquetWriteBindData : public TableFunctionData {
 	//! After how many row groups to rotate to a new file
 	optional_idx row_groups_per_file;
 
+	//! Whether or not to write the page index (ColumnIndex and OffsetIndex) of the column chunks
+	bool write_page_index = false;
+
+	//! The columns for which a Bloom filter is written, and its false positive ratio
+	vector<string> bloom_filter_columns;
+	double bloom_filter_false_positive_ratio = 0.01;
+
+	//! If set, row groups are flushed once their estimated compressed size reaches this amount of bytes
+	optional_idx row_group_size_compressed;
+	//! The compressed size of data pages (0 = pages are sized by their uncompressed size)
+	idx_t page_size_compressed = 0;
+	//! The columns by which the rows within a row group are sorted
+	vector<string> row_group_sort_columns;
+
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
@@ -407,6 +455,7 @@ public:
 		table_function.projection_pushdown = true;
 		table_function.filter_pushdown = true;
 		table_function.filter_prune = true;
+		table_function.sampling_pushdown = true;
 		table_function.pushdown_complex_filter = ParquetComplexFilterPushdown;
 
 		MultiFileReader::AddParameters(table_function);
@@ -737,6 +786,9 @@ public:
 
 		result->column_ids = input.column_ids;
 		result->filters = input.filters.get();
+		if (input.sample_options) {
+			result->sampling = ScanSamplingInfo::Create(context, *input.sample_options);
+		}
 		result->row_group_index = 0;
 		result->file_index = 0;
 		result->batch_index = 0;
@@ -768,6 +820,21 @@ public:
 			}
 		}
 
+		if (file_list.GetExpandResult() == FileExpandResult::MULTIPLE_FILES) {
+			Value prefetch_count;
+			result->prefetch_count = ParquetReadGlobalState::DEFAULT_FILE_PREFETCH_COUNT;
+			if (context.TryGetCurrentSetting("parquet_file_prefetch_count", prefetch_count) &&
+			    !prefetch_count.IsNull()) {
+				result->prefetch_count = UBigIntValue::Get(prefetch_count);
+			}
+			auto &state = *result;
+			for (idx_t thread_idx = 0; thread_idx < result->prefetch_count; thread_idx++) {
+				result->prefetch_threads.emplace_back([&context, &bind_data, &state]() {
+					PrefetchFiles(context, bind_data, state);
+				});
+			}
+		}
+
 		return std::move(result);
 	}
 
@@ -880,6 +947,11 @@ public:
 		return true;
 	}
 
+	//! The position of a range of a row group in the files of the scan, which decides whether it is part of a sample
+	static hash_t GetRowRangePosition(idx_t file_index, idx_t row_group_index, idx_t row_start) {
+		return Hash<uint64_t>(Hash<uint64_t>(Hash<uint64_t>(file_index) ^ row_group_index) ^ row_start);
+	}
+
 	// This function looks for the next available row group. If not available, it will open files from bind_data.files
 	// until there is a row group available for scanning or the files runs out
 	static bool ParquetParallelStateNext(ClientContext &context, const ParquetReadBindData &bind_data,
@@ -900,11 +972,34 @@ public:
 				if (parallel_state.row_group_index < current_reader_data.reader->NumRowGroups()) {
 					// The current reader has rowgroups left to be scanned
 					scan_data.reader = current_reader_data.reader;
-					vector<idx_t> group_indexes {parallel_state.row_group_index};
-					scan_data.reader->InitializeScan(context, scan_data.scan_state, group_indexes);
+					auto &row_group_ranges = parallel_state.row_group_ranges;
+					if (row_group_ranges.empty()) {
+						// large row groups are split in ranges that are scanned by different threads
+						row_group_ranges = scan_data.reader->GetRowGroupScanRanges(parallel_state.row_group_index);
+						parallel_state.row_group_range_index = 0;
+					}
+					auto row_group_index = parallel_state.row_group_index;
+					auto row_range = row_group_ranges[parallel_state.row_group_range_index];
+					bool single_range = row_group_ranges.size() == 1;
+					parallel_state.row_group_range_index++;
+					if (parallel_state.row_group_range_index == row_group_ranges.size()) {
+						row_group_ranges.clear();
+						parallel_state.row_group_index++;
+					}
+					if (parallel_state.sampling &&
+					    !parallel_state.sampling->IsSampled(
+					        GetRowRangePosition(parallel_state.file_index, row_group_index, row_range.first))) {
+						// the range is not part of the sample - skip it without reading it
+						continue;
+					}
+					if (single_range) {
+						vector<idx_t> group_indexes {row_group_index};
+						scan_data.reader->InitializeScan(context, scan_data.scan_state, group_indexes);
+					} else {
+						scan_data.reader->InitializeScan(context, scan_data.scan_state, row_group_index, row_range);
+					}
 					scan_data.batch_index = parallel_state.batch_index++;
 					scan_data.file_index = parallel_state.file_index;
-					parallel_state.row_group_index++;
 					return true;
 				} else {
 					// Close current file
@@ -914,6 +1009,7 @@ public:
 					// Set state to the next file
 					parallel_state.file_index++;
 					parallel_state.row_group_index = 0;
+					parallel_state.prefetch_cv.notify_all();
 
 					continue;
 				}
@@ -969,6 +1065,71 @@ public:
 		}
 	}
 
+	//! Opens the reader of a file, and initializes it for this scan
+	static shared_ptr<ParquetReader> OpenReader(ClientContext &context, const ParquetReadBindData &bind_data,
+	                                            ParquetReadGlobalState &parallel_state,
+	                                            ParquetFileReaderData &reader_data, idx_t file_index) {
+		shared_ptr<ParquetReader> reader;
+		if (reader_data.union_data) {
+			auto &union_data = *reader_data.union_data;
+			reader =
+			    make_shared_ptr<ParquetReader>(context, union_data.file_name, union_data.options, union_data.metadata);
+		} else {
+			reader = make_shared_ptr<ParquetReader>(context, reader_data.file_to_be_opened, bind_data.parquet_options);
+		}
+		InitializeParquetReader(*reader, bind_data, parallel_state.column_ids, parallel_state.filters, context,
+		                        file_index, parallel_state.multi_file_reader_state);
+		return reader;
+	}
+
+	//! Runs in a background thread: opens the unopened files among the next prefetch_count files of the scan, so
+	//! that their metadata is read while other files are scanned
+	static void PrefetchFiles(ClientContext &context, const ParquetReadBindData &bind_data,
+	                          ParquetReadGlobalState &parallel_state) {
+		unique_lock<mutex> parallel_lock(parallel_state.lock);
+		while (!parallel_state.prefetch_finished && !parallel_state.error_opening_file) {
+			optional_ptr<ParquetFileReaderData> unopened_file;
+			idx_t file_index;
+			const auto file_index_limit = parallel_state.file_index + parallel_state.prefetch_count;
+			for (file_index = parallel_state.file_index; file_index < file_index_limit; file_index++) {
+				if (file_index >= parallel_state.readers.size() && !ResizeFiles(parallel_state)) {
+					// all files are opened or being opened
+					return;
+				}
+				auto &reader_data = *parallel_state.readers[file_index];
+				if (reader_data.file_state == ParquetFileState::UNOPENED) {
+					unopened_file = reader_data;
+					break;
+				}
+			}
+			if (!unopened_file) {
+				// wait for the scan to move on to the next file
+				parallel_state.prefetch_cv.wait(parallel_lock);
+				continue;
+			}
+			auto &reader_data = *unopened_file;
+			reader_data.file_state = ParquetFileState::OPENING;
+
+			// threads that need this file wait for its file lock, see TryOpenNextFile
+			auto &file_mutex = *reader_data.file_mutex;
+			parallel_lock.unlock();
+			unique_lock<mutex> file_lock(file_mutex);
+
+			shared_ptr<ParquetReader> reader;
+			try {
+				reader = OpenReader(context, bind_data, parallel_state, reader_data, file_index);
+			} catch (...) {
+				// leave the file to the scan, which opens it again and reports the error
+				parallel_lock.lock();
+				reader_data.file_state = ParquetFileState::UNOPENED;
+				return;
+			}
+			parallel_lock.lock();
+			reader_data.reader = std::move(reader);
+			reader_data.file_state = ParquetFileState::OPEN;
+		}
+	}
+
 	//! Helper function that try to start opening a next file. Parallel lock should be locked when calling.
 	static bool TryOpenNextFile(ClientContext &context, const ParquetReadBindData &bind_data,
 	                            ParquetReadLocalState &scan_data, ParquetReadGlobalState &parallel_state,
@@ -985,7 +1146,6 @@ public:
 			auto &current_reader_data = *parallel_state.readers[i];
 			if (current_reader_data.file_state == ParquetFileState::UNOPENED) {
 				current_reader_data.file_state = ParquetFileState::OPENING;
-				auto pq_options = bind_data.parquet_options;
 
 				// Get pointer to file mutex before unlocking
 				auto &current_file_lock = *current_reader_data.file_mutex;
@@ -997,16 +1157,7 @@ public:
 
 				shared_ptr<ParquetReader> reader;
 				try {
-					if (current_reader_data.union_data) {
-						auto &union_data = *current_reader_data.union_data;
-						reader = make_shared_ptr<ParquetReader>(context, union_data.file_name, union_data.options,
-						                                        union_data.metadata);
-					} else {
-						reader =
-						    make_shared_ptr<ParquetReader>(context, current_reader_data.file_to_be_opened, pq_options);
-					}
-					InitializeParquetReader(*reader, bind_data, parallel_state.column_ids, parallel_state.filters,
-					                        context, i, parallel_state.multi_file_reader_state);
+					reader = OpenReader(context, bind_data, parallel_state, current_reader_data, i);
 				} catch (...) {
 					parallel_lock.lock();
 					parallel_state.error_opening_file = true;
@@ -1176,6 +1327,37 @@ static void GetFieldIDs(const Value &field_ids_value, ChildFieldIDs &field_ids,
 	}
 }
 
+static vector<string> GetColumnNamesArgument(const pair<string, vector<Value>> &option, const vector<string> &names) {
+	auto &columns_value = option.second[0];
+	vector<Value> column_values;
+	if (columns_value.type().id() == LogicalTypeId::LIST) {
+		column_values = ListValue::GetChildren(columns_value);
+	} else {
+		column_values.push_back(columns_value);
+	}
+	auto option_name = StringUtil::Upper(option.first);
+	case_insensitive_set_t column_names(names.begin(), names.end());
+	vector<string> result;
+	for (auto &column_value : column_values) {
+		if (column_value.IsNull() || column_value.type().id() != LogicalTypeId::VARCHAR) {
+			throw BinderException("%s expects a column name or a list of column names", option_name);
+		}
+		auto &column_name = StringValue::Get(column_value);
+		if (column_names.find(column_name) == column_names.end()) {
+			throw BinderException("Column \"%s\" in %s does not exist", column_name, option_name);
+		}
+		result.push_back(column_name);
+	}
+	return result;
+}
+
+static idx_t GetBytesArgument(const Value &value) {
+	if (value.type().id() == LogicalTypeId::VARCHAR) {
+		return DBConfig::ParseMemoryLimit(value.ToString());
+	}
+	return value.GetValue<uint64_t>();
+}
+
 unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBindInput &input,
                                           const vector<string> &names, const vector<LogicalType> &sql_types) {
 	D_ASSERT(names.size() == sql_types.size());
@@ -1190,12 +1372,7 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 		if (loption == "row_group_size" || loption == "chunk_size") {
 			bind_data->row_group_size = option.second[0].GetValue<uint64_t>();
 		} else if (loption == "row_group_size_bytes") {
-			auto roption = option.second[0];
-			if (roption.GetTypeMutable().id() == LogicalTypeId::VARCHAR) {
-				bind_data->row_group_size_bytes = DBConfig::ParseMemoryLimit(roption.ToString());
-			} else {
-				bind_data->row_group_size_bytes = option.second[0].GetValue<uint64_t>();
-			}
+			bind_data->row_group_size_bytes = GetBytesArgument(option.second[0]);
 			row_group_size_bytes_set = true;
 		} else if (loption == "row_groups_per_file") {
 			bind_data->row_groups_per_file = option.second[0].GetValue<uint64_t>();
@@ -1276,10 +1453,34 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			}
 		} else if (loption == "compression_level") {
 			bind_data->compression_level = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "write_page_index") {
+			bind_data->write_page_index = GetBooleanArgument(option);
+		} else if (loption == "bloom_filter_columns") {
+			bind_data->bloom_filter_columns = GetColumnNamesArgument(option, names);
+		} else if (loption == "row_group_sort_by") {
+			bind_data->row_group_sort_columns = GetColumnNamesArgument(option, names);
+		} else if (loption == "row_group_size_compressed") {
+			bind_data->row_group_size_compressed = GetBytesArgument(option.second[0]);
+		} else if (loption == "page_size_compressed") {
+			bind_data->page_size_compressed = GetBytesArgument(option.second[0]);
+			if (bind_data->page_size_compressed == 0) {
+				throw BinderException("PAGE_SIZE_COMPRESSED must be greater than 0");
+			}
+		} else if (loption == "bloom_filter_false_positive_ratio") {
+			auto val = option.second[0].GetValue<double>();
+			if (val <= 0 || val >= 1) {
+				throw BinderException("bloom_filter_false_positive_ratio must be between 0 and 1 (exclusive)");
+			}
+			bind_data->bloom_filter_false_positive_ratio = val;
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
 	}
+	if (bind_data->row_group_size_compressed.IsValid() &&
+	    DBConfig::GetConfig(context).options.preserve_insertion_order) {
+		throw BinderException("ROW_GROUP_SIZE_COMPRESSED does not work while preserving insertion order. Use \"SET "
+		                      "preserve_insertion_order=false;\" to disable preserving insertion order.");
+	}
 	if (row_group_size_bytes_set) {
 		if (DBConfig::GetConfig(context).options.preserve_insertion_order) {
 			throw BinderException("ROW_GROUP_SIZE_BYTES does not work while preserving insertion order. Use \"SET "
@@ -1305,10 +1506,29 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	    make_uniq<ParquetWriter>(context, fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
 	                             parquet_bind.codec, parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata,
 	                             parquet_bind.encryption_config, parquet_bind.dictionary_compression_ratio_threshold,
-	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl);
+	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl,
+	                             parquet_bind.write_page_index, parquet_bind.bloom_filter_columns,
+	                             parquet_bind.bloom_filter_false_positive_ratio, parquet_bind.row_group_sort_columns,
+	                             parquet_bind.page_size_compressed);
 	return std::move(global_state);
 }
 
+static bool ParquetWriteRowGroupFull(const ParquetWriteBindData &bind_data, ParquetWriteGlobalState &global_state,
+                                     ColumnDataCollection &buffer) {
+	if (buffer.Count() >= bind_data.row_group_size) {
+		return true;
+	}
+	auto in_memory_size = buffer.SizeInBytes();
+	if (in_memory_size >= bind_data.row_group_size_bytes) {
+		return true;
+	}
+	if (!bind_data.row_group_size_compressed.IsValid()) {
+		return false;
+	}
+	auto compressed_size = global_state.writer->EstimateCompressedSize(in_memory_size);
+	return compressed_size >= bind_data.row_group_size_compressed.GetIndex();
+}
+
 void ParquetWriteSink(ExecutionContext &context, FunctionData &bind_data_p, GlobalFunctionData &gstate,
                       LocalFunctionData &lstate, DataChunk &input) {
 	auto &bind_data = bind_data_p.Cast<ParquetWriteBindData>();
@@ -1318,8 +1538,7 @@ void ParquetWriteSink(ExecutionContext &context, FunctionData &bind_data_p, Glob
 	// append data to the local (buffered) chunk collection
 	local_state.buffer.Append(local_state.append_state, input);
 
-	if (local_state.buffer.Count() >= bind_data.row_group_size ||
-	    local_state.buffer.SizeInBytes() >= bind_data.row_group_size_bytes) {
+	if (ParquetWriteRowGroupFull(bind_data, global_state, local_state.buffer)) {
 		// if the chunk collection exceeds a certain size (rows/bytes) we flush it to the parquet file
 		local_state.append_state.current_chunk_state.handles.clear();
 		global_state.writer->Flush(local_state.buffer);
@@ -1429,6 +1648,15 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WritePropertyWithDefault<optional_idx>(109, "compression_level", bind_data.compression_level);
 	serializer.WriteProperty(110, "row_groups_per_file", bind_data.row_groups_per_file);
 	serializer.WriteProperty(111, "debug_use_openssl", bind_data.debug_use_openssl);
+	serializer.WritePropertyWithDefault<bool>(112, "write_page_index", bind_data.write_page_index, false);
+	serializer.WritePropertyWithDefault<vector<string>>(113, "bloom_filter_columns", bind_data.bloom_filter_columns);
+	serializer.WritePropertyWithDefault<double>(114, "bloom_filter_false_positive_ratio",
+	                                            bind_data.bloom_filter_false_positive_ratio, 0.01);
+	serializer.WritePropertyWithDefault<optional_idx>(115, "row_group_size_compressed",
+	                                                  bind_data.row_group_size_compressed);
+	serializer.WritePropertyWithDefault<idx_t>(116, "page_size_compressed", bind_data.page_size_compressed, 0);
+	serializer.WritePropertyWithDefault<vector<string>>(117, "row_group_sort_columns",
+	                                                    bind_data.row_group_sort_columns);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1448,6 +1676,15 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	data->row_groups_per_file =
 	    deserializer.ReadPropertyWithExplicitDefault<optional_idx>(110, "row_groups_per_file", optional_idx::Invalid());
 	data->debug_use_openssl = deserializer.ReadPropertyWithExplicitDefault<bool>(111, "debug_use_openssl", true);
+	data->write_page_index = deserializer.ReadPropertyWithExplicitDefault<bool>(112, "write_page_index", false);
+	data->bloom_filter_columns = deserializer.ReadPropertyWithDefault<vector<string>>(113, "bloom_filter_columns");
+	data->bloom_filter_false_positive_ratio =
+	    deserializer.ReadPropertyWithExplicitDefault<double>(114, "bloom_filter_false_positive_ratio", 0.01);
+	deserializer.ReadPropertyWithDefault<optional_idx>(115, "row_group_size_compressed",
+	                                                   data->row_group_size_compressed);
+	data->page_size_compressed = deserializer.ReadPropertyWithExplicitDefault<idx_t>(116, "page_size_compressed", 0);
+	data->row_group_sort_columns =
+	    deserializer.ReadPropertyWithDefault<vector<string>>(117, "row_group_sort_columns");
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
@@ -1622,6 +1859,36 @@ static vector<unique_ptr<Expression>> ParquetWriteSelect(CopyToSelectInput &inpu
 	return {};
 }
 
+//! Provides the statistics of Parquet files of which the metadata is in the object cache, so that multi-file scans can
+//! skip files without opening them
+class ParquetFileStatisticsProvider : public MultiFileStatisticsProvider {
+public:
+	unique_ptr<BaseStatistics> GetColumnStatistics(ClientContext &context, const string &file_name,
+	                                               const string &column_name, const LogicalType &type) override {
+		if (!DBConfig::GetConfig(context).options.object_cache_enable) {
+			return nullptr;
+		}
+		auto &fs = FileSystem::GetFileSystem(context);
+		if (fs.IsRemoteFile(file_name)) {
+			// we cannot cheaply check if the metadata of remote files is current
+			return nullptr;
+		}
+		auto metadata = ObjectCache::GetObjectCache(context).Get<ParquetFileMetadataCache>(file_name);
+		if (!metadata) {
+			return nullptr;
+		}
+		auto handle = fs.OpenFile(file_name, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+		if (!handle || fs.GetLastModifiedTime(*handle) >= metadata->read_time) {
+			return nullptr;
+		}
+		auto stats = ParquetReader::ReadStatistics(context, ParquetOptions(context), std::move(metadata), column_name);
+		if (!stats || stats->GetType() != type) {
+			return nullptr;
+		}
+		return stats;
+	}
+};
+
 void ParquetExtension::Load(DuckDB &db) {
 	auto &db_instance = *db.instance;
 	auto &fs = db.GetFileSystem();
@@ -1678,8 +1945,33 @@ void ParquetExtension::Load(DuckDB &db) {
 
 	auto &config = DBConfig::GetConfig(*db.instance);
 	config.replacement_scans.emplace_back(ParquetScanReplacement);
+	config.file_statistics_providers.push_back(make_uniq<ParquetFileStatisticsProvider>());
 	config.AddExtensionOption("binary_as_string", "In Parquet files, interpret binary data as a string.",
 	                          LogicalType::BOOLEAN);
+	config.AddExtensionOption("parquet_prefetch_merge_gap",
+	                          "When prefetching from remote Parquet files, merge ranges that are at most this many "
+	                          "bytes apart into a single request",
+	                          LogicalType::UBIGINT, Value::UBIGINT(ReadAheadOptions::DEFAULT_MERGE_GAP));
+	config.AddExtensionOption("parquet_prefetch_max_merged_size",
+	                          "When prefetching from remote Parquet files, do not merge ranges into requests that are "
+	                          "larger than this many bytes",
+	                          LogicalType::UBIGINT, Value::UBIGINT(ReadAheadOptions::DEFAULT_MAX_MERGED_SIZE));
+	config.AddExtensionOption("parquet_prefetch_max_size",
+	                          "The maximum amount of bytes that is prefetched at once from remote Parquet files, "
+	                          "the remaining ranges are read when they are needed (0 = unlimited)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("parquet_file_prefetch_count",
+	                          "The number of files that scans over multiple Parquet files open in the background, "
+	                          "ahead of the file that is being scanned (0 = disabled)",
+	                          LogicalType::UBIGINT,
+	                          Value::UBIGINT(ParquetReadGlobalState::DEFAULT_FILE_PREFETCH_COUNT));
+	config.AddExtensionOption("parquet_metadata_cache_size",
+	                          "The maximum total size in bytes of the Parquet footers that are kept in the object "
+	                          "cache, the least recently used footers are evicted first",
+	                          LogicalType::UBIGINT, Value::UBIGINT(ParquetMetadataCacheEviction::DEFAULT_MAXIMUM_SIZE));
+	config.AddExtensionOption("parquet_metadata_cache_directory",
+	                          "A directory in which Parquet footers are cached across restarts (empty = disabled)",
+	                          LogicalType::VARCHAR, Value(""));
 }
 
 std::string ParquetExtension::Name() {
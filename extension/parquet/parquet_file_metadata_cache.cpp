@@ -0,0 +1,201 @@
+#include "parquet_file_metadata_cache.hpp"
+
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/main/client_context.hpp"
+#endif
+
+#include <chrono>
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Eviction
+//===--------------------------------------------------------------------===//
+ParquetMetadataCacheEviction &ParquetMetadataCacheEviction::Get(ClientContext &context) {
+	auto &cache = ObjectCache::GetObjectCache(context);
+	return *cache.GetOrCreate<ParquetMetadataCacheEviction>(ParquetMetadataCacheEviction::ObjectType());
+}
+
+static idx_t MaximumMetadataCacheSize(ClientContext &context) {
+	Value setting;
+	if (context.TryGetCurrentSetting("parquet_metadata_cache_size", setting) && !setting.IsNull()) {
+		return UBigIntValue::Get(setting);
+	}
+	return ParquetMetadataCacheEviction::DEFAULT_MAXIMUM_SIZE;
+}
+
+shared_ptr<ParquetFileMetadataCache> ParquetMetadataCacheEviction::GetMetadata(ClientContext &context,
+                                                                               const string &file_name) {
+	auto metadata = ObjectCache::GetObjectCache(context).Get<ParquetFileMetadataCache>(file_name);
+	if (!metadata) {
+		return nullptr;
+	}
+	auto &eviction = Get(context);
+	lock_guard<mutex> guard(eviction.lock);
+	auto entry = eviction.entries.find(file_name);
+	if (entry != eviction.entries.end()) {
+		eviction.lru.splice(eviction.lru.begin(), eviction.lru, entry->second.lru_position);
+	}
+	return metadata;
+}
+
+void ParquetMetadataCacheEviction::PutMetadata(ClientContext &context, const string &file_name,
+                                               shared_ptr<ParquetFileMetadataCache> metadata) {
+	auto &cache = ObjectCache::GetObjectCache(context);
+	auto size = metadata->footer_size;
+	cache.Put(file_name, std::move(metadata));
+
+	auto maximum_size = MaximumMetadataCacheSize(context);
+	auto &eviction = Get(context);
+	vector<string> evicted_files;
+	{
+		lock_guard<mutex> guard(eviction.lock);
+		auto entry = eviction.entries.find(file_name);
+		if (entry != eviction.entries.end()) {
+			eviction.total_size -= entry->second.size;
+			eviction.lru.erase(entry->second.lru_position);
+			eviction.entries.erase(entry);
+		}
+		eviction.lru.push_front(file_name);
+		eviction.entries[file_name] = CacheEntry {eviction.lru.begin(), size};
+		eviction.total_size += size;
+
+		// evict the least recently used files, but always keep the file that was just added
+		while (eviction.total_size > maximum_size && eviction.lru.size() > 1) {
+			auto &evicted_file = eviction.lru.back();
+			auto evicted_entry = eviction.entries.find(evicted_file);
+			D_ASSERT(evicted_entry != eviction.entries.end());
+			eviction.total_size -= evicted_entry->second.size;
+			eviction.entries.erase(evicted_entry);
+			evicted_files.push_back(std::move(evicted_file));
+			eviction.lru.pop_back();
+		}
+	}
+	for (auto &evicted_file : evicted_files) {
+		cache.Delete(evicted_file);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Disk Cache
+//===--------------------------------------------------------------------===//
+// Cache files consist of a header that identifies the cached file, followed by the footer:
+// "PQFC" | file size (8 bytes) | last modified time (8 bytes) | path length (4 bytes) | path | footer size (4 bytes)
+static constexpr const char *FOOTER_CACHE_MAGIC = "PQFC";
+static constexpr const idx_t FOOTER_CACHE_MAGIC_SIZE = 4;
+static constexpr const idx_t FOOTER_CACHE_FIXED_HEADER_SIZE = FOOTER_CACHE_MAGIC_SIZE + 2 * sizeof(uint64_t);
+// Files that were modified this recently might still be written to, so their footers are not cached
+static constexpr const int64_t FOOTER_CACHE_MINIMUM_AGE_SECONDS = 10;
+
+string ParquetFooterDiskCache::GetDirectory(ClientContext &context) {
+	Value setting;
+	if (!context.TryGetCurrentSetting("parquet_metadata_cache_directory", setting) || setting.IsNull()) {
+		return string();
+	}
+	return StringValue::Get(setting);
+}
+
+static string FooterCachePath(FileSystem &fs, const string &directory, const string &file_path) {
+	auto path_hash = Hash(file_path.c_str(), file_path.size());
+	return fs.JoinPath(directory, "parquet_footer_" + to_string(path_hash));
+}
+
+bool ParquetFooterDiskCache::TryRead(ClientContext &context, const string &directory, FileHandle &file_handle,
+                                     AllocatedData &footer, idx_t &footer_size) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto cache_handle = fs.OpenFile(FooterCachePath(fs, directory, file_handle.path),
+	                                FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+	if (!cache_handle) {
+		return false;
+	}
+	auto &file_path = file_handle.path;
+	auto cache_size = cache_handle->GetFileSize();
+	auto header_size = FOOTER_CACHE_FIXED_HEADER_SIZE + sizeof(uint32_t) + file_path.size() + sizeof(uint32_t);
+	if (cache_size <= header_size) {
+		return false;
+	}
+	auto &allocator = Allocator::Get(context);
+	auto header = allocator.Allocate(header_size);
+	cache_handle->Read(header.get(), header_size, 0);
+
+	auto ptr = header.get();
+	if (memcmp(ptr, FOOTER_CACHE_MAGIC, FOOTER_CACHE_MAGIC_SIZE) != 0) {
+		return false;
+	}
+	ptr += FOOTER_CACHE_MAGIC_SIZE;
+	auto file_size = Load<uint64_t>(ptr);
+	ptr += sizeof(uint64_t);
+	auto last_modified = Load<int64_t>(ptr);
+	ptr += sizeof(int64_t);
+	auto path_length = Load<uint32_t>(ptr);
+	ptr += sizeof(uint32_t);
+	if (path_length != file_path.size() || memcmp(ptr, file_path.c_str(), path_length) != 0) {
+		// a different file with the same hash
+		return false;
+	}
+	ptr += path_length;
+	footer_size = Load<uint32_t>(ptr);
+	if (header_size + footer_size != cache_size) {
+		return false;
+	}
+	// the footer is only valid if the file did not change since it was cached
+	if (file_size != file_handle.GetFileSize() ||
+	    last_modified != int64_t(fs.GetLastModifiedTime(file_handle))) {
+		return false;
+	}
+	footer = allocator.Allocate(footer_size);
+	cache_handle->Read(footer.get(), footer_size, header_size);
+	return true;
+}
+
+void ParquetFooterDiskCache::Write(ClientContext &context, const string &directory, FileHandle &file_handle,
+                                   const_data_ptr_t footer, idx_t footer_size) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto last_modified = int64_t(fs.GetLastModifiedTime(file_handle));
+	auto current_time = int64_t(std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()));
+	if (last_modified + FOOTER_CACHE_MINIMUM_AGE_SECONDS >= current_time) {
+		return;
+	}
+	auto &file_path = file_handle.path;
+	auto header_size = FOOTER_CACHE_FIXED_HEADER_SIZE + sizeof(uint32_t) + file_path.size() + sizeof(uint32_t);
+	auto header = Allocator::Get(context).Allocate(header_size);
+	auto ptr = header.get();
+	memcpy(ptr, FOOTER_CACHE_MAGIC, FOOTER_CACHE_MAGIC_SIZE);
+	ptr += FOOTER_CACHE_MAGIC_SIZE;
+	Store<uint64_t>(file_handle.GetFileSize(), ptr);
+	ptr += sizeof(uint64_t);
+	Store<int64_t>(last_modified, ptr);
+	ptr += sizeof(int64_t);
+	Store<uint32_t>(NumericCast<uint32_t>(file_path.size()), ptr);
+	ptr += sizeof(uint32_t);
+	memcpy(ptr, file_path.c_str(), file_path.size());
+	ptr += file_path.size();
+	Store<uint32_t>(NumericCast<uint32_t>(footer_size), ptr);
+
+	// the cache is best-effort: failing to write it does not fail the query
+	auto cache_path = FooterCachePath(fs, directory, file_path);
+	auto temp_path = cache_path + "." + UUID::ToString(UUID::GenerateRandomUUID()) + ".tmp";
+	try {
+		if (!fs.DirectoryExists(directory)) {
+			fs.CreateDirectory(directory);
+		}
+		{
+			auto cache_handle = fs.OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
+			cache_handle->Write(header.get(), header_size, 0);
+			cache_handle->Write(const_cast<data_ptr_t>(footer), footer_size, header_size);
+			cache_handle->Sync();
+		}
+		// move the complete file into place, so that concurrent readers never see a partially written file
+		fs.MoveFile(temp_path, cache_path);
+	} catch (std::exception &) {
+		try {
+			fs.RemoveFile(temp_path);
+		} catch (std::exception &) {
+		}
+	}
+}
+
+} // namespace duckdb
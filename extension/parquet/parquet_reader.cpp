@@ -8,6 +8,7 @@
 #include "expression_column_reader.hpp"
 #include "geo_parquet.hpp"
 #include "list_column_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_crypto.hpp"
 #include "parquet_file_metadata_cache.hpp"
 #include "parquet_statistics.hpp"
@@ -26,8 +27,11 @@
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/object_cache.hpp"
@@ -40,28 +44,57 @@
 
 namespace duckdb {
 
+using duckdb_parquet::format::BloomFilterHeader;
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileCryptoMetaData;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Statistics;
 using duckdb_parquet::format::Type;
 
 static unique_ptr<duckdb_apache::thrift::protocol::TProtocol>
-CreateThriftFileProtocol(Allocator &allocator, FileHandle &file_handle, bool prefetch_mode) {
-	auto transport = std::make_shared<ThriftFileTransport>(allocator, file_handle, prefetch_mode);
+CreateThriftFileProtocol(Allocator &allocator, FileHandle &file_handle, bool prefetch_mode,
+                         const ReadAheadOptions &read_ahead_options = ReadAheadOptions()) {
+	auto transport = std::make_shared<ThriftFileTransport>(allocator, file_handle, prefetch_mode, read_ahead_options);
 	return make_uniq<duckdb_apache::thrift::protocol::TCompactProtocolT<ThriftFileTransport>>(std::move(transport));
 }
 
+static unique_ptr<FileMetaData> DeserializeFooter(const_data_ptr_t footer, idx_t footer_size) {
+	auto transport = std::make_shared<duckdb_apache::thrift::transport::TMemoryBuffer>(
+	    const_cast<data_ptr_t>(footer), NumericCast<uint32_t>(footer_size));
+	duckdb_apache::thrift::protocol::TCompactProtocolT<duckdb_apache::thrift::transport::TMemoryBuffer> protocol(
+	    std::move(transport));
+	auto metadata = make_uniq<FileMetaData>();
+	metadata->read(&protocol);
+	return metadata;
+}
+
 static shared_ptr<ParquetFileMetadataCache>
 LoadMetadata(ClientContext &context, Allocator &allocator, FileHandle &file_handle,
              const shared_ptr<const ParquetEncryptionConfig> &encryption_config,
              const EncryptionUtil &encryption_util) {
 	auto current_time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
 
+	// the on-disk footer cache only holds unencrypted footers
+	auto cache_directory = encryption_config ? string() : ParquetFooterDiskCache::GetDirectory(context);
+	if (!cache_directory.empty()) {
+		AllocatedData cached_footer;
+		idx_t cached_footer_size;
+		if (ParquetFooterDiskCache::TryRead(context, cache_directory, file_handle, cached_footer, cached_footer_size)) {
+			auto metadata = DeserializeFooter(cached_footer.get(), cached_footer_size);
+			auto geo_metadata = GeoParquetFileMetadata::TryRead(*metadata, context);
+			auto result =
+			    make_shared_ptr<ParquetFileMetadataCache>(std::move(metadata), current_time, std::move(geo_metadata));
+			result->footer_size = cached_footer_size;
+			return result;
+		}
+	}
+
 	auto file_proto = CreateThriftFileProtocol(allocator, file_handle, false);
 	auto &transport = reinterpret_cast<ThriftFileTransport &>(*file_proto->getTransport());
 	auto file_size = transport.GetSize();
@@ -113,13 +146,21 @@ LoadMetadata(ClientContext &context, Allocator &allocator, FileHandle &file_hand
 		}
 		ParquetCrypto::Read(*metadata, *file_proto, encryption_config->GetFooterKey(), encryption_util);
 	} else {
-		metadata->read(file_proto.get());
+		// read the (already prefetched) footer as a whole, so that it can be written to the footer cache as-is
+		auto footer = allocator.Allocate(footer_len);
+		transport.read(footer.get(), footer_len);
+		metadata = DeserializeFooter(footer.get(), footer_len);
+		if (!cache_directory.empty()) {
+			ParquetFooterDiskCache::Write(context, cache_directory, file_handle, footer.get(), footer_len);
+		}
 	}
 
 	// Try to read the GeoParquet metadata (if present)
 	auto geo_metadata = GeoParquetFileMetadata::TryRead(*metadata, context);
 
-	return make_shared_ptr<ParquetFileMetadataCache>(std::move(metadata), current_time, std::move(geo_metadata));
+	auto result = make_shared_ptr<ParquetFileMetadataCache>(std::move(metadata), current_time, std::move(geo_metadata));
+	result->footer_size = footer_len;
+	return result;
 }
 
 LogicalType ParquetReader::DeriveLogicalType(const SchemaElement &s_ele, bool binary_as_string) {
@@ -440,6 +481,10 @@ unique_ptr<ColumnReader> ParquetReader::CreateReader(ClientContext &context) {
 	D_ASSERT(file_meta_data->row_groups.empty() || next_file_idx == file_meta_data->row_groups[0].columns.size());
 
 	auto &root_struct_reader = ret->Cast<StructColumnReader>();
+	// top-level columns can emit dictionary vectors for dictionary-encoded pages
+	for (auto &child_reader : root_struct_reader.child_readers) {
+		child_reader->EnableDictionaryOutput();
+	}
 	// add casts if required
 	for (auto &entry : reader_data.cast_map) {
 		auto column_idx = entry.first;
@@ -547,11 +592,11 @@ ParquetReader::ParquetReader(ClientContext &context_p, string file_name_p, Parqu
 			    LoadMetadata(context_p, allocator, *file_handle, parquet_options.encryption_config, *encryption_util);
 		} else {
 			auto last_modify_time = fs.GetLastModifiedTime(*file_handle);
-			metadata = ObjectCache::GetObjectCache(context_p).Get<ParquetFileMetadataCache>(file_name);
+			metadata = ParquetMetadataCacheEviction::GetMetadata(context_p, file_name);
 			if (!metadata || (last_modify_time + 10 >= metadata->read_time)) {
 				metadata = LoadMetadata(context_p, allocator, *file_handle, parquet_options.encryption_config,
 				                        *encryption_util);
-				ObjectCache::GetObjectCache(context_p).Put(file_name, metadata);
+				ParquetMetadataCacheEviction::PutMetadata(context_p, file_name, metadata);
 			}
 		}
 	} else {
@@ -712,11 +757,50 @@ static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, con
 		return StringStats::CheckZonemap(const_data_ptr_cast(min_value.c_str()), min_value.size(),
 		                                 const_data_ptr_cast(max_value.c_str()), max_value.size(),
 		                                 constant_filter.comparison_type, StringValue::Get(constant_filter.constant));
+	} else if (filter.filter_type == TableFilterType::IN_FILTER) {
+		auto &in_filter = filter.Cast<InFilter>();
+		auto &min_value = pq_col_stats.min_value;
+		auto &max_value = pq_col_stats.max_value;
+		for (auto &value : in_filter.values) {
+			auto prune_result = StringStats::CheckZonemap(const_data_ptr_cast(min_value.c_str()), min_value.size(),
+			                                              const_data_ptr_cast(max_value.c_str()), max_value.size(),
+			                                              ExpressionType::COMPARE_EQUAL, StringValue::Get(value));
+			if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
 	} else {
 		return filter.CheckStatistics(stats);
 	}
 }
 
+static FilterPropagateResult CheckParquetFilter(const ColumnReader &column_reader, BaseStatistics &stats,
+                                                const Statistics &pq_col_stats, TableFilter &filter) {
+	if (column_reader.Type().id() == LogicalTypeId::VARCHAR && pq_col_stats.__isset.min_value &&
+	    pq_col_stats.__isset.max_value) {
+		// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
+		// however, when reading remote Parquet files, skipping row groups is really important
+		// here, we implement a special case to check the full length for string filters
+		if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
+			const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+			auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
+			for (auto &child_filter : and_filter.child_filters) {
+				auto child_prune_result = CheckParquetStringFilter(stats, pq_col_stats, *child_filter);
+				if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+					and_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
+					break;
+				} else if (child_prune_result != and_result) {
+					and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+				}
+			}
+			return and_result;
+		}
+		return CheckParquetStringFilter(stats, pq_col_stats, filter);
+	}
+	return filter.CheckStatistics(stats);
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx) {
 	auto &group = GetGroup(state);
 	auto column_id = reader_data.column_ids[col_idx];
@@ -729,46 +813,28 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 		auto global_id = reader_data.column_mapping[col_idx];
 		auto filter_entry = reader_data.filters->filters.find(global_id);
 		if (stats && filter_entry != reader_data.filters->filters.end()) {
-			bool skip_chunk = false;
 			auto &filter = *filter_entry->second;
-
-			FilterPropagateResult prune_result;
-			if (column_reader->Type().id() == LogicalTypeId::VARCHAR &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.min_value &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.max_value) {
-				// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
-				// however, when reading remote Parquet files, skipping row groups is really important
-				// here, we implement a special case to check the full length for string filters
-				if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
-					const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
-					auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
-					for (auto &child_filter : and_filter.child_filters) {
-						auto child_prune_result = CheckParquetStringFilter(
-						    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, *child_filter);
-						if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-							and_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
-							break;
-						} else if (child_prune_result != and_result) {
-							and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
-						}
-					}
-					prune_result = and_result;
-				} else {
-					prune_result = CheckParquetStringFilter(
-					    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, filter);
-				}
+			auto prune_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			if (column_reader->FileIdx() < group.columns.size()) {
+				auto &column_chunk = group.columns[column_reader->FileIdx()];
+				prune_result = CheckParquetFilter(*column_reader, *stats, column_chunk.meta_data.statistics, filter);
 			} else {
 				prune_result = filter.CheckStatistics(*stats);
 			}
 
-			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-				skip_chunk = true;
+			if (prune_result == FilterPropagateResult::NO_PRUNING_POSSIBLE &&
+			    BloomFilterExcludes(state, *column_reader, filter)) {
+				prune_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
 			}
-			if (skip_chunk) {
+
+			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 				// this effectively will skip this chunk
 				state.group_offset = group.num_rows;
 				return;
 			}
+			if (prune_result != FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+				PrunePages(state, *column_reader, filter);
+			}
 		}
 	}
 
@@ -776,6 +842,224 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+void ParquetReader::PrunePages(ParquetReaderScanState &state, const ColumnReader &column_reader, TableFilter &filter) {
+	auto &group = GetGroup(state);
+	if (parquet_options.encryption_config || column_reader.FileIdx() >= group.columns.size() ||
+	    column_reader.MaxRepeat() > 0 || column_reader.Type().IsNested()) {
+		return;
+	}
+	auto &column_chunk = group.columns[column_reader.FileIdx()];
+	if (!column_chunk.__isset.column_index_offset || !column_chunk.__isset.offset_index_offset) {
+		// the file has no page index for this column chunk
+		return;
+	}
+	// read the page index of the column chunk
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	ColumnIndex column_index;
+	OffsetIndex offset_index;
+	trans.SetLocation(NumericCast<idx_t>(column_chunk.column_index_offset));
+	Read(column_index, *state.thrift_file_proto);
+	trans.SetLocation(NumericCast<idx_t>(column_chunk.offset_index_offset));
+	Read(offset_index, *state.thrift_file_proto);
+
+	auto &page_locations = offset_index.page_locations;
+	auto page_count = page_locations.size();
+	if (column_index.null_pages.size() != page_count || column_index.min_values.size() != page_count ||
+	    column_index.max_values.size() != page_count) {
+		throw InvalidInputException("Malformed parquet file: the page index of column \"%s\" is inconsistent",
+		                            column_reader.Schema().name);
+	}
+	for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+		auto page_stats = ParquetStatisticsUtils::TransformPageStatistics(column_reader, column_index, page_idx);
+		if (!page_stats) {
+			continue;
+		}
+		auto prune_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		if (column_index.null_pages[page_idx]) {
+			prune_result = filter.CheckStatistics(*page_stats);
+		} else {
+			auto pq_page_stats = ParquetStatisticsUtils::GetPageStatistics(column_index, page_idx);
+			prune_result = CheckParquetFilter(column_reader, *page_stats, pq_page_stats, filter);
+		}
+		if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			continue;
+		}
+		// no row in this page can pass the filter: all columns skip the rows of this page
+		auto page_start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+		auto page_end = page_idx + 1 < page_count ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+		                                          : NumericCast<idx_t>(group.num_rows);
+		state.skipped_ranges.emplace_back(page_start, page_end);
+	}
+}
+
+//! Computes the hash of a filter constant as it is stored in the Bloom filter of a column, i.e., the hash of its PLAIN
+//! encoding. Returns false if the Bloom filter cannot be used for the constant
+static bool GetBloomFilterHash(const ColumnReader &column_reader, const Value &constant, uint64_t &hash) {
+	if (constant.IsNull() || constant.type() != column_reader.Type()) {
+		return false;
+	}
+	// only types that are stored as-is are supported: e.g., the unit of a stored timestamp can differ from ours
+	switch (column_reader.Schema().type) {
+	case Type::INT32:
+		switch (constant.type().id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+			hash = ParquetBloomFilter::Hash(constant.GetValue<int32_t>());
+			return true;
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+			hash = ParquetBloomFilter::Hash(constant.GetValue<uint32_t>());
+			return true;
+		case LogicalTypeId::DATE:
+			hash = ParquetBloomFilter::Hash(constant.GetValue<date_t>().days);
+			return true;
+		default:
+			return false;
+		}
+	case Type::INT64:
+		switch (constant.type().id()) {
+		case LogicalTypeId::BIGINT:
+			hash = ParquetBloomFilter::Hash(constant.GetValue<int64_t>());
+			return true;
+		case LogicalTypeId::UBIGINT:
+			hash = ParquetBloomFilter::Hash(constant.GetValue<uint64_t>());
+			return true;
+		default:
+			return false;
+		}
+	case Type::BYTE_ARRAY:
+		switch (constant.type().id()) {
+		case LogicalTypeId::VARCHAR:
+		case LogicalTypeId::BLOB: {
+			auto &str = StringValue::Get(constant);
+			hash = ParquetBloomFilter::Hash(const_data_ptr_cast(str.c_str()), str.size());
+			return true;
+		}
+		default:
+			return false;
+		}
+	default:
+		// floating point values are not supported, as e.g. 0.0 and -0.0 compare equal but hash differently
+		return false;
+	}
+}
+
+//! Whether or not the filter contains an equality or IN filter that can be checked against a Bloom filter
+static bool BloomFilterSupported(const ColumnReader &column_reader, const TableFilter &filter) {
+	uint64_t hash;
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		return constant_filter.comparison_type == ExpressionType::COMPARE_EQUAL &&
+		       GetBloomFilterHash(column_reader, constant_filter.constant, hash);
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		for (auto &value : in_filter.values) {
+			if (!GetBloomFilterHash(column_reader, value, hash)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (BloomFilterSupported(column_reader, *child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+static bool BloomFilterExcludesFilter(const ColumnReader &column_reader, const ParquetBloomFilter &bloom_filter,
+                                      const TableFilter &filter) {
+	uint64_t hash;
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		return constant_filter.comparison_type == ExpressionType::COMPARE_EQUAL &&
+		       GetBloomFilterHash(column_reader, constant_filter.constant, hash) && !bloom_filter.FilterCheck(hash);
+	}
+	case TableFilterType::IN_FILTER: {
+		// none of the values can be present
+		auto &in_filter = filter.Cast<InFilter>();
+		for (auto &value : in_filter.values) {
+			if (!GetBloomFilterHash(column_reader, value, hash) || bloom_filter.FilterCheck(hash)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (BloomFilterExcludesFilter(column_reader, bloom_filter, *child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ParquetReader::BloomFilterExcludes(ParquetReaderScanState &state, const ColumnReader &column_reader,
+                                        TableFilter &filter) {
+	auto &group = GetGroup(state);
+	if (parquet_options.encryption_config || column_reader.FileIdx() >= group.columns.size() ||
+	    column_reader.MaxRepeat() > 0) {
+		return false;
+	}
+	auto &meta_data = group.columns[column_reader.FileIdx()].meta_data;
+	if (!meta_data.__isset.bloom_filter_offset || !BloomFilterSupported(column_reader, filter)) {
+		return false;
+	}
+	// read the Bloom filter of the column chunk
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	trans.SetLocation(NumericCast<idx_t>(meta_data.bloom_filter_offset));
+	BloomFilterHeader header;
+	Read(header, *state.thrift_file_proto);
+	if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED) {
+		// we only know split block Bloom filters that are hashed with XXH64 and are not compressed
+		return false;
+	}
+	if (header.numBytes <= 0 || header.numBytes % ParquetBloomFilter::BLOCK_SIZE != 0) {
+		throw InvalidInputException("Malformed parquet file: the Bloom filter of column \"%s\" has an invalid size",
+		                            column_reader.Schema().name);
+	}
+	auto num_bytes = NumericCast<idx_t>(header.numBytes);
+	auto data = allocator.Allocate(num_bytes);
+	ReadData(*state.thrift_file_proto, data.get(), NumericCast<uint32_t>(num_bytes));
+	ParquetBloomFilter bloom_filter(std::move(data), num_bytes);
+	return BloomFilterExcludesFilter(column_reader, bloom_filter, filter);
+}
+
+//! Sorts the skipped row ranges and merges the ones that overlap or touch
+static void MergeSkippedRanges(vector<pair<idx_t, idx_t>> &ranges) {
+	if (ranges.empty()) {
+		return;
+	}
+	std::sort(ranges.begin(), ranges.end());
+	idx_t merged_count = 0;
+	for (idx_t i = 1; i < ranges.size(); i++) {
+		auto &last = ranges[merged_count];
+		if (ranges[i].first <= last.second) {
+			last.second = MaxValue<idx_t>(last.second, ranges[i].second);
+		} else {
+			ranges[++merged_count] = ranges[i];
+		}
+	}
+	ranges.resize(merged_count + 1);
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -784,9 +1068,38 @@ idx_t ParquetReader::NumRowGroups() {
 	return GetFileMetadata()->row_groups.size();
 }
 
+vector<pair<idx_t, idx_t>> ParquetReader::GetRowGroupScanRanges(idx_t group_idx) {
+	auto &group = GetFileMetadata()->row_groups[group_idx];
+	auto group_rows = NumericCast<idx_t>(group.num_rows);
+	vector<pair<idx_t, idx_t>> result;
+	// splitting the row groups of remote files would fetch (or prefetch) the same row group several times
+	bool can_split = group_rows > ROW_GROUP_SCAN_RANGE_SIZE && file_handle->OnDiskFile();
+	for (auto &column_chunk : group.columns) {
+		// without the OffsetIndex, the pages in front of a range would have to be decoded to skip them
+		can_split = can_split && column_chunk.__isset.offset_index_offset;
+	}
+	if (!can_split) {
+		result.emplace_back(0, group_rows);
+		return result;
+	}
+	for (idx_t range_start = 0; range_start < group_rows; range_start += ROW_GROUP_SCAN_RANGE_SIZE) {
+		result.emplace_back(range_start, MinValue<idx_t>(range_start + ROW_GROUP_SCAN_RANGE_SIZE, group_rows));
+	}
+	return result;
+}
+
+void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanState &state, idx_t group_idx,
+                                   pair<idx_t, idx_t> row_range) {
+	vector<idx_t> group_indexes {group_idx};
+	InitializeScan(context, state, std::move(group_indexes));
+	state.scan_row_range = true;
+	state.row_range = row_range;
+}
+
 void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanState &state,
                                    vector<idx_t> groups_to_read) {
 	state.current_group = -1;
+	state.scan_row_range = false;
 	state.finished = false;
 	state.group_offset = 0;
 	state.group_idx_list = std::move(groups_to_read);
@@ -804,7 +1117,19 @@ void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanStat
 		state.file_handle = fs.OpenFile(file_handle->path, flags);
 	}
 
-	state.thrift_file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode);
+	ReadAheadOptions read_ahead_options;
+	Value setting;
+	if (context.TryGetCurrentSetting("parquet_prefetch_merge_gap", setting) && !setting.IsNull()) {
+		read_ahead_options.merge_gap = UBigIntValue::Get(setting);
+	}
+	if (context.TryGetCurrentSetting("parquet_prefetch_max_merged_size", setting) && !setting.IsNull()) {
+		read_ahead_options.max_merged_size = UBigIntValue::Get(setting);
+	}
+	if (context.TryGetCurrentSetting("parquet_prefetch_max_size", setting) && !setting.IsNull()) {
+		read_ahead_options.max_prefetch_size = UBigIntValue::Get(setting);
+	}
+	state.thrift_file_proto =
+	    CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode, read_ahead_options);
 	state.root_reader = CreateReader(context);
 	state.define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
 	state.repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
@@ -940,6 +1265,45 @@ static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &
 	}
 }
 
+static void FilterBloom(Vector &v, const BloomFilter &bloom_filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (filter_mask.none() || count == 0) {
+		return;
+	}
+	// gather the rows that are still qualifying and probe them against the Bloom filter in one go
+	SelectionVector sel(count);
+	idx_t sel_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(sel_count++, i);
+		}
+	}
+	auto result_count = bloom_filter.Filter(v, sel, sel_count);
+	filter_mask.reset();
+	for (idx_t i = 0; i < result_count; i++) {
+		filter_mask.set(sel.get_index(i));
+	}
+}
+
+static void FilterIn(Vector &v, const InFilter &in_filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (filter_mask.none() || count == 0) {
+		return;
+	}
+	SelectionVector sel(count);
+	idx_t sel_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(sel_count++, i);
+		}
+	}
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+	auto result_count = in_filter.Filter(vdata, v.GetType().InternalType(), sel, sel_count);
+	filter_mask.reset();
+	for (idx_t i = 0; i < result_count; i++) {
+		filter_mask.set(sel.get_index(i));
+	}
+}
+
 static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_AND: {
@@ -994,12 +1358,94 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::BLOOM_FILTER:
+		FilterBloom(v, filter.Cast<BloomFilter>(), filter_mask, count);
+		break;
+	case TableFilterType::IN_FILTER:
+		FilterIn(v, filter.Cast<InFilter>(), filter_mask, count);
+		break;
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		if (!dynamic_filter.filter_data) {
+			break;
+		}
+		lock_guard<mutex> guard(dynamic_filter.filter_data->lock);
+		if (dynamic_filter.filter_data->initialized) {
+			ApplyFilter(v, *dynamic_filter.filter_data->filter, filter_mask, count);
+		}
+		break;
+	}
 	default:
 		D_ASSERT(0);
 		break;
 	}
 }
 
+static bool FilterIsCacheable(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!FilterIsCacheable(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!FilterIsCacheable(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IS_NULL:
+	case TableFilterType::IS_NOT_NULL:
+	case TableFilterType::IN_FILTER:
+		return true;
+	default:
+		// dynamic filters and join Bloom filters can change while scanning
+		return false;
+	}
+}
+
+static void ApplyDictionaryFilter(ColumnReader &column_reader, Vector &v, TableFilter &filter,
+                                  parquet_filter_t &filter_mask, idx_t count) {
+	D_ASSERT(v.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+	if (!FilterIsCacheable(filter)) {
+		v.Flatten(count);
+		ApplyFilter(v, filter, filter_mask, count);
+		return;
+	}
+	auto matches = column_reader.GetDictionaryFilterMatches(filter);
+	if (!matches) {
+		// evaluate the filter once for every entry of the dictionary, and reuse the result for the column chunk
+		auto &dictionary = DictionaryVector::Child(v);
+		auto dictionary_count = column_reader.DictionarySize() + 1;
+		auto dictionary_matches = column_reader.InitializeDictionaryFilterMatches(filter);
+		for (idx_t offset = 0; offset < dictionary_count; offset += STANDARD_VECTOR_SIZE) {
+			auto end = MinValue<idx_t>(offset + STANDARD_VECTOR_SIZE, dictionary_count);
+			Vector entries(dictionary, offset, end);
+			parquet_filter_t entries_mask;
+			entries_mask.set();
+			ApplyFilter(entries, filter, entries_mask, end - offset);
+			for (idx_t i = 0; i < end - offset; i++) {
+				dictionary_matches[offset + i] = entries_mask.test(i);
+			}
+		}
+		matches = dictionary_matches;
+	}
+	auto &sel = DictionaryVector::SelVector(v);
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			filter_mask.set(i, matches[sel.get_index(i)]);
+		}
+	}
+}
+
 void ParquetReader::Scan(ParquetReaderScanState &state, DataChunk &result) {
 	while (ScanInternal(state, result)) {
 		if (result.size() > 0) {
@@ -1028,6 +1474,8 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			return false;
 		}
 
+		state.skipped_ranges.clear();
+		state.skipped_range_idx = 0;
 		uint64_t to_scan_compressed_bytes = 0;
 		for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
 			PrepareRowGroupBuffer(state, col_idx);
@@ -1037,8 +1485,18 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
-
 		auto &group = GetGroup(state);
+		if (state.scan_row_range) {
+			// the rows outside of the range are scanned by others
+			if (state.row_range.first > 0) {
+				state.skipped_ranges.emplace_back(0, state.row_range.first);
+			}
+			if (state.row_range.second < NumericCast<idx_t>(group.num_rows)) {
+				state.skipped_ranges.emplace_back(state.row_range.second, NumericCast<idx_t>(group.num_rows));
+			}
+		}
+		MergeSkippedRanges(state.skipped_ranges);
+
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
 
 			uint64_t total_row_group_span = GetGroupSpan(state);
@@ -1088,7 +1546,30 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
-	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
+	auto group_rows = NumericCast<idx_t>(GetGroup(state).num_rows);
+	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, group_rows - state.group_offset);
+	// skip over (or stop in front of) the row ranges that were excluded by the page index
+	auto &skipped_ranges = state.skipped_ranges;
+	while (state.skipped_range_idx < skipped_ranges.size() &&
+	       skipped_ranges[state.skipped_range_idx].second <= state.group_offset) {
+		state.skipped_range_idx++;
+	}
+	if (state.skipped_range_idx < skipped_ranges.size()) {
+		auto &skipped_range = skipped_ranges[state.skipped_range_idx];
+		if (skipped_range.first <= state.group_offset) {
+			if (skipped_range.second < group_rows) {
+				auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+				auto skip_count = skipped_range.second - state.group_offset;
+				for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+					root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_count);
+				}
+			}
+			state.group_offset = skipped_range.second;
+			result.SetCardinality(0);
+			return true;
+		}
+		this_output_chunk_rows = MinValue<idx_t>(this_output_chunk_rows, skipped_range.first - state.group_offset);
+	}
 	result.SetCardinality(this_output_chunk_rows);
 
 	if (this_output_chunk_rows == 0) {
@@ -1139,7 +1620,12 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 				child_reader->Read(result.size(), filter_mask, define_ptr, repeat_ptr, result_vector);
 				need_to_read[id] = false;
 
-				ApplyFilter(result_vector, *filter_col.second, filter_mask, this_output_chunk_rows);
+				if (result_vector.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+					ApplyDictionaryFilter(*child_reader, result_vector, *filter_col.second, filter_mask,
+					                      this_output_chunk_rows);
+				} else {
+					ApplyFilter(result_vector, *filter_col.second, filter_mask, this_output_chunk_rows);
+				}
 			}
 		}
 
@@ -320,8 +320,37 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
+	return TransformStatistics(reader, column_chunk.meta_data.statistics);
+}
+
+duckdb_parquet::format::Statistics ParquetStatisticsUtils::GetPageStatistics(const ColumnIndex &column_index,
+                                                                             idx_t page_idx) {
+	duckdb_parquet::format::Statistics page_stats;
+	page_stats.__set_min_value(column_index.min_values[page_idx]);
+	page_stats.__set_max_value(column_index.max_values[page_idx]);
+	if (column_index.__isset.null_counts && page_idx < column_index.null_counts.size()) {
+		page_stats.__set_null_count(column_index.null_counts[page_idx]);
+	}
+	return page_stats;
+}
 
+unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformPageStatistics(const ColumnReader &reader,
+                                                                           const ColumnIndex &column_index,
+                                                                           idx_t page_idx) {
+	if (column_index.null_pages[page_idx]) {
+		// the page only contains NULL values
+		auto page_stats = BaseStatistics::CreateEmpty(reader.Type());
+		page_stats.Set(StatsInfo::CAN_HAVE_NULL_VALUES);
+		page_stats.Set(StatsInfo::CANNOT_HAVE_VALID_VALUES);
+		return page_stats.ToUnique();
+	}
+	return TransformStatistics(reader, GetPageStatistics(column_index, page_idx));
+}
+
+unique_ptr<BaseStatistics>
+ParquetStatisticsUtils::TransformStatistics(const ColumnReader &reader,
+                                            const duckdb_parquet::format::Statistics &parquet_stats) {
+	unique_ptr<BaseStatistics> row_group_stats;
 	auto &type = reader.Type();
 	auto &s_ele = reader.Schema();
 
@@ -12,9 +12,12 @@
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/write_stream.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/core_functions/create_sort_key.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/create_copy_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #endif
@@ -319,11 +322,31 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
                              const vector<pair<string, string>> &kv_metadata,
                              shared_ptr<ParquetEncryptionConfig> encryption_config_p,
                              double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p,
-                             bool debug_use_openssl_p)
-    : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
-      field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
+                             bool debug_use_openssl_p, bool write_page_index_p,
+                             const vector<string> &bloom_filter_columns_p,
+                             double bloom_filter_false_positive_ratio_p,
+                             const vector<string> &row_group_sort_columns_p, idx_t page_size_compressed_p)
+    : context(context), file_name(std::move(file_name_p)), sql_types(std::move(types_p)),
+      column_names(std::move(names_p)), codec(codec), field_ids(std::move(field_ids_p)),
+      encryption_config(std::move(encryption_config_p)),
       dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p),
-      debug_use_openssl(debug_use_openssl_p) {
+      debug_use_openssl(debug_use_openssl_p), write_page_index(write_page_index_p && !encryption_config),
+      bloom_filter_false_positive_ratio(bloom_filter_false_positive_ratio_p),
+      page_size_compressed(page_size_compressed_p), row_groups_in_memory_size(0), row_groups_compressed_size(0) {
+	if (!encryption_config) {
+		// Bloom filters would have to be encrypted as well - we only write them for unencrypted files
+		bloom_filter_columns.insert(bloom_filter_columns_p.begin(), bloom_filter_columns_p.end());
+	}
+	for (auto &sort_column : row_group_sort_columns_p) {
+		for (idx_t col_idx = 0; col_idx < column_names.size(); col_idx++) {
+			if (StringUtil::CIEquals(column_names[col_idx], sort_column)) {
+				row_group_sort_columns.push_back(col_idx);
+				break;
+			}
+		}
+	}
+	filter_columns.insert(bloom_filter_columns.begin(), bloom_filter_columns.end());
+	filter_columns.insert(row_group_sort_columns_p.begin(), row_group_sort_columns_p.end());
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -392,74 +415,120 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
 	}
 }
 
-void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result) {
-	// We write 8 columns at a time so that iterating over ColumnDataCollection is more efficient
-	static constexpr idx_t COLUMNS_PER_PASS = 8;
+class ParquetPrepareColumnsTask : public BaseExecutorTask {
+public:
+	ParquetPrepareColumnsTask(TaskExecutor &executor, ParquetWriter &writer, ColumnDataCollection &buffer,
+	                          vector<unique_ptr<ColumnWriterState>> &states, idx_t col_idx, idx_t count)
+	    : BaseExecutorTask(executor), writer(writer), buffer(buffer), states(states), col_idx(col_idx), count(count) {
+	}
 
+	void ExecuteTask() override {
+		writer.PrepareColumns(buffer, states, col_idx, count);
+	}
+
+private:
+	ParquetWriter &writer;
+	ColumnDataCollection &buffer;
+	vector<unique_ptr<ColumnWriterState>> &states;
+	idx_t col_idx;
+	idx_t count;
+};
+
+void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result) {
 	// We want these to be in-memory/hybrid so we don't have to copy over strings to the dictionary
 	D_ASSERT(buffer.GetAllocatorType() == ColumnDataAllocatorType::IN_MEMORY_ALLOCATOR ||
 	         buffer.GetAllocatorType() == ColumnDataAllocatorType::HYBRID);
 
+	// sorting the rows of the row group tightens the statistics of the sort columns
+	unique_ptr<ColumnDataCollection> sorted_buffer;
+	if (!row_group_sort_columns.empty() && buffer.Count() > 0) {
+		sorted_buffer = SortRowGroup(buffer);
+	}
+	auto &row_group_buffer = sorted_buffer ? *sorted_buffer : buffer;
+	PrepareRowGroupInternal(row_group_buffer, result);
+}
+
+void ParquetWriter::PrepareRowGroupInternal(ColumnDataCollection &buffer, PreparedRowGroup &result) {
+	// We write 8 columns at a time so that iterating over ColumnDataCollection is more efficient
+	static constexpr idx_t COLUMNS_PER_PASS = 8;
+
 	// set up a new row group for this chunk collection
 	auto &row_group = result.row_group;
 	row_group.num_rows = NumericCast<int64_t>(buffer.Count());
 	row_group.total_byte_size = NumericCast<int64_t>(buffer.SizeInBytes());
 	row_group.__isset.file_offset = true;
 
+	// the column chunks are registered to the row group up front, so that the columns can be prepared in parallel
 	auto &states = result.states;
-	// iterate over each of the columns of the chunk collection and write them
 	D_ASSERT(buffer.ColumnCount() == column_writers.size());
-	for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx += COLUMNS_PER_PASS) {
-		const auto next = MinValue<idx_t>(buffer.ColumnCount() - col_idx, COLUMNS_PER_PASS);
-		vector<column_t> column_ids;
-		vector<reference<ColumnWriter>> col_writers;
-		vector<unique_ptr<ColumnWriterState>> write_states;
-		for (idx_t i = 0; i < next; i++) {
-			column_ids.emplace_back(col_idx + i);
-			col_writers.emplace_back(*column_writers[column_ids.back()]);
-			write_states.emplace_back(col_writers.back().get().InitializeWriteState(row_group));
-		}
+	for (auto &column_writer : column_writers) {
+		states.push_back(column_writer->InitializeWriteState(row_group));
+	}
 
-		for (auto &chunk : buffer.Chunks({column_ids})) {
-			for (idx_t i = 0; i < next; i++) {
-				if (col_writers[i].get().HasAnalyze()) {
-					col_writers[i].get().Analyze(*write_states[i], nullptr, chunk.data[i], chunk.size());
-				}
-			}
+	// iterate over each of the columns of the chunk collection and write them
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	if (buffer.ColumnCount() <= COLUMNS_PER_PASS || scheduler.NumberOfThreads() <= 1) {
+		for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx += COLUMNS_PER_PASS) {
+			PrepareColumns(buffer, states, col_idx, MinValue<idx_t>(buffer.ColumnCount() - col_idx, COLUMNS_PER_PASS));
 		}
+	} else {
+		// wide row groups: every pass encodes and compresses its columns in a separate task
+		TaskExecutor executor(scheduler);
+		for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx += COLUMNS_PER_PASS) {
+			auto count = MinValue<idx_t>(buffer.ColumnCount() - col_idx, COLUMNS_PER_PASS);
+			executor.ScheduleTask(
+			    make_uniq<ParquetPrepareColumnsTask>(executor, *this, buffer, states, col_idx, count));
+		}
+		executor.WorkOnTasks();
+	}
+	result.heaps = buffer.GetHeapReferences();
+}
 
-		for (idx_t i = 0; i < next; i++) {
+void ParquetWriter::PrepareColumns(ColumnDataCollection &buffer, vector<unique_ptr<ColumnWriterState>> &states,
+                                   idx_t col_idx, idx_t count) {
+	vector<column_t> column_ids;
+	vector<reference<ColumnWriter>> col_writers;
+	vector<reference<ColumnWriterState>> write_states;
+	for (idx_t i = 0; i < count; i++) {
+		column_ids.emplace_back(col_idx + i);
+		col_writers.emplace_back(*column_writers[column_ids.back()]);
+		write_states.emplace_back(*states[column_ids.back()]);
+	}
+
+	for (auto &chunk : buffer.Chunks({column_ids})) {
+		for (idx_t i = 0; i < count; i++) {
 			if (col_writers[i].get().HasAnalyze()) {
-				col_writers[i].get().FinalizeAnalyze(*write_states[i]);
+				col_writers[i].get().Analyze(write_states[i], nullptr, chunk.data[i], chunk.size());
 			}
 		}
+	}
 
-		// Reserving these once at the start really pays off
-		for (auto &write_state : write_states) {
-			write_state->definition_levels.reserve(buffer.Count());
+	for (idx_t i = 0; i < count; i++) {
+		if (col_writers[i].get().HasAnalyze()) {
+			col_writers[i].get().FinalizeAnalyze(write_states[i]);
 		}
+	}
 
-		for (auto &chunk : buffer.Chunks({column_ids})) {
-			for (idx_t i = 0; i < next; i++) {
-				col_writers[i].get().Prepare(*write_states[i], nullptr, chunk.data[i], chunk.size());
-			}
-		}
+	// Reserving these once at the start really pays off
+	for (auto &write_state : write_states) {
+		write_state.get().definition_levels.reserve(buffer.Count());
+	}
 
-		for (idx_t i = 0; i < next; i++) {
-			col_writers[i].get().BeginWrite(*write_states[i]);
+	for (auto &chunk : buffer.Chunks({column_ids})) {
+		for (idx_t i = 0; i < count; i++) {
+			col_writers[i].get().Prepare(write_states[i], nullptr, chunk.data[i], chunk.size());
 		}
+	}
 
-		for (auto &chunk : buffer.Chunks({column_ids})) {
-			for (idx_t i = 0; i < next; i++) {
-				col_writers[i].get().Write(*write_states[i], chunk.data[i], chunk.size());
-			}
-		}
+	for (idx_t i = 0; i < count; i++) {
+		col_writers[i].get().BeginWrite(write_states[i]);
+	}
 
-		for (auto &write_state : write_states) {
-			states.push_back(std::move(write_state));
+	for (auto &chunk : buffer.Chunks({column_ids})) {
+		for (idx_t i = 0; i < count; i++) {
+			col_writers[i].get().Write(write_states[i], chunk.data[i], chunk.size());
 		}
 	}
-	result.heaps = buffer.GetHeapReferences();
 }
 
 // Validation code adapted from Impala
@@ -511,9 +580,14 @@ void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
 		auto write_state = std::move(states[col_idx]);
 		col_writer->FinalizeWrite(*write_state);
 	}
+	WriteBloomFilters(row_group);
 	// let's make sure all offsets are ay-okay
 	ValidateColumnOffsets(file_name, writer->GetTotalWritten(), row_group);
 
+	// keep track of the compression ratio, which is used to estimate the compressed size of the next row groups
+	row_groups_in_memory_size += NumericCast<idx_t>(row_group.total_byte_size);
+	row_groups_compressed_size += writer->GetTotalWritten() - NumericCast<idx_t>(row_group.file_offset);
+
 	// append the row group to the file meta data
 	file_meta_data.row_groups.push_back(row_group);
 	file_meta_data.num_rows += row_group.num_rows;
@@ -521,6 +595,140 @@ void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
 	prepared.heaps.clear();
 }
 
+void ParquetWriter::AddPageIndex(ParquetColumnPageIndex page_index) {
+	// this is called while flushing the row group, i.e., while holding the lock
+	page_index.row_group_idx = file_meta_data.row_groups.size();
+	page_indexes.push_back(std::move(page_index));
+}
+
+bool ParquetWriter::WriteBloomFilter(const vector<string> &schema_path) const {
+	// Bloom filters are only written for top-level columns
+	return schema_path.size() == 1 && bloom_filter_columns.find(schema_path[0]) != bloom_filter_columns.end();
+}
+
+void ParquetWriter::AddBloomFilter(ParquetColumnBloomFilter bloom_filter) {
+	// this is called while flushing the row group, i.e., while holding the lock
+	bloom_filters.push_back(std::move(bloom_filter));
+}
+
+idx_t ParquetWriter::TargetPageSize(const vector<string> &schema_path) const {
+	if (page_size_compressed == 0) {
+		return 0;
+	}
+	if (filter_columns.find(schema_path[0]) != filter_columns.end()) {
+		// smaller pages on columns that are filtered on allow the page index to skip more of them
+		return MaxValue<idx_t>(page_size_compressed / 4, 1);
+	}
+	return page_size_compressed;
+}
+
+idx_t ParquetWriter::EstimateCompressedSize(idx_t in_memory_size) const {
+	idx_t in_memory = row_groups_in_memory_size;
+	idx_t compressed = row_groups_compressed_size;
+	if (in_memory == 0) {
+		// nothing was written yet: assume that the data does not compress
+		return in_memory_size;
+	}
+	return idx_t(double(in_memory_size) * double(compressed) / double(in_memory));
+}
+
+unique_ptr<ColumnDataCollection> ParquetWriter::SortRowGroup(ColumnDataCollection &buffer) {
+	auto &allocator = Allocator::Get(context);
+	auto count = buffer.Count();
+
+	// materialize the rows, and create a (binary comparable) sort key for every row
+	DataChunk rows;
+	rows.Initialize(allocator, buffer.Types(), count);
+	vector<string> sort_keys;
+	sort_keys.reserve(count);
+	vector<OrderModifiers> modifiers(row_group_sort_columns.size(),
+	                                 OrderModifiers(OrderType::ASCENDING, OrderByNullType::NULLS_LAST));
+	vector<LogicalType> sort_types;
+	for (auto &col_idx : row_group_sort_columns) {
+		sort_types.push_back(buffer.Types()[col_idx]);
+	}
+	DataChunk sort_input;
+	sort_input.InitializeEmpty(sort_types);
+	Vector sort_key_vector(LogicalType::BLOB);
+	for (auto &chunk : buffer.Chunks()) {
+		rows.Append(chunk);
+		for (idx_t i = 0; i < row_group_sort_columns.size(); i++) {
+			sort_input.data[i].Reference(chunk.data[row_group_sort_columns[i]]);
+		}
+		sort_input.SetCardinality(chunk.size());
+		CreateSortKeyHelpers::CreateSortKey(sort_input, modifiers, sort_key_vector);
+		sort_key_vector.Flatten(chunk.size());
+		auto keys = FlatVector::GetData<string_t>(sort_key_vector);
+		for (idx_t row_idx = 0; row_idx < chunk.size(); row_idx++) {
+			sort_keys.push_back(keys[row_idx].GetString());
+		}
+	}
+
+	vector<sel_t> order(count);
+	for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+		order[row_idx] = UnsafeNumericCast<sel_t>(row_idx);
+	}
+	std::stable_sort(order.begin(), order.end(),
+	                 [&](const sel_t &lhs, const sel_t &rhs) { return sort_keys[lhs] < sort_keys[rhs]; });
+
+	// gather the rows in sorted order
+	auto result = make_uniq<ColumnDataCollection>(context, buffer.Types(), ColumnDataAllocatorType::HYBRID);
+	ColumnDataAppendState append_state;
+	result->InitializeAppend(append_state);
+	DataChunk sorted_chunk;
+	sorted_chunk.InitializeEmpty(buffer.Types());
+	for (idx_t offset = 0; offset < count; offset += STANDARD_VECTOR_SIZE) {
+		auto chunk_count = MinValue<idx_t>(count - offset, STANDARD_VECTOR_SIZE);
+		SelectionVector sel(order.data() + offset);
+		sorted_chunk.Slice(rows, sel, chunk_count);
+		result->Append(append_state, sorted_chunk);
+	}
+	return result;
+}
+
+void ParquetWriter::WriteBloomFilters(duckdb_parquet::format::RowGroup &row_group) {
+	for (auto &entry : bloom_filters) {
+		auto &bloom_filter = *entry.bloom_filter;
+		duckdb_parquet::format::BloomFilterHeader header;
+		header.numBytes = NumericCast<int32_t>(bloom_filter.NumBytes());
+		header.algorithm.__set_BLOCK(duckdb_parquet::format::SplitBlockAlgorithm());
+		header.hash.__set_XXHASH(duckdb_parquet::format::XxHash());
+		header.compression.__set_UNCOMPRESSED(duckdb_parquet::format::Uncompressed());
+
+		auto &column_chunk = row_group.columns[entry.column_idx];
+		auto filter_start = writer->GetTotalWritten();
+		Write(header);
+		WriteData(bloom_filter.Data(), NumericCast<uint32_t>(bloom_filter.NumBytes()));
+		column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(filter_start));
+		// the length of the Bloom filter includes its header
+		column_chunk.meta_data.__set_bloom_filter_length(
+		    NumericCast<int32_t>(writer->GetTotalWritten() - filter_start));
+	}
+	bloom_filters.clear();
+}
+
+void ParquetWriter::WritePageIndexes() {
+	// all ColumnIndexes are written first, followed by all OffsetIndexes
+	for (auto &page_index : page_indexes) {
+		if (!page_index.has_column_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[page_index.row_group_idx].columns[page_index.column_idx];
+		auto index_start = writer->GetTotalWritten();
+		Write(page_index.column_index);
+		column_chunk.__set_column_index_offset(NumericCast<int64_t>(index_start));
+		column_chunk.__set_column_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - index_start));
+	}
+	for (auto &page_index : page_indexes) {
+		auto &column_chunk = file_meta_data.row_groups[page_index.row_group_idx].columns[page_index.column_idx];
+		auto index_start = writer->GetTotalWritten();
+		Write(page_index.offset_index);
+		column_chunk.__set_offset_index_offset(NumericCast<int64_t>(index_start));
+		column_chunk.__set_offset_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - index_start));
+	}
+	page_indexes.clear();
+}
+
 void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	if (buffer.Count() == 0) {
 		return;
@@ -534,6 +742,8 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 }
 
 void ParquetWriter::Finalize() {
+	WritePageIndexes();
+
 	const auto start_offset = writer->GetTotalWritten();
 	if (encryption_config) {
 		// Crypto metadata is written unencrypted
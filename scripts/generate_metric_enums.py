@@ -23,6 +23,15 @@ metrics = [
     "OPERATOR_ROWS_SCANNED",
     "OPERATOR_TIMING",
     "RESULT_SET_SIZE",
+    "PEAK_QUERY_MEMORY",
+    "TEMPORARY_BYTES_WRITTEN",
+    "OPERATOR_CPU_CYCLES",
+    "OPERATOR_INSTRUCTIONS",
+    "OPERATOR_CACHE_MISSES",
+    "OPERATOR_BRANCH_MISSES",
+    "OPERATOR_BYTES_READ",
+    "OPERATOR_READ_OPERATIONS",
+    "OPERATOR_READ_TIME",
 ]
 
 phase_timing_metrics = [
@@ -34,6 +43,8 @@ phase_timing_metrics = [
     "PHYSICAL_PLANNER_COLUMN_BINDING",
     "PHYSICAL_PLANNER_RESOLVE_TYPES",
     "PHYSICAL_PLANNER_CREATE_PLAN",
+    "JOIN_ORDER_EXACT_ENUMERATION",
+    "JOIN_ORDER_APPROXIMATE_ENUMERATION",
 ]
 
 optimizer_types = []
@@ -1,4 +1,5 @@
 import glob
+import hashlib
 import json
 import os
 import subprocess
@@ -15,30 +16,53 @@ PROFILE_OUTPUT = f"PRAGMA profile_output='{PROFILE_FILENAME}'"
 
 BANNER_SIZE = 52
 
+# severities of a plan change, from most to least severe
+# the severity is determined by the relative increase of the total intermediate cardinality
+SEVERITY_THRESHOLDS = [("CRITICAL", 2.0), ("MAJOR", 1.2), ("MINOR", 1.0)]
+SEVERITY_RANK = {name: rank for rank, (name, _) in enumerate(SEVERITY_THRESHOLDS)}
+
 
 def print_usage():
-    print(
-        f"Expected usage: python3 scripts/{os.path.basename(__file__)} --old=/old/duckdb_cli --new=/new/duckdb_cli --dir=/path/to/benchmark/dir"
-    )
+    script = f"python3 scripts/{os.path.basename(__file__)}"
+    print(f"Expected usage: {script} --old=/old/duckdb_cli --new=/new/duckdb_cli --dir=/path/to/benchmark/dir")
+    print(f"            or: {script} --new=/new/duckdb_cli --dir=/path/to/benchmark/dir --store-baseline=baseline.json")
+    print(f"            or: {script} --new=/new/duckdb_cli --dir=/path/to/benchmark/dir --baseline=baseline.json")
     exit(1)
 
 
+class Arguments:
+    def __init__(self):
+        self.old = None
+        self.new = None
+        self.benchmark_dir = None
+        # the file the plan costs of the new CLI are stored to
+        self.store_baseline = None
+        # the file with stored plan costs, the new CLI is compared against
+        self.baseline = None
+
+
 def parse_args():
-    old = None
-    new = None
-    benchmark_dir = None
+    args = Arguments()
     for arg in sys.argv[1:]:
         if arg.startswith("--old="):
-            old = arg.replace("--old=", "")
+            args.old = arg.replace("--old=", "")
         elif arg.startswith("--new="):
-            new = arg.replace("--new=", "")
+            args.new = arg.replace("--new=", "")
         elif arg.startswith("--dir="):
-            benchmark_dir = arg.replace("--dir=", "")
+            args.benchmark_dir = arg.replace("--dir=", "")
+        elif arg.startswith("--store-baseline="):
+            args.store_baseline = arg.replace("--store-baseline=", "")
+        elif arg.startswith("--baseline="):
+            args.baseline = arg.replace("--baseline=", "")
         else:
             print_usage()
-    if old == None or new == None or benchmark_dir == None:
+    if args.new == None or args.benchmark_dir == None:
         print_usage()
-    return old, new, benchmark_dir
+    # exactly one of --old, --store-baseline and --baseline must be specified
+    modes = [args.old, args.store_baseline, args.baseline]
+    if len([mode for mode in modes if mode != None]) != 1:
+        print_usage()
+    return args
 
 
 def init_db(cli, dbname, benchmark_dir):
@@ -56,6 +80,8 @@ class PlanCost:
         self.build_side = 0
         self.probe_side = 0
         self.time = 0
+        # the join order of the plan, see join_order
+        self.join_order = ""
 
     def __add__(self, other):
         self.total += other.total
@@ -86,6 +112,33 @@ class PlanCost:
     def __eq__(self, other):
         return self.total == other.total and self.build_side == other.build_side and self.probe_side == other.probe_side
 
+    def fingerprint(self):
+        return hashlib.sha1(self.join_order.encode('utf8')).hexdigest()[:16]
+
+    def cardinality_increased(self, other):
+        # timings are not comparable against a stored baseline, so only the cardinalities are compared
+        if self.total != other.total:
+            return self.total > other.total
+        return self.build_side > other.build_side
+
+    def to_json(self):
+        return {
+            'fingerprint': self.fingerprint(),
+            'join_order': self.join_order,
+            'total': self.total,
+            'build_side': self.build_side,
+            'probe_side': self.probe_side,
+        }
+
+    @staticmethod
+    def from_json(entry):
+        cost = PlanCost()
+        cost.total = entry['total']
+        cost.build_side = entry['build_side']
+        cost.probe_side = entry['probe_side']
+        cost.join_order = entry['join_order']
+        return cost
+
 
 def is_measured_join(op) -> bool:
     if 'name' not in op:
@@ -123,6 +176,35 @@ def op_inspect(op) -> PlanCost:
     return cost
 
 
+def scanned_table(op):
+    extra_info = op.get('extra_info', {})
+    if not isinstance(extra_info, dict):
+        return None
+    if 'Table' in extra_info:
+        return extra_info['Table']
+    if op['name'] == 'TABLE_SCAN' and '__text__' in extra_info:
+        return extra_info['__text__']
+    return None
+
+
+def join_order(op) -> str:
+    """Returns the join tree of the plan as a string, e.g. "((a INNER b) INNER c)" - the probe side is on the left"""
+    if is_measured_join(op):
+        probe = join_order(op['children'][0])
+        build = join_order(op['children'][1])
+        return f"({probe} {op['extra_info']['Join Type']} {build})"
+    if 'name' in op:
+        table = scanned_table(op)
+        if table:
+            return table
+    children = [join_order(child_op) for child_op in op['children']]
+    children = [child for child in children if child]
+    if len(children) <= 1:
+        return "".join(children)
+    # operators with multiple children that are not measured joins (e.g. unions or nested loop joins)
+    return f"{op.get('name', '')}[{', '.join(children)}]"
+
+
 def query_plan_cost(cli, dbname, query):
     try:
         subprocess.run(
@@ -143,7 +225,19 @@ def query_plan_cost(cli, dbname, query):
         print("-------------------------")
         raise e
     with open(PROFILE_FILENAME, 'r') as file:
-        return op_inspect(json.load(file))
+        profile = json.load(file)
+    cost = op_inspect(profile)
+    cost.join_order = join_order(profile)
+    return cost
+
+
+def severity(old_cost, new_cost):
+    """Ranks a plan change by the relative increase of the total intermediate cardinality"""
+    ratio = new_cost.total / max(old_cost.total, 1)
+    for name, threshold in SEVERITY_THRESHOLDS:
+        if ratio >= threshold:
+            return name
+    return SEVERITY_THRESHOLDS[-1][0]
 
 
 def print_banner(text):
@@ -169,47 +263,114 @@ def print_diffs(diffs):
         print("New total cost:", new_cost.total)
         print("New build cost:", new_cost.build_side)
         print("New probe cost:", new_cost.probe_side)
+        if old_cost.join_order != new_cost.join_order:
+            print("Old join order:", old_cost.join_order)
+            print("New join order:", new_cost.join_order)
+
+
+def print_ranked_regressions(regressions):
+    # rank the regressions by severity, and by the relative cost increase within a severity
+    def rank(diff):
+        _, old_cost, new_cost = diff
+        return (SEVERITY_RANK[severity(old_cost, new_cost)], -new_cost.total / max(old_cost.total, 1))
+
+    regressions = sorted(regressions, key=rank)
+    for query_name, old_cost, new_cost in regressions:
+        ratio = new_cost.total / max(old_cost.total, 1)
+        join_order_changed = " (join order changed)" if old_cost.join_order != new_cost.join_order else ""
+        print(f"{severity(old_cost, new_cost):<8} {query_name}: {ratio:.2f}x total cost{join_order_changed}")
+    print_diffs(regressions)
+
+
+def benchmark_queries(benchmark_dir):
+    files = glob.glob(f"{benchmark_dir}/queries/*.sql")
+    files.sort()
+    for f in files:
+        query_name = f.split("/")[-1].replace(".sql", "")
+        with open(f, "r") as file:
+            yield query_name, file.read()
+
+
+def load_baseline(path):
+    with open(path, 'r') as file:
+        baseline = json.load(file)
+    return {query_name: PlanCost.from_json(entry) for query_name, entry in baseline['queries'].items()}
+
+
+def store_baseline(path, costs):
+    baseline = {'queries': {query_name: cost.to_json() for query_name, cost in costs.items()}}
+    with open(path, 'w') as file:
+        json.dump(baseline, file, indent=4, sort_keys=True)
 
 
 def main():
-    old, new, benchmark_dir = parse_args()
-    init_db(old, OLD_DB_NAME, benchmark_dir)
-    init_db(new, NEW_DB_NAME, benchmark_dir)
+    args = parse_args()
+    if args.old != None:
+        init_db(args.old, OLD_DB_NAME, args.benchmark_dir)
+    init_db(args.new, NEW_DB_NAME, args.benchmark_dir)
+    baseline = load_baseline(args.baseline) if args.baseline != None else None
 
     improvements = []
     regressions = []
+    # queries with a different join order, but the same cost
+    plan_changes = []
+    new_costs = {}
+    missing = []
 
-    files = glob.glob(f"{benchmark_dir}/queries/*.sql")
-    files.sort()
+    queries = list(benchmark_queries(args.benchmark_dir))
 
     print("")
     print("RUNNING BENCHMARK QUERIES")
-    for f in tqdm(files):
-        query_name = f.split("/")[-1].replace(".sql", "")
-
-        with open(f, "r") as file:
-            query = file.read()
-
-        old_cost = query_plan_cost(old, OLD_DB_NAME, query)
-        new_cost = query_plan_cost(new, NEW_DB_NAME, query)
+    for query_name, query in tqdm(queries):
+        new_cost = query_plan_cost(args.new, NEW_DB_NAME, query)
+        new_costs[query_name] = new_cost
+
+        if args.old != None:
+            old_cost = query_plan_cost(args.old, OLD_DB_NAME, query)
+            improved = old_cost > new_cost
+            regressed = new_cost > old_cost
+        elif baseline != None:
+            if query_name not in baseline:
+                missing.append(query_name)
+                continue
+            old_cost = baseline[query_name]
+            improved = old_cost.cardinality_increased(new_cost)
+            regressed = new_cost.cardinality_increased(old_cost)
+        else:
+            continue
 
-        if old_cost > new_cost:
+        if improved:
             improvements.append((query_name, old_cost, new_cost))
-        elif new_cost > old_cost:
+        elif regressed:
             regressions.append((query_name, old_cost, new_cost))
+        elif old_cost.join_order != new_cost.join_order:
+            plan_changes.append((query_name, old_cost, new_cost))
 
     exit_code = 0
-    if improvements:
-        print_banner("IMPROVEMENTS DETECTED")
-        print_diffs(improvements)
-    if regressions:
-        exit_code = 1
-        print_banner("REGRESSIONS DETECTED")
-        print_diffs(regressions)
-    if not improvements and not regressions:
-        print_banner("NO DIFFERENCES DETECTED")
-
-    os.remove(OLD_DB_NAME)
+    if args.store_baseline != None:
+        store_baseline(args.store_baseline, new_costs)
+        print_banner("BASELINE STORED")
+        print(f"Stored the plan costs of {len(new_costs)} queries in {args.store_baseline}")
+    else:
+        if missing:
+            print_banner("QUERIES NOT IN BASELINE")
+            for query_name in missing:
+                print(query_name)
+        if improvements:
+            print_banner("IMPROVEMENTS DETECTED")
+            print_diffs(improvements)
+        if plan_changes:
+            print_banner("JOIN ORDER CHANGES DETECTED")
+            print_diffs(plan_changes)
+        if regressions:
+            exit_code = 1
+            print_banner("REGRESSIONS DETECTED")
+            print_ranked_regressions(regressions)
+        if not improvements and not regressions and not plan_changes:
+            print_banner("NO DIFFERENCES DETECTED")
+
+    if args.old != None:
+        os.remove(OLD_DB_NAME)
     os.remove(NEW_DB_NAME)
     os.remove(PROFILE_FILENAME)
 
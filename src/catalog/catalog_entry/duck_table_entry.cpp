@@ -258,6 +258,10 @@ unique_ptr<CatalogEntry> DuckTableEntry::AlterEntry(ClientContext &context, Alte
 		auto &drop_not_null_info = table_info.Cast<DropNotNullInfo>();
 		return DropNotNull(context, drop_not_null_info);
 	}
+	case AlterTableType::SET_CLUSTER_BY: {
+		auto &cluster_by_info = table_info.Cast<SetClusterByInfo>();
+		return SetClusterBy(context, cluster_by_info);
+	}
 	default:
 		throw InternalException("Unrecognized alter table type!");
 	}
@@ -297,6 +301,12 @@ unique_ptr<CatalogEntry> DuckTableEntry::RenameColumn(ClientContext &context, Re
 	create_info->temporary = temporary;
 	create_info->comment = comment;
 	create_info->tags = tags;
+	create_info->cluster_by = cluster_by;
+	for (auto &cluster_column : create_info->cluster_by) {
+		if (StringUtil::CIEquals(cluster_column, info.old_name)) {
+			cluster_column = info.new_name;
+		}
+	}
 	for (auto &col : columns.Logical()) {
 		auto copy = col.Copy();
 		if (rename_idx == col.Logical()) {
@@ -371,6 +381,7 @@ unique_ptr<CatalogEntry> DuckTableEntry::AddColumn(ClientContext &context, AddCo
 	create_info->temporary = temporary;
 	create_info->comment = comment;
 	create_info->tags = tags;
+	create_info->cluster_by = cluster_by;
 
 	for (auto &col : columns.Logical()) {
 		create_info->columns.AddColumn(col.Copy());
@@ -494,6 +505,7 @@ unique_ptr<CatalogEntry> DuckTableEntry::RemoveColumn(ClientContext &context, Re
 	create_info->temporary = temporary;
 	create_info->comment = comment;
 	create_info->tags = tags;
+	create_info->cluster_by = cluster_by;
 
 	logical_index_set_t removed_columns;
 	if (column_dependency_manager.HasDependents(removed_index)) {
@@ -508,6 +520,13 @@ unique_ptr<CatalogEntry> DuckTableEntry::RemoveColumn(ClientContext &context, Re
 			if (col.Generated()) {
 				dropped_column_is_generated = true;
 			}
+			// the table is no longer clustered on a dropped column
+			auto &cluster_by = create_info->cluster_by;
+			for (idx_t i = cluster_by.size(); i > 0; i--) {
+				if (StringUtil::CIEquals(cluster_by[i - 1], col.Name())) {
+					cluster_by.erase_at(i - 1);
+				}
+			}
 			continue;
 		}
 		create_info->columns.AddColumn(col.Copy());
@@ -536,6 +555,7 @@ unique_ptr<CatalogEntry> DuckTableEntry::SetDefault(ClientContext &context, SetD
 	auto create_info = make_uniq<CreateTableInfo>(schema, name);
 	create_info->comment = comment;
 	create_info->tags = tags;
+	create_info->cluster_by = cluster_by;
 	auto default_idx = GetColumnIndex(info.column_name);
 	if (default_idx.index == COLUMN_IDENTIFIER_ROW_ID) {
 		throw CatalogException("Cannot SET DEFAULT for rowid column");
@@ -569,6 +589,7 @@ unique_ptr<CatalogEntry> DuckTableEntry::SetNotNull(ClientContext &context, SetN
 	auto create_info = make_uniq<CreateTableInfo>(schema, name);
 	create_info->comment = comment;
 	create_info->tags = tags;
+	create_info->cluster_by = cluster_by;
 	create_info->columns = columns.Copy();
 
 	auto not_null_idx = GetColumnIndex(info.column_name);
@@ -607,6 +628,7 @@ unique_ptr<CatalogEntry> DuckTableEntry::DropNotNull(ClientContext &context, Dro
 	auto create_info = make_uniq<CreateTableInfo>(schema, name);
 	create_info->comment = comment;
 	create_info->tags = tags;
+	create_info->cluster_by = cluster_by;
 	create_info->columns = columns.Copy();
 
 	auto not_null_idx = GetColumnIndex(info.column_name);
@@ -627,6 +649,32 @@ unique_ptr<CatalogEntry> DuckTableEntry::DropNotNull(ClientContext &context, Dro
 	return make_uniq<DuckTableEntry>(catalog, schema, *bound_create_info, storage);
 }
 
+unique_ptr<CatalogEntry> DuckTableEntry::SetClusterBy(ClientContext &context, SetClusterByInfo &info) {
+	auto create_info = make_uniq<CreateTableInfo>(schema, name);
+	create_info->temporary = temporary;
+	create_info->comment = comment;
+	create_info->tags = tags;
+	create_info->columns = columns.Copy();
+	for (auto &constraint : constraints) {
+		create_info->constraints.push_back(constraint->Copy());
+	}
+	for (auto &column_name : info.cluster_by) {
+		auto cluster_idx = GetColumnIndex(column_name);
+		if (cluster_idx.index == COLUMN_IDENTIFIER_ROW_ID) {
+			throw CatalogException("Cannot cluster a table on the rowid column");
+		}
+		auto &col = columns.GetColumn(cluster_idx);
+		if (col.Generated()) {
+			throw CatalogException("Cannot cluster a table on generated column \"%s\"", col.Name());
+		}
+		create_info->cluster_by.push_back(col.Name());
+	}
+
+	auto binder = Binder::CreateBinder(context);
+	auto bound_create_info = binder->BindCreateTableInfo(std::move(create_info), schema);
+	return make_uniq<DuckTableEntry>(catalog, schema, *bound_create_info, storage);
+}
+
 unique_ptr<CatalogEntry> DuckTableEntry::ChangeColumnType(ClientContext &context, ChangeColumnTypeInfo &info) {
 	auto binder = Binder::CreateBinder(context);
 	binder->BindLogicalType(info.target_type, &catalog, schema.name);
@@ -635,6 +683,7 @@ unique_ptr<CatalogEntry> DuckTableEntry::ChangeColumnType(ClientContext &context
 	create_info->temporary = temporary;
 	create_info->comment = comment;
 	create_info->tags = tags;
+	create_info->cluster_by = cluster_by;
 
 	auto bound_constraints = binder->BindConstraints(constraints, name, columns);
 	for (auto &col : columns.Logical()) {
@@ -722,6 +771,7 @@ unique_ptr<CatalogEntry> DuckTableEntry::SetColumnComment(ClientContext &context
 	auto create_info = make_uniq<CreateTableInfo>(schema, name);
 	create_info->comment = comment;
 	create_info->tags = tags;
+	create_info->cluster_by = cluster_by;
 	auto default_idx = GetColumnIndex(info.column_name);
 	if (default_idx.index == COLUMN_IDENTIFIER_ROW_ID) {
 		throw CatalogException("Cannot SET DEFAULT for rowid column");
@@ -753,6 +803,7 @@ unique_ptr<CatalogEntry> DuckTableEntry::AddForeignKeyConstraint(optional_ptr<Cl
 	create_info->temporary = temporary;
 	create_info->comment = comment;
 	create_info->tags = tags;
+	create_info->cluster_by = cluster_by;
 
 	create_info->columns = columns.Copy();
 	for (idx_t i = 0; i < constraints.size(); i++) {
@@ -783,6 +834,7 @@ unique_ptr<CatalogEntry> DuckTableEntry::DropForeignKeyConstraint(ClientContext
 	create_info->temporary = temporary;
 	create_info->comment = comment;
 	create_info->tags = tags;
+	create_info->cluster_by = cluster_by;
 
 	create_info->columns = columns.Copy();
 	for (idx_t i = 0; i < constraints.size(); i++) {
@@ -805,6 +857,7 @@ unique_ptr<CatalogEntry> DuckTableEntry::Copy(ClientContext &context) const {
 	auto create_info = make_uniq<CreateTableInfo>(schema, name);
 	create_info->comment = comment;
 	create_info->tags = tags;
+	create_info->cluster_by = cluster_by;
 	create_info->columns = columns.Copy();
 
 	for (idx_t i = 0; i < constraints.size(); i++) {
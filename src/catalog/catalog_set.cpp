@@ -19,6 +19,14 @@
 
 namespace duckdb {
 
+static idx_t NextCatalogEntryMapVersion() {
+	static atomic<idx_t> next_version {0};
+	return ++next_version;
+}
+
+CatalogEntryMap::CatalogEntryMap() : version(NextCatalogEntryMapVersion()) {
+}
+
 void CatalogEntryMap::AddEntry(unique_ptr<CatalogEntry> entry) {
 	auto name = entry->name;
 
@@ -26,6 +34,7 @@ void CatalogEntryMap::AddEntry(unique_ptr<CatalogEntry> entry) {
 		throw InternalException("Entry with name \"%s\" already exists", name);
 	}
 	entries.insert(make_pair(name, std::move(entry)));
+	version = NextCatalogEntryMapVersion();
 }
 
 void CatalogEntryMap::UpdateEntry(unique_ptr<CatalogEntry> catalog_entry) {
@@ -39,6 +48,7 @@ void CatalogEntryMap::UpdateEntry(unique_ptr<CatalogEntry> catalog_entry) {
 	auto existing = std::move(entry->second);
 	entry->second = std::move(catalog_entry);
 	entry->second->SetChild(std::move(existing));
+	version = NextCatalogEntryMapVersion();
 }
 
 case_insensitive_tree_t<unique_ptr<CatalogEntry>> &CatalogEntryMap::Entries() {
@@ -71,6 +81,7 @@ void CatalogEntryMap::DropEntry(CatalogEntry &entry) {
 		auto &parent = entry.Parent();
 		parent.SetChild(std::move(child));
 	}
+	version = NextCatalogEntryMapVersion();
 }
 
 optional_ptr<CatalogEntry> CatalogEntryMap::GetEntry(const string &name) {
@@ -546,7 +557,29 @@ optional_ptr<CatalogEntry> CatalogSet::CreateDefaultEntry(CatalogTransaction tra
 	return GetEntry(transaction, name);
 }
 
+static optional_ptr<DuckTransaction> GetLookupCacheTransaction(CatalogTransaction transaction) {
+	if (!transaction.transaction || !transaction.transaction->IsDuckTransaction()) {
+		return nullptr;
+	}
+	auto &duck_transaction = transaction.transaction->Cast<DuckTransaction>();
+	if (duck_transaction.transaction_id != transaction.transaction_id ||
+	    duck_transaction.start_time != transaction.start_time) {
+		return nullptr;
+	}
+	return &duck_transaction;
+}
+
 CatalogSet::EntryLookup CatalogSet::GetEntryDetailed(CatalogTransaction transaction, const string &name) {
+	// entries that this transaction looked up before are valid until the catalog set changes:
+	// in that case, we do not need to take the catalog lock that is shared by all transactions
+	auto cache_transaction = GetLookupCacheTransaction(transaction);
+	if (cache_transaction) {
+		auto cached_entry = cache_transaction->GetCachedCatalogEntry(*this, name, map.GetVersion());
+		if (cached_entry) {
+			return EntryLookup {cached_entry, EntryLookup::FailureReason::SUCCESS};
+		}
+	}
+
 	unique_lock<mutex> read_lock(catalog_lock);
 	auto entry_value = map.GetEntry(name);
 	if (entry_value) {
@@ -559,6 +592,9 @@ CatalogSet::EntryLookup CatalogSet::GetEntryDetailed(CatalogTransaction transact
 			return EntryLookup {nullptr, EntryLookup::FailureReason::DELETED};
 		}
 		D_ASSERT(StringUtil::CIEquals(name, current.name));
+		if (cache_transaction) {
+			cache_transaction->CacheCatalogEntry(*this, name, map.GetVersion(), current);
+		}
 		return EntryLookup {&current, EntryLookup::FailureReason::SUCCESS};
 	}
 	auto default_entry = CreateDefaultEntry(transaction, name, read_lock);
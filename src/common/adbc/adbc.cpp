@@ -59,7 +59,7 @@ AdbcStatusCode duckdb_adbc_init(int version, void *driver, struct AdbcError *err
 
 namespace duckdb_adbc {
 
-enum class IngestionMode { CREATE = 0, APPEND = 1 };
+enum class IngestionMode { CREATE = 0, APPEND = 1, REPLACE = 2, CREATE_APPEND = 3 };
 
 struct DuckDBAdbcStatementWrapper {
 	duckdb_connection connection;
@@ -602,35 +602,31 @@ AdbcStatusCode Ingest(duckdb_connection connection, const char *table_name, cons
 	                                        duckdb::Value::POINTER(reinterpret_cast<uintptr_t>(stream_produce)),
 	                                        duckdb::Value::POINTER(reinterpret_cast<uintptr_t>(stream_schema))});
 	try {
+		// The arrow scan is planned directly into a CREATE TABLE AS / INSERT, so the stream is consumed in parallel
+		// and written out as row groups without going through a temporary view or a SQL string
+		auto schema_name = schema ? std::string(schema) : std::string(INVALID_SCHEMA);
+		if (ingestion_mode == IngestionMode::CREATE_APPEND) {
+			ingestion_mode = cconn->TableInfo(schema_name, table_name) ? IngestionMode::APPEND : IngestionMode::CREATE;
+		}
 		switch (ingestion_mode) {
 		case IngestionMode::CREATE:
-			if (schema) {
-				arrow_scan->Create(schema, table_name, temporary);
-			} else {
-				arrow_scan->Create(table_name, temporary);
-			}
+			arrow_scan->Create(schema_name, table_name, temporary);
 			break;
-		case IngestionMode::APPEND: {
-			arrow_scan->CreateView("temp_adbc_view", true, true);
-			std::string query;
-			if (schema) {
-				query = duckdb::StringUtil::Format("insert into \"%s.%s\" select * from temp_adbc_view", schema,
-				                                   table_name);
-			} else {
-				query = duckdb::StringUtil::Format("insert into \"%s\" select * from temp_adbc_view", table_name);
-			}
-			auto result = cconn->Query(query);
+		case IngestionMode::REPLACE:
+			arrow_scan->Create(schema_name, table_name, temporary, duckdb::OnCreateConflict::REPLACE_ON_CONFLICT);
 			break;
-		}
+		case IngestionMode::APPEND:
+			arrow_scan->Insert(schema_name, table_name);
+			break;
+		default:
+			throw duckdb::InternalException("Unsupported ingestion mode");
 		}
 		// After creating a table, the arrow array stream is released. Hence we must set it as released to avoid
 		// double-releasing it
 		input->release = nullptr;
 	} catch (std::exception &ex) {
-		if (error) {
-			duckdb::ErrorData parsed_error(ex);
-			error->message = strdup(parsed_error.RawMessage().c_str());
-		}
+		duckdb::ErrorData parsed_error(ex);
+		SetError(error, parsed_error.RawMessage());
 		return ADBC_STATUS_INTERNAL;
 	} catch (...) {
 		return ADBC_STATUS_INTERNAL;
@@ -1027,6 +1023,12 @@ AdbcStatusCode StatementSetOption(struct AdbcStatement *statement, const char *k
 		} else if (strcmp(value, ADBC_INGEST_OPTION_MODE_APPEND) == 0) {
 			wrapper->ingestion_mode = IngestionMode::APPEND;
 			return ADBC_STATUS_OK;
+		} else if (strcmp(value, ADBC_INGEST_OPTION_MODE_REPLACE) == 0) {
+			wrapper->ingestion_mode = IngestionMode::REPLACE;
+			return ADBC_STATUS_OK;
+		} else if (strcmp(value, ADBC_INGEST_OPTION_MODE_CREATE_APPEND) == 0) {
+			wrapper->ingestion_mode = IngestionMode::CREATE_APPEND;
+			return ADBC_STATUS_OK;
 		} else {
 			SetError(error, "Invalid ingestion mode");
 			return ADBC_STATUS_INVALID_ARGUMENT;
@@ -123,6 +123,22 @@ int ResultArrowArrayStreamWrapper::MyStreamGetNext(struct ArrowArrayStream *stre
 			out->release = nullptr;
 			return 0;
 		}
+		if (stream_result.IsArrowStream()) {
+			// The arrays were already converted by the pipeline threads, in the batch size of the result collector
+			auto array = stream_result.FetchArrowArray();
+			if (!array) {
+				if (stream_result.HasError()) {
+					my_stream->last_error = stream_result.GetErrorObject();
+					return -1;
+				}
+				// Nothing to output
+				out->release = nullptr;
+				return 0;
+			}
+			*out = array->arrow_array;
+			array->arrow_array.release = nullptr;
+			return 0;
+		}
 	}
 	if (my_stream->column_types.empty()) {
 		my_stream->column_types = result.types;
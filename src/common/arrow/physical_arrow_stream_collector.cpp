@@ -0,0 +1,151 @@
+#include "duckdb/common/arrow/physical_arrow_stream_collector.hpp"
+#include "duckdb/main/buffered_data/arrow_buffered_data.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/main/stream_query_result.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/client_context.hpp"
+
+namespace duckdb {
+
+PhysicalArrowStreamCollector::PhysicalArrowStreamCollector(PreparedStatementData &data, bool parallel, bool ordered,
+                                                           idx_t batch_size)
+    : PhysicalResultCollector(data), record_batch_size(batch_size), parallel(parallel), ordered(ordered) {
+}
+
+unique_ptr<PhysicalResultCollector> PhysicalArrowStreamCollector::Create(ClientContext &context,
+                                                                         PreparedStatementData &data,
+                                                                         idx_t batch_size) {
+	if (!PhysicalPlanGenerator::PreserveInsertionOrder(context, *data.plan)) {
+		// the plan is not order preserving, so the arrays are streamed as soon as they are finished
+		return make_uniq_base<PhysicalResultCollector, PhysicalArrowStreamCollector>(data, true, false, batch_size);
+	} else if (!PhysicalPlanGenerator::UseBatchIndex(context, *data.plan)) {
+		// the plan is order preserving, but we cannot use the batch index: convert in a single thread
+		return make_uniq_base<PhysicalResultCollector, PhysicalArrowStreamCollector>(data, false, false, batch_size);
+	} else {
+		// convert in parallel, and stream the arrays in batch index order
+		return make_uniq_base<PhysicalResultCollector, PhysicalArrowStreamCollector>(data, true, true, batch_size);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class ArrowStreamCollectorGlobalState : public GlobalSinkState {
+public:
+	//! This is weak to avoid creating a cyclical reference
+	weak_ptr<ClientContext> context;
+	shared_ptr<BufferedData> buffered_data;
+};
+
+void PhysicalArrowStreamCollector::FinishArray(ArrowStreamCollectorLocalState &lstate,
+                                               ArrowBufferedData &buffered_data) const {
+	if (!lstate.appender) {
+		return;
+	}
+	auto finished_array = make_uniq<ArrowArrayWrapper>();
+	finished_array->arrow_array = lstate.appender->Finalize();
+	lstate.appender.reset();
+	buffered_data.Append(std::move(finished_array), lstate.appended_size, lstate.current_batch);
+	lstate.appended_size = 0;
+}
+
+SinkResultType PhysicalArrowStreamCollector::Sink(ExecutionContext &context, DataChunk &chunk,
+                                                  OperatorSinkInput &input) const {
+	auto &gstate = input.global_state.Cast<ArrowStreamCollectorGlobalState>();
+	auto &lstate = input.local_state.Cast<ArrowStreamCollectorLocalState>();
+	auto &buffered_data = gstate.buffered_data->Cast<ArrowBufferedData>();
+
+	if (ordered) {
+		lstate.current_batch = lstate.partition_info.batch_index.GetIndex();
+		buffered_data.UpdateMinBatchIndex(lstate.partition_info.min_batch_index.GetIndex());
+	}
+	if (buffered_data.ShouldBlockBatch(lstate.current_batch)) {
+		auto callback_state = input.interrupt_state;
+		buffered_data.BlockSink(callback_state, lstate.current_batch);
+		return SinkResultType::BLOCKED;
+	}
+
+	// Append to the appender, up to the record batch size
+	auto count = chunk.size();
+	D_ASSERT(count != 0);
+	auto chunk_size = chunk.GetAllocationSize();
+	idx_t processed = 0;
+	do {
+		if (!lstate.appender) {
+			// Create the appender if we haven't started this array yet
+			auto properties = context.client.GetClientProperties();
+			auto initial_capacity = MinValue(record_batch_size, count - processed);
+			lstate.appender = make_uniq<ArrowAppender>(types, initial_capacity, properties);
+		}
+
+		// Figure out how much we can still append to this array
+		auto row_count = lstate.appender->RowCount();
+		D_ASSERT(record_batch_size > row_count);
+		auto to_append = MinValue(record_batch_size - row_count, count - processed);
+
+		// Append and check if the array is finished
+		lstate.appender->Append(chunk, processed, processed + to_append, count);
+		lstate.appended_size += chunk_size * to_append / count;
+		processed += to_append;
+		if (lstate.appender->RowCount() >= record_batch_size) {
+			FinishArray(lstate, buffered_data);
+		}
+	} while (processed < count);
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkNextBatchType PhysicalArrowStreamCollector::NextBatch(ExecutionContext &context,
+                                                          OperatorSinkNextBatchInput &input) const {
+	auto &gstate = input.global_state.Cast<ArrowStreamCollectorGlobalState>();
+	auto &lstate = input.local_state.Cast<ArrowStreamCollectorLocalState>();
+	auto &buffered_data = gstate.buffered_data->Cast<ArrowBufferedData>();
+
+	// arrays cannot span batches: finish the array of the batch we were working on
+	FinishArray(lstate, buffered_data);
+	lstate.current_batch = lstate.partition_info.batch_index.GetIndex();
+	buffered_data.UpdateMinBatchIndex(lstate.partition_info.min_batch_index.GetIndex());
+	return SinkNextBatchType::READY;
+}
+
+SinkCombineResultType PhysicalArrowStreamCollector::Combine(ExecutionContext &context,
+                                                            OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<ArrowStreamCollectorGlobalState>();
+	auto &lstate = input.local_state.Cast<ArrowStreamCollectorLocalState>();
+	auto &buffered_data = gstate.buffered_data->Cast<ArrowBufferedData>();
+
+	FinishArray(lstate, buffered_data);
+	if (ordered) {
+		buffered_data.UpdateMinBatchIndex(lstate.partition_info.min_batch_index.GetIndex());
+	}
+	return SinkCombineResultType::FINISHED;
+}
+
+SinkFinalizeType PhysicalArrowStreamCollector::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                        OperatorSinkFinalizeInput &input) const {
+	auto &gstate = input.global_state.Cast<ArrowStreamCollectorGlobalState>();
+	auto &buffered_data = gstate.buffered_data->Cast<ArrowBufferedData>();
+	// all batches are complete: hand the remaining buffered batches to the consumer
+	buffered_data.UpdateMinBatchIndex(NumericLimits<idx_t>::Maximum());
+	return SinkFinalizeType::READY;
+}
+
+unique_ptr<LocalSinkState> PhysicalArrowStreamCollector::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<ArrowStreamCollectorLocalState>();
+}
+
+unique_ptr<GlobalSinkState> PhysicalArrowStreamCollector::GetGlobalSinkState(ClientContext &context) const {
+	auto state = make_uniq<ArrowStreamCollectorGlobalState>();
+	state->context = context.shared_from_this();
+	state->buffered_data = make_shared_ptr<ArrowBufferedData>(state->context, ordered);
+	return std::move(state);
+}
+
+unique_ptr<QueryResult> PhysicalArrowStreamCollector::GetResult(GlobalSinkState &state) {
+	auto &gstate = state.Cast<ArrowStreamCollectorGlobalState>();
+	auto cc = gstate.context.lock();
+	auto result = make_uniq<StreamQueryResult>(statement_type, properties, types, names, cc->GetClientProperties(),
+	                                           gstate.buffered_data);
+	return std::move(result);
+}
+
+} // namespace duckdb
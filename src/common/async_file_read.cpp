@@ -0,0 +1,120 @@
+#include "duckdb/common/async_file_read.hpp"
+
+#include "duckdb/common/file_system.hpp"
+
+namespace duckdb {
+
+AsyncFileRead::AsyncFileRead(FileSystem &fs, FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location)
+    : fs(fs), handle(handle), buffer(buffer), nr_bytes(nr_bytes), location(location), sequential(false) {
+}
+
+AsyncFileRead::AsyncFileRead(FileSystem &fs, FileHandle &handle, void *buffer, int64_t nr_bytes)
+    : fs(fs), handle(handle), buffer(buffer), nr_bytes(nr_bytes), location(0), sequential(true) {
+}
+
+void AsyncFileRead::Execute() {
+	ErrorData read_error;
+	try {
+		if (sequential) {
+			auto data = static_cast<data_ptr_t>(buffer);
+			while (bytes_read < nr_bytes) {
+				auto read = fs.Read(handle, data + bytes_read, nr_bytes - bytes_read);
+				if (read <= 0) {
+					break;
+				}
+				bytes_read += read;
+			}
+		} else {
+			fs.Read(handle, buffer, nr_bytes, location);
+			bytes_read = nr_bytes;
+		}
+	} catch (std::exception &ex) {
+		read_error = ErrorData(ex);
+	} catch (...) { // LCOV_EXCL_START
+		read_error = ErrorData("Unknown exception in asynchronous read");
+	} // LCOV_EXCL_STOP
+
+	vector<InterruptState> to_notify;
+	{
+		lock_guard<mutex> guard(lock);
+		error = std::move(read_error);
+		done = true;
+		to_notify = std::move(waiters);
+	}
+	cv.notify_all();
+	for (auto &waiter : to_notify) {
+		waiter.Callback();
+	}
+}
+
+bool AsyncFileRead::IsDone() {
+	lock_guard<mutex> guard(lock);
+	return done;
+}
+
+void AsyncFileRead::Wait() {
+	unique_lock<mutex> guard(lock);
+	cv.wait(guard, [&] { return done; });
+	if (error.HasError()) {
+		error.Throw();
+	}
+}
+
+bool AsyncFileRead::AddWaiter(const InterruptState &state) {
+	lock_guard<mutex> guard(lock);
+	if (done) {
+		return false;
+	}
+	waiters.push_back(state);
+	return true;
+}
+
+AsyncFileReadThreads::AsyncFileReadThreads(idx_t thread_count) {
+#ifndef DUCKDB_NO_THREADS
+	for (idx_t i = 0; i < thread_count; i++) {
+		threads.push_back(make_uniq<thread>([this]() { Run(); }));
+	}
+#endif
+}
+
+AsyncFileReadThreads::~AsyncFileReadThreads() {
+	{
+		lock_guard<mutex> guard(lock);
+		shutdown = true;
+	}
+	cv.notify_all();
+	for (auto &io_thread : threads) {
+		io_thread->join();
+	}
+}
+
+void AsyncFileReadThreads::Schedule(shared_ptr<AsyncFileRead> read) {
+	if (threads.empty()) {
+		// no background threads - perform the read right away
+		read->Execute();
+		return;
+	}
+	{
+		lock_guard<mutex> guard(lock);
+		pending.push_back(std::move(read));
+	}
+	cv.notify_one();
+}
+
+void AsyncFileReadThreads::Run() {
+	while (true) {
+		shared_ptr<AsyncFileRead> read;
+		{
+			unique_lock<mutex> guard(lock);
+			cv.wait(guard, [&] { return shutdown || !pending.empty(); });
+			if (pending.empty()) {
+				return;
+			}
+			read = std::move(pending.front());
+			pending.pop_front();
+		}
+		read->Execute();
+	}
+}
+
+} // namespace duckdb
@@ -1,6 +1,16 @@
 #include "duckdb/common/checksum.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/helper.hpp"
 #include "duckdb/common/types/hash.hpp"
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DUCKDB_CRC32C_SSE42
+#include <nmmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define DUCKDB_CRC32C_ARM
+#include <arm_acle.h>
+#endif
+
 namespace duckdb {
 
 hash_t Checksum(uint64_t x) {
@@ -22,4 +32,171 @@ uint64_t Checksum(uint8_t *buffer, size_t size) {
 	return result;
 }
 
+uint64_t Checksum(uint8_t *buffer, size_t size, ChecksumType type) {
+	switch (type) {
+	case ChecksumType::LEGACY:
+		return Checksum(buffer, size);
+	case ChecksumType::CRC32C:
+		return CRC32C(buffer, size);
+	default:
+		throw InternalException("Unsupported checksum type");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// CRC32C
+//===--------------------------------------------------------------------===//
+//! The reflected CRC32C (Castagnoli) polynomial
+static constexpr uint32_t CRC32C_POLYNOMIAL = 0x82f63b78;
+//! The sizes of the stripes that are computed in parallel by the hardware implementation
+static constexpr size_t CRC32C_LONG_STRIPE_SIZE = 8192;
+static constexpr size_t CRC32C_SHORT_STRIPE_SIZE = 256;
+
+//! Multiplies a and b modulo the CRC polynomial
+static uint32_t CRC32CMultiply(uint32_t a, uint32_t b) {
+	uint32_t result = 0;
+	for (uint32_t m = 1U << 31; m != 0; m >>= 1) {
+		if (a & m) {
+			result ^= b;
+		}
+		b = b & 1 ? (b >> 1) ^ CRC32C_POLYNOMIAL : b >> 1;
+	}
+	return result;
+}
+
+//! Returns the operator that appends byte_count zero bytes to a CRC: x^(8 * byte_count) modulo the CRC polynomial
+static uint32_t CRC32CShiftOperator(size_t byte_count) {
+	// x^1, squared for every bit of the bit count
+	uint32_t power = 1U << 30;
+	uint32_t result = 1U << 31;
+	for (size_t bit_count = byte_count * 8; bit_count > 0; bit_count >>= 1) {
+		if (bit_count & 1) {
+			result = CRC32CMultiply(power, result);
+		}
+		power = CRC32CMultiply(power, power);
+	}
+	return result;
+}
+
+struct CRC32CTables {
+	CRC32CTables() {
+		for (uint32_t i = 0; i < 256; i++) {
+			uint32_t crc = i;
+			for (idx_t k = 0; k < 8; k++) {
+				crc = crc & 1 ? (crc >> 1) ^ CRC32C_POLYNOMIAL : crc >> 1;
+			}
+			table[0][i] = crc;
+		}
+		for (uint32_t i = 0; i < 256; i++) {
+			for (idx_t k = 1; k < 8; k++) {
+				table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xff];
+			}
+		}
+		long_stripe_shift = CRC32CShiftOperator(CRC32C_LONG_STRIPE_SIZE);
+		short_stripe_shift = CRC32CShiftOperator(CRC32C_SHORT_STRIPE_SIZE);
+	}
+
+	//! Slicing-by-8 lookup tables
+	uint32_t table[8][256];
+	//! The operators that shift a CRC over a stripe
+	uint32_t long_stripe_shift;
+	uint32_t short_stripe_shift;
+};
+
+static const CRC32CTables &GetCRC32CTables() {
+	static const CRC32CTables tables;
+	return tables;
+}
+
+static uint32_t CRC32CSoftware(uint32_t crc, const_data_ptr_t data, size_t size) {
+	auto &table = GetCRC32CTables().table;
+	while (size >= 8) {
+		uint64_t word = Load<uint64_t>(data) ^ crc;
+		crc = table[7][word & 0xff] ^ table[6][(word >> 8) & 0xff] ^ table[5][(word >> 16) & 0xff] ^
+		      table[4][(word >> 24) & 0xff] ^ table[3][(word >> 32) & 0xff] ^ table[2][(word >> 40) & 0xff] ^
+		      table[1][(word >> 48) & 0xff] ^ table[0][word >> 56];
+		data += 8;
+		size -= 8;
+	}
+	while (size > 0) {
+		crc = (crc >> 8) ^ table[0][(crc ^ *data) & 0xff];
+		data++;
+		size--;
+	}
+	return crc;
+}
+
+#if defined(DUCKDB_CRC32C_SSE42) || defined(DUCKDB_CRC32C_ARM)
+#ifdef DUCKDB_CRC32C_SSE42
+#define DUCKDB_CRC32C_TARGET __attribute__((target("sse4.2")))
+#define DUCKDB_CRC32C_U64(crc, word) static_cast<uint32_t>(_mm_crc32_u64(crc, word))
+#define DUCKDB_CRC32C_U8(crc, byte)  _mm_crc32_u8(crc, byte)
+
+static bool HasHardwareCRC32C() {
+	static const bool supported = []() {
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("sse4.2") != 0;
+	}();
+	return supported;
+}
+#else
+#define DUCKDB_CRC32C_TARGET
+#define DUCKDB_CRC32C_U64(crc, word) __crc32cd(crc, word)
+#define DUCKDB_CRC32C_U8(crc, byte)  __crc32cb(crc, byte)
+
+static bool HasHardwareCRC32C() {
+	return true;
+}
+#endif
+
+//! Computes the CRC of the blocks of three stripes at the start of the data
+template <size_t STRIPE_SIZE>
+DUCKDB_CRC32C_TARGET static uint32_t CRC32CStripes(uint32_t crc, const_data_ptr_t &data, size_t &size,
+                                                   uint32_t stripe_shift) {
+	// the CRC instruction has a latency of multiple cycles - compute three stripes at a time to keep the CPU busy
+	// the CRCs of the stripes are then combined by shifting them over the stripes that follow them
+	while (size >= 3 * STRIPE_SIZE) {
+		uint32_t crc1 = 0;
+		uint32_t crc2 = 0;
+		for (idx_t i = 0; i < STRIPE_SIZE; i += 8) {
+			crc = DUCKDB_CRC32C_U64(crc, Load<uint64_t>(data + i));
+			crc1 = DUCKDB_CRC32C_U64(crc1, Load<uint64_t>(data + STRIPE_SIZE + i));
+			crc2 = DUCKDB_CRC32C_U64(crc2, Load<uint64_t>(data + 2 * STRIPE_SIZE + i));
+		}
+		crc = CRC32CMultiply(stripe_shift, crc) ^ crc1;
+		crc = CRC32CMultiply(stripe_shift, crc) ^ crc2;
+		data += 3 * STRIPE_SIZE;
+		size -= 3 * STRIPE_SIZE;
+	}
+	return crc;
+}
+
+DUCKDB_CRC32C_TARGET static uint32_t CRC32CHardware(uint32_t crc, const_data_ptr_t data, size_t size) {
+	auto &tables = GetCRC32CTables();
+	crc = CRC32CStripes<CRC32C_LONG_STRIPE_SIZE>(crc, data, size, tables.long_stripe_shift);
+	crc = CRC32CStripes<CRC32C_SHORT_STRIPE_SIZE>(crc, data, size, tables.short_stripe_shift);
+	while (size >= 8) {
+		crc = DUCKDB_CRC32C_U64(crc, Load<uint64_t>(data));
+		data += 8;
+		size -= 8;
+	}
+	while (size > 0) {
+		crc = DUCKDB_CRC32C_U8(crc, *data);
+		data++;
+		size--;
+	}
+	return crc;
+}
+#endif
+
+uint32_t CRC32C(const_data_ptr_t buffer, size_t size) {
+	uint32_t crc = 0xffffffff;
+#if defined(DUCKDB_CRC32C_SSE42) || defined(DUCKDB_CRC32C_ARM)
+	if (HasHardwareCRC32C()) {
+		return ~CRC32CHardware(crc, buffer, size);
+	}
+#endif
+	return ~CRC32CSoftware(crc, buffer, size);
+}
+
 } // namespace duckdb
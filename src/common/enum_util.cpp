@@ -13,8 +13,10 @@
 #include "duckdb/catalog/catalog_entry/dependency/dependency_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_column_type.hpp"
 #include "duckdb/common/box_renderer.hpp"
+#include "duckdb/common/checksum.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
 #include "duckdb/common/enums/aggregate_handling.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/catalog_lookup_behavior.hpp"
 #include "duckdb/common/enums/catalog_type.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
@@ -45,6 +47,7 @@
 #include "duckdb/common/enums/physical_operator_type.hpp"
 #include "duckdb/common/enums/prepared_statement_mode.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
+#include "duckdb/common/enums/query_priority.hpp"
 #include "duckdb/common/enums/relation_type.hpp"
 #include "duckdb/common/enums/scan_options.hpp"
 #include "duckdb/common/enums/set_operation_type.hpp"
@@ -63,6 +66,7 @@
 #include "duckdb/common/extra_type_info.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/file_open_flags.hpp"
+#include "duckdb/common/hardware_counter_profiler.hpp"
 #include "duckdb/common/multi_file_list.hpp"
 #include "duckdb/common/operator/decimal_cast_operators.hpp"
 #include "duckdb/common/printer.hpp"
@@ -367,6 +371,8 @@ const char* EnumUtil::ToChars<AlterTableType>(AlterTableType value) {
 		return "DROP_NOT_NULL";
 	case AlterTableType::SET_COLUMN_COMMENT:
 		return "SET_COLUMN_COMMENT";
+	case AlterTableType::SET_CLUSTER_BY:
+		return "SET_CLUSTER_BY";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<AlterTableType>", value));
 	}
@@ -407,6 +413,9 @@ AlterTableType EnumUtil::FromString<AlterTableType>(const char *value) {
 	if (StringUtil::Equals(value, "SET_COLUMN_COMMENT")) {
 		return AlterTableType::SET_COLUMN_COMMENT;
 	}
+	if (StringUtil::Equals(value, "SET_CLUSTER_BY")) {
+		return AlterTableType::SET_CLUSTER_BY;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<AlterTableType>", value));
 }
 
@@ -722,6 +731,8 @@ const char* EnumUtil::ToChars<BitpackingMode>(BitpackingMode value) {
 		return "DELTA_FOR";
 	case BitpackingMode::FOR:
 		return "FOR";
+	case BitpackingMode::FOR_INTERLEAVED:
+		return "FOR_INTERLEAVED";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<BitpackingMode>", value));
 	}
@@ -747,6 +758,9 @@ BitpackingMode EnumUtil::FromString<BitpackingMode>(const char *value) {
 	if (StringUtil::Equals(value, "FOR")) {
 		return BitpackingMode::FOR;
 	}
+	if (StringUtil::Equals(value, "FOR_INTERLEAVED")) {
+		return BitpackingMode::FOR_INTERLEAVED;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<BitpackingMode>", value));
 }
 
@@ -773,6 +787,29 @@ BlockState EnumUtil::FromString<BlockState>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<BlockState>", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<BufferEvictionPolicy>(BufferEvictionPolicy value) {
+	switch(value) {
+	case BufferEvictionPolicy::LRU:
+		return "LRU";
+	case BufferEvictionPolicy::TWO_QUEUE:
+		return "TWO_QUEUE";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<BufferEvictionPolicy>", value));
+	}
+}
+
+template<>
+BufferEvictionPolicy EnumUtil::FromString<BufferEvictionPolicy>(const char *value) {
+	if (StringUtil::Equals(value, "LRU")) {
+		return BufferEvictionPolicy::LRU;
+	}
+	if (StringUtil::Equals(value, "TWO_QUEUE")) {
+		return BufferEvictionPolicy::TWO_QUEUE;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<BufferEvictionPolicy>", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<CAPIResultSetType>(CAPIResultSetType value) {
 	switch(value) {
@@ -1096,6 +1133,29 @@ CheckpointAbort EnumUtil::FromString<CheckpointAbort>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<CheckpointAbort>", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<ChecksumType>(ChecksumType value) {
+	switch(value) {
+	case ChecksumType::LEGACY:
+		return "LEGACY";
+	case ChecksumType::CRC32C:
+		return "CRC32C";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<ChecksumType>", value));
+	}
+}
+
+template<>
+ChecksumType EnumUtil::FromString<ChecksumType>(const char *value) {
+	if (StringUtil::Equals(value, "LEGACY")) {
+		return ChecksumType::LEGACY;
+	}
+	if (StringUtil::Equals(value, "CRC32C")) {
+		return ChecksumType::CRC32C;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<ChecksumType>", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<ChunkInfoType>(ChunkInfoType value) {
 	switch(value) {
@@ -1105,6 +1165,8 @@ const char* EnumUtil::ToChars<ChunkInfoType>(ChunkInfoType value) {
 		return "VECTOR_INFO";
 	case ChunkInfoType::EMPTY_INFO:
 		return "EMPTY_INFO";
+	case ChunkInfoType::BITMAP_INFO:
+		return "BITMAP_INFO";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<ChunkInfoType>", value));
 	}
@@ -1121,6 +1183,9 @@ ChunkInfoType EnumUtil::FromString<ChunkInfoType>(const char *value) {
 	if (StringUtil::Equals(value, "EMPTY_INFO")) {
 		return ChunkInfoType::EMPTY_INFO;
 	}
+	if (StringUtil::Equals(value, "BITMAP_INFO")) {
+		return ChunkInfoType::BITMAP_INFO;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<ChunkInfoType>", value));
 }
 
@@ -1258,6 +1323,10 @@ const char* EnumUtil::ToChars<CompressionType>(CompressionType value) {
 		return "COMPRESSION_ALP";
 	case CompressionType::COMPRESSION_ALPRD:
 		return "COMPRESSION_ALPRD";
+	case CompressionType::COMPRESSION_ZSTD:
+		return "COMPRESSION_ZSTD";
+	case CompressionType::COMPRESSION_DELTA:
+		return "COMPRESSION_DELTA";
 	case CompressionType::COMPRESSION_COUNT:
 		return "COMPRESSION_COUNT";
 	default:
@@ -1303,6 +1372,12 @@ CompressionType EnumUtil::FromString<CompressionType>(const char *value) {
 	if (StringUtil::Equals(value, "COMPRESSION_ALPRD")) {
 		return CompressionType::COMPRESSION_ALPRD;
 	}
+	if (StringUtil::Equals(value, "COMPRESSION_ZSTD")) {
+		return CompressionType::COMPRESSION_ZSTD;
+	}
+	if (StringUtil::Equals(value, "COMPRESSION_DELTA")) {
+		return CompressionType::COMPRESSION_DELTA;
+	}
 	if (StringUtil::Equals(value, "COMPRESSION_COUNT")) {
 		return CompressionType::COMPRESSION_COUNT;
 	}
@@ -3293,6 +3368,29 @@ GateStatus EnumUtil::FromString<GateStatus>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<GateStatus>", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<HLLSketchFormat>(HLLSketchFormat value) {
+	switch(value) {
+	case HLLSketchFormat::SPARSE:
+		return "SPARSE";
+	case HLLSketchFormat::DENSE:
+		return "DENSE";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<HLLSketchFormat>", value));
+	}
+}
+
+template<>
+HLLSketchFormat EnumUtil::FromString<HLLSketchFormat>(const char *value) {
+	if (StringUtil::Equals(value, "SPARSE")) {
+		return HLLSketchFormat::SPARSE;
+	}
+	if (StringUtil::Equals(value, "DENSE")) {
+		return HLLSketchFormat::DENSE;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<HLLSketchFormat>", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<HLLStorageType>(HLLStorageType value) {
 	switch(value) {
@@ -3316,6 +3414,39 @@ HLLStorageType EnumUtil::FromString<HLLStorageType>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<HLLStorageType>", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<HardwareCounter>(HardwareCounter value) {
+	switch(value) {
+	case HardwareCounter::CPU_CYCLES:
+		return "CPU_CYCLES";
+	case HardwareCounter::INSTRUCTIONS:
+		return "INSTRUCTIONS";
+	case HardwareCounter::CACHE_MISSES:
+		return "CACHE_MISSES";
+	case HardwareCounter::BRANCH_MISSES:
+		return "BRANCH_MISSES";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<HardwareCounter>", value));
+	}
+}
+
+template<>
+HardwareCounter EnumUtil::FromString<HardwareCounter>(const char *value) {
+	if (StringUtil::Equals(value, "CPU_CYCLES")) {
+		return HardwareCounter::CPU_CYCLES;
+	}
+	if (StringUtil::Equals(value, "INSTRUCTIONS")) {
+		return HardwareCounter::INSTRUCTIONS;
+	}
+	if (StringUtil::Equals(value, "CACHE_MISSES")) {
+		return HardwareCounter::CACHE_MISSES;
+	}
+	if (StringUtil::Equals(value, "BRANCH_MISSES")) {
+		return HardwareCounter::BRANCH_MISSES;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<HardwareCounter>", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<IndexConstraintType>(IndexConstraintType value) {
 	switch(value) {
@@ -4391,6 +4522,24 @@ const char* EnumUtil::ToChars<MetricsType>(MetricsType value) {
 		return "OPERATOR_TIMING";
 	case MetricsType::RESULT_SET_SIZE:
 		return "RESULT_SET_SIZE";
+	case MetricsType::PEAK_QUERY_MEMORY:
+		return "PEAK_QUERY_MEMORY";
+	case MetricsType::TEMPORARY_BYTES_WRITTEN:
+		return "TEMPORARY_BYTES_WRITTEN";
+	case MetricsType::OPERATOR_CPU_CYCLES:
+		return "OPERATOR_CPU_CYCLES";
+	case MetricsType::OPERATOR_INSTRUCTIONS:
+		return "OPERATOR_INSTRUCTIONS";
+	case MetricsType::OPERATOR_CACHE_MISSES:
+		return "OPERATOR_CACHE_MISSES";
+	case MetricsType::OPERATOR_BRANCH_MISSES:
+		return "OPERATOR_BRANCH_MISSES";
+	case MetricsType::OPERATOR_BYTES_READ:
+		return "OPERATOR_BYTES_READ";
+	case MetricsType::OPERATOR_READ_OPERATIONS:
+		return "OPERATOR_READ_OPERATIONS";
+	case MetricsType::OPERATOR_READ_TIME:
+		return "OPERATOR_READ_TIME";
 	case MetricsType::ALL_OPTIMIZERS:
 		return "ALL_OPTIMIZERS";
 	case MetricsType::CUMULATIVE_OPTIMIZER_TIMING:
@@ -4407,6 +4556,10 @@ const char* EnumUtil::ToChars<MetricsType>(MetricsType value) {
 		return "PHYSICAL_PLANNER_RESOLVE_TYPES";
 	case MetricsType::PHYSICAL_PLANNER_CREATE_PLAN:
 		return "PHYSICAL_PLANNER_CREATE_PLAN";
+	case MetricsType::JOIN_ORDER_EXACT_ENUMERATION:
+		return "JOIN_ORDER_EXACT_ENUMERATION";
+	case MetricsType::JOIN_ORDER_APPROXIMATE_ENUMERATION:
+		return "JOIN_ORDER_APPROXIMATE_ENUMERATION";
 	case MetricsType::OPTIMIZER_EXPRESSION_REWRITER:
 		return "OPTIMIZER_EXPRESSION_REWRITER";
 	case MetricsType::OPTIMIZER_FILTER_PULLUP:
@@ -4453,6 +4606,12 @@ const char* EnumUtil::ToChars<MetricsType>(MetricsType value) {
 		return "OPTIMIZER_EXTENSION";
 	case MetricsType::OPTIMIZER_MATERIALIZED_CTE:
 		return "OPTIMIZER_MATERIALIZED_CTE";
+	case MetricsType::OPTIMIZER_EAGER_AGGREGATE:
+		return "OPTIMIZER_EAGER_AGGREGATE";
+	case MetricsType::OPTIMIZER_JOIN_ELIMINATION:
+		return "OPTIMIZER_JOIN_ELIMINATION";
+	case MetricsType::OPTIMIZER_SAMPLING_PUSHDOWN:
+		return "OPTIMIZER_SAMPLING_PUSHDOWN";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<MetricsType>", value));
 	}
@@ -4493,6 +4652,33 @@ MetricsType EnumUtil::FromString<MetricsType>(const char *value) {
 	if (StringUtil::Equals(value, "RESULT_SET_SIZE")) {
 		return MetricsType::RESULT_SET_SIZE;
 	}
+	if (StringUtil::Equals(value, "PEAK_QUERY_MEMORY")) {
+		return MetricsType::PEAK_QUERY_MEMORY;
+	}
+	if (StringUtil::Equals(value, "TEMPORARY_BYTES_WRITTEN")) {
+		return MetricsType::TEMPORARY_BYTES_WRITTEN;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_CPU_CYCLES")) {
+		return MetricsType::OPERATOR_CPU_CYCLES;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_INSTRUCTIONS")) {
+		return MetricsType::OPERATOR_INSTRUCTIONS;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_CACHE_MISSES")) {
+		return MetricsType::OPERATOR_CACHE_MISSES;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_BRANCH_MISSES")) {
+		return MetricsType::OPERATOR_BRANCH_MISSES;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_BYTES_READ")) {
+		return MetricsType::OPERATOR_BYTES_READ;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_READ_OPERATIONS")) {
+		return MetricsType::OPERATOR_READ_OPERATIONS;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_READ_TIME")) {
+		return MetricsType::OPERATOR_READ_TIME;
+	}
 	if (StringUtil::Equals(value, "ALL_OPTIMIZERS")) {
 		return MetricsType::ALL_OPTIMIZERS;
 	}
@@ -4517,6 +4703,12 @@ MetricsType EnumUtil::FromString<MetricsType>(const char *value) {
 	if (StringUtil::Equals(value, "PHYSICAL_PLANNER_CREATE_PLAN")) {
 		return MetricsType::PHYSICAL_PLANNER_CREATE_PLAN;
 	}
+	if (StringUtil::Equals(value, "JOIN_ORDER_EXACT_ENUMERATION")) {
+		return MetricsType::JOIN_ORDER_EXACT_ENUMERATION;
+	}
+	if (StringUtil::Equals(value, "JOIN_ORDER_APPROXIMATE_ENUMERATION")) {
+		return MetricsType::JOIN_ORDER_APPROXIMATE_ENUMERATION;
+	}
 	if (StringUtil::Equals(value, "OPTIMIZER_EXPRESSION_REWRITER")) {
 		return MetricsType::OPTIMIZER_EXPRESSION_REWRITER;
 	}
@@ -4586,6 +4778,15 @@ MetricsType EnumUtil::FromString<MetricsType>(const char *value) {
 	if (StringUtil::Equals(value, "OPTIMIZER_MATERIALIZED_CTE")) {
 		return MetricsType::OPTIMIZER_MATERIALIZED_CTE;
 	}
+	if (StringUtil::Equals(value, "OPTIMIZER_EAGER_AGGREGATE")) {
+		return MetricsType::OPTIMIZER_EAGER_AGGREGATE;
+	}
+	if (StringUtil::Equals(value, "OPTIMIZER_JOIN_ELIMINATION")) {
+		return MetricsType::OPTIMIZER_JOIN_ELIMINATION;
+	}
+	if (StringUtil::Equals(value, "OPTIMIZER_SAMPLING_PUSHDOWN")) {
+		return MetricsType::OPTIMIZER_SAMPLING_PUSHDOWN;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<MetricsType>", value));
 }
 
@@ -4881,6 +5082,12 @@ const char* EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 		return "EXTENSION";
 	case OptimizerType::MATERIALIZED_CTE:
 		return "MATERIALIZED_CTE";
+	case OptimizerType::EAGER_AGGREGATE:
+		return "EAGER_AGGREGATE";
+	case OptimizerType::JOIN_ELIMINATION:
+		return "JOIN_ELIMINATION";
+	case OptimizerType::SAMPLING_PUSHDOWN:
+		return "SAMPLING_PUSHDOWN";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<OptimizerType>", value));
 	}
@@ -4960,6 +5167,15 @@ OptimizerType EnumUtil::FromString<OptimizerType>(const char *value) {
 	if (StringUtil::Equals(value, "MATERIALIZED_CTE")) {
 		return OptimizerType::MATERIALIZED_CTE;
 	}
+	if (StringUtil::Equals(value, "EAGER_AGGREGATE")) {
+		return OptimizerType::EAGER_AGGREGATE;
+	}
+	if (StringUtil::Equals(value, "JOIN_ELIMINATION")) {
+		return OptimizerType::JOIN_ELIMINATION;
+	}
+	if (StringUtil::Equals(value, "SAMPLING_PUSHDOWN")) {
+		return OptimizerType::SAMPLING_PUSHDOWN;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<OptimizerType>", value));
 }
 
@@ -5358,6 +5574,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "LIMIT_PERCENT";
 	case PhysicalOperatorType::TOP_N:
 		return "TOP_N";
+	case PhysicalOperatorType::GROUPED_TOP_N:
+		return "GROUPED_TOP_N";
 	case PhysicalOperatorType::WINDOW:
 		return "WINDOW";
 	case PhysicalOperatorType::UNNEST:
@@ -5368,6 +5586,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "HASH_GROUP_BY";
 	case PhysicalOperatorType::PERFECT_HASH_GROUP_BY:
 		return "PERFECT_HASH_GROUP_BY";
+	case PhysicalOperatorType::STREAMING_GROUP_BY:
+		return "STREAMING_GROUP_BY";
 	case PhysicalOperatorType::FILTER:
 		return "FILTER";
 	case PhysicalOperatorType::PROJECTION:
@@ -5414,6 +5634,10 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "CROSS_PRODUCT";
 	case PhysicalOperatorType::PIECEWISE_MERGE_JOIN:
 		return "PIECEWISE_MERGE_JOIN";
+	case PhysicalOperatorType::MERGE_JOIN:
+		return "MERGE_JOIN";
+	case PhysicalOperatorType::MULTIWAY_JOIN:
+		return "MULTIWAY_JOIN";
 	case PhysicalOperatorType::IE_JOIN:
 		return "IE_JOIN";
 	case PhysicalOperatorType::LEFT_DELIM_JOIN:
@@ -5424,6 +5648,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "POSITIONAL_JOIN";
 	case PhysicalOperatorType::ASOF_JOIN:
 		return "ASOF_JOIN";
+	case PhysicalOperatorType::INDEX_JOIN:
+		return "INDEX_JOIN";
 	case PhysicalOperatorType::UNION:
 		return "UNION";
 	case PhysicalOperatorType::RECURSIVE_CTE:
@@ -5527,6 +5753,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "TOP_N")) {
 		return PhysicalOperatorType::TOP_N;
 	}
+	if (StringUtil::Equals(value, "GROUPED_TOP_N")) {
+		return PhysicalOperatorType::GROUPED_TOP_N;
+	}
 	if (StringUtil::Equals(value, "WINDOW")) {
 		return PhysicalOperatorType::WINDOW;
 	}
@@ -5542,6 +5771,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "PERFECT_HASH_GROUP_BY")) {
 		return PhysicalOperatorType::PERFECT_HASH_GROUP_BY;
 	}
+	if (StringUtil::Equals(value, "STREAMING_GROUP_BY")) {
+		return PhysicalOperatorType::STREAMING_GROUP_BY;
+	}
 	if (StringUtil::Equals(value, "FILTER")) {
 		return PhysicalOperatorType::FILTER;
 	}
@@ -5611,6 +5843,12 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "PIECEWISE_MERGE_JOIN")) {
 		return PhysicalOperatorType::PIECEWISE_MERGE_JOIN;
 	}
+	if (StringUtil::Equals(value, "MERGE_JOIN")) {
+		return PhysicalOperatorType::MERGE_JOIN;
+	}
+	if (StringUtil::Equals(value, "MULTIWAY_JOIN")) {
+		return PhysicalOperatorType::MULTIWAY_JOIN;
+	}
 	if (StringUtil::Equals(value, "IE_JOIN")) {
 		return PhysicalOperatorType::IE_JOIN;
 	}
@@ -5626,6 +5864,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "ASOF_JOIN")) {
 		return PhysicalOperatorType::ASOF_JOIN;
 	}
+	if (StringUtil::Equals(value, "INDEX_JOIN")) {
+		return PhysicalOperatorType::INDEX_JOIN;
+	}
 	if (StringUtil::Equals(value, "UNION")) {
 		return PhysicalOperatorType::UNION;
 	}
@@ -6052,6 +6293,34 @@ QueryNodeType EnumUtil::FromString<QueryNodeType>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<QueryNodeType>", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<QueryPriority>(QueryPriority value) {
+	switch(value) {
+	case QueryPriority::LOW:
+		return "LOW";
+	case QueryPriority::NORMAL:
+		return "NORMAL";
+	case QueryPriority::HIGH:
+		return "HIGH";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<QueryPriority>", value));
+	}
+}
+
+template<>
+QueryPriority EnumUtil::FromString<QueryPriority>(const char *value) {
+	if (StringUtil::Equals(value, "LOW")) {
+		return QueryPriority::LOW;
+	}
+	if (StringUtil::Equals(value, "NORMAL")) {
+		return QueryPriority::NORMAL;
+	}
+	if (StringUtil::Equals(value, "HIGH")) {
+		return QueryPriority::HIGH;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<QueryPriority>", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<QueryResultType>(QueryResultType value) {
 	switch(value) {
@@ -7412,6 +7681,12 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::BLOOM_FILTER:
+		return "BLOOM_FILTER";
+	case TableFilterType::IN_FILTER:
+		return "IN_FILTER";
+	case TableFilterType::DYNAMIC_FILTER:
+		return "DYNAMIC_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<TableFilterType>", value));
 	}
@@ -7437,6 +7712,15 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "BLOOM_FILTER")) {
+		return TableFilterType::BLOOM_FILTER;
+	}
+	if (StringUtil::Equals(value, "IN_FILTER")) {
+		return TableFilterType::IN_FILTER;
+	}
+	if (StringUtil::Equals(value, "DYNAMIC_FILTER")) {
+		return TableFilterType::DYNAMIC_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<TableFilterType>", value));
 }
 
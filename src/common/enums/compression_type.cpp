@@ -44,6 +44,10 @@ CompressionType CompressionTypeFromString(const string &str) {
 		return CompressionType::COMPRESSION_ALP;
 	} else if (compression == "alprd") {
 		return CompressionType::COMPRESSION_ALPRD;
+	} else if (compression == "zstd") {
+		return CompressionType::COMPRESSION_ZSTD;
+	} else if (compression == "delta") {
+		return CompressionType::COMPRESSION_DELTA;
 	} else {
 		return CompressionType::COMPRESSION_AUTO;
 	}
@@ -75,6 +79,10 @@ string CompressionTypeToString(CompressionType type) {
 		return "ALP";
 	case CompressionType::COMPRESSION_ALPRD:
 		return "ALPRD";
+	case CompressionType::COMPRESSION_ZSTD:
+		return "ZSTD";
+	case CompressionType::COMPRESSION_DELTA:
+		return "Delta";
 	default:
 		throw InternalException("Unrecognized compression type!");
 	}
@@ -36,6 +36,9 @@ profiler_settings_t MetricsUtils::GetOptimizerMetrics() {
         MetricsType::OPTIMIZER_JOIN_FILTER_PUSHDOWN,
         MetricsType::OPTIMIZER_EXTENSION,
         MetricsType::OPTIMIZER_MATERIALIZED_CTE,
+        MetricsType::OPTIMIZER_EAGER_AGGREGATE,
+        MetricsType::OPTIMIZER_JOIN_ELIMINATION,
+        MetricsType::OPTIMIZER_SAMPLING_PUSHDOWN,
     };
 }
 
@@ -49,6 +52,8 @@ profiler_settings_t MetricsUtils::GetPhaseTimingMetrics() {
         MetricsType::PHYSICAL_PLANNER_COLUMN_BINDING,
         MetricsType::PHYSICAL_PLANNER_RESOLVE_TYPES,
         MetricsType::PHYSICAL_PLANNER_CREATE_PLAN,
+        MetricsType::JOIN_ORDER_EXACT_ENUMERATION,
+        MetricsType::JOIN_ORDER_APPROXIMATE_ENUMERATION,
     };
 }
 
@@ -100,6 +105,12 @@ MetricsType MetricsUtils::GetOptimizerMetricByType(OptimizerType type) {
             return MetricsType::OPTIMIZER_EXTENSION;
         case OptimizerType::MATERIALIZED_CTE:
             return MetricsType::OPTIMIZER_MATERIALIZED_CTE;
+        case OptimizerType::EAGER_AGGREGATE:
+            return MetricsType::OPTIMIZER_EAGER_AGGREGATE;
+        case OptimizerType::JOIN_ELIMINATION:
+            return MetricsType::OPTIMIZER_JOIN_ELIMINATION;
+        case OptimizerType::SAMPLING_PUSHDOWN:
+            return MetricsType::OPTIMIZER_SAMPLING_PUSHDOWN;
        default:
             throw InternalException("OptimizerType %s cannot be converted to a MetricsType", EnumUtil::ToString(type));
     };
@@ -153,6 +164,12 @@ OptimizerType MetricsUtils::GetOptimizerTypeByMetric(MetricsType type) {
             return OptimizerType::EXTENSION;
         case MetricsType::OPTIMIZER_MATERIALIZED_CTE:
             return OptimizerType::MATERIALIZED_CTE;
+        case MetricsType::OPTIMIZER_EAGER_AGGREGATE:
+            return OptimizerType::EAGER_AGGREGATE;
+        case MetricsType::OPTIMIZER_JOIN_ELIMINATION:
+            return OptimizerType::JOIN_ELIMINATION;
+        case MetricsType::OPTIMIZER_SAMPLING_PUSHDOWN:
+            return OptimizerType::SAMPLING_PUSHDOWN;
     default:
             return OptimizerType::INVALID;
     };
@@ -183,6 +200,9 @@ bool MetricsUtils::IsOptimizerMetric(MetricsType type) {
         case MetricsType::OPTIMIZER_JOIN_FILTER_PUSHDOWN:
         case MetricsType::OPTIMIZER_EXTENSION:
         case MetricsType::OPTIMIZER_MATERIALIZED_CTE:
+        case MetricsType::OPTIMIZER_EAGER_AGGREGATE:
+        case MetricsType::OPTIMIZER_JOIN_ELIMINATION:
+        case MetricsType::OPTIMIZER_SAMPLING_PUSHDOWN:
             return true;
         default:
             return false;
@@ -199,6 +219,8 @@ bool MetricsUtils::IsPhaseTimingMetric(MetricsType type) {
         case MetricsType::PHYSICAL_PLANNER_COLUMN_BINDING:
         case MetricsType::PHYSICAL_PLANNER_RESOLVE_TYPES:
         case MetricsType::PHYSICAL_PLANNER_CREATE_PLAN:
+        case MetricsType::JOIN_ORDER_EXACT_ENUMERATION:
+        case MetricsType::JOIN_ORDER_APPROXIMATE_ENUMERATION:
             return true;
         default:
             return false;
@@ -35,6 +35,9 @@ static const DefaultOptimizerType internal_optimizer_types[] = {
     {"join_filter_pushdown", OptimizerType::JOIN_FILTER_PUSHDOWN},
     {"extension", OptimizerType::EXTENSION},
     {"materialized_cte", OptimizerType::MATERIALIZED_CTE},
+    {"eager_aggregate", OptimizerType::EAGER_AGGREGATE},
+    {"join_elimination", OptimizerType::JOIN_ELIMINATION},
+    {"sampling_pushdown", OptimizerType::SAMPLING_PUSHDOWN},
     {nullptr, OptimizerType::INVALID}};
 
 string OptimizerTypeToString(OptimizerType type) {
@@ -5,6 +5,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/numa.hpp"
 #include "duckdb/storage/storage_info.hpp"
 #include <cstring>
 
@@ -23,6 +24,7 @@ void FileBuffer::Init() {
 	size = 0;
 	internal_buffer = nullptr;
 	internal_size = 0;
+	numa_node = 0;
 }
 
 FileBuffer::FileBuffer(FileBuffer &source, FileBufferType type_p) : allocator(source.allocator), type(type_p) {
@@ -31,6 +33,7 @@ FileBuffer::FileBuffer(FileBuffer &source, FileBufferType type_p) : allocator(so
 	size = source.size;
 	internal_buffer = source.internal_buffer;
 	internal_size = source.internal_size;
+	numa_node = source.numa_node;
 
 	source.Init();
 }
@@ -54,6 +57,7 @@ void FileBuffer::ReallocBuffer(size_t new_size) {
 	}
 	internal_buffer = new_buffer;
 	internal_size = new_size;
+	numa_node = NumaTopology::GetCurrentNode();
 	// Caller must update these.
 	buffer = nullptr;
 	size = 0;
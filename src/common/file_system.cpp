@@ -1,5 +1,6 @@
 #include "duckdb/common/file_system.hpp"
 
+#include "duckdb/common/async_file_read.hpp"
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/file_opener.hpp"
@@ -386,6 +387,15 @@ int64_t FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 int64_t FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	throw NotImplementedException("%s: Write is not implemented!", GetName());
 }
+// LCOV_EXCL_STOP
+
+shared_ptr<AsyncFileRead> FileSystem::ReadAsync(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	auto read = make_shared_ptr<AsyncFileRead>(*this, handle, buffer, nr_bytes, location);
+	read->Execute();
+	return read;
+}
+
+// LCOV_EXCL_START
 
 int64_t FileSystem::GetFileSize(FileHandle &handle) {
 	throw NotImplementedException("%s: GetFileSize is not implemented!", GetName());
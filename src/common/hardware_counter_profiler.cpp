@@ -0,0 +1,119 @@
+#include "duckdb/common/hardware_counter_profiler.hpp"
+
+#include "duckdb/common/helper.hpp"
+
+#if defined(__linux__) && !defined(DUCKDB_WASM)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define DUCKDB_PERF_EVENTS
+#endif
+
+namespace duckdb {
+
+#ifdef DUCKDB_PERF_EVENTS
+//! The performance events of a single thread, opened as one group so all counters are read with a single syscall
+struct PerfEventGroup {
+	PerfEventGroup() : leader(-1), counter_count(0) {
+		static const uint64_t CONFIGS[HARDWARE_COUNTER_COUNT] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+		                                                         PERF_COUNT_HW_CACHE_MISSES,
+		                                                         PERF_COUNT_HW_BRANCH_MISSES};
+		for (idx_t i = 0; i < HARDWARE_COUNTER_COUNT; i++) {
+			struct perf_event_attr attr;
+			memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.type = PERF_TYPE_HARDWARE;
+			attr.config = CONFIGS[i];
+			attr.read_format = PERF_FORMAT_GROUP;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			attr.disabled = leader < 0 ? 1 : 0;
+			// count the calling thread on any CPU
+			auto fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0));
+			if (fd < 0) {
+				if (leader < 0) {
+					// without the leader there is no group: the counters are unavailable
+					return;
+				}
+				// this event is not supported by the CPU, skip it
+				continue;
+			}
+			if (leader < 0) {
+				leader = fd;
+			} else {
+				fds[counter_count] = fd;
+			}
+			counters[counter_count++] = static_cast<uint8_t>(i);
+		}
+		ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+	~PerfEventGroup() {
+		for (idx_t i = 1; i < counter_count; i++) {
+			close(fds[i]);
+		}
+		if (leader >= 0) {
+			close(leader);
+		}
+	}
+
+	bool Available() const {
+		return leader >= 0;
+	}
+
+	void Read(hardware_counter_values_t &values) const {
+		// with PERF_FORMAT_GROUP the read returns the number of events followed by the value of every event
+		uint64_t buffer[1 + HARDWARE_COUNTER_COUNT];
+		auto expected_size = static_cast<ssize_t>(sizeof(uint64_t) * (1 + counter_count));
+		if (read(leader, buffer, sizeof(buffer)) != expected_size) {
+			values.fill(0);
+			return;
+		}
+		for (idx_t i = 0; i < counter_count; i++) {
+			values[counters[i]] = buffer[1 + i];
+		}
+	}
+
+	int leader;
+	int fds[HARDWARE_COUNTER_COUNT];
+	//! The counter that is measured by each opened event
+	uint8_t counters[HARDWARE_COUNTER_COUNT];
+	idx_t counter_count;
+};
+
+static PerfEventGroup &GetThreadPerfEvents() {
+	// the events measure the thread that opened them, so every thread opens its own group on first use
+	static thread_local PerfEventGroup events;
+	return events;
+}
+
+bool HardwareCounterProfiler::Start() {
+	auto &events = GetThreadPerfEvents();
+	if (!events.Available()) {
+		return false;
+	}
+	start.fill(0);
+	events.Read(start);
+	return true;
+}
+
+void HardwareCounterProfiler::End() {
+	end.fill(0);
+	GetThreadPerfEvents().Read(end);
+}
+#else
+bool HardwareCounterProfiler::Start() {
+	return false;
+}
+
+void HardwareCounterProfiler::End() {
+}
+#endif
+
+uint64_t HardwareCounterProfiler::Elapsed(HardwareCounter counter) const {
+	auto index = static_cast<idx_t>(counter);
+	return end[index] >= start[index] ? end[index] - start[index] : 0;
+}
+
+} // namespace duckdb
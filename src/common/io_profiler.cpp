@@ -0,0 +1,65 @@
+#include "duckdb/common/io_profiler.hpp"
+
+#include "duckdb/main/query_telemetry.hpp"
+
+namespace duckdb {
+
+//! The reads of the current thread since it started
+static thread_local IOStatistics thread_statistics;
+
+void IOProfiler::RecordRead(idx_t bytes, time_point<std::chrono::steady_clock> read_start, bool remote) {
+	auto elapsed = std::chrono::steady_clock::now() - read_start;
+	auto read_time = static_cast<idx_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+	thread_statistics.bytes_read += bytes;
+	thread_statistics.read_operations++;
+	thread_statistics.read_time += read_time;
+
+	auto telemetry = QueryTelemetry::GetActive();
+	if (telemetry) {
+		telemetry->AddRead(bytes, read_time, remote);
+	}
+}
+
+void IOProfiler::RecordBufferPin(bool hit) {
+	auto telemetry = QueryTelemetry::GetActive();
+	if (telemetry) {
+		telemetry->AddBufferPin(hit);
+	}
+}
+
+void IOProfiler::RecordPrefetchWaste(idx_t bytes) {
+	auto telemetry = QueryTelemetry::GetActive();
+	if (telemetry) {
+		telemetry->AddPrefetchWaste(bytes);
+	}
+}
+
+idx_t IOProfiler::GetLatencyBucket(idx_t read_time) {
+	// the first bucket ends at 16us, every next bucket is 4x wider
+	idx_t bucket_end = 16000;
+	for (idx_t bucket = 0; bucket + 1 < IO_LATENCY_BUCKET_COUNT; bucket++) {
+		if (read_time < bucket_end) {
+			return bucket;
+		}
+		bucket_end *= 4;
+	}
+	return IO_LATENCY_BUCKET_COUNT - 1;
+}
+
+const char *IOProfiler::GetLatencyBucketName(idx_t bucket) {
+	static const char *NAMES[IO_LATENCY_BUCKET_COUNT] = {"<16us", "<64us", "<256us", "<1ms",
+	                                                     "<4ms",  "<16ms", "<64ms",  ">=64ms"};
+	return NAMES[bucket];
+}
+
+void IOProfiler::Start() {
+	start = thread_statistics;
+}
+
+void IOProfiler::End() {
+	elapsed.bytes_read = thread_statistics.bytes_read - start.bytes_read;
+	elapsed.read_operations = thread_statistics.read_operations - start.read_operations;
+	elapsed.read_time = thread_statistics.read_time - start.read_time;
+}
+
+} // namespace duckdb
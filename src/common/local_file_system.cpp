@@ -4,11 +4,13 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/io_profiler.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/windows.hpp"
 #include "duckdb/function/scalar/string_functions.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/storage/storage_info.hpp"
 
 #include <cstdint>
 #include <cstdio>
@@ -129,13 +131,16 @@ bool LocalFileSystem::IsPipe(const string &filename, optional_ptr<FileOpener> op
 
 struct UnixFileHandle : public FileHandle {
 public:
-	UnixFileHandle(FileSystem &file_system, string path, int fd) : FileHandle(file_system, std::move(path)), fd(fd) {
+	UnixFileHandle(FileSystem &file_system, string path, int fd, bool direct_io = false)
+	    : FileHandle(file_system, std::move(path)), fd(fd), direct_io(direct_io) {
 	}
 	~UnixFileHandle() override {
 		UnixFileHandle::Close();
 	}
 
 	int fd;
+	//! Whether the file was opened with O_DIRECT, which requires aligned reads and writes
+	bool direct_io;
 
 public:
 	void Close() override {
@@ -339,6 +344,12 @@ unique_ptr<FileHandle> LocalFileSystem::OpenFile(const string &path_p, FileOpenF
 
 	// Open the file
 	int fd = open(path.c_str(), open_flags, filesec);
+	bool direct_io = flags.DirectIO() && O_DIRECT != 0;
+	if (fd == -1 && errno == EINVAL && direct_io) {
+		// the file system does not support O_DIRECT (e.g. older tmpfs) - fall back to going through the page cache
+		direct_io = false;
+		fd = open(path.c_str(), open_flags & ~O_DIRECT, filesec);
+	}
 
 	if (fd == -1) {
 		if (flags.ReturnNullIfNotExists() && errno == ENOENT) {
@@ -349,15 +360,16 @@ unique_ptr<FileHandle> LocalFileSystem::OpenFile(const string &path_p, FileOpenF
 		}
 		throw IOException("Cannot open file \"%s\": %s", {{"errno", std::to_string(errno)}}, path, strerror(errno));
 	}
-	// #if defined(__DARWIN__) || defined(__APPLE__)
-	// 	if (flags & FileFlags::FILE_FLAGS_DIRECT_IO) {
-	// 		// OSX requires fcntl for Direct IO
-	// 		rc = fcntl(fd, F_NOCACHE, 1);
-	// 		if (fd == -1) {
-	// 			throw IOException("Could not enable direct IO for file \"%s\": %s", path, strerror(errno));
-	// 		}
-	// 	}
-	// #endif
+#if defined(__DARWIN__) || defined(__APPLE__)
+	if (flags.DirectIO()) {
+		// OSX requires fcntl for Direct IO
+		rc = fcntl(fd, F_NOCACHE, 1);
+		if (rc == -1) {
+			close(fd);
+			throw IOException("Could not enable direct IO for file \"%s\": %s", path, strerror(errno));
+		}
+	}
+#endif
 	if (flags.Lock() != FileLockType::NO_LOCK) {
 		// set lock on file
 		// but only if it is not an input/output stream
@@ -417,7 +429,7 @@ unique_ptr<FileHandle> LocalFileSystem::OpenFile(const string &path_p, FileOpenF
 			}
 		}
 	}
-	return make_uniq<UnixFileHandle>(*this, path, fd);
+	return make_uniq<UnixFileHandle>(*this, path, fd, direct_io);
 }
 
 void LocalFileSystem::SetFilePointer(FileHandle &handle, idx_t location) {
@@ -439,8 +451,75 @@ idx_t LocalFileSystem::GetFilePointer(FileHandle &handle) {
 	return UnsafeNumericCast<idx_t>(position);
 }
 
+//! O_DIRECT requires the buffer, the size and the location of reads and writes to be aligned to the sector size
+static bool IsDirectIOAligned(const void *buffer, idx_t nr_bytes, idx_t location) {
+	return reinterpret_cast<uintptr_t>(buffer) % Storage::SECTOR_SIZE == 0 && nr_bytes % Storage::SECTOR_SIZE == 0 &&
+	       location % Storage::SECTOR_SIZE == 0;
+}
+
+//! A sector-aligned buffer for reads and writes that are not aligned on a file opened with O_DIRECT
+class DirectIOBounceBuffer {
+public:
+	explicit DirectIOBounceBuffer(idx_t size) : buffer(nullptr) {
+		if (posix_memalign(&buffer, Storage::SECTOR_SIZE, size) != 0) {
+			throw std::bad_alloc();
+		}
+	}
+	~DirectIOBounceBuffer() {
+		free(buffer);
+	}
+
+	data_ptr_t Get() {
+		return static_cast<data_ptr_t>(buffer);
+	}
+
+private:
+	void *buffer;
+};
+
+//! Reads up to nr_bytes, returns how many bytes were read before reaching the end of the file
+static idx_t ReadUntilEndOfFile(FileHandle &handle, int fd, data_ptr_t buffer, idx_t nr_bytes, idx_t location) {
+	idx_t total_bytes_read = 0;
+	while (total_bytes_read < nr_bytes) {
+		int64_t bytes_read = pread(fd, buffer + total_bytes_read, nr_bytes - total_bytes_read,
+		                           UnsafeNumericCast<off_t>(location + total_bytes_read));
+		if (bytes_read == -1) {
+			throw IOException("Could not read from file \"%s\": %s", {{"errno", std::to_string(errno)}}, handle.path,
+			                  strerror(errno));
+		}
+		if (bytes_read == 0) {
+			break;
+		}
+		total_bytes_read += UnsafeNumericCast<idx_t>(bytes_read);
+	}
+	return total_bytes_read;
+}
+
+//! Reads the sectors surrounding an unaligned range of a file opened with O_DIRECT into a bounce buffer
+static void ReadUnalignedDirectIO(FileHandle &handle, int fd, void *buffer, idx_t nr_bytes, idx_t location) {
+	const auto start = AlignValueFloor<idx_t, Storage::SECTOR_SIZE>(location);
+	const auto end = AlignValue<idx_t, Storage::SECTOR_SIZE>(location + nr_bytes);
+	DirectIOBounceBuffer bounce_buffer(end - start);
+	// the last sector can extend past the end of the file
+	auto bytes_read = ReadUntilEndOfFile(handle, fd, bounce_buffer.Get(), end - start, start);
+	if (bytes_read < location + nr_bytes - start) {
+		throw IOException(
+		    "Could not read enough bytes from file \"%s\": attempted to read %llu bytes from location %llu",
+		    handle.path, nr_bytes, location);
+	}
+	memcpy(buffer, bounce_buffer.Get() + (location - start), nr_bytes);
+}
+
 void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
-	int fd = handle.Cast<UnixFileHandle>().fd;
+	auto &unix_handle = handle.Cast<UnixFileHandle>();
+	int fd = unix_handle.fd;
+	auto read_start = std::chrono::steady_clock::now();
+	if (unix_handle.direct_io && !IsDirectIOAligned(buffer, UnsafeNumericCast<idx_t>(nr_bytes), location)) {
+		ReadUnalignedDirectIO(handle, fd, buffer, UnsafeNumericCast<idx_t>(nr_bytes), location);
+		IOProfiler::RecordRead(UnsafeNumericCast<idx_t>(nr_bytes), read_start, false);
+		return;
+	}
+	auto total_bytes = UnsafeNumericCast<idx_t>(nr_bytes);
 	auto read_buffer = char_ptr_cast(buffer);
 	while (nr_bytes > 0) {
 		int64_t bytes_read =
@@ -458,20 +537,40 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 		nr_bytes -= bytes_read;
 		location += UnsafeNumericCast<idx_t>(bytes_read);
 	}
+	IOProfiler::RecordRead(total_bytes, read_start, false);
 }
 
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	int fd = handle.Cast<UnixFileHandle>().fd;
+	auto read_start = std::chrono::steady_clock::now();
 	int64_t bytes_read = read(fd, buffer, UnsafeNumericCast<size_t>(nr_bytes));
 	if (bytes_read == -1) {
 		throw IOException("Could not read from file \"%s\": %s", {{"errno", std::to_string(errno)}}, handle.path,
 		                  strerror(errno));
 	}
+	IOProfiler::RecordRead(UnsafeNumericCast<idx_t>(bytes_read), read_start, false);
 	return bytes_read;
 }
 
 void LocalFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
-	int fd = handle.Cast<UnixFileHandle>().fd;
+	auto &unix_handle = handle.Cast<UnixFileHandle>();
+	int fd = unix_handle.fd;
+	if (unix_handle.direct_io && !IsDirectIOAligned(buffer, UnsafeNumericCast<idx_t>(nr_bytes), location)) {
+		// read-modify-write the surrounding sectors through an aligned bounce buffer
+		// the padding of the last sector may extend the file with zeros: truncating the file afterwards would race
+		// with concurrent writes past the old end of the file
+		const auto size = UnsafeNumericCast<idx_t>(nr_bytes);
+		const auto start = AlignValueFloor<idx_t, Storage::SECTOR_SIZE>(location);
+		const auto end = AlignValue<idx_t, Storage::SECTOR_SIZE>(location + size);
+		DirectIOBounceBuffer bounce_buffer(end - start);
+		if (start != location || end != location + size) {
+			auto bytes_read = ReadUntilEndOfFile(handle, fd, bounce_buffer.Get(), end - start, start);
+			memset(bounce_buffer.Get() + bytes_read, 0, end - start - bytes_read);
+		}
+		memcpy(bounce_buffer.Get() + (location - start), buffer, size);
+		Write(handle, bounce_buffer.Get(), UnsafeNumericCast<int64_t>(end - start), start);
+		return;
+	}
 	auto write_buffer = char_ptr_cast(buffer);
 	while (nr_bytes > 0) {
 		int64_t bytes_written =
@@ -892,7 +991,9 @@ static DWORD FSInternalRead(FileHandle &handle, HANDLE hFile, void *buffer, int6
 
 void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
 	HANDLE hFile = ((WindowsFileHandle &)handle).fd;
+	auto read_start = std::chrono::steady_clock::now();
 	auto bytes_read = FSInternalRead(handle, hFile, buffer, nr_bytes, location);
+	IOProfiler::RecordRead(UnsafeNumericCast<idx_t>(bytes_read), read_start, false);
 	if (bytes_read != nr_bytes) {
 		throw IOException("Could not read all bytes from file \"%s\": wanted=%lld read=%lld", handle.path, nr_bytes,
 		                  bytes_read);
@@ -903,8 +1004,10 @@ int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes
 	HANDLE hFile = handle.Cast<WindowsFileHandle>().fd;
 	auto &pos = handle.Cast<WindowsFileHandle>().position;
 	auto n = std::min<idx_t>(std::max<idx_t>(GetFileSize(handle), pos) - pos, nr_bytes);
+	auto read_start = std::chrono::steady_clock::now();
 	auto bytes_read = FSInternalRead(handle, hFile, buffer, n, pos);
 	pos += bytes_read;
+	IOProfiler::RecordRead(UnsafeNumericCast<idx_t>(bytes_read), read_start, false);
 	return bytes_read;
 }
 
@@ -1354,6 +1457,21 @@ vector<string> LocalFileSystem::Glob(const string &path, FileOpener *opener) {
 	return vector<string>();
 }
 
+constexpr idx_t LocalFileSystem::ASYNC_READ_THREADS;
+
+shared_ptr<AsyncFileRead> LocalFileSystem::ReadAsync(FileHandle &handle, void *buffer, int64_t nr_bytes,
+                                                     idx_t location) {
+	auto read = make_shared_ptr<AsyncFileRead>(*this, handle, buffer, nr_bytes, location);
+	{
+		lock_guard<mutex> guard(async_read_lock);
+		if (!async_read_threads) {
+			async_read_threads = make_uniq<AsyncFileReadThreads>(ASYNC_READ_THREADS);
+		}
+	}
+	async_read_threads->Schedule(read);
+	return read;
+}
+
 unique_ptr<FileSystem> FileSystem::CreateLocal() {
 	return make_uniq<LocalFileSystem>();
 }
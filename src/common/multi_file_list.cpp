@@ -6,8 +6,15 @@
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
 
 #include <algorithm>
 
@@ -23,6 +30,140 @@ MultiFilePushdownInfo::MultiFilePushdownInfo(idx_t table_index, const vector<str
     : table_index(table_index), column_names(column_names), column_ids(column_ids), extra_info(extra_info) {
 }
 
+static bool HasStatisticsProviders(ClientContext &context) {
+	return !DBConfig::GetConfig(context).file_statistics_providers.empty();
+}
+
+struct FileStatisticsFilter {
+	//! The filter that is checked against the statistics of the column
+	unique_ptr<TableFilter> filter;
+	string column_name;
+	LogicalType type;
+	//! The filter expression, for EXPLAIN
+	string expression;
+};
+
+//! Converts the filters on a single column that can be checked against column statistics
+static vector<FileStatisticsFilter> GetFileStatisticsFilters(MultiFilePushdownInfo &info,
+                                                             const vector<unique_ptr<Expression>> &filters) {
+	vector<FileStatisticsFilter> result;
+	for (auto &filter : filters) {
+		optional_ptr<Expression> column_expr;
+		unique_ptr<TableFilter> table_filter;
+		switch (filter->GetExpressionClass()) {
+		case ExpressionClass::BOUND_COMPARISON: {
+			auto &comparison = filter->Cast<BoundComparisonExpression>();
+			auto comparison_type = comparison.GetExpressionType();
+			if (comparison_type != ExpressionType::COMPARE_EQUAL &&
+			    comparison_type != ExpressionType::COMPARE_LESSTHAN &&
+			    comparison_type != ExpressionType::COMPARE_LESSTHANOREQUALTO &&
+			    comparison_type != ExpressionType::COMPARE_GREATERTHAN &&
+			    comparison_type != ExpressionType::COMPARE_GREATERTHANOREQUALTO) {
+				continue;
+			}
+			optional_ptr<Expression> constant_expr;
+			if (comparison.right->GetExpressionClass() == ExpressionClass::BOUND_CONSTANT) {
+				column_expr = comparison.left.get();
+				constant_expr = comparison.right.get();
+			} else if (comparison.left->GetExpressionClass() == ExpressionClass::BOUND_CONSTANT) {
+				column_expr = comparison.right.get();
+				constant_expr = comparison.left.get();
+				comparison_type = FlipComparisonExpression(comparison_type);
+			} else {
+				continue;
+			}
+			auto &constant = constant_expr->Cast<BoundConstantExpression>().value;
+			if (constant.IsNull()) {
+				continue;
+			}
+			table_filter = make_uniq<ConstantFilter>(comparison_type, constant);
+			break;
+		}
+		case ExpressionClass::BOUND_OPERATOR: {
+			auto &op = filter->Cast<BoundOperatorExpression>();
+			if (op.children.size() != 1) {
+				continue;
+			}
+			if (op.GetExpressionType() == ExpressionType::OPERATOR_IS_NULL) {
+				table_filter = make_uniq<IsNullFilter>();
+			} else if (op.GetExpressionType() == ExpressionType::OPERATOR_IS_NOT_NULL) {
+				table_filter = make_uniq<IsNotNullFilter>();
+			} else {
+				continue;
+			}
+			column_expr = op.children[0].get();
+			break;
+		}
+		default:
+			continue;
+		}
+		if (column_expr->GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+			continue;
+		}
+		auto &colref = column_expr->Cast<BoundColumnRefExpression>();
+		if (colref.binding.table_index != info.table_index || colref.binding.column_index >= info.column_ids.size() ||
+		    IsRowIdColumnId(info.column_ids[colref.binding.column_index])) {
+			continue;
+		}
+		FileStatisticsFilter statistics_filter;
+		statistics_filter.filter = std::move(table_filter);
+		statistics_filter.column_name = info.column_names[info.column_ids[colref.binding.column_index]];
+		statistics_filter.type = colref.return_type;
+		statistics_filter.expression = filter->ToString();
+		result.push_back(std::move(statistics_filter));
+	}
+	return result;
+}
+
+//! Removes the files of which the statistics show that they cannot match the filters, returns true if any were removed
+static bool PruneFilesWithStatistics(ClientContext &context, MultiFilePushdownInfo &info,
+                                     const vector<unique_ptr<Expression>> &filters, vector<string> &files) {
+	auto &providers = DBConfig::GetConfig(context).file_statistics_providers;
+	if (providers.empty() || filters.empty()) {
+		return false;
+	}
+	auto statistics_filters = GetFileStatisticsFilters(info, filters);
+	if (statistics_filters.empty()) {
+		return false;
+	}
+
+	vector<string> pruned_files;
+	vector<bool> filter_applied(statistics_filters.size(), false);
+	for (auto &file : files) {
+		bool should_prune_file = false;
+		for (idx_t filter_idx = 0; filter_idx < statistics_filters.size() && !should_prune_file; filter_idx++) {
+			auto &statistics_filter = statistics_filters[filter_idx];
+			for (auto &provider : providers) {
+				auto stats =
+				    provider->GetColumnStatistics(context, file, statistics_filter.column_name, statistics_filter.type);
+				if (!stats || stats->GetType() != statistics_filter.type) {
+					continue;
+				}
+				if (statistics_filter.filter->CheckStatistics(*stats) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+					should_prune_file = true;
+					if (!filter_applied[filter_idx]) {
+						info.extra_info.file_filters += statistics_filter.expression;
+						filter_applied[filter_idx] = true;
+					}
+				}
+				break;
+			}
+		}
+		if (!should_prune_file) {
+			pruned_files.push_back(file);
+		}
+	}
+	if (pruned_files.size() == files.size()) {
+		return false;
+	}
+	if (!info.extra_info.total_files.IsValid()) {
+		info.extra_info.total_files = files.size();
+	}
+	info.extra_info.filtered_files = pruned_files.size();
+	files = std::move(pruned_files);
+	return true;
+}
+
 // Helper method to do Filter Pushdown into a MultiFileList
 bool PushdownInternal(ClientContext &context, const MultiFileReaderOptions &options, MultiFilePushdownInfo &info,
                       vector<unique_ptr<Expression>> &filters, vector<string> &expanded_files) {
@@ -37,6 +178,7 @@ bool PushdownInternal(ClientContext &context, const MultiFileReaderOptions &opti
 
 	auto start_files = expanded_files.size();
 	HivePartitioning::ApplyFiltersToFileList(context, expanded_files, filters, filter_info, info);
+	PruneFilesWithStatistics(context, info, filters, expanded_files);
 
 	if (expanded_files.size() != start_files) {
 		return true;
@@ -196,7 +338,7 @@ unique_ptr<MultiFileList> SimpleMultiFileList::ComplexFilterPushdown(ClientConte
                                                                      const MultiFileReaderOptions &options,
                                                                      MultiFilePushdownInfo &info,
                                                                      vector<unique_ptr<Expression>> &filters) {
-	if (!options.hive_partitioning && !options.filename) {
+	if (!options.hive_partitioning && !options.filename && !HasStatisticsProviders(context_p)) {
 		return nullptr;
 	}
 
@@ -274,7 +416,7 @@ unique_ptr<MultiFileList> GlobMultiFileList::ComplexFilterPushdown(ClientContext
 	while (ExpandNextPath()) {
 	}
 
-	if (!options.hive_partitioning && !options.filename) {
+	if (!options.hive_partitioning && !options.filename && !HasStatisticsProviders(context_p)) {
 		return nullptr;
 	}
 	auto res = PushdownInternal(context, options, info, filters, expanded_files);
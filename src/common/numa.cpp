@@ -0,0 +1,107 @@
+#include "duckdb/common/numa.hpp"
+
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/operator/cast_operators.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+#if defined(__linux__) && !defined(DUCKDB_WASM)
+#include <sched.h>
+#endif
+
+namespace duckdb {
+
+vector<vector<idx_t>> NumaTopology::GetNodeCPUs(FileSystem &fs) {
+	vector<vector<idx_t>> result;
+#if defined(__linux__) && !defined(DUCKDB_WASM)
+	cpu_set_t allowed_cpus;
+	CPU_ZERO(&allowed_cpus);
+	bool has_allowed_cpus = sched_getaffinity(0, sizeof(allowed_cpus), &allowed_cpus) == 0;
+
+	// node numbers are dense in practice, stop at the first node that does not exist
+	for (idx_t node = 0;; node++) {
+		auto path = "/sys/devices/system/node/node" + to_string(node) + "/cpulist";
+		if (!fs.FileExists(path)) {
+			break;
+		}
+		auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+		char buffer[4096];
+		auto bytes_read = fs.Read(*handle, buffer, sizeof(buffer) - 1);
+		if (bytes_read < 0) {
+			break;
+		}
+		buffer[bytes_read] = '\0';
+
+		vector<idx_t> cpus;
+		for (auto cpu : ParseCPUList(buffer)) {
+			if (!has_allowed_cpus || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed_cpus))) {
+				cpus.push_back(cpu);
+			}
+		}
+		if (!cpus.empty()) {
+			// nodes without (allowed) CPUs only provide memory
+			result.push_back(std::move(cpus));
+		}
+	}
+#endif
+	if (result.empty()) {
+		result.emplace_back();
+	}
+	return result;
+}
+
+vector<idx_t> NumaTopology::GetCPUNodes(const vector<vector<idx_t>> &node_cpus) {
+	vector<idx_t> result;
+	for (idx_t node = 0; node < node_cpus.size(); node++) {
+		for (auto cpu : node_cpus[node]) {
+			if (cpu >= result.size()) {
+				result.resize(cpu + 1, 0);
+			}
+			result[cpu] = node;
+		}
+	}
+	return result;
+}
+
+const NumaTopology &NumaTopology::Get() {
+	// the topology does not change while the process is running - only read it once
+	static const NumaTopology topology = [] {
+		NumaTopology result;
+		auto fs = FileSystem::CreateLocal();
+		result.node_cpus = GetNodeCPUs(*fs);
+		result.cpu_nodes = GetCPUNodes(result.node_cpus);
+		return result;
+	}();
+	return topology;
+}
+
+idx_t NumaTopology::GetCurrentNode() {
+	auto &topology = Get();
+	if (topology.node_cpus.size() <= 1) {
+		return 0;
+	}
+	auto cpu = TaskScheduler::GetEstimatedCPUId();
+	return cpu < topology.cpu_nodes.size() ? topology.cpu_nodes[cpu] : 0;
+}
+
+vector<idx_t> NumaTopology::ParseCPUList(const string &cpu_list) {
+	vector<idx_t> result;
+	auto trimmed_list = cpu_list;
+	StringUtil::Trim(trimmed_list);
+	for (auto &range : StringUtil::Split(trimmed_list, ',')) {
+		auto bounds = StringUtil::Split(range, '-');
+		idx_t lower, upper;
+		if (bounds.empty() || bounds.size() > 2 || !TryCast::Operation<string_t, idx_t>(string_t(bounds[0]), lower)) {
+			continue;
+		}
+		upper = lower;
+		if (bounds.size() == 2 && !TryCast::Operation<string_t, idx_t>(string_t(bounds[1]), upper)) {
+			continue;
+		}
+		for (idx_t cpu = lower; cpu <= upper; cpu++) {
+			result.push_back(cpu);
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -125,6 +125,25 @@ static unique_ptr<RenderTreeNode> CreateNode(const ProfilingNode &op) {
 	string node_name = "QUERY";
 	if (op.depth > 0) {
 		node_name = info.GetMetricAsString(MetricsType::OPERATOR_TYPE);
+		// show the reads of the operators that read from files
+		if (info.Enabled(MetricsType::OPERATOR_BYTES_READ)) {
+			auto bytes_read = info.GetMetricValue<idx_t>(MetricsType::OPERATOR_BYTES_READ);
+			if (bytes_read > 0) {
+				extra_info["Bytes Read"] = StringUtil::BytesToHumanReadableString(bytes_read);
+			}
+		}
+		if (info.Enabled(MetricsType::OPERATOR_READ_OPERATIONS)) {
+			auto read_operations = info.GetMetricValue<idx_t>(MetricsType::OPERATOR_READ_OPERATIONS);
+			if (read_operations > 0) {
+				extra_info["Read Operations"] = to_string(read_operations);
+			}
+		}
+		if (info.Enabled(MetricsType::OPERATOR_READ_TIME)) {
+			auto read_time = info.GetMetricValue<double>(MetricsType::OPERATOR_READ_TIME);
+			if (read_time > 0) {
+				extra_info["Read Time"] = StringUtil::Format("%.2fs", read_time);
+			}
+		}
 	}
 
 	auto result = make_uniq<RenderTreeNode>(node_name, extra_info);
@@ -4,6 +4,14 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/types/row/tuple_data_collection.hpp"
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DUCKDB_ROW_MATCH_AVX2
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define DUCKDB_ROW_MATCH_NEON
+#include <arm_neon.h>
+#endif
+
 namespace duckdb {
 
 using ValidityBytes = TupleDataLayout::ValidityBytes;
@@ -204,11 +212,204 @@ static idx_t GenericNestedMatch(Vector &lhs_vector, const TupleDataVectorFormat
 	return SelectComparison<OP>(sliced, key, sel, count, &sel, nullptr);
 }
 
+//! Whether two values of this type are equal if and only if their bytes are equal
+static bool IsBytewiseComparable(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+		return true;
+	default:
+		// floating point values have -0.0 and NaN, and intervals are normalized before comparing
+		return false;
+	}
+}
+
+static inline bool FixedSizeEquals(const_data_ptr_t lhs, const_data_ptr_t rhs, const idx_t width) {
+	switch (width) {
+	case 1:
+		return Load<uint8_t>(lhs) == Load<uint8_t>(rhs);
+	case 2:
+		return Load<uint16_t>(lhs) == Load<uint16_t>(rhs);
+	case 4:
+		return Load<uint32_t>(lhs) == Load<uint32_t>(rhs);
+	case 8:
+		return Load<uint64_t>(lhs) == Load<uint64_t>(rhs);
+	case 16:
+		return Load<uint64_t>(lhs) == Load<uint64_t>(rhs) && Load<uint64_t>(lhs + 8) == Load<uint64_t>(rhs + 8);
+	default:
+		return memcmp(lhs, rhs, width) == 0;
+	}
+}
+
+static constexpr idx_t MAX_FIXED_SIZE_KEY_COLUMNS = 64;
+
+struct FixedSizeKeyColumn {
+	const_data_ptr_t data;
+	const SelectionVector *sel;
+	idx_t width;
+	idx_t offset;
+};
+
+#if defined(DUCKDB_ROW_MATCH_AVX2) || defined(DUCKDB_ROW_MATCH_NEON)
+#ifdef DUCKDB_ROW_MATCH_AVX2
+#define DUCKDB_ROW_MATCH_TARGET __attribute__((target("avx2")))
+//! The amount of bytes at the start of a row that are compared by a single SIMD comparison
+static constexpr idx_t ROW_MATCH_WIDTH = 32;
+
+static bool HasSIMDRowMatch() {
+	static const bool supported = []() {
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+	}();
+	return supported;
+}
+#else
+#define DUCKDB_ROW_MATCH_TARGET
+static constexpr idx_t ROW_MATCH_WIDTH = 16;
+
+static bool HasSIMDRowMatch() {
+	return true;
+}
+#endif
+
+//! Same as FixedSizeKeyMatch, for keys that (including their validity bytes) are in the first ROW_MATCH_WIDTH bytes of
+//! the RHS rows. The LHS key is assembled in the layout of the RHS rows, so the validity and all key columns of a row
+//! are compared with a single SIMD comparison. The mask selects the bytes (and validity bits) of the key.
+template <bool NO_MATCH_SEL>
+DUCKDB_ROW_MATCH_TARGET static idx_t FixedSizeKeyMatchSIMD(const FixedSizeKeyColumn *columns, const idx_t column_count,
+                                                           const data_t *mask_bytes, SelectionVector &sel,
+                                                           const idx_t count, const data_ptr_t *rhs_locations,
+                                                           SelectionVector *no_match_sel, idx_t &no_match_count) {
+	// the validity bits of the LHS key are all set, as all of its columns are valid
+	data_t lhs_key[ROW_MATCH_WIDTH];
+	memset(lhs_key, 0xFF, ROW_MATCH_WIDTH);
+#ifdef DUCKDB_ROW_MATCH_AVX2
+	const auto mask = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mask_bytes));
+#else
+	const auto mask = vld1q_u8(mask_bytes);
+#endif
+	idx_t match_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = sel.get_index(i);
+		for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
+			const auto &column = columns[col_idx];
+			const auto lhs_idx = column.sel->get_index(idx);
+			memcpy(lhs_key + column.offset, column.data + lhs_idx * column.width, column.width);
+		}
+#ifdef DUCKDB_ROW_MATCH_AVX2
+		const auto lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lhs_key));
+		const auto rhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rhs_locations[idx]));
+		const bool match = _mm256_testz_si256(_mm256_xor_si256(lhs, rhs), mask) != 0;
+#else
+		const auto difference = vandq_u8(veorq_u8(vld1q_u8(lhs_key), vld1q_u8(rhs_locations[idx])), mask);
+		const bool match = vmaxvq_u8(difference) == 0;
+#endif
+		if (match) {
+			sel.set_index(match_count++, idx);
+		} else if (NO_MATCH_SEL) {
+			no_match_sel->set_index(no_match_count++, idx);
+		}
+	}
+	return match_count;
+}
+#endif
+
+//! Compares all (fixed-size, non-NULL) key columns of a row at once, instead of going over the rows once per column.
+//! A row is only written to the (no) match selection once, and the comparison stops at the first column that differs
+template <bool NO_MATCH_SEL>
+static idx_t FixedSizeKeyMatch(const vector<TupleDataVectorFormat> &lhs_formats, SelectionVector &sel,
+                               const idx_t count, const TupleDataLayout &rhs_layout, Vector &rhs_row_locations,
+                               const vector<idx_t> &widths, SelectionVector *no_match_sel, idx_t &no_match_count) {
+	const auto column_count = widths.size();
+	FixedSizeKeyColumn columns[MAX_FIXED_SIZE_KEY_COLUMNS];
+	D_ASSERT(column_count <= MAX_FIXED_SIZE_KEY_COLUMNS);
+	for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
+		auto &unified = lhs_formats[col_idx].unified;
+		columns[col_idx] = {unified.data, unified.sel, widths[col_idx], rhs_layout.GetOffsets()[col_idx]};
+	}
+
+	// all key columns of the RHS row have to be valid, as the LHS is
+	const auto full_validity_bytes = column_count / 8;
+	const auto remaining_validity_mask = static_cast<uint8_t>((1 << (column_count % 8)) - 1);
+
+	const auto rhs_locations = FlatVector::GetData<data_ptr_t>(rhs_row_locations);
+#if defined(DUCKDB_ROW_MATCH_AVX2) || defined(DUCKDB_ROW_MATCH_NEON)
+	// the SIMD comparison loads ROW_MATCH_WIDTH bytes, so it can only be used if the rows are at least that wide
+	const auto &last_column = columns[column_count - 1];
+	if (HasSIMDRowMatch() && last_column.offset + last_column.width <= ROW_MATCH_WIDTH &&
+	    rhs_layout.GetRowWidth() >= ROW_MATCH_WIDTH) {
+		data_t mask_bytes[ROW_MATCH_WIDTH] = {};
+		memset(mask_bytes, 0xFF, full_validity_bytes);
+		mask_bytes[full_validity_bytes] = remaining_validity_mask;
+		for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
+			memset(mask_bytes + columns[col_idx].offset, 0xFF, columns[col_idx].width);
+		}
+		return FixedSizeKeyMatchSIMD<NO_MATCH_SEL>(columns, column_count, mask_bytes, sel, count, rhs_locations,
+		                                           no_match_sel, no_match_count);
+	}
+#endif
+
+	idx_t match_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = sel.get_index(i);
+		const auto &rhs_location = rhs_locations[idx];
+
+		bool match = true;
+		for (idx_t byte_idx = 0; byte_idx < full_validity_bytes; byte_idx++) {
+			match = match && rhs_location[byte_idx] == 0xFF;
+		}
+		if (remaining_validity_mask != 0) {
+			match = match && (rhs_location[full_validity_bytes] & remaining_validity_mask) == remaining_validity_mask;
+		}
+		for (idx_t col_idx = 0; match && col_idx < column_count; col_idx++) {
+			const auto &column = columns[col_idx];
+			const auto lhs_idx = column.sel->get_index(idx);
+			match = FixedSizeEquals(column.data + lhs_idx * column.width, rhs_location + column.offset, column.width);
+		}
+
+		if (match) {
+			sel.set_index(match_count++, idx);
+		} else if (NO_MATCH_SEL) {
+			no_match_sel->set_index(no_match_count++, idx);
+		}
+	}
+	return match_count;
+}
+
 void RowMatcher::Initialize(const bool no_match_sel, const TupleDataLayout &layout, const Predicates &predicates) {
 	match_functions.reserve(predicates.size());
 	for (idx_t col_idx = 0; col_idx < predicates.size(); col_idx++) {
 		match_functions.push_back(GetMatchFunction(no_match_sel, layout.GetTypes()[col_idx], predicates[col_idx]));
 	}
+	InitializeFixedSizeKeys(no_match_sel, layout, predicates);
+}
+
+void RowMatcher::InitializeFixedSizeKeys(const bool no_match_sel, const TupleDataLayout &layout,
+                                         const Predicates &predicates) {
+	if (predicates.size() < 2 || predicates.size() > MAX_FIXED_SIZE_KEY_COLUMNS) {
+		// a single column is already compared in a single loop
+		return;
+	}
+	vector<idx_t> widths;
+	for (idx_t col_idx = 0; col_idx < predicates.size(); col_idx++) {
+		auto &type = layout.GetTypes()[col_idx];
+		if (!IsBytewiseComparable(type) || (predicates[col_idx] != ExpressionType::COMPARE_EQUAL &&
+		                                    predicates[col_idx] != ExpressionType::COMPARE_NOT_DISTINCT_FROM)) {
+			return;
+		}
+		widths.push_back(GetTypeIdSize(type.InternalType()));
+	}
+	fixed_size_key_widths = std::move(widths);
+	fixed_size_key_no_match_sel = no_match_sel;
 }
 
 void RowMatcher::Initialize(const bool no_match_sel, const TupleDataLayout &layout, const Predicates &predicates,
@@ -231,6 +432,21 @@ idx_t RowMatcher::Match(DataChunk &lhs, const vector<TupleDataVectorFormat> &lhs
                         idx_t count, const TupleDataLayout &rhs_layout, Vector &rhs_row_locations,
                         SelectionVector *no_match_sel, idx_t &no_match_count) {
 	D_ASSERT(!match_functions.empty());
+	if (!fixed_size_key_widths.empty()) {
+		bool all_valid = true;
+		for (idx_t col_idx = 0; col_idx < fixed_size_key_widths.size(); col_idx++) {
+			all_valid = all_valid && lhs_formats[col_idx].unified.validity.AllValid();
+		}
+		if (all_valid) {
+			// with a NULL on the LHS, NULLs have to be compared, which the per-column functions take care of
+			if (fixed_size_key_no_match_sel) {
+				return FixedSizeKeyMatch<true>(lhs_formats, sel, count, rhs_layout, rhs_row_locations,
+				                               fixed_size_key_widths, no_match_sel, no_match_count);
+			}
+			return FixedSizeKeyMatch<false>(lhs_formats, sel, count, rhs_layout, rhs_row_locations,
+			                                fixed_size_key_widths, no_match_sel, no_match_count);
+		}
+	}
 	for (idx_t col_idx = 0; col_idx < match_functions.size(); col_idx++) {
 		const auto &match_function = match_functions[col_idx];
 		count =
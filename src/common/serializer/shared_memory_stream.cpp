@@ -0,0 +1,222 @@
+#include "duckdb/common/serializer/shared_memory_stream.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/helper.hpp"
+
+#include <cstring>
+#include <new>
+#include <thread>
+
+#if !defined(_WIN32) && !defined(DUCKDB_WASM)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DUCKDB_SHARED_MEMORY_STREAM
+#endif
+
+namespace duckdb {
+
+static constexpr uint64_t SHARED_MEMORY_STREAM_MAGIC = 0x314d48534b435544ULL; // "DUCKSHM1"
+
+//! The header at the start of the mapped file, the positions are kept on separate cache lines so the writer and the
+//! reader do not contend on the same line
+struct SharedMemoryStreamHeader {
+	uint64_t magic;
+	uint64_t capacity;
+	alignas(64) atomic<uint64_t> write_position;
+	atomic<uint32_t> writer_closed;
+	alignas(64) atomic<uint64_t> read_position;
+	atomic<uint32_t> reader_closed;
+};
+
+static constexpr idx_t SHARED_MEMORY_STREAM_HEADER_SIZE = sizeof(SharedMemoryStreamHeader);
+static_assert(SHARED_MEMORY_STREAM_HEADER_SIZE % 64 == 0, "the ring buffer must start on a cache line");
+
+SharedMemoryStream::SharedMemoryStream(string path_p, data_ptr_t memory_p, idx_t mapped_size_p, bool is_writer_p)
+    : path(std::move(path_p)), memory(memory_p), mapped_size(mapped_size_p), is_writer(is_writer_p), closed(false),
+      header(*reinterpret_cast<SharedMemoryStreamHeader *>(memory)), data(memory + SHARED_MEMORY_STREAM_HEADER_SIZE),
+      capacity(header.capacity), position(0), peer_position(0) {
+}
+
+#ifdef DUCKDB_SHARED_MEMORY_STREAM
+static data_ptr_t MapSharedMemoryFile(const string &path, int fd, idx_t size) {
+	auto memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (memory == MAP_FAILED) {
+		auto error = strerror(errno);
+		close(fd);
+		throw IOException("Could not map shared memory stream \"%s\": %s", path, error);
+	}
+	close(fd);
+	return static_cast<data_ptr_t>(memory);
+}
+
+unique_ptr<SharedMemoryStream> SharedMemoryStream::Create(const string &path, idx_t capacity) {
+	if (capacity == 0) {
+		throw InvalidInputException("The capacity of a shared memory stream must be larger than 0");
+	}
+	// initialize the stream in a temporary file, and move it into place when it is ready
+	// a reader that opens the path therefore always sees a fully initialized stream
+	auto init_path = path + ".init";
+	unlink(init_path.c_str());
+	auto fd = open(init_path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+	if (fd < 0) {
+		throw IOException("Could not create shared memory stream \"%s\": %s", path, strerror(errno));
+	}
+	auto mapped_size = SHARED_MEMORY_STREAM_HEADER_SIZE + capacity;
+	if (ftruncate(fd, NumericCast<off_t>(mapped_size)) != 0) {
+		auto error = strerror(errno);
+		close(fd);
+		unlink(init_path.c_str());
+		throw IOException("Could not resize shared memory stream \"%s\": %s", path, error);
+	}
+	auto memory = MapSharedMemoryFile(path, fd, mapped_size);
+	auto header = new (memory) SharedMemoryStreamHeader();
+	header->magic = SHARED_MEMORY_STREAM_MAGIC;
+	header->capacity = capacity;
+	header->write_position = 0;
+	header->writer_closed = 0;
+	header->read_position = 0;
+	header->reader_closed = 0;
+	if (rename(init_path.c_str(), path.c_str()) != 0) {
+		auto error = strerror(errno);
+		munmap(memory, mapped_size);
+		unlink(init_path.c_str());
+		throw IOException("Could not create shared memory stream \"%s\": %s", path, error);
+	}
+	return unique_ptr<SharedMemoryStream>(new SharedMemoryStream(path, memory, mapped_size, true));
+}
+
+unique_ptr<SharedMemoryStream> SharedMemoryStream::Open(const string &path) {
+	auto fd = open(path.c_str(), O_RDWR);
+	if (fd < 0) {
+		throw IOException("Could not open shared memory stream \"%s\": %s", path, strerror(errno));
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0 || NumericCast<idx_t>(st.st_size) < SHARED_MEMORY_STREAM_HEADER_SIZE) {
+		close(fd);
+		throw IOException("Could not open shared memory stream \"%s\": not a shared memory stream", path);
+	}
+	auto mapped_size = NumericCast<idx_t>(st.st_size);
+	auto memory = MapSharedMemoryFile(path, fd, mapped_size);
+	auto &header = *reinterpret_cast<SharedMemoryStreamHeader *>(memory);
+	if (header.magic != SHARED_MEMORY_STREAM_MAGIC ||
+	    header.capacity != mapped_size - SHARED_MEMORY_STREAM_HEADER_SIZE) {
+		munmap(memory, mapped_size);
+		throw IOException("Could not open shared memory stream \"%s\": not a shared memory stream", path);
+	}
+	if (header.reader_closed.load()) {
+		munmap(memory, mapped_size);
+		throw IOException("Could not open shared memory stream \"%s\": the stream has already been read", path);
+	}
+	return unique_ptr<SharedMemoryStream>(new SharedMemoryStream(path, memory, mapped_size, false));
+}
+
+SharedMemoryStream::~SharedMemoryStream() {
+	Close();
+	munmap(memory, mapped_size);
+}
+#else
+unique_ptr<SharedMemoryStream> SharedMemoryStream::Create(const string &path, idx_t capacity) {
+	throw NotImplementedException("Shared memory streams are not supported on this platform");
+}
+
+unique_ptr<SharedMemoryStream> SharedMemoryStream::Open(const string &path) {
+	throw NotImplementedException("Shared memory streams are not supported on this platform");
+}
+
+SharedMemoryStream::~SharedMemoryStream() {
+}
+#endif
+
+void SharedMemoryStream::SetInterruptFlag(atomic<bool> &interrupted_p) {
+	interrupted = &interrupted_p;
+}
+
+void SharedMemoryStream::Wait(idx_t &iteration) {
+	if (interrupted && interrupted->load(std::memory_order_relaxed)) {
+		throw InterruptException();
+	}
+	if (iteration++ < 64) {
+		std::this_thread::yield();
+	} else {
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
+	}
+}
+
+void SharedMemoryStream::WriteData(const_data_ptr_t buffer, idx_t write_size) {
+	D_ASSERT(is_writer && !closed);
+	idx_t iteration = 0;
+	while (write_size > 0) {
+		auto available = capacity - (position - peer_position);
+		if (available == 0) {
+			// the ring buffer is full: make our data visible and wait for the reader to catch up
+			Flush();
+			peer_position = header.read_position.load(std::memory_order_acquire);
+			if (position - peer_position == capacity) {
+				if (header.reader_closed.load(std::memory_order_relaxed)) {
+					throw IOException("Could not write to shared memory stream \"%s\": the reader closed the stream",
+					                  path);
+				}
+				Wait(iteration);
+			}
+			continue;
+		}
+		auto offset = position % capacity;
+		auto copy_size = MinValue<idx_t>(write_size, MinValue<idx_t>(available, capacity - offset));
+		memcpy(data + offset, buffer, copy_size);
+		position += copy_size;
+		buffer += copy_size;
+		write_size -= copy_size;
+	}
+}
+
+void SharedMemoryStream::Flush() {
+	D_ASSERT(is_writer);
+	header.write_position.store(position, std::memory_order_release);
+}
+
+void SharedMemoryStream::ReadData(data_ptr_t buffer, idx_t read_size) {
+	D_ASSERT(!is_writer && !closed);
+	idx_t iteration = 0;
+	while (read_size > 0) {
+		auto available = peer_position - position;
+		if (available == 0) {
+			// all data we know about has been read: publish our progress and wait for the writer
+			header.read_position.store(position, std::memory_order_release);
+			auto writer_closed = header.writer_closed.load(std::memory_order_acquire);
+			peer_position = header.write_position.load(std::memory_order_acquire);
+			if (peer_position == position) {
+				if (writer_closed) {
+					throw IOException("Could not read from shared memory stream \"%s\": the writer closed the stream",
+					                  path);
+				}
+				Wait(iteration);
+			}
+			continue;
+		}
+		auto offset = position % capacity;
+		auto copy_size = MinValue<idx_t>(read_size, MinValue<idx_t>(available, capacity - offset));
+		memcpy(buffer, data + offset, copy_size);
+		position += copy_size;
+		buffer += copy_size;
+		read_size -= copy_size;
+	}
+	header.read_position.store(position, std::memory_order_release);
+}
+
+void SharedMemoryStream::Close() {
+	if (closed) {
+		return;
+	}
+	closed = true;
+	if (is_writer) {
+		Flush();
+		header.writer_closed.store(1, std::memory_order_release);
+	} else {
+		header.reader_closed.store(1, std::memory_order_release);
+	}
+}
+
+} // namespace duckdb
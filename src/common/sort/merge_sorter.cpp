@@ -10,14 +10,199 @@ MergeSorter::MergeSorter(GlobalSortState &state, BufferManager &buffer_manager)
 
 void MergeSorter::PerformInMergeRound() {
 	while (true) {
+		idx_t partition_idx;
 		{
 			lock_guard<mutex> pair_guard(state.lock);
 			if (state.pair_idx == state.num_pairs) {
 				break;
 			}
-			GetNextPartition();
+			if (state.multiway_merge) {
+				partition_idx = state.pair_idx++;
+			} else {
+				GetNextPartition();
+			}
+		}
+		if (state.multiway_merge) {
+			MergeMultiwayPartition(partition_idx);
+		} else {
+			MergePartition();
+		}
+	}
+}
+
+//! Reads the rows of a sorted block that fall within a partition of a multiway merge round
+struct MultiwayMergeCursor {
+	MultiwayMergeCursor(BufferManager &buffer_manager, SortedBlock &sb, idx_t begin, idx_t end, idx_t entry_size,
+	                    idx_t row_width)
+	    : buffer_manager(buffer_manager), sb(sb), remaining(end - begin), entry_size(entry_size), row_width(row_width) {
+		if (remaining == 0) {
+			return;
+		}
+		// Find the block that contains the first row of the partition
+		block_idx = 0;
+		while (begin >= sb.radix_sorting_data[block_idx]->count) {
+			begin -= sb.radix_sorting_data[block_idx]->count;
+			block_idx++;
+		}
+		PinBlock(begin);
+	}
+
+	void PinBlock(idx_t entry_idx) {
+		D_ASSERT(sb.radix_sorting_data[block_idx]->count == sb.payload_data->data_blocks[block_idx]->count);
+		radix_handle = buffer_manager.Pin(sb.radix_sorting_data[block_idx]->block);
+		payload_handle = buffer_manager.Pin(sb.payload_data->data_blocks[block_idx]->block);
+		block_count = sb.radix_sorting_data[block_idx]->count;
+		radix_ptr = radix_handle.Ptr() + entry_idx * entry_size;
+		payload_ptr = payload_handle.Ptr() + entry_idx * row_width;
+		block_remaining = block_count - entry_idx;
+	}
+
+	bool Exhausted() const {
+		return remaining == 0;
+	}
+
+	void Advance() {
+		D_ASSERT(!Exhausted());
+		remaining--;
+		block_remaining--;
+		if (remaining == 0) {
+			return;
+		}
+		if (block_remaining == 0) {
+			block_idx++;
+			PinBlock(0);
+			return;
+		}
+		radix_ptr += entry_size;
+		payload_ptr += row_width;
+	}
+
+	BufferManager &buffer_manager;
+	SortedBlock &sb;
+	idx_t remaining;
+	const idx_t entry_size;
+	const idx_t row_width;
+
+	idx_t block_idx = 0;
+	idx_t block_count = 0;
+	idx_t block_remaining = 0;
+	BufferHandle radix_handle;
+	BufferHandle payload_handle;
+	data_ptr_t radix_ptr = nullptr;
+	data_ptr_t payload_ptr = nullptr;
+};
+
+//! A tree of losers over the cursors of a multiway merge, the winner is the smallest row of all cursors.
+//! Ties are broken by the index of the cursor, so that the merge is stable
+class MultiwayLoserTree {
+public:
+	MultiwayLoserTree(vector<MultiwayMergeCursor> &cursors, idx_t comparison_size)
+	    : cursors(cursors), comparison_size(comparison_size), tree(cursors.size(), 0) {
+		tree[0] = Initialize(1);
+	}
+
+	idx_t Winner() const {
+		return tree[0];
+	}
+
+	//! Replay the matches from the leaf of the winner to the root, after the winner has advanced
+	void Replay() {
+		auto winner = tree[0];
+		for (auto node = (winner + cursors.size()) / 2; node > 0; node /= 2) {
+			if (IsLess(tree[node], winner)) {
+				std::swap(tree[node], winner);
+			}
+		}
+		tree[0] = winner;
+	}
+
+private:
+	bool IsLess(idx_t l, idx_t r) const {
+		const auto &l_cursor = cursors[l];
+		const auto &r_cursor = cursors[r];
+		if (l_cursor.Exhausted() || r_cursor.Exhausted()) {
+			return !l_cursor.Exhausted() || (r_cursor.Exhausted() && l < r);
+		}
+		const auto comp_res = FastMemcmp(l_cursor.radix_ptr, r_cursor.radix_ptr, comparison_size);
+		return comp_res < 0 || (comp_res == 0 && l < r);
+	}
+
+	//! Returns the winner of the subtree at "node", and stores the loser of the match at "node"
+	idx_t Initialize(idx_t node) {
+		const auto k = cursors.size();
+		if (node >= k) {
+			return node - k;
+		}
+		auto l = Initialize(2 * node);
+		auto r = Initialize(2 * node + 1);
+		if (IsLess(r, l)) {
+			std::swap(l, r);
+		}
+		tree[node] = r;
+		return l;
+	}
+
+private:
+	vector<MultiwayMergeCursor> &cursors;
+	const idx_t comparison_size;
+	//! The overall winner at index 0, the losers of the matches at the internal nodes 1 ... k - 1
+	vector<idx_t> tree;
+};
+
+void MergeSorter::MergeMultiwayPartition(idx_t partition_idx) {
+	D_ASSERT(state.multiway_merge);
+	const auto &begin = state.multiway_bounds[partition_idx];
+	const auto &end = state.multiway_bounds[partition_idx + 1];
+	const auto entry_size = sort_layout.entry_size;
+	const auto row_width = state.payload_layout.GetRowWidth();
+	vector<MultiwayMergeCursor> cursors;
+	cursors.reserve(state.sorted_blocks.size());
+	idx_t count = 0;
+	for (idx_t sb_idx = 0; sb_idx < state.sorted_blocks.size(); sb_idx++) {
+		cursors.emplace_back(buffer_manager, *state.sorted_blocks[sb_idx], begin[sb_idx], end[sb_idx], entry_size,
+		                     row_width);
+		count += end[sb_idx] - begin[sb_idx];
+	}
+	if (count == 0) {
+		return;
+	}
+
+	// The partitions write to disjoint ranges of the result, which has exactly state.block_capacity rows per block
+	auto &result_block = *state.multiway_result;
+	auto offset = state.multiway_offsets[partition_idx];
+	auto block_idx = offset / state.block_capacity;
+	auto entry_idx = offset % state.block_capacity;
+	BufferHandle radix_handle;
+	BufferHandle payload_handle;
+	data_ptr_t radix_ptr = nullptr;
+	data_ptr_t payload_ptr = nullptr;
+	idx_t block_remaining = 0;
+	auto pin_result_block = [&]() {
+		auto &radix_block = *result_block.radix_sorting_data[block_idx];
+		auto &payload_block = *result_block.payload_data->data_blocks[block_idx];
+		radix_handle = buffer_manager.Pin(radix_block.block);
+		payload_handle = buffer_manager.Pin(payload_block.block);
+		radix_ptr = radix_handle.Ptr() + entry_idx * entry_size;
+		payload_ptr = payload_handle.Ptr() + entry_idx * row_width;
+		block_remaining = radix_block.count - entry_idx;
+	};
+	pin_result_block();
+
+	MultiwayLoserTree tree(cursors, sort_layout.comparison_size);
+	for (idx_t i = 0; i < count; i++) {
+		if (block_remaining == 0) {
+			block_idx++;
+			entry_idx = 0;
+			pin_result_block();
 		}
-		MergePartition();
+		auto &cursor = cursors[tree.Winner()];
+		FastMemcpy(radix_ptr, cursor.radix_ptr, entry_size);
+		FastMemcpy(payload_ptr, cursor.payload_ptr, row_width);
+		radix_ptr += entry_size;
+		payload_ptr += row_width;
+		block_remaining--;
+		cursor.Advance();
+		tree.Replay();
 	}
 }
 
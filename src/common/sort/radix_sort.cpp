@@ -284,6 +284,22 @@ static void SubSortTiedTuples(BufferManager &buffer_manager, const data_ptr_t da
 	}
 }
 
+//! Whether the rows are already sorted by their radix data, so sorting can be skipped
+//! (e.g., when the input is read from a table or file that is ordered by the sort keys)
+static bool IsSorted(const data_ptr_t dataptr, const idx_t &count, const SortLayout &sort_layout) {
+	data_ptr_t prev_ptr = dataptr;
+	for (idx_t i = 1; i < count; i++) {
+		const data_ptr_t curr_ptr = prev_ptr + sort_layout.entry_size;
+		const auto comp_res = FastMemcmp(prev_ptr, curr_ptr, sort_layout.comparison_size);
+		if (comp_res > 0 || (comp_res == 0 && !sort_layout.all_constant)) {
+			// Out of order, or the order is determined by the variable size data
+			return false;
+		}
+		prev_ptr = curr_ptr;
+	}
+	return true;
+}
+
 void LocalSortState::SortInMemory() {
 	auto &sb = *sorted_blocks.back();
 	auto &block = *sb.radix_sorting_data.back();
@@ -296,6 +312,10 @@ void LocalSortState::SortInMemory() {
 		Store<uint32_t>(i, idx_dataptr);
 		idx_dataptr += sort_layout->entry_size;
 	}
+	if (IsSorted(dataptr, count, *sort_layout)) {
+		// Nothing to do, the rows will be re-ordered by their (sequential) indices
+		return;
+	}
 	// Radix sort and break ties until no more ties, or until all columns are sorted
 	idx_t sorting_size = 0;
 	idx_t col_offset = 0;
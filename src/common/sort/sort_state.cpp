@@ -42,6 +42,17 @@ idx_t GetNestedSortingColSize(idx_t &col_size, const LogicalType &type) {
 	}
 }
 
+//! All strings between the minimum and the maximum share the common prefix of the (truncated) minimum and maximum
+static idx_t GetCommonStringPrefixLength(const BaseStatistics &stats) {
+	const auto min = StringStats::Min(stats);
+	const auto max = StringStats::Max(stats);
+	idx_t common = 0;
+	while (common < min.size() && common < max.size() && min[common] == max[common]) {
+		common++;
+	}
+	return common;
+}
+
 SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
     : column_count(orders.size()), all_constant(true), comparison_size(0), entry_size(0) {
 	vector<LogicalType> blob_layout_types;
@@ -66,12 +77,18 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 
 		idx_t col_size = has_null.back() ? 1 : 0;
 		prefix_lengths.push_back(0);
+		prefix_offsets.push_back(0);
 		if (!TypeIsConstantSize(physical_type) && physical_type != PhysicalType::VARCHAR) {
 			prefix_lengths.back() = GetNestedSortingColSize(col_size, expr.return_type);
 		} else if (physical_type == PhysicalType::VARCHAR) {
 			idx_t size_before = col_size;
+			if (stats.back()) {
+				// No need to encode the prefix that all strings share in the radix data
+				prefix_offsets.back() = GetCommonStringPrefixLength(*stats.back());
+			}
 			if (stats.back() && StringStats::HasMaxStringLength(*stats.back())) {
-				col_size += StringStats::MaxStringLength(*stats.back());
+				const idx_t max_string_length = StringStats::MaxStringLength(*stats.back());
+				col_size += max_string_length - MinValue(prefix_offsets.back(), max_string_length);
 				if (col_size > 12) {
 					col_size = 12;
 				} else {
@@ -100,7 +117,9 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 			}
 			if (logical_types[col_idx].InternalType() == PhysicalType::VARCHAR && stats[col_idx] &&
 			    StringStats::HasMaxStringLength(*stats[col_idx])) {
-				idx_t diff = StringStats::MaxStringLength(*stats[col_idx]) - prefix_lengths[col_idx];
+				const idx_t encoded_length = prefix_offsets[col_idx] + prefix_lengths[col_idx];
+				const idx_t max_string_length = StringStats::MaxStringLength(*stats[col_idx]);
+				idx_t diff = max_string_length - MinValue(encoded_length, max_string_length);
 				if (diff > 0) {
 					// Increase all sizes accordingly
 					idx_t increase = MinValue(bytes_to_fill, diff);
@@ -144,6 +163,7 @@ SortLayout SortLayout::GetPrefixComparisonLayout(idx_t num_prefix_cols) const {
 		result.column_sizes.push_back(column_sizes[col_idx]);
 
 		result.prefix_lengths.push_back(prefix_lengths[col_idx]);
+		result.prefix_offsets.push_back(prefix_offsets[col_idx]);
 		result.stats.push_back(stats[col_idx]);
 		result.has_null.push_back(has_null[col_idx]);
 	}
@@ -185,6 +205,25 @@ void LocalSortState::Initialize(GlobalSortState &global_sort_state, BufferManage
 	initialized = true;
 }
 
+//! Skip the prefix that all strings share, the resulting strings either point into the original strings or are inlined
+static void SkipStringPrefix(Vector &source, idx_t count, idx_t prefix_offset, Vector &result) {
+	UnifiedVectorFormat vdata;
+	source.ToUnifiedFormat(count, vdata);
+	auto source_data = UnifiedVectorFormat::GetData<string_t>(vdata);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	auto &result_validity = FlatVector::Validity(result);
+	for (idx_t i = 0; i < count; i++) {
+		const auto source_idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(source_idx)) {
+			result_validity.SetInvalid(i);
+			continue;
+		}
+		const auto &str = source_data[source_idx];
+		const auto skip = MinValue<idx_t>(prefix_offset, str.GetSize());
+		result_data[i] = string_t(str.GetData() + skip, UnsafeNumericCast<uint32_t>(str.GetSize() - skip));
+	}
+}
+
 void LocalSortState::SinkChunk(DataChunk &sort, DataChunk &payload) {
 	D_ASSERT(sort.size() == payload.size());
 	// Build and serialize sorting data to radix sortable rows
@@ -194,6 +233,15 @@ void LocalSortState::SinkChunk(DataChunk &sort, DataChunk &payload) {
 		bool has_null = sort_layout->has_null[sort_col];
 		bool nulls_first = sort_layout->order_by_null_types[sort_col] == OrderByNullType::NULLS_FIRST;
 		bool desc = sort_layout->order_types[sort_col] == OrderType::DESCENDING;
+		const auto prefix_offset = sort_layout->prefix_offsets[sort_col];
+		if (prefix_offset > 0) {
+			Vector suffixes(LogicalType::VARCHAR, sort.size());
+			SkipStringPrefix(sort.data[sort_col], sort.size(), prefix_offset, suffixes);
+			RowOperations::RadixScatter(suffixes, sort.size(), sel_ptr, sort.size(), data_pointers, desc, has_null,
+			                            nulls_first, sort_layout->prefix_lengths[sort_col],
+			                            sort_layout->column_sizes[sort_col]);
+			continue;
+		}
 		RowOperations::RadixScatter(sort.data[sort_col], sort.size(), sel_ptr, sort.size(), data_pointers, desc,
 		                            has_null, nulls_first, sort_layout->prefix_lengths[sort_col],
 		                            sort_layout->column_sizes[sort_col]);
@@ -432,8 +480,131 @@ void GlobalSortState::PrepareMergePhase() {
 	}
 }
 
+bool GlobalSortState::CanMergeMultiway() const {
+	// The multiway merge only compares radix data, and copies rows without touching the heap,
+	// so it requires constant size sorting columns and an in-memory sort
+	return !external && sort_layout.all_constant && sorted_blocks.size() > 2 && block_capacity > 0;
+}
+
+//! Reads the radix sorting data of the sorted blocks of a multiway merge round.
+//! Rows are ordered by their key, then by their sorted block, and then by their position in the block,
+//! so that partitions are balanced even with many equal keys
+struct MultiwayRadixReader {
+	MultiwayRadixReader(BufferManager &buffer_manager, const SortLayout &sort_layout,
+	                    const vector<unique_ptr<SortedBlock>> &sorted_blocks)
+	    : sort_layout(sort_layout), handles(sorted_blocks.size()), block_starts(sorted_blocks.size()),
+	      counts(sorted_blocks.size()) {
+		for (idx_t sb_idx = 0; sb_idx < sorted_blocks.size(); sb_idx++) {
+			idx_t count = 0;
+			for (auto &block : sorted_blocks[sb_idx]->radix_sorting_data) {
+				handles[sb_idx].push_back(buffer_manager.Pin(block->block));
+				block_starts[sb_idx].push_back(count);
+				count += block->count;
+			}
+			counts[sb_idx] = count;
+		}
+	}
+
+	data_ptr_t RowPtr(idx_t sb_idx, idx_t row_idx) const {
+		D_ASSERT(row_idx < counts[sb_idx]);
+		const auto &starts = block_starts[sb_idx];
+		const auto block_idx = idx_t(std::upper_bound(starts.begin(), starts.end(), row_idx) - starts.begin()) - 1;
+		return handles[sb_idx][block_idx].Ptr() + (row_idx - starts[block_idx]) * sort_layout.entry_size;
+	}
+
+	bool RowIsLess(idx_t l_sb, idx_t l_row, idx_t r_sb, idx_t r_row) const {
+		const auto comp_res = FastMemcmp(RowPtr(l_sb, l_row), RowPtr(r_sb, r_row), sort_layout.comparison_size);
+		if (comp_res != 0) {
+			return comp_res < 0;
+		}
+		return l_sb < r_sb || (l_sb == r_sb && l_row < r_row);
+	}
+
+	//! The first row of a sorted block that is not less than the given row of another sorted block
+	idx_t LowerBound(idx_t sb_idx, idx_t split_sb, idx_t split_row) const {
+		if (sb_idx == split_sb) {
+			return split_row;
+		}
+		idx_t lower = 0;
+		idx_t upper = counts[sb_idx];
+		while (lower < upper) {
+			const auto middle = lower + (upper - lower) / 2;
+			if (RowIsLess(sb_idx, middle, split_sb, split_row)) {
+				lower = middle + 1;
+			} else {
+				upper = middle;
+			}
+		}
+		return lower;
+	}
+
+	const SortLayout &sort_layout;
+	vector<vector<BufferHandle>> handles;
+	vector<vector<idx_t>> block_starts;
+	vector<idx_t> counts;
+};
+
+void GlobalSortState::InitializeMultiwayMerge() {
+	static constexpr idx_t SAMPLES_PER_PARTITION = 64;
+
+	MultiwayRadixReader reader(buffer_manager, sort_layout, sorted_blocks);
+	const auto block_count = sorted_blocks.size();
+	const auto total_count = std::accumulate(reader.counts.begin(), reader.counts.end(), idx_t(0));
+
+	// Sample rows of all sorted blocks, the splitters are the quantiles of the samples
+	const auto partition_count = MaxValue<idx_t>((total_count + block_capacity - 1) / block_capacity, 1);
+	const auto stride = MaxValue<idx_t>(block_capacity / SAMPLES_PER_PARTITION, 1);
+	vector<std::pair<idx_t, idx_t>> samples;
+	for (idx_t sb_idx = 0; sb_idx < block_count; sb_idx++) {
+		for (idx_t row_idx = stride / 2; row_idx < reader.counts[sb_idx]; row_idx += stride) {
+			samples.emplace_back(sb_idx, row_idx);
+		}
+	}
+	std::sort(samples.begin(), samples.end(),
+	          [&](const std::pair<idx_t, idx_t> &l, const std::pair<idx_t, idx_t> &r) {
+		          return reader.RowIsLess(l.first, l.second, r.first, r.second);
+	          });
+
+	// Every partition starts at the first rows that are not less than its splitter
+	multiway_bounds.clear();
+	multiway_offsets.clear();
+	multiway_bounds.emplace_back(block_count, 0);
+	for (idx_t partition_idx = 1; partition_idx < partition_count && !samples.empty(); partition_idx++) {
+		const auto &splitter = samples[partition_idx * samples.size() / partition_count];
+		vector<idx_t> bounds(block_count);
+		for (idx_t sb_idx = 0; sb_idx < block_count; sb_idx++) {
+			bounds[sb_idx] = reader.LowerBound(sb_idx, splitter.first, splitter.second);
+		}
+		multiway_bounds.push_back(std::move(bounds));
+	}
+	multiway_bounds.push_back(reader.counts);
+	for (idx_t partition_idx = 0; partition_idx + 1 < multiway_bounds.size(); partition_idx++) {
+		const auto &bounds = multiway_bounds[partition_idx];
+		multiway_offsets.push_back(std::accumulate(bounds.begin(), bounds.end(), idx_t(0)));
+	}
+
+	// Allocate the result, the partitions write their rows to disjoint ranges of it
+	multiway_result = make_uniq<SortedBlock>(buffer_manager, *this);
+	for (idx_t row_idx = 0; row_idx < total_count; row_idx += block_capacity) {
+		multiway_result->CreateBlock();
+		multiway_result->payload_data->CreateBlock();
+		const auto count = MinValue<idx_t>(block_capacity, total_count - row_idx);
+		multiway_result->radix_sorting_data.back()->count = count;
+		multiway_result->payload_data->data_blocks.back()->count = count;
+	}
+
+	multiway_merge = true;
+	pair_idx = 0;
+	num_pairs = multiway_offsets.size();
+}
+
 void GlobalSortState::InitializeMergeRound() {
 	D_ASSERT(sorted_blocks_temp.empty());
+	// Merge all blocks in a single round if we can, instead of in log2(blocks) rounds
+	if (CanMergeMultiway()) {
+		InitializeMultiwayMerge();
+		return;
+	}
 	// If we reverse this list, the blocks that were merged last will be merged first in the next round
 	// These are still in memory, therefore this reduces the amount of read/write to disk!
 	std::reverse(sorted_blocks.begin(), sorted_blocks.end());
@@ -455,6 +626,12 @@ void GlobalSortState::InitializeMergeRound() {
 
 void GlobalSortState::CompleteMergeRound(bool keep_radix_data) {
 	sorted_blocks.clear();
+	if (multiway_merge) {
+		sorted_blocks.push_back(std::move(multiway_result));
+		multiway_bounds.clear();
+		multiway_offsets.clear();
+		multiway_merge = false;
+	}
 	for (auto &sorted_block_vector : sorted_blocks_temp) {
 		sorted_blocks.push_back(make_uniq<SortedBlock>(buffer_manager, *this));
 		sorted_blocks.back()->AppendSortedBlocks(sorted_block_vector);
@@ -223,10 +223,33 @@ void SBScanState::PinRadix(idx_t block_idx_to) {
 	D_ASSERT(block_idx_to < radix_sorting_data.size());
 	auto &block = radix_sorting_data[block_idx_to];
 	if (!radix_handle.IsValid() || radix_handle.GetBlockHandle() != block->block) {
+		if (state.external && block->block->IsUnloaded()) {
+			// Read the next blocks in one go, instead of stalling on every block when the scan reaches it
+			ReadAhead(block_idx_to);
+		}
 		radix_handle = buffer_manager.Pin(block->block);
 	}
 }
 
+void SBScanState::ReadAhead(idx_t block_idx_from) {
+	vector<shared_ptr<BlockHandle>> handles;
+	const auto block_idx_to = MinValue(block_idx_from + READ_AHEAD_BLOCKS, sb->radix_sorting_data.size());
+	auto add_sorted_data = [&](const SortedData &sd, idx_t i) {
+		handles.push_back(sd.data_blocks[i]->block);
+		if (!sd.layout.AllConstant()) {
+			handles.push_back(sd.heap_blocks[i]->block);
+		}
+	};
+	for (idx_t i = block_idx_from; i < block_idx_to; i++) {
+		handles.push_back(sb->radix_sorting_data[i]->block);
+		if (!sort_layout.all_constant) {
+			add_sorted_data(*sb->blob_sorting_data, i);
+		}
+		add_sorted_data(*sb->payload_data, i);
+	}
+	buffer_manager.Prefetch(handles);
+}
+
 void SBScanState::PinData(SortedData &sd) {
 	D_ASSERT(block_idx < sd.data_blocks.size());
 	auto &data_handle = sd.type == SortedDataType::BLOB ? blob_sorting_data_handle : payload_data_handle;
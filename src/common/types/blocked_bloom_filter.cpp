@@ -0,0 +1,91 @@
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+namespace duckdb {
+
+static idx_t GetBloomFilterWordCount(idx_t expected_key_count) {
+	auto bit_count = MaxValue<idx_t>(expected_key_count, 1) * BlockedBloomFilter::FILTER_BITS_PER_KEY;
+	auto word_count = NextPowerOfTwo((bit_count + 63) / 64);
+	return MaxValue<idx_t>(word_count, BlockedBloomFilter::MIN_WORD_COUNT);
+}
+
+BlockedBloomFilter::BlockedBloomFilter(idx_t expected_key_count)
+    : word_count(GetBloomFilterWordCount(expected_key_count)),
+      words(make_unsafe_uniq_array<atomic<uint64_t>>(word_count)) {
+	D_ASSERT(IsPowerOfTwo(word_count));
+}
+
+BlockedBloomFilter::BlockedBloomFilter(const vector<uint64_t> &words_p)
+    : word_count(words_p.size()), words(make_unsafe_uniq_array<atomic<uint64_t>>(word_count)) {
+	if (!IsPowerOfTwo(word_count) || word_count < MIN_WORD_COUNT) {
+		throw SerializationException("Bloom filter word count must be a power of two");
+	}
+	for (idx_t i = 0; i < word_count; i++) {
+		words[i].store(words_p[i], std::memory_order_relaxed);
+	}
+}
+
+idx_t BlockedBloomFilter::GetSizeInBytes(idx_t expected_key_count) {
+	return GetBloomFilterWordCount(expected_key_count) * sizeof(uint64_t);
+}
+
+void BlockedBloomFilter::InsertHashes(const hash_t *hashes, idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		InsertHash(hashes[i]);
+	}
+}
+
+void BlockedBloomFilter::InsertHashes(Vector &hashes, idx_t count) {
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		InsertHash(hash_data[hdata.sel->get_index(i)]);
+	}
+}
+
+idx_t BlockedBloomFilter::Lookup(Vector &input, SelectionVector &sel, idx_t count) const {
+	if (count == 0) {
+		return 0;
+	}
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(input, hashes, sel, count);
+	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		// constant input: either everything or nothing qualifies
+		return LookupHash(*ConstantVector::GetData<hash_t>(hashes)) ? count : 0;
+	}
+	// the hashes are written at the positions given by the selection vector
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	SelectionVector result_sel(count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = sel.get_index(i);
+		result_sel.set_index(result_count, idx);
+		result_count += LookupHash(hash_data[idx]);
+	}
+	sel.Initialize(result_sel);
+	return result_count;
+}
+
+vector<uint64_t> BlockedBloomFilter::GetWords() const {
+	vector<uint64_t> result;
+	result.reserve(word_count);
+	for (idx_t i = 0; i < word_count; i++) {
+		result.push_back(words[i].load(std::memory_order_relaxed));
+	}
+	return result;
+}
+
+void BlockedBloomFilter::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty(100, "words", GetWords());
+}
+
+shared_ptr<BlockedBloomFilter> BlockedBloomFilter::Deserialize(Deserializer &deserializer) {
+	auto words = deserializer.ReadProperty<vector<uint64_t>>(100, "words");
+	return make_shared_ptr<BlockedBloomFilter>(words);
+}
+
+} // namespace duckdb
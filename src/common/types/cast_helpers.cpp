@@ -2,6 +2,15 @@
 #include "duckdb/common/types/hugeint.hpp"
 #include "duckdb/common/types/uhugeint.hpp"
 
+#if defined(__x86_64__) || defined(_M_X64)
+// SSE2 is part of the x86-64 baseline, so no runtime check is needed
+#define DUCKDB_PARSE_DIGITS_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define DUCKDB_PARSE_DIGITS_NEON
+#include <arm_neon.h>
+#endif
+
 namespace duckdb {
 
 const int64_t NumericHelper::POWERS_OF_TEN[] {1,
@@ -29,6 +38,48 @@ const double NumericHelper::DOUBLE_POWERS_OF_TEN[] {1e0,  1e1,  1e2,  1e3,  1e4,
                                                     1e20, 1e21, 1e22, 1e23, 1e24, 1e25, 1e26, 1e27, 1e28, 1e29,
                                                     1e30, 1e31, 1e32, 1e33, 1e34, 1e35, 1e36, 1e37, 1e38, 1e39};
 
+bool NumericHelper::TryParseEightDigits(const char *digits, uint32_t &result) {
+#ifdef DUCKDB_PARSE_DIGITS_SSE2
+	// the upper eight bytes of the register are zero
+	auto values = _mm_sub_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(digits)), _mm_set1_epi8('0'));
+	auto invalid = _mm_or_si128(_mm_cmplt_epi8(values, _mm_setzero_si128()), _mm_cmpgt_epi8(values, _mm_set1_epi8(9)));
+	if ((_mm_movemask_epi8(invalid) & 0xFF) != 0) {
+		return false;
+	}
+	// combine adjacent digits into pairs, and adjacent pairs into groups of four digits
+	auto words = _mm_unpacklo_epi8(values, _mm_setzero_si128());
+	auto pairs = _mm_madd_epi16(words, _mm_setr_epi16(10, 1, 10, 1, 10, 1, 10, 1));
+	auto quads = _mm_madd_epi16(_mm_packs_epi32(pairs, pairs), _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+	auto high = static_cast<uint32_t>(_mm_cvtsi128_si32(quads));
+	auto low = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(quads, 4)));
+	result = high * 10000 + low;
+	return true;
+#elif defined(DUCKDB_PARSE_DIGITS_NEON)
+	static const uint8_t DIGIT_WEIGHTS[] = {10, 1, 10, 1, 10, 1, 10, 1};
+	static const uint32_t PAIR_WEIGHTS[] = {100, 1, 100, 1};
+	auto values = vsub_u8(vld1_u8(reinterpret_cast<const uint8_t *>(digits)), vdup_n_u8('0'));
+	if (vmaxv_u8(values) > 9) {
+		return false;
+	}
+	// combine adjacent digits into pairs, and adjacent pairs into groups of four digits
+	auto pairs = vpaddlq_u16(vmull_u8(values, vld1_u8(DIGIT_WEIGHTS)));
+	auto quads = vpaddlq_u32(vmulq_u32(pairs, vld1q_u32(PAIR_WEIGHTS)));
+	result = static_cast<uint32_t>(vgetq_lane_u64(quads, 0) * 10000 + vgetq_lane_u64(quads, 1));
+	return true;
+#else
+	uint32_t value = 0;
+	for (idx_t i = 0; i < 8; i++) {
+		auto digit = static_cast<uint8_t>(digits[i] - '0');
+		if (digit > 9) {
+			return false;
+		}
+		value = value * 10 + digit;
+	}
+	result = value;
+	return true;
+#endif
+}
+
 template <>
 int NumericHelper::UnsignedLength(uint8_t value) {
 	int length = 1;
@@ -59,6 +59,25 @@ BufferHandle ColumnDataAllocator::Pin(uint32_t block_id) {
 	return alloc.buffer_manager->Pin(handle);
 }
 
+void ColumnDataAllocator::Prefetch(const unordered_set<uint32_t> &block_ids) {
+	if (type == ColumnDataAllocatorType::IN_MEMORY_ALLOCATOR) {
+		return;
+	}
+	vector<shared_ptr<BlockHandle>> handles;
+	{
+		unique_lock<mutex> guard(lock, std::defer_lock);
+		if (shared) {
+			guard.lock();
+		}
+		for (auto &block_id : block_ids) {
+			if (blocks[block_id].handle) {
+				handles.push_back(blocks[block_id].handle);
+			}
+		}
+	}
+	alloc.buffer_manager->Prefetch(handles);
+}
+
 BufferHandle ColumnDataAllocator::AllocateBlock(idx_t size) {
 	D_ASSERT(type == ColumnDataAllocatorType::BUFFER_MANAGER_ALLOCATOR || type == ColumnDataAllocatorType::HYBRID);
 	auto max_size = MaxValue<idx_t>(size, GetBufferManager().GetBlockSize());
@@ -438,6 +438,39 @@ static void ColumnDataCopy(ColumnDataMetaData &meta_data, const UnifiedVectorFor
 	TemplatedColumnDataCopy<StandardValueCopy<T>>(meta_data, source_data, source, offset, copy_count);
 }
 
+static bool ColumnDataCopyDeduplicatedStrings(ColumnDataMetaData &meta_data, const UnifiedVectorFormat &source_data,
+                                              Vector &source, idx_t offset, idx_t copy_count) {
+	// find the number of entries that the selection references
+	idx_t entry_count = 0;
+	for (idx_t i = 0; i < copy_count; i++) {
+		entry_count = MaxValue<idx_t>(entry_count, source_data.sel->get_index(offset + i) + 1);
+	}
+	if (entry_count >= copy_count) {
+		// the selection does not necessarily reference any entry more than once
+		return false;
+	}
+	// the selection references entries more than once (e.g., a constant or dictionary vector)
+	// copy every referenced entry to the heap only once, and let all rows that reference it share the copy
+	const auto source_entries = UnifiedVectorFormat::GetData<string_t>(source_data);
+	auto heap_entries = make_unsafe_uniq_array<string_t>(entry_count);
+	ValidityMask copied(entry_count);
+	copied.SetAllInvalid(entry_count);
+	for (idx_t i = 0; i < copy_count; i++) {
+		auto source_idx = source_data.sel->get_index(offset + i);
+		if (!source_data.validity.RowIsValid(source_idx) || copied.RowIsValid(source_idx)) {
+			continue;
+		}
+		heap_entries[source_idx] = StringValueCopy::Operation(meta_data, source_entries[source_idx]);
+		copied.SetValid(source_idx);
+	}
+	UnifiedVectorFormat heap_data;
+	heap_data.sel = source_data.sel;
+	heap_data.data = data_ptr_cast(heap_entries.get());
+	heap_data.validity = source_data.validity;
+	TemplatedColumnDataCopy<StandardValueCopy<string_t>>(meta_data, heap_data, source, offset, copy_count);
+	return true;
+}
+
 template <>
 void ColumnDataCopy<string_t>(ColumnDataMetaData &meta_data, const UnifiedVectorFormat &source_data, Vector &source,
                               idx_t offset, idx_t copy_count) {
@@ -446,6 +479,10 @@ void ColumnDataCopy<string_t>(ColumnDataMetaData &meta_data, const UnifiedVector
 	if (allocator_type == ColumnDataAllocatorType::IN_MEMORY_ALLOCATOR ||
 	    allocator_type == ColumnDataAllocatorType::HYBRID) {
 		// strings cannot be spilled to disk - use StringHeap
+		if (source.GetVectorType() != VectorType::FLAT_VECTOR &&
+		    ColumnDataCopyDeduplicatedStrings(meta_data, source_data, source, offset, copy_count)) {
+			return;
+		}
 		TemplatedColumnDataCopy<StringValueCopy>(meta_data, source_data, source, offset, copy_count);
 		return;
 	}
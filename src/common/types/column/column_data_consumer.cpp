@@ -23,6 +23,7 @@ void ColumnDataConsumer::InitializeScan() {
 	chunk_count = collection.ChunkCount();
 	current_chunk_index = 0;
 	chunk_delete_index = DConstants::INVALID_INDEX;
+	read_ahead_index = 0;
 
 	// Initialize chunk references and sort them, so we can scan them in a sane order, regardless of how it was created
 	chunk_references.reserve(chunk_count);
@@ -35,20 +36,45 @@ void ColumnDataConsumer::InitializeScan() {
 }
 
 bool ColumnDataConsumer::AssignChunk(ColumnDataConsumerScanState &state) {
-	lock_guard<mutex> guard(lock);
-	if (current_chunk_index == chunk_count) {
-		// All chunks have been assigned
-		state.current_chunk_state.handles.clear();
-		state.chunk_index = DConstants::INVALID_INDEX;
-		return false;
+	idx_t read_ahead_start;
+	idx_t read_ahead_end;
+	{
+		lock_guard<mutex> guard(lock);
+		if (current_chunk_index == chunk_count) {
+			// All chunks have been assigned
+			state.current_chunk_state.handles.clear();
+			state.chunk_index = DConstants::INVALID_INDEX;
+			return false;
+		}
+		// Assign chunk index
+		state.chunk_index = current_chunk_index++;
+		D_ASSERT(chunks_in_progress.find(state.chunk_index) == chunks_in_progress.end());
+		chunks_in_progress.insert(state.chunk_index);
+
+		// Read ahead in batches, so we do not stall on every chunk that was offloaded to disk
+		read_ahead_start = read_ahead_index;
+		read_ahead_end = read_ahead_index;
+		if (state.chunk_index + READ_AHEAD_CHUNKS / 2 >= read_ahead_index) {
+			read_ahead_start = MaxValue(read_ahead_index, state.chunk_index);
+			read_ahead_end = MinValue(state.chunk_index + READ_AHEAD_CHUNKS, chunk_count);
+			read_ahead_index = read_ahead_end;
+		}
 	}
-	// Assign chunk index
-	state.chunk_index = current_chunk_index++;
-	D_ASSERT(chunks_in_progress.find(state.chunk_index) == chunks_in_progress.end());
-	chunks_in_progress.insert(state.chunk_index);
+	ReadAhead(read_ahead_start, read_ahead_end);
 	return true;
 }
 
+void ColumnDataConsumer::ReadAhead(idx_t chunk_index_start, idx_t chunk_index_end) {
+	if (collection.GetAllocatorType() == ColumnDataAllocatorType::IN_MEMORY_ALLOCATOR) {
+		return;
+	}
+	for (idx_t chunk_index = chunk_index_start; chunk_index < chunk_index_end; chunk_index++) {
+		auto &chunk_ref = chunk_references[chunk_index];
+		auto &chunk_data = chunk_ref.segment->chunk_data[chunk_ref.chunk_index_in_segment];
+		chunk_ref.segment->allocator->Prefetch(chunk_data.block_ids);
+	}
+}
+
 void ColumnDataConsumer::ScanChunk(ColumnDataConsumerScanState &state, DataChunk &chunk) const {
 	D_ASSERT(state.chunk_index < chunk_count);
 	auto &chunk_ref = chunk_references[state.chunk_index];
@@ -119,6 +119,73 @@ unique_ptr<HyperLogLog> HyperLogLog::Copy() const {
 	return result;
 }
 
+idx_t HyperLogLog::NonZeroRegisterCount() const {
+	idx_t result = 0;
+	for (idx_t i = 0; i < M; ++i) {
+		result += k[i] != 0;
+	}
+	return result;
+}
+
+idx_t HyperLogLog::GetSketchSize() const {
+	const auto sparse_size = 2 * NonZeroRegisterCount();
+	return sizeof(HLLSketchFormat) + MinValue<idx_t>(sparse_size, M);
+}
+
+void HyperLogLog::WriteSketch(data_ptr_t data) const {
+	const auto sparse_size = 2 * NonZeroRegisterCount();
+	if (sparse_size >= M) {
+		data[0] = static_cast<uint8_t>(HLLSketchFormat::DENSE);
+		memcpy(data + sizeof(HLLSketchFormat), k, M);
+		return;
+	}
+	data[0] = static_cast<uint8_t>(HLLSketchFormat::SPARSE);
+	data += sizeof(HLLSketchFormat);
+	for (idx_t i = 0; i < M; ++i) {
+		if (k[i] != 0) {
+			*data++ = UnsafeNumericCast<uint8_t>(i);
+			*data++ = k[i];
+		}
+	}
+}
+
+void HyperLogLog::MergeSketch(const_data_ptr_t data, idx_t size) {
+	if (size < sizeof(HLLSketchFormat)) {
+		throw InvalidInputException("Invalid HyperLogLog sketch: sketch is empty");
+	}
+	const auto format = static_cast<HLLSketchFormat>(data[0]);
+	data += sizeof(HLLSketchFormat);
+	size -= sizeof(HLLSketchFormat);
+	switch (format) {
+	case HLLSketchFormat::SPARSE:
+		if (size % 2 != 0) {
+			throw InvalidInputException("Invalid HyperLogLog sketch: incomplete sparse register");
+		}
+		for (idx_t i = 0; i < size; i += 2) {
+			const auto index = data[i];
+			const auto value = data[i + 1];
+			if (index >= M || value > Q + 1) {
+				throw InvalidInputException("Invalid HyperLogLog sketch: register out of range");
+			}
+			Update(index, value);
+		}
+		break;
+	case HLLSketchFormat::DENSE:
+		if (size != M) {
+			throw InvalidInputException("Invalid HyperLogLog sketch: expected %llu registers, got %llu", M, size);
+		}
+		for (idx_t i = 0; i < M; ++i) {
+			if (data[i] > Q + 1) {
+				throw InvalidInputException("Invalid HyperLogLog sketch: register out of range");
+			}
+			Update(i, data[i]);
+		}
+		break;
+	default:
+		throw InvalidInputException("Invalid HyperLogLog sketch: unknown format %d", static_cast<int>(format));
+	}
+}
+
 class HLLV1 {
 public:
 	HLLV1() {
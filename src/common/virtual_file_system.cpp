@@ -62,6 +62,11 @@ int64_t VirtualFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_by
 	return handle.file_system.Write(handle, buffer, nr_bytes);
 }
 
+shared_ptr<AsyncFileRead> VirtualFileSystem::ReadAsync(FileHandle &handle, void *buffer, int64_t nr_bytes,
+                                                       idx_t location) {
+	return handle.file_system.ReadAsync(handle, buffer, nr_bytes, location);
+}
+
 int64_t VirtualFileSystem::GetFileSize(FileHandle &handle) {
 	return handle.file_system.GetFileSize(handle);
 }
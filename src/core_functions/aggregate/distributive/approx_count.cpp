@@ -1,6 +1,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/types/hash.hpp"
 #include "duckdb/common/types/hyperloglog.hpp"
+#include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "duckdb/core_functions/aggregate/distributive_functions.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
@@ -96,4 +97,58 @@ AggregateFunction ApproxCountDistinctFun::GetFunction() {
 	return GetApproxCountDistinctFunction(LogicalType::ANY);
 }
 
+//===--------------------------------------------------------------------===//
+// HLL Sketches
+//===--------------------------------------------------------------------===//
+struct HLLSketchFunction : public ApproxCountDistinctFunction {
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		target = StringVector::EmptyString(finalize_data.result, state.hll.GetSketchSize());
+		state.hll.WriteSketch(data_ptr_cast(target.GetDataWriteable()));
+		target.Finalize();
+	}
+};
+
+struct HLLMergeFunction : public HLLSketchFunction {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		state.hll.MergeSketch(const_data_ptr_cast(input.GetData()), input.GetSize());
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+	                              idx_t count) {
+		// merging is idempotent
+		Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+	}
+};
+
+AggregateFunction HllSketchFun::GetFunction() {
+	auto fun = AggregateFunction(
+	    {LogicalType::ANY}, LogicalType::BLOB, AggregateFunction::StateSize<ApproxDistinctCountState>,
+	    AggregateFunction::StateInitialize<ApproxDistinctCountState, HLLSketchFunction>,
+	    ApproxCountDistinctUpdateFunction, AggregateFunction::StateCombine<ApproxDistinctCountState, HLLSketchFunction>,
+	    AggregateFunction::StateFinalize<ApproxDistinctCountState, string_t, HLLSketchFunction>,
+	    ApproxCountDistinctSimpleUpdateFunction);
+	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	return fun;
+}
+
+AggregateFunction HllMergeFun::GetFunction() {
+	return AggregateFunction::UnaryAggregate<ApproxDistinctCountState, string_t, string_t, HLLMergeFunction>(
+	    LogicalType::BLOB, LogicalType::BLOB);
+}
+
+static void HLLEstimateFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	UnaryExecutor::Execute<string_t, int64_t>(args.data[0], result, args.size(), [&](string_t sketch) {
+		HyperLogLog hll;
+		hll.MergeSketch(const_data_ptr_cast(sketch.GetData()), sketch.GetSize());
+		return UnsafeNumericCast<int64_t>(hll.Count());
+	});
+}
+
+ScalarFunction HllEstimateFun::GetFunction() {
+	return ScalarFunction({LogicalType::BLOB}, LogicalType::BIGINT, HLLEstimateFunction);
+}
+
 } // namespace duckdb
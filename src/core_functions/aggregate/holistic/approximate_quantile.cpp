@@ -3,6 +3,7 @@
 #include "t_digest.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
+#include "duckdb/common/vector_operations/binary_executor.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 
@@ -405,4 +406,163 @@ AggregateFunctionSet ApproxQuantileFun::GetFunctions() {
 	return approx_quantile;
 }
 
+//===--------------------------------------------------------------------===//
+// Quantile Sketches
+//===--------------------------------------------------------------------===//
+// A sketch is a compressed T-Digest stored as a BLOB:
+// [version: uint8][compression: double][min: double][max: double][count: uint32][count x (mean, weight): double]
+static constexpr uint8_t QUANTILE_SKETCH_VERSION = 1;
+static constexpr idx_t QUANTILE_SKETCH_HEADER_SIZE = sizeof(uint8_t) + 3 * sizeof(double) + sizeof(uint32_t);
+static constexpr idx_t QUANTILE_SKETCH_CENTROID_SIZE = 2 * sizeof(double);
+static constexpr double QUANTILE_SKETCH_MAX_COMPRESSION = 10000;
+
+static string_t WriteQuantileSketch(duckdb_tdigest::TDigest &digest, Vector &result) {
+	digest.compress();
+	auto &centroids = digest.processed();
+	auto size = QUANTILE_SKETCH_HEADER_SIZE + centroids.size() * QUANTILE_SKETCH_CENTROID_SIZE;
+	auto target = StringVector::EmptyString(result, size);
+	auto ptr = data_ptr_cast(target.GetDataWriteable());
+	Store<uint8_t>(QUANTILE_SKETCH_VERSION, ptr);
+	ptr += sizeof(uint8_t);
+	Store<double>(digest.compression(), ptr);
+	ptr += sizeof(double);
+	Store<double>(digest.min(), ptr);
+	ptr += sizeof(double);
+	Store<double>(digest.max(), ptr);
+	ptr += sizeof(double);
+	Store<uint32_t>(NumericCast<uint32_t>(centroids.size()), ptr);
+	ptr += sizeof(uint32_t);
+	for (auto &centroid : centroids) {
+		Store<double>(centroid.mean(), ptr);
+		ptr += sizeof(double);
+		Store<double>(centroid.weight(), ptr);
+		ptr += sizeof(double);
+	}
+	target.Finalize();
+	return target;
+}
+
+static unique_ptr<duckdb_tdigest::TDigest> ReadQuantileSketch(const string_t &sketch) {
+	auto size = sketch.GetSize();
+	if (size < QUANTILE_SKETCH_HEADER_SIZE) {
+		throw InvalidInputException("Invalid quantile sketch: sketch is too short");
+	}
+	auto ptr = const_data_ptr_cast(sketch.GetData());
+	auto version = Load<uint8_t>(ptr);
+	ptr += sizeof(uint8_t);
+	if (version != QUANTILE_SKETCH_VERSION) {
+		throw InvalidInputException("Invalid quantile sketch: unknown version %d", static_cast<int>(version));
+	}
+	auto compression = Load<double>(ptr);
+	ptr += sizeof(double);
+	auto min = Load<double>(ptr);
+	ptr += sizeof(double);
+	auto max = Load<double>(ptr);
+	ptr += sizeof(double);
+	auto count = Load<uint32_t>(ptr);
+	ptr += sizeof(uint32_t);
+	if (!(compression > 0 && compression <= QUANTILE_SKETCH_MAX_COMPRESSION)) {
+		throw InvalidInputException("Invalid quantile sketch: compression out of range");
+	}
+	if (count == 0 || size != QUANTILE_SKETCH_HEADER_SIZE + count * QUANTILE_SKETCH_CENTROID_SIZE) {
+		throw InvalidInputException("Invalid quantile sketch: size does not match the number of centroids");
+	}
+
+	std::vector<duckdb_tdigest::Centroid> centroids;
+	centroids.reserve(count);
+	for (idx_t i = 0; i < count; i++) {
+		auto mean = Load<double>(ptr);
+		ptr += sizeof(double);
+		auto weight = Load<double>(ptr);
+		ptr += sizeof(double);
+		if (!Value::DoubleIsFinite(mean) || !Value::DoubleIsFinite(weight) || weight <= 0 ||
+		    (i > 0 && mean < centroids.back().mean())) {
+			throw InvalidInputException("Invalid quantile sketch: invalid centroid");
+		}
+		centroids.emplace_back(mean, weight);
+	}
+	if (!(min <= centroids.front().mean() && max >= centroids.back().mean())) {
+		throw InvalidInputException("Invalid quantile sketch: invalid bounds");
+	}
+
+	auto result = make_uniq<duckdb_tdigest::TDigest>(std::move(centroids), std::vector<duckdb_tdigest::Centroid>(),
+	                                                 compression, 0, 0);
+	result->mergeBounds(min, max);
+	return result;
+}
+
+struct QuantileSketchOperation : public ApproxQuantileOperation {
+	template <class STATE, class OP>
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &input_data) {
+		ApproxQuantileOperation::Combine<STATE, OP>(source, target, input_data);
+		if (source.pos > 0) {
+			target.h->mergeBounds(source.h->min(), source.h->max());
+		}
+	}
+
+	template <class TARGET_TYPE, class STATE>
+	static void Finalize(STATE &state, TARGET_TYPE &target, AggregateFinalizeData &finalize_data) {
+		if (state.pos == 0) {
+			finalize_data.ReturnNull();
+			return;
+		}
+		D_ASSERT(state.h);
+		target = WriteQuantileSketch(*state.h, finalize_data.result);
+	}
+};
+
+struct QuantileSketchMergeOperation : public QuantileSketchOperation {
+	template <class STATE>
+	static void MergeSketch(STATE &state, const duckdb_tdigest::TDigest &sketch) {
+		if (!state.h) {
+			state.h = new duckdb_tdigest::TDigest(sketch.compression());
+		}
+		state.h->merge(&sketch);
+		state.h->mergeBounds(sketch.min(), sketch.max());
+		state.pos += UnsafeNumericCast<idx_t>(sketch.totalWeight());
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		auto sketch = ReadQuantileSketch(input);
+		MergeSketch(state, *sketch);
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+	                              idx_t count) {
+		// unlike HyperLogLog, merging a T-Digest with itself adds its weight again
+		auto sketch = ReadQuantileSketch(input);
+		for (idx_t i = 0; i < count; i++) {
+			MergeSketch(state, *sketch);
+		}
+	}
+};
+
+AggregateFunction QuantileSketchFun::GetFunction() {
+	return AggregateFunction::UnaryAggregateDestructor<ApproxQuantileState, double, string_t,
+	                                                   QuantileSketchOperation>(LogicalType::DOUBLE,
+	                                                                            LogicalType::BLOB);
+}
+
+AggregateFunction QuantileSketchMergeFun::GetFunction() {
+	return AggregateFunction::UnaryAggregateDestructor<ApproxQuantileState, string_t, string_t,
+	                                                   QuantileSketchMergeOperation>(LogicalType::BLOB,
+	                                                                                 LogicalType::BLOB);
+}
+
+static void SketchQuantileFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	BinaryExecutor::Execute<string_t, double, double>(
+	    args.data[0], args.data[1], result, args.size(), [&](string_t sketch, double quantile) {
+		    if (!(quantile >= 0 && quantile <= 1)) {
+			    throw InvalidInputException("sketch_quantile can only take quantiles in range [0, 1]");
+		    }
+		    return ReadQuantileSketch(sketch)->quantile(quantile);
+	    });
+}
+
+ScalarFunction SketchQuantileFun::GetFunction() {
+	return ScalarFunction({LogicalType::BLOB, LogicalType::DOUBLE}, LogicalType::DOUBLE, SketchQuantileFunction);
+}
+
 } // namespace duckdb
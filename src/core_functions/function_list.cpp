@@ -205,6 +205,9 @@ static const StaticFunctionDefinition internal_functions[] = {
 	DUCKDB_SCALAR_FUNCTION_SET(HexFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(HistogramFun),
 	DUCKDB_AGGREGATE_FUNCTION(HistogramExactFun),
+	DUCKDB_SCALAR_FUNCTION(HllEstimateFun),
+	DUCKDB_AGGREGATE_FUNCTION(HllMergeFun),
+	DUCKDB_AGGREGATE_FUNCTION(HllSketchFun),
 	DUCKDB_SCALAR_FUNCTION_SET(HoursFun),
 	DUCKDB_SCALAR_FUNCTION(InSearchPathFun),
 	DUCKDB_SCALAR_FUNCTION(InstrFun),
@@ -305,6 +308,8 @@ static const StaticFunctionDefinition internal_functions[] = {
 	DUCKDB_AGGREGATE_FUNCTION_SET_ALIAS(QuantileFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(QuantileContFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(QuantileDiscFun),
+	DUCKDB_AGGREGATE_FUNCTION(QuantileSketchFun),
+	DUCKDB_AGGREGATE_FUNCTION(QuantileSketchMergeFun),
 	DUCKDB_SCALAR_FUNCTION_SET(QuarterFun),
 	DUCKDB_SCALAR_FUNCTION(RadiansFun),
 	DUCKDB_SCALAR_FUNCTION(RandomFun),
@@ -341,6 +346,7 @@ static const StaticFunctionDefinition internal_functions[] = {
 	DUCKDB_SCALAR_FUNCTION_SET(SignBitFun),
 	DUCKDB_SCALAR_FUNCTION(SinFun),
 	DUCKDB_SCALAR_FUNCTION(SinhFun),
+	DUCKDB_SCALAR_FUNCTION(SketchQuantileFun),
 	DUCKDB_AGGREGATE_FUNCTION(SkewnessFun),
 	DUCKDB_SCALAR_FUNCTION_ALIAS(SplitFun),
 	DUCKDB_SCALAR_FUNCTION(SqrtFun),
@@ -181,16 +181,12 @@ LambdaFunctions::GetMutableColumnInfo(vector<LambdaFunctions::ColumnInfo> &data)
 	return inconstant_info;
 }
 
-void ExecuteExpression(const idx_t elem_cnt, const LambdaFunctions::ColumnInfo &column_info,
-                       const vector<LambdaFunctions::ColumnInfo> &column_infos, const Vector &index_vector,
-                       LambdaExecuteInfo &info) {
+void ExecuteExpression(const idx_t elem_cnt, Vector &slice, const vector<LambdaFunctions::ColumnInfo> &column_infos,
+                       const Vector &index_vector, LambdaExecuteInfo &info) {
 
 	info.input_chunk.SetCardinality(elem_cnt);
 	info.lambda_chunk.SetCardinality(elem_cnt);
 
-	// slice the child vector
-	Vector slice(column_info.vector, column_info.sel, elem_cnt);
-
 	// reference the child vector (and the index vector)
 	if (info.has_index) {
 		info.input_chunk.data[0].Reference(index_vector);
@@ -219,6 +215,39 @@ void ExecuteExpression(const idx_t elem_cnt, const LambdaFunctions::ColumnInfo &
 	info.expr_executor->Execute(info.input_chunk, info.lambda_chunk);
 }
 
+void ExecuteExpression(const idx_t elem_cnt, const LambdaFunctions::ColumnInfo &column_info,
+                       const vector<LambdaFunctions::ColumnInfo> &column_infos, const Vector &index_vector,
+                       LambdaExecuteInfo &info) {
+	// slice the child vector
+	Vector slice(column_info.vector, column_info.sel, elem_cnt);
+	ExecuteExpression(elem_cnt, slice, column_infos, index_vector, info);
+}
+
+//! Returns true, if the elements of all valid lists follow each other in the child vector, i.e., if we can execute
+//! the lambda expression on ranges of the child vector instead of slicing it element by element
+static bool GetContiguousRange(const LambdaFunctions::LambdaInfo &info, idx_t &begin, idx_t &end) {
+	bool found_list = false;
+	begin = 0;
+	end = 0;
+	for (idx_t row_idx = 0; row_idx < info.row_count; row_idx++) {
+		auto list_idx = info.list_column_format.sel->get_index(row_idx);
+		const auto &list_entry = info.list_entries[list_idx];
+		if (!info.list_column_format.validity.RowIsValid(list_idx) || list_entry.length == 0) {
+			continue;
+		}
+		if (!found_list) {
+			begin = list_entry.offset;
+			end = list_entry.offset;
+			found_list = true;
+		}
+		if (list_entry.offset != end) {
+			return false;
+		}
+		end += list_entry.length;
+	}
+	return true;
+}
+
 //===--------------------------------------------------------------------===//
 // ListLambdaBindData
 //===--------------------------------------------------------------------===//
@@ -278,6 +307,48 @@ LogicalType LambdaFunctions::BindTernaryLambda(const idx_t parameter_idx, const
 	}
 }
 
+//! Executes the lambda expression on STANDARD_VECTOR_SIZE ranges of the (contiguous) list elements
+template <class FUNCTION_FUNCTOR>
+void ExecuteContiguousLambda(LambdaFunctions::LambdaInfo &info, const idx_t begin, const idx_t end,
+                             Vector &index_vector, list_entry_t *result_entries, ListFilterInfo &list_filter_info,
+                             LambdaExecuteInfo &execute_info) {
+
+	// the position of the next element in its list, for the index vector
+	idx_t index_row = 0;
+	idx_t index_child = 0;
+	auto index_data = FlatVector::GetData<int64_t>(index_vector);
+
+	auto offset = begin;
+	do {
+		auto elem_cnt = MinValue<idx_t>(end - offset, STANDARD_VECTOR_SIZE);
+		if (info.has_index) {
+			for (idx_t i = 0; i < elem_cnt; i++) {
+				// skip NULL lists and exhausted lists
+				while (true) {
+					auto list_idx = info.list_column_format.sel->get_index(index_row);
+					if (info.list_column_format.validity.RowIsValid(list_idx) &&
+					    index_child < info.list_entries[list_idx].length) {
+						break;
+					}
+					index_row++;
+					index_child = 0;
+				}
+				index_child++;
+				index_data[i] = NumericCast<int64_t>(index_child);
+			}
+		}
+
+		execute_info.lambda_chunk.Reset();
+		Vector slice(*info.child_vector, offset, offset + elem_cnt);
+		ExecuteExpression(elem_cnt, slice, info.column_infos, index_vector, execute_info);
+		auto &lambda_vector = execute_info.lambda_chunk.data[0];
+
+		FUNCTION_FUNCTOR::AppendResult(info.result, lambda_vector, elem_cnt, result_entries, list_filter_info,
+		                               execute_info);
+		offset += elem_cnt;
+	} while (offset < end);
+}
+
 template <class FUNCTION_FUNCTOR>
 void ExecuteLambda(DataChunk &args, ExpressionState &state, Vector &result) {
 
@@ -305,6 +376,11 @@ void ExecuteLambda(DataChunk &args, ExpressionState &state, Vector &result) {
 	// additional index vector
 	Vector index_vector(LogicalType::BIGINT);
 
+	// if the lists are stored back-to-back and there are no other inconstant inputs,
+	// we can execute the lambda expression on the child vector directly
+	idx_t range_begin, range_end;
+	auto contiguous = mutable_column_infos.empty() && GetContiguousRange(info, range_begin, range_end);
+
 	// loop over the child entries and create chunks to be executed by the expression executor
 	idx_t elem_cnt = 0;
 	idx_t offset = 0;
@@ -327,6 +403,11 @@ void ExecuteLambda(DataChunk &args, ExpressionState &state, Vector &result) {
 			continue;
 		}
 
+		// contiguous lists are executed on ranges of the child vector below
+		if (contiguous) {
+			continue;
+		}
+
 		// iterate the elements of the current list and create the corresponding selection vectors
 		for (idx_t child_idx = 0; child_idx < list_entry.length; child_idx++) {
 
@@ -358,11 +439,17 @@ void ExecuteLambda(DataChunk &args, ExpressionState &state, Vector &result) {
 		}
 	}
 
-	execute_info.lambda_chunk.Reset();
-	ExecuteExpression(elem_cnt, child_info, info.column_infos, index_vector, execute_info);
-	auto &lambda_vector = execute_info.lambda_chunk.data[0];
+	if (contiguous) {
+		ExecuteContiguousLambda<FUNCTION_FUNCTOR>(info, range_begin, range_end, index_vector, result_entries,
+		                                          list_filter_info, execute_info);
+	} else {
+		execute_info.lambda_chunk.Reset();
+		ExecuteExpression(elem_cnt, child_info, info.column_infos, index_vector, execute_info);
+		auto &lambda_vector = execute_info.lambda_chunk.data[0];
 
-	FUNCTION_FUNCTOR::AppendResult(result, lambda_vector, elem_cnt, result_entries, list_filter_info, execute_info);
+		FUNCTION_FUNCTOR::AppendResult(result, lambda_vector, elem_cnt, result_entries, list_filter_info,
+		                               execute_info);
+	}
 
 	if (info.is_all_constant && !info.is_volatile) {
 		result.SetVectorType(VectorType::CONSTANT_VECTOR);
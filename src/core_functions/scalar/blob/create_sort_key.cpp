@@ -729,6 +729,15 @@ void CreateSortKeyHelpers::CreateSortKey(Vector &input, idx_t input_count, Order
 	CreateSortKeyInternal(sort_key_data, modifiers, result, input_count);
 }
 
+void CreateSortKeyHelpers::CreateSortKey(DataChunk &input, const vector<OrderModifiers> &modifiers, Vector &result) {
+	D_ASSERT(input.ColumnCount() == modifiers.size());
+	vector<unique_ptr<SortKeyVectorData>> sort_key_data;
+	for (idx_t c = 0; c < input.ColumnCount(); c++) {
+		sort_key_data.push_back(make_uniq<SortKeyVectorData>(input.data[c], input.size(), modifiers[c]));
+	}
+	CreateSortKeyInternal(sort_key_data, modifiers, result, input.size());
+}
+
 void CreateSortKeyHelpers::CreateSortKeyWithValidity(Vector &input, Vector &result, const OrderModifiers &modifiers,
                                                      const idx_t count) {
 	CreateSortKey(input, count, modifiers, result);
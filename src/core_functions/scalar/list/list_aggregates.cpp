@@ -1,5 +1,6 @@
 #include "duckdb/core_functions/scalar/list_functions.hpp"
 #include "duckdb/core_functions/aggregate/nested_functions.hpp"
+#include "duckdb/core_functions/aggregate/sum_helpers.hpp"
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
 #include "duckdb/execution/expression_executor.hpp"
@@ -13,6 +14,14 @@
 #include "duckdb/core_functions/create_sort_key.hpp"
 #include "duckdb/common/owning_string_map.hpp"
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DUCKDB_LIST_REDUCTION_AVX2
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define DUCKDB_LIST_REDUCTION_NEON
+#include <arm_neon.h>
+#endif
+
 namespace duckdb {
 
 // FIXME: use a local state for each thread to increase performance?
@@ -24,12 +33,19 @@ static unique_ptr<FunctionData> ListAggregatesBindFailure(ScalarFunction &bound_
 	return make_uniq<VariableReturnBindData>(LogicalType::SQLNULL);
 }
 
+//! Computes an aggregate over each list of the lists vector directly on the child vector, without aggregate states
+typedef void (*list_segmented_reduction_t)(Vector &lists, idx_t count, Vector &result);
+
+static list_segmented_reduction_t GetSegmentedReduction(const BoundAggregateExpression &aggr);
+
 struct ListAggregatesBindData : public FunctionData {
 	ListAggregatesBindData(const LogicalType &stype_p, unique_ptr<Expression> aggr_expr_p);
 	~ListAggregatesBindData() override;
 
 	LogicalType stype;
 	unique_ptr<Expression> aggr_expr;
+	//! The segmented reduction that computes the aggregate, if the aggregate has one
+	list_segmented_reduction_t segmented_reduction;
 
 	unique_ptr<FunctionData> Copy() const override {
 		return make_uniq<ListAggregatesBindData>(stype, aggr_expr->Copy());
@@ -68,6 +84,7 @@ struct ListAggregatesBindData : public FunctionData {
 
 ListAggregatesBindData::ListAggregatesBindData(const LogicalType &stype_p, unique_ptr<Expression> aggr_expr_p)
     : stype(stype_p), aggr_expr(std::move(aggr_expr_p)) {
+	segmented_reduction = GetSegmentedReduction(aggr_expr->Cast<BoundAggregateExpression>());
 }
 
 ListAggregatesBindData::~ListAggregatesBindData() {
@@ -188,6 +205,388 @@ struct UniqueFunctor {
 	}
 };
 
+//===--------------------------------------------------------------------===//
+// Segmented reductions
+//===--------------------------------------------------------------------===//
+// sum, avg, min and max over lists of numbers are computed with a tight loop over the entries of every list in the
+// child vector, instead of scattering the entries over one aggregate state per list. The reductions produce exactly
+// the same results as the aggregates: they add the values in the same order, with the same types. Lists of integers
+// are reduced with AVX2 or NEON kernels, for which the order of the additions does not matter.
+
+#ifdef DUCKDB_LIST_REDUCTION_AVX2
+#define DUCKDB_LIST_REDUCTION_TARGET __attribute__((target("avx2")))
+//! The amount of 32-bit values reduced by a single SIMD operation
+static constexpr idx_t LIST_REDUCTION_WIDTH = 8;
+
+static bool HasSIMDListReduction() {
+	static const bool supported = []() {
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+	}();
+	return supported;
+}
+#elif defined(DUCKDB_LIST_REDUCTION_NEON)
+#define DUCKDB_LIST_REDUCTION_TARGET
+static constexpr idx_t LIST_REDUCTION_WIDTH = 4;
+
+static bool HasSIMDListReduction() {
+	return true;
+}
+#endif
+
+#if defined(DUCKDB_LIST_REDUCTION_AVX2) || defined(DUCKDB_LIST_REDUCTION_NEON)
+//! Folds the minimum or maximum of the values LIST_REDUCTION_WIDTH at a time into the state, returns the amount of
+//! values that were folded
+template <bool IS_MAX>
+DUCKDB_LIST_REDUCTION_TARGET static idx_t MinMaxInt32SIMD(int32_t &state, const int32_t *values, idx_t count) {
+	if (count < LIST_REDUCTION_WIDTH) {
+		return 0;
+	}
+	idx_t i = 0;
+	int32_t lanes[LIST_REDUCTION_WIDTH];
+#ifdef DUCKDB_LIST_REDUCTION_AVX2
+	auto accumulator = _mm256_set1_epi32(state);
+	for (; i + LIST_REDUCTION_WIDTH <= count; i += LIST_REDUCTION_WIDTH) {
+		auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i));
+		accumulator = IS_MAX ? _mm256_max_epi32(accumulator, input) : _mm256_min_epi32(accumulator, input);
+	}
+	_mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), accumulator);
+#else
+	auto accumulator = vdupq_n_s32(state);
+	for (; i + LIST_REDUCTION_WIDTH <= count; i += LIST_REDUCTION_WIDTH) {
+		auto input = vld1q_s32(values + i);
+		accumulator = IS_MAX ? vmaxq_s32(accumulator, input) : vminq_s32(accumulator, input);
+	}
+	vst1q_s32(lanes, accumulator);
+#endif
+	for (idx_t lane_idx = 0; lane_idx < LIST_REDUCTION_WIDTH; lane_idx++) {
+		state = IS_MAX ? MaxValue(state, lanes[lane_idx]) : MinValue(state, lanes[lane_idx]);
+	}
+	return i;
+}
+
+//! Adds the values LIST_REDUCTION_WIDTH at a time to the 64-bit state, returns the amount of values that were added
+DUCKDB_LIST_REDUCTION_TARGET static idx_t SumInt32SIMD(int64_t &state, const int32_t *values, idx_t count) {
+	if (count < LIST_REDUCTION_WIDTH) {
+		return 0;
+	}
+	idx_t i = 0;
+	int64_t lanes[LIST_REDUCTION_WIDTH / 2];
+#ifdef DUCKDB_LIST_REDUCTION_AVX2
+	auto low_sum = _mm256_setzero_si256();
+	auto high_sum = _mm256_setzero_si256();
+	for (; i + LIST_REDUCTION_WIDTH <= count; i += LIST_REDUCTION_WIDTH) {
+		auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i));
+		low_sum = _mm256_add_epi64(low_sum, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(input)));
+		high_sum = _mm256_add_epi64(high_sum, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(input, 1)));
+	}
+	_mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), _mm256_add_epi64(low_sum, high_sum));
+#else
+	auto sum = vdupq_n_s64(0);
+	for (; i + LIST_REDUCTION_WIDTH <= count; i += LIST_REDUCTION_WIDTH) {
+		// adds adjacent pairs of 32-bit values to the 64-bit lanes
+		sum = vpadalq_s32(sum, vld1q_s32(values + i));
+	}
+	vst1q_s64(lanes, sum);
+#endif
+	for (idx_t lane_idx = 0; lane_idx < LIST_REDUCTION_WIDTH / 2; lane_idx++) {
+		state += lanes[lane_idx];
+	}
+	return i;
+}
+#endif
+
+struct ListMinReduction {
+	template <class STATE, class INPUT_TYPE>
+	static void Initialize(STATE &state, INPUT_TYPE input) {
+		state = input;
+	}
+	//! Adds the first values of the span at once, returns the amount of added values
+	template <class STATE, class INPUT_TYPE>
+	static idx_t AddSpan(STATE &state, const INPUT_TYPE *input, idx_t count) {
+		return 0;
+	}
+	static idx_t AddSpan(int32_t &state, const int32_t *input, idx_t count) {
+#if defined(DUCKDB_LIST_REDUCTION_AVX2) || defined(DUCKDB_LIST_REDUCTION_NEON)
+		if (HasSIMDListReduction()) {
+			return MinMaxInt32SIMD<false>(state, input, count);
+		}
+#endif
+		return 0;
+	}
+	template <class STATE, class INPUT_TYPE>
+	static void Add(STATE &state, INPUT_TYPE input) {
+		if (LessThan::Operation<INPUT_TYPE>(input, state)) {
+			state = input;
+		}
+	}
+	template <class RESULT_TYPE, class STATE>
+	static RESULT_TYPE Finalize(STATE &state, idx_t count) {
+		return state;
+	}
+};
+
+struct ListMaxReduction : public ListMinReduction {
+	template <class STATE, class INPUT_TYPE>
+	static idx_t AddSpan(STATE &state, const INPUT_TYPE *input, idx_t count) {
+		return 0;
+	}
+	static idx_t AddSpan(int32_t &state, const int32_t *input, idx_t count) {
+#if defined(DUCKDB_LIST_REDUCTION_AVX2) || defined(DUCKDB_LIST_REDUCTION_NEON)
+		if (HasSIMDListReduction()) {
+			return MinMaxInt32SIMD<true>(state, input, count);
+		}
+#endif
+		return 0;
+	}
+	template <class STATE, class INPUT_TYPE>
+	static void Add(STATE &state, INPUT_TYPE input) {
+		if (GreaterThan::Operation<INPUT_TYPE>(input, state)) {
+			state = input;
+		}
+	}
+};
+
+//! Sums into the state with regular additions, starting from zero
+struct ListRegularSumReduction {
+	template <class STATE, class INPUT_TYPE>
+	static void Initialize(STATE &state, INPUT_TYPE input) {
+		state = 0;
+		Add(state, input);
+	}
+	template <class STATE, class INPUT_TYPE>
+	static idx_t AddSpan(STATE &state, const INPUT_TYPE *input, idx_t count) {
+		return 0;
+	}
+	static idx_t AddSpan(int64_t &state, const int32_t *input, idx_t count) {
+#if defined(DUCKDB_LIST_REDUCTION_AVX2) || defined(DUCKDB_LIST_REDUCTION_NEON)
+		if (HasSIMDListReduction()) {
+			return SumInt32SIMD(state, input, count);
+		}
+#endif
+		return 0;
+	}
+	template <class STATE, class INPUT_TYPE>
+	static void Add(STATE &state, INPUT_TYPE input) {
+		state += input;
+	}
+	template <class RESULT_TYPE, class STATE>
+	static RESULT_TYPE Finalize(STATE &state, idx_t count) {
+		return Hugeint::Convert(state);
+	}
+};
+
+struct ListDoubleSumReduction : public ListRegularSumReduction {
+	template <class RESULT_TYPE, class STATE>
+	static RESULT_TYPE Finalize(STATE &state, idx_t count) {
+		return state;
+	}
+};
+
+//! Sums into a hugeint state
+struct ListHugeintSumReduction {
+	template <class STATE, class INPUT_TYPE>
+	static void Initialize(STATE &state, INPUT_TYPE input) {
+		state = hugeint_t(0);
+		Add(state, input);
+	}
+	template <class STATE, class INPUT_TYPE>
+	static idx_t AddSpan(STATE &state, const INPUT_TYPE *input, idx_t count) {
+		return 0;
+	}
+	template <class STATE, class INPUT_TYPE>
+	static void Add(STATE &state, INPUT_TYPE input) {
+		AddToHugeint::AddValue(state, uint64_t(input), input >= 0);
+	}
+	template <class RESULT_TYPE, class STATE>
+	static RESULT_TYPE Finalize(STATE &state, idx_t count) {
+		return state;
+	}
+};
+
+struct ListIntegerAverageReduction : public ListRegularSumReduction {
+	template <class RESULT_TYPE, class STATE>
+	static RESULT_TYPE Finalize(STATE &state, idx_t count) {
+		return double(state) / double(count);
+	}
+};
+
+struct ListDoubleAverageReduction : public ListRegularSumReduction {
+	template <class RESULT_TYPE, class STATE>
+	static RESULT_TYPE Finalize(STATE &state, idx_t count) {
+		return state / count;
+	}
+};
+
+struct ListHugeintAverageReduction : public ListHugeintSumReduction {
+	template <class RESULT_TYPE, class STATE>
+	static RESULT_TYPE Finalize(STATE &state, idx_t count) {
+		return Hugeint::Cast<long double>(state) / static_cast<long double>(count);
+	}
+};
+
+template <class INPUT_TYPE, class STATE, class RESULT_TYPE, class OP>
+static void ListSegmentedReduction(Vector &lists, idx_t count, Vector &result) {
+	auto lists_size = ListVector::GetListSize(lists);
+	auto &child_vector = ListVector::GetEntry(lists);
+	child_vector.Flatten(lists_size);
+	auto child_values = FlatVector::GetData<INPUT_TYPE>(child_vector);
+	auto &child_validity = FlatVector::Validity(child_vector);
+
+	UnifiedVectorFormat lists_data;
+	lists.ToUnifiedFormat(count, lists_data);
+	auto list_entries = UnifiedVectorFormat::GetData<list_entry_t>(lists_data);
+
+	auto result_data = FlatVector::GetData<RESULT_TYPE>(result);
+	auto &result_validity = FlatVector::Validity(result);
+	for (idx_t i = 0; i < count; i++) {
+		auto lists_index = lists_data.sel->get_index(i);
+		if (!lists_data.validity.RowIsValid(lists_index)) {
+			result_validity.SetInvalid(i);
+			continue;
+		}
+		const auto &list_entry = list_entries[lists_index];
+		auto start = list_entry.offset;
+		auto end = list_entry.offset + list_entry.length;
+		STATE state;
+		idx_t valid_count = 0;
+		if (child_validity.AllValid()) {
+			if (start < end) {
+				OP::Initialize(state, child_values[start]);
+				auto child_idx = start + 1;
+				child_idx += OP::AddSpan(state, child_values + child_idx, end - child_idx);
+				for (; child_idx < end; child_idx++) {
+					OP::Add(state, child_values[child_idx]);
+				}
+			}
+			valid_count = list_entry.length;
+		} else {
+			for (idx_t child_idx = start; child_idx < end; child_idx++) {
+				if (!child_validity.RowIsValid(child_idx)) {
+					continue;
+				}
+				if (valid_count == 0) {
+					OP::Initialize(state, child_values[child_idx]);
+				} else {
+					OP::Add(state, child_values[child_idx]);
+				}
+				valid_count++;
+			}
+		}
+		if (valid_count == 0) {
+			// like the aggregates, the reduction of an empty list or a list with only NULLs is NULL
+			result_validity.SetInvalid(i);
+			continue;
+		}
+		result_data[i] = OP::template Finalize<RESULT_TYPE>(state, valid_count);
+	}
+}
+
+template <class OP>
+static list_segmented_reduction_t GetMinMaxReduction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT8:
+		return ListSegmentedReduction<int8_t, int8_t, int8_t, OP>;
+	case PhysicalType::INT16:
+		return ListSegmentedReduction<int16_t, int16_t, int16_t, OP>;
+	case PhysicalType::INT32:
+		return ListSegmentedReduction<int32_t, int32_t, int32_t, OP>;
+	case PhysicalType::INT64:
+		return ListSegmentedReduction<int64_t, int64_t, int64_t, OP>;
+	case PhysicalType::INT128:
+		return ListSegmentedReduction<hugeint_t, hugeint_t, hugeint_t, OP>;
+	case PhysicalType::UINT8:
+		return ListSegmentedReduction<uint8_t, uint8_t, uint8_t, OP>;
+	case PhysicalType::UINT16:
+		return ListSegmentedReduction<uint16_t, uint16_t, uint16_t, OP>;
+	case PhysicalType::UINT32:
+		return ListSegmentedReduction<uint32_t, uint32_t, uint32_t, OP>;
+	case PhysicalType::UINT64:
+		return ListSegmentedReduction<uint64_t, uint64_t, uint64_t, OP>;
+	case PhysicalType::UINT128:
+		return ListSegmentedReduction<uhugeint_t, uhugeint_t, uhugeint_t, OP>;
+	case PhysicalType::FLOAT:
+		return ListSegmentedReduction<float, float, float, OP>;
+	case PhysicalType::DOUBLE:
+		return ListSegmentedReduction<double, double, double, OP>;
+	default:
+		return nullptr;
+	}
+}
+
+static list_segmented_reduction_t GetSegmentedReduction(const BoundAggregateExpression &aggr) {
+	auto &function = aggr.function;
+	if (aggr.IsDistinct() || aggr.filter || aggr.order_bys || function.arguments.size() != 1 || aggr.bind_info) {
+		return nullptr;
+	}
+	auto &input_type = function.arguments[0];
+	auto &return_type = function.return_type;
+	if (function.name == "min" || function.name == "max") {
+		if (input_type != return_type) {
+			return nullptr;
+		}
+		// only types that are ordered by their physical value
+		switch (input_type.id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+		case LogicalTypeId::BIGINT:
+		case LogicalTypeId::HUGEINT:
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+		case LogicalTypeId::UBIGINT:
+		case LogicalTypeId::UHUGEINT:
+		case LogicalTypeId::FLOAT:
+		case LogicalTypeId::DOUBLE:
+		case LogicalTypeId::DECIMAL:
+		case LogicalTypeId::DATE:
+		case LogicalTypeId::TIME:
+		case LogicalTypeId::TIMESTAMP:
+		case LogicalTypeId::TIMESTAMP_SEC:
+		case LogicalTypeId::TIMESTAMP_MS:
+		case LogicalTypeId::TIMESTAMP_NS:
+		case LogicalTypeId::TIMESTAMP_TZ:
+			break;
+		default:
+			return nullptr;
+		}
+		if (function.name == "min") {
+			return GetMinMaxReduction<ListMinReduction>(input_type.InternalType());
+		}
+		return GetMinMaxReduction<ListMaxReduction>(input_type.InternalType());
+	}
+	if (function.name == "sum") {
+		switch (input_type.id()) {
+		case LogicalTypeId::SMALLINT:
+			return ListSegmentedReduction<int16_t, int64_t, hugeint_t, ListRegularSumReduction>;
+		case LogicalTypeId::INTEGER:
+			return ListSegmentedReduction<int32_t, int64_t, hugeint_t, ListRegularSumReduction>;
+		case LogicalTypeId::BIGINT:
+			return ListSegmentedReduction<int64_t, hugeint_t, hugeint_t, ListHugeintSumReduction>;
+		case LogicalTypeId::DOUBLE:
+			return ListSegmentedReduction<double, double, double, ListDoubleSumReduction>;
+		default:
+			return nullptr;
+		}
+	}
+	if (function.name == "avg") {
+		switch (input_type.id()) {
+		case LogicalTypeId::SMALLINT:
+			return ListSegmentedReduction<int16_t, int64_t, double, ListIntegerAverageReduction>;
+		case LogicalTypeId::INTEGER:
+			return ListSegmentedReduction<int32_t, hugeint_t, double, ListHugeintAverageReduction>;
+		case LogicalTypeId::BIGINT:
+			return ListSegmentedReduction<int64_t, hugeint_t, double, ListHugeintAverageReduction>;
+		case LogicalTypeId::DOUBLE:
+			return ListSegmentedReduction<double, double, double, ListDoubleAverageReduction>;
+		default:
+			return nullptr;
+		}
+	}
+	return nullptr;
+}
+
 template <class FUNCTION_FUNCTOR, bool IS_AGGR = false>
 static void ListAggregatesFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	auto count = args.size();
@@ -206,6 +605,13 @@ static void ListAggregatesFunction(DataChunk &args, ExpressionState &state, Vect
 	// get the aggregate function
 	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
 	auto &info = func_expr.bind_info->Cast<ListAggregatesBindData>();
+	if (IS_AGGR && info.segmented_reduction) {
+		info.segmented_reduction(lists, count, result);
+		if (args.AllConstant()) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+		}
+		return;
+	}
 	auto &aggr = info.aggr_expr->Cast<BoundAggregateExpression>();
 	ArenaAllocator allocator(Allocator::DefaultAllocator());
 	AggregateInputData aggr_input_data(aggr.bind_info.get(), allocator);
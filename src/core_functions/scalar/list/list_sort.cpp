@@ -100,21 +100,11 @@ void SinkDataChunk(Vector *child_vector, SelectionVector &sel, idx_t offset_list
 	data_to_sort = true;
 }
 
-static void ListSortFunction(DataChunk &args, ExpressionState &state, Vector &result) {
-	D_ASSERT(args.ColumnCount() >= 1 && args.ColumnCount() <= 3);
-	auto count = args.size();
-	Vector &input_lists = args.data[0];
-
-	result.SetVectorType(VectorType::FLAT_VECTOR);
-	auto &result_validity = FlatVector::Validity(result);
-
-	if (input_lists.GetType().id() == LogicalTypeId::SQLNULL) {
-		result_validity.SetInvalid(0);
-		return;
-	}
-
-	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
-	auto &info = func_expr.bind_info->Cast<ListSortBindData>();
+//! Sorts the entries of all lists with the sort state, using the list index as the first sort key.
+//! Fills sel_sorted with the sorted order of the child entries, and returns the number of sorted entries.
+static idx_t SortWithSortState(ListSortBindData &info, Vector &child_vector, UnifiedVectorFormat &lists_data,
+                               idx_t count, ValidityMask &result_validity, SelectionVector &sel_sorted) {
+	auto list_entries = UnifiedVectorFormat::GetData<list_entry_t>(lists_data);
 
 	// initialize the global and local sorting state
 	auto &buffer_manager = BufferManager::GetBufferManager(info.context);
@@ -122,20 +112,6 @@ static void ListSortFunction(DataChunk &args, ExpressionState &state, Vector &re
 	LocalSortState local_sort_state;
 	local_sort_state.Initialize(global_sort_state, buffer_manager);
 
-	Vector sort_result_vec = info.is_grade_up ? Vector(input_lists.GetType()) : result;
-
-	// this ensures that we do not change the order of the entries in the input chunk
-	VectorOperations::Copy(input_lists, sort_result_vec, count, 0, 0);
-
-	// get the child vector
-	auto lists_size = ListVector::GetListSize(sort_result_vec);
-	auto &child_vector = ListVector::GetEntry(sort_result_vec);
-
-	// get the lists data
-	UnifiedVectorFormat lists_data;
-	sort_result_vec.ToUnifiedFormat(count, lists_data);
-	auto list_entries = UnifiedVectorFormat::GetData<list_entry_t>(lists_data);
-
 	// create the lists_indices vector, this contains an element for each list's entry,
 	// the element corresponds to the list's index, e.g. for [1, 2, 4], [5, 4]
 	// lists_indices contains [0, 0, 0, 1, 1]
@@ -193,6 +169,222 @@ static void ListSortFunction(DataChunk &args, ExpressionState &state, Vector &re
 		              local_sort_state, data_to_sort, lists_indices);
 	}
 
+	if (!data_to_sort) {
+		return 0;
+	}
+
+	// add local state to global state, which sorts the data
+	global_sort_state.AddLocalState(local_sort_state);
+	global_sort_state.PrepareMergePhase();
+
+	// selection vector that is to be filled with the 'sorted' payload
+	sel_sorted.Initialize(incr_payload_count);
+	idx_t sel_sorted_idx = 0;
+
+	// scan the sorted row data
+	PayloadScanner scanner(*global_sort_state.sorted_blocks[0]->payload_data, global_sort_state);
+	for (;;) {
+		DataChunk result_chunk;
+		result_chunk.Initialize(Allocator::DefaultAllocator(), info.payload_types);
+		result_chunk.SetCardinality(0);
+		scanner.Scan(result_chunk);
+		if (result_chunk.size() == 0) {
+			break;
+		}
+
+		// construct the selection vector with the new order from the result vectors
+		Vector result_vector(result_chunk.data[0]);
+		auto result_data = FlatVector::GetData<uint32_t>(result_vector);
+		auto row_count = result_chunk.size();
+
+		for (idx_t i = 0; i < row_count; i++) {
+			sel_sorted.set_index(sel_sorted_idx, result_data[i]);
+			sel_sorted_idx++;
+		}
+	}
+
+	D_ASSERT(sel_sorted_idx == incr_payload_count);
+	return sel_sorted_idx;
+}
+
+//! Whether the entries of lists of this type can be sorted with the segmented sort
+static bool SupportsSegmentedSort(const LogicalType &child_type) {
+	// only types that are ordered by their physical value
+	switch (child_type.id()) {
+	case LogicalTypeId::BOOLEAN:
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::UHUGEINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Sorts the entries of every list in place in the selection vector, which starts out as the identity.
+//! NULLs are placed before or after the values, and the sort is stable, as the sort with the sort state.
+template <class T>
+static void SegmentedSort(ListSortBindData &info, Vector &child_vector, idx_t lists_size,
+                          UnifiedVectorFormat &lists_data, idx_t count, ValidityMask &result_validity,
+                          SelectionVector &sel_sorted) {
+	auto list_entries = UnifiedVectorFormat::GetData<list_entry_t>(lists_data);
+	UnifiedVectorFormat child_data;
+	child_vector.ToUnifiedFormat(lists_size, child_data);
+	auto child_values = UnifiedVectorFormat::GetData<T>(child_data);
+	auto nulls_first = info.null_order == OrderByNullType::NULLS_FIRST;
+	auto descending = info.order_type == OrderType::DESCENDING;
+
+	auto sorted = sel_sorted.data();
+	vector<sel_t> null_entries;
+	for (idx_t i = 0; i < count; i++) {
+		auto lists_index = lists_data.sel->get_index(i);
+		if (!lists_data.validity.RowIsValid(lists_index)) {
+			result_validity.SetInvalid(i);
+			continue;
+		}
+		const auto &list_entry = list_entries[lists_index];
+		if (list_entry.length <= 1) {
+			continue;
+		}
+		auto begin = sorted + list_entry.offset;
+		auto end = begin + list_entry.length;
+
+		// move the NULLs to the front or the back, keeping their order
+		auto values_begin = begin;
+		auto values_end = end;
+		if (!child_data.validity.AllValid()) {
+			null_entries.clear();
+			auto valid_end = begin;
+			for (auto entry = begin; entry != end; entry++) {
+				if (child_data.validity.RowIsValid(child_data.sel->get_index(*entry))) {
+					*valid_end++ = *entry;
+				} else {
+					null_entries.push_back(*entry);
+				}
+			}
+			if (nulls_first) {
+				auto valid_count = NumericCast<idx_t>(valid_end - begin);
+				std::move_backward(begin, valid_end, end);
+				std::copy(null_entries.begin(), null_entries.end(), begin);
+				values_begin = end - valid_count;
+			} else {
+				std::copy(null_entries.begin(), null_entries.end(), valid_end);
+				values_end = valid_end;
+			}
+		}
+		auto &sel = *child_data.sel;
+		if (descending) {
+			std::stable_sort(values_begin, values_end, [&](sel_t lhs, sel_t rhs) {
+				return GreaterThan::Operation<T>(child_values[sel.get_index(lhs)], child_values[sel.get_index(rhs)]);
+			});
+		} else {
+			std::stable_sort(values_begin, values_end, [&](sel_t lhs, sel_t rhs) {
+				return LessThan::Operation<T>(child_values[sel.get_index(lhs)], child_values[sel.get_index(rhs)]);
+			});
+		}
+	}
+}
+
+//! Sorts the entries of every list directly on the child vector. Fills sel_sorted with the sorted order of the child
+//! entries, and returns the number of child entries.
+static idx_t SortSegmented(ListSortBindData &info, Vector &child_vector, idx_t lists_size,
+                           UnifiedVectorFormat &lists_data, idx_t count, ValidityMask &result_validity,
+                           SelectionVector &sel_sorted) {
+	sel_sorted.Initialize(lists_size);
+	for (idx_t i = 0; i < lists_size; i++) {
+		sel_sorted.set_index(i, i);
+	}
+	switch (info.child_type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		SegmentedSort<int8_t>(info, child_vector, lists_size, lists_data, count, result_validity, sel_sorted);
+		break;
+	case PhysicalType::INT16:
+		SegmentedSort<int16_t>(info, child_vector, lists_size, lists_data, count, result_validity, sel_sorted);
+		break;
+	case PhysicalType::INT32:
+		SegmentedSort<int32_t>(info, child_vector, lists_size, lists_data, count, result_validity, sel_sorted);
+		break;
+	case PhysicalType::INT64:
+		SegmentedSort<int64_t>(info, child_vector, lists_size, lists_data, count, result_validity, sel_sorted);
+		break;
+	case PhysicalType::INT128:
+		SegmentedSort<hugeint_t>(info, child_vector, lists_size, lists_data, count, result_validity, sel_sorted);
+		break;
+	case PhysicalType::UINT8:
+		SegmentedSort<uint8_t>(info, child_vector, lists_size, lists_data, count, result_validity, sel_sorted);
+		break;
+	case PhysicalType::UINT16:
+		SegmentedSort<uint16_t>(info, child_vector, lists_size, lists_data, count, result_validity, sel_sorted);
+		break;
+	case PhysicalType::UINT32:
+		SegmentedSort<uint32_t>(info, child_vector, lists_size, lists_data, count, result_validity, sel_sorted);
+		break;
+	case PhysicalType::UINT64:
+		SegmentedSort<uint64_t>(info, child_vector, lists_size, lists_data, count, result_validity, sel_sorted);
+		break;
+	case PhysicalType::UINT128:
+		SegmentedSort<uhugeint_t>(info, child_vector, lists_size, lists_data, count, result_validity, sel_sorted);
+		break;
+	case PhysicalType::FLOAT:
+		SegmentedSort<float>(info, child_vector, lists_size, lists_data, count, result_validity, sel_sorted);
+		break;
+	case PhysicalType::DOUBLE:
+		SegmentedSort<double>(info, child_vector, lists_size, lists_data, count, result_validity, sel_sorted);
+		break;
+	default:
+		throw InternalException("Unsupported type for segmented list sort");
+	}
+	return lists_size;
+}
+
+static void ListSortFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	D_ASSERT(args.ColumnCount() >= 1 && args.ColumnCount() <= 3);
+	auto count = args.size();
+	Vector &input_lists = args.data[0];
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &result_validity = FlatVector::Validity(result);
+
+	if (input_lists.GetType().id() == LogicalTypeId::SQLNULL) {
+		result_validity.SetInvalid(0);
+		return;
+	}
+
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &info = func_expr.bind_info->Cast<ListSortBindData>();
+
+	Vector sort_result_vec = info.is_grade_up ? Vector(input_lists.GetType()) : result;
+
+	// this ensures that we do not change the order of the entries in the input chunk
+	VectorOperations::Copy(input_lists, sort_result_vec, count, 0, 0);
+
+	// get the child vector
+	auto lists_size = ListVector::GetListSize(sort_result_vec);
+	auto &child_vector = ListVector::GetEntry(sort_result_vec);
+
+	// get the lists data
+	UnifiedVectorFormat lists_data;
+	sort_result_vec.ToUnifiedFormat(count, lists_data);
+	auto list_entries = UnifiedVectorFormat::GetData<list_entry_t>(lists_data);
+
 	if (info.is_grade_up) {
 		ListVector::Reserve(result, lists_size);
 		ListVector::SetListSize(result, lists_size);
@@ -200,54 +392,34 @@ static void ListSortFunction(DataChunk &args, ExpressionState &state, Vector &re
 		memcpy(result_data, list_entries, count * sizeof(list_entry_t));
 	}
 
-	if (data_to_sort) {
-		// add local state to global state, which sorts the data
-		global_sort_state.AddLocalState(local_sort_state);
-		global_sort_state.PrepareMergePhase();
-
-		// selection vector that is to be filled with the 'sorted' payload
-		SelectionVector sel_sorted(incr_payload_count);
-		idx_t sel_sorted_idx = 0;
-
-		// scan the sorted row data
-		PayloadScanner scanner(*global_sort_state.sorted_blocks[0]->payload_data, global_sort_state);
-		for (;;) {
-			DataChunk result_chunk;
-			result_chunk.Initialize(Allocator::DefaultAllocator(), info.payload_types);
-			result_chunk.SetCardinality(0);
-			scanner.Scan(result_chunk);
-			if (result_chunk.size() == 0) {
-				break;
-			}
-
-			// construct the selection vector with the new order from the result vectors
-			Vector result_vector(result_chunk.data[0]);
-			auto result_data = FlatVector::GetData<uint32_t>(result_vector);
-			auto row_count = result_chunk.size();
-
-			for (idx_t i = 0; i < row_count; i++) {
-				sel_sorted.set_index(sel_sorted_idx, result_data[i]);
-				D_ASSERT(result_data[i] < lists_size);
-				sel_sorted_idx++;
-			}
-		}
+	// lists of values that are ordered by their physical value are sorted one list at a time, which is much cheaper
+	// than setting up a sort over all lists for the many short lists that are typically sorted
+	SelectionVector sel_sorted;
+	idx_t sel_sorted_count;
+	if (SupportsSegmentedSort(info.child_type)) {
+		sel_sorted_count =
+		    SortSegmented(info, child_vector, lists_size, lists_data, count, result_validity, sel_sorted);
+	} else {
+		sel_sorted_count = SortWithSortState(info, child_vector, lists_data, count, result_validity, sel_sorted);
+	}
 
-		D_ASSERT(sel_sorted_idx == incr_payload_count);
+	if (sel_sorted_count > 0) {
 		if (info.is_grade_up) {
 			auto &result_entry = ListVector::GetEntry(result);
 			auto result_data = ListVector::GetData(result);
+			auto result_entry_data = FlatVector::GetData<int64_t>(result_entry);
 			for (idx_t i = 0; i < count; i++) {
 				if (!result_validity.RowIsValid(i)) {
 					continue;
 				}
 				for (idx_t j = result_data[i].offset; j < result_data[i].offset + result_data[i].length; j++) {
 					auto b = sel_sorted.get_index(j) - result_data[i].offset;
-					result_entry.SetValue(j, Value::BIGINT(UnsafeNumericCast<int64_t>(b + 1)));
+					result_entry_data[j] = UnsafeNumericCast<int64_t>(b + 1);
 				}
 			}
 		} else {
-			child_vector.Slice(sel_sorted, sel_sorted_idx);
-			child_vector.Flatten(sel_sorted_idx);
+			child_vector.Slice(sel_sorted, sel_sorted_count);
+			child_vector.Flatten(sel_sorted_count);
 		}
 	}
 
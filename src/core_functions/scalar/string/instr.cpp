@@ -4,28 +4,89 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/function/scalar/string_functions.hpp"
-#include "utf8proc.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DUCKDB_CODEPOINT_COUNT_AVX2
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define DUCKDB_CODEPOINT_COUNT_NEON
+#include <arm_neon.h>
+#endif
 
 namespace duckdb {
 
+#ifdef DUCKDB_CODEPOINT_COUNT_AVX2
+#define DUCKDB_CODEPOINT_COUNT_TARGET __attribute__((target("avx2,popcnt")))
+//! The amount of bytes classified by a single SIMD comparison
+static constexpr idx_t CODEPOINT_COUNT_WIDTH = 32;
+
+static bool HasSIMDCodepointCount() {
+	static const bool supported = []() {
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0 && __builtin_cpu_supports("popcnt") != 0;
+	}();
+	return supported;
+}
+#elif defined(DUCKDB_CODEPOINT_COUNT_NEON)
+#define DUCKDB_CODEPOINT_COUNT_TARGET
+static constexpr idx_t CODEPOINT_COUNT_WIDTH = 16;
+
+static bool HasSIMDCodepointCount() {
+	return true;
+}
+#endif
+
+#if defined(DUCKDB_CODEPOINT_COUNT_AVX2) || defined(DUCKDB_CODEPOINT_COUNT_NEON)
+//! Counts the UTF-8 continuation bytes CODEPOINT_COUNT_WIDTH bytes at a time, and sets i to the first byte that was
+//! not counted
+DUCKDB_CODEPOINT_COUNT_TARGET static idx_t CountContinuationBytesSIMD(const char *data, idx_t size, idx_t &i) {
+	idx_t count = 0;
+#ifdef DUCKDB_CODEPOINT_COUNT_AVX2
+	const auto prefix_mask = _mm256_set1_epi8(static_cast<char>(0xc0));
+	const auto continuation = _mm256_set1_epi8(static_cast<char>(0x80));
+	for (; i + CODEPOINT_COUNT_WIDTH <= size; i += CODEPOINT_COUNT_WIDTH) {
+		auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+		auto matches = _mm256_cmpeq_epi8(_mm256_and_si256(values, prefix_mask), continuation);
+		count += static_cast<idx_t>(__builtin_popcount(static_cast<uint32_t>(_mm256_movemask_epi8(matches))));
+	}
+#else
+	const auto prefix_mask = vdupq_n_u8(0xc0);
+	const auto continuation = vdupq_n_u8(0x80);
+	for (; i + CODEPOINT_COUNT_WIDTH <= size; i += CODEPOINT_COUNT_WIDTH) {
+		auto values = vld1q_u8(reinterpret_cast<const uint8_t *>(data + i));
+		auto matches = vceqq_u8(vandq_u8(values, prefix_mask), continuation);
+		count += vaddvq_u8(vshrq_n_u8(matches, 7));
+	}
+#endif
+	return count;
+}
+#endif
+
+//! Counts the codepoints of the UTF-8 string, i.e., the bytes that are not continuation bytes
+static idx_t CountCodepoints(const char *data, idx_t size) {
+	idx_t i = 0;
+	idx_t continuation_bytes = 0;
+#if defined(DUCKDB_CODEPOINT_COUNT_AVX2) || defined(DUCKDB_CODEPOINT_COUNT_NEON)
+	if (HasSIMDCodepointCount()) {
+		continuation_bytes = CountContinuationBytesSIMD(data, size, i);
+	}
+#endif
+	for (; i < size; i++) {
+		continuation_bytes += !LengthFun::IsCharacter(data[i]);
+	}
+	return size - continuation_bytes;
+}
+
 struct InstrOperator {
 	template <class TA, class TB, class TR>
 	static inline TR Operation(TA haystack, TB needle) {
-		int64_t string_position = 0;
-
 		auto location = ContainsFun::Find(haystack, needle);
-		if (location != DConstants::INVALID_INDEX) {
-			auto len = (utf8proc_ssize_t)location;
-			auto str = reinterpret_cast<const utf8proc_uint8_t *>(haystack.GetData());
-			D_ASSERT(len <= (utf8proc_ssize_t)haystack.GetSize());
-			for (++string_position; len > 0; ++string_position) {
-				utf8proc_int32_t codepoint;
-				auto bytes = utf8proc_iterate(str, len, &codepoint);
-				str += bytes;
-				len -= bytes;
-			}
+		if (location == DConstants::INVALID_INDEX) {
+			return 0;
 		}
-		return string_position;
+		D_ASSERT(location <= haystack.GetSize());
+		// the position is the amount of codepoints before the match: count the bytes that start a codepoint
+		return UnsafeNumericCast<TR>(CountCodepoints(haystack.GetData(), location) + 1);
 	}
 };
 
@@ -1,31 +1,85 @@
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
-#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/limits.hpp"
 #include "duckdb/common/vector.hpp"
 
+#include <algorithm>
+
 namespace duckdb {
 
-AdaptiveFilter::AdaptiveFilter(const Expression &expr) : observe_interval(10), execute_interval(20), warmup(true) {
-	auto &conj_expr = expr.Cast<BoundConjunctionExpression>();
-	D_ASSERT(conj_expr.children.size() > 1);
-	for (idx_t idx = 0; idx < conj_expr.children.size(); idx++) {
-		permutation.push_back(idx);
-		if (idx != conj_expr.children.size() - 1) {
-			swap_likeliness.push_back(100);
+void AdaptiveFilterStatistics::Update(vector<AdaptivePredicateStatistics> &local, vector<idx_t> &permutation) {
+	lock_guard<mutex> guard(lock);
+	if (predicates.size() < local.size()) {
+		predicates.resize(local.size());
+	}
+	for (idx_t idx = 0; idx < local.size(); idx++) {
+		auto &predicate = predicates[idx];
+		predicate.tuples_in += local[idx].tuples_in;
+		predicate.tuples_out += local[idx].tuples_out;
+		predicate.runtime += local[idx].runtime;
+		if (predicate.tuples_in >= DECAY_TUPLE_COUNT) {
+			predicate.tuples_in /= 2;
+			predicate.tuples_out /= 2;
+			predicate.runtime /= 2;
+		}
+		local[idx] = AdaptivePredicateStatistics();
+	}
+	GetPermutationInternal(permutation);
+}
+
+void AdaptiveFilterStatistics::GetPermutation(vector<idx_t> &permutation) {
+	lock_guard<mutex> guard(lock);
+	GetPermutationInternal(permutation);
+}
+
+void AdaptiveFilterStatistics::GetPermutationInternal(vector<idx_t> &permutation) {
+	if (predicates.size() != permutation.size()) {
+		// nothing was observed yet
+		return;
+	}
+	// the cost of a predicate per tuple it eliminates: a cheap and selective predicate should go first
+	vector<double> ranks;
+	ranks.reserve(predicates.size());
+	for (auto &predicate : predicates) {
+		if (predicate.tuples_in == 0) {
+			// not observed: evaluate it first so we learn about it
+			ranks.push_back(0);
+			continue;
 		}
+		auto tuples_in = static_cast<double>(predicate.tuples_in);
+		auto eliminated = static_cast<double>(predicate.tuples_in - predicate.tuples_out) / tuples_in;
+		auto cost = predicate.runtime / tuples_in;
+		ranks.push_back(eliminated > 0 ? cost / eliminated : NumericLimits<double>::Maximum());
 	}
-	right_random_border = 100 * (conj_expr.children.size() - 1);
+	std::stable_sort(permutation.begin(), permutation.end(),
+	                 [&](const idx_t &lhs, const idx_t &rhs) { return ranks[lhs] < ranks[rhs]; });
+}
+
+AdaptiveFilter::AdaptiveFilter(const Expression &expr, shared_ptr<AdaptiveFilterStatistics> statistics_p)
+    : statistics(std::move(statistics_p)) {
+	auto &conj_expr = expr.Cast<BoundConjunctionExpression>();
+	D_ASSERT(conj_expr.children.size() > 1);
+	Initialize(conj_expr.children.size());
+}
+
+AdaptiveFilter::AdaptiveFilter(const TableFilterSet &table_filters, shared_ptr<AdaptiveFilterStatistics> statistics_p)
+    : statistics(std::move(statistics_p)) {
+	Initialize(table_filters.filters.size());
 }
 
-AdaptiveFilter::AdaptiveFilter(const TableFilterSet &table_filters)
-    : observe_interval(10), execute_interval(20), warmup(true) {
-	for (idx_t idx = 0; idx < table_filters.filters.size(); idx++) {
+void AdaptiveFilter::Initialize(idx_t predicate_count) {
+	if (!statistics) {
+		statistics = make_shared_ptr<AdaptiveFilterStatistics>();
+	}
+	for (idx_t idx = 0; idx < predicate_count; idx++) {
 		permutation.push_back(idx);
-		swap_likeliness.push_back(100);
 	}
-	swap_likeliness.pop_back();
-	right_random_border = 100 * (table_filters.filters.size() - 1);
+	local_statistics.resize(predicate_count);
+	// start from what the other threads (or previous executions) have learned already
+	if (predicate_count > 1) {
+		statistics->GetPermutation(permutation);
+	}
 }
 
 AdaptiveFilterState AdaptiveFilter::BeginFilter() const {
@@ -37,72 +91,27 @@ AdaptiveFilterState AdaptiveFilter::BeginFilter() const {
 	return state;
 }
 
-void AdaptiveFilter::EndFilter(AdaptiveFilterState state) {
+void AdaptiveFilter::EndPredicate(AdaptiveFilterState &state, idx_t idx, idx_t tuples_in, idx_t tuples_out) {
 	if (permutation.size() <= 1) {
-		// nothing to permute
 		return;
 	}
 	auto end_time = high_resolution_clock::now();
-	AdaptRuntimeStatistics(duration_cast<duration<double>>(end_time - state.start_time).count());
+	auto &predicate = local_statistics[permutation[idx]];
+	predicate.tuples_in += tuples_in;
+	predicate.tuples_out += tuples_out;
+	predicate.runtime += duration_cast<duration<double>>(end_time - state.start_time).count();
+	state.start_time = end_time;
 }
 
-void AdaptiveFilter::AdaptRuntimeStatistics(double duration) {
+void AdaptiveFilter::EndFilter() {
+	if (permutation.size() <= 1) {
+		// nothing to permute
+		return;
+	}
+	// update early so that short queries benefit as well
 	iteration_count++;
-	runtime_sum += duration;
-
-	if (!warmup) {
-		// the last swap was observed
-		if (observe && iteration_count == observe_interval) {
-			// keep swap if runtime decreased, else reverse swap
-			if (prev_mean - (runtime_sum / static_cast<double>(iteration_count)) <= 0) {
-				// reverse swap because runtime didn't decrease
-				std::swap(permutation[swap_idx], permutation[swap_idx + 1]);
-
-				// decrease swap likeliness, but make sure there is always a small likeliness left
-				if (swap_likeliness[swap_idx] > 1) {
-					swap_likeliness[swap_idx] /= 2;
-				}
-			} else {
-				// keep swap because runtime decreased, reset likeliness
-				swap_likeliness[swap_idx] = 100;
-			}
-			observe = false;
-
-			// reset values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-		} else if (!observe && iteration_count == execute_interval) {
-			// save old mean to evaluate swap
-			prev_mean = runtime_sum / static_cast<double>(iteration_count);
-
-			// get swap index and swap likeliness
-			// a <= i <= b
-			auto random_number = generator.NextRandomInteger(1, NumericCast<uint32_t>(right_random_border));
-
-			swap_idx = random_number / 100;                    // index to be swapped
-			idx_t likeliness = random_number - 100 * swap_idx; // random number between [0, 100)
-
-			// check if swap is going to happen
-			if (swap_likeliness[swap_idx] > likeliness) { // always true for the first swap of an index
-				// swap
-				std::swap(permutation[swap_idx], permutation[swap_idx + 1]);
-
-				// observe whether swap will be applied
-				observe = true;
-			}
-
-			// reset values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-		}
-	} else {
-		if (iteration_count == 5) {
-			// initially set all values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-			observe = false;
-			warmup = false;
-		}
+	if (iteration_count == 1 || iteration_count % UPDATE_INTERVAL == 0) {
+		statistics->Update(local_statistics, permutation);
 	}
 }
 
@@ -1,7 +1,11 @@
 #include "duckdb/common/uhugeint.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression/bound_between_expression.hpp"
 #include "duckdb/planner/expression/bound_case_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
 
 namespace duckdb {
 
@@ -10,10 +14,122 @@ struct CaseExpressionState : public ExpressionState {
 	    : ExpressionState(expr, root), true_sel(STANDARD_VECTOR_SIZE), false_sel(STANDARD_VECTOR_SIZE) {
 	}
 
+	//! Branchless evaluation is only considered for CASE expressions with at most this many WHEN clauses
+	static constexpr const idx_t BRANCHLESS_MAX_CHECKS = 8;
+	//! The evaluation strategy is reconsidered every this many chunks
+	static constexpr const idx_t ADAPT_INTERVAL = 16;
+
 	SelectionVector true_sel;
 	SelectionVector false_sel;
+
+	//! Whether all branches are cheap and safe to evaluate on every row, and the result has a fixed width
+	bool branchless_eligible = false;
+	//! Whether the branches are currently evaluated branchless (instead of through selection vectors)
+	bool branchless = false;
+	//! The amount of chunks observed since the strategy was last reconsidered
+	idx_t observed_chunks = 0;
+	//! The amount of these chunks in which the rows were spread over more than one branch
+	idx_t mixed_chunks = 0;
+	//! For every row, the index of the branch it takes (the ELSE branch has the index of the last check + 1)
+	uint8_t branches[STANDARD_VECTOR_SIZE];
+
+public:
+	void Observe(bool mixed) {
+		observed_chunks++;
+		mixed_chunks += mixed;
+		if (observed_chunks < ADAPT_INTERVAL) {
+			return;
+		}
+		// selection vectors are efficient if (nearly) all rows of a chunk take the same branch,
+		// blending all branches wins if the rows of most chunks are mixed
+		branchless = mixed_chunks * 2 > observed_chunks;
+		observed_chunks = 0;
+		mixed_chunks = 0;
+	}
 };
 
+//! Whether the expression is cheap to evaluate and cannot throw, so it can be evaluated on rows that do not reach it
+static bool IsBranchlessSafe(const Expression &expr) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_REF:
+	case ExpressionClass::BOUND_CONSTANT:
+		return true;
+	case ExpressionClass::BOUND_COMPARISON: {
+		auto &comparison = expr.Cast<BoundComparisonExpression>();
+		return IsBranchlessSafe(*comparison.left) && IsBranchlessSafe(*comparison.right);
+	}
+	case ExpressionClass::BOUND_BETWEEN: {
+		auto &between = expr.Cast<BoundBetweenExpression>();
+		return IsBranchlessSafe(*between.input) && IsBranchlessSafe(*between.lower) &&
+		       IsBranchlessSafe(*between.upper);
+	}
+	case ExpressionClass::BOUND_CONJUNCTION: {
+		auto &conjunction = expr.Cast<BoundConjunctionExpression>();
+		for (auto &child : conjunction.children) {
+			if (!IsBranchlessSafe(*child)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case ExpressionClass::BOUND_OPERATOR: {
+		switch (expr.GetExpressionType()) {
+		case ExpressionType::OPERATOR_NOT:
+		case ExpressionType::OPERATOR_IS_NULL:
+		case ExpressionType::OPERATOR_IS_NOT_NULL:
+			break;
+		default:
+			return false;
+		}
+		auto &op = expr.Cast<BoundOperatorExpression>();
+		for (auto &child : op.children) {
+			if (!IsBranchlessSafe(*child)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+static bool IsBranchlessType(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::INTERVAL:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool IsBranchlessEligible(const BoundCaseExpression &expr) {
+	if (expr.case_checks.size() > CaseExpressionState::BRANCHLESS_MAX_CHECKS || !IsBranchlessType(expr.return_type)) {
+		return false;
+	}
+	for (auto &case_check : expr.case_checks) {
+		// the THEN expressions must be the same type as the result, since they are blended as-is
+		if (case_check.then_expr->return_type != expr.return_type || !IsBranchlessSafe(*case_check.when_expr) ||
+		    !IsBranchlessSafe(*case_check.then_expr)) {
+			return false;
+		}
+	}
+	return expr.else_expr->return_type == expr.return_type && IsBranchlessSafe(*expr.else_expr);
+}
+
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundCaseExpression &expr,
                                                                 ExpressionExecutorState &root) {
 	auto result = make_uniq<CaseExpressionState>(expr, root);
@@ -23,14 +139,144 @@ unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundCaseE
 	}
 	result->AddChild(expr.else_expr.get());
 	result->Finalize();
+	result->branchless_eligible = IsBranchlessEligible(expr);
 	return std::move(result);
 }
 
+template <class T>
+static void TemplatedBranchlessBlend(DataChunk &intermediate, idx_t check_count, const uint8_t *branches, idx_t count,
+                                     Vector &result) {
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto res = FlatVector::GetData<T>(result);
+	bool row_valid[STANDARD_VECTOR_SIZE];
+	bool all_valid = true;
+	// start with the ELSE branch, then overwrite the rows of every THEN branch
+	for (idx_t branch_idx = 0; branch_idx <= check_count; branch_idx++) {
+		auto branch = NumericCast<uint8_t>(check_count - branch_idx);
+		auto &values = intermediate.data[branch == check_count ? check_count * 2 : branch * 2 + 1];
+		UnifiedVectorFormat vdata;
+		values.ToUnifiedFormat(count, vdata);
+		auto data = UnifiedVectorFormat::GetData<T>(vdata);
+		all_valid = all_valid && vdata.validity.AllValid();
+		if (branch == check_count) {
+			for (idx_t i = 0; i < count; i++) {
+				auto source_idx = vdata.sel->get_index(i);
+				res[i] = data[source_idx];
+				row_valid[i] = vdata.validity.RowIsValid(source_idx);
+			}
+			continue;
+		}
+		for (idx_t i = 0; i < count; i++) {
+			auto source_idx = vdata.sel->get_index(i);
+			auto take = branches[i] == branch;
+			res[i] = take ? data[source_idx] : res[i];
+			row_valid[i] = take ? vdata.validity.RowIsValid(source_idx) : row_valid[i];
+		}
+	}
+	auto &result_mask = FlatVector::Validity(result);
+	if (all_valid) {
+		result_mask.Reset();
+		return;
+	}
+	for (idx_t i = 0; i < count; i++) {
+		result_mask.Set(i, row_valid[i]);
+	}
+}
+
+bool ExpressionExecutor::ExecuteBranchless(const BoundCaseExpression &expr, ExpressionState *state_p,
+                                           const SelectionVector *sel, idx_t count, Vector &result) {
+	auto &state = state_p->Cast<CaseExpressionState>();
+	auto &intermediate = state.intermediate_chunk;
+	auto check_count = expr.case_checks.size();
+	auto branches = state.branches;
+
+	// find the branch of every row: evaluate the checks back to front so that the first matching check wins
+	for (idx_t i = 0; i < count; i++) {
+		branches[i] = NumericCast<uint8_t>(check_count);
+	}
+	for (idx_t check_idx = check_count; check_idx > 0; check_idx--) {
+		auto branch = NumericCast<uint8_t>(check_idx - 1);
+		auto &check_result = intermediate.data[branch * 2];
+		Execute(*expr.case_checks[branch].when_expr, state.child_states[branch * 2].get(), sel, count, check_result);
+		UnifiedVectorFormat cdata;
+		check_result.ToUnifiedFormat(count, cdata);
+		auto checks = UnifiedVectorFormat::GetData<bool>(cdata);
+		for (idx_t i = 0; i < count; i++) {
+			auto source_idx = cdata.sel->get_index(i);
+			auto take = checks[source_idx] && cdata.validity.RowIsValid(source_idx);
+			branches[i] = take ? branch : branches[i];
+		}
+	}
+	bool mixed = false;
+	for (idx_t i = 1; i < count; i++) {
+		mixed = mixed || branches[i] != branches[0];
+	}
+
+	// evaluate all branches on all rows
+	for (idx_t check_idx = 0; check_idx < check_count; check_idx++) {
+		Execute(*expr.case_checks[check_idx].then_expr, state.child_states[check_idx * 2 + 1].get(), sel, count,
+		        intermediate.data[check_idx * 2 + 1]);
+	}
+	Execute(*expr.else_expr, state.child_states.back().get(), sel, count, intermediate.data[check_count * 2]);
+
+	switch (result.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		TemplatedBranchlessBlend<int8_t>(intermediate, check_count, branches, count, result);
+		break;
+	case PhysicalType::INT16:
+		TemplatedBranchlessBlend<int16_t>(intermediate, check_count, branches, count, result);
+		break;
+	case PhysicalType::INT32:
+		TemplatedBranchlessBlend<int32_t>(intermediate, check_count, branches, count, result);
+		break;
+	case PhysicalType::INT64:
+		TemplatedBranchlessBlend<int64_t>(intermediate, check_count, branches, count, result);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedBranchlessBlend<uint8_t>(intermediate, check_count, branches, count, result);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedBranchlessBlend<uint16_t>(intermediate, check_count, branches, count, result);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedBranchlessBlend<uint32_t>(intermediate, check_count, branches, count, result);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedBranchlessBlend<uint64_t>(intermediate, check_count, branches, count, result);
+		break;
+	case PhysicalType::INT128:
+		TemplatedBranchlessBlend<hugeint_t>(intermediate, check_count, branches, count, result);
+		break;
+	case PhysicalType::UINT128:
+		TemplatedBranchlessBlend<uhugeint_t>(intermediate, check_count, branches, count, result);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedBranchlessBlend<float>(intermediate, check_count, branches, count, result);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedBranchlessBlend<double>(intermediate, check_count, branches, count, result);
+		break;
+	case PhysicalType::INTERVAL:
+		TemplatedBranchlessBlend<interval_t>(intermediate, check_count, branches, count, result);
+		break;
+	default:
+		throw InternalException("Unsupported type for branchless case expression: %s", result.GetType().ToString());
+	}
+	return mixed;
+}
+
 void ExpressionExecutor::Execute(const BoundCaseExpression &expr, ExpressionState *state_p, const SelectionVector *sel,
                                  idx_t count, Vector &result) {
 	auto &state = state_p->Cast<CaseExpressionState>();
 
 	state.intermediate_chunk.Reset();
+	if (state.branchless) {
+		state.Observe(ExecuteBranchless(expr, state_p, sel, count, result));
+		return;
+	}
+	// the amount of branches the rows are spread over
+	idx_t filled_branches = 0;
 
 	// first execute the check expression
 	auto current_true_sel = &state.true_sel;
@@ -54,11 +300,15 @@ void ExpressionExecutor::Execute(const BoundCaseExpression &expr, ExpressionStat
 			// everything is true in the first CHECK statement
 			// we can skip the entire case and only execute the TRUE side
 			Execute(*case_check.then_expr, then_state, sel, count, result);
+			if (state.branchless_eligible) {
+				state.Observe(false);
+			}
 			return;
 		} else {
 			// we need to execute and then fill in the desired tuples in the result
 			Execute(*case_check.then_expr, then_state, current_true_sel, tcount, intermediate_result);
 			FillSwitch(intermediate_result, result, *current_true_sel, NumericCast<sel_t>(tcount));
+			filled_branches++;
 		}
 		// continue with the false tuples
 		current_sel = current_false_sel;
@@ -73,6 +323,9 @@ void ExpressionExecutor::Execute(const BoundCaseExpression &expr, ExpressionStat
 		if (current_count == count) {
 			// everything was false, we can just evaluate the else expression directly
 			Execute(*expr.else_expr, else_state, sel, count, result);
+			if (state.branchless_eligible) {
+				state.Observe(false);
+			}
 			return;
 		} else {
 			auto &intermediate_result = state.intermediate_chunk.data[expr.case_checks.size() * 2];
@@ -80,8 +333,12 @@ void ExpressionExecutor::Execute(const BoundCaseExpression &expr, ExpressionStat
 			D_ASSERT(current_sel);
 			Execute(*expr.else_expr, else_state, current_sel, current_count, intermediate_result);
 			FillSwitch(intermediate_result, result, *current_sel, NumericCast<sel_t>(current_count));
+			filled_branches++;
 		}
 	}
+	if (state.branchless_eligible) {
+		state.Observe(filled_branches > 1);
+	}
 	if (sel) {
 		result.Slice(*sel, count);
 	}
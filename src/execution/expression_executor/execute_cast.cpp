@@ -17,17 +17,8 @@ unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundCastE
 	return std::move(result);
 }
 
-void ExpressionExecutor::Execute(const BoundCastExpression &expr, ExpressionState *state, const SelectionVector *sel,
-                                 idx_t count, Vector &result) {
-	auto lstate = ExecuteFunctionState::GetFunctionState(*state);
-
-	// resolve the child
-	state->intermediate_chunk.Reset();
-
-	auto &child = state->intermediate_chunk.data[0];
-	auto child_state = state->child_states[0].get();
-
-	Execute(*expr.child, child_state, sel, count, child);
+static void ExecuteCast(const BoundCastExpression &expr, optional_ptr<FunctionLocalState> lstate, Vector &child,
+                        Vector &result, idx_t count) {
 	if (expr.try_cast) {
 		string error_message;
 		CastParameters parameters(expr.bound_cast.cast_data.get(), false, &error_message, lstate);
@@ -42,4 +33,32 @@ void ExpressionExecutor::Execute(const BoundCastExpression &expr, ExpressionStat
 	}
 }
 
+void ExpressionExecutor::Execute(const BoundCastExpression &expr, ExpressionState *state, const SelectionVector *sel,
+                                 idx_t count, Vector &result) {
+	auto lstate = ExecuteFunctionState::GetFunctionState(*state);
+
+	// resolve the child
+	state->intermediate_chunk.Reset();
+
+	auto &child = state->intermediate_chunk.data[0];
+	auto child_state = state->child_states[0].get();
+
+	Execute(*expr.child, child_state, sel, count, child);
+	if (child.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		// Cast every distinct dictionary entry only once, and select the results of the rows
+		auto &function_state = state->Cast<ExecuteFunctionState>();
+		state->intermediate_chunk.SetCardinality(count);
+		auto dictionary_sel = function_state.PrepareDictionaryArguments(state->intermediate_chunk);
+		if (dictionary_sel) {
+			auto &dictionary_child = function_state.dictionary_arguments.data[0];
+			const auto dictionary_count = function_state.dictionary_arguments.size();
+			Vector dictionary_result(expr.return_type, dictionary_count);
+			ExecuteCast(expr, lstate, dictionary_child, dictionary_result, dictionary_count);
+			result.Slice(dictionary_result, *dictionary_sel, count);
+			return;
+		}
+	}
+	ExecuteCast(expr, lstate, child, result, count);
+}
+
 } // namespace duckdb
@@ -9,7 +9,8 @@ namespace duckdb {
 
 struct ConjunctionState : public ExpressionState {
 	ConjunctionState(const Expression &expr, ExpressionExecutorState &root) : ExpressionState(expr, root) {
-		adaptive_filter = make_uniq<AdaptiveFilter>(expr);
+		auto &conj_expr = expr.Cast<BoundConjunctionExpression>();
+		adaptive_filter = make_uniq<AdaptiveFilter>(expr, conj_expr.statistics);
 	}
 	unique_ptr<AdaptiveFilter> adaptive_filter;
 };
@@ -76,6 +77,7 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 			idx_t tcount = Select(*expr.children[state.adaptive_filter->permutation[i]],
 			                      state.child_states[state.adaptive_filter->permutation[i]].get(), current_sel,
 			                      current_count, true_sel, temp_false.get());
+			state.adaptive_filter->EndPredicate(filter_state, i, current_count, tcount);
 			idx_t fcount = current_count - tcount;
 			if (fcount > 0 && false_sel) {
 				// move failing tuples into the false_sel
@@ -95,7 +97,7 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 			}
 		}
 		// adapt runtime statistics
-		state.adaptive_filter->EndFilter(filter_state);
+		state.adaptive_filter->EndFilter();
 		return current_count;
 	} else {
 		// get runtime statistics
@@ -117,6 +119,7 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 			idx_t tcount = Select(*expr.children[state.adaptive_filter->permutation[i]],
 			                      state.child_states[state.adaptive_filter->permutation[i]].get(), current_sel,
 			                      current_count, temp_true.get(), false_sel);
+			state.adaptive_filter->EndPredicate(filter_state, i, current_count, current_count - tcount);
 			if (tcount > 0) {
 				if (true_sel) {
 					// tuples passed, move them into the actual result vector
@@ -131,7 +134,7 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 		}
 
 		// adapt runtime statistics
-		state.adaptive_filter->EndFilter(filter_state);
+		state.adaptive_filter->EndFilter();
 		return result_count;
 	}
 }
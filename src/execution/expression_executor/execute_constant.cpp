@@ -4,17 +4,30 @@
 
 namespace duckdb {
 
+struct ConstantExpressionState : public ExpressionState {
+	ConstantExpressionState(const BoundConstantExpression &expr, ExpressionExecutorState &root)
+	    : ExpressionState(expr, root), constant(expr.value) {
+	}
+
+	//! The constant vector, which is referenced by the result of every chunk instead of being materialized again
+	Vector constant;
+};
+
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundConstantExpression &expr,
                                                                 ExpressionExecutorState &root) {
-	auto result = make_uniq<ExpressionState>(expr, root);
+	auto result = make_uniq<ConstantExpressionState>(expr, root);
 	result->Finalize();
-	return result;
+	return std::move(result);
 }
 
 void ExpressionExecutor::Execute(const BoundConstantExpression &expr, ExpressionState *state,
                                  const SelectionVector *sel, idx_t count, Vector &result) {
 	D_ASSERT(expr.value.type() == expr.return_type);
-	result.Reference(expr.value);
+	if (!state) {
+		result.Reference(expr.value);
+		return;
+	}
+	result.Reference(state->Cast<ConstantExpressionState>().constant);
 }
 
 } // namespace duckdb
@@ -10,6 +10,80 @@ ExecuteFunctionState::ExecuteFunctionState(const Expression &expr, ExpressionExe
 ExecuteFunctionState::~ExecuteFunctionState() {
 }
 
+unique_ptr<SelectionVector> ExecuteFunctionState::PrepareDictionaryArguments(DataChunk &arguments) {
+	const auto count = arguments.size();
+	if (count < DICTIONARY_MIN_REUSE) {
+		return nullptr;
+	}
+	optional_idx dictionary_idx;
+	for (idx_t col_idx = 0; col_idx < arguments.ColumnCount(); col_idx++) {
+		switch (arguments.data[col_idx].GetVectorType()) {
+		case VectorType::CONSTANT_VECTOR:
+			break;
+		case VectorType::DICTIONARY_VECTOR:
+			if (dictionary_idx.IsValid()) {
+				return nullptr;
+			}
+			dictionary_idx = col_idx;
+			break;
+		default:
+			return nullptr;
+		}
+	}
+	if (!dictionary_idx.IsValid()) {
+		return nullptr;
+	}
+	auto &dictionary = arguments.data[dictionary_idx.GetIndex()];
+	auto &sel = DictionaryVector::SelVector(dictionary);
+	for (idx_t i = 0; i < count; i++) {
+		if (sel.get_index(i) >= DICTIONARY_MAX_INDEX) {
+			return nullptr;
+		}
+	}
+
+	// Find the distinct entries of the dictionary, and the position of every row in them
+	if (dictionary_positions.empty()) {
+		dictionary_positions.resize(DICTIONARY_MAX_INDEX, sel_t(DConstants::INVALID_INDEX));
+		dictionary_entries.Initialize(STANDARD_VECTOR_SIZE);
+	}
+	auto result = make_uniq<SelectionVector>(count);
+	idx_t distinct_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto entry = sel.get_index(i);
+		auto &position = dictionary_positions[entry];
+		if (position == sel_t(DConstants::INVALID_INDEX)) {
+			position = UnsafeNumericCast<sel_t>(distinct_count);
+			dictionary_entries.set_index(distinct_count++, entry);
+			if (distinct_count * DICTIONARY_MIN_REUSE > count) {
+				// too many distinct entries, e.g., because the dictionary is a selection of a flat vector
+				break;
+			}
+		}
+		result->set_index(i, position);
+	}
+	for (idx_t i = 0; i < distinct_count; i++) {
+		dictionary_positions[dictionary_entries.get_index(i)] = sel_t(DConstants::INVALID_INDEX);
+	}
+	if (distinct_count * DICTIONARY_MIN_REUSE > count) {
+		return nullptr;
+	}
+
+	// The arguments over the distinct entries
+	if (dictionary_arguments.ColumnCount() == 0) {
+		dictionary_arguments.InitializeEmpty(arguments.GetTypes());
+	}
+	for (idx_t col_idx = 0; col_idx < arguments.ColumnCount(); col_idx++) {
+		if (col_idx == dictionary_idx.GetIndex()) {
+			dictionary_arguments.data[col_idx].Slice(DictionaryVector::Child(dictionary), dictionary_entries,
+			                                         distinct_count);
+		} else {
+			dictionary_arguments.data[col_idx].Reference(arguments.data[col_idx]);
+		}
+	}
+	dictionary_arguments.SetCardinality(distinct_count);
+	return result;
+}
+
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundFunctionExpression &expr,
                                                                 ExpressionExecutorState &root) {
 	auto result = make_uniq<ExecuteFunctionState>(expr, root);
@@ -75,6 +149,20 @@ void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, Expression
 	arguments.Verify();
 
 	D_ASSERT(expr.function.function);
+	if (expr.function.stability == FunctionStability::CONSISTENT) {
+		// Evaluate the function once per distinct dictionary entry, and select the results of the rows
+		auto &function_state = state->Cast<ExecuteFunctionState>();
+		auto dictionary_sel = function_state.PrepareDictionaryArguments(arguments);
+		if (dictionary_sel) {
+			auto &dictionary_arguments = function_state.dictionary_arguments;
+			Vector dictionary_result(expr.return_type, dictionary_arguments.size());
+			expr.function.function(dictionary_arguments, *state, dictionary_result);
+			result.Slice(dictionary_result, *dictionary_sel, count);
+			VerifyNullHandling(expr, arguments, result);
+			D_ASSERT(result.GetType() == expr.return_type);
+			return;
+		}
+	}
 	expr.function.function(arguments, *state, result);
 
 	VerifyNullHandling(expr, arguments, result);
@@ -16,7 +16,9 @@
 #include "duckdb/optimizer/matcher/expression_matcher.hpp"
 #include "duckdb/planner/expression/bound_between_expression.hpp"
 #include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/storage/arena_allocator.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -24,17 +26,29 @@
 
 namespace duckdb {
 
-struct ARTIndexScanState : public IndexScanState {
+//! A single lookup of an index scan.
+struct ARTScanPredicate {
 	//! The predicates to scan.
 	//! A single predicate for point lookups, and two predicates for range scans.
 	Value values[2];
 	//! The expressions over the scan predicates.
-	ExpressionType expressions[2];
+	ExpressionType expressions[2] = {ExpressionType::INVALID, ExpressionType::INVALID};
+	//! The values of a point lookup on the leading columns of a compound key.
+	//! If there are fewer values than key columns, then we scan all keys with that prefix.
+	vector<Value> compound_values;
+};
+
+struct ARTIndexScanState : public IndexScanState {
+	//! The lookups to scan. An index scan returns the union of their row IDs.
+	vector<ARTScanPredicate> predicates;
 	bool checked = false;
 	//! All scanned row IDs.
 	unsafe_vector<row_t> row_ids;
 };
 
+//! The maximum number of lookups of a scan on a compound key, i.e., the product of the sizes of its IN lists.
+static constexpr idx_t MAX_COMPOUND_LOOKUPS = 2048;
+
 //===--------------------------------------------------------------------===//
 // ART
 //===--------------------------------------------------------------------===//
@@ -112,27 +126,73 @@ ART::ART(const string &name, const IndexConstraintType index_constraint_type, co
 // Initialize Scans
 //===--------------------------------------------------------------------===//
 
-static unique_ptr<IndexScanState> InitializeScanSinglePredicate(const Value &value,
-                                                                const ExpressionType expression_type) {
-	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = value;
-	result->expressions[0] = expression_type;
-	return std::move(result);
+static ARTScanPredicate InitializeScanSinglePredicate(const Value &value, const ExpressionType expression_type) {
+	ARTScanPredicate result;
+	result.values[0] = value;
+	result.expressions[0] = expression_type;
+	return result;
 }
 
-static unique_ptr<IndexScanState> InitializeScanTwoPredicates(const Value &low_value,
-                                                              const ExpressionType low_expression_type,
-                                                              const Value &high_value,
-                                                              const ExpressionType high_expression_type) {
-	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = low_value;
-	result->expressions[0] = low_expression_type;
-	result->values[1] = high_value;
-	result->expressions[1] = high_expression_type;
-	return std::move(result);
+static ARTScanPredicate InitializeScanTwoPredicates(const Value &low_value, const ExpressionType low_expression_type,
+                                                    const Value &high_value,
+                                                    const ExpressionType high_expression_type) {
+	ARTScanPredicate result;
+	result.values[0] = low_value;
+	result.expressions[0] = low_expression_type;
+	result.values[1] = high_value;
+	result.expressions[1] = high_expression_type;
+	return result;
 }
 
-unique_ptr<IndexScanState> ART::TryInitializeScan(const Expression &expr, const Expression &filter_expr) {
+//! Tries to bind the filter to lookups on the index expression. Returns false, if the filter does not
+//! restrict the index expression. Otherwise, the union of the lookups contains all rows satisfying the filter.
+static bool TryBindScanPredicates(const Expression &expr, const Expression &filter_expr,
+                                  vector<ARTScanPredicate> &predicates) {
+	if (filter_expr.type == ExpressionType::COMPARE_IN) {
+		// We perform a point lookup for each constant in the IN list.
+		auto &in_expr = filter_expr.Cast<BoundOperatorExpression>();
+		if (!in_expr.children[0]->Equals(expr)) {
+			return false;
+		}
+		for (idx_t i = 1; i < in_expr.children.size(); i++) {
+			if (in_expr.children[i]->type != ExpressionType::VALUE_CONSTANT) {
+				return false;
+			}
+		}
+		for (idx_t i = 1; i < in_expr.children.size(); i++) {
+			auto &value = in_expr.children[i]->Cast<BoundConstantExpression>().value;
+			// NULL never compares equal.
+			if (!value.IsNull()) {
+				predicates.push_back(InitializeScanSinglePredicate(value, ExpressionType::COMPARE_EQUAL));
+			}
+		}
+		return true;
+	}
+
+	if (filter_expr.type == ExpressionType::CONJUNCTION_OR) {
+		// We need to bind every child of a disjunction.
+		auto &conjunction = filter_expr.Cast<BoundConjunctionExpression>();
+		for (auto &child : conjunction.children) {
+			if (!TryBindScanPredicates(expr, *child, predicates)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	if (filter_expr.type == ExpressionType::CONJUNCTION_AND) {
+		// The rows satisfying any child of a conjunction contain all rows satisfying the conjunction.
+		auto &conjunction = filter_expr.Cast<BoundConjunctionExpression>();
+		auto predicate_count = predicates.size();
+		for (auto &child : conjunction.children) {
+			if (TryBindScanPredicates(expr, *child, predicates)) {
+				return true;
+			}
+			predicates.resize(predicate_count);
+		}
+		return false;
+	}
+
 	Value low_value, high_value, equal_value;
 	ExpressionType low_comparison_type = ExpressionType::INVALID, high_comparison_type = ExpressionType::INVALID;
 
@@ -180,13 +240,13 @@ unique_ptr<IndexScanState> ART::TryInitializeScan(const Expression &expr, const
 		auto &between = filter_expr.Cast<BoundBetweenExpression>();
 		if (!between.input->Equals(expr)) {
 			// The expression does not match the index expression.
-			return nullptr;
+			return false;
 		}
 
 		if (between.lower->type != ExpressionType::VALUE_CONSTANT ||
 		    between.upper->type != ExpressionType::VALUE_CONSTANT) {
 			// Not a constant expression.
-			return nullptr;
+			return false;
 		}
 
 		low_value = between.lower->Cast<BoundConstantExpression>().value;
@@ -199,24 +259,106 @@ unique_ptr<IndexScanState> ART::TryInitializeScan(const Expression &expr, const
 
 	// We cannot use an index scan.
 	if (equal_value.IsNull() && low_value.IsNull() && high_value.IsNull()) {
-		return nullptr;
+		return false;
 	}
 
-	// Initialize the index scan state and return it.
+	// Initialize the index scan predicate.
 	if (!equal_value.IsNull()) {
 		// Equality predicate.
-		return InitializeScanSinglePredicate(equal_value, ExpressionType::COMPARE_EQUAL);
-	}
-	if (!low_value.IsNull() && !high_value.IsNull()) {
+		predicates.push_back(InitializeScanSinglePredicate(equal_value, ExpressionType::COMPARE_EQUAL));
+	} else if (!low_value.IsNull() && !high_value.IsNull()) {
 		// Two-sided predicate.
-		return InitializeScanTwoPredicates(low_value, low_comparison_type, high_value, high_comparison_type);
-	}
-	if (!low_value.IsNull()) {
+		predicates.push_back(
+		    InitializeScanTwoPredicates(low_value, low_comparison_type, high_value, high_comparison_type));
+	} else if (!low_value.IsNull()) {
 		// Less-than predicate.
-		return InitializeScanSinglePredicate(low_value, low_comparison_type);
+		predicates.push_back(InitializeScanSinglePredicate(low_value, low_comparison_type));
+	} else {
+		// Greater-than predicate.
+		predicates.push_back(InitializeScanSinglePredicate(high_value, high_comparison_type));
+	}
+	return true;
+}
+
+unique_ptr<IndexScanState> ART::TryInitializeScan(const Expression &expr, const Expression &filter_expr) {
+	vector<ARTScanPredicate> predicates;
+	if (!TryBindScanPredicates(expr, filter_expr, predicates)) {
+		return nullptr;
+	}
+
+	// Initialize the index scan state and return it.
+	auto result = make_uniq<ARTIndexScanState>();
+	result->predicates = std::move(predicates);
+	return std::move(result);
+}
+
+unique_ptr<IndexScanState> ART::TryInitializeScan(const vector<unique_ptr<Expression>> &exprs,
+                                                  const vector<unique_ptr<Expression>> &filters,
+                                                  const idx_t min_prefix_count) {
+	D_ASSERT(exprs.size() <= types.size());
+
+	// Find the equality values of the leading key columns.
+	vector<vector<Value>> column_values;
+	idx_t lookup_count = 1;
+	for (auto &expr : exprs) {
+		bool found = false;
+		for (auto &filter : filters) {
+			vector<ARTScanPredicate> predicates;
+			if (!TryBindScanPredicates(*expr, *filter, predicates)) {
+				continue;
+			}
+
+			// Only point lookups narrow down the key prefix.
+			bool all_equal = true;
+			for (auto &predicate : predicates) {
+				if (predicate.expressions[0] != ExpressionType::COMPARE_EQUAL) {
+					all_equal = false;
+					break;
+				}
+			}
+			if (!all_equal || lookup_count * predicates.size() > MAX_COMPOUND_LOOKUPS) {
+				continue;
+			}
+
+			column_values.emplace_back();
+			for (auto &predicate : predicates) {
+				column_values.back().push_back(predicate.values[0]);
+			}
+			lookup_count *= predicates.size();
+			found = true;
+			break;
+		}
+		if (!found) {
+			break;
+		}
+	}
+
+	// Keys containing NULLs are not in the ART.
+	// Thus, prefix lookups miss rows with NULLs in the remaining key columns.
+	if (column_values.empty() || column_values.size() < min_prefix_count) {
+		return nullptr;
+	}
+
+	// We perform a lookup for each combination of the values.
+	vector<vector<Value>> prefixes(1);
+	for (auto &values : column_values) {
+		vector<vector<Value>> next_prefixes;
+		for (auto &prefix : prefixes) {
+			for (auto &value : values) {
+				next_prefixes.push_back(prefix);
+				next_prefixes.back().push_back(value);
+			}
+		}
+		prefixes = std::move(next_prefixes);
+	}
+
+	auto result = make_uniq<ARTIndexScanState>();
+	for (auto &prefix : prefixes) {
+		ARTScanPredicate predicate;
+		predicate.compound_values = std::move(prefix);
+		result->predicates.push_back(std::move(predicate));
 	}
-	// Greater-than predicate.
-	return InitializeScanSinglePredicate(high_value, high_comparison_type);
+	return std::move(result);
 }
 
 //===--------------------------------------------------------------------===//
@@ -680,6 +822,9 @@ void ART::Delete(IndexLock &state, DataChunk &input, Vector &row_ids) {
 	if (!tree.HasMetadata()) {
 		// No more allocations.
 		VerifyAllocationsInternal();
+	} else if (owns_data && NeedsCompaction()) {
+		// The deletes left the buffers sparsely filled: move the remaining nodes into fewer buffers.
+		Vacuum(state);
 	}
 
 #ifdef DEBUG
@@ -833,6 +978,97 @@ const unsafe_optional_ptr<const Node> ART::Lookup(const Node &node, const ARTKey
 	return nullptr;
 }
 
+void ART::LookupBatch(const unsafe_vector<ARTKey> &keys, unsafe_vector<unsafe_optional_ptr<const Node>> &leaves) {
+	leaves.clear();
+	leaves.resize(keys.size());
+	unsafe_vector<idx_t> order;
+	order.reserve(keys.size());
+	for (idx_t i = 0; i < keys.size(); i++) {
+		if (!keys[i].Empty()) {
+			order.push_back(i);
+		}
+	}
+	if (order.empty() || !tree.HasMetadata()) {
+		return;
+	}
+	// Sort the keys, so that keys with a common prefix are adjacent.
+	std::sort(order.begin(), order.end(), [&](const idx_t l, const idx_t r) { return keys[r] > keys[l]; });
+	LookupBatch(tree, keys, order, 0, order.size(), 0, leaves);
+}
+
+void ART::LookupBatch(const Node &node, const unsafe_vector<ARTKey> &keys, const unsafe_vector<idx_t> &order,
+                      idx_t begin, idx_t end, idx_t depth, unsafe_vector<unsafe_optional_ptr<const Node>> &leaves) {
+	// All keys in [begin, end) share the path up to the node.
+	reference<const Node> ref(node);
+	while (ref.get().HasMetadata()) {
+
+		// All keys reaching the leaf share it.
+		if (ref.get().IsAnyLeaf() || ref.get().GetGateStatus() == GateStatus::GATE_SET) {
+			for (idx_t i = begin; i < end; i++) {
+				leaves[order[i]] = unsafe_optional_ptr<const Node>(ref.get());
+			}
+			return;
+		}
+
+		// Traverse the prefix.
+		// The keys are sorted, so the keys matching the prefix form a contiguous range.
+		if (ref.get().GetType() == NType::PREFIX) {
+			Prefix prefix(*this, ref.get());
+			auto count = prefix.data[Prefix::Count(*this)];
+			auto matches = [&](const idx_t i) {
+				auto &key = keys[order[i]];
+				for (idx_t pos = 0; pos < count; pos++) {
+					if (prefix.data[pos] != key[depth + pos]) {
+						return false;
+					}
+				}
+				return true;
+			};
+			while (begin < end && !matches(begin)) {
+				begin++;
+			}
+			idx_t match_end = begin;
+			while (match_end < end && matches(match_end)) {
+				match_end++;
+			}
+			if (begin == match_end) {
+				// Prefix mismatch for all keys.
+				return;
+			}
+			end = match_end;
+			depth += count;
+			ref = *prefix.ptr;
+			continue;
+		}
+
+		// Group the keys by their byte at the current depth, and descend into each child once.
+		D_ASSERT(depth < keys[order[begin]].len);
+		idx_t group_begin = begin;
+		while (group_begin < end) {
+			auto byte = keys[order[group_begin]][depth];
+			idx_t group_end = group_begin + 1;
+			while (group_end < end && keys[order[group_end]][depth] == byte) {
+				group_end++;
+			}
+			auto child = ref.get().GetChild(*this, byte);
+			if (child) {
+				if (group_begin == begin && group_end == end) {
+					// All keys continue in the same child.
+					ref = *child;
+					depth++;
+					break;
+				}
+				LookupBatch(*child, keys, order, group_begin, group_end, depth + 1, leaves);
+			}
+			group_begin = group_end;
+		}
+		if (group_begin == end) {
+			// All groups were handled, or none of the keys has a matching child.
+			return;
+		}
+	}
+}
+
 bool ART::SearchEqual(ARTKey &key, idx_t max_count, unsafe_vector<row_t> &row_ids) {
 	auto leaf = Lookup(tree, key, 0);
 	if (!leaf) {
@@ -895,16 +1131,53 @@ bool ART::SearchCloseRange(ARTKey &lower_bound, ARTKey &upper_bound, bool left_e
 	return it.Scan(upper_bound, max_count, row_ids, right_equal);
 }
 
-bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t> &row_ids) {
-	auto &scan_state = state.Cast<ARTIndexScanState>();
-	D_ASSERT(scan_state.values[0].type().InternalType() == types[0]);
-	ArenaAllocator arena_allocator(Allocator::Get(db));
-	auto key = ARTKey::CreateKey(arena_allocator, types[0], scan_state.values[0]);
+bool ART::SearchPrefix(ArenaAllocator &allocator, ARTKey &prefix, idx_t max_count, unsafe_vector<row_t> &row_ids) {
+	// Find the first key starting with the prefix.
+	Iterator it(*this);
 
-	if (scan_state.values[1].IsNull()) {
+	// Early-out, if the maximum value in the ART is lower than the prefix.
+	if (!it.LowerBound(tree, prefix, true, 0)) {
+		return true;
+	}
+
+	// All keys starting with the prefix are lower than the prefix with its last byte incremented.
+	auto len = prefix.len;
+	while (len > 0 && prefix.data[len - 1] == NumericLimits<uint8_t>::Maximum()) {
+		len--;
+	}
+	if (len == 0) {
+		return it.Scan(ARTKey(), max_count, row_ids, false);
+	}
+
+	auto upper_bound_data = allocator.Allocate(len);
+	memcpy(upper_bound_data, prefix.data, len);
+	upper_bound_data[len - 1]++;
+	ARTKey upper_bound(upper_bound_data, len);
+	return it.Scan(upper_bound, max_count, row_ids, false);
+}
+
+bool ART::Scan(ArenaAllocator &allocator, ARTScanPredicate &predicate, const idx_t max_count,
+               unsafe_vector<row_t> &row_ids) {
+	if (!predicate.compound_values.empty()) {
+		// Lookup on a compound key.
+		D_ASSERT(predicate.compound_values.size() <= types.size());
+		auto key = ARTKey::CreateKey(allocator, types[0], predicate.compound_values[0]);
+		for (idx_t i = 1; i < predicate.compound_values.size(); i++) {
+			auto other_key = ARTKey::CreateKey(allocator, types[i], predicate.compound_values[i]);
+			key.Concat(allocator, other_key);
+		}
+		if (predicate.compound_values.size() == types.size()) {
+			return SearchEqual(key, max_count, row_ids);
+		}
+		return SearchPrefix(allocator, key, max_count, row_ids);
+	}
+
+	D_ASSERT(predicate.values[0].type().InternalType() == types[0]);
+	auto key = ARTKey::CreateKey(allocator, types[0], predicate.values[0]);
+
+	if (predicate.values[1].IsNull()) {
 		// Single predicate.
-		lock_guard<mutex> l(lock);
-		switch (scan_state.expressions[0]) {
+		switch (predicate.expressions[0]) {
 		case ExpressionType::COMPARE_EQUAL:
 			return SearchEqual(key, max_count, row_ids);
 		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
@@ -921,14 +1194,59 @@ bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t
 	}
 
 	// Two predicates.
-	lock_guard<mutex> l(lock);
-	D_ASSERT(scan_state.values[1].type().InternalType() == types[0]);
-	auto upper_bound = ARTKey::CreateKey(arena_allocator, types[0], scan_state.values[1]);
-	bool left_equal = scan_state.expressions[0] == ExpressionType ::COMPARE_GREATERTHANOREQUALTO;
-	bool right_equal = scan_state.expressions[1] == ExpressionType ::COMPARE_LESSTHANOREQUALTO;
+	D_ASSERT(predicate.values[1].type().InternalType() == types[0]);
+	auto upper_bound = ARTKey::CreateKey(allocator, types[0], predicate.values[1]);
+	bool left_equal = predicate.expressions[0] == ExpressionType ::COMPARE_GREATERTHANOREQUALTO;
+	bool right_equal = predicate.expressions[1] == ExpressionType ::COMPARE_LESSTHANOREQUALTO;
 	return SearchCloseRange(key, upper_bound, left_equal, right_equal, max_count, row_ids);
 }
 
+bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t> &row_ids) {
+	auto &scan_state = state.Cast<ARTIndexScanState>();
+	ArenaAllocator arena_allocator(Allocator::Get(db));
+
+	lock_guard<mutex> l(lock);
+	auto success = true;
+	for (auto &predicate : scan_state.predicates) {
+		if (!Scan(arena_allocator, predicate, max_count, row_ids)) {
+			success = false;
+			break;
+		}
+	}
+	UnloadColdBuffers();
+	if (!success) {
+		return false;
+	}
+
+	if (scan_state.predicates.size() > 1) {
+		// Overlapping lookups return the same row IDs. Sorting them also lets the fetches visit each row group once.
+		std::sort(row_ids.begin(), row_ids.end());
+		row_ids.erase(std::unique(row_ids.begin(), row_ids.end()), row_ids.end());
+	}
+	return true;
+}
+
+void ART::LookupRowIds(DataChunk &input, vector<unsafe_vector<row_t>> &row_ids) {
+	D_ASSERT(row_ids.size() >= input.size());
+	ArenaAllocator arena_allocator(BufferAllocator::Get(db));
+	unsafe_vector<ARTKey> keys(input.size());
+	GenerateKeys<>(arena_allocator, input, keys);
+
+	lock_guard<mutex> l(lock);
+	unsafe_vector<unsafe_optional_ptr<const Node>> leaves;
+	LookupBatch(keys, leaves);
+
+	for (idx_t i = 0; i < input.size(); i++) {
+		if (!leaves[i]) {
+			continue;
+		}
+		Iterator it(*this);
+		it.FindMinimum(*leaves[i]);
+		it.Scan(ARTKey(), NumericLimits<idx_t>::Maximum(), row_ids[i], false);
+	}
+	UnloadColdBuffers();
+}
+
 //===--------------------------------------------------------------------===//
 // More Constraint Checking
 //===--------------------------------------------------------------------===//
@@ -987,6 +1305,10 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 	unsafe_vector<ARTKey> keys(expr_chunk.size());
 	GenerateKeys<>(arena_allocator, expr_chunk, keys);
 
+	// Probe the index for all keys at once.
+	unsafe_vector<unsafe_optional_ptr<const Node>> leaves;
+	LookupBatch(keys, leaves);
+
 	auto found_conflict = DConstants::INVALID_INDEX;
 	for (idx_t i = 0; found_conflict == DConstants::INVALID_INDEX && i < input.size(); i++) {
 		if (keys[i].Empty()) {
@@ -996,7 +1318,7 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 			continue;
 		}
 
-		auto leaf = Lookup(tree, keys[i], 0);
+		auto leaf = leaves[i];
 		if (!leaf) {
 			if (conflict_manager.AddMiss(i)) {
 				found_conflict = i;
@@ -1012,6 +1334,8 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 		}
 	}
 
+	UnloadColdBuffers();
+
 	conflict_manager.FinishLookup();
 	if (found_conflict == DConstants::INVALID_INDEX) {
 		return;
@@ -1175,6 +1499,29 @@ idx_t ART::GetInMemorySize(IndexLock &index_lock) {
 	return in_memory_size;
 }
 
+double ART::GetFragmentation() {
+	lock_guard<mutex> l(lock);
+
+	idx_t free_size = 0;
+	idx_t capacity = 0;
+	for (auto &allocator : *allocators) {
+		auto segment_capacity = allocator->GetSegmentCapacity();
+		free_size += (segment_capacity - allocator->GetSegmentCount()) * allocator->GetSegmentSize();
+		capacity += segment_capacity * allocator->GetSegmentSize();
+	}
+	return capacity == 0 ? 0 : double(free_size) / double(capacity);
+}
+
+void ART::UnloadColdBuffers() {
+	// ARTs that share their allocators with another ART are protected by the lock of that ART.
+	if (!owns_data || !(*allocators)[0]->UnderMemoryPressure()) {
+		return;
+	}
+	for (auto &allocator : *allocators) {
+		allocator->UnloadColdBuffers();
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Vacuum
 //===--------------------------------------------------------------------===//
@@ -1193,6 +1540,15 @@ void ART::FinalizeVacuum(const unordered_set<uint8_t> &indexes) {
 	}
 }
 
+bool ART::NeedsCompaction() const {
+	for (auto &allocator : *allocators) {
+		if (allocator->NeedsCompaction()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 void ART::Vacuum(IndexLock &state) {
 	D_ASSERT(owns_data);
 
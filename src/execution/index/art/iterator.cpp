@@ -159,6 +159,12 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 		return true;
 	}
 
+	// All keys in this subtree start with the key, e.g., when looking up a prefix of a compound key.
+	if (depth == key.len) {
+		FindMinimum(node);
+		return true;
+	}
+
 	D_ASSERT(node.GetGateStatus() == GateStatus::GATE_NOT_SET);
 	if (node.GetType() != NType::PREFIX) {
 		auto next_byte = key[depth];
@@ -191,6 +197,12 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 
 	// We compare the prefix bytes with the key bytes.
 	for (idx_t i = 0; i < prefix.data[Prefix::Count(art)]; i++) {
+		// The key ends within the prefix, i.e., all keys in the subsequent node start with the key.
+		if (depth + i == key.len) {
+			FindMinimum(*prefix.ptr);
+			return true;
+		}
+
 		// We found a prefix byte that is less than its corresponding key byte.
 		// I.e., the subsequent node is lesser than the key. Thus, the next node
 		// is the lower bound.
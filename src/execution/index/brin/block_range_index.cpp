@@ -0,0 +1,500 @@
+#include "duckdb/execution/index/brin/block_range_index.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/hugeint.hpp"
+#include "duckdb/common/types/uhugeint.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+namespace duckdb {
+
+constexpr const char *BlockRangeIndex::TYPE_NAME;
+constexpr const char *BlockRangeIndex::RANGE_SIZE_OPTION;
+constexpr const char *BlockRangeIndex::BLOCK_RANGES_OPTION;
+
+BlockRangeIndex::BlockRangeIndex(const string &name, const IndexConstraintType index_constraint_type,
+                                 const vector<column_t> &column_ids, TableIOManager &table_io_manager,
+                                 const vector<unique_ptr<Expression>> &unbound_expressions, AttachedDatabase &db,
+                                 const case_insensitive_map_t<Value> &options, const IndexStorageInfo &info)
+    : BoundIndex(name, BlockRangeIndex::TYPE_NAME, index_constraint_type, column_ids, table_io_manager,
+                 unbound_expressions, db),
+      range_size(DEFAULT_RANGE_SIZE), range_count(0) {
+
+	if (index_constraint_type != IndexConstraintType::NONE) {
+		throw BinderException("BRIN indexes do not support UNIQUE or PRIMARY KEY constraints.");
+	}
+	if (types.size() != 1) {
+		throw BinderException("BRIN indexes must have exactly one key.");
+	}
+	switch (types[0]) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		break;
+	default:
+		throw InvalidTypeException(logical_types[0], "Invalid type for BRIN index key.");
+	}
+	key_size = GetTypeIdSize(types[0]);
+
+	// The range size of a stored BRIN takes precedence over the options of the CREATE INDEX statement.
+	auto &range_size_options = info.IsValid() ? info.options : options;
+	auto range_size_entry = range_size_options.find(RANGE_SIZE_OPTION);
+	if (range_size_entry != range_size_options.end()) {
+		auto value = range_size_entry->second.DefaultCastAs(LogicalType::BIGINT).GetValue<int64_t>();
+		if (value <= 0) {
+			throw BinderException("The %s of a BRIN index must be greater than 0.", RANGE_SIZE_OPTION);
+		}
+		range_size = NumericCast<idx_t>(value);
+	}
+
+	if (!info.IsValid()) {
+		// We create a new BRIN.
+		return;
+	}
+	auto block_ranges_entry = info.options.find(BLOCK_RANGES_OPTION);
+	if (block_ranges_entry != info.options.end()) {
+		Deserialize(block_ranges_entry->second);
+	}
+}
+
+void BlockRangeIndex::Resize(const idx_t new_range_count) {
+	if (new_range_count <= range_count) {
+		return;
+	}
+	range_count = new_range_count;
+	has_keys.resize(range_count, 0);
+	min_keys.resize(range_count * key_size);
+	max_keys.resize(range_count * key_size);
+}
+
+//===--------------------------------------------------------------------===//
+// Insert and Delete
+//===--------------------------------------------------------------------===//
+
+template <class T>
+void BlockRangeIndex::InsertKeys(UnifiedVectorFormat &keys, UnifiedVectorFormat &row_ids, const idx_t count) {
+	auto key_data = UnifiedVectorFormat::GetData<T>(keys);
+	auto row_id_data = UnifiedVectorFormat::GetData<row_t>(row_ids);
+
+	for (idx_t i = 0; i < count; i++) {
+		auto key_idx = keys.sel->get_index(i);
+		if (!keys.validity.RowIsValid(key_idx)) {
+			continue;
+		}
+		auto row_id = row_id_data[row_ids.sel->get_index(i)];
+		// Transaction-local rows are not part of the table, and scans never skip them.
+		if (row_id < 0 || row_id >= MAX_ROW_ID) {
+			continue;
+		}
+
+		auto range_idx = NumericCast<idx_t>(row_id) / range_size;
+		Resize(range_idx + 1);
+		auto &min_key = reinterpret_cast<T *>(min_keys.data())[range_idx];
+		auto &max_key = reinterpret_cast<T *>(max_keys.data())[range_idx];
+		auto &key = key_data[key_idx];
+
+		if (!has_keys[range_idx]) {
+			has_keys[range_idx] = 1;
+			min_key = key;
+			max_key = key;
+			continue;
+		}
+		if (LessThan::Operation<T>(key, min_key)) {
+			min_key = key;
+		}
+		if (GreaterThan::Operation<T>(key, max_key)) {
+			max_key = key;
+		}
+	}
+}
+
+ErrorData BlockRangeIndex::Insert(IndexLock &lock, DataChunk &input, Vector &row_ids) {
+	D_ASSERT(row_ids.GetType().InternalType() == ROW_TYPE);
+	D_ASSERT(input.ColumnCount() == 1);
+	auto count = input.size();
+
+	UnifiedVectorFormat key_data;
+	UnifiedVectorFormat row_id_data;
+	input.data[0].ToUnifiedFormat(count, key_data);
+	row_ids.ToUnifiedFormat(count, row_id_data);
+
+	switch (types[0]) {
+	case PhysicalType::INT8:
+		InsertKeys<int8_t>(key_data, row_id_data, count);
+		break;
+	case PhysicalType::INT16:
+		InsertKeys<int16_t>(key_data, row_id_data, count);
+		break;
+	case PhysicalType::INT32:
+		InsertKeys<int32_t>(key_data, row_id_data, count);
+		break;
+	case PhysicalType::INT64:
+		InsertKeys<int64_t>(key_data, row_id_data, count);
+		break;
+	case PhysicalType::INT128:
+		InsertKeys<hugeint_t>(key_data, row_id_data, count);
+		break;
+	case PhysicalType::UINT8:
+		InsertKeys<uint8_t>(key_data, row_id_data, count);
+		break;
+	case PhysicalType::UINT16:
+		InsertKeys<uint16_t>(key_data, row_id_data, count);
+		break;
+	case PhysicalType::UINT32:
+		InsertKeys<uint32_t>(key_data, row_id_data, count);
+		break;
+	case PhysicalType::UINT64:
+		InsertKeys<uint64_t>(key_data, row_id_data, count);
+		break;
+	case PhysicalType::UINT128:
+		InsertKeys<uhugeint_t>(key_data, row_id_data, count);
+		break;
+	case PhysicalType::FLOAT:
+		InsertKeys<float>(key_data, row_id_data, count);
+		break;
+	case PhysicalType::DOUBLE:
+		InsertKeys<double>(key_data, row_id_data, count);
+		break;
+	default:
+		throw InternalException("Invalid type for BRIN index key.");
+	}
+	return ErrorData();
+}
+
+ErrorData BlockRangeIndex::Append(IndexLock &lock, DataChunk &input, Vector &row_ids) {
+	// Execute all column expressions before inserting the data chunk.
+	DataChunk expr_chunk;
+	expr_chunk.Initialize(Allocator::DefaultAllocator(), logical_types);
+	ExecuteExpressions(input, expr_chunk);
+	return Insert(lock, expr_chunk, row_ids);
+}
+
+void BlockRangeIndex::VerifyAppend(DataChunk &chunk) {
+}
+
+void BlockRangeIndex::VerifyAppend(DataChunk &chunk, ConflictManager &conflict_manager) {
+}
+
+void BlockRangeIndex::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) {
+}
+
+string BlockRangeIndex::GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
+                                                      DataChunk &input) {
+	throw InternalException("BRIN indexes do not enforce constraints.");
+}
+
+void BlockRangeIndex::Delete(IndexLock &lock, DataChunk &entries, Vector &row_ids) {
+}
+
+void BlockRangeIndex::CommitDrop(IndexLock &index_lock) {
+	range_count = 0;
+	has_keys.clear();
+	min_keys.clear();
+	max_keys.clear();
+}
+
+//===--------------------------------------------------------------------===//
+// Merging
+//===--------------------------------------------------------------------===//
+
+template <class T>
+void BlockRangeIndex::MergeRanges(BlockRangeIndex &other) {
+	Resize(other.range_count);
+	auto min_data = reinterpret_cast<T *>(min_keys.data());
+	auto max_data = reinterpret_cast<T *>(max_keys.data());
+	auto other_min_data = reinterpret_cast<T *>(other.min_keys.data());
+	auto other_max_data = reinterpret_cast<T *>(other.max_keys.data());
+
+	for (idx_t i = 0; i < other.range_count; i++) {
+		if (!other.has_keys[i]) {
+			continue;
+		}
+		if (!has_keys[i]) {
+			has_keys[i] = 1;
+			min_data[i] = other_min_data[i];
+			max_data[i] = other_max_data[i];
+			continue;
+		}
+		if (LessThan::Operation<T>(other_min_data[i], min_data[i])) {
+			min_data[i] = other_min_data[i];
+		}
+		if (GreaterThan::Operation<T>(other_max_data[i], max_data[i])) {
+			max_data[i] = other_max_data[i];
+		}
+	}
+}
+
+bool BlockRangeIndex::MergeIndexes(IndexLock &state, BoundIndex &other_index) {
+	auto &other = other_index.Cast<BlockRangeIndex>();
+	D_ASSERT(range_size == other.range_size && types[0] == other.types[0]);
+
+	switch (types[0]) {
+	case PhysicalType::INT8:
+		MergeRanges<int8_t>(other);
+		break;
+	case PhysicalType::INT16:
+		MergeRanges<int16_t>(other);
+		break;
+	case PhysicalType::INT32:
+		MergeRanges<int32_t>(other);
+		break;
+	case PhysicalType::INT64:
+		MergeRanges<int64_t>(other);
+		break;
+	case PhysicalType::INT128:
+		MergeRanges<hugeint_t>(other);
+		break;
+	case PhysicalType::UINT8:
+		MergeRanges<uint8_t>(other);
+		break;
+	case PhysicalType::UINT16:
+		MergeRanges<uint16_t>(other);
+		break;
+	case PhysicalType::UINT32:
+		MergeRanges<uint32_t>(other);
+		break;
+	case PhysicalType::UINT64:
+		MergeRanges<uint64_t>(other);
+		break;
+	case PhysicalType::UINT128:
+		MergeRanges<uhugeint_t>(other);
+		break;
+	case PhysicalType::FLOAT:
+		MergeRanges<float>(other);
+		break;
+	case PhysicalType::DOUBLE:
+		MergeRanges<double>(other);
+		break;
+	default:
+		throw InternalException("Invalid type for BRIN index key.");
+	}
+	return true;
+}
+
+void BlockRangeIndex::Vacuum(IndexLock &state) {
+}
+
+//===--------------------------------------------------------------------===//
+// Filtering
+//===--------------------------------------------------------------------===//
+
+template <class T>
+bool BlockRangeIndex::FilterRanges(TableFilter &filter, unsafe_vector<bool> &qualifying) {
+	auto min_data = reinterpret_cast<const T *>(min_keys.data());
+	auto max_data = reinterpret_cast<const T *>(max_keys.data());
+
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.constant.IsNull() || constant_filter.constant.type() != logical_types[0]) {
+			return false;
+		}
+		auto constant = constant_filter.constant.GetValueUnsafe<T>();
+		switch (constant_filter.comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+			for (idx_t i = 0; i < range_count; i++) {
+				qualifying[i] = qualifying[i] && has_keys[i] && !LessThan::Operation<T>(constant, min_data[i]) &&
+				                !GreaterThan::Operation<T>(constant, max_data[i]);
+			}
+			return true;
+		case ExpressionType::COMPARE_LESSTHAN:
+			for (idx_t i = 0; i < range_count; i++) {
+				qualifying[i] = qualifying[i] && has_keys[i] && LessThan::Operation<T>(min_data[i], constant);
+			}
+			return true;
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			for (idx_t i = 0; i < range_count; i++) {
+				qualifying[i] = qualifying[i] && has_keys[i] && !GreaterThan::Operation<T>(min_data[i], constant);
+			}
+			return true;
+		case ExpressionType::COMPARE_GREATERTHAN:
+			for (idx_t i = 0; i < range_count; i++) {
+				qualifying[i] = qualifying[i] && has_keys[i] && GreaterThan::Operation<T>(max_data[i], constant);
+			}
+			return true;
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			for (idx_t i = 0; i < range_count; i++) {
+				qualifying[i] = qualifying[i] && has_keys[i] && !LessThan::Operation<T>(max_data[i], constant);
+			}
+			return true;
+		default:
+			return false;
+		}
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		unsafe_vector<T> values;
+		for (auto &value : in_filter.values) {
+			if (value.type() != logical_types[0]) {
+				return false;
+			}
+			values.push_back(value.GetValueUnsafe<T>());
+		}
+		auto less_than = [](const T &l, const T &r) { return LessThan::Operation<T>(l, r); };
+		std::sort(values.begin(), values.end(), less_than);
+		for (idx_t i = 0; i < range_count; i++) {
+			if (!qualifying[i] || !has_keys[i]) {
+				qualifying[i] = false;
+				continue;
+			}
+			// The range qualifies, if the smallest value that is not less than its minimum is within the range.
+			auto entry = std::lower_bound(values.begin(), values.end(), min_data[i], less_than);
+			qualifying[i] = entry != values.end() && !GreaterThan::Operation<T>(*entry, max_data[i]);
+		}
+		return true;
+	}
+	case TableFilterType::IS_NOT_NULL:
+		for (idx_t i = 0; i < range_count; i++) {
+			qualifying[i] = qualifying[i] && has_keys[i];
+		}
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		// Children that cannot prune any range do not restrict the conjunction.
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		auto can_prune = false;
+		for (auto &child_filter : and_filter.child_filters) {
+			if (FilterRanges<T>(*child_filter, qualifying)) {
+				can_prune = true;
+			}
+		}
+		return can_prune;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		unsafe_vector<bool> any_qualifying(range_count, false);
+		for (auto &child_filter : or_filter.child_filters) {
+			auto child_qualifying = qualifying;
+			if (!FilterRanges<T>(*child_filter, child_qualifying)) {
+				return false;
+			}
+			for (idx_t i = 0; i < range_count; i++) {
+				any_qualifying[i] = any_qualifying[i] || child_qualifying[i];
+			}
+		}
+		qualifying = std::move(any_qualifying);
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+shared_ptr<ScanRowRanges> BlockRangeIndex::GetQualifyingRanges(TableFilter &filter) {
+	lock_guard<mutex> l(lock);
+	auto result = make_shared_ptr<ScanRowRanges>(range_size);
+	result->qualifying.resize(range_count, true);
+
+	bool can_prune;
+	switch (types[0]) {
+	case PhysicalType::INT8:
+		can_prune = FilterRanges<int8_t>(filter, result->qualifying);
+		break;
+	case PhysicalType::INT16:
+		can_prune = FilterRanges<int16_t>(filter, result->qualifying);
+		break;
+	case PhysicalType::INT32:
+		can_prune = FilterRanges<int32_t>(filter, result->qualifying);
+		break;
+	case PhysicalType::INT64:
+		can_prune = FilterRanges<int64_t>(filter, result->qualifying);
+		break;
+	case PhysicalType::INT128:
+		can_prune = FilterRanges<hugeint_t>(filter, result->qualifying);
+		break;
+	case PhysicalType::UINT8:
+		can_prune = FilterRanges<uint8_t>(filter, result->qualifying);
+		break;
+	case PhysicalType::UINT16:
+		can_prune = FilterRanges<uint16_t>(filter, result->qualifying);
+		break;
+	case PhysicalType::UINT32:
+		can_prune = FilterRanges<uint32_t>(filter, result->qualifying);
+		break;
+	case PhysicalType::UINT64:
+		can_prune = FilterRanges<uint64_t>(filter, result->qualifying);
+		break;
+	case PhysicalType::UINT128:
+		can_prune = FilterRanges<uhugeint_t>(filter, result->qualifying);
+		break;
+	case PhysicalType::FLOAT:
+		can_prune = FilterRanges<float>(filter, result->qualifying);
+		break;
+	case PhysicalType::DOUBLE:
+		can_prune = FilterRanges<double>(filter, result->qualifying);
+		break;
+	default:
+		throw InternalException("Invalid type for BRIN index key.");
+	}
+	if (!can_prune) {
+		return nullptr;
+	}
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Storage and Memory
+//===--------------------------------------------------------------------===//
+
+IndexStorageInfo BlockRangeIndex::GetStorageInfo(const case_insensitive_map_t<Value> &options, const bool to_wal) {
+	lock_guard<mutex> l(lock);
+	IndexStorageInfo info(name);
+	info.options = options;
+	info.options[RANGE_SIZE_OPTION] = Value::UBIGINT(range_size);
+
+	// The block ranges are small, so we store them inline: first the flags of all ranges, then their minimums,
+	// and then their maximums.
+	string block_ranges;
+	block_ranges.reserve(has_keys.size() + min_keys.size() + max_keys.size());
+	block_ranges.append(const_char_ptr_cast(has_keys.data()), has_keys.size());
+	block_ranges.append(const_char_ptr_cast(min_keys.data()), min_keys.size());
+	block_ranges.append(const_char_ptr_cast(max_keys.data()), max_keys.size());
+	info.options[BLOCK_RANGES_OPTION] = Value::BLOB_RAW(block_ranges);
+	return info;
+}
+
+void BlockRangeIndex::Deserialize(const Value &block_ranges) {
+	auto &data = StringValue::Get(block_ranges);
+	auto entry_size = 1 + 2 * key_size;
+	if (data.size() % entry_size != 0) {
+		throw IOException("Invalid block ranges of BRIN index \"%s\".", name);
+	}
+
+	Resize(data.size() / entry_size);
+	auto ptr = const_data_ptr_cast(data.c_str());
+	memcpy(has_keys.data(), ptr, has_keys.size());
+	ptr += has_keys.size();
+	memcpy(min_keys.data(), ptr, min_keys.size());
+	ptr += min_keys.size();
+	memcpy(max_keys.data(), ptr, max_keys.size());
+}
+
+idx_t BlockRangeIndex::GetInMemorySize(IndexLock &index_lock) {
+	return has_keys.size() + min_keys.size() + max_keys.size();
+}
+
+//===--------------------------------------------------------------------===//
+// Verification
+//===--------------------------------------------------------------------===//
+
+string BlockRangeIndex::VerifyAndToString(IndexLock &state, const bool only_verify) {
+	D_ASSERT(has_keys.size() == range_count);
+	D_ASSERT(min_keys.size() == range_count * key_size && max_keys.size() == range_count * key_size);
+	return StringUtil::Format("BRIN: %llu block ranges of %llu rows", range_count, range_size);
+}
+
+void BlockRangeIndex::VerifyAllocations(IndexLock &state) {
+}
+
+} // namespace duckdb
@@ -253,6 +253,51 @@ IndexPointer FixedSizeAllocator::VacuumPointer(const IndexPointer ptr) {
 	return new_ptr;
 }
 
+bool FixedSizeAllocator::NeedsCompaction() const {
+	idx_t available_segments_in_memory = 0;
+	idx_t segment_capacity_in_memory = 0;
+	for (auto &buffer : buffers) {
+		if (buffer.second.InMemory()) {
+			available_segments_in_memory += available_segments_per_buffer - buffer.second.segment_count;
+			segment_capacity_in_memory += available_segments_per_buffer;
+		}
+	}
+
+	// the vacuum releases the excess buffers, so we need at least one buffer worth of free segments
+	if (available_segments_in_memory < available_segments_per_buffer) {
+		return false;
+	}
+	auto threshold = double(COMPACTION_THRESHOLD) / 100.0;
+	return double(available_segments_in_memory) >= double(segment_capacity_in_memory) * threshold;
+}
+
+bool FixedSizeAllocator::UnderMemoryPressure() const {
+	auto max_memory = buffer_manager.GetMaxMemory();
+	auto threshold = double(UNLOAD_THRESHOLD) / 100.0;
+	return double(buffer_manager.GetUsedMemory()) >= double(max_memory) * threshold;
+}
+
+idx_t FixedSizeAllocator::UnloadColdBuffers() {
+
+	// buffers get a second chance: we unload a buffer only if it was not accessed since the previous call,
+	// so that the upper levels of the tree, which almost every operation accesses, stay in memory
+
+	idx_t unloaded_count = 0;
+	for (auto &buffer : buffers) {
+		if (!buffer.second.InMemory() || buffer.second.vacuum) {
+			continue;
+		}
+		if (buffer.second.referenced) {
+			buffer.second.referenced = false;
+			continue;
+		}
+		if (buffer.second.Unload()) {
+			unloaded_count++;
+		}
+	}
+	return unloaded_count;
+}
+
 FixedSizeAllocatorInfo FixedSizeAllocator::GetInfo() const {
 
 	FixedSizeAllocatorInfo info;
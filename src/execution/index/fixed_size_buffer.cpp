@@ -36,8 +36,8 @@ constexpr idx_t FixedSizeBuffer::BASE[];
 constexpr uint8_t FixedSizeBuffer::SHIFT[];
 
 FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager)
-    : block_manager(block_manager), segment_count(0), allocation_size(0), dirty(false), vacuum(false), block_pointer(),
-      block_handle(nullptr) {
+    : block_manager(block_manager), segment_count(0), allocation_size(0), dirty(false), vacuum(false),
+      referenced(false), block_pointer(), block_handle(nullptr) {
 
 	auto &buffer_manager = block_manager.buffer_manager;
 	buffer_handle = buffer_manager.Allocate(MemoryTag::ART_INDEX, block_manager.GetBlockSize(), false);
@@ -47,7 +47,7 @@ FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager)
 FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager, const idx_t segment_count, const idx_t allocation_size,
                                  const BlockPointer &block_pointer)
     : block_manager(block_manager), segment_count(segment_count), allocation_size(allocation_size), dirty(false),
-      vacuum(false), block_pointer(block_pointer) {
+      vacuum(false), referenced(false), block_pointer(block_pointer) {
 
 	D_ASSERT(block_pointer.IsValid());
 	block_handle = block_manager.RegisterBlock(block_pointer.block_id);
@@ -66,6 +66,19 @@ void FixedSizeBuffer::Destroy() {
 	}
 }
 
+bool FixedSizeBuffer::Unload() {
+	if (!InMemory() || !OnDisk() || dirty) {
+		return false;
+	}
+
+	// the in-memory buffer is a copy of the on-disk block, so we can release it,
+	// and the buffer manager can evict the on-disk block
+	buffer_handle.Destroy();
+	block_handle = block_manager.RegisterBlock(block_pointer.block_id);
+	D_ASSERT(block_handle->BlockId() < MAXIMUM_BLOCK);
+	return true;
+}
+
 void FixedSizeBuffer::Serialize(PartialBlockManager &partial_block_manager, const idx_t available_segments,
                                 const idx_t segment_size, const idx_t bitmask_offset) {
 
@@ -1,12 +1,23 @@
 #include "duckdb/execution/join_hashtable.hpp"
 
+#include "duckdb/common/bit_utils.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/ht_entry.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DUCKDB_SALT_SEARCH_AVX2
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define DUCKDB_SALT_SEARCH_NEON
+#include <arm_neon.h>
+#endif
+
 namespace duckdb {
 using ValidityBytes = JoinHashTable::ValidityBytes;
 using ScanStructure = JoinHashTable::ScanStructure;
@@ -29,10 +40,10 @@ JoinHashTable::InsertState::InsertState(const JoinHashTable &ht)
 	ht.data_collection->InitializeChunkState(chunk_state, ht.equality_predicate_columns);
 }
 
-JoinHashTable::JoinHashTable(ClientContext &context, const vector<JoinCondition> &conditions_p,
+JoinHashTable::JoinHashTable(ClientContext &context, const vector<JoinCondition> &conditions,
                              vector<LogicalType> btypes, JoinType type_p, const vector<idx_t> &output_columns_p)
-    : buffer_manager(BufferManager::GetBufferManager(context)), conditions(conditions_p),
-      build_types(std::move(btypes)), output_columns(output_columns_p), entry_size(0), tuple_size(0),
+    : buffer_manager(BufferManager::GetBufferManager(context)), build_types(std::move(btypes)),
+      output_columns(output_columns_p), entry_size(0), tuple_size(0),
       vfound(Value::BOOLEAN(false)), join_type(type_p), finalized(false), has_null(false),
       radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
 	for (idx_t i = 0; i < conditions.size(); ++i) {
@@ -151,6 +162,108 @@ static void ApplyBitmaskAndGetSaltBuild(Vector &hashes_v, const idx_t &count, co
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Salt Search
+//===--------------------------------------------------------------------===//
+//! Returns the offset of the first entry starting at ht_offset that is empty or has the salt, one entry at a time
+static inline idx_t FindSaltOrEmptyScalar(const ht_entry_t *entries, idx_t ht_offset, const idx_t bitmask,
+                                          const hash_t row_salt) {
+	while (true) {
+		auto &entry = entries[ht_offset];
+		if (!entry.IsOccupied() || entry.GetSalt() == row_salt) {
+			return ht_offset;
+		}
+		IncrementAndWrap(ht_offset, bitmask);
+	}
+}
+
+#if defined(DUCKDB_SALT_SEARCH_AVX2) || defined(DUCKDB_SALT_SEARCH_NEON)
+#ifdef DUCKDB_SALT_SEARCH_AVX2
+#define DUCKDB_SALT_SEARCH_TARGET __attribute__((target("avx2")))
+//! The amount of entries compared by a single SIMD comparison
+static constexpr idx_t SALT_SEARCH_WIDTH = 4;
+
+static bool HasSIMDSaltSearch() {
+	static const bool supported = []() {
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+	}();
+	return supported;
+}
+
+//! Returns a bitmask of the entries at the pointer that are empty or have the salt
+DUCKDB_SALT_SEARCH_TARGET static inline uint64_t MatchSaltOrEmpty(const ht_entry_t *entries, const __m256i &salts,
+                                                                  const __m256i &pointer_mask) {
+	auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(entries));
+	auto empty = _mm256_cmpeq_epi64(values, _mm256_setzero_si256());
+	auto salt_match = _mm256_cmpeq_epi64(_mm256_or_si256(values, pointer_mask), salts);
+	return static_cast<uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_or_si256(empty, salt_match))));
+}
+#else
+#define DUCKDB_SALT_SEARCH_TARGET
+static constexpr idx_t SALT_SEARCH_WIDTH = 2;
+
+static bool HasSIMDSaltSearch() {
+	return true;
+}
+#endif
+
+//! Same as FindSaltOrEmptyScalar, but compares SALT_SEARCH_WIDTH consecutive entries at a time
+DUCKDB_SALT_SEARCH_TARGET static idx_t FindSaltOrEmptySIMD(const ht_entry_t *entries, idx_t ht_offset,
+                                                           const idx_t bitmask, const hash_t row_salt) {
+#ifdef DUCKDB_SALT_SEARCH_AVX2
+	const auto salts = _mm256_set1_epi64x(static_cast<int64_t>(row_salt));
+	const auto pointer_mask = _mm256_set1_epi64x(static_cast<int64_t>(ht_entry_t::POINTER_MASK));
+#else
+	const auto salts = vdupq_n_u64(row_salt);
+	const auto pointer_mask = vdupq_n_u64(ht_entry_t::POINTER_MASK);
+#endif
+	while (true) {
+		if (ht_offset + SALT_SEARCH_WIDTH - 1 > bitmask) {
+			// the entries wrap around the end of the HT: compare a single entry
+			auto &entry = entries[ht_offset];
+			if (!entry.IsOccupied() || entry.GetSalt() == row_salt) {
+				return ht_offset;
+			}
+			IncrementAndWrap(ht_offset, bitmask);
+			continue;
+		}
+#ifdef DUCKDB_SALT_SEARCH_AVX2
+		auto matches = MatchSaltOrEmpty(entries + ht_offset, salts, pointer_mask);
+		if (matches != 0) {
+			return ht_offset + CountZeros<uint64_t>::Trailing(matches);
+		}
+#else
+		auto values = vld1q_u64(reinterpret_cast<const uint64_t *>(entries + ht_offset));
+		auto matches = vorrq_u64(vceqq_u64(values, vdupq_n_u64(0)), vceqq_u64(vorrq_u64(values, pointer_mask), salts));
+		if (vgetq_lane_u64(matches, 0) != 0) {
+			return ht_offset;
+		}
+		if (vgetq_lane_u64(matches, 1) != 0) {
+			return ht_offset + 1;
+		}
+#endif
+		ht_offset = (ht_offset + SALT_SEARCH_WIDTH) & bitmask;
+	}
+}
+#endif
+
+//! Returns the offset of the first entry starting at ht_offset that is empty or has the salt (linear probing)
+static inline idx_t FindSaltOrEmpty(const ht_entry_t *entries, const idx_t ht_offset, const idx_t bitmask,
+                                    const hash_t row_salt) {
+	// most probes end at the first entry, only search the remainder of longer chains with SIMD
+	auto &entry = entries[ht_offset];
+	if (!entry.IsOccupied() || entry.GetSalt() == row_salt) {
+		return ht_offset;
+	}
+#if defined(DUCKDB_SALT_SEARCH_AVX2) || defined(DUCKDB_SALT_SEARCH_NEON)
+	if (HasSIMDSaltSearch()) {
+		return FindSaltOrEmptySIMD(entries, (ht_offset + 1) & bitmask, bitmask, row_salt);
+	}
+#endif
+	return FindSaltOrEmptyScalar(entries, (ht_offset + 1) & bitmask, bitmask, row_salt);
+}
+
 //! Gets a pointer to the entry in the HT for each of the hashes_v using linear probing. Will update the key_match_sel
 //! vector and the count argument to the number and position of the matches
 template <bool USE_SALTS>
@@ -170,16 +283,18 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 	idx_t non_empty_count = 0;
 
 	// first, filter out the empty rows and calculate the offset
+	// we prefetch the entries for the entire chunk here, so the cache misses are resolved in parallel
 	for (idx_t i = 0; i < count; i++) {
 		const auto row_index = sel.get_index(i);
 		auto uvf_index = hashes_v_unified.sel->get_index(row_index);
 		auto ht_offset = hashes[uvf_index] & ht->bitmask;
 		ht_offsets_dense[i] = ht_offset;
 		ht_offsets[row_index] = ht_offset;
+		DUCKDB_PREFETCH(entries + ht_offset);
 	}
 
 	// have a dense loop to have as few instructions as possible while producing cache misses as this is the
-	// first location where we access the big entries array
+	// first location where we access the big entries array (if the prefetches have not arrived yet)
 	for (idx_t i = 0; i < count; i++) {
 		idx_t ht_offset = ht_offsets_dense[i];
 		auto &entry = entries[ht_offset];
@@ -226,21 +341,10 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 			ht_entry_t entry;
 
 			if (USE_SALTS) {
-				hash_t row_salt = salts[row_index];
-				// increment the ht_offset of the entry as long as next entry is occupied and salt does not match
-				while (true) {
-					entry = entries[ht_offset];
-					occupied = entry.IsOccupied();
-					bool salt_match = entry.GetSalt() == row_salt;
-
-					// condition for incrementing the ht_offset: occupied and row_salt does not match -> move to next
-					// entry
-					if (!occupied || salt_match) {
-						break;
-					}
-
-					IncrementAndWrap(ht_offset, ht->bitmask);
-				}
+				// move the ht_offset of the entry to the next entry that is empty or has a matching salt
+				ht_offset = FindSaltOrEmpty(entries, ht_offset, ht->bitmask, salts[row_index]);
+				entry = entries[ht_offset];
+				occupied = entry.IsOccupied();
 			} else {
 				entry = entries[ht_offset];
 				occupied = entry.IsOccupied();
@@ -254,6 +358,8 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 			// entry might be empty, so the pointer in the entry is nullptr, but this does not matter as the row
 			// will not be compared anyway as with an empty entry we are already done
 			row_ptr_insert_to[row_index] = entry.GetPointerOrNull();
+			// the keys are stored at the start of the row, prefetch them for the row comparison below
+			DUCKDB_PREFETCH(row_ptr_insert_to[row_index]);
 		}
 
 		if (salt_match_count != 0) {
@@ -571,7 +677,7 @@ static void InsertHashesLoop(atomic<ht_entry_t> entries[], Vector &row_locations
 	if (PropagatesBuildSide(ht.join_type)) {
 		// if we propagate the build side, we may have added rows with NULL keys to the HT
 		// these may need to be filtered out depending on the comparison type (exactly like PrepareKeys does)
-		for (idx_t col_idx = 0; col_idx < ht.conditions.size(); col_idx++) {
+		for (idx_t col_idx = 0; col_idx < ht.condition_types.size(); col_idx++) {
 			// if null values are NOT equal for this column we filter them out
 			if (ht.NullValuesAreEqual(col_idx)) {
 				continue;
@@ -724,6 +830,10 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 		for (idx_t i = 0; i < count; i++) {
 			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
 		}
+		if (bloom_filter) {
+			// the hashes get overwritten by pointers in InsertHashes, so we have to fill the Bloom filter first
+			bloom_filter->InsertHashes(hash_data, count);
+		}
 		TupleDataChunkState &chunk_state = iterator.GetChunkState();
 
 		InsertHashes(hashes, count, chunk_state, insert_state, parallel);
@@ -876,6 +986,8 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, const idx_t sel_
 	for (idx_t i = 0; i < sel_count; i++) {
 		auto idx = sel.get_index(i);
 		ptrs[idx] = LoadPointer(ptrs[idx] + ht.pointer_offset);
+		// prefetch the next row in the chain, as we will compare its keys next
+		DUCKDB_PREFETCH(ptrs[idx]);
 		if (ptrs[idx]) {
 			this->sel_vector.set_index(new_count++, idx);
 		}
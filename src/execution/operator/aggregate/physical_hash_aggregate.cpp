@@ -558,9 +558,7 @@ private:
 	idx_t grouping_idx = 0;
 	unique_ptr<LocalSourceState> radix_table_lstate;
 	bool blocked = false;
-	idx_t aggregation_idx = 0;
-	idx_t payload_idx = 0;
-	idx_t next_payload_idx = 0;
+	idx_t table_idx = 0;
 };
 
 void HashAggregateDistinctFinalizeEvent::Schedule() {
@@ -574,7 +572,6 @@ void HashAggregateDistinctFinalizeEvent::Schedule() {
 }
 
 idx_t HashAggregateDistinctFinalizeEvent::CreateGlobalSources() {
-	auto &aggregates = op.grouped_aggregate_data.aggregates;
 	global_source_states.reserve(op.groupings.size());
 
 	idx_t n_tasks = 0;
@@ -583,24 +580,19 @@ idx_t HashAggregateDistinctFinalizeEvent::CreateGlobalSources() {
 		auto &distinct_state = *gstate.grouping_states[grouping_idx].distinct_state;
 		auto &distinct_data = *grouping.distinct_data;
 
-		vector<unique_ptr<GlobalSourceState>> aggregate_sources;
-		aggregate_sources.reserve(aggregates.size());
-		for (idx_t agg_idx = 0; agg_idx < aggregates.size(); agg_idx++) {
-			auto &aggregate = aggregates[agg_idx];
-			auto &aggr = aggregate->Cast<BoundAggregateExpression>();
-
-			if (!aggr.IsDistinct()) {
-				aggregate_sources.push_back(nullptr);
+		// Every table is scanned once, also if it is shared by multiple distinct aggregates
+		vector<unique_ptr<GlobalSourceState>> table_sources;
+		table_sources.reserve(distinct_data.radix_tables.size());
+		for (idx_t table_idx = 0; table_idx < distinct_data.radix_tables.size(); table_idx++) {
+			auto &radix_table_p = distinct_data.radix_tables[table_idx];
+			if (!radix_table_p) {
+				table_sources.push_back(nullptr);
 				continue;
 			}
-			D_ASSERT(distinct_data.info.table_map.count(agg_idx));
-
-			auto table_idx = distinct_data.info.table_map.at(agg_idx);
-			auto &radix_table_p = distinct_data.radix_tables[table_idx];
 			n_tasks += radix_table_p->MaxThreads(*distinct_state.radix_states[table_idx]);
-			aggregate_sources.push_back(radix_table_p->GetGlobalSourceState(context));
+			table_sources.push_back(radix_table_p->GetGlobalSourceState(context));
 		}
-		global_source_states.push_back(std::move(aggregate_sources));
+		global_source_states.push_back(std::move(table_sources));
 	}
 
 	return MaxValue<idx_t>(n_tasks, 1);
@@ -619,9 +611,7 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::ExecuteTask(TaskExecution
 			return res;
 		}
 		D_ASSERT(res == TaskExecutionResult::TASK_FINISHED);
-		aggregation_idx = 0;
-		payload_idx = 0;
-		next_payload_idx = 0;
+		table_idx = 0;
 		local_sink_state = nullptr;
 	}
 	event->FinishTask();
@@ -667,31 +657,35 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping
 
 	const auto &finalize_event = event->Cast<HashAggregateDistinctFinalizeEvent>();
 
-	auto &agg_idx = aggregation_idx;
-	for (; agg_idx < op.grouped_aggregate_data.aggregates.size(); agg_idx++) {
-		auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
-
-		if (!blocked) {
-			// Forward the payload idx
-			payload_idx = next_payload_idx;
-			next_payload_idx = payload_idx + aggregate.children.size();
-		}
+	// The offsets of the inputs of the aggregates in the payload
+	vector<idx_t> payload_offsets;
+	idx_t payload_offset = 0;
+	for (auto &aggregate : aggregates) {
+		payload_offsets.push_back(payload_offset);
+		payload_offset += aggregate->Cast<BoundAggregateExpression>().children.size();
+	}
 
-		// If aggregate is not distinct, skip it
-		if (!distinct_data.IsDistinct(agg_idx)) {
+	for (; table_idx < distinct_data.radix_tables.size(); table_idx++) {
+		auto &radix_table = distinct_data.radix_tables[table_idx];
+		if (!radix_table) {
 			continue;
 		}
 
-		D_ASSERT(distinct_data.info.table_map.count(agg_idx));
-		const auto &table_idx = distinct_data.info.table_map.at(agg_idx);
-		auto &radix_table = distinct_data.radix_tables[table_idx];
+		// The distinct aggregates that share this table
+		unsafe_vector<idx_t> table_aggregates;
+		for (auto &agg_idx : info.indices) {
+			if (info.table_map.at(agg_idx) == table_idx) {
+				table_aggregates.push_back(agg_idx);
+			}
+		}
+		D_ASSERT(!table_aggregates.empty());
 
 		auto &sink = *distinct_state.radix_states[table_idx];
 		if (!blocked) {
 			radix_table_lstate = radix_table->GetLocalSourceState(execution_context);
 		}
 		auto &local_source = *radix_table_lstate;
-		OperatorSourceInput source_input {*finalize_event.global_source_states[grouping_idx][agg_idx], local_source,
+		OperatorSourceInput source_input {*finalize_event.global_source_states[grouping_idx][table_idx], local_source,
 		                                  interrupt_state};
 
 		// Create a duplicate of the output_chunk, because of multi-threading we cant alter the original
@@ -721,14 +715,18 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping
 			}
 			group_chunk.SetCardinality(output_chunk);
 
-			for (idx_t child_idx = 0; child_idx < grouped_aggregate_data.groups.size() - group_by_size; child_idx++) {
-				aggregate_input_chunk.data[payload_idx + child_idx].Reference(
-				    output_chunk.data[group_by_size + child_idx]);
+			for (auto &agg_idx : table_aggregates) {
+				for (idx_t child_idx = 0; child_idx < grouped_aggregate_data.groups.size() - group_by_size;
+				     child_idx++) {
+					aggregate_input_chunk.data[payload_offsets[agg_idx] + child_idx].Reference(
+					    output_chunk.data[group_by_size + child_idx]);
+				}
 			}
 			aggregate_input_chunk.SetCardinality(output_chunk);
 
 			// Sink it into the main ht
-			grouping_data.table_data.Sink(execution_context, group_chunk, sink_input, aggregate_input_chunk, {agg_idx});
+			grouping_data.table_data.Sink(execution_context, group_chunk, sink_input, aggregate_input_chunk,
+			                              table_aggregates);
 		}
 		blocked = false;
 	}
@@ -84,8 +84,6 @@ public:
 	    : ht(op.CreateHT(Allocator::Get(context), context)) {
 	}
 
-	//! The lock for updating the global aggregate state
-	mutex lock;
 	//! The global aggregate hash table
 	unique_ptr<PerfectAggregateHashTable> ht;
 };
@@ -164,7 +162,7 @@ SinkCombineResultType PhysicalPerfectHashAggregate::Combine(ExecutionContext &co
 	auto &lstate = input.local_state.Cast<PerfectHashAggregateLocalState>();
 	auto &gstate = input.global_state.Cast<PerfectHashAggregateGlobalState>();
 
-	lock_guard<mutex> l(gstate.lock);
+	// the global HT locks the pages that are being combined, so that threads combine their HTs in parallel
 	gstate.ht->Combine(*lstate.ht);
 
 	return SinkCombineResultType::FINISHED;
@@ -0,0 +1,290 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/core_functions/create_sort_key.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(vector<LogicalType> types,
+                                                       vector<unique_ptr<Expression>> aggregates_p,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)), state_size(0) {
+	for (auto &expr : aggregates) {
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		D_ASSERT(!aggr.IsDistinct());
+		state_offsets.push_back(state_size);
+		state_size += AlignValue(aggr.function.state_size(aggr.function));
+	}
+}
+
+class StreamingAggregateState : public OperatorState {
+public:
+	StreamingAggregateState(ExecutionContext &context, const PhysicalStreamingAggregate &op)
+	    : op(op), allocator(Allocator::DefaultAllocator()), group_executor(context.client),
+	      addresses(LogicalType::POINTER) {
+		vector<LogicalType> group_types;
+		for (auto &group : op.groups) {
+			group_types.push_back(group->return_type);
+			group_executor.AddExpression(*group);
+			modifiers.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST);
+		}
+		group_chunk.Initialize(Allocator::Get(context.client), group_types);
+		group_values.Initialize(Allocator::Get(context.client), group_types, 1);
+		for (idx_t i = 0; i < 2; i++) {
+			state_buffers[i] = make_unsafe_uniq_array_uninitialized<data_t>(op.state_size * STANDARD_VECTOR_SIZE);
+		}
+		state_pointers.resize(STANDARD_VECTOR_SIZE);
+	}
+
+	~StreamingAggregateState() override {
+		if (has_group) {
+			DestroyStates(&group_state, 1);
+		}
+	}
+
+	const PhysicalStreamingAggregate &op;
+	ArenaAllocator allocator;
+	ExpressionExecutor group_executor;
+	DataChunk group_chunk;
+	vector<OrderModifiers> modifiers;
+
+	//! The states of the groups that start in an input chunk, the current group can be in the other buffer
+	unsafe_unique_array<data_t> state_buffers[2];
+	//! The buffer that holds the state of the current group
+	idx_t current_buffer = 0;
+
+	//! Whether or not there is a group that has not been emitted yet
+	bool has_group = false;
+	//! The sort key of the current group, which is compared against the groups of the next chunk
+	string group_key;
+	//! The values of the current group
+	DataChunk group_values;
+	//! The state of the current group
+	data_ptr_t group_state = nullptr;
+
+	//! For every row of the input chunk, the state of its group
+	vector<data_ptr_t> state_pointers;
+	Vector addresses;
+
+public:
+	void InitializeStates(data_ptr_t states, idx_t count) {
+		for (idx_t i = 0; i < count; i++) {
+			for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+				auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+				aggr.function.initialize(aggr.function, states + i * op.state_size + op.state_offsets[aggr_idx]);
+			}
+		}
+	}
+
+	//! Points the addresses to the state of the aggregate for every state
+	void SetAddresses(data_ptr_t states[], idx_t count, idx_t aggr_idx) {
+		auto address_data = FlatVector::GetData<data_ptr_t>(addresses);
+		for (idx_t i = 0; i < count; i++) {
+			address_data[i] = states[i] + op.state_offsets[aggr_idx];
+		}
+	}
+
+	void DestroyStates(data_ptr_t states[], idx_t count) {
+		for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+			auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+			if (!aggr.function.destructor) {
+				continue;
+			}
+			SetAddresses(states, count, aggr_idx);
+			AggregateInputData aggr_input_data(aggr.bind_info.get(), allocator);
+			aggr.function.destructor(addresses, aggr_input_data, count);
+		}
+	}
+
+	//! Writes the aggregates of the given (finished) groups to the result, starting at column "column_offset"
+	void FinalizeStates(data_ptr_t states[], idx_t count, DataChunk &result, idx_t column_offset) {
+		for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+			auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+			SetAddresses(states, count, aggr_idx);
+			AggregateInputData aggr_input_data(aggr.bind_info.get(), allocator);
+			aggr.function.finalize(addresses, aggr_input_data, result.data[column_offset + aggr_idx], count, 0);
+		}
+		DestroyStates(states, count);
+	}
+};
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context, *this);
+}
+
+static void UpdateAggregate(StreamingAggregateState &state, BoundAggregateExpression &aggr, idx_t aggr_idx,
+                            DataChunk &input) {
+	auto count = input.size();
+	state.SetAddresses(state.state_pointers.data(), count, aggr_idx);
+	AggregateInputData aggr_input_data(aggr.bind_info.get(), state.allocator);
+
+	// the children of the aggregate (and its filter) are columns of the input
+	DataChunk aggr_input;
+	if (!aggr.children.empty()) {
+		vector<LogicalType> child_types;
+		for (auto &child : aggr.children) {
+			child_types.push_back(child->return_type);
+		}
+		aggr_input.InitializeEmpty(child_types);
+		for (idx_t child_idx = 0; child_idx < aggr.children.size(); child_idx++) {
+			auto &child = aggr.children[child_idx]->Cast<BoundReferenceExpression>();
+			aggr_input.data[child_idx].Reference(input.data[child.index]);
+		}
+		aggr_input.SetCardinality(count);
+	}
+	auto inputs = aggr.children.empty() ? nullptr : aggr_input.data.data();
+	if (!aggr.filter) {
+		aggr.function.update(inputs, aggr_input_data, aggr.children.size(), state.addresses, count);
+		return;
+	}
+
+	// only the rows that pass the filter are aggregated
+	auto &filter = input.data[aggr.filter->Cast<BoundReferenceExpression>().index];
+	UnifiedVectorFormat filter_data;
+	filter.ToUnifiedFormat(count, filter_data);
+	auto filter_values = UnifiedVectorFormat::GetData<bool>(filter_data);
+	SelectionVector sel(count);
+	idx_t sel_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = filter_data.sel->get_index(i);
+		if (filter_data.validity.RowIsValid(idx) && filter_values[idx]) {
+			sel.set_index(sel_count++, i);
+		}
+	}
+	if (sel_count == 0) {
+		return;
+	}
+	if (!aggr.children.empty()) {
+		aggr_input.Slice(sel, sel_count);
+	}
+	Vector filtered_addresses(state.addresses, sel, sel_count);
+	aggr.function.update(inputs, aggr_input_data, aggr.children.size(), filtered_addresses, sel_count);
+}
+
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate_p, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	auto count = input.size();
+	if (count == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	// compare the sort keys of the groups of adjacent rows to find the rows that start a new group
+	state.group_chunk.Reset();
+	state.group_executor.Execute(input, state.group_chunk);
+	Vector keys(LogicalType::BLOB, count);
+	CreateSortKeyHelpers::CreateSortKey(state.group_chunk, state.modifiers, keys);
+	auto key_data = FlatVector::GetData<string_t>(keys);
+
+	auto new_buffer = state.state_buffers[1 - state.current_buffer].get();
+	SelectionVector group_starts(count);
+	idx_t group_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		bool new_group;
+		if (i == 0) {
+			new_group = !state.has_group || !(key_data[0] == string_t(state.group_key));
+		} else {
+			new_group = !(key_data[i] == key_data[i - 1]);
+		}
+		if (new_group) {
+			group_starts.set_index(group_count++, i);
+		}
+		state.state_pointers[i] =
+		    group_count == 0 ? state.group_state : new_buffer + (group_count - 1) * state_size;
+	}
+	state.InitializeStates(new_buffer, group_count);
+
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggr = aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		UpdateAggregate(state, aggr, aggr_idx, input);
+	}
+	if (group_count == 0) {
+		// the chunk only contains rows of the current group
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	// all groups but the last one in this chunk are finished
+	vector<data_ptr_t> finished_states;
+	idx_t output_offset = 0;
+	if (state.has_group) {
+		finished_states.push_back(state.group_state);
+		for (idx_t col_idx = 0; col_idx < groups.size(); col_idx++) {
+			VectorOperations::Copy(state.group_values.data[col_idx], chunk.data[col_idx], 1, 0, 0);
+		}
+		output_offset = 1;
+	}
+	for (idx_t group_idx = 0; group_idx + 1 < group_count; group_idx++) {
+		finished_states.push_back(new_buffer + group_idx * state_size);
+	}
+	for (idx_t col_idx = 0; col_idx < groups.size(); col_idx++) {
+		VectorOperations::Copy(state.group_chunk.data[col_idx], chunk.data[col_idx], group_starts, group_count - 1, 0,
+		                       output_offset);
+	}
+	state.FinalizeStates(finished_states.data(), finished_states.size(), chunk, groups.size());
+	chunk.SetCardinality(finished_states.size());
+
+	// the last group of the chunk becomes the current group
+	auto last_row = group_starts.get_index(group_count - 1);
+	state.has_group = true;
+	state.group_state = new_buffer + (group_count - 1) * state_size;
+	state.current_buffer = 1 - state.current_buffer;
+	state.group_key = key_data[last_row].GetString();
+	state.group_values.Reset();
+	SelectionVector last_sel(group_starts.data() + group_count - 1);
+	for (idx_t col_idx = 0; col_idx < groups.size(); col_idx++) {
+		VectorOperations::Copy(state.group_chunk.data[col_idx], state.group_values.data[col_idx], last_sel, 1, 0, 0);
+	}
+	state.group_values.SetCardinality(1);
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate_p,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (!state.has_group) {
+		return OperatorFinalizeResultType::FINISHED;
+	}
+	// emit the last group
+	for (idx_t col_idx = 0; col_idx < groups.size(); col_idx++) {
+		VectorOperations::Copy(state.group_values.data[col_idx], chunk.data[col_idx], 1, 0, 0);
+	}
+	state.FinalizeStates(&state.group_state, 1, chunk, groups.size());
+	chunk.SetCardinality(1);
+	state.has_group = false;
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+InsertionOrderPreservingMap<string> PhysicalStreamingAggregate::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	string groups_info;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			groups_info += "\n";
+		}
+		groups_info += groups[i]->GetName();
+	}
+	result["Groups"] = groups_info;
+
+	string aggregate_info;
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		if (i > 0) {
+			aggregate_info += "\n";
+		}
+		aggregate_info += aggregates[i]->GetName();
+		auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+		if (aggregate.filter) {
+			aggregate_info += " Filter: " + aggregate.filter->GetName();
+		}
+	}
+	result["Aggregates"] = aggregate_info;
+	return result;
+}
+
+} // namespace duckdb
@@ -23,13 +23,73 @@ public:
 	std::atomic<int64_t> row_number;
 };
 
+//! The aggregates that can be maintained over a bounded frame by adding the entering and removing the leaving rows
+enum class InvertibleAggregate : uint8_t { NONE, COUNT, SUM, AVG };
+
 class StreamingWindowState : public OperatorState {
 public:
 	struct AggregateState {
+		//	Fixed size
+		static constexpr idx_t MAX_PRECEDING = 2048U;
+		//	Aggregates that cannot be inverted are computed from scratch for every frame
+		static constexpr idx_t MAX_RECOMPUTED_PRECEDING = 64U;
+
+		static InvertibleAggregate GetInvertible(BoundWindowExpression &wexpr) {
+			if (!wexpr.aggregate || wexpr.children.size() != 1 || wexpr.bind_info) {
+				return InvertibleAggregate::NONE;
+			}
+			auto &name = wexpr.aggregate->name;
+			if (name == "count") {
+				return InvertibleAggregate::COUNT;
+			}
+			// integer SUM/AVG are exact, so removing a row restores the state without it
+			switch (wexpr.children[0]->return_type.id()) {
+			case LogicalTypeId::SMALLINT:
+			case LogicalTypeId::INTEGER:
+			case LogicalTypeId::BIGINT:
+				break;
+			default:
+				return InvertibleAggregate::NONE;
+			}
+			if (name == "sum" && wexpr.return_type.id() == LogicalTypeId::HUGEINT) {
+				return InvertibleAggregate::SUM;
+			}
+			if ((name == "avg" || name == "mean") && wexpr.return_type.id() == LogicalTypeId::DOUBLE) {
+				return InvertibleAggregate::AVG;
+			}
+			return InvertibleAggregate::NONE;
+		}
+
+		static bool ComputePreceding(ClientContext &context, BoundWindowExpression &wexpr, idx_t &preceding) {
+			preceding = 0;
+			if (!wexpr.start_expr || wexpr.start_expr->HasParameter() || !wexpr.start_expr->IsFoldable()) {
+				return false;
+			}
+			auto preceding_value = ExpressionExecutor::EvaluateScalar(context, *wexpr.start_expr);
+			if (preceding_value.IsNull()) {
+				return false;
+			}
+			Value bigint_value;
+			if (!preceding_value.DefaultTryCastAs(LogicalType::BIGINT, bigint_value, nullptr, false)) {
+				return false;
+			}
+			const auto offset = bigint_value.GetValue<int64_t>();
+			if (offset < 0) {
+				return false;
+			}
+			//	We only buffer the arguments of a bounded number of rows
+			preceding = idx_t(offset);
+			if (wexpr.children.empty() || GetInvertible(wexpr) != InvertibleAggregate::NONE) {
+				return preceding < MAX_PRECEDING;
+			}
+			//	Larger frames are better served by the (parallel) segment tree of the regular window operator
+			return preceding < MAX_RECOMPUTED_PRECEDING;
+		}
+
 		AggregateState(ClientContext &client, BoundWindowExpression &wexpr, Allocator &allocator)
 		    : wexpr(wexpr), arena_allocator(Allocator::DefaultAllocator()), executor(client), filter_executor(client),
-		      statev(LogicalType::POINTER, data_ptr_cast(&state_ptr)), hashes(LogicalType::HASH),
-		      addresses(LogicalType::POINTER) {
+		      statev(LogicalType::POINTER, data_ptr_cast(&state_ptr)), framev(LogicalType::POINTER),
+		      hashes(LogicalType::HASH), addresses(LogicalType::POINTER) {
 			D_ASSERT(wexpr.GetExpressionType() == ExpressionType::WINDOW_AGGREGATE);
 			auto &aggregate = *wexpr.aggregate;
 			bind_data = wexpr.bind_info.get();
@@ -45,6 +105,17 @@ public:
 				arg_chunk.Initialize(allocator, arg_types);
 				arg_cursor.Initialize(allocator, arg_types);
 			}
+			if (wexpr.start == WindowBoundary::EXPR_PRECEDING_ROWS) {
+				bounded = ComputePreceding(client, wexpr, preceding);
+				D_ASSERT(bounded);
+				invertible = GetInvertible(wexpr);
+				framev.SetVectorType(VectorType::CONSTANT_VECTOR);
+				ConstantVector::GetData<data_ptr_t>(framev)[0] = state.data();
+				if (!arg_types.empty()) {
+					frame.Initialize(allocator, arg_types, preceding + STANDARD_VECTOR_SIZE);
+					frame_tail.Initialize(allocator, arg_types, MaxValue<idx_t>(preceding, 1));
+				}
+			}
 			if (wexpr.filter_expr) {
 				filter_executor.AddExpression(*wexpr.filter_expr);
 				filter_sel.Initialize();
@@ -65,6 +136,12 @@ public:
 		}
 
 		void Execute(ExecutionContext &context, DataChunk &input, Vector &result);
+		void ExecuteBounded(ExecutionContext &context, DataChunk &input, Vector &result);
+		//! Aggregates the bounded frame of every row from scratch
+		void ExecuteRecomputed(Vector &result, idx_t buffered, idx_t count);
+		//! Maintains an invertible aggregate over a bounded frame by adding and removing single rows
+		template <class T>
+		void ExecuteInvertible(Vector &result, idx_t buffered, idx_t count);
 
 		//! The aggregate expression
 		BoundWindowExpression &wexpr;
@@ -95,6 +172,25 @@ public:
 		//! Argument cursor (a one element slice of arg_chunk)
 		DataChunk arg_cursor;
 
+		//! Whether the frame is bounded (ROWS BETWEEN <preceding> PRECEDING AND CURRENT ROW)
+		bool bounded = false;
+		//! The number of preceding rows in a bounded frame
+		idx_t preceding = 0;
+		//! The number of rows seen so far
+		idx_t rows_seen = 0;
+		//! The arguments of the last <preceding> rows, followed by the arguments of the current chunk
+		DataChunk frame;
+		//! The copy buffer for the arguments of the last <preceding> rows
+		DataChunk frame_tail;
+		//! The constant state vector for updating the single state with a whole frame
+		Vector framev;
+		//! The aggregate that is maintained incrementally over the bounded frame (if any)
+		InvertibleAggregate invertible = InvertibleAggregate::NONE;
+		//! The sum of the non-NULL arguments in the current frame of an invertible aggregate
+		hugeint_t window_sum = 0;
+		//! The number of non-NULL arguments in the current frame of an invertible aggregate
+		int64_t window_count = 0;
+
 		//! Hash table for accumulating the distinct values
 		unique_ptr<GroupedAggregateHashTable> distinct;
 		//! Filtered arguments for checking distinctness
@@ -338,9 +434,19 @@ bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, unique
 	}
 	switch (wexpr.type) {
 	// TODO: add more expression types here?
-	case ExpressionType::WINDOW_AGGREGATE:
+	case ExpressionType::WINDOW_AGGREGATE: {
+		if (wexpr.end != WindowBoundary::CURRENT_ROW_ROWS) {
+			return false;
+		}
 		// We can stream aggregates if they are "running totals"
-		return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS;
+		if (wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING) {
+			return true;
+		}
+		// We can stream aggregates over a constant number of preceding rows by buffering their arguments
+		idx_t preceding;
+		return wexpr.start == WindowBoundary::EXPR_PRECEDING_ROWS && !wexpr.distinct && !wexpr.filter_expr &&
+		       StreamingWindowState::AggregateState::ComputePreceding(context, wexpr, preceding);
+	}
 	case ExpressionType::WINDOW_FIRST_VALUE:
 	case ExpressionType::WINDOW_PERCENT_RANK:
 	case ExpressionType::WINDOW_RANK:
@@ -368,7 +474,139 @@ unique_ptr<OperatorState> PhysicalStreamingWindow::GetOperatorState(ExecutionCon
 	return make_uniq<StreamingWindowState>(context.client);
 }
 
+void StreamingWindowState::AggregateState::ExecuteBounded(ExecutionContext &context, DataChunk &input,
+                                                          Vector &result) {
+	D_ASSERT(!wexpr.distinct && !wexpr.filter_expr);
+	const idx_t count = input.size();
+
+	// Check for COUNT(*)
+	if (wexpr.children.empty()) {
+		D_ASSERT(GetTypeIdSize(result.GetType().InternalType()) == sizeof(int64_t));
+		auto data = FlatVector::GetData<int64_t>(result);
+		for (idx_t i = 0; i < count; ++i) {
+			data[i] = int64_t(MinValue<idx_t>(rows_seen + i, preceding) + 1);
+		}
+		rows_seen += count;
+		return;
+	}
+
+	// Append the arguments to the ones of the preceding rows
+	arg_chunk.Reset();
+	executor.Execute(input, arg_chunk);
+	arg_chunk.Flatten();
+	const idx_t buffered = frame.size();
+	frame.Append(arg_chunk);
+
+	switch (invertible) {
+	case InvertibleAggregate::NONE:
+		ExecuteRecomputed(result, buffered, count);
+		break;
+	case InvertibleAggregate::COUNT:
+		// COUNT only reads the validity of its argument
+		ExecuteInvertible<int64_t>(result, buffered, count);
+		break;
+	default:
+		switch (frame.data[0].GetType().InternalType()) {
+		case PhysicalType::INT16:
+			ExecuteInvertible<int16_t>(result, buffered, count);
+			break;
+		case PhysicalType::INT32:
+			ExecuteInvertible<int32_t>(result, buffered, count);
+			break;
+		case PhysicalType::INT64:
+			ExecuteInvertible<int64_t>(result, buffered, count);
+			break;
+		default:
+			throw InternalException("Unsupported type for an invertible streaming window aggregate");
+		}
+		break;
+	}
+	rows_seen += count;
+
+	// Only keep the arguments of the last <preceding> rows
+	const idx_t keep = MinValue<idx_t>(frame.size(), preceding);
+	frame_tail.Reset();
+	for (column_t col_idx = 0; col_idx < frame.ColumnCount(); ++col_idx) {
+		VectorOperations::Copy(frame.data[col_idx], frame_tail.data[col_idx], frame.size(), frame.size() - keep, 0);
+	}
+	frame_tail.SetCardinality(keep);
+	frame.Reset();
+	frame.Append(frame_tail);
+}
+
+void StreamingWindowState::AggregateState::ExecuteRecomputed(Vector &result, idx_t buffered, idx_t count) {
+	auto &aggregate = *wexpr.aggregate;
+
+	// Compute the aggregate over the frame of every row, reusing the single state
+	AggregateInputData aggr_input_data(wexpr.bind_info.get(), arena_allocator);
+	for (idx_t i = 0; i < count; ++i) {
+		const idx_t frame_end = buffered + i + 1;
+		const idx_t frame_begin = frame_end - MinValue<idx_t>(frame_end, preceding + 1);
+		for (column_t col_idx = 0; col_idx < frame.ColumnCount(); ++col_idx) {
+			arg_cursor.data[col_idx].Slice(frame.data[col_idx], frame_begin, frame_end);
+		}
+		aggregate.update(arg_cursor.data.data(), aggr_input_data, arg_cursor.ColumnCount(), framev,
+		                 frame_end - frame_begin);
+		aggregate.finalize(statev, aggr_input_data, result, 1, i);
+
+		// Start over for the next frame
+		if (dtor) {
+			dtor(statev, aggr_input_data, 1);
+		}
+		arena_allocator.Reset();
+		aggregate.initialize(aggregate, state.data());
+	}
+}
+
+template <class T>
+void StreamingWindowState::AggregateState::ExecuteInvertible(Vector &result, idx_t buffered, idx_t count) {
+	auto &args = frame.data[0];
+	auto values = FlatVector::GetData<T>(args);
+	auto &validity = FlatVector::Validity(args);
+	auto &result_mask = FlatVector::Validity(result);
+	const bool sum_values = invertible != InvertibleAggregate::COUNT;
+	for (idx_t i = 0; i < count; ++i) {
+		// Add the row that enters the frame
+		const idx_t frame_end = buffered + i + 1;
+		const idx_t frame_begin = frame_end - MinValue<idx_t>(frame_end, preceding + 1);
+		if (validity.RowIsValid(frame_end - 1)) {
+			if (sum_values) {
+				window_sum += hugeint_t(values[frame_end - 1]);
+			}
+			++window_count;
+		}
+
+		// Finalize the same way as the regular aggregate functions
+		if (invertible == InvertibleAggregate::COUNT) {
+			FlatVector::GetData<int64_t>(result)[i] = window_count;
+		} else if (window_count == 0) {
+			result_mask.SetInvalid(i);
+		} else if (invertible == InvertibleAggregate::SUM) {
+			FlatVector::GetData<hugeint_t>(result)[i] = window_sum;
+		} else if (std::is_same<T, int16_t>::value) {
+			FlatVector::GetData<double>(result)[i] =
+			    double(Hugeint::Cast<int64_t>(window_sum)) / double(window_count);
+		} else {
+			FlatVector::GetData<double>(result)[i] =
+			    double(Hugeint::Cast<long double>(window_sum) / static_cast<long double>(window_count));
+		}
+
+		// Remove the row that leaves the frame of the next row
+		if (frame_end - frame_begin == preceding + 1 && validity.RowIsValid(frame_begin)) {
+			if (sum_values) {
+				window_sum -= hugeint_t(values[frame_begin]);
+			}
+			--window_count;
+		}
+	}
+}
+
 void StreamingWindowState::AggregateState::Execute(ExecutionContext &context, DataChunk &input, Vector &result) {
+	if (bounded) {
+		ExecuteBounded(context, input, result);
+		return;
+	}
+
 	//	Establish the aggregation environment
 	const idx_t count = input.size();
 	auto &aggregate = *wexpr.aggregate;
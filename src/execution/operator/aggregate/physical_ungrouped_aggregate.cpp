@@ -2,6 +2,7 @@
 
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
 #include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/unordered_set.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
@@ -19,6 +20,14 @@
 
 #include <functional>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DUCKDB_FUSED_AGGREGATE_AVX2
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define DUCKDB_FUSED_AGGREGATE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace duckdb {
 
 PhysicalUngroupedAggregate::PhysicalUngroupedAggregate(vector<LogicalType> types,
@@ -27,6 +36,7 @@ PhysicalUngroupedAggregate::PhysicalUngroupedAggregate(vector<LogicalType> types
     : PhysicalOperator(PhysicalOperatorType::UNGROUPED_AGGREGATE, std::move(types), estimated_cardinality),
       aggregates(std::move(expressions)) {
 
+	InitializeFusedAggregates();
 	distinct_collection_info = DistinctAggregateCollectionInfo::Create(aggregates);
 	if (!distinct_collection_info) {
 		return;
@@ -34,6 +44,71 @@ PhysicalUngroupedAggregate::PhysicalUngroupedAggregate(vector<LogicalType> types
 	distinct_data = make_uniq<DistinctAggregateData>(*distinct_collection_info);
 }
 
+static bool CanFuseAggregate(const BoundAggregateExpression &aggr) {
+	if (aggr.IsDistinct() || aggr.filter || aggr.order_bys || aggr.children.size() != 1 ||
+	    !aggr.function.simple_update) {
+		return false;
+	}
+	if (aggr.function.name != "min" && aggr.function.name != "max" && aggr.function.name != "count") {
+		return false;
+	}
+	if (aggr.children[0]->GetExpressionClass() != ExpressionClass::BOUND_REF) {
+		return false;
+	}
+	// the values have to be compared by the physical value
+	auto &type = aggr.children[0]->return_type;
+	if (!type.IsNumeric() && type.id() != LogicalTypeId::DATE && type.id() != LogicalTypeId::TIMESTAMP) {
+		return false;
+	}
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void PhysicalUngroupedAggregate::InitializeFusedAggregates() {
+	is_fused.resize(aggregates.size(), false);
+	idx_t payload_idx = 0;
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggr = aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		const auto aggr_payload_idx = payload_idx;
+		payload_idx += aggr.children.size();
+		if (is_fused[aggr_idx] || !CanFuseAggregate(aggr)) {
+			continue;
+		}
+		// look for the other aggregates over the same input
+		FusedUngroupedAggregates fused;
+		fused.payload_idx = aggr_payload_idx;
+		fused.aggregates.push_back(aggr_idx);
+		for (idx_t other_idx = aggr_idx + 1; other_idx < aggregates.size(); other_idx++) {
+			auto &other = aggregates[other_idx]->Cast<BoundAggregateExpression>();
+			if (!is_fused[other_idx] && CanFuseAggregate(other) && other.children[0]->Equals(*aggr.children[0])) {
+				fused.aggregates.push_back(other_idx);
+			}
+		}
+		if (fused.aggregates.size() < 2) {
+			continue;
+		}
+		for (auto &fused_idx : fused.aggregates) {
+			is_fused[fused_idx] = true;
+		}
+		fused_aggregates.push_back(std::move(fused));
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Ungrouped Aggregate State
 //===--------------------------------------------------------------------===//
@@ -307,7 +382,7 @@ SinkResultType PhysicalUngroupedAggregate::Sink(ExecutionContext &context, DataC
 		payload_idx = next_payload_idx;
 		next_payload_idx = payload_idx + aggregate.children.size();
 
-		if (aggregate.IsDistinct()) {
+		if (aggregate.IsDistinct() || is_fused[aggr_idx]) {
 			continue;
 		}
 
@@ -333,6 +408,15 @@ SinkResultType PhysicalUngroupedAggregate::Sink(ExecutionContext &context, DataC
 
 		sink.state.Sink(payload_chunk, payload_idx, aggr_idx);
 	}
+
+	for (auto &fused : fused_aggregates) {
+		// the aggregates share their input: resolve it only once
+		sink.child_executor.SetChunk(chunk);
+		payload_chunk.SetCardinality(chunk);
+		auto &input_vector = payload_chunk.data[fused.payload_idx];
+		sink.child_executor.ExecuteExpression(fused.payload_idx, input_vector);
+		sink.state.SinkFused(input_vector, payload_chunk.size(), fused.aggregates);
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -348,6 +432,265 @@ void LocalUngroupedAggregateState::Sink(DataChunk &payload_chunk, idx_t payload_
 	                                 payload_chunk.size());
 }
 
+template <class T, bool ALL_VALID>
+static idx_t FusedMinMaxCountLoop(const T *data, const SelectionVector &sel, const ValidityMask &validity, idx_t count,
+                                  T &min, T &max) {
+	idx_t valid_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = sel.get_index(i);
+		if (!ALL_VALID && !validity.RowIsValid(idx)) {
+			continue;
+		}
+		const auto &value = data[idx];
+		if (valid_count == 0) {
+			min = value;
+			max = value;
+		} else {
+			if (LessThan::Operation<T>(value, min)) {
+				min = value;
+			}
+			if (GreaterThan::Operation<T>(value, max)) {
+				max = value;
+			}
+		}
+		valid_count++;
+	}
+	return valid_count;
+}
+
+#ifdef DUCKDB_FUSED_AGGREGATE_AVX2
+#define DUCKDB_FUSED_AGGREGATE_TARGET __attribute__((target("avx2")))
+//! The size of a SIMD register in bytes
+static constexpr idx_t FUSED_AGGREGATE_REGISTER_SIZE = 32;
+
+static bool HasSIMDFusedAggregate() {
+	static const bool supported = []() {
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+	}();
+	return supported;
+}
+#elif defined(DUCKDB_FUSED_AGGREGATE_NEON)
+#define DUCKDB_FUSED_AGGREGATE_TARGET
+static constexpr idx_t FUSED_AGGREGATE_REGISTER_SIZE = 16;
+
+static bool HasSIMDFusedAggregate() {
+	return true;
+}
+#endif
+
+#if defined(DUCKDB_FUSED_AGGREGATE_AVX2) || defined(DUCKDB_FUSED_AGGREGATE_NEON)
+//! Computes the MIN and MAX of the first values of the input one SIMD register at a time. The input has to hold at
+//! least one register of values. Returns the amount of processed values.
+DUCKDB_FUSED_AGGREGATE_TARGET static idx_t FusedMinMaxInt32SIMD(const int32_t *data, idx_t count, int32_t &min,
+                                                                int32_t &max) {
+	static constexpr idx_t WIDTH = FUSED_AGGREGATE_REGISTER_SIZE / sizeof(int32_t);
+	D_ASSERT(count >= WIDTH);
+	idx_t i = WIDTH;
+	int32_t min_lanes[WIDTH];
+	int32_t max_lanes[WIDTH];
+#ifdef DUCKDB_FUSED_AGGREGATE_AVX2
+	auto min_values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+	auto max_values = min_values;
+	for (; i + WIDTH <= count; i += WIDTH) {
+		auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+		min_values = _mm256_min_epi32(min_values, values);
+		max_values = _mm256_max_epi32(max_values, values);
+	}
+	_mm256_storeu_si256(reinterpret_cast<__m256i *>(min_lanes), min_values);
+	_mm256_storeu_si256(reinterpret_cast<__m256i *>(max_lanes), max_values);
+#else
+	auto min_values = vld1q_s32(data);
+	auto max_values = min_values;
+	for (; i + WIDTH <= count; i += WIDTH) {
+		auto values = vld1q_s32(data + i);
+		min_values = vminq_s32(min_values, values);
+		max_values = vmaxq_s32(max_values, values);
+	}
+	vst1q_s32(min_lanes, min_values);
+	vst1q_s32(max_lanes, max_values);
+#endif
+	min = min_lanes[0];
+	max = max_lanes[0];
+	for (idx_t lane_idx = 1; lane_idx < WIDTH; lane_idx++) {
+		min = MinValue(min, min_lanes[lane_idx]);
+		max = MaxValue(max, max_lanes[lane_idx]);
+	}
+	return i;
+}
+
+//! Same as FusedMinMaxInt32SIMD, for 64-bit integers, which only have SIMD comparisons and no SIMD MIN or MAX
+DUCKDB_FUSED_AGGREGATE_TARGET static idx_t FusedMinMaxInt64SIMD(const int64_t *data, idx_t count, int64_t &min,
+                                                                int64_t &max) {
+	static constexpr idx_t WIDTH = FUSED_AGGREGATE_REGISTER_SIZE / sizeof(int64_t);
+	D_ASSERT(count >= WIDTH);
+	idx_t i = WIDTH;
+	int64_t min_lanes[WIDTH];
+	int64_t max_lanes[WIDTH];
+#ifdef DUCKDB_FUSED_AGGREGATE_AVX2
+	auto min_values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+	auto max_values = min_values;
+	for (; i + WIDTH <= count; i += WIDTH) {
+		auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+		min_values = _mm256_blendv_epi8(min_values, values, _mm256_cmpgt_epi64(min_values, values));
+		max_values = _mm256_blendv_epi8(max_values, values, _mm256_cmpgt_epi64(values, max_values));
+	}
+	_mm256_storeu_si256(reinterpret_cast<__m256i *>(min_lanes), min_values);
+	_mm256_storeu_si256(reinterpret_cast<__m256i *>(max_lanes), max_values);
+#else
+	auto min_values = vld1q_s64(data);
+	auto max_values = min_values;
+	for (; i + WIDTH <= count; i += WIDTH) {
+		auto values = vld1q_s64(data + i);
+		min_values = vbslq_s64(vcgtq_s64(min_values, values), values, min_values);
+		max_values = vbslq_s64(vcgtq_s64(values, max_values), values, max_values);
+	}
+	vst1q_s64(min_lanes, min_values);
+	vst1q_s64(max_lanes, max_values);
+#endif
+	min = min_lanes[0];
+	max = max_lanes[0];
+	for (idx_t lane_idx = 1; lane_idx < WIDTH; lane_idx++) {
+		min = MinValue(min, min_lanes[lane_idx]);
+		max = MaxValue(max, max_lanes[lane_idx]);
+	}
+	return i;
+}
+#endif
+
+//! Computes the MIN and MAX of the first values of a flat input without NULLs with a SIMD kernel, if the type has one.
+//! Returns the amount of processed values, or 0 if none were processed.
+template <class T>
+static idx_t FusedMinMaxSIMD(const T *data, idx_t count, T &min, T &max) {
+	return 0;
+}
+
+static idx_t FusedMinMaxSIMD(const int32_t *data, idx_t count, int32_t &min, int32_t &max) {
+#if defined(DUCKDB_FUSED_AGGREGATE_AVX2) || defined(DUCKDB_FUSED_AGGREGATE_NEON)
+	if (HasSIMDFusedAggregate() && count >= FUSED_AGGREGATE_REGISTER_SIZE / sizeof(int32_t)) {
+		return FusedMinMaxInt32SIMD(data, count, min, max);
+	}
+#endif
+	return 0;
+}
+
+static idx_t FusedMinMaxSIMD(const int64_t *data, idx_t count, int64_t &min, int64_t &max) {
+#if defined(DUCKDB_FUSED_AGGREGATE_AVX2) || defined(DUCKDB_FUSED_AGGREGATE_NEON)
+	if (HasSIMDFusedAggregate() && count >= FUSED_AGGREGATE_REGISTER_SIZE / sizeof(int64_t)) {
+		return FusedMinMaxInt64SIMD(data, count, min, max);
+	}
+#endif
+	return 0;
+}
+
+//! Computes the MIN, MAX and COUNT of the input in a single pass, and writes the MIN and MAX to the given vectors
+template <class T>
+static idx_t FusedMinMaxCount(Vector &input, idx_t count, Vector &min_vector, Vector &max_vector) {
+	auto &min = ConstantVector::GetData<T>(min_vector)[0];
+	auto &max = ConstantVector::GetData<T>(max_vector)[0];
+	if (input.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		if (ConstantVector::IsNull(input)) {
+			return 0;
+		}
+		min = ConstantVector::GetData<T>(input)[0];
+		max = min;
+		return count;
+	}
+	UnifiedVectorFormat idata;
+	input.ToUnifiedFormat(count, idata);
+	const auto data = UnifiedVectorFormat::GetData<T>(idata);
+	if (idata.validity.AllValid()) {
+		idx_t simd_count = 0;
+		if (input.GetVectorType() == VectorType::FLAT_VECTOR) {
+			simd_count = FusedMinMaxSIMD(data, count, min, max);
+		}
+		if (simd_count == 0) {
+			return FusedMinMaxCountLoop<T, true>(data, *idata.sel, idata.validity, count, min, max);
+		}
+		// fold the values after the last full SIMD register into the result
+		T tail_min, tail_max;
+		if (FusedMinMaxCountLoop<T, true>(data + simd_count, *idata.sel, idata.validity, count - simd_count, tail_min,
+		                                  tail_max) > 0) {
+			min = MinValue(min, tail_min);
+			max = MaxValue(max, tail_max);
+		}
+		return count;
+	}
+	return FusedMinMaxCountLoop<T, false>(data, *idata.sel, idata.validity, count, min, max);
+}
+
+void LocalUngroupedAggregateState::SinkFused(Vector &input, idx_t count, const vector<idx_t> &aggregates) {
+	auto &type = input.GetType();
+	Vector min_vector(type, 1);
+	Vector max_vector(type, 1);
+	min_vector.SetVectorType(VectorType::CONSTANT_VECTOR);
+	max_vector.SetVectorType(VectorType::CONSTANT_VECTOR);
+
+	idx_t valid_count;
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+		valid_count = FusedMinMaxCount<int8_t>(input, count, min_vector, max_vector);
+		break;
+	case PhysicalType::INT16:
+		valid_count = FusedMinMaxCount<int16_t>(input, count, min_vector, max_vector);
+		break;
+	case PhysicalType::INT32:
+		valid_count = FusedMinMaxCount<int32_t>(input, count, min_vector, max_vector);
+		break;
+	case PhysicalType::INT64:
+		valid_count = FusedMinMaxCount<int64_t>(input, count, min_vector, max_vector);
+		break;
+	case PhysicalType::INT128:
+		valid_count = FusedMinMaxCount<hugeint_t>(input, count, min_vector, max_vector);
+		break;
+	case PhysicalType::UINT8:
+		valid_count = FusedMinMaxCount<uint8_t>(input, count, min_vector, max_vector);
+		break;
+	case PhysicalType::UINT16:
+		valid_count = FusedMinMaxCount<uint16_t>(input, count, min_vector, max_vector);
+		break;
+	case PhysicalType::UINT32:
+		valid_count = FusedMinMaxCount<uint32_t>(input, count, min_vector, max_vector);
+		break;
+	case PhysicalType::UINT64:
+		valid_count = FusedMinMaxCount<uint64_t>(input, count, min_vector, max_vector);
+		break;
+	case PhysicalType::UINT128:
+		valid_count = FusedMinMaxCount<uhugeint_t>(input, count, min_vector, max_vector);
+		break;
+	case PhysicalType::FLOAT:
+		valid_count = FusedMinMaxCount<float>(input, count, min_vector, max_vector);
+		break;
+	case PhysicalType::DOUBLE:
+		valid_count = FusedMinMaxCount<double>(input, count, min_vector, max_vector);
+		break;
+	default:
+		throw InternalException("Unsupported type for fused ungrouped aggregates");
+	}
+
+	for (auto &aggr_idx : aggregates) {
+#ifdef DEBUG
+		state.counts[aggr_idx] += count;
+#endif
+		if (valid_count == 0) {
+			// only NULL values: none of the states change
+			continue;
+		}
+		auto &aggregate = state.aggregate_expressions[aggr_idx]->Cast<BoundAggregateExpression>();
+		AggregateInputData aggr_input_data(state.bind_data[aggr_idx], allocator);
+		auto state_ptr = state.aggregate_data[aggr_idx].get();
+		if (aggregate.function.name == "min") {
+			aggregate.function.simple_update(&min_vector, aggr_input_data, 1, state_ptr, 1);
+		} else if (aggregate.function.name == "max") {
+			aggregate.function.simple_update(&max_vector, aggr_input_data, 1, state_ptr, 1);
+		} else {
+			// COUNT only needs to know how many non-NULL values there are: count a constant vector
+			D_ASSERT(aggregate.function.name == "count");
+			aggregate.function.simple_update(&min_vector, aggr_input_data, 1, state_ptr, valid_count);
+		}
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Combine
 //===--------------------------------------------------------------------===//
@@ -145,6 +145,8 @@ public:
 	unique_ptr<WindowPartitionGlobalSinkState> global_partition;
 	//! The execution functions
 	Executors executors;
+	//! For each aggregate executor, an earlier executor whose aggregator it can share (if any)
+	vector<optional_idx> shared_aggregators;
 };
 
 class WindowPartitionGlobalSinkState : public PartitionGlobalSinkState {
@@ -198,6 +200,9 @@ PhysicalWindow::PhysicalWindow(vector<LogicalType> types, vector<unique_ptr<Expr
     : PhysicalOperator(type, std::move(types), estimated_cardinality), select_list(std::move(select_list_p)),
       order_idx(0), is_order_dependent(false) {
 
+	// The sort is defined by the expression with the fewest partitions and the most orders,
+	// expressions with more partitions (within its orders) can use the same sort
+	idx_t min_partitions = NumericLimits<idx_t>::Maximum();
 	idx_t max_orders = 0;
 	for (idx_t i = 0; i < select_list.size(); ++i) {
 		auto &expr = select_list[i];
@@ -207,8 +212,10 @@ PhysicalWindow::PhysicalWindow(vector<LogicalType> types, vector<unique_ptr<Expr
 			is_order_dependent = true;
 		}
 
-		if (bound_window.orders.size() > max_orders) {
+		if (bound_window.partitions.size() < min_partitions ||
+		    (bound_window.partitions.size() == min_partitions && bound_window.orders.size() > max_orders)) {
 			order_idx = i;
+			min_partitions = bound_window.partitions.size();
 			max_orders = bound_window.orders.size();
 		}
 	}
@@ -257,6 +264,21 @@ WindowGlobalSinkState::WindowGlobalSinkState(const PhysicalWindow &op, ClientCon
 		D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
 		auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
 		auto wexec = WindowExecutorFactory(wexpr, context, mode);
+
+		//	Aggregates that only differ in their frame can use the same segment tree
+		optional_idx shared_idx;
+		if (wexpr.type == ExpressionType::WINDOW_AGGREGATE) {
+			auto &aggr_exec = wexec->Cast<WindowAggregateExecutor>();
+			for (idx_t prev_idx = 0; prev_idx < expr_idx; ++prev_idx) {
+				auto &prev = *executors[prev_idx];
+				if (prev.wexpr.type == ExpressionType::WINDOW_AGGREGATE && !shared_aggregators[prev_idx].IsValid() &&
+				    aggr_exec.CanShareAggregator(prev.Cast<WindowAggregateExecutor>())) {
+					shared_idx = prev_idx;
+					break;
+				}
+			}
+		}
+		shared_aggregators.emplace_back(shared_idx);
 		executors.emplace_back(std::move(wexec));
 	}
 
@@ -535,6 +557,14 @@ WindowHashGroup::WindowHashGroup(WindowGlobalSinkState &gstate, const idx_t hash
 	const auto &executors = gstate.executors;
 	for (auto &wexec : executors) {
 		auto &wexpr = wexec->wexpr;
+		// Expressions with more partitions than the sort use the order mask of their partitions as partition mask
+		if (wexpr.partitions.size() > gpart.partitions.size()) {
+			auto &nested_partition_mask = order_masks[wexpr.partitions.size()];
+			if (!nested_partition_mask.IsMaskSet()) {
+				nested_partition_mask.Initialize(count);
+				nested_partition_mask.SetAllInvalid(count);
+			}
+		}
 		auto &order_mask = order_masks[wexpr.partitions.size() + wexpr.orders.size()];
 		if (order_mask.IsMaskSet()) {
 			continue;
@@ -617,10 +647,21 @@ WindowHashGroup::ExecutorGlobalStates &WindowHashGroup::Initialize(WindowGlobalS
 	}
 
 	// These can be large so we defer building them until we are ready.
-	for (auto &wexec : executors) {
+	const auto partition_count = gsink.global_partition->partitions.size();
+	for (idx_t w = 0; w < executors.size(); ++w) {
+		auto &wexec = executors[w];
 		auto &wexpr = wexec->wexpr;
 		auto &order_mask = order_masks[wexpr.partitions.size() + wexpr.orders.size()];
-		gestates.emplace_back(wexec->GetGlobalState(count, partition_mask, order_mask));
+		auto &wexpr_partition_mask =
+		    wexpr.partitions.size() > partition_count ? order_masks[wexpr.partitions.size()] : partition_mask;
+		const auto &shared_idx = gsink.shared_aggregators[w];
+		if (shared_idx.IsValid()) {
+			auto &aggr_exec = wexec->Cast<WindowAggregateExecutor>();
+			gestates.emplace_back(aggr_exec.GetSharedGlobalState(count, wexpr_partition_mask, order_mask,
+			                                                     *gestates[shared_idx.GetIndex()]));
+		} else {
+			gestates.emplace_back(wexec->GetGlobalState(count, wexpr_partition_mask, order_mask));
+		}
 	}
 
 	return gestates;
@@ -1,4 +1,5 @@
 #include "duckdb/execution/operator/csv_scanner/csv_buffer.hpp"
+#include "duckdb/common/async_file_read.hpp"
 #include "duckdb/common/string_util.hpp"
 
 namespace duckdb {
@@ -33,6 +34,65 @@ CSVBuffer::CSVBuffer(CSVFileHandle &file_handle, ClientContext &context, idx_t b
 	last_buffer = file_handle.FinishedReading();
 }
 
+CSVBuffer::CSVBuffer(ClientContext &context, CSVFileHandle &file_handle, idx_t buffer_size,
+                     idx_t global_csv_current_position, idx_t file_number_p, idx_t buffer_idx_p, idx_t read_size)
+    : context(context), requested_size(buffer_size), global_csv_start(global_csv_current_position),
+      file_number(file_number_p), can_seek(file_handle.CanSeek()), is_pipe(file_handle.IsPipe()),
+      buffer_idx(buffer_idx_p) {
+	D_ASSERT(read_size > 0 && read_size <= buffer_size);
+	AllocateBuffer(buffer_size);
+	actual_buffer_size = read_size;
+	if (can_seek) {
+		last_buffer = global_csv_start + read_size >= file_handle.FileSize();
+		pending_read = file_handle.ReadAsync(handle.Ptr(), read_size, global_csv_start);
+	} else {
+		// the size of the buffer is only known once the read has completed
+		pending_read = file_handle.ReadAsync(handle.Ptr(), read_size);
+	}
+}
+
+CSVBuffer::~CSVBuffer() {
+	if (!pending_read) {
+		return;
+	}
+	// the background read is still writing into our memory - wait for it before releasing the buffer
+	try {
+		pending_read->Wait();
+	} catch (...) { // NOLINT
+	}
+}
+
+shared_ptr<CSVBuffer> CSVBuffer::ReadAhead(CSVFileHandle &file_handle, idx_t buffer_size, idx_t file_number_p) {
+	auto next_start = global_csv_start + actual_buffer_size;
+	if (!file_handle.CanSeek()) {
+		if (file_handle.FinishedReading()) {
+			return nullptr;
+		}
+		return make_shared_ptr<CSVBuffer>(context, file_handle, buffer_size, next_start, file_number_p, buffer_idx + 1,
+		                                  buffer_size);
+	}
+	auto file_size = file_handle.FileSize();
+	if (next_start >= file_size) {
+		return nullptr;
+	}
+	auto read_size = MinValue<idx_t>(buffer_size, file_size - next_start);
+	return make_shared_ptr<CSVBuffer>(context, file_handle, buffer_size, next_start, file_number_p, buffer_idx + 1,
+	                                  read_size);
+}
+
+void CSVBuffer::AwaitRead(CSVFileHandle &file_handle) {
+	if (!pending_read) {
+		return;
+	}
+	auto read = std::move(pending_read);
+	read->Wait();
+	if (read->IsSequential()) {
+		file_handle.FinishRead(*read);
+		actual_buffer_size = UnsafeNumericCast<idx_t>(read->GetBytesRead());
+		last_buffer = file_handle.FinishedReading();
+	}
+}
+
 shared_ptr<CSVBuffer> CSVBuffer::Next(CSVFileHandle &file_handle, idx_t buffer_size, idx_t file_number_p,
                                       bool &has_seaked) {
 	if (has_seaked) {
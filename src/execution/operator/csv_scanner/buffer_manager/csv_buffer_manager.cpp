@@ -39,7 +39,22 @@ bool CSVBufferManager::ReadNextAndCacheIt() {
 	D_ASSERT(last_buffer);
 	for (idx_t i = 0; i < 2; i++) {
 		if (!last_buffer->IsCSVFileLastBuffer()) {
-			auto maybe_last_buffer = last_buffer->Next(*file_handle, buffer_size, file_idx, has_seeked);
+			shared_ptr<CSVBuffer> maybe_last_buffer;
+			if (read_ahead) {
+				// the next buffer is already being read in the background
+				maybe_last_buffer = std::move(read_ahead);
+				maybe_last_buffer->AwaitRead(*file_handle);
+				if (file_handle->CanSeek()) {
+					// the read did not move the file handle, seek before reading from the handle again
+					has_seeked = true;
+				}
+				if (maybe_last_buffer->GetBufferSize() == 0) {
+					// we are done reading
+					maybe_last_buffer = nullptr;
+				}
+			} else {
+				maybe_last_buffer = last_buffer->Next(*file_handle, buffer_size, file_idx, has_seeked);
+			}
 			if (!maybe_last_buffer) {
 				last_buffer->last_buffer = true;
 				return false;
@@ -47,6 +62,10 @@ bool CSVBufferManager::ReadNextAndCacheIt() {
 			last_buffer = std::move(maybe_last_buffer);
 			bytes_read += last_buffer->GetBufferSize();
 			cached_buffers.emplace_back(last_buffer);
+			if (CanReadAhead() && !last_buffer->IsCSVFileLastBuffer()) {
+				// overlap reading the buffer after this one with parsing this one
+				read_ahead = last_buffer->ReadAhead(*file_handle, buffer_size, file_idx);
+			}
 			return true;
 		}
 	}
@@ -61,6 +80,7 @@ shared_ptr<CSVBufferHandle> CSVBufferManager::GetBuffer(const idx_t pos) {
 		}
 		// This is a recursive CTE, we have to reset out whole buffer
 		done = false;
+		read_ahead.reset();
 		file_handle->Reset();
 		Initialize();
 	}
@@ -134,6 +154,7 @@ bool CSVBufferManager::Done() {
 void CSVBufferManager::ResetBufferManager() {
 	if (!file_handle->IsPipe()) {
 		// If this is not a pipe we reset the buffer manager and restart it when doing the actual scan
+		read_ahead.reset();
 		cached_buffers.clear();
 		reset_when_possible.clear();
 		file_handle->Reset();
@@ -144,6 +165,18 @@ void CSVBufferManager::ResetBufferManager() {
 	}
 }
 
+bool CSVBufferManager::CanReadAhead() {
+	if (sniffing || file_handle->IsPipe()) {
+		return false;
+	}
+	if (file_handle->compression_type != FileCompressionType::UNCOMPRESSED) {
+		// the next part of a compressed file is decompressed in a background thread while this part is parsed
+		return true;
+	}
+	// reading ahead an uncompressed file reads at explicit positions, which requires a file we can seek in
+	return file_handle->CanSeek() && file_handle->OnDiskFile();
+}
+
 string CSVBufferManager::GetFilePath() {
 	return file_path;
 }
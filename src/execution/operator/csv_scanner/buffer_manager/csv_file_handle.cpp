@@ -1,4 +1,5 @@
 #include "duckdb/execution/operator/csv_scanner/csv_file_handle.hpp"
+#include "duckdb/common/async_file_read.hpp"
 #include "duckdb/common/exception/binder_exception.hpp"
 #include "duckdb/common/numeric_utils.hpp"
 #include "duckdb/common/compressed_file_system.hpp"
@@ -8,7 +9,7 @@ namespace duckdb {
 
 CSVFileHandle::CSVFileHandle(FileSystem &fs, Allocator &allocator, unique_ptr<FileHandle> file_handle_p,
                              const string &path_p, FileCompressionType compression)
-    : compression_type(compression), file_handle(std::move(file_handle_p)), path(path_p) {
+    : compression_type(compression), file_handle(std::move(file_handle_p)), path(path_p), compressed_progress(0) {
 	can_seek = file_handle->CanSeek();
 	on_disk_file = file_handle->OnDiskFile();
 	file_size = file_handle->GetFileSize();
@@ -16,6 +17,9 @@ CSVFileHandle::CSVFileHandle(FileSystem &fs, Allocator &allocator, unique_ptr<Fi
 	compression_type = file_handle->GetFileCompressionType();
 }
 
+CSVFileHandle::~CSVFileHandle() {
+}
+
 unique_ptr<FileHandle> CSVFileHandle::OpenFileHandle(FileSystem &fs, Allocator &allocator, const string &path,
                                                      FileCompressionType compression) {
 	auto file_handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ | compression);
@@ -32,6 +36,9 @@ unique_ptr<CSVFileHandle> CSVFileHandle::OpenFile(FileSystem &fs, Allocator &all
 }
 
 double CSVFileHandle::GetProgress() {
+	if (compression_type != FileCompressionType::UNCOMPRESSED) {
+		return static_cast<double>(compressed_progress.load());
+	}
 	return static_cast<double>(file_handle->GetProgress());
 }
 
@@ -57,6 +64,7 @@ void CSVFileHandle::Reset() {
 	file_handle->Reset();
 	finished = false;
 	requested_bytes = 0;
+	compressed_progress = 0;
 }
 
 bool CSVFileHandle::IsPipe() {
@@ -67,6 +75,10 @@ idx_t CSVFileHandle::FileSize() {
 	return file_size;
 }
 
+time_t CSVFileHandle::GetLastModifiedTime() {
+	return file_handle->file_system.GetLastModifiedTime(*file_handle);
+}
+
 bool CSVFileHandle::FinishedReading() {
 	return finished;
 }
@@ -79,9 +91,41 @@ idx_t CSVFileHandle::Read(void *buffer, idx_t nr_bytes) {
 		finished = bytes_read == 0;
 	}
 	uncompressed_bytes_read += static_cast<idx_t>(bytes_read);
+	if (compression_type != FileCompressionType::UNCOMPRESSED) {
+		compressed_progress = file_handle->GetProgress();
+	}
 	return UnsafeNumericCast<idx_t>(bytes_read);
 }
 
+shared_ptr<AsyncFileRead> CSVFileHandle::ReadAsync(void *buffer, idx_t nr_bytes, idx_t location) {
+	D_ASSERT(can_seek);
+	return file_handle->file_system.ReadAsync(*file_handle, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
+}
+
+shared_ptr<AsyncFileRead> CSVFileHandle::ReadAsync(void *buffer, idx_t nr_bytes) {
+	if (!read_thread) {
+		read_thread = make_uniq<AsyncFileReadThreads>(1);
+	}
+	requested_bytes += nr_bytes;
+	auto read = make_shared_ptr<AsyncFileRead>(file_handle->file_system, *file_handle, buffer,
+	                                           UnsafeNumericCast<int64_t>(nr_bytes));
+	read_thread->Schedule(read);
+	return read;
+}
+
+void CSVFileHandle::FinishRead(const AsyncFileRead &read) {
+	D_ASSERT(read.IsSequential());
+	auto bytes_read = UnsafeNumericCast<idx_t>(read.GetBytesRead());
+	if (!finished) {
+		// the read stops early only when it reached the end of the file
+		finished = bytes_read < UnsafeNumericCast<idx_t>(read.GetSize());
+	}
+	uncompressed_bytes_read += bytes_read;
+	if (compression_type != FileCompressionType::UNCOMPRESSED) {
+		compressed_progress = file_handle->GetProgress();
+	}
+}
+
 string CSVFileHandle::ReadLine() {
 	bool carriage_return = false;
 	string result;
@@ -228,11 +228,9 @@ void StringValueResult::AddValueToVector(const char *value_ptr, const idx_t size
 		return;
 	}
 
-	if (projecting_columns) {
-		if (!projected_columns[cur_col_id]) {
-			cur_col_id++;
-			return;
-		}
+	if (IsSkippedColumn()) {
+		cur_col_id++;
+		return;
 	}
 	for (idx_t i = 0; i < null_str_count; i++) {
 		if (size == null_str_size[i]) {
@@ -456,6 +454,12 @@ void StringValueResult::Reset() {
 	for (auto &v : validity_mask) {
 		v->SetAllValid(result_size);
 	}
+	for (auto &parse_vector : parse_chunk.data) {
+		if (parse_vector.GetType().InternalType() == PhysicalType::VARCHAR) {
+			// results of the previous chunk keep their own reference to the heap: start a new one
+			parse_vector.SetAuxiliary(nullptr);
+		}
+	}
 	// We keep a reference to the buffer from our current iteration if it already exists
 	shared_ptr<CSVBufferHandle> cur_buffer;
 	if (buffer_handles.find(iterator.GetBufferIdx()) != buffer_handles.end()) {
@@ -469,15 +473,22 @@ void StringValueResult::Reset() {
 	borked_rows.clear();
 }
 
+bool StringValueResult::IsSkippedColumn() const {
+	return projecting_columns && cur_col_id < number_of_columns && !projected_columns[cur_col_id];
+}
+
+void StringValueResult::SkipValue() {
+	// we only have to count the value: there is nothing to unescape, validate or cast
+	cur_col_id++;
+	quoted = false;
+	escaped = false;
+}
+
 void StringValueResult::AddQuotedValue(StringValueResult &result, const idx_t buffer_pos) {
 	if (result.escaped) {
-		if (result.projecting_columns) {
-			if (!result.projected_columns[result.cur_col_id]) {
-				result.cur_col_id++;
-				result.quoted = false;
-				result.escaped = false;
-				return;
-			}
+		if (result.IsSkippedColumn()) {
+			result.SkipValue();
+			return;
 		}
 		if (!result.HandleTooManyColumnsError(result.buffer_ptr + result.quoted_position + 1,
 		                                      buffer_pos - result.quoted_position - 2)) {
@@ -527,7 +538,9 @@ void StringValueResult::AddValue(StringValueResult &result, const idx_t buffer_p
 	if (result.last_position.buffer_pos > buffer_pos) {
 		return;
 	}
-	if (result.quoted) {
+	if (result.IsSkippedColumn()) {
+		result.SkipValue();
+	} else if (result.quoted) {
 		StringValueResult::AddQuotedValue(result, buffer_pos);
 	} else {
 		result.AddValueToVector(result.buffer_ptr + result.last_position.buffer_pos,
@@ -755,11 +768,9 @@ bool StringValueResult::AddRowInternal() {
 				if (cur_col_id < state_machine.options.force_not_null.size()) {
 					empty = state_machine.options.force_not_null[cur_col_id];
 				}
-				if (projecting_columns) {
-					if (!projected_columns[cur_col_id]) {
-						cur_col_id++;
-						continue;
-					}
+				if (IsSkippedColumn()) {
+					cur_col_id++;
+					continue;
 				}
 				if (empty) {
 					static_cast<string_t *>(vector_ptr[chunk_col_id])[number_of_rows] = string_t();
@@ -808,7 +819,9 @@ bool StringValueResult::AddRowInternal() {
 bool StringValueResult::AddRow(StringValueResult &result, const idx_t buffer_pos) {
 	if (result.last_position.buffer_pos <= buffer_pos) {
 		// We add the value
-		if (result.quoted) {
+		if (result.IsSkippedColumn()) {
+			result.SkipValue();
+		} else if (result.quoted) {
 			AddQuotedValue(result, buffer_pos);
 		} else {
 			result.AddValueToVector(result.buffer_ptr + result.last_position.buffer_pos,
@@ -921,6 +934,17 @@ StringValueResult &StringValueScanner::ParseChunk() {
 	return result;
 }
 
+//! Keeps the CSV buffers that the strings of a result vector point into pinned, for as long as the vector is alive
+class CSVStringVectorBuffer : public VectorBuffer {
+public:
+	explicit CSVStringVectorBuffer(vector<shared_ptr<CSVBufferHandle>> buffer_handles_p)
+	    : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), buffer_handles(std::move(buffer_handles_p)) {
+	}
+
+private:
+	vector<shared_ptr<CSVBufferHandle>> buffer_handles;
+};
+
 void StringValueScanner::Flush(DataChunk &insert_chunk) {
 	auto &process_result = ParseChunk();
 	// First Get Parsed Chunk
@@ -937,6 +961,7 @@ void StringValueScanner::Flush(DataChunk &insert_chunk) {
 	D_ASSERT(csv_file_scan);
 
 	auto &reader_data = csv_file_scan->reader_data;
+	buffer_ptr<VectorBuffer> csv_buffers;
 	// Now Do the cast-aroo
 	for (idx_t c = 0; c < reader_data.column_ids.size(); c++) {
 		idx_t col_idx = c;
@@ -955,6 +980,23 @@ void StringValueScanner::Flush(DataChunk &insert_chunk) {
 		    (type == LogicalType::VARCHAR || (type != LogicalType::VARCHAR && parse_type != LogicalType::VARCHAR))) {
 			// reinterpret rather than reference
 			result_vector.Reinterpret(parse_vector);
+			if (result_vector.GetType().InternalType() == PhysicalType::VARCHAR) {
+				// The strings are not copied: they point into the CSV buffers, or into the heap of the parse vector
+				// for values that had to be unescaped. The result keeps both alive instead of sharing the heap.
+				if (!csv_buffers) {
+					vector<shared_ptr<CSVBufferHandle>> pinned_buffers;
+					for (auto &buffer_handle : process_result.buffer_handles) {
+						pinned_buffers.push_back(buffer_handle.second);
+					}
+					csv_buffers = make_buffer<CSVStringVectorBuffer>(std::move(pinned_buffers));
+				}
+				auto parse_heap = result_vector.GetAuxiliary();
+				result_vector.SetAuxiliary(nullptr);
+				if (parse_heap) {
+					StringVector::AddBuffer(result_vector, std::move(parse_heap));
+				}
+				StringVector::AddBuffer(result_vector, csv_buffers);
+			}
 		} else {
 			string error_message;
 			idx_t line_error = 0;
@@ -1262,11 +1304,9 @@ void StringValueScanner::ProcessOverbufferValue() {
 		j++;
 	}
 	bool skip_value = false;
-	if (result.projecting_columns) {
-		if (!result.projected_columns[result.cur_col_id] && result.cur_col_id != result.number_of_columns) {
-			result.cur_col_id++;
-			skip_value = true;
-		}
+	if (result.IsSkippedColumn()) {
+		result.cur_col_id++;
+		skip_value = true;
 	}
 	if (!skip_value) {
 		string_t value;
@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/csv_scanner/csv_sniffer.hpp"
 #include "duckdb/common/types/value.hpp"
+#include "duckdb/execution/operator/csv_scanner/csv_sniffer_cache.hpp"
 
 namespace duckdb {
 
@@ -153,7 +154,16 @@ SnifferResult CSVSniffer::MinimalSniff() {
 }
 
 SnifferResult CSVSniffer::AdaptiveSniff(CSVSchema &file_schema) {
-	auto min_sniff_res = MinimalSniff();
+	auto &sniffer_cache = CSVSnifferCache::Get(buffer_manager->context);
+	auto cache_key = CSVSnifferCache::GetKey(*buffer_manager, options, "minimal");
+	SnifferResult min_sniff_res({}, {});
+	if (cache_key.empty() ||
+	    !sniffer_cache.TryGet(cache_key, options, min_sniff_res.return_types, min_sniff_res.names)) {
+		min_sniff_res = MinimalSniff();
+		if (!cache_key.empty() && !error_handler->AnyErrors() && !detection_error_handler->AnyErrors()) {
+			sniffer_cache.Insert(cache_key, options, min_sniff_res.return_types, min_sniff_res.names);
+		}
+	}
 	bool run_full = error_handler->AnyErrors() || detection_error_handler->AnyErrors();
 	// Check if we are happy with the result or if we need to do more sniffing
 	if (!error_handler->AnyErrors() && !detection_error_handler->AnyErrors()) {
@@ -179,6 +189,27 @@ SnifferResult CSVSniffer::AdaptiveSniff(CSVSchema &file_schema) {
 	return min_sniff_res;
 }
 SnifferResult CSVSniffer::SniffCSV(bool force_match) {
+	auto &sniffer_cache = CSVSnifferCache::Get(buffer_manager->context);
+	string sniff_type = force_match ? "full_match" : "full";
+	if (!default_null_to_varchar) {
+		sniff_type += "_null";
+	}
+	auto cache_key = CSVSnifferCache::GetKey(*buffer_manager, options, sniff_type);
+	if (cache_key.empty()) {
+		return SniffCSVInternal(force_match);
+	}
+	SnifferResult result({}, {});
+	if (sniffer_cache.TryGet(cache_key, options, result.return_types, result.names)) {
+		return result;
+	}
+	result = SniffCSVInternal(force_match);
+	if (!error_handler->AnyErrors()) {
+		sniffer_cache.Insert(cache_key, options, result.return_types, result.names);
+	}
+	return result;
+}
+
+SnifferResult CSVSniffer::SniffCSVInternal(bool force_match) {
 	buffer_manager->sniffing = true;
 	// 1. Dialect Detection
 	DetectDialect();
@@ -0,0 +1,72 @@
+#include "duckdb/execution/operator/csv_scanner/csv_sniffer_cache.hpp"
+
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/execution/operator/csv_scanner/csv_buffer_manager.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+
+namespace duckdb {
+
+CSVSnifferCache &CSVSnifferCache::Get(ClientContext &context) {
+	auto &cache = ObjectCache::GetObjectCache(context);
+	return *cache.GetOrCreate<CSVSnifferCache>(CSVSnifferCache::ObjectType());
+}
+
+static void AddToKey(string &key, const string &part) {
+	// prefix every part with its length, so the concatenation is unambiguous
+	key += to_string(part.size());
+	key += ':';
+	key += part;
+}
+
+string CSVSnifferCache::GetKey(CSVBufferManager &buffer_manager, const CSVReaderOptions &options,
+                               const string &sniff_type) {
+	auto &context = buffer_manager.context;
+	if (!DBConfig::GetConfig(context).options.enable_csv_sniffer_cache) {
+		return string();
+	}
+	auto &file_handle = *buffer_manager.file_handle;
+	if (!file_handle.OnDiskFile() || file_handle.IsPipe() ||
+	    file_handle.compression_type != FileCompressionType::UNCOMPRESSED) {
+		return string();
+	}
+	string key;
+	AddToKey(key, sniff_type);
+	AddToKey(key, buffer_manager.GetFilePath());
+	AddToKey(key, to_string(file_handle.FileSize()));
+	AddToKey(key, to_string(file_handle.GetLastModifiedTime()));
+	// timestamps with time zones are only detected when ICU is loaded
+	AddToKey(key, context.db->ExtensionIsLoaded("icu") ? "icu" : "");
+	MemoryStream stream;
+	BinarySerializer::Serialize(options, stream);
+	AddToKey(key, string(char_ptr_cast(stream.GetData()), stream.GetPosition()));
+	return key;
+}
+
+bool CSVSnifferCache::TryGet(const string &key, CSVReaderOptions &options, vector<LogicalType> &return_types,
+                             vector<string> &names) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(key);
+	if (entry == entries.end()) {
+		return false;
+	}
+	options = entry->second.options;
+	return_types = entry->second.return_types;
+	names = entry->second.names;
+	return true;
+}
+
+void CSVSnifferCache::Insert(const string &key, const CSVReaderOptions &options,
+                             const vector<LogicalType> &return_types, const vector<string> &names) {
+	lock_guard<mutex> guard(lock);
+	if (entries.size() >= MAXIMUM_ENTRIES) {
+		entries.clear();
+	}
+	auto &entry = entries[key];
+	entry.options = options;
+	entry.return_types = return_types;
+	entry.names = names;
+}
+
+} // namespace duckdb
@@ -9,61 +9,80 @@ namespace duckdb {
 
 class SampleGlobalSinkState : public GlobalSinkState {
 public:
-	explicit SampleGlobalSinkState(Allocator &allocator, SampleOptions &options) {
+	SampleGlobalSinkState() {
+	}
+
+	//! The lock for merging the thread-local samples into the global sample
+	mutex lock;
+	//! The reservoir sample
+	unique_ptr<BlockingSample> sample;
+	//! The number of thread-local samples that have been created
+	idx_t local_sample_count = 0;
+};
+
+class SampleLocalSinkState : public LocalSinkState {
+public:
+	SampleLocalSinkState(Allocator &allocator, SampleOptions &options, int64_t seed) {
 		if (options.is_percentage) {
 			auto percentage = options.sample_size.GetValue<double>();
 			if (percentage == 0) {
 				return;
 			}
-			sample = make_uniq<ReservoirSamplePercentage>(allocator, percentage, options.seed);
+			sample = make_uniq<ReservoirSamplePercentage>(allocator, percentage, seed);
 		} else {
 			auto size = NumericCast<idx_t>(options.sample_size.GetValue<int64_t>());
 			if (size == 0) {
 				return;
 			}
-			sample = make_uniq<ReservoirSample>(allocator, size, options.seed);
+			sample = make_uniq<ReservoirSample>(allocator, size, seed);
 		}
 	}
 
-	//! The lock for updating the global aggoregate state
-	//! Also used to update the global sample when percentages are used
-	mutex lock;
-	//! The reservoir sample
+	//! The thread-local reservoir sample
 	unique_ptr<BlockingSample> sample;
 };
 
 unique_ptr<GlobalSinkState> PhysicalReservoirSample::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<SampleGlobalSinkState>(Allocator::Get(context), *options);
+	return make_uniq<SampleGlobalSinkState>();
+}
+
+unique_ptr<LocalSinkState> PhysicalReservoirSample::GetLocalSinkState(ExecutionContext &context) const {
+	auto &gstate = sink_state->Cast<SampleGlobalSinkState>();
+	int64_t seed;
+	{
+		lock_guard<mutex> glock(gstate.lock);
+		// the first thread uses the seed itself, so a single-threaded sample is the same as a serial sample
+		// the other threads need different seeds, otherwise they would all draw the same random keys
+		auto local_idx = gstate.local_sample_count++;
+		seed = options->seed < 0 ? -1 : options->seed + NumericCast<int64_t>(local_idx);
+	}
+	return make_uniq<SampleLocalSinkState>(Allocator::Get(context.client), *options, seed);
 }
 
 SinkResultType PhysicalReservoirSample::Sink(ExecutionContext &context, DataChunk &chunk,
                                              OperatorSinkInput &input) const {
-	auto &global_state = input.global_state.Cast<SampleGlobalSinkState>();
-	// Percentage only has a global sample.
-	lock_guard<mutex> glock(global_state.lock);
-	if (!global_state.sample) {
-		// always gather full thread percentage
-		auto &allocator = Allocator::Get(context.client);
-		if (options->is_percentage) {
-			double percentage = options->sample_size.GetValue<double>();
-			if (percentage == 0) {
-				return SinkResultType::FINISHED;
-			}
-			global_state.sample = make_uniq<ReservoirSamplePercentage>(allocator, percentage, options->seed);
-		} else {
-			idx_t num_samples = options->sample_size.GetValue<idx_t>();
-			if (num_samples == 0) {
-				return SinkResultType::FINISHED;
-			}
-			global_state.sample = make_uniq<ReservoirSample>(allocator, num_samples, options->seed);
-		}
+	auto &local_state = input.local_state.Cast<SampleLocalSinkState>();
+	if (!local_state.sample) {
+		return SinkResultType::FINISHED;
 	}
-	global_state.sample->AddToReservoir(chunk);
+	local_state.sample->AddToReservoir(chunk);
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
 SinkCombineResultType PhysicalReservoirSample::Combine(ExecutionContext &context,
                                                        OperatorSinkCombineInput &input) const {
+	auto &global_state = input.global_state.Cast<SampleGlobalSinkState>();
+	auto &local_state = input.local_state.Cast<SampleLocalSinkState>();
+	if (!local_state.sample) {
+		return SinkCombineResultType::FINISHED;
+	}
+	// merge the thread-local sample into the global sample
+	lock_guard<mutex> glock(global_state.lock);
+	if (!global_state.sample) {
+		global_state.sample = std::move(local_state.sample);
+	} else {
+		global_state.sample->Merge(*local_state.sample);
+	}
 	return SinkCombineResultType::FINISHED;
 }
 
@@ -1,8 +1,10 @@
 #include "duckdb/execution/operator/helper/physical_reset.hpp"
 
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/execution/operator/helper/physical_set.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/plan_cache.hpp"
 
 namespace duckdb {
 
@@ -13,9 +15,11 @@ void PhysicalReset::ResetExtensionVariable(ExecutionContext &context, DBConfig &
 	}
 	if (scope == SetScope::GLOBAL) {
 		config.ResetOption(name);
+		PlanCache::Get(context.client).Evict(0);
 	} else {
 		auto &client_config = ClientConfig::GetConfig(context.client);
 		client_config.set_variables[name] = extension_option.default_value;
+		client_config.modified_settings = true;
 	}
 }
 
@@ -58,6 +62,7 @@ SourceResultType PhysicalReset::GetData(ExecutionContext &context, DataChunk &ch
 		}
 		auto &db = DatabaseInstance::GetDatabase(context.client);
 		config.ResetOption(&db, *option);
+		PlanCache::Get(db).Evict(0);
 		break;
 	}
 	case SetScope::SESSION:
@@ -65,6 +70,9 @@ SourceResultType PhysicalReset::GetData(ExecutionContext &context, DataChunk &ch
 			throw CatalogException("option \"%s\" cannot be reset locally", name);
 		}
 		option->reset_local(context.client);
+		if (PhysicalSet::AffectsPlans(name)) {
+			ClientConfig::GetConfig(context.client).modified_settings = true;
+		}
 		break;
 	default:
 		throw InternalException("Unsupported SetScope for variable");
@@ -3,6 +3,7 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/plan_cache.hpp"
 
 namespace duckdb {
 
@@ -16,12 +17,19 @@ void PhysicalSet::SetExtensionVariable(ClientContext &context, ExtensionOption &
 	}
 	if (scope == SetScope::GLOBAL) {
 		config.SetOption(name, std::move(target_value));
+		PlanCache::Get(context).Evict(0);
 	} else {
 		auto &client_config = ClientConfig::GetConfig(context);
 		client_config.set_variables[name] = std::move(target_value);
+		client_config.modified_settings = true;
 	}
 }
 
+bool PhysicalSet::AffectsPlans(const string &name) {
+	// the search path is part of the key of the plan cache
+	return !StringUtil::CIEquals(name, "schema") && !StringUtil::CIEquals(name, "search_path");
+}
+
 SourceResultType PhysicalSet::GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const {
 	auto &config = DBConfig::GetConfig(context.client);
 	// check if we are allowed to change the configuration option
@@ -57,6 +65,8 @@ SourceResultType PhysicalSet::GetData(ExecutionContext &context, DataChunk &chun
 		auto &db = DatabaseInstance::GetDatabase(context.client);
 		auto &config = DBConfig::GetConfig(context.client);
 		config.SetOption(&db, *option, input_val);
+		// cached plans might depend on the previous value of the setting
+		PlanCache::Get(db).Evict(0);
 		break;
 	}
 	case SetScope::SESSION:
@@ -64,6 +74,9 @@ SourceResultType PhysicalSet::GetData(ExecutionContext &context, DataChunk &chun
 			throw CatalogException("option \"%s\" cannot be set locally", name);
 		}
 		option->set_local(context.client, input_val);
+		if (AffectsPlans(name)) {
+			ClientConfig::GetConfig(context.client).modified_settings = true;
+		}
 		break;
 	default:
 		throw InternalException("Unsupported SetScope for variable");
@@ -0,0 +1,285 @@
+#include "duckdb/execution/operator/join/hash_join_build_cache.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/common/enum_util.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/execution/operator/filter/physical_filter.hpp"
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
+
+namespace duckdb {
+
+HashJoinBuildCache &HashJoinBuildCache::Get(ClientContext &context) {
+	return Get(DatabaseInstance::GetDatabase(context));
+}
+
+HashJoinBuildCache &HashJoinBuildCache::Get(DatabaseInstance &db) {
+	return *db.GetObjectCache().GetOrCreate<HashJoinBuildCache>(HashJoinBuildCache::ObjectType());
+}
+
+//===--------------------------------------------------------------------===//
+// Fingerprint
+//===--------------------------------------------------------------------===//
+static void AddToFingerprint(HashJoinBuildCacheKey &key, const string &part) {
+	// prefix every part with its length, so the concatenation is unambiguous
+	key.fingerprint += to_string(part.size());
+	key.fingerprint += ':';
+	key.fingerprint += part;
+}
+
+template <class T>
+static void AddSerializedToFingerprint(HashJoinBuildCacheKey &key, const T &object) {
+	MemoryStream stream;
+	BinarySerializer::Serialize(object, stream);
+	AddToFingerprint(key, string(char_ptr_cast(stream.GetData()), stream.GetPosition()));
+}
+
+static void AddIndexesToFingerprint(HashJoinBuildCacheKey &key, const vector<idx_t> &indexes) {
+	AddToFingerprint(key, to_string(indexes.size()));
+	for (auto &index : indexes) {
+		AddToFingerprint(key, to_string(index));
+	}
+}
+
+static bool DependsOnTimeZone(const LogicalType &type) {
+	return type.id() == LogicalTypeId::TIMESTAMP_TZ || type.id() == LogicalTypeId::TIME_TZ;
+}
+
+static bool ExpressionIsCacheable(const Expression &expr) {
+	if (!expr.IsConsistent() || expr.HasParameter()) {
+		// the result of the expression can differ between queries
+		return false;
+	}
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_FUNCTION: {
+		auto &function = expr.Cast<BoundFunctionExpression>();
+		if (function.bind_info && !function.function.serialize) {
+			// the bind data does not end up in the fingerprint
+			return false;
+		}
+		break;
+	}
+	case ExpressionClass::BOUND_CAST: {
+		auto &cast = expr.Cast<BoundCastExpression>();
+		if (DependsOnTimeZone(cast.child->return_type) || DependsOnTimeZone(cast.return_type)) {
+			// the result of the cast depends on the settings of the client
+			return false;
+		}
+		break;
+	}
+	default:
+		break;
+	}
+	bool cacheable = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) {
+		if (!ExpressionIsCacheable(child)) {
+			cacheable = false;
+		}
+	});
+	return cacheable;
+}
+
+static bool AddExpressionToFingerprint(HashJoinBuildCacheKey &key, const Expression &expr) {
+	if (!ExpressionIsCacheable(expr)) {
+		return false;
+	}
+	AddSerializedToFingerprint(key, expr);
+	return true;
+}
+
+static bool AddTableScanToKey(ClientContext &context, const PhysicalTableScan &scan, HashJoinBuildCacheKey &key) {
+	if (scan.function.name != "seq_scan" || !scan.bind_data || scan.dynamic_filters) {
+		// we can only cache scans over DuckDB tables whose filters are known up front
+		return false;
+	}
+	auto &bind_data = scan.bind_data->Cast<TableScanBindData>();
+	if (bind_data.is_index_scan) {
+		return false;
+	}
+	auto &table = bind_data.table;
+	auto &catalog = table.ParentCatalog();
+	auto &transaction = DuckTransaction::Get(context, catalog);
+	if (transaction.ChangesMade()) {
+		// transaction-local changes are not visible to other transactions
+		return false;
+	}
+	auto last_change_commit = DuckTransactionManager::Get(catalog.GetAttached()).GetLastChangeCommit();
+	if (last_change_commit >= transaction.start_time) {
+		// there are committed changes that this transaction does not see
+		return false;
+	}
+
+	AddToFingerprint(key, catalog.GetName());
+	AddToFingerprint(key, table.schema.name);
+	AddToFingerprint(key, table.name);
+	AddIndexesToFingerprint(key, scan.column_ids);
+	AddIndexesToFingerprint(key, scan.projection_ids);
+	if (scan.table_filters) {
+		AddSerializedToFingerprint(key, *scan.table_filters);
+	}
+	key.tables.push_back(table.GetStorage().GetDataTableInfo());
+	key.commit_ids.push_back(last_change_commit);
+	return true;
+}
+
+static bool AddOperatorToKey(ClientContext &context, const PhysicalOperator &op, HashJoinBuildCacheKey &key) {
+	AddToFingerprint(key, PhysicalOperatorToString(op.type));
+	for (auto &type : op.types) {
+		AddSerializedToFingerprint(key, type);
+	}
+	switch (op.type) {
+	case PhysicalOperatorType::TABLE_SCAN:
+		if (!AddTableScanToKey(context, op.Cast<PhysicalTableScan>(), key)) {
+			return false;
+		}
+		break;
+	case PhysicalOperatorType::FILTER:
+		if (!AddExpressionToFingerprint(key, *op.Cast<PhysicalFilter>().expression)) {
+			return false;
+		}
+		break;
+	case PhysicalOperatorType::PROJECTION:
+		for (auto &expr : op.Cast<PhysicalProjection>().select_list) {
+			if (!AddExpressionToFingerprint(key, *expr)) {
+				return false;
+			}
+		}
+		break;
+	default:
+		// other operators are not (yet) supported
+		return false;
+	}
+	AddToFingerprint(key, to_string(op.children.size()));
+	for (auto &child : op.children) {
+		if (!AddOperatorToKey(context, *child, key)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+unique_ptr<HashJoinBuildCacheKey> HashJoinBuildCache::GetKey(ClientContext &context, const PhysicalHashJoin &op) {
+	switch (op.join_type) {
+	case JoinType::INNER:
+	case JoinType::LEFT:
+	case JoinType::SEMI:
+	case JoinType::ANTI:
+		break;
+	default:
+		// other join types write to the hash table while probing, or depend on state of the query (e.g., SINGLE)
+		return nullptr;
+	}
+	if (!op.delim_types.empty()) {
+		return nullptr;
+	}
+
+	auto key = make_uniq<HashJoinBuildCacheKey>();
+	try {
+		// the layout of the hash table
+		AddToFingerprint(*key, EnumUtil::ToString(op.join_type));
+		AddToFingerprint(*key, to_string(op.conditions.size()));
+		for (auto &condition : op.conditions) {
+			AddToFingerprint(*key, EnumUtil::ToString(condition.comparison));
+			AddSerializedToFingerprint(*key, condition.left->return_type);
+			if (!AddExpressionToFingerprint(*key, *condition.right)) {
+				return nullptr;
+			}
+		}
+		AddIndexesToFingerprint(*key, op.payload_column_idxs);
+		AddIndexesToFingerprint(*key, op.rhs_output_columns);
+		// the build side
+		if (!AddOperatorToKey(context, *op.children[1], *key)) {
+			return nullptr;
+		}
+	} catch (NotImplementedException &ex) {
+		// (part of) the build side cannot be serialized
+		return nullptr;
+	}
+	return key;
+}
+
+//===--------------------------------------------------------------------===//
+// Cache
+//===--------------------------------------------------------------------===//
+shared_ptr<JoinHashTable> HashJoinBuildCache::Lookup(const HashJoinBuildCacheKey &key) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(key.fingerprint);
+	if (entry == entries.end()) {
+		return nullptr;
+	}
+	auto &cache_entry = entry->second;
+	if (cache_entry.commit_ids != key.commit_ids) {
+		// the hash table was built from a different state of the data
+		return nullptr;
+	}
+	D_ASSERT(cache_entry.tables.size() == key.tables.size());
+	for (idx_t table_idx = 0; table_idx < key.tables.size(); table_idx++) {
+		if (cache_entry.tables[table_idx].lock() != key.tables[table_idx]) {
+			// the table was dropped (or its database was detached) and replaced by another table with the same name
+			return nullptr;
+		}
+	}
+	cache_entry.last_used = ++current_timestamp;
+	return cache_entry.hash_table;
+}
+
+void HashJoinBuildCache::Insert(ClientContext &context, const HashJoinBuildCacheKey &key,
+                                shared_ptr<JoinHashTable> hash_table, idx_t size, idx_t maximum_size) {
+	if (size > maximum_size) {
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(key.fingerprint);
+	if (entry != entries.end()) {
+		// replace the hash table that was built from a different state of the data
+		total_size -= entry->second.size;
+		entries.erase(entry);
+	}
+	EvictInternal(maximum_size - size);
+
+	CacheEntry cache_entry;
+	cache_entry.hash_table = std::move(hash_table);
+	for (auto &table : key.tables) {
+		cache_entry.tables.push_back(table);
+	}
+	cache_entry.commit_ids = key.commit_ids;
+	cache_entry.size = size;
+	// the cached hash table is no longer counted by the query that built it, but its memory is still in use
+	cache_entry.memory_state = TemporaryMemoryManager::Get(context).Register(context);
+	cache_entry.memory_state->SetMinimumReservation(size);
+	cache_entry.memory_state->SetRemainingSizeAndUpdateReservation(context, size);
+	cache_entry.last_used = ++current_timestamp;
+	entries.emplace(key.fingerprint, std::move(cache_entry));
+	total_size += size;
+}
+
+void HashJoinBuildCache::Evict(idx_t maximum_size) {
+	lock_guard<mutex> guard(lock);
+	EvictInternal(maximum_size);
+}
+
+void HashJoinBuildCache::EvictInternal(idx_t maximum_size) {
+	while (total_size > maximum_size) {
+		D_ASSERT(!entries.empty());
+		auto lru_entry = entries.begin();
+		for (auto it = entries.begin(); it != entries.end(); it++) {
+			if (it->second.last_used < lru_entry->second.last_used) {
+				lru_entry = it;
+			}
+		}
+		total_size -= lru_entry->second.size;
+		entries.erase(lru_entry);
+	}
+}
+
+} // namespace duckdb
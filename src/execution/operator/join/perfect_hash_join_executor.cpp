@@ -17,23 +17,56 @@ bool PerfectHashJoinExecutor::CanDoPerfectHashJoin() {
 //===--------------------------------------------------------------------===//
 // Build
 //===--------------------------------------------------------------------===//
-bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
-	// First, allocate memory for each build column
+static idx_t CountSetBits(uint64_t value) {
+	// see here: https://en.wikipedia.org/wiki/Hamming_weight
+	value = value - ((value >> 1) & 0x5555555555555555ULL);
+	value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+	value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (value * 0x0101010101010101ULL) >> 56;
+}
+
+bool PerfectHashJoinExecutor::BuildPerfectHashTable() {
+	for (idx_t key_idx = 0; key_idx < ht.equality_types.size(); key_idx++) {
+		if (perfect_join_statistics.build_min[key_idx].IsNull() ||
+		    perfect_join_statistics.build_max[key_idx].IsNull()) {
+			return false;
+		}
+	}
 	auto build_size = perfect_join_statistics.build_range + 1;
-	for (const auto &type : join.rhs_output_types) {
-		perfect_hash_table.emplace_back(type, build_size);
+	if (perfect_join_statistics.is_bitmap_indexed && ht.Count() * BITMAP_DENSITY_FACTOR < build_size) {
+		// the build side is too sparse, the bitmap would be (much) larger than the hash table
+		return false;
 	}
 
-	// and for duplicate_checking
-	bitmap_build_idx = make_unsafe_uniq_array_uninitialized<bool>(build_size);
-	memset(bitmap_build_idx.get(), 0, sizeof(bool) * build_size); // set false
+	// Allocate memory for duplicate checking
+	auto word_count = (build_size + 63) / 64;
+	bitmap_build_idx = make_unsafe_uniq_array_uninitialized<uint64_t>(word_count);
+	memset(bitmap_build_idx.get(), 0, sizeof(uint64_t) * word_count); // set false
 
 	// Now fill columns with build data
+	return FullScanHashTable();
+}
 
-	return FullScanHashTable(key_type);
+void PerfectHashJoinExecutor::InitializeBitmapRanks() {
+	auto word_count = (perfect_join_statistics.build_range + 1 + 63) / 64;
+	bitmap_ranks = make_unsafe_uniq_array_uninitialized<uint32_t>(word_count);
+	idx_t rank = 0;
+	for (idx_t word_idx = 0; word_idx < word_count; word_idx++) {
+		bitmap_ranks[word_idx] = NumericCast<uint32_t>(rank);
+		rank += CountSetBits(bitmap_build_idx[word_idx]);
+	}
+}
+
+idx_t PerfectHashJoinExecutor::GetPayloadIndex(idx_t slot) const {
+	if (!perfect_join_statistics.is_bitmap_indexed) {
+		return slot;
+	}
+	// the payload is stored for the occupied slots only: count the occupied slots that precede this one
+	auto word = bitmap_build_idx[slot / 64] & ((1ULL << (slot % 64)) - 1);
+	return bitmap_ranks[slot / 64] + CountSetBits(word);
 }
 
-bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
+bool PerfectHashJoinExecutor::FullScanHashTable() {
 	auto &data_collection = ht.GetDataCollection();
 
 	// TODO: In a parallel finalize: One should exclusively lock and each thread should do one part of the code below.
@@ -48,27 +81,50 @@ bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
 		key_count = ht.FillWithHTOffsets(join_ht_state, tuples_addresses);
 	}
 
-	// Scan the build keys in the hash table
-	Vector build_vector(key_type, key_count);
-	RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vector, key_count, 0);
-
-	// Now fill the selection vector using the build keys and create a sequential vector
-	// TODO: add check for fast pass when probe is part of build domain
-	SelectionVector sel_build(key_count + 1);
+	// Scan the build keys in the hash table and compute the slot of every tuple
+	auto slots = make_unsafe_uniq_array_uninitialized<idx_t>(key_count + 1);
+	memset(slots.get(), 0, sizeof(idx_t) * key_count);
 	SelectionVector sel_tuples(key_count + 1);
-	bool success = FillSelectionVectorSwitchBuild(build_vector, sel_build, sel_tuples, key_count);
+	idx_t tuple_count = key_count;
+	for (idx_t key_idx = 0; key_idx < ht.equality_types.size(); key_idx++) {
+		Vector build_vector(ht.equality_types[key_idx], key_count);
+		RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vector, key_count, key_idx);
+		auto &sel = key_idx == 0 ? *FlatVector::IncrementalSelectionVector() : sel_tuples;
+		tuple_count = ComputeSlots(build_vector, key_count, key_idx, slots.get(), sel, tuple_count, sel_tuples);
+	}
 
-	// early out
-	if (!success) {
-		return false;
+	// Now fill the selection vector using the slots, and check for duplicates
+	SelectionVector sel_build(key_count + 1);
+	for (idx_t i = 0; i < tuple_count; i++) {
+		auto slot = slots[sel_tuples.get_index(i)];
+		auto &word = bitmap_build_idx[slot / 64];
+		auto bit = 1ULL << (slot % 64);
+		if (word & bit) {
+			// early out
+			return false;
+		}
+		word |= bit;
+		unique_keys++;
+		sel_build.set_index(i, slot);
 	}
 	if (unique_keys == perfect_join_statistics.build_range + 1 && !ht.has_null) {
 		perfect_join_statistics.is_build_dense = true;
 	}
-	key_count = unique_keys; // do not consider keys out of the range
+	if (perfect_join_statistics.is_bitmap_indexed) {
+		InitializeBitmapRanks();
+		for (idx_t i = 0; i < tuple_count; i++) {
+			sel_build.set_index(i, GetPayloadIndex(sel_build.get_index(i)));
+		}
+	}
+
+	// Allocate memory for each build column: for every slot, or only for the occupied slots if bitmap-indexed
+	const auto build_size = perfect_join_statistics.is_bitmap_indexed ? MaxValue<idx_t>(unique_keys, 1)
+	                                                                   : perfect_join_statistics.build_range + 1;
+	for (const auto &type : join.rhs_output_types) {
+		perfect_hash_table.emplace_back(type, build_size);
+	}
 
 	// Full scan the remaining build columns and fill the perfect hash table
-	const auto build_size = perfect_join_statistics.build_range + 1;
 	for (idx_t i = 0; i < join.rhs_output_types.size(); i++) {
 		auto &vector = perfect_hash_table[i];
 		const auto output_col_idx = ht.output_columns[i];
@@ -77,65 +133,65 @@ bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
 			auto &col_mask = FlatVector::Validity(vector);
 			col_mask.Initialize(build_size);
 		}
-		data_collection.Gather(tuples_addresses, sel_tuples, key_count, output_col_idx, vector, sel_build, nullptr);
+		data_collection.Gather(tuples_addresses, sel_tuples, tuple_count, output_col_idx, vector, sel_build, nullptr);
 	}
 
 	return true;
 }
 
-bool PerfectHashJoinExecutor::FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec,
-                                                             SelectionVector &seq_sel_vec, idx_t count) {
+idx_t PerfectHashJoinExecutor::ComputeSlots(Vector &source, idx_t count, idx_t key_idx, idx_t slots[],
+                                            const SelectionVector &sel, idx_t sel_count,
+                                            SelectionVector &result_sel) {
 	switch (source.GetType().InternalType()) {
 	case PhysicalType::INT8:
-		return TemplatedFillSelectionVectorBuild<int8_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<int8_t>(source, count, key_idx, slots, sel, sel_count, result_sel);
 	case PhysicalType::INT16:
-		return TemplatedFillSelectionVectorBuild<int16_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<int16_t>(source, count, key_idx, slots, sel, sel_count, result_sel);
 	case PhysicalType::INT32:
-		return TemplatedFillSelectionVectorBuild<int32_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<int32_t>(source, count, key_idx, slots, sel, sel_count, result_sel);
 	case PhysicalType::INT64:
-		return TemplatedFillSelectionVectorBuild<int64_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<int64_t>(source, count, key_idx, slots, sel, sel_count, result_sel);
 	case PhysicalType::UINT8:
-		return TemplatedFillSelectionVectorBuild<uint8_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<uint8_t>(source, count, key_idx, slots, sel, sel_count, result_sel);
 	case PhysicalType::UINT16:
-		return TemplatedFillSelectionVectorBuild<uint16_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<uint16_t>(source, count, key_idx, slots, sel, sel_count, result_sel);
 	case PhysicalType::UINT32:
-		return TemplatedFillSelectionVectorBuild<uint32_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<uint32_t>(source, count, key_idx, slots, sel, sel_count, result_sel);
 	case PhysicalType::UINT64:
-		return TemplatedFillSelectionVectorBuild<uint64_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<uint64_t>(source, count, key_idx, slots, sel, sel_count, result_sel);
 	default:
 		throw NotImplementedException("Type not supported for perfect hash join");
 	}
 }
 
 template <typename T>
-bool PerfectHashJoinExecutor::TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec,
-                                                                SelectionVector &seq_sel_vec, idx_t count) {
-	if (perfect_join_statistics.build_min.IsNull() || perfect_join_statistics.build_max.IsNull()) {
-		return false;
-	}
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
+idx_t PerfectHashJoinExecutor::TemplatedComputeSlots(Vector &source, idx_t count, idx_t key_idx, idx_t slots[],
+                                                     const SelectionVector &sel, idx_t sel_count,
+                                                     SelectionVector &result_sel) {
+	auto min_value = perfect_join_statistics.build_min[key_idx].GetValueUnsafe<T>();
+	auto max_value = perfect_join_statistics.build_max[key_idx].GetValueUnsafe<T>();
+	auto stride = perfect_join_statistics.key_strides[key_idx];
+
 	UnifiedVectorFormat vector_data;
 	source.ToUnifiedFormat(count, vector_data);
-	auto data = reinterpret_cast<T *>(vector_data.data);
-	// generate the selection vector
-	for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-		auto data_idx = vector_data.sel->get_index(i);
+	auto data = UnifiedVectorFormat::GetData<T>(vector_data);
+	auto &validity_mask = vector_data.validity;
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < sel_count; ++i) {
+		auto row_idx = sel.get_index(i);
+		auto data_idx = vector_data.sel->get_index(row_idx);
+		if (!validity_mask.RowIsValid(data_idx)) {
+			continue;
+		}
 		auto input_value = data[data_idx];
-		// add index to selection vector if value in the range
+		// keep the row if the value is in the range
 		if (min_value <= input_value && input_value <= max_value) {
-			auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-			sel_vec.set_index(sel_idx, idx);
-			if (bitmap_build_idx[idx]) {
-				return false;
-			} else {
-				bitmap_build_idx[idx] = true;
-				unique_keys++;
-			}
-			seq_sel_vec.set_index(sel_idx++, i);
+			// subtract min value to get the position of the value in the range of this key
+			slots[row_idx] += static_cast<idx_t>(input_value - min_value) * stride;
+			result_sel.set_index(result_count++, row_idx);
 		}
 	}
-	return true;
+	return result_count;
 }
 
 //===--------------------------------------------------------------------===//
@@ -150,14 +206,14 @@ public:
 		}
 		build_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
 		probe_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
-		seq_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
+		slots = make_unsafe_uniq_array_uninitialized<idx_t>(STANDARD_VECTOR_SIZE);
 	}
 
 	DataChunk join_keys;
 	ExpressionExecutor probe_executor;
 	SelectionVector build_sel_vec;
 	SelectionVector probe_sel_vec;
-	SelectionVector seq_sel_vec;
+	unsafe_unique_array<idx_t> slots;
 };
 
 unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionContext &context) {
@@ -168,17 +224,30 @@ unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionCon
 OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionContext &context, DataChunk &input,
                                                                   DataChunk &result, OperatorState &state_p) {
 	auto &state = state_p.Cast<PerfectHashJoinState>();
-	// keeps track of how many probe keys have a match
-	idx_t probe_sel_count = 0;
 
 	// fetch the join keys from the chunk
 	state.join_keys.Reset();
 	state.probe_executor.Execute(input, state.join_keys);
-	// select the keys that are in the min-max range
-	auto &keys_vec = state.join_keys.data[0];
+	// select the keys that are in the min-max range, and compute their slots
 	auto keys_count = state.join_keys.size();
-	// todo: add check for fast pass when probe is part of build domain
-	FillSelectionVectorSwitchProbe(keys_vec, state.build_sel_vec, state.probe_sel_vec, keys_count, probe_sel_count);
+	memset(state.slots.get(), 0, sizeof(idx_t) * keys_count);
+	idx_t candidate_count = keys_count;
+	for (idx_t key_idx = 0; key_idx < state.join_keys.ColumnCount(); key_idx++) {
+		auto &sel = key_idx == 0 ? *FlatVector::IncrementalSelectionVector() : state.probe_sel_vec;
+		candidate_count = ComputeSlots(state.join_keys.data[key_idx], keys_count, key_idx, state.slots.get(), sel,
+		                               candidate_count, state.probe_sel_vec);
+	}
+	// keeps track of how many probe keys have a match
+	idx_t probe_sel_count = 0;
+	for (idx_t i = 0; i < candidate_count; i++) {
+		auto row_idx = state.probe_sel_vec.get_index(i);
+		auto slot = state.slots[row_idx];
+		// check for matches in the build
+		if (bitmap_build_idx[slot / 64] & (1ULL << (slot % 64))) {
+			state.build_sel_vec.set_index(probe_sel_count, GetPayloadIndex(slot));
+			state.probe_sel_vec.set_index(probe_sel_count++, row_idx);
+		}
+	}
 
 	// If build is dense and probe is in build's domain, just reference probe
 	if (perfect_join_statistics.is_build_dense && keys_count == probe_sel_count) {
@@ -198,87 +267,4 @@ OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionConte
 	return OperatorResultType::NEED_MORE_INPUT;
 }
 
-void PerfectHashJoinExecutor::FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                             SelectionVector &probe_sel_vec, idx_t count,
-                                                             idx_t &probe_sel_count) {
-	switch (source.GetType().InternalType()) {
-	case PhysicalType::INT8:
-		TemplatedFillSelectionVectorProbe<int8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT16:
-		TemplatedFillSelectionVectorProbe<int16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT32:
-		TemplatedFillSelectionVectorProbe<int32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT64:
-		TemplatedFillSelectionVectorProbe<int64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT8:
-		TemplatedFillSelectionVectorProbe<uint8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT16:
-		TemplatedFillSelectionVectorProbe<uint16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT32:
-		TemplatedFillSelectionVectorProbe<uint32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT64:
-		TemplatedFillSelectionVectorProbe<uint64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	default:
-		throw NotImplementedException("Type not supported");
-	}
-}
-
-template <typename T>
-void PerfectHashJoinExecutor::TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                                SelectionVector &probe_sel_vec, idx_t count,
-                                                                idx_t &probe_sel_count) {
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
-
-	UnifiedVectorFormat vector_data;
-	source.ToUnifiedFormat(count, vector_data);
-	auto data = reinterpret_cast<T *>(vector_data.data);
-	auto validity_mask = &vector_data.validity;
-	// build selection vector for non-dense build
-	if (validity_mask->AllValid()) {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
-		}
-	} else {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			if (!validity_mask->RowIsValid(data_idx)) {
-				continue;
-			}
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
-		}
-	}
-}
-
 } // namespace duckdb
@@ -1,12 +1,16 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
 #include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
+#include "duckdb/common/types/value_map.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/operator/aggregate/ungrouped_aggregate_state.hpp"
+#include "duckdb/execution/operator/join/hash_join_build_cache.hpp"
 #include "duckdb/function/aggregate/distributive_functions.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
 #include "duckdb/parallel/executor_task.hpp"
 #include "duckdb/parallel/interrupt.hpp"
@@ -14,7 +18,9 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -102,7 +108,9 @@ unique_ptr<JoinFilterGlobalState> JoinFilterPushdownInfo::GetGlobalState(ClientC
                                                                          const PhysicalOperator &op) const {
 	// clear any previously set filters
 	// we can have previous filters for this operator in case of e.g. recursive CTEs
-	dynamic_filters->ClearFilters(op);
+	for (auto &target : targets) {
+		target.dynamic_filters->ClearFilters(op);
+	}
 	auto result = make_uniq<JoinFilterGlobalState>();
 	result->global_aggregate_state =
 	    make_uniq<GlobalUngroupedAggregateState>(BufferAllocator::Get(context), min_max_aggregates);
@@ -115,13 +123,24 @@ public:
 	    : context(context_p), op(op_p),
 	      num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
 	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), finalized(false),
-	      active_local_states(0), total_size(0), max_partition_size(0), max_partition_count(0), scanned_data(false) {
-		hash_table = op.InitializeHashTable(context);
+	      active_local_states(0), total_size(0), max_partition_size(0), max_partition_count(0), scanned_data(false),
+	      cached_build(false) {
+		// For external hash join
+		external = ClientConfig::GetConfig(context).force_external;
+		// Check if we can use a cached hash table of an earlier query instead of building our own
+		if (!external && DBConfig::GetConfig(context).options.hash_join_build_cache_size > 0) {
+			build_cache_key = HashJoinBuildCache::GetKey(context, op);
+			if (build_cache_key) {
+				hash_table = HashJoinBuildCache::Get(context).Lookup(*build_cache_key);
+				cached_build = hash_table != nullptr;
+			}
+		}
+		if (!hash_table) {
+			hash_table = op.InitializeHashTable(context);
+		}
 
 		// For perfect hash join
 		perfect_join_executor = make_uniq<PerfectHashJoinExecutor>(op, *hash_table, op.perfect_join_statistics);
-		// For external hash join
-		external = ClientConfig::GetConfig(context).force_external;
 		// Set probe types
 		const auto &payload_types = op.children[0]->types;
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
@@ -144,8 +163,8 @@ public:
 	//! Temporary memory state for managing this operator's memory usage
 	unique_ptr<TemporaryMemoryState> temporary_memory_state;
 
-	//! Global HT used by the join
-	unique_ptr<JoinHashTable> hash_table;
+	//! Global HT used by the join (can be shared with other queries through the HashJoinBuildCache)
+	shared_ptr<JoinHashTable> hash_table;
 	//! The perfect hash join executor (if any)
 	unique_ptr<PerfectHashJoinExecutor> perfect_join_executor;
 	//! Whether or not the hash table has been finalized
@@ -170,6 +189,11 @@ public:
 	atomic<bool> scanned_data;
 
 	unique_ptr<JoinFilterGlobalState> global_filter_state;
+
+	//! The key of the build side in the HashJoinBuildCache (if it can be cached)
+	unique_ptr<HashJoinBuildCacheKey> build_cache_key;
+	//! Whether the (finalized) HT was obtained from the HashJoinBuildCache
+	bool cached_build;
 };
 
 unique_ptr<JoinFilterLocalState> JoinFilterPushdownInfo::GetLocalState(JoinFilterGlobalState &gstate) const {
@@ -288,7 +312,12 @@ void JoinFilterPushdownInfo::Sink(DataChunk &chunk, JoinFilterLocalState &lstate
 }
 
 SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
+	auto &gstate = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &lstate = input.local_state.Cast<HashJoinLocalSinkState>();
+	if (gstate.cached_build) {
+		// the HT was obtained from the cache, no need to read the build side
+		return SinkResultType::FINISHED;
+	}
 
 	// resolve the join keys for the right chunk
 	lstate.join_keys.Reset();
@@ -373,13 +402,39 @@ static idx_t GetPartitioningSpaceRequirement(ClientContext &context, const vecto
 	return num_threads * num_partitions * size_per_partition;
 }
 
+//! The expected I/O of an external hash join: partitions that do not fit in the reservation are spilled on both sides
+static vector<TemporaryMemoryCost> GetExternalHashJoinCostCurve(const idx_t build_size, const idx_t probe_size,
+                                                                 const idx_t partition_size) {
+	static constexpr idx_t MAXIMUM_COST_CURVE_POINTS = 32;
+	vector<TemporaryMemoryCost> result;
+	if (partition_size == 0 || build_size <= partition_size) {
+		return result;
+	}
+	const auto partition_count = (build_size + partition_size - 1) / partition_size;
+	const auto step = MaxValue<idx_t>(partition_count / MAXIMUM_COST_CURVE_POINTS, 1);
+	const auto total_io = 2 * static_cast<double>(build_size + probe_size);
+	for (idx_t partitions_in_memory = 0; partitions_in_memory < partition_count; partitions_in_memory += step) {
+		const auto spilled_ratio =
+		    static_cast<double>(partition_count - partitions_in_memory) / static_cast<double>(partition_count);
+		result.emplace_back(partitions_in_memory * partition_size, LossyNumericCast<idx_t>(spilled_ratio * total_io));
+	}
+	result.emplace_back(build_size, 0);
+	return result;
+}
+
 void PhysicalHashJoin::PrepareFinalize(ClientContext &context, GlobalSinkState &global_state) const {
 	auto &gstate = global_state.Cast<HashJoinGlobalSinkState>();
+	if (gstate.cached_build) {
+		return;
+	}
 	auto &ht = *gstate.hash_table;
 	gstate.total_size =
 	    ht.GetTotalSize(gstate.local_hash_tables, gstate.max_partition_size, gstate.max_partition_count);
 	bool all_constant;
-	gstate.temporary_memory_state->SetMaterializationPenalty(GetTupleWidth(children[0]->types, all_constant));
+	const auto probe_tuple_width = GetTupleWidth(children[0]->types, all_constant);
+	gstate.temporary_memory_state->SetMaterializationPenalty(probe_tuple_width);
+	gstate.temporary_memory_state->SetCostCurve(GetExternalHashJoinCostCurve(
+	    gstate.total_size, children[0]->estimated_cardinality * probe_tuple_width, gstate.max_partition_size));
 	gstate.temporary_memory_state->SetRemainingSize(gstate.total_size);
 }
 
@@ -446,6 +501,13 @@ public:
 	void FinishEvent() override {
 		sink.hash_table->GetDataCollection().VerifyEverythingPinned();
 		sink.hash_table->finalized = true;
+		if (sink.build_cache_key && !sink.external) {
+			// the in-memory HT is complete and read-only from here on, so other queries can use it as well
+			auto &config = DBConfig::GetConfig(sink.context);
+			HashJoinBuildCache::Get(sink.context)
+			    .Insert(sink.context, *sink.build_cache_key, sink.hash_table, sink.total_size,
+			            config.options.hash_join_build_cache_size);
+		}
 	}
 
 	static constexpr const idx_t PARALLEL_CONSTRUCT_THRESHOLD = 1048576;
@@ -560,7 +622,33 @@ public:
 	}
 };
 
-void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+static vector<value_set_t> GetBuildKeySets(JoinHashTable &ht, const vector<JoinFilterPushdownColumn> &filters) {
+	auto &data_collection = ht.GetDataCollection();
+	// the join keys are stored first in the HT layout, in order of the join conditions
+	vector<column_t> column_ids;
+	for (auto &filter : filters) {
+		column_ids.push_back(filter.join_condition);
+	}
+	vector<value_set_t> result(filters.size());
+	TupleDataScanState scan_state;
+	data_collection.InitializeScan(scan_state, column_ids);
+	DataChunk chunk;
+	data_collection.InitializeScanChunk(scan_state, chunk);
+	while (data_collection.Scan(scan_state, chunk)) {
+		for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+			for (idx_t row_idx = 0; row_idx < chunk.size(); row_idx++) {
+				auto value = chunk.GetValue(col_idx, row_idx);
+				if (!value.IsNull()) {
+					result[col_idx].insert(std::move(value));
+				}
+			}
+		}
+	}
+	return result;
+}
+
+void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, JoinHashTable &ht,
+                                         const PhysicalOperator &op) const {
 	// finalize the min/max aggregates
 	vector<LogicalType> min_max_types;
 	for (auto &aggr_expr : min_max_aggregates) {
@@ -571,10 +659,14 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 
 	gstate.global_aggregate_state->Finalize(final_min_max);
 
+	// if the build side is small, we collect the exact key sets so we can push down IN filters
+	vector<value_set_t> build_key_sets;
+	if (ht.Count() <= MAX_IN_FILTER_KEYS) {
+		build_key_sets = GetBuildKeySets(ht, filters);
+	}
+
 	// create a filter for each of the aggregates
 	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
-		auto &filter = filters[filter_idx];
-		auto filter_col_idx = filter.probe_column_index.column_index;
 		auto min_idx = filter_idx * 2;
 		auto max_idx = min_idx + 1;
 
@@ -589,17 +681,64 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 		if (Value::NotDistinctFrom(min_val, max_val)) {
 			// min = max - generate an equality filter
 			auto constant_filter = make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_val));
-			dynamic_filters->PushFilter(op, filter_col_idx, std::move(constant_filter));
+			PushFilter(op, filter_idx, std::move(constant_filter));
 		} else {
 			// min != max - generate a range filter
 			auto greater_equals =
 			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_val));
-			dynamic_filters->PushFilter(op, filter_col_idx, std::move(greater_equals));
+			PushFilter(op, filter_idx, std::move(greater_equals));
 			auto less_equals = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val));
-			dynamic_filters->PushFilter(op, filter_col_idx, std::move(less_equals));
+			PushFilter(op, filter_idx, std::move(less_equals));
+			if (!build_key_sets.empty()) {
+				// the range might be sparse: push the exact key set as well
+				// the range filters are evaluated first, so this only has to check the values within the range
+				vector<Value> in_values(build_key_sets[filter_idx].begin(), build_key_sets[filter_idx].end());
+				PushFilter(op, filter_idx, make_uniq<InFilter>(std::move(in_values)));
+			}
 		}
 		// not null filter
-		dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<IsNotNullFilter>());
+		PushFilter(op, filter_idx, make_uniq<IsNotNullFilter>());
+	}
+}
+
+void JoinFilterPushdownInfo::PushFilter(const PhysicalOperator &op, idx_t filter_idx,
+                                        unique_ptr<TableFilter> filter) const {
+	for (auto &target : targets) {
+		for (auto &column : target.columns) {
+			if (column.first == filter_idx) {
+				target.dynamic_filters->PushFilter(op, column.second, filter->Copy());
+			}
+		}
+	}
+}
+
+void JoinFilterPushdownInfo::PushBloomFilter(JoinHashTable &ht, const PhysicalOperator &op) const {
+	// the Bloom filter is built from the hashes in the HT, which combine all equality conditions
+	// we can only probe it with a single column if there is exactly one equality condition
+	if (ht.equality_types.size() != 1) {
+		return;
+	}
+	const auto ht_count = ht.Count();
+	if (ht_count <= MAX_IN_FILTER_KEYS) {
+		// we have pushed the exact key set already
+		return;
+	}
+	if (ht_count > MAX_BLOOM_FILTER_KEYS) {
+		// the Bloom filter would become too large to stay cache-resident while probing
+		return;
+	}
+	if (op.children[0]->estimated_cardinality < ht_count) {
+		// the probe side is (estimated to be) smaller than the build side - probing the filter does not pay off
+		return;
+	}
+	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
+		if (filters[filter_idx].join_condition != 0) {
+			continue;
+		}
+		if (!ht.bloom_filter) {
+			ht.bloom_filter = make_shared_ptr<BlockedBloomFilter>(ht_count);
+		}
+		PushFilter(op, filter_idx, make_uniq<BloomFilter>(ht.bloom_filter));
 	}
 }
 
@@ -608,6 +747,23 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
 
+	if (sink.cached_build) {
+		// the HT was obtained from the HashJoinBuildCache and has been finalized already
+		sink.local_hash_tables.clear();
+		sink.perfect_join_executor.reset();
+		sink.finalized = true;
+		return SinkFinalizeType::READY;
+	}
+
+	if (!build_feedback_key.empty()) {
+		// the build side is complete: remember its actual size for the next time this plan is optimized
+		auto build_count = ht.Count();
+		for (auto &local_ht : sink.local_hash_tables) {
+			build_count += local_ht->Count();
+		}
+		CardinalityFeedback::Get(context).RecordBuild(build_feedback_key, build_count);
+	}
+
 	sink.temporary_memory_state->UpdateReservation(context);
 	sink.external = sink.temporary_memory_state->GetReservation() < sink.total_size;
 	if (sink.external) {
@@ -646,19 +802,21 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	ht.Unpartition();
 
 	if (filter_pushdown && ht.Count() > 0) {
-		filter_pushdown->PushFilters(*sink.global_filter_state, *this);
+		filter_pushdown->PushFilters(*sink.global_filter_state, ht, *this);
 	}
 
 	// check for possible perfect hash table
 	auto use_perfect_hash = sink.perfect_join_executor->CanDoPerfectHashJoin();
 	if (use_perfect_hash) {
-		D_ASSERT(ht.equality_types.size() == 1);
-		auto key_type = ht.equality_types[0];
-		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable(key_type);
+		D_ASSERT(ht.equality_types.size() == perfect_join_statistics.build_min.size());
+		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable();
 	}
 	// In case of a large build side or duplicates, use regular hash join
 	if (!use_perfect_hash) {
 		sink.perfect_join_executor.reset();
+		if (filter_pushdown && ht.Count() > 0) {
+			filter_pushdown->PushBloomFilter(ht, *this);
+		}
 		sink.ScheduleFinalize(pipeline, event);
 	}
 	sink.finalized = true;
@@ -947,6 +1105,8 @@ void HashJoinGlobalSourceState::PrepareBuild(HashJoinGlobalSinkState &sink) {
 	D_ASSERT(global_stage != HashJoinSourceStage::BUILD);
 	auto &ht = *sink.hash_table;
 
+	// The probe side has been partitioned, the reservation now only determines how many partitions we build at once
+	sink.temporary_memory_state->SetCostCurve({});
 	// Update remaining size
 	sink.temporary_memory_state->SetRemainingSizeAndUpdateReservation(sink.context, ht.GetRemainingSize());
 
@@ -1251,8 +1411,12 @@ InsertionOrderPreservingMap<string> PhysicalHashJoin::ParamsToString() const {
 
 	if (perfect_join_statistics.is_build_small) {
 		// perfect hash join
-		result["Build Min"] = perfect_join_statistics.build_min.ToString();
-		result["Build Max"] = perfect_join_statistics.build_max.ToString();
+		auto &build_min = perfect_join_statistics.build_min;
+		auto &build_max = perfect_join_statistics.build_max;
+		result["Build Min"] =
+		    StringUtil::Join(build_min, build_min.size(), ", ", [](const Value &value) { return value.ToString(); });
+		result["Build Max"] =
+		    StringUtil::Join(build_max, build_max.size(), ", ", [](const Value &value) { return value.ToString(); });
 	}
 	SetEstimatedCardinality(result, estimated_cardinality);
 	return result;
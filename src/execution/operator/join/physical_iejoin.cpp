@@ -9,6 +9,7 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/event.hpp"
 #include "duckdb/parallel/meta_pipeline.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/common/atomic.hpp"
@@ -156,6 +157,19 @@ SinkCombineResultType PhysicalIEJoin::Combine(ExecutionContext &context, Operato
 //===--------------------------------------------------------------------===//
 // Finalize
 //===--------------------------------------------------------------------===//
+idx_t PhysicalIEJoin::GetMaxPartitionSize(ClientContext &context, idx_t count) {
+	// The sorted blocks are range partitions on the first inequality, and every pair of partitions that can produce
+	// matches is joined by a single thread. Roughly half of the pairs produce matches for typical range joins
+	// (e.g., between overlapping intervals), so we want at least sqrt(2 * threads) partitions on each side.
+	const auto num_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	idx_t partition_count = 1;
+	while (partition_count * partition_count < 2 * num_threads) {
+		partition_count++;
+	}
+	// Every pair is sorted again, so smaller partitions add work: only split if the partitions stay large
+	return MaxValue<idx_t>((count + partition_count - 1) / partition_count, MIN_PARTITION_SIZE);
+}
+
 SinkFinalizeType PhysicalIEJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                           OperatorSinkFinalizeInput &input) const {
 	auto &gstate = input.global_state.Cast<IEJoinGlobalState>();
@@ -172,7 +186,7 @@ SinkFinalizeType PhysicalIEJoin::Finalize(Pipeline &pipeline, Event &event, Clie
 	}
 
 	// Sort the current input child
-	table.Finalize(pipeline, event);
+	table.Finalize(pipeline, event, GetMaxPartitionSize(context, table.Count()));
 
 	// Move to the next input child
 	++gstate.child;
@@ -234,6 +248,10 @@ struct IEJoinUnion {
 		return result;
 	}
 
+	//! Whether the blocks can produce any matches for the first inequality
+	static bool BlocksOverlap(const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1, SortedTable &t2,
+	                          const idx_t b2);
+
 	IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1, SortedTable &t2,
 	            const idx_t b2);
 
@@ -344,6 +362,22 @@ idx_t IEJoinUnion::AppendKey(SortedTable &table, ExpressionExecutor &executor, S
 	return inserted;
 }
 
+bool IEJoinUnion::BlocksOverlap(const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1, SortedTable &t2,
+                                const idx_t b2) {
+	if (!t1.BlockSize(b1) || !t2.BlockSize(b2)) {
+		return false;
+	}
+
+	const auto &cmp1 = op.conditions[0].comparison;
+	SBIterator bounds1(t1.global_sort_state, cmp1);
+	SBIterator bounds2(t2.global_sort_state, cmp1);
+
+	// t1.X[0] op1 t2.X'[-1]
+	bounds1.SetIndex(bounds1.block_capacity * b1);
+	bounds2.SetIndex(bounds2.block_capacity * b2 + t2.BlockSize(b2) - 1);
+	return bounds1.Compare(bounds2);
+}
+
 IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1,
                          SortedTable &t2, const idx_t b2)
     : n(0), i(0) {
@@ -353,20 +387,11 @@ IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, Sorte
 	// We only join the two block numbers and use the sizes of the blocks as the counts
 
 	// 0. Filter out tables with no overlap
-	if (!t1.BlockSize(b1) || !t2.BlockSize(b2)) {
+	if (!BlocksOverlap(op, t1, b1, t2, b2)) {
 		return;
 	}
 
 	const auto &cmp1 = op.conditions[0].comparison;
-	SBIterator bounds1(t1.global_sort_state, cmp1);
-	SBIterator bounds2(t2.global_sort_state, cmp1);
-
-	// t1.X[0] op1 t2.X'[-1]
-	bounds1.SetIndex(bounds1.block_capacity * b1);
-	bounds2.SetIndex(bounds2.block_capacity * b2 + t2.BlockSize(b2) - 1);
-	if (!bounds1.Compare(bounds2)) {
-		return;
-	}
 
 	// 1. let L1 (resp. L2) be the array of column X (resp. Y )
 	const auto &order1 = op.lhs_orders[0];
@@ -820,6 +845,16 @@ public:
 			right_base += right_table.BlockSize(rhs);
 		}
 
+		// Only the block pairs that overlap on the first inequality have to be joined,
+		// so every thread can pick up a pair that will do actual work
+		for (idx_t lhs = 0; lhs < left_blocks; ++lhs) {
+			for (idx_t rhs = 0; rhs < right_blocks; ++rhs) {
+				if (IEJoinUnion::BlocksOverlap(op, left_table, lhs, right_table, rhs)) {
+					pairs.emplace_back(lhs, rhs);
+				}
+			}
+		}
+
 		// Outer join block counts
 		if (left_table.found_match) {
 			left_outers = left_blocks;
@@ -835,24 +870,22 @@ public:
 
 public:
 	idx_t MaxThreads() override {
-		// We can't leverage any more threads than block pairs.
-		const auto &sink_state = (op.sink_state->Cast<IEJoinGlobalState>());
-		return sink_state.tables[0]->BlockCount() * sink_state.tables[1]->BlockCount();
+		// We can't leverage any more threads than overlapping block pairs (or outer blocks).
+		Initialize();
+		return MaxValue<idx_t>(pairs.size(), MaxValue(left_outers.load(), right_outers.load()));
 	}
 
 	void GetNextPair(ClientContext &client, IEJoinLocalSourceState &lstate) {
 		auto &left_table = *gsink.tables[0];
 		auto &right_table = *gsink.tables[1];
 
-		const auto left_blocks = left_table.BlockCount();
-		const auto right_blocks = right_table.BlockCount();
-		const auto pair_count = left_blocks * right_blocks;
+		const auto pair_count = pairs.size();
 
 		// Regular block
 		const auto i = next_pair++;
 		if (i < pair_count) {
-			const auto b1 = i / right_blocks;
-			const auto b2 = i % right_blocks;
+			const auto b1 = pairs[i].first;
+			const auto b2 = pairs[i].second;
 
 			lstate.left_block_index = b1;
 			lstate.left_base = left_bases[b1];
@@ -912,12 +945,10 @@ public:
 	}
 
 	double GetProgress() const {
-		auto &left_table = *gsink.tables[0];
-		auto &right_table = *gsink.tables[1];
-
-		const auto left_blocks = left_table.BlockCount();
-		const auto right_blocks = right_table.BlockCount();
-		const auto pair_count = left_blocks * right_blocks;
+		if (!initialized) {
+			return 0;
+		}
+		const auto pair_count = pairs.size();
 
 		const auto count = pair_count + left_outers + right_outers;
 
@@ -931,7 +962,7 @@ public:
 	const PhysicalIEJoin &op;
 	IEJoinGlobalState &gsink;
 
-	bool initialized;
+	atomic<bool> initialized;
 
 	// Join queue state
 	atomic<size_t> next_pair;
@@ -941,6 +972,9 @@ public:
 	vector<idx_t> left_bases;
 	vector<idx_t> right_bases;
 
+	// The (left, right) block pairs that have to be joined
+	vector<std::pair<idx_t, idx_t>> pairs;
+
 	// Outer joins
 	atomic<idx_t> left_outers;
 	atomic<idx_t> next_left;
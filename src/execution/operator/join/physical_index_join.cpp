@@ -0,0 +1,203 @@
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
+
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/enum_util.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+PhysicalIndexJoin::PhysicalIndexJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> outer,
+                                     unique_ptr<PhysicalOperator> inner, unique_ptr<Expression> outer_key_p,
+                                     TableCatalogEntry &table, ART &index, vector<column_t> fetch_ids_p,
+                                     vector<LogicalType> fetch_types_p, idx_t inner_column_count,
+                                     vector<idx_t> outer_projection_map_p, bool outer_first,
+                                     idx_t estimated_cardinality)
+    : PhysicalJoin(op, PhysicalOperatorType::INDEX_JOIN, JoinType::INNER, estimated_cardinality),
+      outer_key(std::move(outer_key_p)), table(table), index(index), fetch_ids(std::move(fetch_ids_p)),
+      fetch_types(std::move(fetch_types_p)), inner_column_count(inner_column_count),
+      outer_projection_map(std::move(outer_projection_map_p)), outer_first(outer_first) {
+	children.push_back(std::move(outer));
+	children.push_back(std::move(inner));
+}
+
+//===--------------------------------------------------------------------===//
+// Operator
+//===--------------------------------------------------------------------===//
+class IndexJoinOperatorState : public CachingOperatorState {
+public:
+	IndexJoinOperatorState(ClientContext &context, const PhysicalIndexJoin &op)
+	    : executor(context, *op.outer_key), matches(STANDARD_VECTOR_SIZE), outer_sel(STANDARD_VECTOR_SIZE),
+	      fetch_sel(STANDARD_VECTOR_SIZE), global_positions(STANDARD_VECTOR_SIZE),
+	      local_positions(STANDARD_VECTOR_SIZE) {
+		auto &allocator = Allocator::Get(context);
+		join_keys.Initialize(allocator, vector<LogicalType> {op.outer_key->return_type});
+		fetch_chunk.Initialize(allocator, op.fetch_types);
+		local_fetch_chunk.Initialize(allocator, op.fetch_types);
+		candidate_outer.resize(STANDARD_VECTOR_SIZE);
+		global_row_ids.resize(STANDARD_VECTOR_SIZE);
+		local_row_ids.resize(STANDARD_VECTOR_SIZE);
+
+		// rows appended by this transaction are not in the index of the table, but in the index of its local storage
+		auto &storage = op.table.GetStorage();
+		auto &local_storage = LocalStorage::Get(context, op.table.catalog);
+		if (local_storage.Find(storage)) {
+			local_storage.GetIndexes(storage).ScanBound<ART>([&](ART &art) {
+				if (art.GetIndexName() == op.index.GetIndexName()) {
+					local_index = &art;
+					return true;
+				}
+				return false;
+			});
+		}
+	}
+
+	ExpressionExecutor executor;
+	DataChunk join_keys;
+	//! The row ids matching each row of the input
+	vector<unsafe_vector<row_t>> matches;
+	//! Whether we probed the index for the current input
+	bool probed = false;
+	//! The position of the next match to output
+	idx_t outer_idx = 0;
+	idx_t match_idx = 0;
+
+	//! The outer row of each match we fetch
+	unsafe_vector<idx_t> candidate_outer;
+	//! The row ids to fetch from the table and its local storage, and the positions of their matches
+	unsafe_vector<row_t> global_row_ids;
+	unsafe_vector<row_t> local_row_ids;
+	SelectionVector outer_sel;
+	SelectionVector fetch_sel;
+	SelectionVector global_positions;
+	SelectionVector local_positions;
+
+	DataChunk fetch_chunk;
+	DataChunk local_fetch_chunk;
+	ColumnFetchState fetch_state;
+	//! The index of the transaction-local storage, if any
+	optional_ptr<ART> local_index;
+
+public:
+	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
+		context.thread.profiler.Flush(op);
+	}
+};
+
+unique_ptr<OperatorState> PhysicalIndexJoin::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<IndexJoinOperatorState>(context.client, *this);
+}
+
+OperatorResultType PhysicalIndexJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                      GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<IndexJoinOperatorState>();
+	auto &storage = table.GetStorage();
+	auto &transaction = DuckTransaction::Get(context.client, table.catalog);
+
+	if (!state.probed) {
+		// probe the index with all join keys of the input at once
+		state.join_keys.Reset();
+		state.executor.Execute(input, state.join_keys);
+		for (idx_t i = 0; i < input.size(); i++) {
+			state.matches[i].clear();
+		}
+		index.LookupRowIds(state.join_keys, state.matches);
+		if (state.local_index) {
+			state.local_index->LookupRowIds(state.join_keys, state.matches);
+		}
+		state.probed = true;
+		state.outer_idx = 0;
+		state.match_idx = 0;
+	}
+
+	// collect the next matches, and split them into rows of the table and rows of its local storage
+	idx_t global_count = 0;
+	idx_t local_count = 0;
+	idx_t candidate_count = 0;
+	while (candidate_count < STANDARD_VECTOR_SIZE && state.outer_idx < input.size()) {
+		auto &row_ids = state.matches[state.outer_idx];
+		if (state.match_idx == row_ids.size()) {
+			state.outer_idx++;
+			state.match_idx = 0;
+			continue;
+		}
+		auto row_id = row_ids[state.match_idx++];
+		if (row_id < MAX_ROW_ID) {
+			state.global_row_ids[global_count] = row_id;
+			state.global_positions.set_index(global_count++, candidate_count);
+		} else {
+			state.local_row_ids[local_count] = row_id;
+			state.local_positions.set_index(local_count++, candidate_count);
+		}
+		state.candidate_outer[candidate_count++] = state.outer_idx;
+	}
+
+	// fetch the matching rows: rows that are not visible to this transaction are skipped
+	idx_t result_count = 0;
+	state.fetch_chunk.Reset();
+	if (global_count > 0) {
+		Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(state.global_row_ids.data()));
+		storage.Fetch(transaction, state.fetch_chunk, fetch_ids, row_ids, global_count, state.fetch_state,
+		              state.fetch_sel);
+		for (idx_t i = 0; i < state.fetch_chunk.size(); i++) {
+			auto candidate_idx = state.global_positions.get_index(state.fetch_sel.get_index(i));
+			state.outer_sel.set_index(result_count++, state.candidate_outer[candidate_idx]);
+		}
+	}
+	if (local_count > 0) {
+		state.local_fetch_chunk.Reset();
+		Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(state.local_row_ids.data()));
+		auto &local_storage = LocalStorage::Get(transaction);
+		local_storage.FetchChunk(storage, row_ids, local_count, fetch_ids, state.local_fetch_chunk, state.fetch_state,
+		                         state.fetch_sel);
+		for (idx_t i = 0; i < state.local_fetch_chunk.size(); i++) {
+			auto candidate_idx = state.local_positions.get_index(state.fetch_sel.get_index(i));
+			state.outer_sel.set_index(result_count++, state.candidate_outer[candidate_idx]);
+		}
+		state.fetch_chunk.Append(state.local_fetch_chunk);
+	}
+	D_ASSERT(state.fetch_chunk.size() == result_count);
+
+	// construct the result from the outer rows and the fetched rows
+	auto outer_column_count = outer_projection_map.empty() ? input.ColumnCount() : outer_projection_map.size();
+	auto outer_offset = outer_first ? 0 : inner_column_count;
+	auto inner_offset = outer_first ? outer_column_count : 0;
+	for (idx_t i = 0; i < outer_column_count; i++) {
+		auto column_idx = outer_projection_map.empty() ? i : outer_projection_map[i];
+		chunk.data[outer_offset + i].Slice(input.data[column_idx], state.outer_sel, result_count);
+	}
+	for (idx_t i = 0; i < inner_column_count; i++) {
+		chunk.data[inner_offset + i].Reference(state.fetch_chunk.data[i]);
+	}
+	chunk.SetCardinality(result_count);
+
+	if (state.outer_idx < input.size()) {
+		return OperatorResultType::HAVE_MORE_OUTPUT;
+	}
+	state.probed = false;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+InsertionOrderPreservingMap<string> PhysicalIndexJoin::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	result["Join Type"] = EnumUtil::ToString(join_type);
+	result["Table"] = table.name;
+	result["Index"] = index.GetIndexName();
+	result["Conditions"] = StringUtil::Format("%s = %s", outer_key->GetName(), index.unbound_expressions[0]->GetName());
+	SetEstimatedCardinality(result, estimated_cardinality);
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Pipeline Construction
+//===--------------------------------------------------------------------===//
+void PhysicalIndexJoin::BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) {
+	PhysicalJoin::BuildJoinPipelines(current, meta_pipeline, *this, false);
+}
+
+} // namespace duckdb
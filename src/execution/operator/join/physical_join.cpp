@@ -28,6 +28,14 @@ bool PhysicalJoin::EmptyResultIfRHSIsEmpty() const {
 //===--------------------------------------------------------------------===//
 // Pipeline Construction
 //===--------------------------------------------------------------------===//
+static bool TransfersFiltersIntoBuildSides(const PhysicalOperator &op) {
+	if (op.type != PhysicalOperatorType::HASH_JOIN) {
+		return false;
+	}
+	auto &hash_join = op.Cast<PhysicalHashJoin>();
+	return hash_join.filter_pushdown && hash_join.filter_pushdown->transfers_into_build_sides;
+}
+
 void PhysicalJoin::BuildJoinPipelines(Pipeline &current, MetaPipeline &meta_pipeline, PhysicalOperator &op,
                                       bool build_rhs) {
 	op.op_state.reset();
@@ -48,10 +56,11 @@ void PhysicalJoin::BuildJoinPipelines(Pipeline &current, MetaPipeline &meta_pipe
 		// on the RHS (build side), we construct a child MetaPipeline with this operator as its sink
 		auto &child_meta_pipeline = meta_pipeline.CreateChildMetaPipeline(current, op, MetaPipelineType::JOIN_BUILD);
 		child_meta_pipeline.Build(*op.children[1]);
-		if (op.children[1]->CanSaturateThreads(current.GetClientContext())) {
+		if (op.children[1]->CanSaturateThreads(current.GetClientContext()) || TransfersFiltersIntoBuildSides(op)) {
 			// if the build side can saturate all available threads,
 			// we don't just make the LHS pipeline depend on the RHS, but recursively all LHS children too.
 			// this prevents breadth-first plan evaluation
+			// we do the same if the join pushes filters into scans of LHS children, so these scans are filtered
 			child_meta_pipeline.GetPipelines(dependencies, false);
 			last_child_ptr = meta_pipeline.GetLastChild();
 		}
@@ -0,0 +1,411 @@
+#include "duckdb/execution/operator/join/physical_merge_join.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/types/string_heap.hpp"
+#include "duckdb/core_functions/create_sort_key.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+
+namespace duckdb {
+
+PhysicalMergeJoin::PhysicalMergeJoin(LogicalComparisonJoin &op, unique_ptr<PhysicalOperator> left,
+                                     unique_ptr<PhysicalOperator> right, vector<JoinCondition> cond,
+                                     vector<OrderType> key_orders_p, idx_t estimated_cardinality)
+    : PhysicalComparisonJoin(op, PhysicalOperatorType::MERGE_JOIN, std::move(cond), JoinType::INNER,
+                             estimated_cardinality),
+      key_orders(std::move(key_orders_p)) {
+	D_ASSERT(key_orders.size() == conditions.size());
+	children.push_back(std::move(left));
+	children.push_back(std::move(right));
+
+	left_projection_map = op.left_projection_map;
+	if (left_projection_map.empty()) {
+		for (idx_t i = 0; i < children[0]->types.size(); i++) {
+			left_projection_map.push_back(i);
+		}
+	}
+	right_projection_map = op.right_projection_map;
+	if (right_projection_map.empty()) {
+		for (idx_t i = 0; i < children[1]->types.size(); i++) {
+			right_projection_map.push_back(i);
+		}
+	}
+	for (auto &column : right_projection_map) {
+		rhs_types.push_back(children[1]->types[column]);
+	}
+	rhs_types.push_back(LogicalType::BLOB);
+}
+
+bool PhysicalMergeJoin::SupportsKeyType(const LogicalType &type) {
+	// the keys are compared through their sort keys, which are only equal if the values are equal
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::UHUGEINT:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::UUID:
+	case LogicalTypeId::BLOB:
+		return true;
+	case LogicalTypeId::VARCHAR:
+		return StringType::GetCollation(type).empty();
+	default:
+		// e.g. floating point values and intervals have different representations that compare equal
+		return false;
+	}
+}
+
+static vector<OrderModifiers> GetKeyModifiers(const PhysicalMergeJoin &op) {
+	vector<OrderModifiers> modifiers;
+	for (auto &order_type : op.key_orders) {
+		// rows with NULL keys never match, so the order of the NULLs does not matter
+		modifiers.emplace_back(order_type, OrderByNullType::NULLS_LAST);
+	}
+	return modifiers;
+}
+
+//! Creates the sort keys of the join keys, and selects the rows in which none of the join keys is NULL
+static idx_t CreateSortKeys(DataChunk &keys, const vector<OrderModifiers> &modifiers, Vector &sort_key,
+                            SelectionVector &sel) {
+	// start with a fresh vector, so the string data of the previous sort keys is released
+	sort_key.Initialize();
+	CreateSortKeyHelpers::CreateSortKey(keys, modifiers, sort_key);
+	sort_key.Flatten(keys.size());
+
+	vector<UnifiedVectorFormat> key_data(keys.ColumnCount());
+	for (idx_t col_idx = 0; col_idx < keys.ColumnCount(); col_idx++) {
+		keys.data[col_idx].ToUnifiedFormat(keys.size(), key_data[col_idx]);
+	}
+	idx_t count = 0;
+	for (idx_t i = 0; i < keys.size(); i++) {
+		bool has_null = false;
+		for (auto &data : key_data) {
+			if (!data.validity.RowIsValid(data.sel->get_index(i))) {
+				has_null = true;
+				break;
+			}
+		}
+		if (!has_null) {
+			sel.set_index(count++, i);
+		}
+	}
+	return count;
+}
+
+//! The merge relies on the order of the inputs: verify it while we are going through the keys anyway
+static void VerifySorted(const string_t keys[], const SelectionVector &sel, idx_t count) {
+	for (idx_t i = 1; i < count; i++) {
+		if (LessThan::Operation(keys[sel.get_index(i)], keys[sel.get_index(i - 1)])) {
+			throw InternalException("Merge join: the input is not sorted on the join keys");
+		}
+	}
+}
+
+static bool SortKeyLessThan(const string_t &a, const string_t &b) {
+	return LessThan::Operation(a, b);
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class MergeJoinLocalSinkState : public LocalSinkState {
+public:
+	MergeJoinLocalSinkState(ClientContext &context, const PhysicalMergeJoin &op)
+	    : executor(context), modifiers(GetKeyModifiers(op)), sort_key(LogicalType::BLOB), sel(STANDARD_VECTOR_SIZE) {
+		vector<LogicalType> key_types;
+		for (auto &cond : op.conditions) {
+			executor.AddExpression(*cond.right);
+			key_types.push_back(cond.right->return_type);
+		}
+		keys.Initialize(Allocator::Get(context), key_types);
+		materialized.InitializeEmpty(op.rhs_types);
+	}
+
+	//! The executor of the RHS keys
+	ExpressionExecutor executor;
+	DataChunk keys;
+	vector<OrderModifiers> modifiers;
+	Vector sort_key;
+	//! The rows with non-NULL keys
+	SelectionVector sel;
+	//! The chunk that is appended to the materialized RHS
+	DataChunk materialized;
+};
+
+class MergeJoinGlobalSinkState : public GlobalSinkState {
+public:
+	MergeJoinGlobalSinkState(ClientContext &context, const PhysicalMergeJoin &op) : rhs_data(context, op.rhs_types) {
+		rhs_data.InitializeAppend(append_state);
+	}
+
+	//! The materialized RHS (without the rows with NULL keys), in the order of the input
+	ColumnDataCollection rhs_data;
+	ColumnDataAppendState append_state;
+	//! The largest key that was sunk so far (sort keys are never empty)
+	string last_key;
+	//! The largest sort key in every chunk of the materialized RHS
+	vector<string_t> chunk_last_keys;
+	StringHeap key_heap;
+};
+
+unique_ptr<GlobalSinkState> PhysicalMergeJoin::GetGlobalSinkState(ClientContext &context) const {
+	return make_uniq<MergeJoinGlobalSinkState>(context, *this);
+}
+
+unique_ptr<LocalSinkState> PhysicalMergeJoin::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<MergeJoinLocalSinkState>(context.client, *this);
+}
+
+SinkResultType PhysicalMergeJoin::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
+	auto &gstate = input.global_state.Cast<MergeJoinGlobalSinkState>();
+	auto &lstate = input.local_state.Cast<MergeJoinLocalSinkState>();
+
+	lstate.keys.Reset();
+	lstate.executor.Execute(chunk, lstate.keys);
+	auto count = CreateSortKeys(lstate.keys, lstate.modifiers, lstate.sort_key, lstate.sel);
+	if (count == 0) {
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+
+	// this is not a parallel sink, so the chunks arrive in order
+	auto sort_keys = FlatVector::GetData<string_t>(lstate.sort_key);
+	VerifySorted(sort_keys, lstate.sel, count);
+	auto first_key = sort_keys[lstate.sel.get_index(0)];
+	if (!gstate.last_key.empty() && SortKeyLessThan(first_key, string_t(gstate.last_key))) {
+		throw InternalException("Merge join: the input is not sorted on the join keys");
+	}
+	gstate.last_key = sort_keys[lstate.sel.get_index(count - 1)].GetString();
+
+	auto &materialized = lstate.materialized;
+	for (idx_t i = 0; i < right_projection_map.size(); i++) {
+		materialized.data[i].Reference(chunk.data[right_projection_map[i]]);
+	}
+	materialized.data[right_projection_map.size()].Reference(lstate.sort_key);
+	materialized.SetCardinality(chunk.size());
+	if (count < chunk.size()) {
+		materialized.Slice(lstate.sel, count);
+	}
+	gstate.rhs_data.Append(gstate.append_state, materialized);
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType PhysicalMergeJoin::Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const {
+	auto &client_profiler = QueryProfiler::Get(context.client);
+	context.thread.profiler.Flush(*this);
+	client_profiler.Flush(context.thread.profiler);
+	return SinkCombineResultType::FINISHED;
+}
+
+SinkFinalizeType PhysicalMergeJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                             OperatorSinkFinalizeInput &input) const {
+	auto &gstate = input.global_state.Cast<MergeJoinGlobalSinkState>();
+	if (gstate.rhs_data.Count() == 0) {
+		return SinkFinalizeType::NO_OUTPUT_POSSIBLE;
+	}
+
+	// remember the largest key of every chunk, so the LHS can find the chunk of a key with a binary search
+	const auto key_column = rhs_types.size() - 1;
+	ColumnDataScanState scan_state;
+	gstate.rhs_data.InitializeScan(scan_state, {key_column});
+	DataChunk sort_keys;
+	sort_keys.Initialize(context, {LogicalType::BLOB});
+	while (gstate.rhs_data.Scan(scan_state, sort_keys)) {
+		auto data = FlatVector::GetData<string_t>(sort_keys.data[0]);
+		gstate.chunk_last_keys.push_back(gstate.key_heap.AddBlob(data[sort_keys.size() - 1]));
+	}
+	D_ASSERT(gstate.chunk_last_keys.size() == gstate.rhs_data.ChunkCount());
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Operator
+//===--------------------------------------------------------------------===//
+class MergeJoinOperatorState : public CachingOperatorState {
+public:
+	MergeJoinOperatorState(ClientContext &context, const PhysicalMergeJoin &op)
+	    : executor(context), modifiers(GetKeyModifiers(op)), sort_key(LogicalType::BLOB), sel(STANDARD_VECTOR_SIZE) {
+		vector<LogicalType> key_types;
+		for (auto &cond : op.conditions) {
+			executor.AddExpression(*cond.left);
+			key_types.push_back(cond.left->return_type);
+		}
+		keys.Initialize(Allocator::Get(context), key_types);
+		rhs_chunk.Initialize(Allocator::Get(context), op.rhs_types);
+	}
+
+	//! The executor of the LHS keys
+	ExpressionExecutor executor;
+	DataChunk keys;
+	vector<OrderModifiers> modifiers;
+	Vector sort_key;
+	//! The rows of the input with non-NULL keys
+	SelectionVector sel;
+	idx_t count = 0;
+
+	//! Whether the keys of the current input have been computed
+	bool initialized = false;
+	//! The (non-NULL) row of the input that is being joined
+	idx_t lhs_idx = 0;
+	//! Whether the RHS rows of the current input row have been searched
+	bool positioned = false;
+	//! The first RHS row with a key that is not smaller than the key of the current input row
+	idx_t run_chunk = 0;
+	idx_t run_row = 0;
+	//! The next RHS row to compare with the current input row
+	idx_t scan_chunk = 0;
+	idx_t scan_row = 0;
+
+	//! The chunk of the materialized RHS that is loaded
+	idx_t loaded_chunk = DConstants::INVALID_INDEX;
+	DataChunk rhs_chunk;
+
+public:
+	void Load(MergeJoinGlobalSinkState &gstate, idx_t chunk_idx) {
+		rhs_chunk.Reset();
+		gstate.rhs_data.FetchChunk(chunk_idx, rhs_chunk);
+		loaded_chunk = chunk_idx;
+	}
+
+	const string_t *RHSKeys() {
+		auto &sort_keys = rhs_chunk.data.back();
+		D_ASSERT(sort_keys.GetVectorType() == VectorType::FLAT_VECTOR);
+		return FlatVector::GetData<string_t>(sort_keys);
+	}
+
+	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
+		context.thread.profiler.Flush(op);
+	}
+};
+
+unique_ptr<OperatorState> PhysicalMergeJoin::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<MergeJoinOperatorState>(context.client, *this);
+}
+
+OperatorResultType PhysicalMergeJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                      GlobalOperatorState &gstate_p, OperatorState &state_p) const {
+	auto &gstate = sink_state->Cast<MergeJoinGlobalSinkState>();
+	auto &state = state_p.Cast<MergeJoinOperatorState>();
+	auto &chunk_last_keys = gstate.chunk_last_keys;
+
+	if (!state.initialized) {
+		// every input chunk is sorted on its own, so the chunks can be joined in any order (and in parallel)
+		state.keys.Reset();
+		state.executor.Execute(input, state.keys);
+		state.count = CreateSortKeys(state.keys, state.modifiers, state.sort_key, state.sel);
+		VerifySorted(FlatVector::GetData<string_t>(state.sort_key), state.sel, state.count);
+		state.lhs_idx = 0;
+		state.positioned = false;
+		state.run_chunk = 0;
+		state.run_row = 0;
+		state.initialized = true;
+	}
+	auto lhs_keys = FlatVector::GetData<string_t>(state.sort_key);
+
+	SelectionVector lhs_sel(STANDARD_VECTOR_SIZE);
+	SelectionVector rhs_sel(STANDARD_VECTOR_SIZE);
+	idx_t result_count = 0;
+	bool have_more_output = false;
+	while (state.lhs_idx < state.count) {
+		const auto lhs_row = state.sel.get_index(state.lhs_idx);
+		const auto &lhs_key = lhs_keys[lhs_row];
+		if (!state.positioned) {
+			// the keys of the input are sorted: the matches of this row can not be before those of the previous row
+			auto previous_key = state.lhs_idx > 0 ? &lhs_keys[state.sel.get_index(state.lhs_idx - 1)] : nullptr;
+			if (!previous_key || !Equals::Operation(*previous_key, lhs_key)) {
+				auto entry = std::lower_bound(chunk_last_keys.begin() + NumericCast<int64_t>(state.run_chunk),
+				                              chunk_last_keys.end(), lhs_key, SortKeyLessThan);
+				if (entry == chunk_last_keys.end()) {
+					// all remaining keys are larger than the keys of the RHS
+					state.lhs_idx = state.count;
+					break;
+				}
+				const auto chunk_idx = NumericCast<idx_t>(entry - chunk_last_keys.begin());
+				if (chunk_idx != state.run_chunk) {
+					state.run_chunk = chunk_idx;
+					state.run_row = 0;
+				}
+				if (state.loaded_chunk != state.run_chunk) {
+					if (result_count > 0) {
+						// the result can only reference one RHS chunk
+						have_more_output = true;
+						break;
+					}
+					state.Load(gstate, state.run_chunk);
+				}
+				auto rhs_keys = state.RHSKeys();
+				auto begin = rhs_keys + state.run_row;
+				auto end = rhs_keys + state.rhs_chunk.size();
+				state.run_row += NumericCast<idx_t>(std::lower_bound(begin, end, lhs_key, SortKeyLessThan) - begin);
+				D_ASSERT(state.run_row < state.rhs_chunk.size());
+			}
+			state.scan_chunk = state.run_chunk;
+			state.scan_row = state.run_row;
+			state.positioned = true;
+		}
+
+		// emit the RHS rows with the same key
+		while (state.scan_chunk < chunk_last_keys.size()) {
+			if (state.loaded_chunk != state.scan_chunk) {
+				if (result_count > 0) {
+					have_more_output = true;
+					break;
+				}
+				state.Load(gstate, state.scan_chunk);
+			}
+			if (!Equals::Operation(state.RHSKeys()[state.scan_row], lhs_key)) {
+				break;
+			}
+			lhs_sel.set_index(result_count, lhs_row);
+			rhs_sel.set_index(result_count, state.scan_row);
+			result_count++;
+			if (++state.scan_row == state.rhs_chunk.size()) {
+				state.scan_chunk++;
+				state.scan_row = 0;
+			}
+			if (result_count == STANDARD_VECTOR_SIZE) {
+				have_more_output = true;
+				break;
+			}
+		}
+		if (have_more_output) {
+			break;
+		}
+		state.lhs_idx++;
+		state.positioned = false;
+	}
+
+	if (result_count > 0) {
+		const auto left_projected = left_projection_map.size();
+		for (idx_t i = 0; i < left_projected; i++) {
+			chunk.data[i].Slice(input.data[left_projection_map[i]], lhs_sel, result_count);
+		}
+		for (idx_t i = 0; i < right_projection_map.size(); i++) {
+			chunk.data[left_projected + i].Slice(state.rhs_chunk.data[i], rhs_sel, result_count);
+		}
+		chunk.SetCardinality(result_count);
+	}
+	if (have_more_output) {
+		return OperatorResultType::HAVE_MORE_OUTPUT;
+	}
+	state.initialized = false;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+} // namespace duckdb
@@ -0,0 +1,440 @@
+#include "duckdb/execution/operator/join/physical_multiway_join.hpp"
+
+#include "duckdb/common/enum_util.hpp"
+#include "duckdb/common/string_map_set.hpp"
+#include "duckdb/common/types/row/tuple_data_collection.hpp"
+#include "duckdb/common/types/string_heap.hpp"
+#include "duckdb/core_functions/create_sort_key.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/query_profiler.hpp"
+#include "duckdb/parallel/meta_pipeline.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
+
+namespace duckdb {
+
+PhysicalMultiwayJoin::PhysicalMultiwayJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> probe,
+                                           unique_ptr<PhysicalOperator> build_1, unique_ptr<PhysicalOperator> build_2,
+                                           vector<MultiwayJoinBuildKeys> build_keys_p,
+                                           vector<pair<idx_t, idx_t>> output_columns_p,
+                                           vector<string> condition_names_p, idx_t estimated_cardinality)
+    : PhysicalJoin(op, PhysicalOperatorType::MULTIWAY_JOIN, JoinType::INNER, estimated_cardinality),
+      build_keys(std::move(build_keys_p)), output_columns(std::move(output_columns_p)),
+      condition_names(std::move(condition_names_p)) {
+	D_ASSERT(build_keys.size() == 2);
+	D_ASSERT(output_columns.size() == types.size());
+	children.push_back(std::move(probe));
+	children.push_back(std::move(build_1));
+	children.push_back(std::move(build_2));
+}
+
+InsertionOrderPreservingMap<string> PhysicalMultiwayJoin::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	result["Join Type"] = EnumUtil::ToString(join_type);
+	result["Conditions"] = StringUtil::Join(condition_names, "\n");
+	SetEstimatedCardinality(result, estimated_cardinality);
+	return result;
+}
+
+idx_t PhysicalMultiwayJoin::EstimateBuildSize(const vector<LogicalType> &types, idx_t cardinality) {
+	TupleDataLayout layout;
+	layout.Initialize(types);
+	return cardinality * (layout.GetRowWidth() + TRIE_ENTRY_SIZE);
+}
+
+//! Selects the rows of the chunk in which none of the given columns is NULL
+static idx_t SelectValidRows(DataChunk &chunk, const vector<idx_t> &columns, SelectionVector &sel) {
+	vector<UnifiedVectorFormat> column_data(columns.size());
+	for (idx_t i = 0; i < columns.size(); i++) {
+		chunk.data[columns[i]].ToUnifiedFormat(chunk.size(), column_data[i]);
+	}
+	idx_t count = 0;
+	for (idx_t i = 0; i < chunk.size(); i++) {
+		bool has_null = false;
+		for (auto &data : column_data) {
+			if (!data.validity.RowIsValid(data.sel->get_index(i))) {
+				has_null = true;
+				break;
+			}
+		}
+		if (!has_null) {
+			sel.set_index(count++, i);
+		}
+	}
+	return count;
+}
+
+//! Creates the keys of a set of columns of an input
+//! The keys are sort keys, which are only equal if the values are equal, so they can be hashed and compared as blobs
+class MultiwayJoinKeys {
+public:
+	MultiwayJoinKeys(const vector<LogicalType> &input_types, const vector<idx_t> &columns_p)
+	    : columns(columns_p), sort_keys(LogicalType::BLOB) {
+		vector<LogicalType> key_types;
+		for (auto &column : columns) {
+			key_types.push_back(input_types[column]);
+			modifiers.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST);
+		}
+		key_chunk.InitializeEmpty(key_types);
+	}
+
+	vector<idx_t> columns;
+	vector<OrderModifiers> modifiers;
+	DataChunk key_chunk;
+	Vector sort_keys;
+
+public:
+	const string_t *Create(DataChunk &input) {
+		key_chunk.ReferenceColumns(input, columns);
+		// start with a fresh vector, so the string data of the previous keys is released
+		sort_keys.Initialize();
+		CreateSortKeyHelpers::CreateSortKey(key_chunk, modifiers, sort_keys);
+		sort_keys.Flatten(input.size());
+		return FlatVector::GetData<string_t>(sort_keys);
+	}
+};
+
+//! The rows of a build side, by their keys that are shared with the other build side
+using MultiwayJoinTrieNode = string_map_t<vector<data_ptr_t>>;
+
+//! A hash trie over the rows of a build side: by their keys that are shared with the probe side,
+//! and then by their keys that are shared with the other build side
+class MultiwayJoinTrie {
+public:
+	void Insert(const string_t &probe_key, const string_t &shared_key, data_ptr_t row) {
+		auto node_entry = nodes.find(probe_key);
+		if (node_entry == nodes.end()) {
+			node_entry = nodes.emplace(StoreKey(probe_key), MultiwayJoinTrieNode()).first;
+		}
+		auto &node = node_entry->second;
+		auto rows_entry = node.find(shared_key);
+		if (rows_entry == node.end()) {
+			rows_entry = node.emplace(StoreKey(shared_key), vector<data_ptr_t>()).first;
+		}
+		rows_entry->second.push_back(row);
+	}
+
+	optional_ptr<const MultiwayJoinTrieNode> Find(const string_t &probe_key) const {
+		auto entry = nodes.find(probe_key);
+		if (entry == nodes.end()) {
+			return nullptr;
+		}
+		return &entry->second;
+	}
+
+private:
+	string_t StoreKey(const string_t &key) {
+		return key.IsInlined() ? key : key_heap.AddBlob(key);
+	}
+
+private:
+	string_map_t<MultiwayJoinTrieNode> nodes;
+	//! The keys of the trie that are not inlined
+	StringHeap key_heap;
+};
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class MultiwayJoinGlobalSinkState : public GlobalSinkState {
+public:
+	MultiwayJoinGlobalSinkState(ClientContext &context, const PhysicalMultiwayJoin &op)
+	    : temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), tries(2) {
+		auto &buffer_manager = BufferManager::GetBufferManager(context);
+		for (idx_t i = 0; i < 2; i++) {
+			TupleDataLayout layout;
+			layout.Initialize(op.children[i + 1]->types);
+			data.push_back(make_uniq<TupleDataCollection>(buffer_manager, layout));
+		}
+	}
+
+	mutex lock;
+	//! The build side that is being sunk: the build sides are sunk (and finalized) one after the other
+	idx_t side = 0;
+	//! The materialized build sides (without the rows with NULL keys)
+	vector<unique_ptr<TupleDataCollection>> data;
+	//! The build sides stay in memory: their size is reserved here, so other operators spill instead
+	unique_ptr<TemporaryMemoryState> temporary_memory_state;
+	//! The hash tries over the rows of the build sides
+	vector<MultiwayJoinTrie> tries;
+};
+
+class MultiwayJoinLocalSinkState : public LocalSinkState {
+public:
+	MultiwayJoinLocalSinkState(ClientContext &context, const PhysicalMultiwayJoin &op,
+	                           MultiwayJoinGlobalSinkState &gstate)
+	    : side(gstate.side), sel(STANDARD_VECTOR_SIZE) {
+		D_ASSERT(side < 2);
+		auto &keys = op.build_keys[side];
+		key_columns = keys.build_columns;
+		key_columns.insert(key_columns.end(), keys.shared_columns.begin(), keys.shared_columns.end());
+		data = make_uniq<TupleDataCollection>(BufferManager::GetBufferManager(context), gstate.data[side]->GetLayout());
+		data->InitializeAppend(append_state);
+	}
+
+	//! The build side that is being sunk
+	idx_t side;
+	//! The key columns of the build side
+	vector<idx_t> key_columns;
+	//! The rows with non-NULL keys
+	SelectionVector sel;
+	unique_ptr<TupleDataCollection> data;
+	TupleDataAppendState append_state;
+};
+
+unique_ptr<GlobalSinkState> PhysicalMultiwayJoin::GetGlobalSinkState(ClientContext &context) const {
+	return make_uniq<MultiwayJoinGlobalSinkState>(context, *this);
+}
+
+unique_ptr<LocalSinkState> PhysicalMultiwayJoin::GetLocalSinkState(ExecutionContext &context) const {
+	auto &gstate = sink_state->Cast<MultiwayJoinGlobalSinkState>();
+	return make_uniq<MultiwayJoinLocalSinkState>(context.client, *this, gstate);
+}
+
+SinkResultType PhysicalMultiwayJoin::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
+	auto &lstate = input.local_state.Cast<MultiwayJoinLocalSinkState>();
+
+	// rows with NULL keys never match
+	auto count = SelectValidRows(chunk, lstate.key_columns, lstate.sel);
+	if (count > 0) {
+		lstate.data->Append(lstate.append_state, chunk, lstate.sel, count);
+	}
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType PhysicalMultiwayJoin::Combine(ExecutionContext &context,
+                                                    OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<MultiwayJoinGlobalSinkState>();
+	auto &lstate = input.local_state.Cast<MultiwayJoinLocalSinkState>();
+
+	lstate.data->FinalizePinState(lstate.append_state.pin_state);
+	{
+		lock_guard<mutex> guard(gstate.lock);
+		gstate.data[lstate.side]->Combine(*lstate.data);
+	}
+
+	auto &client_profiler = QueryProfiler::Get(context.client);
+	context.thread.profiler.Flush(*this);
+	client_profiler.Flush(context.thread.profiler);
+	return SinkCombineResultType::FINISHED;
+}
+
+SinkFinalizeType PhysicalMultiwayJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                OperatorSinkFinalizeInput &input) const {
+	auto &gstate = input.global_state.Cast<MultiwayJoinGlobalSinkState>();
+	const auto side = gstate.side++;
+	auto &data = *gstate.data[side];
+	auto &trie = gstate.tries[side];
+
+	// the rows stay pinned, so the trie can point to them
+	TupleDataScanState scan_state;
+	data.InitializeScan(scan_state, TupleDataPinProperties::KEEP_EVERYTHING_PINNED);
+	DataChunk chunk;
+	data.InitializeScanChunk(scan_state, chunk);
+	auto &types = children[side + 1]->types;
+	MultiwayJoinKeys probe_keys(types, build_keys[side].build_columns);
+	MultiwayJoinKeys shared_keys(types, build_keys[side].shared_columns);
+	while (data.Scan(scan_state, chunk)) {
+		auto probe_key_data = probe_keys.Create(chunk);
+		auto shared_key_data = shared_keys.Create(chunk);
+		auto rows = FlatVector::GetData<data_ptr_t>(scan_state.chunk_state.row_locations);
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			trie.Insert(probe_key_data[i], shared_key_data[i], rows[i]);
+		}
+	}
+
+	// reserve the memory of the build sides that have been finalized so far
+	idx_t build_size = 0;
+	for (idx_t i = 0; i <= side; i++) {
+		build_size += gstate.data[i]->SizeInBytes() + gstate.data[i]->Count() * TRIE_ENTRY_SIZE;
+	}
+	gstate.temporary_memory_state->SetMinimumReservation(build_size);
+	gstate.temporary_memory_state->SetRemainingSizeAndUpdateReservation(context, build_size);
+
+	if (side == 0) {
+		// the second build side is sunk next
+		return SinkFinalizeType::READY;
+	}
+	if (gstate.data[0]->Count() == 0 || gstate.data[1]->Count() == 0) {
+		return SinkFinalizeType::NO_OUTPUT_POSSIBLE;
+	}
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Operator
+//===--------------------------------------------------------------------===//
+class MultiwayJoinOperatorState : public CachingOperatorState {
+public:
+	explicit MultiwayJoinOperatorState(const PhysicalMultiwayJoin &op)
+	    : sel(STANDARD_VECTOR_SIZE), result_sel(STANDARD_VECTOR_SIZE) {
+		auto &types = op.children[0]->types;
+		for (auto &keys : op.build_keys) {
+			probe_keys.push_back(make_uniq<MultiwayJoinKeys>(types, keys.probe_columns));
+			key_columns.insert(key_columns.end(), keys.probe_columns.begin(), keys.probe_columns.end());
+			row_pointers.emplace_back(LogicalType::POINTER);
+		}
+	}
+
+	//! The keys of the input for both build sides
+	vector<unique_ptr<MultiwayJoinKeys>> probe_keys;
+	vector<idx_t> key_columns;
+	//! The rows of the input with non-NULL keys
+	SelectionVector sel;
+	idx_t count = 0;
+	const string_t *probe_key_data[2];
+
+	//! Whether the keys of the current input have been computed
+	bool initialized = false;
+	//! The (non-NULL) row of the input that is being joined
+	idx_t position = 0;
+	//! The trie nodes of both build sides for the current row are intersected:
+	//! the entries of the smaller node are scanned, and looked up in the larger node
+	optional_ptr<const MultiwayJoinTrieNode> scan_node;
+	optional_ptr<const MultiwayJoinTrieNode> lookup_node;
+	idx_t scan_side = 0;
+	MultiwayJoinTrieNode::const_iterator scan_entry;
+	//! The matching rows of both build sides for the current shared key, and the next combination of them to emit
+	optional_ptr<const vector<data_ptr_t>> matches[2];
+	idx_t match_idx[2];
+
+	//! The rows of the result
+	SelectionVector result_sel;
+	vector<Vector> row_pointers;
+
+public:
+	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
+		context.thread.profiler.Flush(op);
+	}
+};
+
+unique_ptr<OperatorState> PhysicalMultiwayJoin::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<MultiwayJoinOperatorState>(*this);
+}
+
+OperatorResultType PhysicalMultiwayJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                         GlobalOperatorState &gstate_p, OperatorState &state_p) const {
+	auto &gstate = sink_state->Cast<MultiwayJoinGlobalSinkState>();
+	auto &state = state_p.Cast<MultiwayJoinOperatorState>();
+
+	if (!state.initialized) {
+		// rows with NULL keys never match
+		state.count = SelectValidRows(input, state.key_columns, state.sel);
+		for (idx_t side = 0; side < 2; side++) {
+			state.probe_key_data[side] = state.probe_keys[side]->Create(input);
+		}
+		state.position = 0;
+		state.initialized = true;
+	}
+
+	auto first_rows = FlatVector::GetData<data_ptr_t>(state.row_pointers[0]);
+	auto second_rows = FlatVector::GetData<data_ptr_t>(state.row_pointers[1]);
+	idx_t result_count = 0;
+	while (result_count < STANDARD_VECTOR_SIZE) {
+		if (state.matches[0]) {
+			// emit all combinations of the matching rows of both build sides
+			auto &first_matches = *state.matches[0];
+			auto &second_matches = *state.matches[1];
+			const auto row = state.sel.get_index(state.position);
+			while (result_count < STANDARD_VECTOR_SIZE && state.match_idx[0] < first_matches.size()) {
+				state.result_sel.set_index(result_count, row);
+				first_rows[result_count] = first_matches[state.match_idx[0]];
+				second_rows[result_count] = second_matches[state.match_idx[1]];
+				result_count++;
+				if (++state.match_idx[1] == second_matches.size()) {
+					state.match_idx[1] = 0;
+					state.match_idx[0]++;
+				}
+			}
+			if (state.match_idx[0] < first_matches.size()) {
+				// the result is full
+				break;
+			}
+			state.matches[0] = nullptr;
+			state.matches[1] = nullptr;
+		}
+		if (state.scan_node) {
+			// find the next shared key that is in the trie nodes of both build sides
+			while (state.scan_entry != state.scan_node->end()) {
+				auto &entry = *state.scan_entry;
+				++state.scan_entry;
+				auto lookup_entry = state.lookup_node->find(entry.first);
+				if (lookup_entry == state.lookup_node->end()) {
+					continue;
+				}
+				state.matches[state.scan_side] = &entry.second;
+				state.matches[1 - state.scan_side] = &lookup_entry->second;
+				state.match_idx[0] = 0;
+				state.match_idx[1] = 0;
+				break;
+			}
+			if (!state.matches[0]) {
+				// the row is done
+				state.scan_node = nullptr;
+				state.position++;
+			}
+			continue;
+		}
+		if (state.position >= state.count) {
+			break;
+		}
+		const auto row = state.sel.get_index(state.position);
+		auto first_node = gstate.tries[0].Find(state.probe_key_data[0][row]);
+		auto second_node = gstate.tries[1].Find(state.probe_key_data[1][row]);
+		if (!first_node || !second_node) {
+			state.position++;
+			continue;
+		}
+		// the cost of the intersection is bounded by the smaller node
+		state.scan_side = first_node->size() <= second_node->size() ? 0 : 1;
+		state.scan_node = state.scan_side == 0 ? first_node : second_node;
+		state.lookup_node = state.scan_side == 0 ? second_node : first_node;
+		state.scan_entry = state.scan_node->begin();
+	}
+
+	if (result_count > 0) {
+		for (idx_t i = 0; i < output_columns.size(); i++) {
+			auto &column = output_columns[i];
+			if (column.first == 0) {
+				chunk.data[i].Slice(input.data[column.second], state.result_sel, result_count);
+				continue;
+			}
+			const auto side = column.first - 1;
+			gstate.data[side]->Gather(state.row_pointers[side], *FlatVector::IncrementalSelectionVector(),
+			                          result_count, column.second, chunk.data[i],
+			                          *FlatVector::IncrementalSelectionVector(), nullptr);
+		}
+		chunk.SetCardinality(result_count);
+	}
+	if (state.position < state.count) {
+		return OperatorResultType::HAVE_MORE_OUTPUT;
+	}
+	state.initialized = false;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+//===--------------------------------------------------------------------===//
+// Pipeline Construction
+//===--------------------------------------------------------------------===//
+void PhysicalMultiwayJoin::BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) {
+	op_state.reset();
+	sink_state.reset();
+
+	// 'current' is the probe pipeline: add this operator
+	auto &state = meta_pipeline.GetState();
+	state.AddPipelineOperator(current, *this);
+
+	// both build sides sink into this operator: one child MetaPipeline holds the pipelines of both
+	auto &child_meta_pipeline = meta_pipeline.CreateChildMetaPipeline(current, *this);
+	child_meta_pipeline.Build(*children[1]);
+	// the second build side gets its own finish event, so the first build side is finalized before it is sunk
+	auto &second_pipeline = child_meta_pipeline.CreatePipeline();
+	children[2]->BuildPipelines(second_pipeline, child_meta_pipeline);
+	child_meta_pipeline.AddFinishEvent(second_pipeline);
+
+	// continue building the current pipeline on the probe side
+	children[0]->BuildPipelines(current, meta_pipeline);
+}
+
+} // namespace duckdb
@@ -153,12 +153,14 @@ void PhysicalRangeJoin::GlobalSortedTable::ScheduleMergeTasks(Pipeline &pipeline
 	event.InsertEvent(std::move(new_event));
 }
 
-void PhysicalRangeJoin::GlobalSortedTable::Finalize(Pipeline &pipeline, Event &event) {
+void PhysicalRangeJoin::GlobalSortedTable::Finalize(Pipeline &pipeline, Event &event, idx_t max_block_capacity) {
 	// Prepare for merge sort phase
 	global_sort_state.PrepareMergePhase();
 
 	// Start the merge phase or finish if a merge is not necessary
 	if (global_sort_state.sorted_blocks.size() > 1) {
+		// Every merge task produces a block of (at most) block_capacity rows
+		global_sort_state.block_capacity = MinValue(global_sort_state.block_capacity, max_block_capacity);
 		ScheduleMergeTasks(pipeline, event);
 	}
 }
@@ -0,0 +1,345 @@
+#include "duckdb/execution/operator/order/physical_grouped_top_n.hpp"
+
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/core_functions/create_sort_key.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+PhysicalGroupedTopN::PhysicalGroupedTopN(vector<LogicalType> types, vector<unique_ptr<Expression>> partitions_p,
+                                         vector<BoundOrderByNode> orders_p, idx_t limit, idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::GROUPED_TOP_N, std::move(types), estimated_cardinality),
+      partitions(std::move(partitions_p)), orders(std::move(orders_p)), limit(limit) {
+}
+
+//===--------------------------------------------------------------------===//
+// Heaps
+//===--------------------------------------------------------------------===//
+struct GroupedTopNEntry {
+	GroupedTopNEntry(string order_key_p, idx_t row_idx) : order_key(std::move(order_key_p)), row_idx(row_idx) {
+	}
+
+	//! The sort key of the orders
+	string order_key;
+	//! The index of the row in the collection
+	idx_t row_idx;
+
+	bool operator<(const GroupedTopNEntry &other) const {
+		return order_key < other.order_key;
+	}
+};
+
+//! One max-heap (on the order sort key) per partition, the rows themselves are stored in a ColumnDataCollection
+class GroupedTopNHeap {
+public:
+	GroupedTopNHeap(ClientContext &context, const PhysicalGroupedTopN &op);
+
+	ClientContext &context;
+	const PhysicalGroupedTopN &op;
+	vector<LogicalType> payload_types;
+	ExpressionExecutor partition_executor;
+	ExpressionExecutor order_executor;
+	DataChunk partition_chunk;
+	DataChunk order_chunk;
+	vector<OrderModifiers> partition_modifiers;
+	vector<OrderModifiers> order_modifiers;
+
+	//! The rows that have been added to a heap (some of which might have been pushed out of the heap since)
+	unique_ptr<ColumnDataCollection> rows;
+	//! The heap of every partition, keyed on the sort key of the partition values
+	unordered_map<string, vector<GroupedTopNEntry>> heaps;
+	//! The amount of rows in all heaps
+	idx_t entry_count = 0;
+	//! The row number of every row in the collection (only set after Finalize)
+	vector<int64_t> row_numbers;
+
+	SelectionVector append_sel;
+
+public:
+	void Sink(DataChunk &input);
+	void Combine(GroupedTopNHeap &other);
+	//! Removes the rows that are no longer in any heap from the collection
+	void Reduce();
+	void Finalize();
+};
+
+GroupedTopNHeap::GroupedTopNHeap(ClientContext &context, const PhysicalGroupedTopN &op)
+    : context(context), op(op), partition_executor(context), order_executor(context),
+      append_sel(STANDARD_VECTOR_SIZE) {
+	payload_types = op.children[0]->types;
+	vector<LogicalType> partition_types;
+	for (auto &partition : op.partitions) {
+		partition_types.push_back(partition->return_type);
+		partition_executor.AddExpression(*partition);
+		partition_modifiers.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST);
+	}
+	vector<LogicalType> order_types;
+	for (auto &order : op.orders) {
+		order_types.push_back(order.expression->return_type);
+		order_executor.AddExpression(*order.expression);
+		order_modifiers.emplace_back(order.type, order.null_order);
+	}
+	if (!partition_types.empty()) {
+		partition_chunk.Initialize(Allocator::Get(context), partition_types);
+	}
+	order_chunk.Initialize(Allocator::Get(context), order_types);
+	rows = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), payload_types);
+}
+
+void GroupedTopNHeap::Sink(DataChunk &input) {
+	auto count = input.size();
+	if (count == 0) {
+		return;
+	}
+	// compute the sort keys of the partitions and the orders
+	Vector partition_keys(LogicalType::BLOB, count);
+	if (!op.partitions.empty()) {
+		partition_chunk.Reset();
+		partition_executor.Execute(input, partition_chunk);
+		CreateSortKeyHelpers::CreateSortKey(partition_chunk, partition_modifiers, partition_keys);
+	}
+	Vector order_keys(LogicalType::BLOB, count);
+	order_chunk.Reset();
+	order_executor.Execute(input, order_chunk);
+	CreateSortKeyHelpers::CreateSortKey(order_chunk, order_modifiers, order_keys);
+	auto partition_data = FlatVector::GetData<string_t>(partition_keys);
+	auto order_data = FlatVector::GetData<string_t>(order_keys);
+
+	// add the rows to the heaps of their partition, if they are among the first "limit" rows seen so far
+	idx_t append_count = 0;
+	auto base_idx = rows->Count();
+	string empty_key;
+	for (idx_t i = 0; i < count; i++) {
+		auto &heap = op.partitions.empty() ? heaps[empty_key] : heaps[partition_data[i].GetString()];
+		if (heap.size() < op.limit) {
+			heap.emplace_back(order_data[i].GetString(), base_idx + append_count);
+			std::push_heap(heap.begin(), heap.end());
+			entry_count++;
+		} else {
+			auto order_key = order_data[i].GetString();
+			if (!(order_key < heap.front().order_key)) {
+				continue;
+			}
+			// the row replaces the last row of the heap
+			std::pop_heap(heap.begin(), heap.end());
+			heap.back() = GroupedTopNEntry(std::move(order_key), base_idx + append_count);
+			std::push_heap(heap.begin(), heap.end());
+		}
+		append_sel.set_index(append_count++, i);
+	}
+	if (append_count == 0) {
+		return;
+	}
+	DataChunk append_chunk;
+	append_chunk.InitializeEmpty(payload_types);
+	append_chunk.Slice(input, append_sel, append_count);
+	rows->Append(append_chunk);
+
+	// once the collection holds enough rows that are no longer in a heap, get rid of them
+	if (rows->Count() > MaxValue<idx_t>(STANDARD_VECTOR_SIZE * 5ULL, 2ULL * entry_count)) {
+		Reduce();
+	}
+}
+
+void GroupedTopNHeap::Reduce() {
+	if (rows->Count() == entry_count) {
+		return;
+	}
+	vector<idx_t> live_rows;
+	live_rows.reserve(entry_count);
+	for (auto &heap : heaps) {
+		for (auto &entry : heap.second) {
+			live_rows.push_back(entry.row_idx);
+		}
+	}
+	std::sort(live_rows.begin(), live_rows.end());
+
+	// copy the rows that are still in a heap into a new collection
+	auto new_rows = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), payload_types);
+	ColumnDataScanState scan_state;
+	DataChunk scan_chunk;
+	rows->InitializeScan(scan_state);
+	rows->InitializeScanChunk(scan_chunk);
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t base_idx = 0;
+	idx_t live_idx = 0;
+	while (live_idx < live_rows.size() && rows->Scan(scan_state, scan_chunk)) {
+		idx_t sel_count = 0;
+		auto end_idx = base_idx + scan_chunk.size();
+		for (; live_idx < live_rows.size() && live_rows[live_idx] < end_idx; live_idx++) {
+			sel.set_index(sel_count++, live_rows[live_idx] - base_idx);
+		}
+		if (sel_count > 0) {
+			scan_chunk.Slice(sel, sel_count);
+			new_rows->Append(scan_chunk);
+		}
+		base_idx = end_idx;
+	}
+	rows = std::move(new_rows);
+
+	// the new index of a row is its position in the (sorted) list of live rows
+	for (auto &heap : heaps) {
+		for (auto &entry : heap.second) {
+			auto it = std::lower_bound(live_rows.begin(), live_rows.end(), entry.row_idx);
+			entry.row_idx = NumericCast<idx_t>(it - live_rows.begin());
+		}
+	}
+}
+
+void GroupedTopNHeap::Combine(GroupedTopNHeap &other) {
+	other.Reduce();
+	ColumnDataScanState scan_state;
+	DataChunk scan_chunk;
+	other.rows->InitializeScan(scan_state, ColumnDataScanProperties::DISALLOW_ZERO_COPY);
+	other.rows->InitializeScanChunk(scan_chunk);
+	while (other.rows->Scan(scan_state, scan_chunk)) {
+		Sink(scan_chunk);
+	}
+	other.rows.reset();
+	other.heaps.clear();
+}
+
+void GroupedTopNHeap::Finalize() {
+	Reduce();
+	row_numbers.resize(rows->Count());
+	for (auto &heap : heaps) {
+		auto &entries = heap.second;
+		std::sort_heap(entries.begin(), entries.end());
+		for (idx_t i = 0; i < entries.size(); i++) {
+			row_numbers[entries[i].row_idx] = NumericCast<int64_t>(i + 1);
+		}
+	}
+	heaps.clear();
+}
+
+class GroupedTopNGlobalState : public GlobalSinkState {
+public:
+	GroupedTopNGlobalState(ClientContext &context, const PhysicalGroupedTopN &op) : heap(context, op) {
+	}
+
+	mutex lock;
+	GroupedTopNHeap heap;
+};
+
+class GroupedTopNLocalState : public LocalSinkState {
+public:
+	GroupedTopNLocalState(ClientContext &context, const PhysicalGroupedTopN &op) : heap(context, op) {
+	}
+
+	GroupedTopNHeap heap;
+};
+
+unique_ptr<LocalSinkState> PhysicalGroupedTopN::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<GroupedTopNLocalState>(context.client, *this);
+}
+
+unique_ptr<GlobalSinkState> PhysicalGroupedTopN::GetGlobalSinkState(ClientContext &context) const {
+	return make_uniq<GroupedTopNGlobalState>(context, *this);
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+SinkResultType PhysicalGroupedTopN::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
+	auto &sink = input.local_state.Cast<GroupedTopNLocalState>();
+	sink.heap.Sink(chunk);
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+//===--------------------------------------------------------------------===//
+// Combine
+//===--------------------------------------------------------------------===//
+SinkCombineResultType PhysicalGroupedTopN::Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<GroupedTopNGlobalState>();
+	auto &lstate = input.local_state.Cast<GroupedTopNLocalState>();
+
+	lock_guard<mutex> glock(gstate.lock);
+	gstate.heap.Combine(lstate.heap);
+
+	return SinkCombineResultType::FINISHED;
+}
+
+//===--------------------------------------------------------------------===//
+// Finalize
+//===--------------------------------------------------------------------===//
+SinkFinalizeType PhysicalGroupedTopN::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                               OperatorSinkFinalizeInput &input) const {
+	auto &gstate = input.global_state.Cast<GroupedTopNGlobalState>();
+	gstate.heap.Finalize();
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+class GroupedTopNSourceState : public GlobalSourceState {
+public:
+	ColumnDataScanState scan_state;
+	DataChunk payload;
+	bool initialized = false;
+	idx_t row_idx = 0;
+};
+
+unique_ptr<GlobalSourceState> PhysicalGroupedTopN::GetGlobalSourceState(ClientContext &context) const {
+	return make_uniq<GroupedTopNSourceState>();
+}
+
+SourceResultType PhysicalGroupedTopN::GetData(ExecutionContext &context, DataChunk &chunk,
+                                              OperatorSourceInput &input) const {
+	auto &state = input.global_state.Cast<GroupedTopNSourceState>();
+	auto &heap = sink_state->Cast<GroupedTopNGlobalState>().heap;
+	if (!state.initialized) {
+		heap.rows->InitializeScan(state.scan_state);
+		heap.rows->InitializeScanChunk(state.payload);
+		state.initialized = true;
+	}
+	state.payload.Reset();
+	if (!heap.rows->Scan(state.scan_state, state.payload)) {
+		return SourceResultType::FINISHED;
+	}
+
+	// the rows are emitted together with their row number
+	auto count = state.payload.size();
+	for (idx_t col_idx = 0; col_idx < state.payload.ColumnCount(); col_idx++) {
+		chunk.data[col_idx].Reference(state.payload.data[col_idx]);
+	}
+	auto &row_number = chunk.data[state.payload.ColumnCount()];
+	row_number.SetVectorType(VectorType::FLAT_VECTOR);
+	auto row_number_data = FlatVector::GetData<int64_t>(row_number);
+	for (idx_t i = 0; i < count; i++) {
+		row_number_data[i] = heap.row_numbers[state.row_idx + i];
+	}
+	state.row_idx += count;
+	chunk.SetCardinality(count);
+	return SourceResultType::HAVE_MORE_OUTPUT;
+}
+
+InsertionOrderPreservingMap<string> PhysicalGroupedTopN::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	result["Top"] = to_string(limit);
+
+	string partitions_info;
+	for (idx_t i = 0; i < partitions.size(); i++) {
+		if (i > 0) {
+			partitions_info += "\n";
+		}
+		partitions_info += partitions[i]->ToString();
+	}
+	result["Partition By"] = partitions_info;
+
+	string orders_info;
+	for (idx_t i = 0; i < orders.size(); i++) {
+		if (i > 0) {
+			orders_info += "\n";
+		}
+		orders_info += orders[i].expression->ToString() + " ";
+		orders_info += orders[i].type == OrderType::DESCENDING ? "DESC" : "ASC";
+	}
+	result["Order By"] = orders_info;
+	return result;
+}
+
+} // namespace duckdb
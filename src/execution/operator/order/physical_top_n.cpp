@@ -1,19 +1,24 @@
 #include "duckdb/execution/operator/order/physical_top_n.hpp"
 
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/common/assert.hpp"
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/common/types/row/row_layout.hpp"
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
 
 namespace duckdb {
 
 PhysicalTopN::PhysicalTopN(vector<LogicalType> types, vector<BoundOrderByNode> orders, idx_t limit, idx_t offset,
                            idx_t estimated_cardinality)
     : PhysicalOperator(PhysicalOperatorType::TOP_N, std::move(types), estimated_cardinality), orders(std::move(orders)),
-      limit(limit), offset(offset) {
+      limit(limit), offset(offset), payload_types(this->types) {
 }
 
 //===--------------------------------------------------------------------===//
@@ -84,7 +89,8 @@ public:
 public:
 	void Sink(DataChunk &input);
 	void Combine(TopNHeap &other);
-	void Reduce();
+	//! Reduces the heap to limit + offset rows (if it grew large enough), returns whether the heap was reduced
+	bool Reduce();
 	void Finalize();
 
 	void ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk);
@@ -275,11 +281,11 @@ void TopNHeap::Finalize() {
 	sort_state.Finalize();
 }
 
-void TopNHeap::Reduce() {
+bool TopNHeap::Reduce() {
 	idx_t min_sort_threshold = MaxValue<idx_t>(STANDARD_VECTOR_SIZE * 5ULL, 2ULL * (limit + offset));
 	if (sort_state.count < min_sort_threshold) {
 		// only reduce when we pass two times the limit + offset, or 5 vectors (whichever comes first)
-		return;
+		return false;
 	}
 	sort_state.Finalize();
 	TopNSortState new_state(*this);
@@ -306,6 +312,7 @@ void TopNHeap::Reduce() {
 	}
 
 	sort_state.Move(new_state);
+	return true;
 }
 
 void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk) {
@@ -420,11 +427,15 @@ public:
 };
 
 unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &context) const {
-	return make_uniq<TopNLocalState>(context, types, orders, limit, offset);
+	return make_uniq<TopNLocalState>(context, payload_types, orders, limit, offset);
 }
 
 unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
+	if (dynamic_filter) {
+		// clear the boundary of a previous execution of this plan (e.g. of a prepared statement)
+		dynamic_filter->Reset();
+	}
+	return make_uniq<TopNGlobalState>(context, payload_types, orders, limit, offset);
 }
 
 //===--------------------------------------------------------------------===//
@@ -434,7 +445,10 @@ SinkResultType PhysicalTopN::Sink(ExecutionContext &context, DataChunk &chunk, O
 	// append to the local sink state
 	auto &sink = input.local_state.Cast<TopNLocalState>();
 	sink.heap.Sink(chunk);
-	sink.heap.Reduce();
+	if (sink.heap.Reduce() && dynamic_filter && sink.heap.has_boundary_values) {
+		// no row that is beyond the boundary of the local heap can end up in the result
+		dynamic_filter->SetValue(sink.heap.boundary_values.GetValue(0, 0));
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -470,10 +484,68 @@ class TopNOperatorState : public GlobalSourceState {
 public:
 	TopNScanState state;
 	bool initialized = false;
+
+	//! The rows of the heap, if columns are fetched late
+	DataChunk payload;
+	//! The fetched columns
+	DataChunk fetched;
+	DataChunk fetch_chunk;
+	ColumnFetchState fetch_state;
 };
 
 unique_ptr<GlobalSourceState> PhysicalTopN::GetGlobalSourceState(ClientContext &context) const {
-	return make_uniq<TopNOperatorState>();
+	auto result = make_uniq<TopNOperatorState>();
+	if (fetch_table) {
+		vector<LogicalType> fetch_types;
+		for (idx_t col_idx = 0; col_idx < output_columns.size(); col_idx++) {
+			if (output_columns[col_idx] >= payload_types.size()) {
+				fetch_types.push_back(types[col_idx]);
+			}
+		}
+		D_ASSERT(fetch_types.size() == fetch_column_ids.size());
+		result->payload.Initialize(context, payload_types);
+		result->fetched.Initialize(context, fetch_types);
+		result->fetch_chunk.Initialize(context, fetch_types);
+	}
+	return std::move(result);
+}
+
+void PhysicalTopN::FetchColumns(ClientContext &context, TopNOperatorState &state) const {
+	auto &payload = state.payload;
+	auto &fetched = state.fetched;
+	auto &fetch_chunk = state.fetch_chunk;
+	fetched.Reset();
+
+	auto &storage = fetch_table.get_mutable()->GetStorage();
+	auto &transaction = DuckTransaction::Get(context, fetch_table->catalog);
+	auto &local_storage = LocalStorage::Get(transaction);
+
+	auto &row_ids = payload.data[row_id_index];
+	row_ids.Flatten(payload.size());
+	auto ids = FlatVector::GetData<row_t>(row_ids);
+
+	// rows can come from both the table and the transaction-local storage, fetch them in runs to preserve the order
+	idx_t pos = 0;
+	while (pos < payload.size()) {
+		idx_t start = pos;
+		bool is_local = ids[pos] >= MAX_ROW_ID;
+		for (pos++; pos < payload.size(); pos++) {
+			if ((ids[pos] >= MAX_ROW_ID) != is_local) {
+				break;
+			}
+		}
+		Vector run_ids(row_ids, start, pos);
+		fetch_chunk.Reset();
+		if (is_local) {
+			local_storage.FetchChunk(storage, run_ids, pos - start, fetch_column_ids, fetch_chunk, state.fetch_state);
+		} else {
+			storage.Fetch(transaction, fetch_chunk, fetch_column_ids, run_ids, pos - start, state.fetch_state);
+		}
+		if (fetch_chunk.size() != pos - start) {
+			throw InternalException("PhysicalTopN - could not fetch all rows of the Top-N");
+		}
+		fetched.Append(fetch_chunk);
+	}
 }
 
 SourceResultType PhysicalTopN::GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const {
@@ -487,7 +559,24 @@ SourceResultType PhysicalTopN::GetData(ExecutionContext &context, DataChunk &chu
 		gstate.heap.InitializeScan(state.state, true);
 		state.initialized = true;
 	}
-	gstate.heap.Scan(state.state, chunk);
+	if (!fetch_table) {
+		gstate.heap.Scan(state.state, chunk);
+		return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
+	}
+
+	// scan the heap and fetch the remaining columns of the rows
+	state.payload.Reset();
+	gstate.heap.Scan(state.state, state.payload);
+	FetchColumns(context.client, state);
+	for (idx_t col_idx = 0; col_idx < output_columns.size(); col_idx++) {
+		auto source_idx = output_columns[col_idx];
+		if (source_idx < payload_types.size()) {
+			chunk.data[col_idx].Reference(state.payload.data[source_idx]);
+		} else {
+			chunk.data[col_idx].Reference(state.fetched.data[source_idx - payload_types.size()]);
+		}
+	}
+	chunk.SetCardinality(state.payload.size());
 
 	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
 }
@@ -508,6 +597,9 @@ InsertionOrderPreservingMap<string> PhysicalTopN::ParamsToString() const {
 		orders_info += orders[i].type == OrderType::DESCENDING ? "DESC" : "ASC";
 	}
 	result["Order By"] = orders_info;
+	if (fetch_table) {
+		result["Fetched Columns"] = to_string(fetch_column_ids.size());
+	}
 	return result;
 }
 
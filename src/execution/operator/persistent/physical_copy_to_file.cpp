@@ -4,10 +4,15 @@
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/types/uuid.hpp"
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/execution_context.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/operator/logical_copy_to_file.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 #include <algorithm>
 
@@ -45,6 +50,33 @@ struct VectorOfValuesEquality {
 template <class T>
 using vector_of_value_map_t = unordered_map<vector<Value>, T, VectorOfValuesHashFunction, VectorOfValuesEquality>;
 
+static void SetDataWithoutPartitions(DataChunk &chunk, const DataChunk &source, const vector<LogicalType> &col_types,
+                                     const vector<idx_t> &part_cols) {
+	D_ASSERT(source.ColumnCount() == col_types.size());
+	auto types = LogicalCopyToFile::GetTypesWithoutPartitions(col_types, part_cols, false);
+	chunk.InitializeEmpty(types);
+	set<idx_t> part_col_set(part_cols.begin(), part_cols.end());
+	idx_t new_col_id = 0;
+	for (idx_t col_idx = 0; col_idx < source.ColumnCount(); col_idx++) {
+		if (part_col_set.find(col_idx) == part_col_set.end()) {
+			chunk.data[new_col_id].Reference(source.data[col_idx]);
+			new_col_id++;
+		}
+	}
+	chunk.SetCardinality(source.size());
+}
+
+static void SinkPartitionChunk(ExecutionContext &context, const PhysicalCopyToFile &op, GlobalFunctionData &gstate,
+                               LocalFunctionData &lstate, DataChunk &chunk) {
+	if (op.write_partition_columns) {
+		op.function.copy_to_sink(context, *op.bind_data, gstate, lstate, chunk);
+	} else {
+		DataChunk filtered_chunk;
+		SetDataWithoutPartitions(filtered_chunk, chunk, op.expected_types, op.partition_columns);
+		op.function.copy_to_sink(context, *op.bind_data, gstate, lstate, filtered_chunk);
+	}
+}
+
 class CopyToFunctionGlobalState : public GlobalSinkState {
 public:
 	explicit CopyToFunctionGlobalState(ClientContext &context, unique_ptr<GlobalFunctionData> global_state)
@@ -145,17 +177,7 @@ public:
 		// Create a writer for the current file
 		auto trimmed_path = op.GetTrimmedPath(context.client);
 		string hive_path = GetOrCreateDirectory(op.partition_columns, op.names, values, trimmed_path, fs);
-		string full_path(op.filename_pattern.CreateFilename(fs, hive_path, op.file_extension, offset));
-		if (op.overwrite_mode == CopyOverwriteMode::COPY_APPEND) {
-			// when appending, we first check if the file exists
-			while (fs.FileExists(full_path)) {
-				// file already exists - re-generate name
-				if (!op.filename_pattern.HasUUID()) {
-					throw InternalException("CopyOverwriteMode::COPY_APPEND without {uuid} - and file exists");
-				}
-				full_path = op.filename_pattern.CreateFilename(fs, hive_path, op.file_extension, offset);
-			}
-		}
+		auto full_path = GetPartitionFilePath(op, fs, hive_path, offset);
 		if (op.return_type == CopyFunctionReturnType::CHANGED_ROWS_AND_FILE_LIST) {
 			AddFileName(*global_lock, full_path);
 		}
@@ -174,10 +196,77 @@ public:
 		info.active_writes--;
 	}
 
+	//! Moves the data of a partition into the buffer of the partition (for BUFFER_PARTITIONS)
+	void BufferPartition(ClientContext &context, const vector<Value> &values, ColumnDataCollection &data) {
+		auto global_lock = lock.GetExclusiveLock();
+		auto &buffer = buffered_partitions[values];
+		if (!buffer) {
+			buffer = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), data.Types());
+		}
+		buffer->Combine(data);
+	}
+
+	//! Writes the buffered partitions one after the other, so that only a single file is open at any time
+	void WriteBufferedPartitions(ClientContext &context, const PhysicalCopyToFile &op) {
+		ThreadContext thread_context(context);
+		ExecutionContext execution_context(context, thread_context, nullptr);
+		auto &fs = FileSystem::GetFileSystem(context);
+		auto trimmed_path = op.GetTrimmedPath(context);
+		for (auto &entry : buffered_partitions) {
+			string hive_path = GetOrCreateDirectory(op.partition_columns, op.names, entry.first, trimmed_path, fs);
+			idx_t offset = 0;
+			unique_ptr<GlobalFunctionData> file_state;
+			unique_ptr<LocalFunctionData> local_state;
+			for (auto &chunk : entry.second->Chunks()) {
+				if (!file_state) {
+					auto full_path = GetPartitionFilePath(op, fs, hive_path, offset++);
+					if (op.return_type == CopyFunctionReturnType::CHANGED_ROWS_AND_FILE_LIST) {
+						auto global_lock = lock.GetExclusiveLock();
+						AddFileName(*global_lock, full_path);
+					}
+					file_state = op.function.copy_to_initialize_global(context, *op.bind_data, full_path);
+					local_state = op.function.copy_to_initialize_local(execution_context, *op.bind_data);
+				}
+				SinkPartitionChunk(execution_context, op, *file_state, *local_state, chunk);
+				if (op.rotate && op.function.rotate_next_file(*file_state, *op.bind_data, op.file_size_bytes)) {
+					// FILE_SIZE_BYTES/rotate applies to the files of every partition separately
+					op.function.copy_to_combine(execution_context, *op.bind_data, *file_state, *local_state);
+					op.function.copy_to_finalize(context, *op.bind_data, *file_state);
+					file_state.reset();
+				}
+			}
+			if (file_state) {
+				op.function.copy_to_combine(execution_context, *op.bind_data, *file_state, *local_state);
+				op.function.copy_to_finalize(context, *op.bind_data, *file_state);
+			}
+			// free the buffered data of this partition
+			entry.second.reset();
+		}
+		buffered_partitions.clear();
+	}
+
+private:
+	string GetPartitionFilePath(const PhysicalCopyToFile &op, FileSystem &fs, const string &hive_path, idx_t offset) {
+		string full_path(op.filename_pattern.CreateFilename(fs, hive_path, op.file_extension, offset));
+		if (op.overwrite_mode == CopyOverwriteMode::COPY_APPEND) {
+			// when appending, we first check if the file exists
+			while (fs.FileExists(full_path)) {
+				// file already exists - re-generate name
+				if (!op.filename_pattern.HasUUID()) {
+					throw InternalException("CopyOverwriteMode::COPY_APPEND without {uuid} - and file exists");
+				}
+				full_path = op.filename_pattern.CreateFilename(fs, hive_path, op.file_extension, offset);
+			}
+		}
+		return full_path;
+	}
+
 private:
 	//! The active writes per partition (for partitioned write)
 	vector_of_value_map_t<unique_ptr<PartitionWriteInfo>> active_partitioned_writes;
 	vector_of_value_map_t<idx_t> previous_partitions;
+	//! The buffered data per partition (for partitioned write with BUFFER_PARTITIONS)
+	vector_of_value_map_t<unique_ptr<ColumnDataCollection>> buffered_partitions;
 };
 
 string PhysicalCopyToFile::GetTrimmedPath(ClientContext &context) const {
@@ -229,22 +318,6 @@ public:
 		append_count = 0;
 	}
 
-	void SetDataWithoutPartitions(DataChunk &chunk, const DataChunk &source, const vector<LogicalType> &col_types,
-	                              const vector<idx_t> &part_cols) {
-		D_ASSERT(source.ColumnCount() == col_types.size());
-		auto types = LogicalCopyToFile::GetTypesWithoutPartitions(col_types, part_cols, false);
-		chunk.InitializeEmpty(types);
-		set<idx_t> part_col_set(part_cols.begin(), part_cols.end());
-		idx_t new_col_id = 0;
-		for (idx_t col_idx = 0; col_idx < source.ColumnCount(); col_idx++) {
-			if (part_col_set.find(col_idx) == part_col_set.end()) {
-				chunk.data[new_col_id].Reference(source.data[col_idx]);
-				new_col_id++;
-			}
-		}
-		chunk.SetCardinality(source.size());
-	}
-
 	void FlushPartitions(ExecutionContext &context, const PhysicalCopyToFile &op, CopyToFunctionGlobalState &g) {
 		if (!part_buffer) {
 			return;
@@ -258,20 +331,19 @@ public:
 			if (entry == partition_key_map.end()) {
 				continue;
 			}
+			if (op.buffer_partitions) {
+				// the partitions are written in Finalize
+				g.BufferPartition(context.client, entry->second->values, *partitions[i]);
+				partitions[i].reset();
+				continue;
+			}
 			// get the partition write info for this buffer
 			auto &info = g.GetPartitionWriteInfo(context, op, entry->second->values);
 
 			auto local_copy_state = op.function.copy_to_initialize_local(context, *op.bind_data);
 			// push the chunks into the write state
 			for (auto &chunk : partitions[i]->Chunks()) {
-				if (op.write_partition_columns) {
-					op.function.copy_to_sink(context, *op.bind_data, *info.global_state, *local_copy_state, chunk);
-				} else {
-					DataChunk filtered_chunk;
-					SetDataWithoutPartitions(filtered_chunk, chunk, op.expected_types, op.partition_columns);
-					op.function.copy_to_sink(context, *op.bind_data, *info.global_state, *local_copy_state,
-					                         filtered_chunk);
-				}
+				SinkPartitionChunk(context, op, *info.global_state, *local_copy_state, chunk);
 			}
 			op.function.copy_to_combine(context, *op.bind_data, *info.global_state, *local_copy_state);
 			local_copy_state.reset();
@@ -504,6 +576,9 @@ SinkFinalizeType PhysicalCopyToFile::Finalize(Pipeline &pipeline, Event &event,
                                               OperatorSinkFinalizeInput &input) const {
 	auto &gstate = input.global_state.Cast<CopyToFunctionGlobalState>();
 	if (partition_output) {
+		if (buffer_partitions) {
+			gstate.WriteBufferedPartitions(context, *this);
+		}
 		// finalize any outstanding partitions
 		gstate.FinalizePartitions(context, *this);
 		return SinkFinalizeType::READY;
@@ -1,7 +1,9 @@
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/enum_util.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/to_string.hpp"
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 #include "duckdb/transaction/transaction.hpp"
 
@@ -28,7 +30,8 @@ public:
 			table_filters = op.dynamic_filters->GetFinalTableFilters(op, op.table_filters.get());
 		}
 		if (op.function.init_global) {
-			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, GetTableFilters(op));
+			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, GetTableFilters(op),
+			                             op.extra_info.sample_options.get());
 			global_state = op.function.init_global(context, input);
 			if (global_state) {
 				max_threads = global_state->MaxThreads();
@@ -71,7 +74,7 @@ public:
 	                          const PhysicalTableScan &op) {
 		if (op.function.init_local) {
 			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids,
-			                             gstate.GetTableFilters(op));
+			                             gstate.GetTableFilters(op), op.extra_info.sample_options.get());
 			local_state = op.function.init_local(context, input, gstate.global_state.get());
 		}
 	}
@@ -191,6 +194,11 @@ InsertionOrderPreservingMap<string> PhysicalTableScan::ParamsToString() const {
 			                                              extra_info.total_files.GetIndex());
 		}
 	}
+	if (extra_info.sample_options) {
+		auto &sample_options = *extra_info.sample_options;
+		result["Sample Method"] = EnumUtil::ToString(sample_options.method) + ": " +
+		                          to_string(sample_options.sample_size.GetValue<double>()) + "%";
+	}
 
 	SetEstimatedCardinality(result, estimated_cardinality);
 	return result;
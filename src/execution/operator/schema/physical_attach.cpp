@@ -4,6 +4,7 @@
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parser/parsed_data/attach_info.hpp"
 #include "duckdb/storage/storage_extension.hpp"
 #include "duckdb/main/database_path_and_type.hpp"
@@ -18,6 +19,21 @@ SourceResultType PhysicalAttach::GetData(ExecutionContext &context, DataChunk &c
 	// parse the options
 	auto &config = DBConfig::GetConfig(context.client);
 	AttachOptions options(info, config.options.access_mode);
+	if (!options.encryption_secret.empty()) {
+		// the key of an encrypted database is managed by the secret manager
+		auto &secret_manager = SecretManager::Get(context.client);
+		auto transaction = CatalogTransaction::GetSystemCatalogTransaction(context.client);
+		auto secret_entry = secret_manager.GetSecretByName(transaction, options.encryption_secret);
+		if (!secret_entry) {
+			throw InvalidInputException("Encryption secret \"%s\" does not exist", options.encryption_secret);
+		}
+		if (secret_entry->secret->GetType() != "encryption") {
+			throw InvalidInputException("Secret \"%s\" is of type \"%s\", but an encryption secret is required",
+			                            options.encryption_secret, secret_entry->secret->GetType());
+		}
+		auto &secret = dynamic_cast<const KeyValueSecret &>(*secret_entry->secret);
+		options.encryption_key = secret.TryGetValue("key", true).ToString();
+	}
 
 	// get the name and path of the database
 	auto &name = info->name;
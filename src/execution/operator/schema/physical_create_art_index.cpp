@@ -31,6 +31,9 @@ PhysicalCreateARTIndex::PhysicalCreateARTIndex(LogicalOperator &op, TableCatalog
 // Sink
 //===--------------------------------------------------------------------===//
 
+//! The amount of keys a thread buffers before constructing an ART from them
+static constexpr const idx_t ART_BULK_LOAD_KEY_COUNT = 1ULL << 20;
+
 class CreateARTIndexGlobalSinkState : public GlobalSinkState {
 public:
 	unique_ptr<BoundIndex> global_index;
@@ -41,6 +44,7 @@ public:
 	explicit CreateARTIndexLocalSinkState(ClientContext &context) : arena_allocator(Allocator::Get(context)) {};
 
 	unique_ptr<BoundIndex> local_index;
+	//! Holds the buffered keys and row IDs
 	ArenaAllocator arena_allocator;
 
 	DataChunk key_chunk;
@@ -49,6 +53,10 @@ public:
 
 	DataChunk row_id_chunk;
 	unsafe_vector<ARTKey> row_ids;
+
+	//! The keys and row IDs that are not yet part of the local index
+	unsafe_vector<ARTKey> buffered_keys;
+	unsafe_vector<ARTKey> buffered_row_ids;
 };
 
 unique_ptr<GlobalSinkState> PhysicalCreateARTIndex::GetGlobalSinkState(ClientContext &context) const {
@@ -78,33 +86,53 @@ unique_ptr<LocalSinkState> PhysicalCreateARTIndex::GetLocalSinkState(ExecutionCo
 	return std::move(state);
 }
 
-SinkResultType PhysicalCreateARTIndex::SinkUnsorted(OperatorSinkInput &input) const {
-
-	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	auto row_count = l_state.key_chunk.size();
-
-	// Insert each key and its corresponding row ID.
-	auto &art = l_state.local_index->Cast<ART>();
-	for (idx_t i = 0; i < row_count; i++) {
-		if (!art.Insert(art.tree, l_state.keys[i], 0, l_state.row_ids[i], art.tree.GetGateStatus())) {
-			throw ConstraintException("Data contains duplicates on indexed column(s)");
+static bool KeysAreSorted(const unsafe_vector<ARTKey> &keys) {
+	for (idx_t i = 1; i < keys.size(); i++) {
+		if (keys[i - 1] > keys[i]) {
+			return false;
 		}
 	}
+	return true;
+}
 
-	return SinkResultType::NEED_MORE_INPUT;
+static void SortKeys(unsafe_vector<ARTKey> &keys, unsafe_vector<ARTKey> &row_ids) {
+	unsafe_vector<idx_t> order(keys.size());
+	for (idx_t i = 0; i < keys.size(); i++) {
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(), [&](const idx_t l, const idx_t r) { return keys[r] > keys[l]; });
+
+	unsafe_vector<ARTKey> sorted_keys;
+	unsafe_vector<ARTKey> sorted_row_ids;
+	sorted_keys.reserve(keys.size());
+	sorted_row_ids.reserve(row_ids.size());
+	for (auto &idx : order) {
+		sorted_keys.push_back(keys[idx]);
+		sorted_row_ids.push_back(row_ids[idx]);
+	}
+	keys = std::move(sorted_keys);
+	row_ids = std::move(sorted_row_ids);
 }
 
-SinkResultType PhysicalCreateARTIndex::SinkSorted(OperatorSinkInput &input) const {
+void PhysicalCreateARTIndex::BulkLoad(CreateARTIndexLocalSinkState &l_state) const {
+	auto &keys = l_state.buffered_keys;
+	auto &row_ids = l_state.buffered_row_ids;
+	if (keys.empty()) {
+		return;
+	}
+
+	// A sorted pipeline produces sorted runs: we only have to sort if a thread received multiple runs.
+	if (!sorted || !KeysAreSorted(keys)) {
+		SortKeys(keys, row_ids);
+	}
 
-	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+	// Construct an ART bottom-up from the sorted keys.
 	auto &storage = table.GetStorage();
 	auto &l_index = l_state.local_index;
-
-	// Construct an ART for this chunk.
 	auto art = make_uniq<ART>(info->index_name, l_index->GetConstraintType(), l_index->GetColumnIds(),
 	                          l_index->table_io_manager, l_index->unbound_expressions, storage.db,
 	                          l_index->Cast<ART>().allocators);
-	if (!art->Construct(l_state.keys, l_state.row_ids, l_state.key_chunk.size())) {
+	if (!art->Construct(keys, row_ids, keys.size())) {
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
 	}
 
@@ -113,7 +141,9 @@ SinkResultType PhysicalCreateARTIndex::SinkSorted(OperatorSinkInput &input) cons
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
 	}
 
-	return SinkResultType::NEED_MORE_INPUT;
+	keys.clear();
+	row_ids.clear();
+	l_state.arena_allocator.Reset();
 }
 
 SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk &chunk,
@@ -121,15 +151,19 @@ SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk
 
 	D_ASSERT(chunk.ColumnCount() >= 2);
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	l_state.arena_allocator.Reset();
 	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
 	ART::GenerateKeyVectors(l_state.arena_allocator, l_state.key_chunk, chunk.data[chunk.ColumnCount() - 1],
 	                        l_state.keys, l_state.row_ids);
 
-	if (sorted) {
-		return SinkSorted(input);
+	// Buffer the keys, so that we can construct the ART from many keys at once.
+	for (idx_t i = 0; i < l_state.key_chunk.size(); i++) {
+		l_state.buffered_keys.push_back(l_state.keys[i]);
+		l_state.buffered_row_ids.push_back(l_state.row_ids[i]);
+	}
+	if (l_state.buffered_keys.size() >= ART_BULK_LOAD_KEY_COUNT) {
+		BulkLoad(l_state);
 	}
-	return SinkUnsorted(input);
+	return SinkResultType::NEED_MORE_INPUT;
 }
 
 SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
@@ -138,6 +172,9 @@ SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
 	auto &g_state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
 
+	// construct an ART from the remaining keys
+	BulkLoad(l_state);
+
 	// merge the local index into the global index
 	if (!g_state.global_index->MergeIndexes(*l_state.local_index)) {
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
@@ -0,0 +1,137 @@
+#include "duckdb/execution/operator/schema/physical_create_block_range_index.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/common/exception/transaction_exception.hpp"
+#include "duckdb/execution/index/brin/block_range_index.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+
+namespace duckdb {
+
+PhysicalCreateBlockRangeIndex::PhysicalCreateBlockRangeIndex(LogicalOperator &op, TableCatalogEntry &table_p,
+                                                             const vector<column_t> &column_ids,
+                                                             unique_ptr<CreateIndexInfo> info,
+                                                             vector<unique_ptr<Expression>> unbound_expressions,
+                                                             idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::CREATE_INDEX, op.types, estimated_cardinality),
+      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)),
+      unbound_expressions(std::move(unbound_expressions)) {
+
+	// Convert the virtual column ids to physical column ids.
+	for (auto &column_id : column_ids) {
+		storage_ids.push_back(table.GetColumns().LogicalToPhysical(LogicalIndex(column_id)).index);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+
+class CreateBlockRangeIndexGlobalSinkState : public GlobalSinkState {
+public:
+	unique_ptr<BoundIndex> global_index;
+};
+
+class CreateBlockRangeIndexLocalSinkState : public LocalSinkState {
+public:
+	unique_ptr<BoundIndex> local_index;
+	DataChunk key_chunk;
+	vector<column_t> key_column_ids;
+};
+
+unique_ptr<GlobalSinkState> PhysicalCreateBlockRangeIndex::GetGlobalSinkState(ClientContext &context) const {
+	// Create the global sink state and add the global index.
+	auto state = make_uniq<CreateBlockRangeIndexGlobalSinkState>();
+	auto &storage = table.GetStorage();
+	state->global_index = make_uniq<BlockRangeIndex>(info->index_name, info->constraint_type, storage_ids,
+	                                                 TableIOManager::Get(storage), unbound_expressions, storage.db,
+	                                                 info->options);
+	return (std::move(state));
+}
+
+unique_ptr<LocalSinkState> PhysicalCreateBlockRangeIndex::GetLocalSinkState(ExecutionContext &context) const {
+	// Create the local sink state and add the local index.
+	auto state = make_uniq<CreateBlockRangeIndexLocalSinkState>();
+	auto &storage = table.GetStorage();
+	state->local_index = make_uniq<BlockRangeIndex>(info->index_name, info->constraint_type, storage_ids,
+	                                                TableIOManager::Get(storage), unbound_expressions, storage.db,
+	                                                info->options);
+
+	state->key_chunk.Initialize(Allocator::Get(context.client), state->local_index->logical_types);
+	for (idx_t i = 0; i < state->key_chunk.ColumnCount(); i++) {
+		state->key_column_ids.push_back(i);
+	}
+	return std::move(state);
+}
+
+SinkResultType PhysicalCreateBlockRangeIndex::Sink(ExecutionContext &context, DataChunk &chunk,
+                                                   OperatorSinkInput &input) const {
+
+	D_ASSERT(chunk.ColumnCount() >= 2);
+	auto &l_state = input.local_state.Cast<CreateBlockRangeIndexLocalSinkState>();
+	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
+
+	IndexLock lock;
+	l_state.local_index->InitializeLock(lock);
+	l_state.local_index->Insert(lock, l_state.key_chunk, chunk.data[chunk.ColumnCount() - 1]);
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType PhysicalCreateBlockRangeIndex::Combine(ExecutionContext &context,
+                                                             OperatorSinkCombineInput &input) const {
+
+	auto &g_state = input.global_state.Cast<CreateBlockRangeIndexGlobalSinkState>();
+	auto &l_state = input.local_state.Cast<CreateBlockRangeIndexLocalSinkState>();
+
+	// merge the block ranges of the local index into the global index
+	g_state.global_index->MergeIndexes(*l_state.local_index);
+	return SinkCombineResultType::FINISHED;
+}
+
+SinkFinalizeType PhysicalCreateBlockRangeIndex::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                         OperatorSinkFinalizeInput &input) const {
+
+	// here, we set the resulting global index as the newly created index of the table
+	auto &state = input.global_state.Cast<CreateBlockRangeIndexGlobalSinkState>();
+	D_ASSERT(!state.global_index->VerifyAndToString(true).empty());
+
+	auto &storage = table.GetStorage();
+	if (!storage.IsRoot()) {
+		throw TransactionException("Transaction conflict: cannot add an index to a table that has been altered!");
+	}
+
+	auto &schema = table.schema;
+	info->column_ids = storage_ids;
+
+	// Ensure that the index does not yet exist.
+	if (schema.GetEntry(schema.GetCatalogTransaction(context), CatalogType::INDEX_ENTRY, info->index_name)) {
+		if (info->on_conflict != OnCreateConflict::IGNORE_ON_CONFLICT) {
+			throw CatalogException("Index with name \"%s\" already exists!", info->index_name);
+		}
+		// IF NOT EXISTS on existing index. We are done.
+		return SinkFinalizeType::READY;
+	}
+
+	auto index_entry = schema.CreateIndex(schema.GetCatalogTransaction(context), *info, table).get();
+	D_ASSERT(index_entry);
+	auto &index = index_entry->Cast<DuckIndexEntry>();
+	index.initial_index_size = state.global_index->GetInMemorySize();
+
+	// add index to storage
+	storage.AddIndex(std::move(state.global_index));
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+
+SourceResultType PhysicalCreateBlockRangeIndex::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                        OperatorSourceInput &input) const {
+	return SourceResultType::FINISHED;
+}
+
+} // namespace duckdb
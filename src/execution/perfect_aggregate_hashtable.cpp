@@ -18,33 +18,55 @@ PerfectAggregateHashTable::PerfectAggregateHashTable(ClientContext &context, All
 	for (auto &group_bits : required_bits) {
 		total_required_bits += group_bits;
 	}
-	// the total amount of groups we allocate space for is 2^required_bits
+	// the total amount of groups we have space for is 2^required_bits
 	total_groups = (uint64_t)1 << total_required_bits;
 	// we don't need to store the groups in a perfect hash table, since the group keys can be deduced by their location
 	grouping_columns = group_types_p.size();
 	layout.Initialize(std::move(aggregate_objects_p));
 	tuple_size = layout.GetRowWidth();
 
-	// allocate and null initialize the data
-	owned_data = make_unsafe_uniq_array_uninitialized<data_t>(tuple_size * total_groups);
-	data = owned_data.get();
+	// the groups are allocated in pages, which are only created once we find a group in their range
+	page_bits = MinValue<idx_t>(total_required_bits, PAGE_BITS);
+	page_size = (uint64_t)1 << page_bits;
+	pages.resize(total_groups >> page_bits);
+	page_locks = make_unsafe_uniq_array<mutex>(pages.size());
+}
 
-	// set up the empty payloads for every tuple, and initialize the "occupied" flag to false
-	group_is_set = make_unsafe_uniq_array_uninitialized<bool>(total_groups);
-	memset(group_is_set.get(), 0, total_groups * sizeof(bool));
+static inline bool GroupIsSet(const PerfectAggregatePage &page, idx_t group) {
+	return (page.group_is_set[group / ValidityMask::BITS_PER_VALUE] >> (group % ValidityMask::BITS_PER_VALUE)) & 1;
+}
 
-	// initialize the hash table for each entry
-	auto address_data = FlatVector::GetData<uintptr_t>(addresses);
+static inline void SetGroup(PerfectAggregatePage &page, idx_t group) {
+	page.group_is_set[group / ValidityMask::BITS_PER_VALUE] |= validity_t(1) << (group % ValidityMask::BITS_PER_VALUE);
+}
+
+PerfectAggregatePage &PerfectAggregateHashTable::CreatePage(idx_t page_idx) {
+	D_ASSERT(!pages[page_idx]);
+	auto page = make_uniq<PerfectAggregatePage>();
+	page->data = make_unsafe_uniq_array_uninitialized<data_t>(tuple_size * page_size);
+
+	// initialize the "occupied" flags to false
+	const auto bitmap_size = ValidityMask::EntryCount(page_size);
+	page->group_is_set = make_unsafe_uniq_array_uninitialized<validity_t>(bitmap_size);
+	memset(page->group_is_set.get(), 0, bitmap_size * sizeof(validity_t));
+
+	// set up the empty payloads for every tuple
+	Vector init_addresses(LogicalType::POINTER);
+	auto address_data = FlatVector::GetData<uintptr_t>(init_addresses);
 	idx_t init_count = 0;
-	for (idx_t i = 0; i < total_groups; i++) {
-		address_data[init_count] = uintptr_t(data) + (tuple_size * i);
+	for (idx_t i = 0; i < page_size; i++) {
+		address_data[init_count] = uintptr_t(page->data.get()) + (tuple_size * i);
 		init_count++;
 		if (init_count == STANDARD_VECTOR_SIZE) {
-			RowOperations::InitializeStates(layout, addresses, *FlatVector::IncrementalSelectionVector(), init_count);
+			RowOperations::InitializeStates(layout, init_addresses, *FlatVector::IncrementalSelectionVector(),
+			                                init_count);
 			init_count = 0;
 		}
 	}
-	RowOperations::InitializeStates(layout, addresses, *FlatVector::IncrementalSelectionVector(), init_count);
+	RowOperations::InitializeStates(layout, init_addresses, *FlatVector::IncrementalSelectionVector(), init_count);
+
+	pages[page_idx] = std::move(page);
+	return *pages[page_idx];
 }
 
 PerfectAggregateHashTable::~PerfectAggregateHashTable() {
@@ -127,12 +149,16 @@ void PerfectAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload)
 		ComputeGroupLocation(groups.data[i], group_minima[i], address_data, current_shift, groups.size());
 	}
 	// now we have the HT entry number for every tuple
-	// compute the actual pointer to the data by adding it to the base HT pointer and multiplying by the tuple size
+	// compute the actual pointer to the data by looking up its page, and adding the offset within the page
+	const auto page_mask = page_size - 1;
 	for (idx_t i = 0; i < groups.size(); i++) {
 		const auto group = address_data[i];
 		D_ASSERT(group < total_groups);
-		group_is_set[group] = true;
-		address_data[i] = uintptr_t(data) + group * tuple_size;
+		const auto page_idx = group >> page_bits;
+		auto &page = pages[page_idx] ? *pages[page_idx] : CreatePage(page_idx);
+		const auto page_group = group & page_mask;
+		SetGroup(page, page_group);
+		address_data[i] = uintptr_t(page.data.get()) + page_group * tuple_size;
 	}
 
 	// after finding the group location we update the aggregates
@@ -163,31 +189,48 @@ void PerfectAggregateHashTable::Combine(PerfectAggregateHashTable &other) {
 	auto source_addresses_ptr = FlatVector::GetData<data_ptr_t>(source_addresses);
 	auto target_addresses_ptr = FlatVector::GetData<data_ptr_t>(target_addresses);
 
-	// iterate over all entries of both hash tables and call combine for all entries that can be combined
-	data_ptr_t source_ptr = other.data;
-	data_ptr_t target_ptr = data;
-	idx_t combine_count = 0;
-	RowOperationsState row_state(*aggregate_allocator);
-	for (idx_t i = 0; i < total_groups; i++) {
-		auto has_entry_source = other.group_is_set[i];
-		// we only have any work to do if the source has an entry for this group
-		if (has_entry_source) {
-			group_is_set[i] = true;
-			source_addresses_ptr[combine_count] = source_ptr;
-			target_addresses_ptr[combine_count] = target_ptr;
-			combine_count++;
-			if (combine_count == STANDARD_VECTOR_SIZE) {
-				RowOperations::CombineStates(row_state, layout, source_addresses, target_addresses, combine_count);
-				combine_count = 0;
+	// other threads may be combining into this HT at the same time, so we only lock the page we are combining
+	// every thread starts at a different page, so that the threads spread out over the pages instead of queueing up
+	// the combined states are allocated in the allocator of the source, which no other thread uses
+	RowOperationsState row_state(*other.aggregate_allocator);
+	const auto start_page = next_combine_page++;
+	for (idx_t i = 0; i < pages.size(); i++) {
+		auto page_idx = (start_page + i) % pages.size();
+		auto &source_page = other.pages[page_idx];
+		if (!source_page) {
+			// we only have any work to do if the source has entries in this page
+			continue;
+		}
+		lock_guard<mutex> guard(page_locks[page_idx]);
+		auto &target_page = pages[page_idx];
+		if (!target_page) {
+			// we have no entries in this page: we can take over the page of the source
+			target_page = std::move(source_page);
+			continue;
+		}
+		idx_t combine_count = 0;
+		data_ptr_t source_ptr = source_page->data.get();
+		data_ptr_t target_ptr = target_page->data.get();
+		for (idx_t group_idx = 0; group_idx < page_size; group_idx++) {
+			if (GroupIsSet(*source_page, group_idx)) {
+				SetGroup(*target_page, group_idx);
+				source_addresses_ptr[combine_count] = source_ptr;
+				target_addresses_ptr[combine_count] = target_ptr;
+				combine_count++;
+				if (combine_count == STANDARD_VECTOR_SIZE) {
+					RowOperations::CombineStates(row_state, layout, source_addresses, target_addresses, combine_count);
+					combine_count = 0;
+				}
 			}
+			source_ptr += tuple_size;
+			target_ptr += tuple_size;
 		}
-		source_ptr += tuple_size;
-		target_ptr += tuple_size;
+		RowOperations::CombineStates(row_state, layout, source_addresses, target_addresses, combine_count);
 	}
-	RowOperations::CombineStates(row_state, layout, source_addresses, target_addresses, combine_count);
 
 	// FIXME: after moving the arena allocator, we currently have to ensure that the pointer is not nullptr, because the
 	// FIXME: Destroy()-function of the hash table expects an allocator in some cases (e.g., for sorted aggregates)
+	lock_guard<mutex> guard(allocator_lock);
 	stored_allocators.push_back(std::move(other.aggregate_allocator));
 	other.aggregate_allocator = make_uniq<ArenaAllocator>(allocator);
 }
@@ -250,18 +293,22 @@ void PerfectAggregateHashTable::Scan(idx_t &scan_position, DataChunk &result) {
 	auto data_pointers = FlatVector::GetData<data_ptr_t>(addresses);
 	uint32_t group_values[STANDARD_VECTOR_SIZE];
 
-	// iterate over the HT until we either have exhausted the entire HT, or
+	// iterate over the HT until we either have exhausted the entire HT, or have filled the result vector
+	const auto page_mask = page_size - 1;
 	idx_t entry_count = 0;
-	for (; scan_position < total_groups; scan_position++) {
-		if (group_is_set[scan_position]) {
+	for (; scan_position < total_groups && entry_count < STANDARD_VECTOR_SIZE; scan_position++) {
+		auto &page = pages[scan_position >> page_bits];
+		if (!page) {
+			// this page has no entries: skip to its last group
+			scan_position |= page_mask;
+			continue;
+		}
+		const auto page_group = scan_position & page_mask;
+		if (GroupIsSet(*page, page_group)) {
 			// this group is set: add it to the set of groups to extract
-			data_pointers[entry_count] = data + tuple_size * scan_position;
+			data_pointers[entry_count] = page->data.get() + tuple_size * page_group;
 			group_values[entry_count] = NumericCast<uint32_t>(scan_position);
 			entry_count++;
-			if (entry_count == STANDARD_VECTOR_SIZE) {
-				scan_position++;
-				break;
-			}
 		}
 	}
 	if (entry_count == 0) {
@@ -298,14 +345,19 @@ void PerfectAggregateHashTable::Destroy() {
 
 	// iterate over all initialised slots of the hash table
 	RowOperationsState row_state(*aggregate_allocator);
-	data_ptr_t payload_ptr = data;
-	for (idx_t i = 0; i < total_groups; i++) {
-		data_pointers[count++] = payload_ptr;
-		if (count == STANDARD_VECTOR_SIZE) {
-			RowOperations::DestroyStates(row_state, layout, addresses, count);
-			count = 0;
+	for (auto &page : pages) {
+		if (!page) {
+			continue;
+		}
+		data_ptr_t payload_ptr = page->data.get();
+		for (idx_t i = 0; i < page_size; i++) {
+			data_pointers[count++] = payload_ptr;
+			if (count == STANDARD_VECTOR_SIZE) {
+				RowOperations::DestroyStates(row_state, layout, addresses, count);
+				count = 0;
+			}
+			payload_ptr += tuple_size;
 		}
-		payload_ptr += tuple_size;
 	}
 	RowOperations::DestroyStates(row_state, layout, addresses, count);
 }
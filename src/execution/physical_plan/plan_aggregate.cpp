@@ -2,15 +2,23 @@
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_window.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/perfect_aggregate_hashtable.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/function/aggregate/distributive_functions.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/parser/expression_map.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -33,6 +41,9 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 		return false;
 	}
 	idx_t perfect_hash_bits = 0;
+	const auto perfect_ht_threshold = ClientConfig::GetConfig(context).perfect_ht_threshold;
+	const auto max_perfect_hash_bits =
+	    MaxValue<idx_t>(perfect_ht_threshold, PhysicalPerfectHashAggregate::MAXIMUM_SPARSE_BITS);
 	if (op.group_stats.empty()) {
 		op.group_stats.resize(op.groups.size());
 	}
@@ -134,11 +145,23 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 		bits_per_group.push_back(required_bits);
 		perfect_hash_bits += required_bits;
 		// check if we have exceeded the bits for the hash
-		if (perfect_hash_bits > ClientConfig::GetConfig(context).perfect_ht_threshold) {
+		if (perfect_hash_bits > max_perfect_hash_bits) {
 			// too many bits for perfect hash
 			return false;
 		}
 	}
+	if (perfect_hash_bits > perfect_ht_threshold) {
+		// the range exceeds the threshold: only use a perfect hash table if its pages are allocated lazily,
+		// and if the input can fill the range reasonably
+		if (perfect_ht_threshold == 0 || perfect_hash_bits <= PerfectAggregateHashTable::PAGE_BITS) {
+			return false;
+		}
+		auto cardinality = op.children[0]->EstimateCardinality(context);
+		auto total_groups = idx_t(1) << perfect_hash_bits;
+		if (cardinality * PhysicalPerfectHashAggregate::MAXIMUM_SPARSE_FACTOR < total_groups) {
+			return false;
+		}
+	}
 	for (auto &expression : op.expressions) {
 		auto &aggregate = expression->Cast<BoundAggregateExpression>();
 		if (aggregate.IsDistinct() || !aggregate.function.combine) {
@@ -149,13 +172,138 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+//! Whether the input of the aggregate is sorted on (exactly) the groups, i.e., all rows of a group are adjacent
+static bool CanUseStreamingAggregate(ClientContext &context, LogicalAggregate &op) {
+	if (!ClientConfig::GetConfig(context).enable_optimizer) {
+		return false;
+	}
+	if (op.groups.empty() || op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct()) {
+			return false;
+		}
+	}
+	// find the columns of the groups in the input of the order (through any projections)
+	vector<idx_t> group_columns;
+	for (auto &group : op.groups) {
+		if (group->GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			return false;
+		}
+		group_columns.push_back(group->Cast<BoundReferenceExpression>().index);
+	}
+	auto order = PhysicalPlanGenerator::GetOrderedInput(*op.children[0], group_columns);
+	if (!order) {
+		return false;
+	}
+	// the first orders have to be on the group columns, and cover all of them
+	unordered_set<idx_t> groups(group_columns.begin(), group_columns.end());
+	unordered_set<idx_t> ordered_groups;
+	for (auto &node : order->orders) {
+		if (ordered_groups.size() == groups.size()) {
+			break;
+		}
+		if (node.expression->GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			return false;
+		}
+		auto column = node.expression->Cast<BoundReferenceExpression>().index;
+		if (groups.find(column) == groups.end()) {
+			return false;
+		}
+		ordered_groups.insert(column);
+	}
+	return ordered_groups.size() == groups.size();
+}
+
+static bool IsHolisticAggregate(const BoundAggregateExpression &aggregate) {
+	auto &name = aggregate.function.name;
+	return name == "median" || name == "quantile" || name == "quantile_cont" || name == "quantile_disc" ||
+	       name == "mad" || name == "mode";
+}
+
+//! Holistic aggregates (e.g., median) keep all values of a group in their (in-memory) state. If these values are not
+//! expected to fit in memory, the aggregates are computed as window aggregates over partitions of the groups instead,
+//! which sorts (and spills) the input and processes the partitions in parallel
+static bool UseSortedHolisticAggregate(ClientContext &context, LogicalAggregate &op) {
+	if (!ClientConfig::GetConfig(context).enable_optimizer) {
+		return false;
+	}
+	if (op.groups.empty() || op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	idx_t holistic_width = 0;
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct() || aggregate.filter || aggregate.order_bys || aggregate.children.empty()) {
+			return false;
+		}
+		if (IsHolisticAggregate(aggregate)) {
+			auto &type = aggregate.children[0]->return_type;
+			holistic_width += type.InternalType() == PhysicalType::VARCHAR ? sizeof(string_t) * 2
+			                                                                : GetTypeIdSize(type.InternalType());
+		}
+	}
+	if (holistic_width == 0) {
+		return false;
+	}
+	// the states are not accounted for by the buffer manager, so be conservative
+	auto cardinality = op.children[0]->EstimateCardinality(context);
+	auto max_memory = BufferManager::GetBufferManager(context).GetQueryMaxMemory();
+	return static_cast<double>(cardinality) * static_cast<double>(holistic_width) > static_cast<double>(max_memory) / 4;
+}
+
+//! Computes the aggregates as window aggregates partitioned by the groups, and then takes one row of every group
+static unique_ptr<PhysicalOperator> PlanSortedHolisticAggregate(ClientContext &context, LogicalAggregate &op,
+                                                                unique_ptr<PhysicalOperator> plan) {
+	auto input_count = plan->types.size();
+	auto window_types = plan->types;
+	vector<unique_ptr<Expression>> select_list;
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		auto window_aggregate = make_uniq<BoundWindowExpression>(
+		    ExpressionType::WINDOW_AGGREGATE, aggregate.return_type, make_uniq<AggregateFunction>(aggregate.function),
+		    aggregate.bind_info ? aggregate.bind_info->Copy() : nullptr);
+		window_aggregate->children = std::move(aggregate.children);
+		for (auto &group : op.groups) {
+			window_aggregate->partitions.push_back(group->Copy());
+		}
+		window_aggregate->start = WindowBoundary::UNBOUNDED_PRECEDING;
+		window_aggregate->end = WindowBoundary::UNBOUNDED_FOLLOWING;
+		window_types.push_back(aggregate.return_type);
+		select_list.push_back(std::move(window_aggregate));
+	}
+	auto window = make_uniq<PhysicalWindow>(std::move(window_types), std::move(select_list), op.estimated_cardinality);
+	window->children.push_back(std::move(plan));
+
+	FunctionBinder function_binder(context);
+	vector<unique_ptr<Expression>> aggregates;
+	for (idx_t aggr_idx = 0; aggr_idx < op.expressions.size(); aggr_idx++) {
+		auto &type = op.expressions[aggr_idx]->return_type;
+		vector<unique_ptr<Expression>> children;
+		children.push_back(make_uniq<BoundReferenceExpression>(type, input_count + aggr_idx));
+		aggregates.push_back(function_binder.BindAggregateFunction(FirstFun::GetFunction(type), std::move(children),
+		                                                           nullptr, AggregateType::NON_DISTINCT));
+	}
+	auto groupby = make_uniq<PhysicalHashAggregate>(context, op.types, std::move(aggregates), std::move(op.groups),
+	                                                op.estimated_cardinality);
+	groupby->children.push_back(std::move(window));
+	return std::move(groupby);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
 
+	bool use_streaming_aggregate = CanUseStreamingAggregate(context, op);
+	bool use_sorted_holistic_aggregate = !use_streaming_aggregate && UseSortedHolisticAggregate(context, op);
 	auto plan = CreatePlan(*op.children[0]);
 
 	plan = ExtractAggregateExpressions(std::move(plan), op.expressions, op.groups);
+	if (use_sorted_holistic_aggregate) {
+		return PlanSortedHolisticAggregate(context, op, std::move(plan));
+	}
 
 	if (op.groups.empty() && op.grouping_sets.size() <= 1) {
 		// no groups, check if we can use a simple aggregation
@@ -180,7 +328,11 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		// groups! create a GROUP BY aggregator
 		// use a perfect hash aggregate if possible
 		vector<idx_t> required_bits;
-		if (CanUsePerfectHashAggregate(context, op, required_bits)) {
+		if (use_streaming_aggregate) {
+			// the input is sorted on the groups: emit every group as soon as it ends
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
+		} else if (CanUsePerfectHashAggregate(context, op, required_bits)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
@@ -215,9 +367,19 @@ PhysicalPlanGenerator::ExtractAggregateExpressions(unique_ptr<PhysicalOperator>
 		expressions.push_back(std::move(group));
 		group = std::move(ref);
 	}
+	// aggregates with the same inputs refer to the same projected columns, so distinct aggregates can share a table
+	expression_map_t<idx_t> child_map;
 	for (auto &aggr : aggregates) {
 		auto &bound_aggr = aggr->Cast<BoundAggregateExpression>();
 		for (auto &child : bound_aggr.children) {
+			auto entry = child_map.find(*child);
+			if (entry != child_map.end()) {
+				child = make_uniq<BoundReferenceExpression>(child->return_type, entry->second);
+				continue;
+			}
+			if (!child->IsVolatile()) {
+				child_map[*child] = expressions.size();
+			}
 			auto ref = make_uniq<BoundReferenceExpression>(child->return_type, expressions.size());
 			types.push_back(child->return_type);
 			expressions.push_back(std::move(child));
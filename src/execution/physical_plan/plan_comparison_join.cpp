@@ -1,7 +1,11 @@
 #include "duckdb/execution/operator/join/perfect_hash_join_executor.hpp"
 #include "duckdb/execution/operator/join/physical_cross_product.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
+#include "duckdb/execution/operator/join/physical_merge_join.hpp"
+#include "duckdb/execution/operator/join/physical_multiway_join.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
@@ -9,6 +13,9 @@
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/join/physical_blockwise_nl_join.hpp"
@@ -42,17 +49,13 @@ bool ExtractNumericValue(Value val, int64_t &result) {
 	return true;
 }
 
-void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &join_state) {
+void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, idx_t build_cardinality, PerfectHashJoinStats &join_state) {
 	// we only do this optimization for inner joins
 	if (op.join_type != JoinType::INNER) {
 		return;
 	}
-	// with one condition
-	if (op.conditions.size() != 1) {
-		return;
-	}
-	// with propagated statistics
-	if (op.join_stats.empty()) {
+	// with propagated statistics for every condition
+	if (op.join_stats.empty() || op.join_stats.size() != op.conditions.size() * 2) {
 		return;
 	}
 	for (auto &type : op.children[1]->types) {
@@ -81,46 +84,58 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 		}
 	}
 
-	// and when the build range is smaller than the threshold
-	auto &stats_build = *op.join_stats[1].get(); // rhs stats
-	if (!NumericStats::HasMinMax(stats_build)) {
-		return;
-	}
-	int64_t min_value, max_value;
-	if (!ExtractNumericValue(NumericStats::Min(stats_build), min_value) ||
-	    !ExtractNumericValue(NumericStats::Max(stats_build), max_value)) {
-		return;
-	}
-	if (max_value < min_value) {
-		// empty table
-		return;
-	}
-	int64_t build_range;
-	if (!TrySubtractOperator::Operation(max_value, min_value, build_range)) {
-		return;
-	}
-
-	// Fill join_stats for invisible join
-	auto &stats_probe = *op.join_stats[0].get(); // lhs stats
-	if (!NumericStats::HasMinMax(stats_probe)) {
-		return;
+	// and when the combined build range of all keys is smaller than the threshold
+	idx_t slot_count = 1;
+	bool is_probe_in_domain = true;
+	for (idx_t cond_idx = 0; cond_idx < op.conditions.size(); cond_idx++) {
+		auto &stats_probe = *op.join_stats[cond_idx * 2].get(); // lhs stats
+		auto &stats_build = *op.join_stats[cond_idx * 2 + 1].get(); // rhs stats
+		if (!NumericStats::HasMinMax(stats_build) || !NumericStats::HasMinMax(stats_probe)) {
+			return;
+		}
+		int64_t min_value, max_value;
+		if (!ExtractNumericValue(NumericStats::Min(stats_build), min_value) ||
+		    !ExtractNumericValue(NumericStats::Max(stats_build), max_value)) {
+			return;
+		}
+		if (max_value < min_value) {
+			// empty table
+			return;
+		}
+		int64_t build_range;
+		if (!TrySubtractOperator::Operation(max_value, min_value, build_range)) {
+			return;
+		}
+		auto key_range = NumericCast<idx_t>(build_range);
+		if (key_range >= PerfectHashJoinExecutor::MAX_BITMAP_BUILD_SIZE) {
+			return;
+		}
+		// the keys are packed into a single slot: the stride of a key is the number of slots of the keys before it
+		join_state.key_strides.push_back(slot_count);
+		slot_count *= key_range + 1;
+		if (slot_count > PerfectHashJoinExecutor::MAX_BITMAP_BUILD_SIZE) {
+			return;
+		}
+		join_state.probe_min.push_back(NumericStats::Min(stats_probe));
+		join_state.probe_max.push_back(NumericStats::Max(stats_probe));
+		join_state.build_min.push_back(NumericStats::Min(stats_build));
+		join_state.build_max.push_back(NumericStats::Max(stats_build));
+		if (NumericStats::Min(stats_probe) < NumericStats::Min(stats_build) ||
+		    NumericStats::Max(stats_build) < NumericStats::Max(stats_probe)) {
+			is_probe_in_domain = false;
+		}
 	}
-
-	// The max size our build must have to run the perfect HJ
-	const idx_t MAX_BUILD_SIZE = 1000000;
-	join_state.probe_min = NumericStats::Min(stats_probe);
-	join_state.probe_max = NumericStats::Max(stats_probe);
-	join_state.build_min = NumericStats::Min(stats_build);
-	join_state.build_max = NumericStats::Max(stats_build);
 	join_state.estimated_cardinality = op.estimated_cardinality;
-	join_state.build_range = NumericCast<idx_t>(build_range);
-	if (join_state.build_range > MAX_BUILD_SIZE) {
-		return;
-	}
-	if (NumericStats::Min(stats_build) <= NumericStats::Min(stats_probe) &&
-	    NumericStats::Max(stats_probe) <= NumericStats::Max(stats_build)) {
-		join_state.is_probe_in_domain = true;
+	join_state.build_range = slot_count - 1;
+	if (slot_count > PerfectHashJoinExecutor::MAX_BUILD_SIZE) {
+		// too many slots to store the payload for every slot: only store it for the occupied slots,
+		// which is only worth it if the build side is expected to occupy a reasonable fraction of them
+		if (build_cardinality * PerfectHashJoinExecutor::BITMAP_DENSITY_FACTOR < slot_count) {
+			return;
+		}
+		join_state.is_bitmap_indexed = true;
 	}
+	join_state.is_probe_in_domain = is_probe_in_domain;
 	join_state.is_build_small = true;
 	return;
 }
@@ -156,9 +171,311 @@ bool PhysicalPlanGenerator::HasEquality(vector<JoinCondition> &conds, idx_t &ran
 	return false;
 }
 
+//! Plans an index join, if one side of an inner equality join scans a table with a unique index on the join key,
+//! and the other side is small enough that probing the index is cheaper than scanning the table
+static unique_ptr<PhysicalOperator> PlanIndexJoin(ClientContext &context, LogicalComparisonJoin &op,
+                                                  unique_ptr<PhysicalOperator> &left,
+                                                  unique_ptr<PhysicalOperator> &right) {
+	auto index_join_threshold = ClientConfig::GetConfig(context).index_join_threshold;
+	if (index_join_threshold == 0 || op.type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN ||
+	    op.join_type != JoinType::INNER || op.conditions.size() != 1 ||
+	    op.conditions[0].comparison != ExpressionType::COMPARE_EQUAL) {
+		return nullptr;
+	}
+	auto &condition = op.conditions[0];
+
+	// we prefer probing the index of the RHS table, and then try the LHS table
+	for (idx_t inner_idx = 2; inner_idx-- > 0;) {
+		auto outer_first = inner_idx == 1;
+		auto &outer = outer_first ? left : right;
+		auto &inner = outer_first ? right : left;
+		auto outer_cardinality = MaxValue<idx_t>(outer->estimated_cardinality, 1);
+		if (inner->estimated_cardinality / outer_cardinality < index_join_threshold) {
+			continue;
+		}
+
+		// the table must be scanned without any filters
+		auto &inner_op = *op.children[inner_idx];
+		if (inner_op.type != LogicalOperatorType::LOGICAL_GET) {
+			continue;
+		}
+		auto &get = inner_op.Cast<LogicalGet>();
+		auto table = get.GetTable();
+		if (!table || !table->IsDuckTable() || get.function.name != "seq_scan" ||
+		    !get.table_filters.filters.empty()) {
+			continue;
+		}
+
+		// the join key of the table must be one of its columns
+		auto &inner_key = outer_first ? *condition.right : *condition.left;
+		if (inner_key.type != ExpressionType::BOUND_REF) {
+			continue;
+		}
+		auto &column_ids = get.GetColumnIds();
+		vector<column_t> output_column_ids;
+		if (get.projection_ids.empty()) {
+			output_column_ids = column_ids;
+		} else {
+			for (auto &projection_id : get.projection_ids) {
+				output_column_ids.push_back(column_ids[projection_id]);
+			}
+		}
+		auto key_column_id = output_column_ids[inner_key.Cast<BoundReferenceExpression>().index];
+		if (key_column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			continue;
+		}
+
+		// find a single-column unique index on the join key
+		// we require a unique index, because transaction-local storage only maintains unique indexes
+		optional_ptr<ART> join_index;
+		auto &info = table->GetStorage().GetDataTableInfo();
+		info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art) {
+			if (art.GetConstraintType() == IndexConstraintType::NONE || art.unbound_expressions.size() != 1 ||
+			    art.unbound_expressions[0]->type != ExpressionType::BOUND_COLUMN_REF ||
+			    art.GetColumnIds()[0] != key_column_id || art.logical_types[0] != inner_key.return_type) {
+				return false;
+			}
+			join_index = &art;
+			return true;
+		});
+		if (!join_index) {
+			continue;
+		}
+
+		// fetch the table columns that are part of the output
+		auto &inner_projection_map = outer_first ? op.right_projection_map : op.left_projection_map;
+		auto inner_column_count =
+		    inner_projection_map.empty() ? output_column_ids.size() : inner_projection_map.size();
+		vector<column_t> fetch_ids;
+		vector<LogicalType> fetch_types;
+		for (idx_t i = 0; i < inner_column_count; i++) {
+			auto column_id = output_column_ids[inner_projection_map.empty() ? i : inner_projection_map[i]];
+			if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+				fetch_ids.push_back(column_id);
+				fetch_types.push_back(LogicalType::ROW_TYPE);
+				continue;
+			}
+			auto &column = table->GetColumn(LogicalIndex(column_id));
+			fetch_ids.push_back(column.StorageOid());
+			fetch_types.push_back(column.Type());
+		}
+		if (fetch_ids.empty()) {
+			fetch_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+			fetch_types.push_back(LogicalType::ROW_TYPE);
+		}
+
+		auto outer_key = std::move(outer_first ? condition.left : condition.right);
+		auto &outer_projection_map = outer_first ? op.left_projection_map : op.right_projection_map;
+		return make_uniq<PhysicalIndexJoin>(op, std::move(outer), std::move(inner), std::move(outer_key), *table,
+		                                    *join_index, std::move(fetch_ids), std::move(fetch_types),
+		                                    inner_column_count, outer_projection_map, outer_first,
+		                                    op.estimated_cardinality);
+	}
+	return nullptr;
+}
+
+static bool IsOrderedOn(BoundOrderByNode &node, idx_t column) {
+	auto &expr = *node.expression;
+	return expr.GetExpressionClass() == ExpressionClass::BOUND_REF &&
+	       expr.Cast<BoundReferenceExpression>().index == column;
+}
+
+//! Whether the join is an inner join on equalities between columns, with keys that can be compared by their sort keys
+static bool IsColumnEquiJoin(LogicalComparisonJoin &op) {
+	if (op.type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN || op.join_type != JoinType::INNER ||
+	    op.conditions.empty()) {
+		return false;
+	}
+	for (auto &cond : op.conditions) {
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL) {
+			return false;
+		}
+		if (cond.left->GetExpressionClass() != ExpressionClass::BOUND_REF ||
+		    cond.right->GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			return false;
+		}
+		if (cond.left->return_type != cond.right->return_type ||
+		    !PhysicalMergeJoin::SupportsKeyType(cond.left->return_type)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Whether both inputs of the join are sorted on (exactly) the join keys, in the same way
+static bool CanUseMergeJoin(ClientContext &context, LogicalComparisonJoin &op, vector<OrderType> &key_orders) {
+	if (!ClientConfig::GetConfig(context).enable_optimizer || !IsColumnEquiJoin(op)) {
+		return false;
+	}
+	vector<idx_t> left_columns;
+	vector<idx_t> right_columns;
+	for (auto &cond : op.conditions) {
+		left_columns.push_back(cond.left->Cast<BoundReferenceExpression>().index);
+		right_columns.push_back(cond.right->Cast<BoundReferenceExpression>().index);
+	}
+	auto left_order = PhysicalPlanGenerator::GetOrderedInput(*op.children[0], left_columns);
+	auto right_order = PhysicalPlanGenerator::GetOrderedInput(*op.children[1], right_columns);
+	if (!left_order || !right_order) {
+		return false;
+	}
+	// the first orders of both inputs have to be on the keys of the conditions, in the same direction
+	if (left_order->orders.size() < op.conditions.size() || right_order->orders.size() < op.conditions.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < op.conditions.size(); i++) {
+		auto &left_node = left_order->orders[i];
+		auto &right_node = right_order->orders[i];
+		if (!IsOrderedOn(left_node, left_columns[i]) || !IsOrderedOn(right_node, right_columns[i])) {
+			return false;
+		}
+		if (left_node.type != right_node.type) {
+			return false;
+		}
+		key_orders.push_back(left_node.type);
+	}
+	return true;
+}
+
+//! Resolves a column of the output of a join to the child it comes from, and its column in that child
+static pair<idx_t, idx_t> ResolveJoinColumn(LogicalComparisonJoin &join, idx_t column) {
+	auto &left_map = join.left_projection_map;
+	auto &right_map = join.right_projection_map;
+	const auto left_count = left_map.empty() ? join.children[0]->types.size() : left_map.size();
+	if (column < left_count) {
+		return pair<idx_t, idx_t>(0, left_map.empty() ? column : left_map[column]);
+	}
+	column -= left_count;
+	return pair<idx_t, idx_t>(1, right_map.empty() ? column : right_map[column]);
+}
+
+static string ConditionName(const JoinCondition &cond) {
+	return StringUtil::Format("%s %s %s", cond.left->GetName(), ExpressionTypeToOperator(cond.comparison),
+	                          cond.right->GetName());
+}
+
+//! Plans a multiway join if this join closes a cycle of three inputs: one child is a join, and the conditions connect
+//! the other child to both children of that join. The binary plan materializes the child join first, so we only do
+//! this if the child join is (estimated to be) larger than the three inputs together
+unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanMultiwayJoin(LogicalComparisonJoin &op) {
+	if (!ClientConfig::GetConfig(context).enable_optimizer || !recursive_cte_tables.empty() || !IsColumnEquiJoin(op)) {
+		return nullptr;
+	}
+	for (idx_t join_idx = 0; join_idx < 2; join_idx++) {
+		if (op.children[join_idx]->type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+			continue;
+		}
+		auto &child_join = op.children[join_idx]->Cast<LogicalComparisonJoin>();
+		if (!IsColumnEquiJoin(child_join)) {
+			continue;
+		}
+		// the probe side of the join that is on the probe side stays the probe side (input 0)
+		vector<reference<LogicalOperator>> inputs;
+		if (join_idx == 0) {
+			inputs = {*child_join.children[0], *child_join.children[1], *op.children[1]};
+		} else {
+			inputs = {*op.children[0], *child_join.children[0], *child_join.children[1]};
+		}
+		const idx_t join_input_offset = join_idx == 0 ? 0 : 1;
+		const idx_t other_input = join_idx == 0 ? 2 : 0;
+
+		// sort the conditions into the three edges of the cycle
+		vector<MultiwayJoinBuildKeys> build_keys(2);
+		vector<string> condition_names;
+		auto add_condition = [&](pair<idx_t, idx_t> lhs, pair<idx_t, idx_t> rhs) {
+			if (lhs.first > rhs.first) {
+				std::swap(lhs, rhs);
+			}
+			if (lhs.first == 0) {
+				auto &keys = build_keys[rhs.first - 1];
+				keys.probe_columns.push_back(lhs.second);
+				keys.build_columns.push_back(rhs.second);
+			} else {
+				build_keys[0].shared_columns.push_back(lhs.second);
+				build_keys[1].shared_columns.push_back(rhs.second);
+			}
+		};
+		for (auto &cond : child_join.conditions) {
+			add_condition(make_pair(join_input_offset, cond.left->Cast<BoundReferenceExpression>().index),
+			              make_pair(join_input_offset + 1, cond.right->Cast<BoundReferenceExpression>().index));
+			condition_names.push_back(ConditionName(cond));
+		}
+		for (auto &cond : op.conditions) {
+			auto &join_key = join_idx == 0 ? *cond.left : *cond.right;
+			auto &other_key = join_idx == 0 ? *cond.right : *cond.left;
+			auto join_column = ResolveJoinColumn(child_join, join_key.Cast<BoundReferenceExpression>().index);
+			add_condition(make_pair(join_input_offset + join_column.first, join_column.second),
+			              make_pair(other_input, other_key.Cast<BoundReferenceExpression>().index));
+			condition_names.push_back(ConditionName(cond));
+		}
+		if (build_keys[0].probe_columns.empty() || build_keys[1].probe_columns.empty() ||
+		    build_keys[0].shared_columns.empty()) {
+			// the inputs do not form a cycle
+			continue;
+		}
+
+		vector<idx_t> input_cardinalities;
+		idx_t total_input_cardinality = 0;
+		for (auto &input : inputs) {
+			input_cardinalities.push_back(input.get().EstimateCardinality(context));
+			total_input_cardinality += input_cardinalities.back();
+		}
+		if (child_join.EstimateCardinality(context) <= total_input_cardinality) {
+			continue;
+		}
+		// the build sides cannot spill: if their memory cannot be reserved, the hash joins are used instead
+		idx_t build_size = 0;
+		for (idx_t input_idx = 1; input_idx < inputs.size(); input_idx++) {
+			build_size +=
+			    PhysicalMultiwayJoin::EstimateBuildSize(inputs[input_idx].get().types, input_cardinalities[input_idx]);
+		}
+		auto memory_state = TemporaryMemoryManager::Get(context).Register(context);
+		memory_state->SetMinimumReservation(0);
+		memory_state->SetRemainingSizeAndUpdateReservation(context, build_size);
+		if (memory_state->GetReservation() < build_size) {
+			continue;
+		}
+
+		// the output columns of both children, resolved to the inputs
+		vector<pair<idx_t, idx_t>> output_columns;
+		for (idx_t child_idx = 0; child_idx < 2; child_idx++) {
+			auto &projection_map = child_idx == 0 ? op.left_projection_map : op.right_projection_map;
+			auto column_count = projection_map.empty() ? op.children[child_idx]->types.size() : projection_map.size();
+			for (idx_t i = 0; i < column_count; i++) {
+				auto column = projection_map.empty() ? i : projection_map[i];
+				if (child_idx != join_idx) {
+					output_columns.emplace_back(other_input, column);
+					continue;
+				}
+				auto join_column = ResolveJoinColumn(child_join, column);
+				output_columns.emplace_back(join_input_offset + join_column.first, join_column.second);
+			}
+		}
+		D_ASSERT(output_columns.size() == op.types.size());
+
+		vector<unique_ptr<PhysicalOperator>> plans;
+		for (idx_t input_idx = 0; input_idx < inputs.size(); input_idx++) {
+			auto plan = CreatePlan(inputs[input_idx].get());
+			plan->estimated_cardinality = input_cardinalities[input_idx];
+			plans.push_back(std::move(plan));
+		}
+		return make_uniq<PhysicalMultiwayJoin>(op, std::move(plans[0]), std::move(plans[1]), std::move(plans[2]),
+		                                       std::move(build_keys), std::move(output_columns),
+		                                       std::move(condition_names), op.estimated_cardinality);
+	}
+	return nullptr;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalComparisonJoin &op) {
 	// now visit the children
 	D_ASSERT(op.children.size() == 2);
+	// a join that closes a cycle is planned together with its child join, before the children are planned
+	auto multiway_join = PlanMultiwayJoin(op);
+	if (multiway_join) {
+		return multiway_join;
+	}
+	// planning the children moves the orders out of the logical plan, so we check for a merge join first
+	vector<OrderType> merge_key_orders;
+	bool use_merge_join = CanUseMergeJoin(context, op, merge_key_orders);
 	idx_t lhs_cardinality = op.children[0]->EstimateCardinality(context);
 	idx_t rhs_cardinality = op.children[1]->EstimateCardinality(context);
 	auto left = CreatePlan(*op.children[0]);
@@ -172,6 +489,16 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 		return make_uniq<PhysicalCrossProduct>(op.types, std::move(left), std::move(right), op.estimated_cardinality);
 	}
 
+	auto index_join = PlanIndexJoin(context, op, left, right);
+	if (index_join) {
+		return index_join;
+	}
+	if (use_merge_join) {
+		// both inputs are sorted on the keys: merge them instead of building a hash table
+		return make_uniq<PhysicalMergeJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
+		                                    std::move(merge_key_orders), op.estimated_cardinality);
+	}
+
 	idx_t has_range = 0;
 	bool has_equality = HasEquality(op.conditions, has_range);
 	bool can_merge = has_range > 0;
@@ -197,11 +524,13 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 	if (has_equality && !prefer_range_joins) {
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
-		CheckForPerfectJoinOpt(op, perfect_join_stats);
-		plan =
+		CheckForPerfectJoinOpt(op, right->estimated_cardinality, perfect_join_stats);
+		auto hash_join =
 		    make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions), op.join_type,
 		                                op.left_projection_map, op.right_projection_map, std::move(op.mark_types),
 		                                op.estimated_cardinality, perfect_join_stats, std::move(op.filter_pushdown));
+		hash_join->build_feedback_key = std::move(op.build_feedback_key);
+		plan = std::move(hash_join);
 
 	} else {
 		if (left->estimated_cardinality <= client_config.nested_loop_join_threshold ||
@@ -56,6 +56,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCopyToFile
 	copy->partition_output = op.partition_output;
 	copy->partition_columns = op.partition_columns;
 	copy->write_partition_columns = op.write_partition_columns;
+	copy->buffer_partitions = op.buffer_partitions;
 	copy->names = op.names;
 	copy->expected_types = op.expected_types;
 	copy->parallel = mode == CopyFunctionExecutionMode::PARALLEL_COPY_TO_FILE;
@@ -2,7 +2,9 @@
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/operator/filter/physical_filter.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/execution/index/brin/block_range_index.hpp"
 #include "duckdb/execution/operator/schema/physical_create_art_index.hpp"
+#include "duckdb/execution/operator/schema/physical_create_block_range_index.hpp"
 #include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/planner/operator/logical_create_index.hpp"
@@ -30,10 +32,11 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateInde
 		}
 	}
 
-	// if we get here and the index type is not ART, we throw an exception
+	// if we get here and the index type is neither ART nor BRIN, we throw an exception
 	// because we don't support any other index type yet. However, an operator extension could have
 	// replaced this part of the plan with a different index creation operator.
-	if (op.info->index_type != ART::TYPE_NAME) {
+	auto is_block_range_index = op.info->index_type == BlockRangeIndex::TYPE_NAME;
+	if (op.info->index_type != ART::TYPE_NAME && !is_block_range_index) {
 		throw BinderException("Unknown index type: " + op.info->index_type);
 	}
 
@@ -76,6 +79,15 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateInde
 	null_filter->types.emplace_back(LogicalType::ROW_TYPE);
 	null_filter->children.push_back(std::move(projection));
 
+	// block range indexes summarize the key ranges in row id order, so we never sort
+	if (is_block_range_index) {
+		auto physical_create_index = make_uniq<PhysicalCreateBlockRangeIndex>(
+		    op, op.table, op.info->column_ids, std::move(op.info), std::move(op.unbound_expressions),
+		    op.estimated_cardinality);
+		physical_create_index->children.push_back(std::move(null_filter));
+		return std::move(physical_create_index);
+	}
+
 	// determine if we sort the data prior to index creation
 	// we don't sort, if either VARCHAR or compound key
 	auto perform_sorting = true;
@@ -1,18 +1,109 @@
 #include "duckdb/execution/operator/filter/physical_filter.hpp"
+#include "duckdb/execution/operator/order/physical_grouped_top_n.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/client_config.hpp"
 #include "duckdb/optimizer/matcher/expression_matcher.hpp"
 #include "duckdb/planner/expression/bound_comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
 #include "duckdb/planner/operator/logical_filter.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_window.hpp"
 
 namespace duckdb {
 
+//! Returns the limit on the row number if the filter is of the form "row_number <= N", or 0 otherwise
+static idx_t GetRowNumberLimit(const Expression &expr, idx_t row_number_idx) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_COMPARISON) {
+		return 0;
+	}
+	auto &comparison = expr.Cast<BoundComparisonExpression>();
+	auto comparison_type = comparison.type;
+	auto left = comparison.left.get();
+	auto right = comparison.right.get();
+	if (left->GetExpressionClass() == ExpressionClass::BOUND_CONSTANT) {
+		std::swap(left, right);
+		comparison_type = FlipComparisonExpression(comparison_type);
+	}
+	if (left->GetExpressionClass() != ExpressionClass::BOUND_REF ||
+	    left->Cast<BoundReferenceExpression>().index != row_number_idx ||
+	    right->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+		return 0;
+	}
+	auto &constant = right->Cast<BoundConstantExpression>().value;
+	if (constant.IsNull() || constant.type() != LogicalType::BIGINT) {
+		return 0;
+	}
+	auto value = constant.GetValue<int64_t>();
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+		value--;
+		break;
+	case ExpressionType::COMPARE_EQUAL:
+		if (value != 1) {
+			return 0;
+		}
+		break;
+	default:
+		return 0;
+	}
+	if (value <= 0 || idx_t(value) > PhysicalGroupedTopN::MAX_LIMIT) {
+		return 0;
+	}
+	return idx_t(value);
+}
+
+//! A filter that only keeps the first N rows of the row_number() of a window can be planned as a PhysicalGroupedTopN,
+//! which only keeps N rows per partition instead of sorting the partitions entirely.
+//! Returns N (and removes the filters on the row number), or 0 if the filter cannot be planned as such
+static idx_t GetGroupedTopNLimit(ClientContext &context, LogicalFilter &op) {
+	if (!ClientConfig::GetConfig(context).enable_optimizer ||
+	    op.children[0]->type != LogicalOperatorType::LOGICAL_WINDOW) {
+		return 0;
+	}
+	auto &window = op.children[0]->Cast<LogicalWindow>();
+	if (window.expressions.size() != 1 || window.expressions[0]->type != ExpressionType::WINDOW_ROW_NUMBER) {
+		return 0;
+	}
+	auto &wexpr = window.expressions[0]->Cast<BoundWindowExpression>();
+	if (wexpr.orders.empty() || wexpr.filter_expr) {
+		return 0;
+	}
+
+	// find the filters on the row number
+	auto row_number_idx = window.types.size() - 1;
+	idx_t limit = 0;
+	vector<unique_ptr<Expression>> remaining_filters;
+	for (auto &expr : op.expressions) {
+		auto expr_limit = GetRowNumberLimit(*expr, row_number_idx);
+		if (expr_limit == 0) {
+			remaining_filters.push_back(std::move(expr));
+			continue;
+		}
+		limit = limit == 0 ? expr_limit : MinValue<idx_t>(limit, expr_limit);
+	}
+	op.expressions = std::move(remaining_filters);
+	return limit;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalFilter &op) {
 	D_ASSERT(op.children.size() == 1);
-	unique_ptr<PhysicalOperator> plan = CreatePlan(*op.children[0]);
+	unique_ptr<PhysicalOperator> plan;
+	auto grouped_top_n_limit = GetGroupedTopNLimit(context, op);
+	if (grouped_top_n_limit > 0) {
+		auto &window = op.children[0]->Cast<LogicalWindow>();
+		auto &wexpr = window.expressions[0]->Cast<BoundWindowExpression>();
+		auto top_n = make_uniq<PhysicalGroupedTopN>(window.types, std::move(wexpr.partitions), std::move(wexpr.orders),
+		                                            grouped_top_n_limit, op.estimated_cardinality);
+		top_n->children.push_back(CreatePlan(*window.children[0]));
+		plan = std::move(top_n);
+	} else {
+		plan = CreatePlan(*op.children[0]);
+	}
 	if (!op.expressions.empty()) {
 		D_ASSERT(plan->types.size() > 0);
 		// create a filter if there is anything to filter
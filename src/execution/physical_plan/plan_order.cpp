@@ -1,9 +1,37 @@
 #include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
 
 namespace duckdb {
 
+optional_ptr<LogicalOrder> PhysicalPlanGenerator::GetOrderedInput(LogicalOperator &input, vector<idx_t> &columns) {
+	auto child = &input;
+	while (child->type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		for (auto &column : columns) {
+			auto &expr = *child->expressions[column];
+			if (expr.GetExpressionClass() != ExpressionClass::BOUND_REF) {
+				return nullptr;
+			}
+			column = expr.Cast<BoundReferenceExpression>().index;
+		}
+		child = child->children[0].get();
+	}
+	if (child->type != LogicalOperatorType::LOGICAL_ORDER_BY) {
+		return nullptr;
+	}
+	auto &order = child->Cast<LogicalOrder>();
+	if (order.orders.empty()) {
+		return nullptr;
+	}
+	if (!order.projections.empty()) {
+		for (auto &column : columns) {
+			column = order.projections[column];
+		}
+	}
+	return &order;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalOrder &op) {
 	D_ASSERT(op.children.size() == 1);
 
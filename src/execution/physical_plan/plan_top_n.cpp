@@ -1,16 +1,251 @@
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/execution/operator/order/physical_top_n.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
 
+//! Columns that are not needed for ordering are not carried through the heap, but fetched for the final rows only
+struct TopNLateMaterialization {
+	optional_ptr<DuckTableEntry> table;
+	vector<column_t> fetch_column_ids;
+	vector<idx_t> output_columns;
+	idx_t row_id_index = DConstants::INVALID_INDEX;
+};
+
+static void GetReferencedColumns(const Expression &expr, unordered_set<idx_t> &referenced_columns) {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_REF) {
+		referenced_columns.insert(expr.Cast<BoundReferenceExpression>().index);
+	}
+	ExpressionIterator::EnumerateChildren(
+	    expr, [&](const Expression &child) { GetReferencedColumns(child, referenced_columns); });
+}
+
+static void ReplaceReferencedColumns(Expression &expr, const vector<idx_t> &column_map) {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_REF) {
+		auto &bound_ref = expr.Cast<BoundReferenceExpression>();
+		D_ASSERT(column_map[bound_ref.index] != DConstants::INVALID_INDEX);
+		bound_ref.index = column_map[bound_ref.index];
+	}
+	ExpressionIterator::EnumerateChildren(expr,
+	                                      [&](Expression &child) { ReplaceReferencedColumns(child, column_map); });
+}
+
+//! A Top-N directly on top of a scan of a DuckDB table only needs to scan the columns it orders by (and the row ids):
+//! the other columns are fetched from the table for the rows that end up in the result
+static bool PlanLateMaterialization(LogicalTopN &op, TopNLateMaterialization &result) {
+	if (op.limit + op.offset > PhysicalTopN::MAX_LATE_MATERIALIZATION_ROWS) {
+		return false;
+	}
+	if (op.children[0]->type != LogicalOperatorType::LOGICAL_GET) {
+		return false;
+	}
+	auto &get = op.children[0]->Cast<LogicalGet>();
+	if (!get.children.empty() || get.function.name != "seq_scan" || !get.bind_data || get.dynamic_filters) {
+		return false;
+	}
+	auto &bind_data = get.bind_data->Cast<TableScanBindData>();
+	if (bind_data.is_index_scan) {
+		return false;
+	}
+	auto &column_ids = get.GetMutableColumnIds();
+
+	// for every output column of the scan, the index in the column ids
+	vector<idx_t> scan_outputs;
+	if (get.projection_ids.empty()) {
+		for (idx_t i = 0; i < column_ids.size(); i++) {
+			scan_outputs.push_back(i);
+		}
+	} else {
+		scan_outputs = get.projection_ids;
+	}
+	unordered_set<idx_t> order_columns;
+	for (auto &order : op.orders) {
+		GetReferencedColumns(*order.expression, order_columns);
+	}
+
+	// figure out which output columns the heap needs, and which ones can be fetched late
+	vector<idx_t> payload_outputs;
+	vector<idx_t> fetch_outputs;
+	for (idx_t out_idx = 0; out_idx < scan_outputs.size(); out_idx++) {
+		auto column_id = column_ids[scan_outputs[out_idx]];
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID || order_columns.find(out_idx) != order_columns.end()) {
+			payload_outputs.push_back(out_idx);
+		} else {
+			fetch_outputs.push_back(out_idx);
+		}
+	}
+	if (fetch_outputs.empty()) {
+		return false;
+	}
+
+	// remove the fetched columns from the scan, unless they are needed for the table filters
+	unordered_set<idx_t> fetch_indexes;
+	for (auto &out_idx : fetch_outputs) {
+		auto column_id = column_ids[scan_outputs[out_idx]];
+		if (get.table_filters.filters.find(column_id) == get.table_filters.filters.end()) {
+			fetch_indexes.insert(scan_outputs[out_idx]);
+		}
+	}
+	vector<column_t> new_column_ids;
+	vector<idx_t> new_indexes(column_ids.size(), DConstants::INVALID_INDEX);
+	idx_t row_id_column = DConstants::INVALID_INDEX;
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		if (fetch_indexes.find(i) != fetch_indexes.end()) {
+			continue;
+		}
+		if (column_ids[i] == COLUMN_IDENTIFIER_ROW_ID) {
+			row_id_column = new_column_ids.size();
+		}
+		new_indexes[i] = new_column_ids.size();
+		new_column_ids.push_back(column_ids[i]);
+	}
+	if (row_id_column == DConstants::INVALID_INDEX) {
+		row_id_column = new_column_ids.size();
+		new_column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+	}
+
+	// the scan now emits the payload columns, followed by the row ids (if they are not emitted already)
+	vector<idx_t> new_projection_ids;
+	vector<idx_t> payload_map(scan_outputs.size(), DConstants::INVALID_INDEX);
+	for (auto &out_idx : payload_outputs) {
+		auto index = new_indexes[scan_outputs[out_idx]];
+		if (index == row_id_column) {
+			result.row_id_index = new_projection_ids.size();
+		}
+		payload_map[out_idx] = new_projection_ids.size();
+		new_projection_ids.push_back(index);
+	}
+	if (result.row_id_index == DConstants::INVALID_INDEX) {
+		result.row_id_index = new_projection_ids.size();
+		new_projection_ids.push_back(row_id_column);
+	}
+	auto payload_count = new_projection_ids.size();
+
+	// the output columns are either read from the payload or fetched from the table
+	result.table = bind_data.table;
+	for (idx_t out_idx = 0; out_idx < scan_outputs.size(); out_idx++) {
+		if (payload_map[out_idx] != DConstants::INVALID_INDEX) {
+			result.output_columns.push_back(payload_map[out_idx]);
+			continue;
+		}
+		auto column_id = column_ids[scan_outputs[out_idx]];
+		auto &column = bind_data.table.GetColumn(LogicalIndex(column_id));
+		result.output_columns.push_back(payload_count + result.fetch_column_ids.size());
+		result.fetch_column_ids.push_back(column.StorageOid());
+	}
+
+	// finally, update the scan and let the orders refer to the payload columns
+	bool identity_projection = new_projection_ids.size() == new_column_ids.size();
+	for (idx_t i = 0; identity_projection && i < new_projection_ids.size(); i++) {
+		identity_projection = new_projection_ids[i] == i;
+	}
+	if (identity_projection) {
+		new_projection_ids.clear();
+	}
+	get.SetColumnIds(std::move(new_column_ids));
+	get.projection_ids = std::move(new_projection_ids);
+	for (auto &order : op.orders) {
+		ReplaceReferencedColumns(*order.expression, payload_map);
+	}
+	return true;
+}
+
+static bool SupportsDynamicFilter(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::UHUGEINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Pushes a filter on the first order into the scan below the Top-N, which is set to the boundary value of the heap
+//! once it is full. The scan can then skip row groups and segments that cannot contain rows that make it into the heap
+static shared_ptr<DynamicFilterData> PushDynamicFilter(LogicalTopN &op) {
+	if (op.children[0]->type != LogicalOperatorType::LOGICAL_GET) {
+		return nullptr;
+	}
+	auto &get = op.children[0]->Cast<LogicalGet>();
+	if (!get.children.empty() || !get.function.filter_pushdown ||
+	    (get.function.name != "seq_scan" && get.function.name != "parquet_scan")) {
+		return nullptr;
+	}
+	auto &order = op.orders[0];
+	if (order.null_order != OrderByNullType::NULLS_LAST) {
+		// NULL values always make it into the heap, but cannot pass a comparison filter
+		return nullptr;
+	}
+	if (order.expression->GetExpressionClass() != ExpressionClass::BOUND_REF ||
+	    !SupportsDynamicFilter(order.expression->return_type)) {
+		return nullptr;
+	}
+	auto &column_ids = get.GetColumnIds();
+	auto scan_idx = order.expression->Cast<BoundReferenceExpression>().index;
+	auto column_id = get.projection_ids.empty() ? column_ids[scan_idx] : column_ids[get.projection_ids[scan_idx]];
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return nullptr;
+	}
+
+	// rows that are equal to the boundary value can only make it into the heap if there are more orders
+	ExpressionType comparison_type;
+	bool single_order = op.orders.size() == 1;
+	if (order.type == OrderType::ASCENDING) {
+		comparison_type =
+		    single_order ? ExpressionType::COMPARE_LESSTHAN : ExpressionType::COMPARE_LESSTHANOREQUALTO;
+	} else {
+		comparison_type =
+		    single_order ? ExpressionType::COMPARE_GREATERTHAN : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+	}
+	auto filter_data = make_shared_ptr<DynamicFilterData>(comparison_type);
+	get.table_filters.PushFilter(column_id, make_uniq<DynamicFilter>(filter_data));
+	return filter_data;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalTopN &op) {
 	D_ASSERT(op.children.size() == 1);
 
+	TopNLateMaterialization late_materialization;
+	bool materialize_late = PlanLateMaterialization(op, late_materialization);
+	auto dynamic_filter = PushDynamicFilter(op);
+
 	auto plan = CreatePlan(*op.children[0]);
 
 	auto top_n = make_uniq<PhysicalTopN>(op.types, std::move(op.orders), NumericCast<idx_t>(op.limit),
 	                                     NumericCast<idx_t>(op.offset), op.estimated_cardinality);
+	if (materialize_late) {
+		top_n->payload_types = plan->types;
+		top_n->fetch_table = late_materialization.table;
+		top_n->row_id_index = late_materialization.row_id_index;
+		top_n->fetch_column_ids = std::move(late_materialization.fetch_column_ids);
+		top_n->output_columns = std::move(late_materialization.output_columns);
+	}
+	top_n->dynamic_filter = std::move(dynamic_filter);
 	top_n->children.push_back(std::move(plan));
 	return std::move(top_n);
 }
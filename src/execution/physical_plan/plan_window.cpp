@@ -3,6 +3,7 @@
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/parser/expression_map.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression/bound_window_expression.hpp"
 #include "duckdb/planner/operator/logical_window.hpp"
@@ -11,6 +12,41 @@
 
 namespace duckdb {
 
+//! Whether "wexpr" can be computed over the sort of "over_expr" although it has more partitions. This is the case if
+//! its additional partitions are the leading orders of "over_expr" (in any order), and its orders follow them
+static bool IsNestedPartition(const BoundWindowExpression &over_expr, const BoundWindowExpression &wexpr) {
+	if (wexpr.partitions.size() <= over_expr.partitions.size()) {
+		return false;
+	}
+	const auto extra_partitions = wexpr.partitions.size() - over_expr.partitions.size();
+	if (extra_partitions + wexpr.orders.size() > over_expr.orders.size()) {
+		return false;
+	}
+	expression_set_t partitions;
+	for (const auto &partition : wexpr.partitions) {
+		partitions.insert(*partition);
+	}
+	if (partitions.size() != wexpr.partitions.size()) {
+		return false;
+	}
+	for (const auto &partition : over_expr.partitions) {
+		if (!partitions.erase(*partition)) {
+			return false;
+		}
+	}
+	for (idx_t i = 0; i < extra_partitions; i++) {
+		if (!partitions.erase(*over_expr.orders[i].expression)) {
+			return false;
+		}
+	}
+	for (idx_t i = 0; i < wexpr.orders.size(); i++) {
+		if (!wexpr.orders[i].Equals(over_expr.orders[extra_partitions + i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op) {
 	D_ASSERT(op.children.size() == 1);
 
@@ -65,10 +101,18 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 				continue;
 			}
 
-			// If it is in a different partition, skip it
+			// If it is in a different partition, skip it - unless the partitions are nested within the sort
 			const auto &over_expr = op.expressions[over_idx]->Cast<BoundWindowExpression>();
 			if (!over_expr.PartitionsAreEquivalent(wexpr)) {
-				unprocessed.emplace_back(expr_idx);
+				if (IsNestedPartition(over_expr, wexpr)) {
+					matching.emplace_back(expr_idx);
+				} else if (IsNestedPartition(wexpr, over_expr)) {
+					// Switch to the coarser partitioning
+					matching.emplace_back(expr_idx);
+					over_idx = expr_idx;
+				} else {
+					unprocessed.emplace_back(expr_idx);
+				}
 				continue;
 			}
 
@@ -380,11 +380,18 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 			thread_limit = temporary_memory_state.GetReservation() / gstate.number_of_threads;
 			if (total_size > thread_limit) {
 				// Out-of-core would be triggered below, try to increase the reservation
-				auto remaining_size =
-				    MaxValue<idx_t>(gstate.number_of_threads * total_size, temporary_memory_state.GetRemainingSize());
-				temporary_memory_state.SetRemainingSizeAndUpdateReservation(context, 2 * remaining_size);
+				auto remaining_size = 2 * MaxValue<idx_t>(gstate.number_of_threads * total_size,
+				                                          temporary_memory_state.GetRemainingSize());
+				// Once out-of-core, all data is spilled and read back, so only a reservation that fits it saves I/O
+				temporary_memory_state.SetCostCurve(
+				    {TemporaryMemoryCost(0, 2 * remaining_size), TemporaryMemoryCost(remaining_size, 0)});
+				temporary_memory_state.SetRemainingSizeAndUpdateReservation(context, remaining_size);
 				thread_limit = temporary_memory_state.GetReservation() / gstate.number_of_threads;
 			}
+		} else if (temporary_memory_state.CanRebalance()) {
+			// Other operators released memory since we went out-of-core, we might not have to spill this time
+			temporary_memory_state.UpdateReservation(context);
+			thread_limit = temporary_memory_state.GetReservation() / gstate.number_of_threads;
 		}
 	}
 
@@ -542,6 +549,8 @@ void RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState
 
 	// Minimum of combining one partition at a time
 	gstate.temporary_memory_state->SetMinimumReservation(gstate.max_partition_size);
+	// The reservation of the scan determines its parallelism, not its I/O
+	gstate.temporary_memory_state->SetCostCurve({});
 	// Set size to 0 until the scan actually starts
 	gstate.temporary_memory_state->SetZero();
 	gstate.finalized = true;
@@ -1,6 +1,7 @@
 #include "duckdb/execution/reservoir_sample.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/pair.hpp"
+#include "duckdb/common/algorithm.hpp"
 
 namespace duckdb {
 
@@ -15,7 +16,8 @@ unique_ptr<ReservoirChunk> ReservoirChunk::Deserialize(Deserializer &deserialize
 }
 
 ReservoirSample::ReservoirSample(Allocator &allocator, idx_t sample_count, int64_t seed)
-    : BlockingSample(seed), allocator(allocator), sample_count(sample_count), reservoir_initialized(false) {
+    : BlockingSample(SampleType::RESERVOIR_SAMPLE, seed), allocator(allocator), sample_count(sample_count),
+      reservoir_initialized(false) {
 }
 
 ReservoirSample::ReservoirSample(idx_t sample_count, int64_t seed)
@@ -155,9 +157,134 @@ void ReservoirSample::Finalize() {
 	return;
 }
 
+//! An entry of one of the reservoirs that are merged
+struct ReservoirMergeEntry {
+	double key;
+	bool from_other;
+	idx_t index;
+};
+
+static void GatherReservoirEntries(BaseReservoirSampling &base, idx_t count, bool from_other,
+                                   vector<ReservoirMergeEntry> &result) {
+	if (base.reservoir_weights.size() != count) {
+		// the reservoir is not full yet, so it holds all entries it has seen and no keys have been assigned yet
+		// every entry gets a random key, which is what the weighted sampling would have assigned it
+		for (idx_t i = 0; i < count; i++) {
+			result.push_back({base.random.NextRandom(), from_other, i});
+		}
+		return;
+	}
+	auto weights = base.reservoir_weights;
+	while (!weights.empty()) {
+		auto &entry = weights.top();
+		result.push_back({-entry.first, from_other, entry.second});
+		weights.pop();
+	}
+}
+
+void ReservoirSample::Merge(BlockingSample &other_p) {
+	auto &other = other_p.Cast<ReservoirSample>();
+	D_ASSERT(sample_count == other.sample_count);
+	auto &base = old_base_reservoir_sample;
+	auto &other_base = other.old_base_reservoir_sample;
+	auto num_entries_seen_total = base.num_entries_seen_total + other_base.num_entries_seen_total;
+	auto this_count = GetSampleCount();
+	auto other_count = other.GetSampleCount();
+	if (other_count == 0) {
+		base.num_entries_seen_total = num_entries_seen_total;
+		return;
+	}
+	if (this_count == 0) {
+		// this sample is empty: take over the other sample
+		reservoir_data_chunk = std::move(other.reservoir_data_chunk);
+		reservoir_initialized = true;
+		base.reservoir_weights = std::move(other_base.reservoir_weights);
+		base.next_index_to_sample = other_base.next_index_to_sample;
+		base.min_weight_threshold = other_base.min_weight_threshold;
+		base.min_weighted_entry_index = other_base.min_weighted_entry_index;
+		base.num_entries_to_skip_b4_next_sample = other_base.num_entries_to_skip_b4_next_sample;
+		base.num_entries_seen_total = num_entries_seen_total;
+		return;
+	}
+	// every entry of a reservoir has a key that is uniformly distributed in [0, 1), and a reservoir holds the entries
+	// with the highest keys of its input. The entries with the highest keys of both reservoirs are thus the entries
+	// with the highest keys of the combined input, i.e. a uniform sample of it
+	vector<ReservoirMergeEntry> entries;
+	entries.reserve(this_count + other_count);
+	GatherReservoirEntries(base, this_count, false, entries);
+	GatherReservoirEntries(other_base, other_count, true, entries);
+	std::sort(entries.begin(), entries.end(),
+	          [](const ReservoirMergeEntry &a, const ReservoirMergeEntry &b) { return a.key > b.key; });
+	auto result_count = MinValue<idx_t>(entries.size(), sample_count);
+
+	SelectionVector this_sel(result_count);
+	SelectionVector other_sel(result_count);
+	idx_t this_sel_count = 0;
+	idx_t other_sel_count = 0;
+	for (idx_t i = 0; i < result_count; i++) {
+		auto &entry = entries[i];
+		if (entry.from_other) {
+			other_sel.set_index(other_sel_count++, entry.index);
+		} else {
+			this_sel.set_index(this_sel_count++, entry.index);
+		}
+	}
+	auto new_chunk = make_uniq<DataChunk>();
+	new_chunk->Initialize(allocator, reservoir_data_chunk->GetTypes(), sample_count);
+	for (idx_t col_idx = 0; col_idx < new_chunk->ColumnCount(); col_idx++) {
+		FlatVector::Validity(new_chunk->data[col_idx]).Initialize(sample_count);
+	}
+	new_chunk->Append(*reservoir_data_chunk, false, &this_sel, this_sel_count);
+	new_chunk->Append(*other.reservoir_data_chunk, false, &other_sel, other_sel_count);
+	reservoir_data_chunk = std::move(new_chunk);
+	other.reservoir_data_chunk.reset();
+
+	// rebuild the weights: the entries are now at the position they were appended at
+	std::priority_queue<std::pair<double, idx_t>> weights;
+	idx_t this_position = 0;
+	idx_t other_position = this_sel_count;
+	for (idx_t i = 0; i < result_count; i++) {
+		auto &entry = entries[i];
+		weights.emplace(-entry.key, entry.from_other ? other_position++ : this_position++);
+	}
+	base.reservoir_weights = std::move(weights);
+	base.num_entries_seen_total = num_entries_seen_total;
+	if (result_count == sample_count) {
+		// the reservoir is full: determine the next entry to replace
+		base.SetNextEntry();
+	} else {
+		// the reservoir is not full yet: the keys are assigned once it is filled
+		base.reservoir_weights = std::priority_queue<std::pair<double, idx_t>>();
+	}
+}
+
+unique_ptr<ReservoirSample> ReservoirSample::Copy() {
+	auto result = make_uniq<ReservoirSample>(allocator, sample_count, random.NextRandomInteger());
+	result->old_base_reservoir_sample.num_entries_seen_total = old_base_reservoir_sample.num_entries_seen_total;
+	auto count = GetSampleCount();
+	if (count == 0) {
+		return result;
+	}
+	result->reservoir_data_chunk = make_uniq<DataChunk>();
+	result->reservoir_data_chunk->Initialize(allocator, reservoir_data_chunk->GetTypes(), sample_count);
+	for (idx_t col_idx = 0; col_idx < reservoir_data_chunk->ColumnCount(); col_idx++) {
+		FlatVector::Validity(result->reservoir_data_chunk->data[col_idx]).Initialize(sample_count);
+	}
+	result->reservoir_data_chunk->Append(*reservoir_data_chunk);
+	result->reservoir_initialized = true;
+	auto &base = old_base_reservoir_sample;
+	auto &result_base = result->old_base_reservoir_sample;
+	result_base.reservoir_weights = base.reservoir_weights;
+	result_base.next_index_to_sample = base.next_index_to_sample;
+	result_base.min_weight_threshold = base.min_weight_threshold;
+	result_base.min_weighted_entry_index = base.min_weighted_entry_index;
+	result_base.num_entries_to_skip_b4_next_sample = base.num_entries_to_skip_b4_next_sample;
+	return result;
+}
+
 ReservoirSamplePercentage::ReservoirSamplePercentage(Allocator &allocator, double percentage, int64_t seed)
-    : BlockingSample(seed), allocator(allocator), sample_percentage(percentage / 100.0), current_count(0),
-      is_finalized(false) {
+    : BlockingSample(SampleType::RESERVOIR_PERCENTAGE_SAMPLE, seed), allocator(allocator),
+      sample_percentage(percentage / 100.0), current_count(0), is_finalized(false) {
 	reservoir_sample_size = idx_t(sample_percentage * RESERVOIR_THRESHOLD);
 	current_sample = make_uniq<ReservoirSample>(allocator, reservoir_sample_size, random.NextRandomInteger());
 }
@@ -166,6 +293,22 @@ ReservoirSamplePercentage::ReservoirSamplePercentage(double percentage, int64_t
     : ReservoirSamplePercentage(Allocator::DefaultAllocator(), percentage, seed) {
 }
 
+void ReservoirSamplePercentage::Merge(BlockingSample &other_p) {
+	auto &other = other_p.Cast<ReservoirSamplePercentage>();
+	// the percentage samples of disjoint parts of the input together form a percentage sample of the combined input
+	if (!is_finalized) {
+		Finalize();
+	}
+	if (!other.is_finalized) {
+		other.Finalize();
+	}
+	for (auto &sample : other.finished_samples) {
+		finished_samples.push_back(std::move(sample));
+	}
+	other.finished_samples.clear();
+	old_base_reservoir_sample.num_entries_seen_total += other.old_base_reservoir_sample.num_entries_seen_total;
+}
+
 void ReservoirSamplePercentage::AddToReservoir(DataChunk &input) {
 	old_base_reservoir_sample.num_entries_seen_total += input.size();
 	if (current_count + input.size() > RESERVOIR_THRESHOLD) {
@@ -171,7 +171,7 @@ WindowInputColumn::WindowInputColumn(optional_ptr<Expression> expr_p, ClientCont
 	if (expr) {
 		vector<LogicalType> types;
 		types.emplace_back(expr->return_type);
-		wtarget.Initialize(Allocator::Get(context), types, count);
+		wtarget.Initialize(BufferAllocator::Get(context), types, count);
 		ptype = expr->return_type.InternalType();
 	}
 }
@@ -927,12 +927,24 @@ public:
 	bool IsDistinctAggregate();
 
 	WindowAggregateExecutorGlobalState(const WindowAggregateExecutor &executor, const idx_t payload_count,
-	                                   const ValidityMask &partition_mask, const ValidityMask &order_mask);
+	                                   const ValidityMask &partition_mask, const ValidityMask &order_mask,
+	                                   optional_ptr<const WindowAggregateExecutorGlobalState> shared_p);
+
+	const WindowAggregator &GetAggregator() const {
+		return shared ? *shared->aggregator : *aggregator;
+	}
+	const WindowAggregatorState &GetSink() const {
+		return shared ? *shared->gsink : *gsink;
+	}
 
 	// aggregate computation algorithm
 	unique_ptr<WindowAggregator> aggregator;
 	// aggregate global state
 	unique_ptr<WindowAggregatorState> gsink;
+	// whether the aggregator builds a segment tree, which other executors can share
+	bool builds_tree = false;
+	// the global state whose segment tree is used instead of building one (if any)
+	optional_ptr<const WindowAggregateExecutorGlobalState> shared;
 };
 
 bool WindowAggregateExecutorGlobalState::IsConstantAggregate() {
@@ -1036,10 +1048,9 @@ WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, C
     : WindowExecutor(wexpr, context), mode(mode) {
 }
 
-WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(const WindowAggregateExecutor &executor,
-                                                                       const idx_t group_count,
-                                                                       const ValidityMask &partition_mask,
-                                                                       const ValidityMask &order_mask)
+WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(
+    const WindowAggregateExecutor &executor, const idx_t group_count, const ValidityMask &partition_mask,
+    const ValidityMask &order_mask, optional_ptr<const WindowAggregateExecutorGlobalState> shared_p)
     : WindowExecutorGlobalState(executor, group_count, partition_mask, order_mask) {
 	auto &wexpr = executor.wexpr;
 	auto &context = executor.context;
@@ -1060,19 +1071,56 @@ WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(const Win
 		aggregator = make_uniq<WindowConstantAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
 	} else if (IsCustomAggregate()) {
 		aggregator = make_uniq<WindowCustomAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
+	} else if (shared_p && shared_p->builds_tree) {
+		// the segment tree does not depend on the frame, so use the one of an identical aggregate
+		shared = shared_p;
+		return;
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
 		aggregator = make_uniq<WindowSegmentTree>(aggr, arg_types, return_type, mode, wexpr.exclude_clause);
+		builds_tree = true;
 	}
 
-	gsink = aggregator->GetGlobalState(group_count, partition_mask);
+	gsink = aggregator->GetGlobalState(context, group_count, partition_mask);
 }
 
 unique_ptr<WindowExecutorGlobalState> WindowAggregateExecutor::GetGlobalState(const idx_t payload_count,
                                                                               const ValidityMask &partition_mask,
                                                                               const ValidityMask &order_mask) const {
-	return make_uniq<WindowAggregateExecutorGlobalState>(*this, payload_count, partition_mask, order_mask);
+	return make_uniq<WindowAggregateExecutorGlobalState>(*this, payload_count, partition_mask, order_mask, nullptr);
+}
+
+bool WindowAggregateExecutor::CanShareAggregator(const WindowAggregateExecutor &other) const {
+	//	The aggregator only depends on the aggregate, its arguments and the ordering of the partition
+	const auto &other_wexpr = other.wexpr;
+	if (mode != other.mode || wexpr.distinct || other_wexpr.distinct ||
+	    wexpr.exclude_clause != other_wexpr.exclude_clause || wexpr.return_type != other_wexpr.return_type) {
+		return false;
+	}
+	if (!wexpr.aggregate || !other_wexpr.aggregate || *wexpr.aggregate != *other_wexpr.aggregate) {
+		return false;
+	}
+	if (wexpr.bind_info.get() != other_wexpr.bind_info.get()) {
+		if (!wexpr.bind_info || !other_wexpr.bind_info || !wexpr.bind_info->Equals(*other_wexpr.bind_info)) {
+			return false;
+		}
+	}
+	if (!Expression::ListEquals(wexpr.children, other_wexpr.children) ||
+	    !Expression::Equals(wexpr.filter_expr, other_wexpr.filter_expr)) {
+		return false;
+	}
+	return wexpr.KeysAreCompatible(other_wexpr);
+}
+
+unique_ptr<WindowExecutorGlobalState>
+WindowAggregateExecutor::GetSharedGlobalState(const idx_t payload_count, const ValidityMask &partition_mask,
+                                              const ValidityMask &order_mask,
+                                              const WindowExecutorGlobalState &shared) const {
+	D_ASSERT(CanShareAggregator(shared.executor.Cast<WindowAggregateExecutor>()));
+	auto &shared_gastate = shared.Cast<WindowAggregateExecutorGlobalState>();
+	return make_uniq<WindowAggregateExecutorGlobalState>(*this, payload_count, partition_mask, order_mask,
+	                                                     shared_gastate);
 }
 
 class WindowAggregateExecutorLocalState : public WindowExecutorBoundsState {
@@ -1081,7 +1129,7 @@ public:
 	    : WindowExecutorBoundsState(gstate), filter_executor(gstate.executor.context) {
 
 		auto &gastate = gstate.Cast<WindowAggregateExecutorGlobalState>();
-		aggregator_state = aggregator.GetLocalState(*gastate.gsink);
+		aggregator_state = aggregator.GetLocalState(gastate.GetSink());
 
 		// evaluate the FILTER clause and stuff it into a large mask for compactness and reuse
 		auto &wexpr = gstate.executor.wexpr;
@@ -1103,7 +1151,7 @@ public:
 unique_ptr<WindowExecutorLocalState>
 WindowAggregateExecutor::GetLocalState(const WindowExecutorGlobalState &gstate) const {
 	auto &gastate = gstate.Cast<WindowAggregateExecutorGlobalState>();
-	auto res = make_uniq<WindowAggregateExecutorLocalState>(gstate, *gastate.aggregator);
+	auto res = make_uniq<WindowAggregateExecutorLocalState>(gstate, gastate.GetAggregator());
 	return std::move(res);
 }
 
@@ -1117,6 +1165,12 @@ void WindowAggregateExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx
 	auto &payload_chunk = lastate.payload_chunk;
 	auto &aggregator = gastate.aggregator;
 
+	// The inputs of a shared aggregator have already been sunk
+	if (gastate.shared) {
+		WindowExecutor::Sink(input_chunk, input_idx, total_count, gstate, lstate);
+		return;
+	}
+
 	idx_t filtered = 0;
 	SelectionVector *filtering = nullptr;
 	if (wexpr.filter_expr) {
@@ -1203,6 +1257,10 @@ void WindowAggregateExecutor::Finalize(WindowExecutorGlobalState &gstate, Window
 	auto &gastate = gstate.Cast<WindowAggregateExecutorGlobalState>();
 	auto &aggregator = gastate.aggregator;
 	auto &gsink = gastate.gsink;
+	// A shared segment tree is built by the executor that owns it
+	if (gastate.shared) {
+		return;
+	}
 	D_ASSERT(aggregator);
 
 	//	Estimate the frame statistics
@@ -1228,13 +1286,12 @@ void WindowAggregateExecutor::EvaluateInternal(WindowExecutorGlobalState &gstate
                                                Vector &result, idx_t count, idx_t row_idx) const {
 	auto &gastate = gstate.Cast<WindowAggregateExecutorGlobalState>();
 	auto &lastate = lstate.Cast<WindowAggregateExecutorLocalState>();
-	auto &aggregator = gastate.aggregator;
-	auto &gsink = gastate.gsink;
-	D_ASSERT(aggregator);
+	auto &aggregator = gastate.GetAggregator();
+	auto &gsink = gastate.GetSink();
 
 	auto &agg_state = *lastate.aggregator_state;
 
-	aggregator->Evaluate(*gsink, agg_state, lastate.bounds, result, count, row_idx);
+	aggregator.Evaluate(gsink, agg_state, lastate.bounds, result, count, row_idx);
 }
 
 //===--------------------------------------------------------------------===//
@@ -1434,7 +1491,7 @@ public:
 
 	{
 		if (!arg_types.empty()) {
-			payload_collection.Initialize(Allocator::Get(executor.context), arg_types, payload_count);
+			payload_collection.Initialize(BufferAllocator::Get(executor.context), arg_types, payload_count);
 		}
 
 		auto &wexpr = executor.wexpr;
@@ -0,0 +1,164 @@
+#include "duckdb/common/owning_string_map.hpp"
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/vector_operations/unary_executor.hpp"
+#include "duckdb/function/scalar/compressed_materialization_functions.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_context_state.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+
+namespace duckdb {
+
+static string StringDictionaryCompressFunctionName() {
+	return "__internal_compress_string_dictionary";
+}
+
+static string StringDictionaryDecompressFunctionName() {
+	return "__internal_decompress_string_dictionary";
+}
+
+//! The dictionary of the strings that were compressed by one compress projection during a query.
+//! Decompressed strings point into the dictionary: it is added as a buffer to the vectors that reference it.
+class CMStringDictionary : public VectorBuffer {
+public:
+	explicit CMStringDictionary(Allocator &allocator)
+	    : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), arena(allocator), codes(arena) {
+	}
+
+public:
+	void Encode(Vector &input, Vector &result, idx_t count) {
+		lock_guard<mutex> guard(lock);
+		UnaryExecutor::Execute<string_t, uint32_t>(input, result, count, [&](const string_t &input_str) {
+			auto entry = codes.find(input_str);
+			if (entry != codes.end()) {
+				return entry->second;
+			}
+			auto code = NumericCast<uint32_t>(strings.size());
+			auto inserted = codes.insert(make_pair(input_str, code));
+			strings.push_back(inserted.first->first);
+			return code;
+		});
+	}
+
+	void Decode(Vector &input, Vector &result, idx_t count) {
+		lock_guard<mutex> guard(lock);
+		UnaryExecutor::Execute<uint32_t, string_t>(input, result, count, [&](const uint32_t &code) {
+			D_ASSERT(code < strings.size());
+			return strings[code];
+		});
+	}
+
+private:
+	mutex lock;
+	ArenaAllocator arena;
+	//! String -> code
+	OwningStringMap<uint32_t> codes;
+	//! Code -> string
+	vector<string_t> strings;
+};
+
+//! Holds the dictionaries of the current query of a client
+class CMStringDictionaryState : public ClientContextState {
+public:
+	static constexpr const char *NAME = "compressed_materialization_dictionaries";
+
+	static shared_ptr<CMStringDictionary> GetDictionary(ClientContext &context, idx_t dictionary_id) {
+		auto state = context.registered_state->GetOrCreate<CMStringDictionaryState>(NAME);
+		lock_guard<mutex> guard(state->lock);
+		auto &dictionary = state->dictionaries[dictionary_id];
+		if (!dictionary) {
+			dictionary = make_shared_ptr<CMStringDictionary>(Allocator::Get(context));
+		}
+		return dictionary;
+	}
+
+	void QueryEnd() override {
+		lock_guard<mutex> guard(lock);
+		dictionaries.clear();
+	}
+
+private:
+	mutex lock;
+	unordered_map<idx_t, shared_ptr<CMStringDictionary>> dictionaries;
+};
+
+CMStringDictionaryFunctionData::CMStringDictionaryFunctionData(idx_t dictionary_id_p)
+    : dictionary_id(dictionary_id_p) {
+}
+
+unique_ptr<FunctionData> CMStringDictionaryFunctionData::Copy() const {
+	return make_uniq<CMStringDictionaryFunctionData>(dictionary_id);
+}
+
+bool CMStringDictionaryFunctionData::Equals(const FunctionData &other_p) const {
+	auto &other = other_p.Cast<CMStringDictionaryFunctionData>();
+	return dictionary_id == other.dictionary_id;
+}
+
+struct StringDictionaryLocalState : public FunctionLocalState {
+public:
+	explicit StringDictionaryLocalState(shared_ptr<CMStringDictionary> dictionary_p)
+	    : dictionary(std::move(dictionary_p)) {
+	}
+
+	static unique_ptr<FunctionLocalState> Init(ExpressionState &state, const BoundFunctionExpression &expr,
+	                                           FunctionData *bind_data) {
+		auto &info = bind_data->Cast<CMStringDictionaryFunctionData>();
+		return make_uniq<StringDictionaryLocalState>(
+		    CMStringDictionaryState::GetDictionary(state.GetContext(), info.dictionary_id));
+	}
+
+public:
+	shared_ptr<CMStringDictionary> dictionary;
+};
+
+static void StringDictionaryCompressFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &dictionary = *ExecuteFunctionState::GetFunctionState(state)->Cast<StringDictionaryLocalState>().dictionary;
+	dictionary.Encode(args.data[0], result, args.size());
+}
+
+static void StringDictionaryDecompressFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &dictionary = ExecuteFunctionState::GetFunctionState(state)->Cast<StringDictionaryLocalState>().dictionary;
+	dictionary->Decode(args.data[0], result, args.size());
+	StringVector::AddBuffer(result, dictionary);
+}
+
+static void CMStringDictionarySerialize(Serializer &serializer, const optional_ptr<FunctionData> bind_data,
+                                        const ScalarFunction &function) {
+	auto &info = bind_data->Cast<CMStringDictionaryFunctionData>();
+	serializer.WriteProperty(100, "dictionary_id", info.dictionary_id);
+}
+
+unique_ptr<FunctionData> CMStringDictionaryDeserialize(Deserializer &deserializer, ScalarFunction &function) {
+	auto dictionary_id = deserializer.ReadProperty<idx_t>(100, "dictionary_id");
+	return make_uniq<CMStringDictionaryFunctionData>(dictionary_id);
+}
+
+ScalarFunction CMStringDictionaryCompressFun::GetFunction() {
+	ScalarFunction result(StringDictionaryCompressFunctionName(), {LogicalType::VARCHAR}, LogicalType::UINTEGER,
+	                      StringDictionaryCompressFunction, CompressedMaterializationFunctions::Bind, nullptr,
+	                      nullptr, StringDictionaryLocalState::Init);
+	result.serialize = CMStringDictionarySerialize;
+	result.deserialize = CMStringDictionaryDeserialize;
+	return result;
+}
+
+void CMStringDictionaryCompressFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(CMStringDictionaryCompressFun::GetFunction());
+}
+
+ScalarFunction CMStringDictionaryDecompressFun::GetFunction() {
+	ScalarFunction result(StringDictionaryDecompressFunctionName(), {LogicalType::UINTEGER}, LogicalType::VARCHAR,
+	                      StringDictionaryDecompressFunction, CompressedMaterializationFunctions::Bind, nullptr,
+	                      nullptr, StringDictionaryLocalState::Init);
+	result.serialize = CMStringDictionarySerialize;
+	result.deserialize = CMStringDictionaryDeserialize;
+	return result;
+}
+
+void CMStringDictionaryDecompressFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(CMStringDictionaryDecompressFun::GetFunction());
+}
+
+} // namespace duckdb
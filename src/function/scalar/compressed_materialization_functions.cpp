@@ -24,6 +24,8 @@ void BuiltinFunctions::RegisterCompressedMaterializationFunctions() {
 	Register<CMIntegralDecompressFun>();
 	Register<CMStringCompressFun>();
 	Register<CMStringDecompressFun>();
+	Register<CMStringDictionaryCompressFun>();
+	Register<CMStringDictionaryDecompressFun>();
 }
 
 } // namespace duckdb
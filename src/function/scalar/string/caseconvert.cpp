@@ -9,6 +9,14 @@
 
 #include <string.h>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DUCKDB_CASE_CONVERT_AVX2
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define DUCKDB_CASE_CONVERT_NEON
+#include <arm_neon.h>
+#endif
+
 namespace duckdb {
 
 const uint8_t UpperFun::ASCII_TO_UPPER_MAP[] = {
@@ -38,14 +46,79 @@ const uint8_t LowerFun::ASCII_TO_LOWER_MAP[] = {
     220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
     242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255};
 
+#ifdef DUCKDB_CASE_CONVERT_AVX2
+#define DUCKDB_CASE_CONVERT_TARGET __attribute__((target("avx2")))
+//! The amount of characters converted by a single SIMD operation
+static constexpr idx_t CASE_CONVERT_WIDTH = 32;
+
+static bool HasSIMDCaseConvert() {
+	static const bool supported = []() {
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+	}();
+	return supported;
+}
+#elif defined(DUCKDB_CASE_CONVERT_NEON)
+#define DUCKDB_CASE_CONVERT_TARGET
+static constexpr idx_t CASE_CONVERT_WIDTH = 16;
+
+static bool HasSIMDCaseConvert() {
+	return true;
+}
+#endif
+
+#if defined(DUCKDB_CASE_CONVERT_AVX2) || defined(DUCKDB_CASE_CONVERT_NEON)
+//! Converts the case of the ASCII characters CASE_CONVERT_WIDTH at a time, returns the amount of converted characters
+template <bool IS_UPPER>
+DUCKDB_CASE_CONVERT_TARGET static idx_t ASCIICaseConvertSIMD(const char *input_data, char *result_data,
+                                                             idx_t input_length) {
+	static constexpr const char FIRST = IS_UPPER ? 'a' : 'A';
+	idx_t i = 0;
+#ifdef DUCKDB_CASE_CONVERT_AVX2
+	// the comparisons are signed, which is fine for ASCII characters
+	const auto before_first = _mm256_set1_epi8(FIRST - 1);
+	const auto after_last = _mm256_set1_epi8(FIRST + 26);
+	const auto case_bit = _mm256_set1_epi8(0x20);
+	for (; i + CASE_CONVERT_WIDTH <= input_length; i += CASE_CONVERT_WIDTH) {
+		auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input_data + i));
+		auto in_range =
+		    _mm256_and_si256(_mm256_cmpgt_epi8(values, before_first), _mm256_cmpgt_epi8(after_last, values));
+		auto converted = _mm256_xor_si256(values, _mm256_and_si256(in_range, case_bit));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(result_data + i), converted);
+	}
+#else
+	const auto first = vdupq_n_u8(FIRST);
+	const auto last = vdupq_n_u8(FIRST + 25);
+	const auto case_bit = vdupq_n_u8(0x20);
+	for (; i + CASE_CONVERT_WIDTH <= input_length; i += CASE_CONVERT_WIDTH) {
+		auto values = vld1q_u8(reinterpret_cast<const uint8_t *>(input_data + i));
+		auto in_range = vandq_u8(vcgeq_u8(values, first), vcleq_u8(values, last));
+		auto converted = veorq_u8(values, vandq_u8(in_range, case_bit));
+		vst1q_u8(reinterpret_cast<uint8_t *>(result_data + i), converted);
+	}
+#endif
+	return i;
+}
+#endif
+
 template <bool IS_UPPER>
 static string_t ASCIICaseConvert(Vector &result, const char *input_data, idx_t input_length) {
 	idx_t output_length = input_length;
 	auto result_str = StringVector::EmptyString(result, output_length);
 	auto result_data = result_str.GetDataWriteable();
-	for (idx_t i = 0; i < input_length; i++) {
-		result_data[i] = UnsafeNumericCast<char>(IS_UPPER ? UpperFun::ASCII_TO_UPPER_MAP[uint8_t(input_data[i])]
-		                                                  : LowerFun::ASCII_TO_LOWER_MAP[uint8_t(input_data[i])]);
+	idx_t i = 0;
+#if defined(DUCKDB_CASE_CONVERT_AVX2) || defined(DUCKDB_CASE_CONVERT_NEON)
+	if (HasSIMDCaseConvert()) {
+		i = ASCIICaseConvertSIMD<IS_UPPER>(input_data, result_data, input_length);
+	}
+#endif
+	// equivalent to the ASCII_TO_UPPER_MAP/ASCII_TO_LOWER_MAP lookups, but without branches or loads so the
+	// compiler can vectorize the loop
+	static constexpr const uint8_t FIRST = IS_UPPER ? 'a' : 'A';
+	for (; i < input_length; i++) {
+		auto c = uint8_t(input_data[i]);
+		auto in_range = uint8_t(uint8_t(c - FIRST) < 26);
+		result_data[i] = char(IS_UPPER ? c - (in_range << 5) : c + (in_range << 5));
 	}
 	result_str.Finalize();
 	return result_str;
@@ -124,6 +197,10 @@ struct CaseConvertOperator {
 	static RESULT_TYPE Operation(INPUT_TYPE input, Vector &result) {
 		auto input_data = input.GetData();
 		auto input_length = input.GetSize();
+		if (StripAccentsFun::IsAscii(input_data, input_length)) {
+			// most strings are ASCII: skip computing the length and decoding codepoints
+			return ASCIICaseConvert<IS_UPPER>(result, input_data, input_length);
+		}
 		return UnicodeCaseConvert<IS_UPPER>(result, input_data, input_length);
 	}
 };
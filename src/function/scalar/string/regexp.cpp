@@ -10,6 +10,8 @@
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "utf8proc_wrapper.hpp"
 
+#include "re2/regexp.h"
+
 namespace duckdb {
 
 using regexp_util::CreateStringPiece;
@@ -49,6 +51,48 @@ unique_ptr<FunctionLocalState> RegexInitLocalState(ExpressionState &state, const
 //===--------------------------------------------------------------------===//
 // Regexp Matches
 //===--------------------------------------------------------------------===//
+static void AddRune(duckdb_re2::Rune rune, string &literal) {
+	char buffer[4];
+	int size;
+	if (!Utf8Proc::CodepointToUtf8(rune, size, buffer)) {
+		throw InternalException("Invalid codepoint in regex literal");
+	}
+	literal.append(buffer, UnsafeNumericCast<idx_t>(size));
+}
+
+//! Collect the (case-sensitive) literals in the top-level concatenation of a pattern: every match contains them
+static void ExtractRequiredLiterals(duckdb_re2::Regexp &regexp, vector<string> &result) {
+	if (regexp.parse_flags() & (duckdb_re2::Regexp::FoldCase | duckdb_re2::Regexp::Latin1)) {
+		return;
+	}
+	switch (regexp.op()) {
+	case duckdb_re2::kRegexpConcat:
+		for (int i = 0; i < regexp.nsub(); i++) {
+			ExtractRequiredLiterals(*regexp.sub()[i], result);
+		}
+		break;
+	case duckdb_re2::kRegexpCapture:
+		ExtractRequiredLiterals(*regexp.sub()[0], result);
+		break;
+	case duckdb_re2::kRegexpLiteralString: {
+		string literal;
+		for (int i = 0; i < regexp.nrunes(); i++) {
+			AddRune(regexp.runes()[i], literal);
+		}
+		result.push_back(std::move(literal));
+		break;
+	}
+	case duckdb_re2::kRegexpLiteral: {
+		string literal;
+		AddRune(regexp.rune(), literal);
+		result.push_back(std::move(literal));
+		break;
+	}
+	default:
+		break;
+	}
+}
+
 RegexpMatchesBindData::RegexpMatchesBindData(duckdb_re2::RE2::Options options, string constant_string_p,
                                              bool constant_pattern)
     : RegexpBaseBindData(options, std::move(constant_string_p), constant_pattern) {
@@ -59,6 +103,9 @@ RegexpMatchesBindData::RegexpMatchesBindData(duckdb_re2::RE2::Options options, s
 		}
 
 		range_success = pattern->PossibleMatchRange(&range_min, &range_max, 1000);
+		if (options.encoding() == duckdb_re2::RE2::Options::EncodingUTF8) {
+			ExtractRequiredLiterals(*pattern->Regexp(), required_literals);
+		}
 	} else {
 		range_success = false;
 	}
@@ -66,14 +113,15 @@ RegexpMatchesBindData::RegexpMatchesBindData(duckdb_re2::RE2::Options options, s
 
 RegexpMatchesBindData::RegexpMatchesBindData(duckdb_re2::RE2::Options options, string constant_string_p,
                                              bool constant_pattern, string range_min_p, string range_max_p,
-                                             bool range_success)
+                                             bool range_success, vector<string> required_literals_p)
     : RegexpBaseBindData(options, std::move(constant_string_p), constant_pattern), range_min(std::move(range_min_p)),
-      range_max(std::move(range_max_p)), range_success(range_success) {
+      range_max(std::move(range_max_p)), range_success(range_success),
+      required_literals(std::move(required_literals_p)) {
 }
 
 unique_ptr<FunctionData> RegexpMatchesBindData::Copy() const {
 	return make_uniq<RegexpMatchesBindData>(options, constant_string, constant_pattern, range_min, range_max,
-	                                        range_success);
+	                                        range_success, required_literals);
 }
 
 unique_ptr<FunctionData> RegexpMatchesBind(ClientContext &context, ScalarFunction &bound_function,
@@ -114,6 +162,22 @@ static void RegexpMatchesFunction(DataChunk &args, ExpressionState &state, Vecto
 
 	if (info.constant_pattern) {
 		auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<RegexLocalState>();
+		if (!info.required_literals.empty()) {
+			// only run the regex on strings that contain all required literals
+			vector<string_t> literals;
+			for (auto &literal : info.required_literals) {
+				literals.emplace_back(literal);
+			}
+			UnaryExecutor::Execute<string_t, bool>(strings, result, args.size(), [&](string_t input) {
+				for (auto &literal : literals) {
+					if (ContainsFun::Find(input, literal) == DConstants::INVALID_INDEX) {
+						return false;
+					}
+				}
+				return OP::Operation(CreateStringPiece(input), lstate.constant_pattern);
+			});
+			return;
+		}
 		UnaryExecutor::Execute<string_t, bool>(strings, result, args.size(), [&](string_t input) {
 			return OP::Operation(CreateStringPiece(input), lstate.constant_pattern);
 		});
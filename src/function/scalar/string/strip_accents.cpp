@@ -2,10 +2,72 @@
 
 #include "utf8proc.hpp"
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DUCKDB_ASCII_CHECK_AVX2
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define DUCKDB_ASCII_CHECK_NEON
+#include <arm_neon.h>
+#endif
+
 namespace duckdb {
 
+#ifdef DUCKDB_ASCII_CHECK_AVX2
+#define DUCKDB_ASCII_CHECK_TARGET __attribute__((target("avx2")))
+//! The amount of bytes checked by a single SIMD comparison
+static constexpr idx_t ASCII_CHECK_WIDTH = 32;
+
+static bool HasSIMDAsciiCheck() {
+	static const bool supported = []() {
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+	}();
+	return supported;
+}
+#elif defined(DUCKDB_ASCII_CHECK_NEON)
+#define DUCKDB_ASCII_CHECK_TARGET
+static constexpr idx_t ASCII_CHECK_WIDTH = 16;
+
+static bool HasSIMDAsciiCheck() {
+	return true;
+}
+#endif
+
+#if defined(DUCKDB_ASCII_CHECK_AVX2) || defined(DUCKDB_ASCII_CHECK_NEON)
+//! Checks ASCII_CHECK_WIDTH bytes at a time for a set high bit, and sets i to the first byte that was not checked
+DUCKDB_ASCII_CHECK_TARGET static bool IsAsciiSIMD(const char *input, idx_t n, idx_t &i) {
+	for (; i + ASCII_CHECK_WIDTH <= n; i += ASCII_CHECK_WIDTH) {
+#ifdef DUCKDB_ASCII_CHECK_AVX2
+		auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i));
+		if (_mm256_movemask_epi8(values) != 0) {
+			return false;
+		}
+#else
+		auto values = vld1q_u8(reinterpret_cast<const uint8_t *>(input + i));
+		if (vmaxvq_u8(values) & 0x80) {
+			return false;
+		}
+#endif
+	}
+	return true;
+}
+#endif
+
 bool StripAccentsFun::IsAscii(const char *input, idx_t n) {
-	for (idx_t i = 0; i < n; i++) {
+	idx_t i = 0;
+#if defined(DUCKDB_ASCII_CHECK_AVX2) || defined(DUCKDB_ASCII_CHECK_NEON)
+	if (HasSIMDAsciiCheck() && !IsAsciiSIMD(input, n, i)) {
+		return false;
+	}
+#endif
+	// check eight bytes at a time for a set high bit
+	static constexpr const uint64_t HIGH_BITS = 0x8080808080808080ULL;
+	for (; i + sizeof(uint64_t) <= n; i += sizeof(uint64_t)) {
+		if (Load<uint64_t>(const_data_ptr_cast(input + i)) & HIGH_BITS) {
+			return false;
+		}
+	}
+	for (; i < n; i++) {
 		if (input[i] & 0x80) {
 			// non-ascii character
 			return false;
@@ -703,6 +703,40 @@ static void FlattenRunEndsSwitch(Vector &result, ArrowRunEndEncodingState &run_e
 	}
 }
 
+template <class RUN_END_TYPE>
+static void ReferenceRunEnds(Vector &result, ArrowRunEndEncodingState &run_end_encoding, idx_t compressed_size,
+                             idx_t scan_offset, idx_t count) {
+	auto &runs = *run_end_encoding.run_ends;
+	auto &values = *run_end_encoding.values;
+
+	UnifiedVectorFormat run_end_format;
+	runs.ToUnifiedFormat(compressed_size, run_end_format);
+	auto run_ends_data = run_end_format.GetData<RUN_END_TYPE>(run_end_format);
+
+	auto run = FindRunIndex(run_ends_data, compressed_size, scan_offset);
+	D_ASSERT(run < compressed_size);
+	auto first_run_end = static_cast<idx_t>(run_ends_data[run_end_format.sel->get_index(run)]);
+	if (scan_offset + count <= first_run_end) {
+		// The whole range falls within a single run
+		ConstantVector::Reference(result, values, run, compressed_size);
+		return;
+	}
+	// Reference the run values through a selection vector, so that no values are copied
+	SelectionVector sel(count);
+	idx_t index = 0;
+	for (; run < compressed_size && index < count; ++run) {
+		auto run_end = static_cast<idx_t>(run_ends_data[run_end_format.sel->get_index(run)]);
+		D_ASSERT(run_end > (scan_offset + index));
+		auto to_scan = MinValue<idx_t>(run_end - (scan_offset + index), count - index);
+		for (idx_t i = 0; i < to_scan; i++) {
+			sel.set_index(index + i, run);
+		}
+		index += to_scan;
+	}
+	D_ASSERT(index == count);
+	result.Slice(values, sel, count);
+}
+
 static void ColumnArrowToDuckDBRunEndEncoded(Vector &vector, const ArrowArray &array, ArrowArrayScanState &array_state,
                                              idx_t size, const ArrowType &arrow_type, int64_t nested_offset,
                                              ValidityMask *parent_mask, uint64_t parent_offset) {
@@ -727,6 +761,9 @@ static void ColumnArrowToDuckDBRunEndEncoded(Vector &vector, const ArrowArray &a
 		D_ASSERT(!run_end_encoding.values);
 		run_end_encoding.run_ends = make_uniq<Vector>(run_ends_type.GetDuckType(), compressed_size);
 		run_end_encoding.values = make_uniq<Vector>(values_type.GetDuckType(), compressed_size);
+		// The values can reference the Arrow buffers, which have to outlive the vectors that reference the values
+		run_end_encoding.values->GetBuffer()->SetAuxiliaryData(
+		    make_uniq<ArrowAuxiliaryData>(array_state.owned_data));
 
 		ColumnArrowToDuckDB(*run_end_encoding.run_ends, run_ends_array, array_state, compressed_size, run_ends_type);
 		auto &values = *run_end_encoding.values;
@@ -737,6 +774,23 @@ static void ColumnArrowToDuckDBRunEndEncoded(Vector &vector, const ArrowArray &a
 
 	idx_t scan_offset = GetEffectiveOffset(array, NumericCast<int64_t>(parent_offset), scan_state, nested_offset);
 	auto physical_type = run_ends_type.GetDuckType().InternalType();
+	if (nested_offset == -1 && !parent_mask) {
+		// Top-level columns reference the run values as a constant or dictionary vector instead of flattening them
+		switch (physical_type) {
+		case PhysicalType::INT16:
+			ReferenceRunEnds<int16_t>(vector, run_end_encoding, compressed_size, scan_offset, size);
+			return;
+		case PhysicalType::INT32:
+			ReferenceRunEnds<int32_t>(vector, run_end_encoding, compressed_size, scan_offset, size);
+			return;
+		case PhysicalType::INT64:
+			ReferenceRunEnds<int64_t>(vector, run_end_encoding, compressed_size, scan_offset, size);
+			return;
+		default:
+			throw NotImplementedException("Type '%s' not implemented for RunEndEncoding",
+			                              TypeIdToString(physical_type));
+		}
+	}
 	switch (physical_type) {
 	case PhysicalType::INT16:
 		FlattenRunEndsSwitch<int16_t>(vector, run_end_encoding, compressed_size, scan_offset, size);
@@ -745,7 +799,7 @@ static void ColumnArrowToDuckDBRunEndEncoded(Vector &vector, const ArrowArray &a
 		FlattenRunEndsSwitch<int32_t>(vector, run_end_encoding, compressed_size, scan_offset, size);
 		break;
 	case PhysicalType::INT64:
-		FlattenRunEndsSwitch<int32_t>(vector, run_end_encoding, compressed_size, scan_offset, size);
+		FlattenRunEndsSwitch<int64_t>(vector, run_end_encoding, compressed_size, scan_offset, size);
 		break;
 	default:
 		throw NotImplementedException("Type '%s' not implemented for RunEndEncoding", TypeIdToString(physical_type));
@@ -1283,6 +1337,8 @@ static void ColumnArrowToDuckDBDictionary(Vector &vector, ArrowArray &array, Arr
 	if (array_state.CacheOutdated(array.dictionary)) {
 		//! We need to set the dictionary data for this column
 		auto base_vector = make_uniq<Vector>(vector.GetType(), NumericCast<idx_t>(array.dictionary->length));
+		// The dictionary can reference the Arrow buffers, which have to outlive the vectors that slice it
+		base_vector->GetBuffer()->SetAuxiliaryData(make_uniq<ArrowAuxiliaryData>(array_state.owned_data));
 		SetValidityMask(*base_vector, *array.dictionary, scan_state, NumericCast<idx_t>(array.dictionary->length), 0, 0,
 		                has_nulls);
 		auto &dictionary_type = arrow_type.GetDictionary();
@@ -5,6 +5,7 @@
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/operator/add.hpp"
 #include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/storage/storage_info.hpp"
 
 namespace duckdb {
 
@@ -28,11 +29,34 @@ static void GetParameters(int64_t values[], idx_t value_count, hugeint_t &start,
 	}
 }
 
+template <bool GENERATE_SERIES>
+static void GenerateRangeParameters(int64_t values[], idx_t value_count, hugeint_t &start, hugeint_t &end,
+                                    hugeint_t &increment) {
+	GetParameters(values, value_count, start, end, increment);
+	if (increment == 0) {
+		throw BinderException("interval cannot be 0!");
+	}
+	if (start > end && increment > 0) {
+		throw BinderException("start is bigger than end, but increment is positive: cannot generate infinite series");
+	}
+	if (start < end && increment < 0) {
+		throw BinderException("start is smaller than end, but increment is negative: cannot generate infinite series");
+	}
+	if (GENERATE_SERIES) {
+		// generate_series has inclusive bounds on the RHS
+		if (increment < 0) {
+			end = end - 1;
+		} else {
+			end = end + 1;
+		}
+	}
+}
+
 struct RangeFunctionBindData : public TableFunctionData {
-	explicit RangeFunctionBindData(const vector<Value> &inputs) : cardinality(0) {
-		int64_t values[3];
+	explicit RangeFunctionBindData(const vector<Value> &inputs) : cardinality(0), value_count(inputs.size()) {
 		for (idx_t i = 0; i < inputs.size(); i++) {
 			if (inputs[i].IsNull()) {
+				has_null = true;
 				return;
 			}
 			values[i] = inputs[i].GetValue<int64_t>();
@@ -45,21 +69,49 @@ struct RangeFunctionBindData : public TableFunctionData {
 	}
 
 	idx_t cardinality;
+	//! The constant parameters of the range
+	int64_t values[3];
+	idx_t value_count;
+	bool has_null = false;
+};
+
+//! The number of values in each morsel of a constant range
+static constexpr const idx_t RANGE_MORSEL_SIZE = Storage::ROW_GROUP_SIZE;
+
+struct RangeFunctionGlobalState : public GlobalTableFunctionState {
+	RangeFunctionGlobalState() {
+	}
+
+	hugeint_t start;
+	hugeint_t increment;
+	//! The number of values in the range
+	idx_t count = 0;
+	idx_t morsel_count = 0;
+	atomic<idx_t> next_morsel {0};
+
+	idx_t MaxThreads() const override {
+		return MaxValue<idx_t>(morsel_count, 1);
+	}
 };
 
 template <bool GENERATE_SERIES>
-static unique_ptr<FunctionData> RangeFunctionBind(ClientContext &context, TableFunctionBindInput &input,
-                                                  vector<LogicalType> &return_types, vector<string> &names) {
-	return_types.emplace_back(LogicalType::BIGINT);
-	if (GENERATE_SERIES) {
-		names.emplace_back("generate_series");
-	} else {
-		names.emplace_back("range");
+static unique_ptr<GlobalTableFunctionState> RangeFunctionGlobalInit(ClientContext &context,
+                                                                    TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<RangeFunctionBindData>();
+	auto result = make_uniq<RangeFunctionGlobalState>();
+	if (bind_data.has_null) {
+		return std::move(result);
 	}
-	if (input.inputs.empty() || input.inputs.size() > 3) {
-		return nullptr;
+	int64_t values[3];
+	for (idx_t i = 0; i < bind_data.value_count; i++) {
+		values[i] = bind_data.values[i];
 	}
-	return make_uniq<RangeFunctionBindData>(input.inputs);
+	hugeint_t end;
+	GenerateRangeParameters<GENERATE_SERIES>(values, bind_data.value_count, result->start, end, result->increment);
+	int64_t offset = result->increment < 0 ? 1 : -1;
+	result->count = Hugeint::Cast<idx_t>((end - result->start + (result->increment + offset)) / result->increment);
+	result->morsel_count = (result->count + RANGE_MORSEL_SIZE - 1) / RANGE_MORSEL_SIZE;
+	return std::move(result);
 }
 
 struct RangeFunctionLocalState : public LocalTableFunctionState {
@@ -73,6 +125,10 @@ struct RangeFunctionLocalState : public LocalTableFunctionState {
 	hugeint_t start;
 	hugeint_t end;
 	hugeint_t increment;
+
+	//! The morsel of a constant range that is being produced
+	idx_t batch_index = 0;
+	idx_t morsel_end = 0;
 };
 
 static unique_ptr<LocalTableFunctionState> RangeFunctionLocalInit(ExecutionContext &context,
@@ -99,24 +155,28 @@ static void GenerateRangeParameters(DataChunk &input, idx_t row_id, RangeFunctio
 		}
 		values[c] = FlatVector::GetValue<int64_t>(input.data[c], row_id);
 	}
-	GetParameters(values, input.ColumnCount(), result.start, result.end, result.increment);
-	if (result.increment == 0) {
-		throw BinderException("interval cannot be 0!");
-	}
-	if (result.start > result.end && result.increment > 0) {
-		throw BinderException("start is bigger than end, but increment is positive: cannot generate infinite series");
-	}
-	if (result.start < result.end && result.increment < 0) {
-		throw BinderException("start is smaller than end, but increment is negative: cannot generate infinite series");
-	}
-	if (GENERATE_SERIES) {
-		// generate_series has inclusive bounds on the RHS
-		if (result.increment < 0) {
-			result.end = result.end - 1;
-		} else {
-			result.end = result.end + 1;
+	GenerateRangeParameters<GENERATE_SERIES>(values, input.ColumnCount(), result.start, result.end, result.increment);
+}
+
+static void RangeScanFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &gstate = data_p.global_state->Cast<RangeFunctionGlobalState>();
+	auto &state = data_p.local_state->Cast<RangeFunctionLocalState>();
+	if (state.current_idx >= state.morsel_end) {
+		// claim the next morsel
+		auto morsel = gstate.next_morsel++;
+		if (morsel >= gstate.morsel_count) {
+			return;
 		}
+		state.batch_index = morsel;
+		state.current_idx = morsel * RANGE_MORSEL_SIZE;
+		state.morsel_end = MinValue<idx_t>(state.current_idx + RANGE_MORSEL_SIZE, gstate.count);
 	}
+	hugeint_t current_value = gstate.start + gstate.increment * Hugeint::Convert(state.current_idx);
+	idx_t remaining = MinValue<idx_t>(state.morsel_end - state.current_idx, STANDARD_VECTOR_SIZE);
+	output.data[0].Sequence(Hugeint::Cast<int64_t>(current_value), Hugeint::Cast<int64_t>(gstate.increment),
+	                        remaining);
+	state.current_idx += remaining;
+	output.SetCardinality(remaining);
 }
 
 template <bool GENERATE_SERIES>
@@ -164,6 +224,33 @@ static OperatorResultType RangeFunction(ExecutionContext &context, TableFunction
 	}
 }
 
+static idx_t RangeFunctionGetBatchIndex(ClientContext &context, const FunctionData *bind_data_p,
+                                        LocalTableFunctionState *local_state, GlobalTableFunctionState *global_state) {
+	auto &state = local_state->Cast<RangeFunctionLocalState>();
+	return state.batch_index;
+}
+
+template <bool GENERATE_SERIES>
+static unique_ptr<FunctionData> RangeFunctionBind(ClientContext &context, TableFunctionBindInput &input,
+                                                  vector<LogicalType> &return_types, vector<string> &names) {
+	return_types.emplace_back(LogicalType::BIGINT);
+	if (GENERATE_SERIES) {
+		names.emplace_back("generate_series");
+	} else {
+		names.emplace_back("range");
+	}
+	if (input.inputs.empty() || input.inputs.size() > 3) {
+		return nullptr;
+	}
+	// constant ranges are split into morsels that are scanned in parallel
+	auto &function = input.table_function;
+	function.function = RangeScanFunction;
+	function.in_out_function = nullptr;
+	function.init_global = RangeFunctionGlobalInit<GENERATE_SERIES>;
+	function.get_batch_index = RangeFunctionGetBatchIndex;
+	return make_uniq<RangeFunctionBindData>(input.inputs);
+}
+
 unique_ptr<NodeStatistics> RangeCardinality(ClientContext &context, const FunctionData *bind_data_p) {
 	if (!bind_data_p) {
 		return nullptr;
@@ -362,6 +449,7 @@ void BuiltinFunctions::RegisterTableFunctions() {
 	ReadBlobFunction::RegisterFunction(*this);
 	ReadTextFunction::RegisterFunction(*this);
 	QueryTableFunction::RegisterFunction(*this);
+	SharedMemoryFunction::RegisterFunction(*this);
 }
 
 } // namespace duckdb
@@ -0,0 +1,206 @@
+#include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/shared_memory_stream.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/function/copy_function.hpp"
+#include "duckdb/function/table/range.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/parser/parsed_data/copy_info.hpp"
+
+namespace duckdb {
+
+// A shared memory stream holds a header with the names and types of the result, followed by the chunks of the
+// result. Every chunk is preceded by a marker, the stream ends with an end marker
+enum class SharedMemoryMarker : uint8_t { END_OF_STREAM = 0, CHUNK = 1 };
+
+//===--------------------------------------------------------------------===//
+// COPY TO
+//===--------------------------------------------------------------------===//
+struct WriteSharedMemoryData : public TableFunctionData {
+	WriteSharedMemoryData(vector<string> names_p, vector<LogicalType> types_p)
+	    : names(std::move(names_p)), types(std::move(types_p)), capacity(SharedMemoryStream::DEFAULT_CAPACITY) {
+	}
+
+	vector<string> names;
+	vector<LogicalType> types;
+	//! The capacity of the ring buffer of the stream
+	idx_t capacity;
+
+public:
+	unique_ptr<FunctionData> Copy() const override {
+		auto result = make_uniq<WriteSharedMemoryData>(names, types);
+		result->capacity = capacity;
+		return std::move(result);
+	}
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<WriteSharedMemoryData>();
+		return names == other.names && types == other.types && capacity == other.capacity;
+	}
+};
+
+struct GlobalWriteSharedMemoryData : public GlobalFunctionData {
+	unique_ptr<SharedMemoryStream> stream;
+};
+
+static unique_ptr<FunctionData> WriteSharedMemoryBind(ClientContext &context, CopyFunctionBindInput &input,
+                                                      const vector<string> &names,
+                                                      const vector<LogicalType> &sql_types) {
+	auto bind_data = make_uniq<WriteSharedMemoryData>(names, sql_types);
+	for (auto &option : input.info.options) {
+		auto loption = StringUtil::Lower(option.first);
+		if (loption == "buffer_size") {
+			if (option.second.size() != 1) {
+				throw BinderException("BUFFER_SIZE requires a single argument");
+			}
+			auto &value = option.second[0];
+			if (value.type().id() == LogicalTypeId::VARCHAR) {
+				bind_data->capacity = DBConfig::ParseMemoryLimit(value.ToString());
+			} else {
+				bind_data->capacity = value.GetValue<uint64_t>();
+			}
+			if (bind_data->capacity == 0) {
+				throw BinderException("BUFFER_SIZE must be larger than 0");
+			}
+		} else {
+			throw BinderException("Unrecognized option for shared memory COPY \"%s\"", option.first);
+		}
+	}
+	return std::move(bind_data);
+}
+
+static unique_ptr<LocalFunctionData> WriteSharedMemoryInitializeLocal(ExecutionContext &context,
+                                                                      FunctionData &bind_data) {
+	return make_uniq<LocalFunctionData>();
+}
+
+static unique_ptr<GlobalFunctionData> WriteSharedMemoryInitializeGlobal(ClientContext &context,
+                                                                        FunctionData &bind_data_p,
+                                                                        const string &file_path) {
+	auto &bind_data = bind_data_p.Cast<WriteSharedMemoryData>();
+	auto result = make_uniq<GlobalWriteSharedMemoryData>();
+	result->stream = SharedMemoryStream::Create(file_path, bind_data.capacity);
+	result->stream->SetInterruptFlag(context.interrupted);
+
+	BinarySerializer serializer(*result->stream);
+	serializer.Begin();
+	serializer.WriteProperty(100, "names", bind_data.names);
+	serializer.WriteProperty(101, "types", bind_data.types);
+	serializer.End();
+	result->stream->Flush();
+	return std::move(result);
+}
+
+static void WriteSharedMemorySink(ExecutionContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
+                                  LocalFunctionData &lstate, DataChunk &input) {
+	if (input.size() == 0) {
+		return;
+	}
+	auto &stream = *gstate.Cast<GlobalWriteSharedMemoryData>().stream;
+	stream.Write(SharedMemoryMarker::CHUNK);
+	BinarySerializer serializer(stream);
+	serializer.Begin();
+	input.Serialize(serializer);
+	serializer.End();
+	stream.Flush();
+}
+
+static void WriteSharedMemoryCombine(ExecutionContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
+                                     LocalFunctionData &lstate) {
+}
+
+static void WriteSharedMemoryFinalize(ClientContext &context, FunctionData &bind_data, GlobalFunctionData &gstate) {
+	auto &stream = *gstate.Cast<GlobalWriteSharedMemoryData>().stream;
+	stream.Write(SharedMemoryMarker::END_OF_STREAM);
+	stream.Close();
+}
+
+//===--------------------------------------------------------------------===//
+// read_shared_memory
+//===--------------------------------------------------------------------===//
+struct ReadSharedMemoryData : public TableFunctionData {
+	explicit ReadSharedMemoryData(shared_ptr<SharedMemoryStream> stream_p) : stream(std::move(stream_p)) {
+	}
+
+	//! The stream is opened (and its header is read) while binding, it is consumed by the scan
+	shared_ptr<SharedMemoryStream> stream;
+
+public:
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<ReadSharedMemoryData>(stream);
+	}
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<ReadSharedMemoryData>();
+		return stream == other.stream;
+	}
+};
+
+struct ReadSharedMemoryState : public GlobalTableFunctionState {
+	ReadSharedMemoryState() : finished(false) {
+	}
+
+	DataChunk chunk;
+	bool finished;
+};
+
+static unique_ptr<FunctionData> ReadSharedMemoryBind(ClientContext &context, TableFunctionBindInput &input,
+                                                     vector<LogicalType> &return_types, vector<string> &names) {
+	auto path = StringValue::Get(input.inputs[0]);
+	shared_ptr<SharedMemoryStream> stream = SharedMemoryStream::Open(path);
+	stream->SetInterruptFlag(context.interrupted);
+
+	BinaryDeserializer deserializer(*stream);
+	deserializer.Begin();
+	names = deserializer.ReadProperty<vector<string>>(100, "names");
+	return_types = deserializer.ReadProperty<vector<LogicalType>>(101, "types");
+	deserializer.End();
+	return make_uniq<ReadSharedMemoryData>(std::move(stream));
+}
+
+static unique_ptr<GlobalTableFunctionState> ReadSharedMemoryInit(ClientContext &context,
+                                                                 TableFunctionInitInput &input) {
+	return make_uniq<ReadSharedMemoryState>();
+}
+
+static void ReadSharedMemoryFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<ReadSharedMemoryData>();
+	auto &state = data_p.global_state->Cast<ReadSharedMemoryState>();
+	if (state.finished) {
+		return;
+	}
+	auto &stream = *bind_data.stream;
+	auto marker = stream.Read<SharedMemoryMarker>();
+	if (marker == SharedMemoryMarker::END_OF_STREAM) {
+		stream.Close();
+		state.finished = true;
+		return;
+	}
+	if (marker != SharedMemoryMarker::CHUNK) {
+		throw IOException("Corrupt shared memory stream: unexpected marker %d", static_cast<int>(marker));
+	}
+	// deserialize into the state, so the output can reference the data
+	state.chunk.Destroy();
+	BinaryDeserializer deserializer(stream);
+	deserializer.Begin();
+	state.chunk.Deserialize(deserializer);
+	deserializer.End();
+	output.Reference(state.chunk);
+}
+
+void SharedMemoryFunction::RegisterFunction(BuiltinFunctions &set) {
+	CopyFunction info("shared_memory");
+	info.copy_to_bind = WriteSharedMemoryBind;
+	info.copy_to_initialize_local = WriteSharedMemoryInitializeLocal;
+	info.copy_to_initialize_global = WriteSharedMemoryInitializeGlobal;
+	info.copy_to_sink = WriteSharedMemorySink;
+	info.copy_to_combine = WriteSharedMemoryCombine;
+	info.copy_to_finalize = WriteSharedMemoryFinalize;
+	info.extension = "shm";
+	set.AddFunction(info);
+
+	TableFunction read_shared_memory("read_shared_memory", {LogicalType::VARCHAR}, ReadSharedMemoryFunction,
+	                                 ReadSharedMemoryBind, ReadSharedMemoryInit);
+	set.AddFunction(read_shared_memory);
+}
+
+} // namespace duckdb
@@ -0,0 +1,159 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBCheckpointsEntry {
+	string database_name;
+	idx_t wal_size;
+	BackgroundCheckpointInfo info;
+	WALReplayInfo replay_info;
+};
+
+struct DuckDBCheckpointsData : public GlobalTableFunctionState {
+	DuckDBCheckpointsData() : offset(0) {
+	}
+
+	vector<DuckDBCheckpointsEntry> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBCheckpointsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("database_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("background_checkpointer_running");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	names.emplace_back("wal_size");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("checkpoint_count");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("postponed_count");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("failed_count");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("last_checkpoint");
+	return_types.emplace_back(LogicalType::TIMESTAMP_TZ);
+
+	names.emplace_back("last_checkpoint_reason");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("last_checkpoint_duration_ms");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("last_error");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("wal_replay_entries");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("wal_replay_bytes");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("wal_replay_progress");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("wal_replay_parallel_appends");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("wal_replay_duration_ms");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBCheckpointsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBCheckpointsData>();
+
+	// collect the state of the background checkpointers of all attached databases that are stored on disk
+	auto &db_manager = DatabaseManager::Get(context);
+	for (auto &entry : db_manager.GetDatabases(context)) {
+		auto &attached = entry.get();
+		if (attached.IsSystem() || attached.IsTemporary() || !attached.GetCatalog().IsDuckCatalog()) {
+			continue;
+		}
+		auto &storage = attached.GetStorageManager();
+		auto background_checkpointer = storage.GetBackgroundCheckpointer();
+		if (!background_checkpointer) {
+			continue;
+		}
+		DuckDBCheckpointsEntry checkpoints_entry;
+		checkpoints_entry.database_name = attached.GetName();
+		checkpoints_entry.wal_size = storage.GetWALSize();
+		checkpoints_entry.info = background_checkpointer->GetInfo();
+		checkpoints_entry.replay_info = storage.GetWALReplayInfo();
+		result->entries.push_back(std::move(checkpoints_entry));
+	}
+	return std::move(result);
+}
+
+void DuckDBCheckpointsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBCheckpointsData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		auto &info = entry.info;
+
+		idx_t col = 0;
+		// database_name, VARCHAR
+		output.SetValue(col++, count, Value(entry.database_name));
+		// background_checkpointer_running, BOOLEAN
+		output.SetValue(col++, count, Value::BOOLEAN(info.running));
+		// wal_size, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(entry.wal_size));
+		// checkpoint_count, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(info.checkpoint_count));
+		// postponed_count, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(info.postponed_count));
+		// failed_count, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(info.failed_count));
+		bool has_checkpoint = info.checkpoint_count > 0;
+		// last_checkpoint, TIMESTAMP WITH TIME ZONE
+		output.SetValue(col++, count,
+		                has_checkpoint ? Value::TIMESTAMPTZ(info.last_checkpoint) : Value());
+		// last_checkpoint_reason, VARCHAR
+		output.SetValue(col++, count, has_checkpoint ? Value(info.last_reason) : Value());
+		// last_checkpoint_duration_ms, UBIGINT
+		output.SetValue(col++, count, has_checkpoint ? Value::UBIGINT(info.last_duration_ms) : Value());
+		// last_error, VARCHAR
+		output.SetValue(col++, count, info.last_error.empty() ? Value() : Value(info.last_error));
+		auto &replay_info = entry.replay_info;
+		bool has_replay = replay_info.wal_size > 0;
+		// wal_replay_entries, UBIGINT
+		output.SetValue(col++, count, has_replay ? Value::UBIGINT(replay_info.replayed_entries) : Value());
+		// wal_replay_bytes, UBIGINT
+		output.SetValue(col++, count, has_replay ? Value::UBIGINT(replay_info.replayed_bytes) : Value());
+		// wal_replay_progress, DOUBLE
+		output.SetValue(col++, count,
+		                has_replay ? Value::DOUBLE(double(replay_info.replayed_bytes) / double(replay_info.wal_size))
+		                           : Value());
+		// wal_replay_parallel_appends, UBIGINT
+		output.SetValue(col++, count, has_replay ? Value::UBIGINT(replay_info.parallel_appends) : Value());
+		// wal_replay_duration_ms, UBIGINT
+		output.SetValue(col++, count, has_replay ? Value::UBIGINT(replay_info.duration_ms) : Value());
+
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBCheckpointsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_checkpoints", {}, DuckDBCheckpointsFunction, DuckDBCheckpointsBind,
+	                              DuckDBCheckpointsInit));
+}
+
+} // namespace duckdb
@@ -1,10 +1,13 @@
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
 #include "duckdb/catalog/catalog_entry/index_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/function/table/system_functions.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
 
 namespace duckdb {
 
@@ -60,6 +63,9 @@ static unique_ptr<FunctionData> DuckDBIndexesBind(ClientContext &context, TableF
 	names.emplace_back("sql");
 	return_types.emplace_back(LogicalType::VARCHAR);
 
+	names.emplace_back("fragmentation");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
 	return nullptr;
 }
 
@@ -89,6 +95,25 @@ Value GetIndexExpressions(IndexCatalogEntry &index) {
 	return Value::LIST(LogicalType::VARCHAR, std::move(content));
 }
 
+Value GetIndexFragmentation(IndexCatalogEntry &index) {
+	if (!index.catalog.IsDuckCatalog()) {
+		return Value();
+	}
+	// only ART indexes that are loaded report their fragmentation
+	auto &duck_index = index.Cast<DuckIndexEntry>();
+	Value result;
+	duck_index.GetDataTableInfo().GetIndexes().Scan([&](Index &table_index) {
+		if (table_index.GetIndexName() != index.name) {
+			return false;
+		}
+		if (table_index.IsBound() && table_index.GetIndexType() == ART::TYPE_NAME) {
+			result = Value::DOUBLE(table_index.Cast<ART>().GetFragmentation());
+		}
+		return true;
+	});
+	return result;
+}
+
 void DuckDBIndexesFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &data = data_p.global_state->Cast<DuckDBIndexesData>();
 	if (data.offset >= data.entries.size()) {
@@ -137,6 +162,8 @@ void DuckDBIndexesFunction(ClientContext &context, TableFunctionInput &data_p, D
 		// sql, VARCHAR
 		auto sql = index.ToSQL();
 		output.SetValue(col++, count, sql.empty() ? Value() : Value(std::move(sql)));
+		// fragmentation, DOUBLE
+		output.SetValue(col++, count, GetIndexFragmentation(index));
 
 		count++;
 	}
@@ -1,4 +1,6 @@
 #include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/storage/buffer/client_memory_tracker.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
@@ -8,6 +10,8 @@ struct DuckDBMemoryData : public GlobalTableFunctionState {
 	}
 
 	vector<MemoryInformation> entries;
+	//! The memory reserved by the calling client, per tag
+	vector<idx_t> client_usage;
 	idx_t offset;
 };
 
@@ -22,6 +26,15 @@ static unique_ptr<FunctionData> DuckDBMemoryBind(ClientContext &context, TableFu
 	names.emplace_back("temporary_storage_bytes");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("buffer_hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("buffer_misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("client_memory_usage_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
 	return nullptr;
 }
 
@@ -29,6 +42,10 @@ unique_ptr<GlobalTableFunctionState> DuckDBMemoryInit(ClientContext &context, Ta
 	auto result = make_uniq<DuckDBMemoryData>();
 
 	result->entries = BufferManager::GetBufferManager(context).GetMemoryUsageInfo();
+	auto &memory_tracker = *ClientData::Get(context).memory_tracker;
+	for (auto &entry : result->entries) {
+		result->client_usage.push_back(memory_tracker.GetSessionMemory(entry.tag));
+	}
 	return std::move(result);
 }
 
@@ -42,7 +59,9 @@ void DuckDBMemoryFunction(ClientContext &context, TableFunctionInput &data_p, Da
 	// either fill up the chunk or return all the remaining columns
 	idx_t count = 0;
 	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
-		auto &entry = data.entries[data.offset++];
+		auto &entry = data.entries[data.offset];
+		auto client_usage = data.client_usage[data.offset];
+		data.offset++;
 		// return values:
 		idx_t col = 0;
 		// tag, VARCHAR
@@ -51,6 +70,12 @@ void DuckDBMemoryFunction(ClientContext &context, TableFunctionInput &data_p, Da
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.size)));
 		// temporary_storage_bytes, BIGINT
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.evicted_data)));
+		// buffer_hits, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.buffer_hits)));
+		// buffer_misses, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.buffer_misses)));
+		// client_memory_usage_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(client_usage)));
 		count++;
 	}
 	output.SetCardinality(count);
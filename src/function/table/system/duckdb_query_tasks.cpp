@@ -0,0 +1,70 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+namespace duckdb {
+
+struct DuckDBQueryTasksData : public GlobalTableFunctionState {
+	DuckDBQueryTasksData() : offset(0) {
+	}
+
+	vector<ProducerInformation> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBQueryTasksBind(ClientContext &context, TableFunctionBindInput &input,
+                                                     vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("query_id");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("priority");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("queued_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("running_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBQueryTasksInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBQueryTasksData>();
+
+	result->entries = TaskScheduler::GetScheduler(context).GetProducerInformation();
+	return std::move(result);
+}
+
+void DuckDBQueryTasksFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBQueryTasksData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// query_id, UBIGINT
+		output.SetValue(col++, count,
+		                entry.query_id.IsValid() ? Value::UBIGINT(entry.query_id.GetIndex()) : Value());
+		// priority, VARCHAR
+		output.SetValue(col++, count, EnumUtil::ToString(entry.priority));
+		// queued_tasks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.queued_tasks)));
+		// running_tasks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.running_tasks)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBQueryTasksFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_query_tasks", {}, DuckDBQueryTasksFunction, DuckDBQueryTasksBind,
+	                              DuckDBQueryTasksInit));
+}
+
+} // namespace duckdb
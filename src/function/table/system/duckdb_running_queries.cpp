@@ -0,0 +1,204 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/common/progress_bar/progress_bar.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/connection_manager.hpp"
+#include "duckdb/main/query_telemetry.hpp"
+#include "duckdb/storage/buffer/client_memory_tracker.hpp"
+
+namespace duckdb {
+
+struct RunningQueryEntry {
+	QueryTelemetryInfo info;
+	double progress;
+	idx_t rows_processed;
+	idx_t total_rows_to_process;
+	idx_t memory_usage;
+	idx_t peak_memory_usage;
+	//! The memory reserved by the connection of the query, per tag
+	vector<Value> memory_tags;
+	vector<Value> memory_tag_usage;
+};
+
+struct DuckDBRunningQueriesData : public GlobalTableFunctionState {
+	DuckDBRunningQueriesData() : offset(0) {
+	}
+
+	vector<RunningQueryEntry> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBRunningQueriesBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("query_id");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("query");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("elapsed_time");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("cpu_time");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("progress");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("rows_processed");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("total_rows_to_process");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_usage_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("peak_memory_usage_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_usage_by_tag");
+	return_types.emplace_back(LogicalType::MAP(LogicalType::VARCHAR, LogicalType::BIGINT));
+
+	names.emplace_back("temporary_bytes_written");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("local_bytes_read");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("remote_bytes_read");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("read_operations");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("read_time");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("read_latency_histogram");
+	return_types.emplace_back(LogicalType::MAP(LogicalType::VARCHAR, LogicalType::BIGINT));
+
+	names.emplace_back("buffer_hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("buffer_misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("prefetch_waste_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("active_threads");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBRunningQueriesInit(ClientContext &context,
+                                                               TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBRunningQueriesData>();
+
+	// the counters are read without locking the connections, so this does not wait for their queries
+	auto connections = ConnectionManager::Get(context).GetConnectionList();
+	for (auto &connection : connections) {
+		auto &client_data = ClientData::Get(*connection);
+		RunningQueryEntry entry;
+		if (!client_data.query_telemetry->GetRunningQuery(entry.info)) {
+			continue;
+		}
+		// the progress is only tracked when the progress bar is enabled for the connection
+		auto progress = connection->GetQueryProgress();
+		entry.progress = progress.GetPercentage();
+		entry.rows_processed = progress.GetRowsProcesseed();
+		entry.total_rows_to_process = progress.GetTotalRowsToProcess();
+
+		auto &memory_tracker = *client_data.memory_tracker;
+		entry.memory_usage = memory_tracker.GetQueryMemory();
+		entry.peak_memory_usage = memory_tracker.GetQueryPeakMemory();
+		for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
+			auto tag = MemoryTag(i);
+			auto usage = memory_tracker.GetSessionMemory(tag);
+			if (usage == 0) {
+				continue;
+			}
+			entry.memory_tags.emplace_back(EnumUtil::ToString(tag));
+			entry.memory_tag_usage.push_back(Value::BIGINT(NumericCast<int64_t>(usage)));
+		}
+		result->entries.push_back(std::move(entry));
+	}
+	return std::move(result);
+}
+
+void DuckDBRunningQueriesFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBRunningQueriesData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		auto &info = entry.info;
+		// return values:
+		idx_t col = 0;
+		// query_id, UBIGINT
+		output.SetValue(col++, count, info.query_id.IsValid() ? Value::UBIGINT(info.query_id.GetIndex()) : Value());
+		// query, VARCHAR
+		output.SetValue(col++, count, Value(info.query));
+		// elapsed_time, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(info.elapsed_time));
+		// cpu_time, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(info.cpu_time));
+		// progress, DOUBLE
+		output.SetValue(col++, count, entry.progress >= 0 ? Value::DOUBLE(entry.progress) : Value());
+		// rows_processed, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.rows_processed)));
+		// total_rows_to_process, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.total_rows_to_process)));
+		// memory_usage_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.memory_usage)));
+		// peak_memory_usage_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.peak_memory_usage)));
+		// memory_usage_by_tag, MAP(VARCHAR, BIGINT)
+		output.SetValue(col++, count,
+		                Value::MAP(LogicalType::VARCHAR, LogicalType::BIGINT, std::move(entry.memory_tags),
+		                           std::move(entry.memory_tag_usage)));
+		// temporary_bytes_written, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(info.temporary_bytes_written)));
+		// local_bytes_read, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(info.local_bytes_read)));
+		// remote_bytes_read, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(info.remote_bytes_read)));
+		// read_operations, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(info.read_operations)));
+		// read_time, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(info.read_time));
+		// read_latency_histogram, MAP(VARCHAR, BIGINT)
+		vector<Value> latency_buckets;
+		vector<Value> latency_counts;
+		for (idx_t bucket = 0; bucket < info.read_latency_histogram.size(); bucket++) {
+			latency_buckets.emplace_back(IOProfiler::GetLatencyBucketName(bucket));
+			latency_counts.push_back(Value::BIGINT(NumericCast<int64_t>(info.read_latency_histogram[bucket])));
+		}
+		output.SetValue(col++, count,
+		                Value::MAP(LogicalType::VARCHAR, LogicalType::BIGINT, std::move(latency_buckets),
+		                           std::move(latency_counts)));
+		// buffer_hits, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(info.buffer_hits)));
+		// buffer_misses, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(info.buffer_misses)));
+		// prefetch_waste_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(info.prefetch_waste_bytes)));
+		// active_threads, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(info.active_threads)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBRunningQueriesFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_running_queries", {}, DuckDBRunningQueriesFunction,
+	                              DuckDBRunningQueriesBind, DuckDBRunningQueriesInit));
+}
+
+} // namespace duckdb
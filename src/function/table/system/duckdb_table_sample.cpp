@@ -0,0 +1,64 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/execution/reservoir_sample.hpp"
+#include "duckdb/parser/qualified_name.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/storage/data_table.hpp"
+
+namespace duckdb {
+
+struct DuckDBTableSampleData : public TableFunctionData {
+	explicit DuckDBTableSampleData(TableCatalogEntry &table_entry) : table_entry(table_entry) {
+	}
+
+	TableCatalogEntry &table_entry;
+};
+
+struct DuckDBTableSampleState : public GlobalTableFunctionState {
+	//! A copy of the table sample, which is consumed while it is emitted
+	unique_ptr<ReservoirSample> sample;
+};
+
+static unique_ptr<FunctionData> DuckDBTableSampleBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	auto qname = QualifiedName::Parse(input.inputs[0].GetValue<string>());
+
+	// look up the table name in the catalog
+	Binder::BindSchemaOrCatalog(context, qname.catalog, qname.schema);
+	auto &table_entry = Catalog::GetEntry<TableCatalogEntry>(context, qname.catalog, qname.schema, qname.name);
+	for (auto &col : table_entry.GetColumns().Physical()) {
+		names.push_back(col.Name());
+		return_types.push_back(col.Type());
+	}
+	return make_uniq<DuckDBTableSampleData>(table_entry);
+}
+
+static unique_ptr<GlobalTableFunctionState> DuckDBTableSampleInit(ClientContext &context,
+                                                                  TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<DuckDBTableSampleData>();
+	auto result = make_uniq<DuckDBTableSampleState>();
+	result->sample = bind_data.table_entry.GetStorage().GetSample();
+	return std::move(result);
+}
+
+static void DuckDBTableSampleFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<DuckDBTableSampleState>();
+	if (!state.sample) {
+		return;
+	}
+	auto chunk = state.sample->GetChunk();
+	if (!chunk) {
+		state.sample.reset();
+		return;
+	}
+	output.Move(*chunk);
+}
+
+void DuckDBTableSampleFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_table_sample", {LogicalType::VARCHAR}, DuckDBTableSampleFunction,
+	                              DuckDBTableSampleBind, DuckDBTableSampleInit));
+}
+
+} // namespace duckdb
@@ -6,10 +6,12 @@
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/brin/block_range_index.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/optimizer/matcher/expression_matcher.hpp"
+#include "duckdb/parser/constraints/not_null_constraint.hpp"
 #include "duckdb/planner/expression/bound_between_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
@@ -54,6 +56,10 @@ struct TableScanGlobalState : public GlobalTableFunctionState {
 
 	vector<idx_t> projection_ids;
 	vector<LogicalType> scanned_types;
+	//! The row ranges of the table that can contain rows passing the filters
+	vector<shared_ptr<ScanRowRanges>> row_ranges;
+	//! The system sample that is pushed into the scan (if any)
+	shared_ptr<ScanSamplingInfo> sampling;
 
 	idx_t MaxThreads() const override {
 		return max_threads;
@@ -74,9 +80,15 @@ static unique_ptr<LocalTableFunctionState> TableScanInitLocal(ExecutionContext &
 		col = storage_idx;
 	}
 	result->scan_state.Initialize(std::move(column_ids), input.filters.get());
+	auto &tsgs = gstate->Cast<TableScanGlobalState>();
+	for (auto &row_ranges : tsgs.row_ranges) {
+		result->scan_state.GetFilterInfo().AddRowRanges(row_ranges);
+	}
+	if (tsgs.sampling) {
+		result->scan_state.GetFilterInfo().SetSampling(tsgs.sampling);
+	}
 	TableScanParallelStateNext(context.client, input.bind_data.get(), result.get(), gstate);
 	if (input.CanRemoveFilterColumns()) {
-		auto &tsgs = gstate->Cast<TableScanGlobalState>();
 		result->all_columns.Initialize(context.client, tsgs.scanned_types);
 	}
 
@@ -90,6 +102,31 @@ unique_ptr<GlobalTableFunctionState> TableScanInitGlobal(ClientContext &context,
 	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
 	auto result = make_uniq<TableScanGlobalState>(context, input.bind_data.get());
 	bind_data.table.GetStorage().InitializeParallelScan(context, result->state);
+
+	// block range indexes on filtered columns restrict the scan to the row ranges that can pass the filters
+	if (input.filters) {
+		auto &info = bind_data.table.GetStorage().GetDataTableInfo();
+		for (auto &entry : input.filters->filters) {
+			auto column_id = GetStorageIndex(bind_data.table, input.column_ids[entry.first]);
+			info->GetIndexes().BindAndScan<BlockRangeIndex>(context, *info, [&](BlockRangeIndex &index) {
+				if (index.GetColumnIds()[0] != column_id ||
+				    index.unbound_expressions[0]->type != ExpressionType::BOUND_COLUMN_REF) {
+					return false;
+				}
+				auto row_ranges = index.GetQualifyingRanges(*entry.second);
+				if (row_ranges) {
+					result->row_ranges.push_back(std::move(row_ranges));
+				}
+				return false;
+			});
+		}
+	}
+
+	// a pushed down system sample skips the vectors that are not part of the sample
+	if (input.sample_options) {
+		result->sampling = ScanSamplingInfo::Create(context, *input.sample_options);
+	}
+
 	if (input.CanRemoveFilterColumns()) {
 		result->projection_ids = input.projection_ids;
 		const auto &columns = bind_data.table.GetColumns();
@@ -293,6 +330,35 @@ static void RewriteIndexExpression(Index &index, LogicalGet &get, Expression &ex
 	    expr, [&](Expression &child) { RewriteIndexExpression(index, get, child, rewrite_possible); });
 }
 
+//! Returns the number of leading key columns that a lookup on a prefix of the compound key must contain.
+//! Keys containing NULLs are not indexed, so all remaining key columns must be NOT NULL columns.
+static idx_t GetMinPrefixCount(TableCatalogEntry &table, ART &art_index) {
+	auto &column_ids = art_index.GetColumnIds();
+	auto count = art_index.unbound_expressions.size();
+	while (count > 0) {
+		auto &expr = *art_index.unbound_expressions[count - 1];
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			break;
+		}
+		// the index stores the column ids of the table scan that created it
+		auto logical_index = LogicalIndex(column_ids[expr.Cast<BoundColumnRefExpression>().binding.column_index]);
+
+		bool not_null = false;
+		for (auto &constraint : table.GetConstraints()) {
+			if (constraint->type == ConstraintType::NOT_NULL &&
+			    constraint->Cast<NotNullConstraint>().index == logical_index) {
+				not_null = true;
+				break;
+			}
+		}
+		if (!not_null) {
+			break;
+		}
+		count--;
+	}
+	return count;
+}
+
 void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
                                     vector<unique_ptr<Expression>> &filters) {
 	auto &bind_data = bind_data_p->Cast<TableScanBindData>();
@@ -307,6 +373,10 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 	if (bind_data.is_index_scan) {
 		return;
 	}
+	if (get.extra_info.sample_options) {
+		// the index scan does not support a pushed down sample
+		return;
+	}
 	if (!get.table_filters.filters.empty()) {
 		// if there were filters before we can't convert this to an index scan
 		return;
@@ -324,49 +394,70 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 	auto checkpoint_lock = storage.GetSharedCheckpointLock();
 	auto &info = storage.GetDataTableInfo();
 
+	auto &db_config = DBConfig::GetConfig(context);
+	auto index_scan_percentage = db_config.options.index_scan_percentage;
+	auto index_scan_max_count = db_config.options.index_scan_max_count;
+
+	auto total_rows = storage.GetTotalRows();
+	auto total_rows_from_percentage = LossyNumericCast<idx_t>(double(total_rows) * index_scan_percentage);
+	auto max_count = MaxValue(index_scan_max_count, total_rows_from_percentage);
+
 	// bind and scan any ART indexes
+	// we scan every index matching the filters, and keep the index scan that fetches the fewest rows
 	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
-		// first rewrite the index expression so the ColumnBindings align with the column bindings of the current table
-		if (art_index.unbound_expressions.size() > 1) {
-			// NOTE: index scans are not (yet) supported for compound index keys
-			return false;
+		// first rewrite the index expressions so the ColumnBindings align with the column bindings of the current table
+		// we can use the leading key columns of compound keys, even if the remaining columns were not bound
+		vector<unique_ptr<Expression>> index_expressions;
+		for (auto &unbound_expression : art_index.unbound_expressions) {
+			auto index_expression = unbound_expression->Copy();
+			bool rewrite_possible = true;
+			RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
+			if (!rewrite_possible) {
+				break;
+			}
+			index_expressions.push_back(std::move(index_expression));
 		}
-
-		auto index_expression = art_index.unbound_expressions[0]->Copy();
-		bool rewrite_possible = true;
-		RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
-		if (!rewrite_possible) {
+		if (index_expressions.empty()) {
 			// could not rewrite!
 			return false;
 		}
 
 		// Try to find a matching index for any of the filter expressions.
-		for (auto &filter : filters) {
-			auto index_state = art_index.TryInitializeScan(*index_expression, *filter);
-			if (index_state != nullptr) {
-
-				auto &db_config = DBConfig::GetConfig(context);
-				auto index_scan_percentage = db_config.options.index_scan_percentage;
-				auto index_scan_max_count = db_config.options.index_scan_max_count;
-
-				auto total_rows = storage.GetTotalRows();
-				auto total_rows_from_percentage = LossyNumericCast<idx_t>(double(total_rows) * index_scan_percentage);
-				auto max_count = MaxValue(index_scan_max_count, total_rows_from_percentage);
-
-				// Check if we can use an index scan, and already retrieve the matching row ids.
-				if (art_index.Scan(*index_state, max_count, bind_data.row_ids)) {
-					bind_data.is_index_scan = true;
-					get.function = TableScanFunction::GetIndexScanFunction();
-					return true;
+		vector<unique_ptr<IndexScanState>> index_states;
+		if (art_index.unbound_expressions.size() == 1) {
+			for (auto &filter : filters) {
+				auto index_state = art_index.TryInitializeScan(*index_expressions[0], *filter);
+				if (index_state) {
+					index_states.push_back(std::move(index_state));
 				}
+			}
+		} else {
+			auto min_prefix_count = GetMinPrefixCount(table, art_index);
+			auto index_state = art_index.TryInitializeScan(index_expressions, filters, min_prefix_count);
+			if (index_state) {
+				index_states.push_back(std::move(index_state));
+			}
+		}
 
-				// Clear the row ids in case we exceeded the maximum count and stopped scanning.
-				bind_data.row_ids.clear();
-				return true;
+		for (auto &index_state : index_states) {
+			// Check if we can use an index scan, and already retrieve the matching row ids.
+			// We stop scanning once we exceed the row ids of the cheapest index scan so far.
+			unsafe_vector<row_t> row_ids;
+			auto scan_max_count = bind_data.is_index_scan ? bind_data.row_ids.size() : max_count;
+			if (!art_index.Scan(*index_state, scan_max_count, row_ids)) {
+				continue;
+			}
+			if (!bind_data.is_index_scan || row_ids.size() < bind_data.row_ids.size()) {
+				bind_data.row_ids = std::move(row_ids);
+				bind_data.is_index_scan = true;
 			}
 		}
 		return false;
 	});
+
+	if (bind_data.is_index_scan) {
+		get.function = TableScanFunction::GetIndexScanFunction();
+	}
 }
 
 string TableScanToString(const FunctionData *bind_data_p) {
@@ -436,6 +527,7 @@ TableFunction TableScanFunction::GetFunction() {
 	scan_function.projection_pushdown = true;
 	scan_function.filter_pushdown = true;
 	scan_function.filter_prune = true;
+	scan_function.sampling_pushdown = true;
 	scan_function.serialize = TableScanSerialize;
 	scan_function.deserialize = TableScanDeserialize;
 	return scan_function;
@@ -241,6 +241,9 @@ typedef uint64_t idx_t;
 //! bind data (if any), init data (if any), extra data for replacement scans (if any)
 typedef void (*duckdb_delete_callback_t)(void *data);
 
+//! The callback that will be called when a pending result can make progress without blocking
+typedef void (*duckdb_pending_ready_callback_t)(void *user_data);
+
 //! Used for threading, contains a task state. Must be destroyed with `duckdb_destroy_state`.
 typedef void *duckdb_task_state;
 
@@ -1643,6 +1646,24 @@ Note that the result must be freed with `duckdb_destroy_result`.
 DUCKDB_API duckdb_state duckdb_execute_prepared(duckdb_prepared_statement prepared_statement,
                                                 duckdb_result *out_result);
 
+/*!
+Executes the prepared statement once for every row of a data chunk of parameters, and returns a materialized query
+result. Column `i` of the chunk holds the values of parameter `i + 1`; parameters bound with `duckdb_bind_*` are
+ignored.
+
+An `INSERT INTO ... VALUES (...)` statement with a single row of values is executed as a single INSERT that scans
+all parameter rows. Other statements are executed once per row, and the result of the last execution is returned.
+
+Note that the result must be freed with `duckdb_destroy_result`.
+
+* @param prepared_statement The prepared statement to execute.
+* @param parameters The data chunk with one column per parameter, and one row per execution.
+* @param out_result The query result.
+* @return `DuckDBSuccess` on success or `DuckDBError` on failure.
+*/
+DUCKDB_API duckdb_state duckdb_execute_prepared_batch(duckdb_prepared_statement prepared_statement,
+                                                      duckdb_data_chunk parameters, duckdb_result *out_result);
+
 #ifndef DUCKDB_API_NO_DEPRECATED
 /*!
 **DEPRECATION NOTICE**: This method is scheduled for removal in a future release.
@@ -1820,6 +1841,31 @@ DUCKDB_PENDING_RESULT_READY, this function will return true.
 */
 DUCKDB_API bool duckdb_pending_execution_is_finished(duckdb_pending_state pending_state);
 
+/*!
+Sets a callback that is invoked when the pending result can make progress without blocking, so it can be
+executed asynchronously: instead of calling `duckdb_pending_execute_task` in a loop, the query is executed by the
+background threads of the database, and the callback notifies the caller when to continue.
+
+The callback is invoked when all tasks of the query have finished, when an error occurred, or when a streaming result
+has buffered data that is waiting to be fetched. It is invoked immediately if this is already the case. After the
+callback, `duckdb_pending_execute_check_state` returns whether the result is ready, and `duckdb_execute_pending`
+returns it without blocking. For a streaming result, the callback is also invoked while the result is being fetched,
+whenever the execution is waiting for the next chunk to be fetched or finishes.
+
+The callback can be invoked from any thread, and must not call back into DuckDB, e.g., it should only wake up the
+event loop of the caller. Spurious invocations are possible. The query can be cancelled with `duckdb_interrupt`.
+This requires at least one background thread, i.e., the `threads` setting must be larger than 1.
+
+`user_data` must stay valid until the pending result, and any result obtained from it, have been destroyed.
+
+* @param pending_result The pending result.
+* @param callback The callback to invoke, or `NULL` to remove the callback.
+* @param user_data The parameter passed to the callback.
+* @return `DuckDBSuccess` on success or `DuckDBError` on failure.
+*/
+DUCKDB_API duckdb_state duckdb_pending_set_ready_callback(duckdb_pending_result pending_result,
+                                                          duckdb_pending_ready_callback_t callback, void *user_data);
+
 //===--------------------------------------------------------------------===//
 // Value Interface
 //===--------------------------------------------------------------------===//
@@ -4050,6 +4096,23 @@ It is not known beforehand how many chunks will be returned by this result.
 */
 DUCKDB_API duckdb_data_chunk duckdb_fetch_chunk(duckdb_result result);
 
+/*!
+Fetches data chunks from a duckdb_result until at least `min_rows` rows have been fetched or the result is
+exhausted, and returns them as a single data chunk. This function should be called repeatedly until the result is
+exhausted.
+
+The returned data chunk can hold more than `STANDARD_VECTOR_SIZE` rows, and all of its vectors are flat: the data of
+every column is one contiguous array, and its validity is one bitmap. They can be accessed with
+`duckdb_vector_get_data` and `duckdb_vector_get_validity`, and stay valid until the data chunk is destroyed.
+
+The result must be destroyed with `duckdb_destroy_data_chunk`.
+
+* @param result The result object to fetch the data chunks from.
+* @param min_rows The minimum number of rows to fetch into the data chunk, unless the result is exhausted.
+* @return The resulting data chunk. Returns `NULL` if the result has an error or is exhausted.
+*/
+DUCKDB_API duckdb_data_chunk duckdb_fetch_chunk_batch(duckdb_result result, idx_t min_rows);
+
 //===--------------------------------------------------------------------===//
 // Cast Functions
 //===--------------------------------------------------------------------===//
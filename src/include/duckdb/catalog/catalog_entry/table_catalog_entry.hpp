@@ -31,6 +31,7 @@ struct SetDefaultInfo;
 struct ChangeColumnTypeInfo;
 struct AlterForeignKeyInfo;
 struct SetNotNullInfo;
+struct SetClusterByInfo;
 struct DropNotNullInfo;
 struct SetColumnCommentInfo;
 
@@ -78,6 +79,8 @@ public:
 
 	//! Returns a list of the constraints of the table
 	DUCKDB_API const vector<unique_ptr<Constraint>> &GetConstraints() const;
+	//! Returns the columns that inserted rows are sorted on (empty if the table is not clustered)
+	DUCKDB_API const vector<string> &GetClusterBy() const;
 	DUCKDB_API string ToSQL() const override;
 
 	//! Get statistics of a column (physical or virtual) within the table
@@ -112,5 +115,7 @@ protected:
 	ColumnList columns;
 	//! A list of constraints that are part of this table
 	vector<unique_ptr<Constraint>> constraints;
+	//! The columns that inserted rows are sorted on
+	vector<string> cluster_by;
 };
 } // namespace duckdb
@@ -10,6 +10,7 @@
 
 #include "duckdb/catalog/catalog_entry.hpp"
 #include "duckdb/catalog/default/default_generator.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/pair.hpp"
@@ -34,8 +35,7 @@ class SequenceCatalogEntry;
 
 class CatalogEntryMap {
 public:
-	CatalogEntryMap() {
-	}
+	CatalogEntryMap();
 
 public:
 	void AddEntry(unique_ptr<CatalogEntry> entry);
@@ -43,10 +43,16 @@ public:
 	void DropEntry(CatalogEntry &entry);
 	case_insensitive_tree_t<unique_ptr<CatalogEntry>> &Entries();
 	optional_ptr<CatalogEntry> GetEntry(const string &name);
+	//! Returns the version of the map, which changes whenever an entry is added, updated or dropped
+	idx_t GetVersion() const {
+		return version;
+	}
 
 private:
 	//! Mapping of string to catalog entry
 	case_insensitive_tree_t<unique_ptr<CatalogEntry>> entries;
+	//! The version of the map. Versions are unique across all maps, so a map never takes the version of another map
+	atomic<idx_t> version;
 };
 
 //! The Catalog Set stores (key, value) map of a set of CatalogEntries
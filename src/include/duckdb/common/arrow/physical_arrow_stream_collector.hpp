@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/arrow/physical_arrow_stream_collector.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+#include "duckdb/common/arrow/arrow_appender.hpp"
+
+namespace duckdb {
+
+class ArrowBufferedData;
+
+class ArrowStreamCollectorLocalState : public LocalSinkState {
+public:
+	//! The appender for the array we're creating
+	unique_ptr<ArrowAppender> appender;
+	//! The (estimated) size of the data appended to the appender
+	idx_t appended_size = 0;
+	idx_t current_batch = 0;
+};
+
+//! Converts the result to Arrow arrays in the pipeline threads, and streams the arrays to the consumer as soon as
+//! they are finished (in batch index order if insertion order is preserved)
+class PhysicalArrowStreamCollector : public PhysicalResultCollector {
+public:
+	PhysicalArrowStreamCollector(PreparedStatementData &data, bool parallel, bool ordered, idx_t batch_size);
+
+public:
+	static unique_ptr<PhysicalResultCollector> Create(ClientContext &context, PreparedStatementData &data,
+	                                                  idx_t batch_size);
+	unique_ptr<QueryResult> GetResult(GlobalSinkState &state) override;
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkNextBatchType NextBatch(ExecutionContext &context, OperatorSinkNextBatchInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+
+	bool RequiresBatchIndex() const override {
+		return ordered;
+	}
+	bool ParallelSink() const override {
+		return parallel;
+	}
+	bool SinkOrderDependent() const override {
+		return true;
+	}
+	bool IsStreaming() const override {
+		return true;
+	}
+
+public:
+	//! User provided batch size
+	idx_t record_batch_size;
+	bool parallel;
+	//! Whether the arrays are streamed in batch index order
+	bool ordered;
+
+private:
+	void FinishArray(ArrowStreamCollectorLocalState &lstate, ArrowBufferedData &buffered_data) const;
+};
+
+} // namespace duckdb
@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/async_file_read.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/parallel/interrupt.hpp"
+
+#include <condition_variable>
+
+namespace duckdb {
+class FileHandle;
+class FileSystem;
+
+//! A read that was issued through FileSystem::ReadAsync. The buffer and the file handle must stay alive until the read
+//! has completed.
+class AsyncFileRead {
+public:
+	AsyncFileRead(FileSystem &fs, FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
+	//! A read from the current position of the handle (e.g., of a compressed file), which reads until "nr_bytes" have
+	//! been read or the end of the file is reached. The handle is positioned after the read data.
+	AsyncFileRead(FileSystem &fs, FileHandle &handle, void *buffer, int64_t nr_bytes);
+
+	//! Performs the read on the calling thread and marks the request as completed
+	void Execute();
+	//! Whether the read has completed (successfully or not)
+	bool IsDone();
+	//! Blocks until the read has completed, throws if the read failed
+	void Wait();
+	//! Registers a task to be rescheduled once the read has completed. Returns false if the read has already completed,
+	//! in which case the caller can proceed right away instead of returning BLOCKED.
+	bool AddWaiter(const InterruptState &state);
+
+	int64_t GetSize() const {
+		return nr_bytes;
+	}
+	idx_t GetLocation() const {
+		return location;
+	}
+	//! Whether this read continues from the current position of the handle
+	bool IsSequential() const {
+		return sequential;
+	}
+	//! The amount of bytes that were read - only valid once the read has completed
+	int64_t GetBytesRead() const {
+		return bytes_read;
+	}
+
+private:
+	FileSystem &fs;
+	FileHandle &handle;
+	void *buffer;
+	int64_t nr_bytes;
+	idx_t location;
+	bool sequential;
+	int64_t bytes_read = 0;
+
+	mutex lock;
+	std::condition_variable cv;
+	bool done = false;
+	//! The error raised by the read (if any)
+	ErrorData error;
+	//! Tasks waiting for this read to complete
+	vector<InterruptState> waiters;
+};
+
+//! Background threads that execute asynchronous reads for file systems without native support for asynchronous I/O
+class AsyncFileReadThreads {
+public:
+	explicit AsyncFileReadThreads(idx_t thread_count);
+	~AsyncFileReadThreads();
+
+	//! Queues the read to be executed by one of the background threads
+	void Schedule(shared_ptr<AsyncFileRead> read);
+
+private:
+	void Run();
+
+	mutex lock;
+	std::condition_variable cv;
+	bool shutdown = false;
+	deque<shared_ptr<AsyncFileRead>> pending;
+	vector<unique_ptr<thread>> threads;
+};
+
+} // namespace duckdb
@@ -30,6 +30,8 @@ public:
 	static constexpr const idx_t BITPACKING_ALGORITHM_GROUP_SIZE = 32;
 	static constexpr const idx_t BITPACKING_HEADER_SIZE = sizeof(uint64_t);
 	static constexpr const bool BYTE_ALIGNED = false;
+	//! The number of values that are packed together in the interleaved layout
+	static constexpr const idx_t INTERLEAVED_BLOCK_SIZE = 1024;
 
 	// To ensure enough data is available, use GetRequiredSize() to determine the correct size for dst buffer
 	// Note: input should be aligned to BITPACKING_ALGORITHM_GROUP_SIZE for good performance.
@@ -105,6 +107,64 @@ public:
 		return ((count * width) / 8);
 	}
 
+	// The interleaved (FastLanes) layout spreads a block of INTERLEAVED_BLOCK_SIZE values over the lanes of a 1024-bit
+	// virtual register: value i is stored in lane (i % lanes), and every lane packs its values into consecutive words
+	// of the lane. All lanes are (un)packed with the same shifts and masks, so the loops over the lanes are vectorized
+	// by the compiler for whatever SIMD width the build targets. Unpacking 16-64 bit integers additionally uses AVX2
+	// when the CPU supports it (see bitpacking_interleaved.cpp). Only 8-64 bit integer types are supported.
+	template <class T>
+	inline static void PackInterleaved(data_ptr_t dst, const T *src, bitpacking_width_t width) {
+		if (std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value) {
+			PackInterleavedBlock(reinterpret_cast<uint8_t *>(dst), reinterpret_cast<const uint8_t *>(src), width);
+		} else if (std::is_same<T, int16_t>::value || std::is_same<T, uint16_t>::value) {
+			PackInterleavedBlock(reinterpret_cast<uint16_t *>(dst), reinterpret_cast<const uint16_t *>(src), width);
+		} else if (std::is_same<T, int32_t>::value || std::is_same<T, uint32_t>::value) {
+			PackInterleavedBlock(reinterpret_cast<uint32_t *>(dst), reinterpret_cast<const uint32_t *>(src), width);
+		} else if (std::is_same<T, int64_t>::value || std::is_same<T, uint64_t>::value) {
+			PackInterleavedBlock(reinterpret_cast<uint64_t *>(dst), reinterpret_cast<const uint64_t *>(src), width);
+		} else {
+			throw InternalException("Unsupported type for interleaved bitpacking");
+		}
+	}
+
+	// Unpacks a block of INTERLEAVED_BLOCK_SIZE values, the values are not sign extended
+	template <class T>
+	inline static void UnPackInterleaved(data_ptr_t dst, const_data_ptr_t src, bitpacking_width_t width) {
+		if (std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value) {
+			UnPackInterleavedBlock(reinterpret_cast<uint8_t *>(dst), reinterpret_cast<const uint8_t *>(src), width);
+		} else if (std::is_same<T, int16_t>::value || std::is_same<T, uint16_t>::value) {
+			UnPackInterleavedSIMD(reinterpret_cast<uint16_t *>(dst), reinterpret_cast<const uint16_t *>(src), width);
+		} else if (std::is_same<T, int32_t>::value || std::is_same<T, uint32_t>::value) {
+			UnPackInterleavedSIMD(reinterpret_cast<uint32_t *>(dst), reinterpret_cast<const uint32_t *>(src), width);
+		} else if (std::is_same<T, int64_t>::value || std::is_same<T, uint64_t>::value) {
+			UnPackInterleavedSIMD(reinterpret_cast<uint64_t *>(dst), reinterpret_cast<const uint64_t *>(src), width);
+		} else {
+			throw InternalException("Unsupported type for interleaved bitpacking");
+		}
+	}
+
+	// Unpacks the value at position "index" of a block in the interleaved layout
+	template <class T>
+	inline static void UnPackInterleavedValue(data_ptr_t dst, const_data_ptr_t src, idx_t index,
+	                                          bitpacking_width_t width) {
+		if (std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value) {
+			Store<uint8_t>(UnPackInterleavedSingle(reinterpret_cast<const uint8_t *>(src), index, width), dst);
+		} else if (std::is_same<T, int16_t>::value || std::is_same<T, uint16_t>::value) {
+			Store<uint16_t>(UnPackInterleavedSingle(reinterpret_cast<const uint16_t *>(src), index, width), dst);
+		} else if (std::is_same<T, int32_t>::value || std::is_same<T, uint32_t>::value) {
+			Store<uint32_t>(UnPackInterleavedSingle(reinterpret_cast<const uint32_t *>(src), index, width), dst);
+		} else if (std::is_same<T, int64_t>::value || std::is_same<T, uint64_t>::value) {
+			Store<uint64_t>(UnPackInterleavedSingle(reinterpret_cast<const uint64_t *>(src), index, width), dst);
+		} else {
+			throw InternalException("Unsupported type for interleaved bitpacking");
+		}
+	}
+
+	inline static idx_t GetRequiredInterleavedSize(idx_t count, bitpacking_width_t width) {
+		auto block_count = (count + INTERLEAVED_BLOCK_SIZE - 1) / INTERLEAVED_BLOCK_SIZE;
+		return block_count * INTERLEAVED_BLOCK_SIZE * width / 8;
+	}
+
 	template <class T>
 	inline static T RoundUpToAlgorithmGroupSize(T num_to_round) {
 		int remainder = num_to_round % BITPACKING_ALGORITHM_GROUP_SIZE;
@@ -209,6 +269,96 @@ private:
 		return width;
 	}
 
+	template <class T>
+	static inline T InterleavedMask(bitpacking_width_t width) {
+		return width >= sizeof(T) * 8 ? NumericLimits<T>::Maximum() : static_cast<T>((T(1) << width) - 1);
+	}
+
+	template <class T>
+	static void PackInterleavedBlock(T *__restrict dst, const T *__restrict src, bitpacking_width_t width) {
+		static constexpr idx_t TYPE_BITS = sizeof(T) * 8;
+		static constexpr idx_t LANES = INTERLEAVED_BLOCK_SIZE / TYPE_BITS;
+		memset(dst, 0, width * LANES * sizeof(T));
+		const T mask = InterleavedMask<T>(width);
+		idx_t word = 0;
+		idx_t shift = 0;
+		for (idx_t row = 0; row < TYPE_BITS && width > 0; row++) {
+			auto src_row = src + row * LANES;
+			auto dst_word = dst + word * LANES;
+			for (idx_t lane = 0; lane < LANES; lane++) {
+				dst_word[lane] |= static_cast<T>((src_row[lane] & mask) << shift);
+			}
+			if (shift + width > TYPE_BITS) {
+				// the value continues in the next word of the lane
+				auto next_word = dst_word + LANES;
+				for (idx_t lane = 0; lane < LANES; lane++) {
+					next_word[lane] |= static_cast<T>((src_row[lane] & mask) >> (TYPE_BITS - shift));
+				}
+			}
+			shift += width;
+			word += shift / TYPE_BITS;
+			shift %= TYPE_BITS;
+		}
+	}
+
+	// Unpack a block with the widest SIMD instructions that the CPU supports, or with UnPackInterleavedBlock
+	static void UnPackInterleavedSIMD(uint16_t *__restrict dst, const uint16_t *__restrict src,
+	                                  bitpacking_width_t width);
+	static void UnPackInterleavedSIMD(uint32_t *__restrict dst, const uint32_t *__restrict src,
+	                                  bitpacking_width_t width);
+	static void UnPackInterleavedSIMD(uint64_t *__restrict dst, const uint64_t *__restrict src,
+	                                  bitpacking_width_t width);
+
+	template <class T>
+	static void UnPackInterleavedBlock(T *__restrict dst, const T *__restrict src, bitpacking_width_t width) {
+		static constexpr idx_t TYPE_BITS = sizeof(T) * 8;
+		static constexpr idx_t LANES = INTERLEAVED_BLOCK_SIZE / TYPE_BITS;
+		if (width == 0) {
+			memset(dst, 0, INTERLEAVED_BLOCK_SIZE * sizeof(T));
+			return;
+		}
+		const T mask = InterleavedMask<T>(width);
+		idx_t word = 0;
+		idx_t shift = 0;
+		for (idx_t row = 0; row < TYPE_BITS; row++) {
+			auto dst_row = dst + row * LANES;
+			auto src_word = src + word * LANES;
+			if (shift + width <= TYPE_BITS) {
+				for (idx_t lane = 0; lane < LANES; lane++) {
+					dst_row[lane] = static_cast<T>(src_word[lane] >> shift) & mask;
+				}
+			} else {
+				auto next_word = src_word + LANES;
+				auto remaining_shift = TYPE_BITS - shift;
+				for (idx_t lane = 0; lane < LANES; lane++) {
+					dst_row[lane] =
+					    static_cast<T>((src_word[lane] >> shift) | (next_word[lane] << remaining_shift)) & mask;
+				}
+			}
+			shift += width;
+			word += shift / TYPE_BITS;
+			shift %= TYPE_BITS;
+		}
+	}
+
+	template <class T>
+	static T UnPackInterleavedSingle(const T *src, idx_t index, bitpacking_width_t width) {
+		static constexpr idx_t TYPE_BITS = sizeof(T) * 8;
+		static constexpr idx_t LANES = INTERLEAVED_BLOCK_SIZE / TYPE_BITS;
+		if (width == 0) {
+			return 0;
+		}
+		auto lane = index % LANES;
+		auto bit = (index / LANES) * width;
+		auto shift = bit % TYPE_BITS;
+		auto src_word = src + (bit / TYPE_BITS) * LANES;
+		auto value = static_cast<T>(src_word[lane] >> shift);
+		if (shift + width > TYPE_BITS) {
+			value |= static_cast<T>(src_word[LANES + lane] << (TYPE_BITS - shift));
+		}
+		return value & InterleavedMask<T>(width);
+	}
+
 	template <class T>
 	static inline void PackGroup(data_ptr_t dst, T *values, bitpacking_width_t width) {
 		if (std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value) {
@@ -12,7 +12,19 @@
 
 namespace duckdb {
 
+//! The algorithm used to compute the checksums of the blocks in a database file
+enum class ChecksumType : uint8_t {
+	//! The multiply-xor checksum used by older storage versions
+	LEGACY = 0,
+	//! CRC32C (Castagnoli), computed with the CRC instructions of the CPU when available
+	CRC32C = 1
+};
+
 //! Compute a checksum over a buffer of size size
 uint64_t Checksum(uint8_t *buffer, size_t size);
+//! Compute a checksum over a buffer of size size using the given checksum algorithm
+uint64_t Checksum(uint8_t *buffer, size_t size, ChecksumType type);
+//! Compute the CRC32C of a buffer of size size
+uint32_t CRC32C(const_data_ptr_t buffer, size_t size);
 
 } // namespace duckdb
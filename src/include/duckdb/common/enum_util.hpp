@@ -72,6 +72,8 @@ enum class BitpackingMode : uint8_t;
 
 enum class BlockState : uint8_t;
 
+enum class BufferEvictionPolicy : uint8_t;
+
 enum class CAPIResultSetType : uint8_t;
 
 enum class CSVState : uint8_t;
@@ -84,6 +86,8 @@ enum class CatalogType : uint8_t;
 
 enum class CheckpointAbort : uint8_t;
 
+enum class ChecksumType : uint8_t;
+
 enum class ChunkInfoType : uint8_t;
 
 enum class ColumnDataAllocatorType : uint8_t;
@@ -172,8 +176,12 @@ enum class FunctionStability : uint8_t;
 
 enum class GateStatus : uint8_t;
 
+enum class HLLSketchFormat : uint8_t;
+
 enum class HLLStorageType : uint8_t;
 
+enum class HardwareCounter : uint8_t;
+
 enum class IndexConstraintType : uint8_t;
 
 enum class InsertColumnOrder : uint8_t;
@@ -258,6 +266,8 @@ enum class QuantileSerializationType : uint8_t;
 
 enum class QueryNodeType : uint8_t;
 
+enum class QueryPriority : uint8_t;
+
 enum class QueryResultType : uint8_t;
 
 enum class QuoteRule : uint8_t;
@@ -419,6 +429,9 @@ const char* EnumUtil::ToChars<BitpackingMode>(BitpackingMode value);
 template<>
 const char* EnumUtil::ToChars<BlockState>(BlockState value);
 
+template<>
+const char* EnumUtil::ToChars<BufferEvictionPolicy>(BufferEvictionPolicy value);
+
 template<>
 const char* EnumUtil::ToChars<CAPIResultSetType>(CAPIResultSetType value);
 
@@ -437,6 +450,9 @@ const char* EnumUtil::ToChars<CatalogType>(CatalogType value);
 template<>
 const char* EnumUtil::ToChars<CheckpointAbort>(CheckpointAbort value);
 
+template<>
+const char* EnumUtil::ToChars<ChecksumType>(ChecksumType value);
+
 template<>
 const char* EnumUtil::ToChars<ChunkInfoType>(ChunkInfoType value);
 
@@ -569,9 +585,15 @@ const char* EnumUtil::ToChars<FunctionStability>(FunctionStability value);
 template<>
 const char* EnumUtil::ToChars<GateStatus>(GateStatus value);
 
+template<>
+const char* EnumUtil::ToChars<HLLSketchFormat>(HLLSketchFormat value);
+
 template<>
 const char* EnumUtil::ToChars<HLLStorageType>(HLLStorageType value);
 
+template<>
+const char* EnumUtil::ToChars<HardwareCounter>(HardwareCounter value);
+
 template<>
 const char* EnumUtil::ToChars<IndexConstraintType>(IndexConstraintType value);
 
@@ -698,6 +720,9 @@ const char* EnumUtil::ToChars<QuantileSerializationType>(QuantileSerializationTy
 template<>
 const char* EnumUtil::ToChars<QueryNodeType>(QueryNodeType value);
 
+template<>
+const char* EnumUtil::ToChars<QueryPriority>(QueryPriority value);
+
 template<>
 const char* EnumUtil::ToChars<QueryResultType>(QueryResultType value);
 
@@ -909,6 +934,9 @@ BitpackingMode EnumUtil::FromString<BitpackingMode>(const char *value);
 template<>
 BlockState EnumUtil::FromString<BlockState>(const char *value);
 
+template<>
+BufferEvictionPolicy EnumUtil::FromString<BufferEvictionPolicy>(const char *value);
+
 template<>
 CAPIResultSetType EnumUtil::FromString<CAPIResultSetType>(const char *value);
 
@@ -927,6 +955,9 @@ CatalogType EnumUtil::FromString<CatalogType>(const char *value);
 template<>
 CheckpointAbort EnumUtil::FromString<CheckpointAbort>(const char *value);
 
+template<>
+ChecksumType EnumUtil::FromString<ChecksumType>(const char *value);
+
 template<>
 ChunkInfoType EnumUtil::FromString<ChunkInfoType>(const char *value);
 
@@ -1059,9 +1090,15 @@ FunctionStability EnumUtil::FromString<FunctionStability>(const char *value);
 template<>
 GateStatus EnumUtil::FromString<GateStatus>(const char *value);
 
+template<>
+HLLSketchFormat EnumUtil::FromString<HLLSketchFormat>(const char *value);
+
 template<>
 HLLStorageType EnumUtil::FromString<HLLStorageType>(const char *value);
 
+template<>
+HardwareCounter EnumUtil::FromString<HardwareCounter>(const char *value);
+
 template<>
 IndexConstraintType EnumUtil::FromString<IndexConstraintType>(const char *value);
 
@@ -1188,6 +1225,9 @@ QuantileSerializationType EnumUtil::FromString<QuantileSerializationType>(const
 template<>
 QueryNodeType EnumUtil::FromString<QueryNodeType>(const char *value);
 
+template<>
+QueryPriority EnumUtil::FromString<QueryPriority>(const char *value);
+
 template<>
 QueryResultType EnumUtil::FromString<QueryResultType>(const char *value);
 
@@ -0,0 +1,21 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/buffer_eviction_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The policy the buffer pool uses to pick persistent blocks to evict
+//! LRU:       Evict the least recently unpinned block first.
+//! TWO_QUEUE: Blocks that were unpinned only once (e.g., by a large sequential scan) are evicted before blocks that
+//!            were used repeatedly, so that one-off scans do not flush out frequently used blocks.
+enum class BufferEvictionPolicy : uint8_t { LRU = 0, TWO_QUEUE = 1 };
+
+} // namespace duckdb
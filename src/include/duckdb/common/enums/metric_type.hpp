@@ -31,6 +31,15 @@ enum class MetricsType : uint8_t {
     OPERATOR_ROWS_SCANNED,
     OPERATOR_TIMING,
     RESULT_SET_SIZE,
+    PEAK_QUERY_MEMORY,
+    TEMPORARY_BYTES_WRITTEN,
+    OPERATOR_CPU_CYCLES,
+    OPERATOR_INSTRUCTIONS,
+    OPERATOR_CACHE_MISSES,
+    OPERATOR_BRANCH_MISSES,
+    OPERATOR_BYTES_READ,
+    OPERATOR_READ_OPERATIONS,
+    OPERATOR_READ_TIME,
     ALL_OPTIMIZERS,
     CUMULATIVE_OPTIMIZER_TIMING,
     PLANNER,
@@ -39,6 +48,8 @@ enum class MetricsType : uint8_t {
     PHYSICAL_PLANNER_COLUMN_BINDING,
     PHYSICAL_PLANNER_RESOLVE_TYPES,
     PHYSICAL_PLANNER_CREATE_PLAN,
+    JOIN_ORDER_EXACT_ENUMERATION,
+    JOIN_ORDER_APPROXIMATE_ENUMERATION,
     OPTIMIZER_EXPRESSION_REWRITER,
     OPTIMIZER_FILTER_PULLUP,
     OPTIMIZER_FILTER_PUSHDOWN,
@@ -62,6 +73,9 @@ enum class MetricsType : uint8_t {
     OPTIMIZER_JOIN_FILTER_PUSHDOWN,
     OPTIMIZER_EXTENSION,
     OPTIMIZER_MATERIALIZED_CTE,
+    OPTIMIZER_EAGER_AGGREGATE,
+    OPTIMIZER_JOIN_ELIMINATION,
+    OPTIMIZER_SAMPLING_PUSHDOWN,
 };
 
 struct MetricsTypeHashFunction {
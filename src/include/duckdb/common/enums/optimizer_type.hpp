@@ -38,6 +38,9 @@ enum class OptimizerType : uint32_t {
 	JOIN_FILTER_PUSHDOWN,
 	EXTENSION,
 	MATERIALIZED_CTE,
+	EAGER_AGGREGATE,
+	JOIN_ELIMINATION,
+	SAMPLING_PUSHDOWN,
 };
 
 string OptimizerTypeToString(OptimizerType type);
@@ -22,11 +22,13 @@ enum class PhysicalOperatorType : uint8_t {
 	STREAMING_LIMIT,
 	LIMIT_PERCENT,
 	TOP_N,
+	GROUPED_TOP_N,
 	WINDOW,
 	UNNEST,
 	UNGROUPED_AGGREGATE,
 	HASH_GROUP_BY,
 	PERFECT_HASH_GROUP_BY,
+	STREAMING_GROUP_BY,
 	FILTER,
 	PROJECTION,
 	COPY_TO_FILE,
@@ -57,11 +59,14 @@ enum class PhysicalOperatorType : uint8_t {
 	HASH_JOIN,
 	CROSS_PRODUCT,
 	PIECEWISE_MERGE_JOIN,
+	MERGE_JOIN,
+	MULTIWAY_JOIN,
 	IE_JOIN,
 	LEFT_DELIM_JOIN,
 	RIGHT_DELIM_JOIN,
 	POSITIONAL_JOIN,
 	ASOF_JOIN,
+	INDEX_JOIN,
 	// -----------------------------
 	// SetOps
 	// -----------------------------
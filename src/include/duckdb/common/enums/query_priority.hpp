@@ -0,0 +1,18 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/query_priority.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The priority class of the tasks of a query, which determines its share of the scheduler's threads
+enum class QueryPriority : uint8_t { LOW = 0, NORMAL = 1, HIGH = 2 };
+
+} // namespace duckdb
@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <cstring>
 #include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/parser/parsed_data/sample_options.hpp"
 
 namespace duckdb {
 
@@ -26,6 +27,9 @@ public:
 		if (extra_info.filtered_files.IsValid()) {
 			filtered_files = extra_info.filtered_files.GetIndex();
 		}
+		if (extra_info.sample_options) {
+			sample_options = extra_info.sample_options->Copy();
+		}
 	}
 
 	//! Filters that have been pushed down into the main file list
@@ -34,6 +38,8 @@ public:
 	optional_idx total_files;
 	//! Size of file list after applying filters
 	optional_idx filtered_files;
+	//! A system sample that has been pushed down into the scan
+	unique_ptr<SampleOptions> sample_options;
 };
 
 } // namespace duckdb
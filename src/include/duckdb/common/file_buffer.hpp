@@ -38,6 +38,8 @@ public:
 	data_ptr_t buffer;
 	//! The size of the portion that users can write to, this is equivalent to internal_size - BLOCK_HEADER_SIZE
 	uint64_t size;
+	//! The NUMA node of the thread that allocated the buffer - with first-touch placement its memory lives there
+	idx_t numa_node;
 
 public:
 	//! Read into the FileBuffer from the specified location.
@@ -57,6 +59,10 @@ public:
 	data_ptr_t InternalBuffer() {
 		return internal_buffer;
 	}
+	//! Whether the memory of this buffer can be handed over to another buffer (i.e., the buffer owns its memory)
+	virtual bool IsReusable() const {
+		return true;
+	}
 
 	struct MemoryRequirement {
 		idx_t alloc_size;
@@ -26,6 +26,7 @@
 #undef RemoveDirectory
 
 namespace duckdb {
+class AsyncFileRead;
 class AttachedDatabase;
 class ClientContext;
 class DatabaseInstance;
@@ -123,6 +124,11 @@ public:
 	DUCKDB_API virtual int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes);
 	//! Write nr_bytes from the buffer into the file, moving the file pointer forward by nr_bytes.
 	DUCKDB_API virtual int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes);
+	//! Start reading exactly nr_bytes from the specified location in the file without waiting for the read to finish.
+	//! The buffer and the handle must stay alive until the read has completed. File systems without support for
+	//! asynchronous I/O perform the read right away.
+	DUCKDB_API virtual shared_ptr<AsyncFileRead> ReadAsync(FileHandle &handle, void *buffer, int64_t nr_bytes,
+	                                                       idx_t location);
 	//! Excise a range of the file. The OS can drop pages from the page-cache, and the file-system is free to deallocate
 	//! this range (sparse file support). Reads to the range will succeed but will return undefined data.
 	DUCKDB_API virtual bool Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes);
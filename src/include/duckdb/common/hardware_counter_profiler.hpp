@@ -0,0 +1,38 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/hardware_counter_profiler.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/array.hpp"
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+enum class HardwareCounter : uint8_t { CPU_CYCLES = 0, INSTRUCTIONS = 1, CACHE_MISSES = 2, BRANCH_MISSES = 3 };
+
+static constexpr const idx_t HARDWARE_COUNTER_COUNT = 4;
+typedef array<uint64_t, HARDWARE_COUNTER_COUNT> hardware_counter_values_t;
+
+//! The hardware counter profiler measures the hardware events (cycles, instructions, last-level cache misses and
+//! branch misses) of the calling thread between Start() and End(). The counters are read through perf_event_open, and
+//! are only available on Linux when the process is allowed to open performance events for itself
+class HardwareCounterProfiler {
+public:
+	//! Starts counting, returns false if the hardware counters are not available on this thread
+	DUCKDB_API bool Start();
+	//! Finishes counting, must be called on the same thread as Start()
+	DUCKDB_API void End();
+	//! Returns the number of events of the counter between Start() and End(), or 0 if the counter is not available
+	DUCKDB_API uint64_t Elapsed(HardwareCounter counter) const;
+
+private:
+	hardware_counter_values_t start {};
+	hardware_counter_values_t end {};
+};
+
+} // namespace duckdb
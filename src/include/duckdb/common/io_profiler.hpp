@@ -0,0 +1,61 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/io_profiler.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The file reads done by a thread
+struct IOStatistics {
+	idx_t bytes_read = 0;
+	idx_t read_operations = 0;
+	//! The time spent in reads, in nanoseconds
+	idx_t read_time = 0;
+};
+
+//! The reads are counted in a latency histogram: bucket i holds the reads that took less than 16us * 4^i, the last
+//! bucket holds all slower reads
+static constexpr const idx_t IO_LATENCY_BUCKET_COUNT = 8;
+
+//! The IOProfiler is the accounting layer for the I/O of queries. The file systems report every read to it, and the
+//! buffer manager reports buffer pool hits and misses and wasted prefetches. These are accounted to the calling thread,
+//! which the operator profiler uses to attribute reads to operators (through Start() and End()), and to the query that
+//! is active on the thread (see QueryTelemetry).
+class IOProfiler {
+public:
+	//! Records a read of a local or remote file that started at read_start
+	DUCKDB_API static void RecordRead(idx_t bytes, time_point<std::chrono::steady_clock> read_start, bool remote);
+	//! Records a buffer pool pin that found the block in memory (hit) or had to read it (miss)
+	DUCKDB_API static void RecordBufferPin(bool hit);
+	//! Records data that was read ahead but was not used
+	DUCKDB_API static void RecordPrefetchWaste(idx_t bytes);
+
+	//! The latency histogram bucket of a read that took read_time nanoseconds
+	static idx_t GetLatencyBucket(idx_t read_time);
+	//! The name of a latency histogram bucket, e.g. "<16us"
+	static const char *GetLatencyBucketName(idx_t bucket);
+
+public:
+	//! Starts counting the reads of the calling thread
+	void Start();
+	//! Finishes counting, must be called on the same thread as Start()
+	void End();
+	//! The reads of the thread between Start() and End()
+	const IOStatistics &Elapsed() const {
+		return elapsed;
+	}
+
+private:
+	IOStatistics start;
+	IOStatistics elapsed;
+};
+
+} // namespace duckdb
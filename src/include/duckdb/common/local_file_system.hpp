@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/async_file_read.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/windows_undefs.hpp"
 
@@ -29,6 +30,8 @@ public:
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
 	//! Write nr_bytes from the buffer into the file, moving the file pointer forward by nr_bytes.
 	int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+	//! Start reading nr_bytes from the specified location on one of the background I/O threads
+	shared_ptr<AsyncFileRead> ReadAsync(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
 	//! Excise a range of the file. The file-system is free to deallocate this
 	//! range (sparse file support). Reads to the range will succeed but will return
 	//! undefined data.
@@ -102,6 +105,12 @@ private:
 	idx_t GetFilePointer(FileHandle &handle);
 
 	vector<string> FetchFileWithoutGlob(const string &path, FileOpener *opener, bool absolute_path);
+
+	//! The number of background threads used to perform asynchronous reads
+	static constexpr idx_t ASYNC_READ_THREADS = 2;
+	mutex async_read_lock;
+	//! Background threads performing asynchronous reads, started on the first call to ReadAsync
+	unique_ptr<AsyncFileReadThreads> async_read_threads;
 };
 
 } // namespace duckdb
@@ -13,6 +13,7 @@
 #include "duckdb/common/extra_operator_info.hpp"
 
 namespace duckdb {
+class BaseStatistics;
 class MultiFileList;
 
 enum class FileExpandResult : uint8_t { NO_FILES, SINGLE_FILE, MULTIPLE_FILES };
@@ -63,6 +64,17 @@ struct MultiFilePushdownInfo {
 	ExtraOperatorInfo &extra_info;
 };
 
+//! A source of the statistics of the columns of files (e.g., cached file footers or an external manifest). Multi-file
+//! scans use them to skip files that cannot match the filters of the query before the files are opened
+class MultiFileStatisticsProvider {
+public:
+	virtual ~MultiFileStatisticsProvider() = default;
+
+	//! Returns the statistics of the column of the file, or nullptr if they are not known
+	virtual unique_ptr<BaseStatistics> GetColumnStatistics(ClientContext &context, const string &file_name,
+	                                                       const string &column_name, const LogicalType &type) = 0;
+};
+
 //! Abstract class for lazily generated list of file paths/globs
 //! NOTE: subclasses are responsible for ensuring thread-safety
 class MultiFileList {
@@ -0,0 +1,40 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/numa.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/file_system.hpp"
+
+namespace duckdb {
+
+//! The NUMA topology of the machine, restricted to the CPUs this process may run on
+class NumaTopology {
+public:
+	//! Returns the CPUs of every NUMA node that has CPUs available to this process.
+	//! Returns a single node with no CPUs if the topology is unknown.
+	static vector<vector<idx_t>> GetNodeCPUs(FileSystem &fs);
+	//! Returns the NUMA node of every CPU, given the CPUs of every node
+	static vector<idx_t> GetCPUNodes(const vector<vector<idx_t>> &node_cpus);
+	//! Returns the topology of the local machine, which is only read once
+	static const NumaTopology &Get();
+	//! Returns the NUMA node of the CPU the calling thread is (estimated to be) running on, using the topology of the
+	//! local machine. Returns 0 if the machine has a single node or the topology is unknown.
+	static idx_t GetCurrentNode();
+
+	//! The CPUs of every node
+	vector<vector<idx_t>> node_cpus;
+	//! The node of every CPU
+	vector<idx_t> cpu_nodes;
+
+private:
+	//! Parses a list of CPUs in the format of the Linux kernel (e.g. "0-3,8,10-11")
+	static vector<idx_t> ParseCPUList(const string &cpu_list);
+};
+
+} // namespace duckdb
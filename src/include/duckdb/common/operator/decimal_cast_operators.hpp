@@ -659,6 +659,72 @@ struct DecimalCastOperation {
 	}
 };
 
+//! Fast path for the most common input: a plain (optionally negative) number with at most "scale" decimals and
+//! without spaces or exponents, that fits in an int64_t. Returns false if the input does not have this shape.
+template <class T, char decimal_separator = '.'>
+bool TryPlainDecimalCast(const char *string_ptr, idx_t string_size, T &result, uint8_t width, uint8_t scale) {
+	if (!std::is_integral<T>::value) {
+		return false;
+	}
+	static constexpr const idx_t MAX_DIGITS = 18;
+	const bool negative = string_size > 0 && *string_ptr == '-';
+	idx_t pos = negative ? 1 : 0;
+	int64_t value = 0;
+	idx_t integer_digits = 0;
+	uint32_t digits;
+	while (pos + 8 <= string_size && integer_digits + 8 + scale <= MAX_DIGITS &&
+	       NumericHelper::TryParseEightDigits(string_ptr + pos, digits)) {
+		value = value * 100000000 + digits;
+		integer_digits += 8;
+		pos += 8;
+	}
+	for (; pos < string_size; pos++) {
+		auto digit = static_cast<uint8_t>(string_ptr[pos] - '0');
+		if (digit > 9) {
+			break;
+		}
+		if (integer_digits + scale >= MAX_DIGITS) {
+			return false;
+		}
+		value = value * 10 + digit;
+		integer_digits++;
+	}
+	idx_t decimal_digits = 0;
+	if (pos < string_size) {
+		if (string_ptr[pos] != decimal_separator) {
+			return false;
+		}
+		pos++;
+		while (pos + 8 <= string_size && decimal_digits + 8 <= scale &&
+		       NumericHelper::TryParseEightDigits(string_ptr + pos, digits)) {
+			value = value * 100000000 + digits;
+			decimal_digits += 8;
+			pos += 8;
+		}
+		for (; pos < string_size; pos++) {
+			auto digit = static_cast<uint8_t>(string_ptr[pos] - '0');
+			if (digit > 9 || decimal_digits == scale) {
+				// not a digit, or the value needs to be rounded
+				return false;
+			}
+			value = value * 10 + digit;
+			decimal_digits++;
+		}
+	}
+	if (integer_digits + decimal_digits == 0) {
+		return false;
+	}
+	for (; decimal_digits < scale; decimal_digits++) {
+		value *= 10;
+	}
+	if (value >= NumericHelper::POWERS_OF_TEN[width]) {
+		return false;
+	}
+	// the value is below 10^width, so it always fits in T
+	result = static_cast<T>(negative ? -value : value);
+	return true;
+}
+
 template <class T, char decimal_separator = '.'>
 bool TryDecimalStringCast(string_t input, T &result, CastParameters &parameters, uint8_t width, uint8_t scale) {
 	return TryDecimalStringCast<T, decimal_separator>(input.GetData(), input.GetSize(), result, parameters, width,
@@ -668,6 +734,9 @@ bool TryDecimalStringCast(string_t input, T &result, CastParameters &parameters,
 template <class T, char decimal_separator = '.'>
 bool TryDecimalStringCast(const char *string_ptr, idx_t string_size, T &result, CastParameters &parameters,
                           uint8_t width, uint8_t scale) {
+	if (TryPlainDecimalCast<T, decimal_separator>(string_ptr, string_size, result, width, scale)) {
+		return true;
+	}
 	DecimalCastData<T> state;
 	state.result = 0;
 	state.width = width;
@@ -693,6 +762,9 @@ bool TryDecimalStringCast(const char *string_ptr, idx_t string_size, T &result,
 
 template <class T, char decimal_separator = '.'>
 bool TryDecimalStringCast(const char *string_ptr, idx_t string_size, T &result, uint8_t width, uint8_t scale) {
+	if (TryPlainDecimalCast<T, decimal_separator>(string_ptr, string_size, result, width, scale)) {
+		return true;
+	}
 	DecimalCastData<T> state;
 	state.result = 0;
 	state.width = width;
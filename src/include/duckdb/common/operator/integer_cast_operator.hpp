@@ -12,6 +12,7 @@
 #include "duckdb/common/operator/multiply.hpp"
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
+#include "duckdb/common/types/cast_helpers.hpp"
 
 namespace duckdb {
 template <typename T>
@@ -438,8 +439,50 @@ static bool TryIntegerCast(const char *buf, idx_t len, T &result, bool strict) {
 	return IntegerCastLoop<T, false, ALLOW_EXPONENT, OP, decimal_separator>(buf, len, result, strict);
 }
 
+//! Fast path for the most common input: a plain (optionally negative) decimal number without spaces, separators,
+//! exponents or prefixes, with too few digits to overflow T. Returns false if the input does not have this shape.
+template <typename T, bool IS_SIGNED>
+static inline bool TryPlainIntegerCast(const char *buf, idx_t len, T &result, bool strict) {
+	using accumulate_t = typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type;
+	if (!std::is_integral<T>::value || sizeof(T) > sizeof(accumulate_t)) {
+		return false;
+	}
+	const bool negative = IS_SIGNED && std::is_signed<T>::value && len > 0 && *buf == '-';
+	const idx_t start_pos = negative ? 1 : 0;
+	const idx_t digit_count = len - start_pos;
+	// every number with fewer digits than the maximum value of T fits in T
+	if (digit_count == 0 || digit_count >= NumericLimits<T>::Digits()) {
+		return false;
+	}
+	if (strict && digit_count > 1 && buf[start_pos] == '0') {
+		// leading zeros are not allowed in strict mode
+		return false;
+	}
+	accumulate_t value = 0;
+	idx_t pos = start_pos;
+	for (; pos + 8 <= len; pos += 8) {
+		uint32_t digits;
+		if (!NumericHelper::TryParseEightDigits(buf + pos, digits)) {
+			return false;
+		}
+		value = value * 100000000 + digits;
+	}
+	for (; pos < len; pos++) {
+		auto digit = static_cast<uint8_t>(buf[pos] - '0');
+		if (digit > 9) {
+			return false;
+		}
+		value = value * 10 + digit;
+	}
+	result = static_cast<T>(negative ? 0 - value : value);
+	return true;
+}
+
 template <typename T, bool IS_SIGNED = true>
 static inline bool TrySimpleIntegerCast(const char *buf, idx_t len, T &result, bool strict) {
+	if (TryPlainIntegerCast<T, IS_SIGNED>(buf, len, result, strict)) {
+		return true;
+	}
 	IntegerCastData<T> simple_data;
 	if (TryIntegerCast<IntegerCastData<T>, IS_SIGNED, false, IntegerCastOperation>(buf, len, simple_data, strict)) {
 		result = (T)simple_data.result;
@@ -0,0 +1,17 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/prefetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+// Software prefetch hint: bring the cache line containing the address into the cache ahead of a (random) access
+// This is only a performance suggestion - the address does not need to be valid
+#if __GNUC__
+#define DUCKDB_PREFETCH(address) (__builtin_prefetch(address))
+#else
+#define DUCKDB_PREFETCH(address) ((void)(address))
+#endif
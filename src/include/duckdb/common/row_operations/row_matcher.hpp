@@ -67,9 +67,15 @@ private:
 	MatchFunction GetStructMatchFunction(const LogicalType &type, const ExpressionType predicate);
 	template <bool NO_MATCH_SEL>
 	MatchFunction GetListMatchFunction(const ExpressionType predicate);
+	//! Checks whether all columns can be compared at once on their bytes, and if so fills fixed_size_key_widths
+	void InitializeFixedSizeKeys(const bool no_match_sel, const TupleDataLayout &layout, const Predicates &predicates);
 
 private:
 	vector<MatchFunction> match_functions;
+	//! If not empty, the widths of the columns, which are all fixed-size and compared for equality on their bytes
+	vector<idx_t> fixed_size_key_widths;
+	//! Whether the fixed-size key match needs to fill the no_match_sel
+	bool fixed_size_key_no_match_sel = false;
 };
 
 } // namespace duckdb
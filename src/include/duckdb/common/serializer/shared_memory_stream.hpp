@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/serializer/shared_memory_stream.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/common/serializer/read_stream.hpp"
+#include "duckdb/common/serializer/write_stream.hpp"
+#include "duckdb/common/string.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+
+namespace duckdb {
+
+struct SharedMemoryStreamHeader;
+
+//! A single-producer single-consumer byte stream over a ring buffer in a memory mapped file, that can be used to
+//! transfer data between processes. When the file is placed on a memory backed file system (e.g. /dev/shm) the data
+//! never touches the disk. The writer blocks while the ring buffer is full and the reader blocks while it is empty,
+//! so a slow reader applies back pressure on the writer.
+class SharedMemoryStream : public WriteStream, public ReadStream {
+public:
+	static constexpr idx_t DEFAULT_CAPACITY = 16ULL * 1024ULL * 1024ULL;
+
+	//! Creates a new stream with the given ring buffer capacity at the path and opens it for writing. An existing file
+	//! at the path is replaced, readers that still have the old file open are not affected
+	DUCKDB_API static unique_ptr<SharedMemoryStream> Create(const string &path, idx_t capacity = DEFAULT_CAPACITY);
+	//! Opens the stream at the path for reading, throws if no stream has been created at the path
+	DUCKDB_API static unique_ptr<SharedMemoryStream> Open(const string &path);
+
+	DUCKDB_API ~SharedMemoryStream() override;
+
+public:
+	//! Writes the data to the ring buffer, the data is only visible to the reader after Flush is called.
+	//! Throws if the reader has closed the stream
+	DUCKDB_API void WriteData(const_data_ptr_t buffer, idx_t write_size) override;
+	//! Makes all written data visible to the reader
+	DUCKDB_API void Flush();
+	//! Reads data from the ring buffer, waiting for the writer if necessary.
+	//! Throws if the writer closed the stream before writing the requested data
+	DUCKDB_API void ReadData(data_ptr_t buffer, idx_t read_size) override;
+	//! Closes this side of the stream, the writer flushes any remaining data
+	DUCKDB_API void Close();
+	//! Sets a flag that is checked while waiting for the other side, waiting is aborted when the flag is set
+	DUCKDB_API void SetInterruptFlag(atomic<bool> &interrupted);
+
+private:
+	SharedMemoryStream(string path, data_ptr_t memory, idx_t mapped_size, bool is_writer);
+
+	//! Waits for the other side of the stream to make progress
+	void Wait(idx_t &iteration);
+
+private:
+	string path;
+	data_ptr_t memory;
+	idx_t mapped_size;
+	bool is_writer;
+	bool closed;
+
+	SharedMemoryStreamHeader &header;
+	data_ptr_t data;
+	idx_t capacity;
+	//! The position up to which this side has written or read
+	uint64_t position;
+	//! The last seen position of the other side
+	uint64_t peer_position;
+	optional_ptr<atomic<bool>> interrupted;
+};
+
+} // namespace duckdb
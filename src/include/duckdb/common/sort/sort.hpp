@@ -41,6 +41,9 @@ public:
 	vector<bool> constant_size;
 	vector<idx_t> column_sizes;
 	vector<idx_t> prefix_lengths;
+	//! The length of the prefix that all strings of a VARCHAR sorting column share (according to the statistics),
+	//! which is skipped when encoding the radix sorting data, so that the radix data holds their distinct bytes
+	vector<idx_t> prefix_offsets;
 	vector<BaseStatistics *> stats;
 	vector<bool> has_null;
 
@@ -61,6 +64,8 @@ public:
 	void PrepareMergePhase();
 	//! Initializes the global sort state for another round of merging
 	void InitializeMergeRound();
+	//! Whether the next merge round can merge all sorted blocks at once
+	bool CanMergeMultiway() const;
 	//! Completes the cascaded merge sort round.
 	//! Pass true if you wish to use the radix data for further comparisons.
 	void CompleteMergeRound(bool keep_radix_data = false);
@@ -96,6 +101,19 @@ public:
 	idx_t num_pairs;
 	idx_t l_start;
 	idx_t r_start;
+
+	//! Whether the current merge round merges all sorted blocks at once, instead of pairwise
+	bool multiway_merge = false;
+	//! For each partition of a multiway merge round, the index of its first row within each sorted block
+	vector<vector<idx_t>> multiway_bounds;
+	//! The row within the result at which each partition of a multiway merge round starts
+	vector<idx_t> multiway_offsets;
+	//! The result of a multiway merge round, which has exactly block_capacity rows per block (except the last)
+	unique_ptr<SortedBlock> multiway_result;
+
+private:
+	//! Partitions the sorted blocks for a multiway merge round
+	void InitializeMultiwayMerge();
 };
 
 struct LocalSortState {
@@ -180,6 +198,8 @@ private:
 
 	//! Finds the next partition and merges it
 	void MergePartition();
+	//! Merges a partition of all sorted blocks at once with a loser tree (multiway merge round)
+	void MergeMultiwayPartition(idx_t partition_idx);
 
 	//! Computes how the next 'count' tuples should be merged by setting the 'left_smaller' array
 	void ComputeMerge(const idx_t &count, bool left_smaller[]);
@@ -98,6 +98,8 @@ public:
 
 	void PinRadix(idx_t block_idx_to);
 	void PinData(SortedData &sd);
+	//! Load the next READ_AHEAD_BLOCKS blocks of the sorted block, if an external sort offloaded them to disk
+	void ReadAhead(idx_t block_idx_from);
 
 	data_ptr_t RadixPtr() const;
 	data_ptr_t DataPtr(SortedData &sd) const;
@@ -109,6 +111,9 @@ public:
 	void SetIndices(idx_t block_idx_to, idx_t entry_idx_to);
 
 public:
+	//! The number of blocks that are loaded at once when the scan reaches a block that was offloaded to disk
+	static constexpr const idx_t READ_AHEAD_BLOCKS = 4;
+
 	BufferManager &buffer_manager;
 	const SortLayout &sort_layout;
 	GlobalSortState &state;
@@ -0,0 +1,87 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/types/blocked_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+
+namespace duckdb {
+
+class Serializer;
+class Deserializer;
+
+//! A register-blocked Bloom filter over 64-bit hashes
+//! Every key maps to a single 64-bit word (chosen by the upper half of the hash) in which BITS_PER_KEY bits are set
+//! (chosen by the lower half of the hash). A lookup therefore touches exactly one word, which keeps probing cheap and
+//! easy to vectorize, at the cost of a slightly higher false positive rate than a classic Bloom filter.
+//! Insertion is thread-safe, so multiple threads can fill the same filter concurrently.
+class BlockedBloomFilter {
+public:
+	//! The number of bits that are set per key
+	static constexpr const idx_t BITS_PER_KEY = 4;
+	//! The number of bits of filter space we allocate per (expected) key
+	static constexpr const idx_t FILTER_BITS_PER_KEY = 16;
+	//! The minimum number of words in a filter
+	static constexpr const idx_t MIN_WORD_COUNT = 8;
+
+public:
+	//! Creates an empty filter, sized for the expected number of keys
+	explicit BlockedBloomFilter(idx_t expected_key_count);
+	//! Creates a filter directly from its words (e.g., after deserialization)
+	explicit BlockedBloomFilter(const vector<uint64_t> &words);
+
+	//! Returns the number of bytes a filter for the expected number of keys would occupy
+	static idx_t GetSizeInBytes(idx_t expected_key_count);
+
+public:
+	//! Insert a single hash
+	inline void InsertHash(hash_t hash) {
+		words[GetWordIndex(hash)].fetch_or(GetMask(hash), std::memory_order_relaxed);
+	}
+	//! Insert an array of hashes
+	void InsertHashes(const hash_t *hashes, idx_t count);
+	//! Insert "count" hashes of a hash vector
+	void InsertHashes(Vector &hashes, idx_t count);
+
+	//! Returns false if the hash was definitely not inserted into the filter
+	inline bool LookupHash(hash_t hash) const {
+		const auto mask = GetMask(hash);
+		return (words[GetWordIndex(hash)].load(std::memory_order_relaxed) & mask) == mask;
+	}
+	//! Hashes the vector and reduces the selection vector to the entries that may be in the filter
+	//! Returns the number of remaining entries
+	idx_t Lookup(Vector &input, SelectionVector &sel, idx_t count) const;
+
+	idx_t GetWordCount() const {
+		return word_count;
+	}
+	//! Returns a copy of the words in the filter
+	vector<uint64_t> GetWords() const;
+
+	void Serialize(Serializer &serializer) const;
+	static shared_ptr<BlockedBloomFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	inline idx_t GetWordIndex(hash_t hash) const {
+		return (hash >> 32) & (word_count - 1);
+	}
+	static inline uint64_t GetMask(hash_t hash) {
+		return (uint64_t(1) << (hash & 63)) | (uint64_t(1) << ((hash >> 6) & 63)) |
+		       (uint64_t(1) << ((hash >> 12) & 63)) | (uint64_t(1) << ((hash >> 18) & 63));
+	}
+
+private:
+	//! The number of words in the filter, always a power of two
+	idx_t word_count;
+	//! The words of the filter
+	unsafe_unique_array<atomic<uint64_t>> words;
+};
+
+} // namespace duckdb
@@ -28,6 +28,9 @@ public:
 	static const double DOUBLE_POWERS_OF_TEN[40];
 
 public:
+	//! Parses exactly eight decimal digits into result. Returns false if any of the characters is not a digit.
+	static bool TryParseEightDigits(const char *digits, uint32_t &result);
+
 	template <class T>
 	static int UnsignedLength(T value);
 
@@ -73,6 +73,8 @@ public:
 
 	//! Prevents the block with the given id from being added to the eviction queue
 	void SetDestroyBufferUponUnpin(uint32_t block_id);
+	//! Loads the blocks with the given ids ahead of time, if they were offloaded to disk
+	void Prefetch(const unordered_set<uint32_t> &block_ids);
 
 private:
 	void AllocateEmptyBlock(idx_t size);
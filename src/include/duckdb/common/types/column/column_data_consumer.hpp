@@ -64,6 +64,12 @@ public:
 
 private:
 	void ConsumeChunks(idx_t delete_index_start, idx_t delete_index_end);
+	//! Load the blocks of the chunks that are assigned next, if they were offloaded to disk
+	void ReadAhead(idx_t chunk_index_start, idx_t chunk_index_end);
+
+public:
+	//! The number of chunks that are read ahead of the scan
+	static constexpr const idx_t READ_AHEAD_CHUNKS = 8;
 
 private:
 	mutex lock;
@@ -81,6 +87,8 @@ private:
 	unordered_set<idx_t> chunks_in_progress;
 	//! The data has been consumed up to this chunk index
 	idx_t chunk_delete_index;
+	//! The blocks were read ahead up to this chunk index
+	idx_t read_ahead_index;
 };
 
 } // namespace duckdb
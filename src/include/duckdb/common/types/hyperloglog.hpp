@@ -18,6 +18,12 @@ enum class HLLStorageType : uint8_t {
 	HLL_V2 = 2, //! Our own implementation
 };
 
+//! The format of an exported HLL sketch (see HyperLogLog::WriteSketch)
+enum class HLLSketchFormat : uint8_t {
+	SPARSE = 1, //! (register index, register value) pairs of the non-zero registers
+	DENSE = 2   //! All registers
+};
+
 class Serializer;
 class Deserializer;
 
@@ -64,6 +70,13 @@ public:
 	//! Get copy of the HLL
 	unique_ptr<HyperLogLog> Copy() const;
 
+	//! Get the size of the (compact) sketch of this HLL, which is sparse if few registers are set
+	idx_t GetSketchSize() const;
+	//! Write the sketch of this HLL to "data", which must be able to hold GetSketchSize() bytes
+	void WriteSketch(data_ptr_t data) const;
+	//! Merge a sketch that was written by WriteSketch into this HLL
+	void MergeSketch(const_data_ptr_t data, idx_t size);
+
 	void Serialize(Serializer &serializer) const;
 	static unique_ptr<HyperLogLog> Deserialize(Deserializer &deserializer);
 
@@ -72,6 +85,9 @@ public:
 	//! Algorithm 6
 	static int64_t EstimateCardinality(uint32_t *c);
 
+private:
+	idx_t NonZeroRegisterCount() const;
+
 private:
 	uint8_t k[M];
 };
@@ -28,6 +28,7 @@ public:
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
 
 	int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+	shared_ptr<AsyncFileRead> ReadAsync(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
 
 	int64_t GetFileSize(FileHandle &handle) override;
 	time_t GetLastModifiedTime(FileHandle &handle) override;
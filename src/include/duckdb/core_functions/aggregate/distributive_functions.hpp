@@ -147,6 +147,33 @@ struct EntropyFun {
 	static AggregateFunctionSet GetFunctions();
 };
 
+struct HllEstimateFun {
+	static constexpr const char *Name = "hll_estimate";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Computes the approximate count of distinct elements of a HyperLogLog sketch.";
+	static constexpr const char *Example = "hll_estimate(hll_merge(A))";
+
+	static ScalarFunction GetFunction();
+};
+
+struct HllMergeFun {
+	static constexpr const char *Name = "hll_merge";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Merges HyperLogLog sketches into a single sketch.";
+	static constexpr const char *Example = "hll_merge(A)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct HllSketchFun {
+	static constexpr const char *Name = "hll_sketch";
+	static constexpr const char *Parameters = "any";
+	static constexpr const char *Description = "Computes a HyperLogLog sketch of the distinct elements, which can be merged with hll_merge and estimated with hll_estimate.";
+	static constexpr const char *Example = "hll_sketch(A)";
+
+	static AggregateFunction GetFunction();
+};
+
 struct KahanSumFun {
 	static constexpr const char *Name = "kahan_sum";
 	static constexpr const char *Parameters = "arg";
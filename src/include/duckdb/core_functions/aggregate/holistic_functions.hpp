@@ -75,6 +75,24 @@ struct QuantileContFun {
 	static AggregateFunctionSet GetFunctions();
 };
 
+struct QuantileSketchFun {
+	static constexpr const char *Name = "quantile_sketch";
+	static constexpr const char *Parameters = "x";
+	static constexpr const char *Description = "Computes a T-Digest sketch of the values, which can be merged with quantile_sketch_merge and queried with sketch_quantile.";
+	static constexpr const char *Example = "quantile_sketch(A)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct QuantileSketchMergeFun {
+	static constexpr const char *Name = "quantile_sketch_merge";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Merges T-Digest quantile sketches into a single sketch.";
+	static constexpr const char *Example = "quantile_sketch_merge(A)";
+
+	static AggregateFunction GetFunction();
+};
+
 struct ReservoirQuantileFun {
 	static constexpr const char *Name = "reservoir_quantile";
 	static constexpr const char *Parameters = "x,quantile,sample_size";
@@ -84,6 +102,15 @@ struct ReservoirQuantileFun {
 	static AggregateFunctionSet GetFunctions();
 };
 
+struct SketchQuantileFun {
+	static constexpr const char *Name = "sketch_quantile";
+	static constexpr const char *Parameters = "sketch,pos";
+	static constexpr const char *Description = "Computes the approximate quantile of a T-Digest quantile sketch.";
+	static constexpr const char *Example = "sketch_quantile(quantile_sketch_merge(A), 0.99)";
+
+	static ScalarFunction GetFunction();
+};
+
 struct ApproxTopKFun {
 	static constexpr const char *Name = "approx_top_k";
 	static constexpr const char *Parameters = "val,k";
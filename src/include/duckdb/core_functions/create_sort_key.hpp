@@ -47,6 +47,8 @@ struct OrderModifiers {
 
 struct CreateSortKeyHelpers {
 	static void CreateSortKey(Vector &input, idx_t input_count, OrderModifiers modifiers, Vector &result);
+	//! Creates a single (BLOB) sort key out of all the columns of the input
+	static void CreateSortKey(DataChunk &input, const vector<OrderModifiers> &modifiers, Vector &result);
 	static void DecodeSortKey(string_t sort_key, Vector &result, idx_t result_idx, OrderModifiers modifiers);
 	static void CreateSortKeyWithValidity(Vector &input, Vector &result, const OrderModifiers &modifiers,
 	                                      const idx_t count);
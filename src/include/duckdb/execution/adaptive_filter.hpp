@@ -11,7 +11,7 @@
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/chrono.hpp"
-#include "duckdb/common/random_engine.hpp"
+#include "duckdb/common/mutex.hpp"
 
 namespace duckdb {
 
@@ -19,31 +19,63 @@ struct AdaptiveFilterState {
 	time_point<high_resolution_clock> start_time;
 };
 
+//! The observed cost and selectivity of a single predicate of a filter
+struct AdaptivePredicateStatistics {
+	//! The amount of tuples the predicate was evaluated on
+	idx_t tuples_in = 0;
+	//! The amount of tuples the predicate did not eliminate
+	idx_t tuples_out = 0;
+	//! The time spent evaluating the predicate (in seconds)
+	double runtime = 0;
+};
+
+//! The runtime statistics of the predicates of a filter. These are owned by the plan, so they are shared by all
+//! threads that evaluate the filter, and persist across executions of a prepared statement.
+class AdaptiveFilterStatistics {
+public:
+	//! After this many evaluated tuples, the statistics of a predicate are halved so they follow changes in the data
+	static constexpr const idx_t DECAY_TUPLE_COUNT = 1ULL << 24ULL;
+
+public:
+	//! Merge (and reset) the locally observed statistics, and compute the permutation in which to evaluate the
+	//! predicates: unobserved predicates first, then ascending by the cost per eliminated tuple
+	void Update(vector<AdaptivePredicateStatistics> &local, vector<idx_t> &permutation);
+	//! Get the permutation learned so far, leaves the permutation untouched if nothing was observed yet
+	void GetPermutation(vector<idx_t> &permutation);
+
+private:
+	void GetPermutationInternal(vector<idx_t> &permutation);
+
+private:
+	mutex lock;
+	vector<AdaptivePredicateStatistics> predicates;
+};
+
 class AdaptiveFilter {
 public:
-	explicit AdaptiveFilter(const Expression &expr);
-	explicit AdaptiveFilter(const TableFilterSet &table_filters);
+	//! If no shared statistics are provided, the filter only learns from its own evaluations
+	AdaptiveFilter(const Expression &expr, shared_ptr<AdaptiveFilterStatistics> statistics);
+	AdaptiveFilter(const TableFilterSet &table_filters, shared_ptr<AdaptiveFilterStatistics> statistics);
+
+	//! The local statistics are merged into the shared statistics every this many filter evaluations
+	static constexpr const idx_t UPDATE_INTERVAL = 8;
 
 	vector<idx_t> permutation;
 
 public:
-	void AdaptRuntimeStatistics(double duration);
-
 	AdaptiveFilterState BeginFilter() const;
-	void EndFilter(AdaptiveFilterState state);
+	//! Record that the predicate at position "idx" of the permutation reduced "tuples_in" to "tuples_out" tuples
+	//! (since the state was started, or since the previous predicate ended)
+	void EndPredicate(AdaptiveFilterState &state, idx_t idx, idx_t tuples_in, idx_t tuples_out);
+	void EndFilter();
+
+private:
+	void Initialize(idx_t predicate_count);
 
 private:
-	//! used for adaptive expression reordering
+	shared_ptr<AdaptiveFilterStatistics> statistics;
+	//! The statistics observed since the last update of the shared statistics
+	vector<AdaptivePredicateStatistics> local_statistics;
 	idx_t iteration_count = 0;
-	idx_t swap_idx = 0;
-	idx_t right_random_border = 0;
-	idx_t observe_interval = 0;
-	idx_t execute_interval = 0;
-	double runtime_sum = 0;
-	double prev_mean = 0;
-	bool observe = false;
-	bool warmup = false;
-	vector<idx_t> swap_likeliness;
-	RandomEngine generator;
 };
 } // namespace duckdb
@@ -17,6 +17,7 @@
 #include "duckdb/parallel/pipeline.hpp"
 
 #include <condition_variable>
+#include <functional>
 
 namespace duckdb {
 class ClientContext;
@@ -25,6 +26,7 @@ class PhysicalOperator;
 class PipelineExecutor;
 class OperatorState;
 class QueryProfiler;
+class ExecutionTracer;
 class ThreadContext;
 class Task;
 
@@ -87,9 +89,7 @@ public:
 	//! Returns the progress of the pipelines
 	bool GetPipelinesProgress(double &current_progress, uint64_t &current_cardinality, uint64_t &total_cardinality);
 
-	void CompletePipeline() {
-		completed_pipelines++;
-	}
+	void CompletePipeline();
 	ProducerToken &GetToken() {
 		return *producer;
 	}
@@ -108,6 +108,10 @@ public:
 	//! Returns true if all pipelines have been completed
 	bool ExecutionIsFinished();
 
+	//! Sets a callback that is invoked (from any thread) when the client can continue the execution without
+	//! blocking: all pipelines are complete, an error occurred, or the streaming result is waiting to be fetched from
+	void SetReadyCallback(std::function<void()> callback);
+
 	void RegisterTask() {
 		executor_tasks++;
 	}
@@ -123,9 +127,16 @@ public:
 		return completed_pipelines.load();
 	}
 
+	//! The tracer that records the execution timeline of the query (if enabled)
+	optional_ptr<ExecutionTracer> GetTracer() {
+		return tracer.get();
+	}
+
 private:
 	//! Check if the streaming query result is waiting to be fetched from, must hold the 'executor_lock'
 	bool ResultCollectorIsBlocked();
+	//! Invokes the ready callback (if any)
+	void SignalReady();
 	void InitializeInternal(PhysicalOperator &physical_plan);
 
 	void ScheduleEvents(const vector<shared_ptr<MetaPipeline>> &meta_pipelines);
@@ -165,6 +176,8 @@ private:
 	vector<shared_ptr<Event>> events;
 	//! The query profiler
 	shared_ptr<QueryProfiler> profiler;
+	//! The execution tracer (if enabled)
+	unique_ptr<ExecutionTracer> tracer;
 	//! Task error manager
 	TaskErrorManager error_manager;
 
@@ -188,6 +201,11 @@ private:
 	//! Currently alive executor tasks
 	atomic<idx_t> executor_tasks;
 
+	//! Protects the ready callback
+	mutex ready_lock;
+	//! The callback that is invoked when the client can continue the execution (if any)
+	std::function<void()> ready_callback;
+
 	//! Total time blocked while waiting on tasks. In ticks. One tick corresponds to WAIT_TIME.
 	atomic<idx_t> blocked_thread_time;
 };
@@ -112,6 +112,10 @@ protected:
 	             Vector &result);
 	void Execute(const BoundCaseExpression &expr, ExpressionState *state, const SelectionVector *sel, idx_t count,
 	             Vector &result);
+	//! Evaluate all branches of a CASE expression over all rows and blend the results without selection vectors.
+	//! Returns whether the rows were spread over more than one branch
+	bool ExecuteBranchless(const BoundCaseExpression &expr, ExpressionState *state, const SelectionVector *sel,
+	                       idx_t count, Vector &result);
 	void Execute(const BoundCastExpression &expr, ExpressionState *state, const SelectionVector *sel, idx_t count,
 	             Vector &result);
 
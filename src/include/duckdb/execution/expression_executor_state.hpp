@@ -57,10 +57,28 @@ struct ExecuteFunctionState : public ExpressionState {
 
 	unique_ptr<FunctionLocalState> local_state;
 
+	//! Functions over a dictionary vector are only evaluated on the dictionary if every distinct entry is used by at
+	//! least this many rows on average
+	static constexpr const idx_t DICTIONARY_MIN_REUSE = 2;
+	//! The largest dictionary index that is tracked, larger dictionaries are evaluated row by row
+	static constexpr const idx_t DICTIONARY_MAX_INDEX = 8 * STANDARD_VECTOR_SIZE;
+
+	//! The arguments of the function over the distinct dictionary entries that are used by a chunk
+	DataChunk dictionary_arguments;
+	//! The distinct dictionary entries that are used by a chunk
+	SelectionVector dictionary_entries;
+	//! For every dictionary index, its position in dictionary_entries (or INVALID_INDEX)
+	vector<sel_t> dictionary_positions;
+
 public:
 	static optional_ptr<FunctionLocalState> GetFunctionState(ExpressionState &state) {
 		return state.Cast<ExecuteFunctionState>().local_state.get();
 	}
+
+	//! If all arguments are constant except for a single dictionary vector, prepares dictionary_arguments with the
+	//! distinct dictionary entries that are used, and returns the selection of every row into these entries.
+	//! Returns nullptr if the function should be evaluated on the arguments directly
+	unique_ptr<SelectionVector> PrepareDictionaryArguments(DataChunk &arguments);
 };
 
 struct ExpressionExecutorState {
@@ -28,6 +28,7 @@ class ARTKeySection;
 class FixedSizeAllocator;
 
 struct ARTIndexScanState;
+struct ARTScanPredicate;
 
 class ART : public BoundIndex {
 public:
@@ -66,10 +67,19 @@ public:
 
 public:
 	//! Try to initialize a scan on the ART with the given expression and filter.
+	//! Supports comparisons with constants, BETWEEN, IN lists, and disjunctions thereof.
 	unique_ptr<IndexScanState> TryInitializeScan(const Expression &expr, const Expression &filter_expr);
+	//! Try to initialize a scan on a compound key with equality predicates on its leading key columns.
+	//! Lookups on a prefix of the key require at least min_prefix_count key columns.
+	unique_ptr<IndexScanState> TryInitializeScan(const vector<unique_ptr<Expression>> &exprs,
+	                                             const vector<unique_ptr<Expression>> &filters,
+	                                             const idx_t min_prefix_count);
 	//! Perform a lookup on the ART, fetching up to max_count row IDs.
 	//! If all row IDs were fetched, it return true, else false.
 	bool Scan(IndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids);
+	//! Looks up a chunk of keys, and appends the row IDs of the key in row i of the input to row_ids[i].
+	//! The input contains one column per key column. NULL keys do not match any row.
+	void LookupRowIds(DataChunk &input, vector<unsafe_vector<row_t>> &row_ids);
 
 	//! Append a chunk by first executing the ART's expressions.
 	ErrorData Append(IndexLock &lock, DataChunk &input, Vector &row_ids) override;
@@ -99,6 +109,8 @@ public:
 	IndexStorageInfo GetStorageInfo(const case_insensitive_map_t<Value> &options, const bool to_wal) override;
 	//! Returns the in-memory usage of the ART.
 	idx_t GetInMemorySize(IndexLock &index_lock) override;
+	//! Returns the fraction of the allocated node memory that is free.
+	double GetFragmentation();
 
 	//! ART key generation.
 	template <bool IS_NOT_NULL = false>
@@ -117,7 +129,15 @@ private:
 	bool SearchLess(ARTKey &upper_bound, bool equal, idx_t max_count, unsafe_vector<row_t> &row_ids);
 	bool SearchCloseRange(ARTKey &lower_bound, ARTKey &upper_bound, bool left_equal, bool right_equal, idx_t max_count,
 	                      unsafe_vector<row_t> &row_ids);
+	bool SearchPrefix(ArenaAllocator &allocator, ARTKey &prefix, idx_t max_count, unsafe_vector<row_t> &row_ids);
+	bool Scan(ArenaAllocator &allocator, ARTScanPredicate &predicate, const idx_t max_count,
+	          unsafe_vector<row_t> &row_ids);
 	const unsafe_optional_ptr<const Node> Lookup(const Node &node, const ARTKey &key, idx_t depth);
+	//! Looks up the leaves of a batch of keys. Empty keys are skipped.
+	//! The keys are visited in sorted order, so keys sharing a path are looked up with a single traversal.
+	void LookupBatch(const unsafe_vector<ARTKey> &keys, unsafe_vector<unsafe_optional_ptr<const Node>> &leaves);
+	void LookupBatch(const Node &node, const unsafe_vector<ARTKey> &keys, const unsafe_vector<idx_t> &order,
+	                 idx_t begin, idx_t end, idx_t depth, unsafe_vector<unsafe_optional_ptr<const Node>> &leaves);
 
 	void InsertIntoEmpty(Node &node, const ARTKey &key, const idx_t depth, const ARTKey &row_id,
 	                     const GateStatus status);
@@ -137,8 +157,14 @@ private:
 
 	void InitializeMerge(unsafe_vector<idx_t> &upper_bounds);
 
+	//! Unloads cold buffers of the ART, if the buffer manager is under memory pressure.
+	//! The lock must be held, and no pointers into the ART may be in use.
+	void UnloadColdBuffers();
+
 	void InitializeVacuum(unordered_set<uint8_t> &indexes);
 	void FinalizeVacuum(const unordered_set<uint8_t> &indexes);
+	//! Returns true, if any allocator of the ART exceeds its compaction threshold.
+	bool NeedsCompaction() const;
 
 	void InitAllocators(const IndexStorageInfo &info);
 	void TransformToDeprecated();
@@ -11,6 +11,7 @@
 #include "duckdb/execution/index/fixed_size_allocator.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/art/node.hpp"
+#include "duckdb/execution/index/art/node_search.hpp"
 
 namespace duckdb {
 
@@ -42,24 +43,22 @@ public:
 
 	//! Returns true, if the byte exists, else false.
 	bool HasByte(uint8_t &byte) const {
-		for (uint8_t i = 0; i < count; i++) {
-			if (key[i] == byte) {
-				return true;
-			}
-		}
-		return false;
+		// The count and the key bytes are adjacent, so we search them together, skipping the count.
+		static_assert(sizeof(BaseLeaf) == CAPACITY + 1, "BaseLeaf must only contain the count and the key bytes");
+		auto data = &count;
+		return NodeSearch::Find<CAPACITY + 1>(data, 1, count + 1, byte) != count + 1;
 	}
 
 	//! Get the first byte greater than or equal to the byte.
 	//! Returns true, if such a byte exists, else false.
 	bool GetNextByte(uint8_t &byte) const {
-		for (uint8_t i = 0; i < count; i++) {
-			if (key[i] >= byte) {
-				byte = key[i];
-				return true;
-			}
+		auto data = &count;
+		auto pos = NodeSearch::FindGreaterOrEqual<CAPACITY + 1>(data, 1, count + 1, byte);
+		if (pos == count + 1) {
+			return false;
 		}
-		return false;
+		byte = data[pos];
+		return true;
 	}
 
 private:
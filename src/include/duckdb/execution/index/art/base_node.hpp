@@ -11,6 +11,7 @@
 #include "duckdb/execution/index/fixed_size_allocator.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/art/node.hpp"
+#include "duckdb/execution/index/art/node_search.hpp"
 
 namespace duckdb {
 
@@ -67,24 +68,22 @@ public:
 
 	//! Get the child at byte.
 	static unsafe_optional_ptr<Node> GetChild(BaseNode &n, const uint8_t byte) {
-		for (uint8_t i = 0; i < n.count; i++) {
-			if (n.key[i] == byte) {
-				D_ASSERT(n.children[i].HasMetadata());
-				return &n.children[i];
-			}
+		auto pos = NodeSearch::Find<CAPACITY>(n.key, 0, n.count, byte);
+		if (pos == n.count) {
+			return nullptr;
 		}
-		return nullptr;
+		D_ASSERT(n.children[pos].HasMetadata());
+		return &n.children[pos];
 	}
 
 	//! Get the first child greater than or equal to the byte.
 	static unsafe_optional_ptr<Node> GetNextChild(BaseNode &n, uint8_t &byte) {
-		for (uint8_t i = 0; i < n.count; i++) {
-			if (n.key[i] >= byte) {
-				byte = n.key[i];
-				return &n.children[i];
-			}
+		auto pos = NodeSearch::FindGreaterOrEqual<CAPACITY>(n.key, 0, n.count, byte);
+		if (pos == n.count) {
+			return nullptr;
 		}
-		return nullptr;
+		byte = n.key[pos];
+		return &n.children[pos];
 	}
 
 public:
@@ -0,0 +1,107 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/index/art/node_search.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/bit_utils.hpp"
+#include "duckdb/common/typedefs.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DUCKDB_ART_SEARCH_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define DUCKDB_ART_SEARCH_NEON
+#include <arm_neon.h>
+#endif
+
+namespace duckdb {
+
+//! NodeSearch searches the sorted key bytes of ART nodes.
+//! Nodes that fit their key bytes into 16 bytes are searched with a single SIMD comparison, if available.
+struct NodeSearch {
+	//! The amount of bytes compared by a single SIMD comparison.
+	static constexpr uint8_t SIMD_WIDTH = 16;
+
+	//! Returns the position of the byte in data[begin, end), or end, if the byte does not exist.
+	//! SIZE is the amount of bytes that can be read starting at data.
+	template <uint8_t SIZE>
+	static inline uint8_t Find(const uint8_t *data, const uint8_t begin, const uint8_t end, const uint8_t byte) {
+		for (uint8_t i = begin; i < end; i++) {
+			if (data[i] == byte) {
+				return i;
+			}
+		}
+		return end;
+	}
+
+	//! Returns the position of the first byte greater than or equal to the byte in data[begin, end), or end.
+	template <uint8_t SIZE>
+	static inline uint8_t FindGreaterOrEqual(const uint8_t *data, const uint8_t begin, const uint8_t end,
+	                                         const uint8_t byte) {
+		for (uint8_t i = begin; i < end; i++) {
+			if (data[i] >= byte) {
+				return i;
+			}
+		}
+		return end;
+	}
+
+private:
+	//! Returns the position of the first set bit of the mask within [begin, end), or end.
+	static inline uint8_t FirstPosition(uint32_t mask, const uint8_t begin, const uint8_t end) {
+		mask &= ((1U << end) - 1) & ~((1U << begin) - 1);
+		if (!mask) {
+			return end;
+		}
+		return static_cast<uint8_t>(CountZeros<uint32_t>::Trailing(mask));
+	}
+
+#if defined(DUCKDB_ART_SEARCH_SSE2)
+	static inline uint32_t EqualMask(const uint8_t *data, const uint8_t byte) {
+		auto keys = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+		auto cmp = _mm_cmpeq_epi8(keys, _mm_set1_epi8(static_cast<char>(byte)));
+		return static_cast<uint32_t>(_mm_movemask_epi8(cmp));
+	}
+	static inline uint32_t GreaterOrEqualMask(const uint8_t *data, const uint8_t byte) {
+		// There is no unsigned byte comparison: key >= byte, if max(key, byte) == key.
+		auto keys = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+		auto cmp = _mm_cmpeq_epi8(_mm_max_epu8(keys, _mm_set1_epi8(static_cast<char>(byte))), keys);
+		return static_cast<uint32_t>(_mm_movemask_epi8(cmp));
+	}
+#elif defined(DUCKDB_ART_SEARCH_NEON)
+	static inline uint32_t ToMask(uint8x16_t cmp) {
+		// Keep one bit per byte.
+		static const uint8_t BITS[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+		auto bits = vandq_u8(cmp, vld1q_u8(BITS));
+		return static_cast<uint32_t>(vaddv_u8(vget_low_u8(bits))) |
+		       (static_cast<uint32_t>(vaddv_u8(vget_high_u8(bits))) << 8);
+	}
+	static inline uint32_t EqualMask(const uint8_t *data, const uint8_t byte) {
+		return ToMask(vceqq_u8(vld1q_u8(data), vdupq_n_u8(byte)));
+	}
+	static inline uint32_t GreaterOrEqualMask(const uint8_t *data, const uint8_t byte) {
+		return ToMask(vcgeq_u8(vld1q_u8(data), vdupq_n_u8(byte)));
+	}
+#endif
+};
+
+#if defined(DUCKDB_ART_SEARCH_SSE2) || defined(DUCKDB_ART_SEARCH_NEON)
+template <>
+inline uint8_t NodeSearch::Find<NodeSearch::SIMD_WIDTH>(const uint8_t *data, const uint8_t begin, const uint8_t end,
+                                                        const uint8_t byte) {
+	return FirstPosition(EqualMask(data, byte), begin, end);
+}
+
+template <>
+inline uint8_t NodeSearch::FindGreaterOrEqual<NodeSearch::SIMD_WIDTH>(const uint8_t *data, const uint8_t begin,
+                                                                      const uint8_t end, const uint8_t byte) {
+	return FirstPosition(GreaterOrEqualMask(data, byte), begin, end);
+}
+#endif
+
+} // namespace duckdb
@@ -0,0 +1,108 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/index/brin/block_range_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/index/bound_index.hpp"
+#include "duckdb/execution/index/index_type.hpp"
+
+namespace duckdb {
+
+class TableFilter;
+struct ScanRowRanges;
+
+//! The BlockRangeIndex (BRIN) stores the minimum and maximum key of each range of range_size consecutive row IDs.
+//! It does not support lookups, but lets table scans skip the ranges that cannot contain rows passing a filter.
+//! It is cheap to maintain and small, and effective on keys that correlate with the insertion order.
+class BlockRangeIndex : public BoundIndex {
+public:
+	//! Index type name for the BRIN.
+	static constexpr const char *TYPE_NAME = "BRIN";
+	//! The option setting the number of rows per block range.
+	static constexpr const char *RANGE_SIZE_OPTION = "range_size";
+	//! The storage option holding the serialized block ranges.
+	static constexpr const char *BLOCK_RANGES_OPTION = "block_ranges";
+	//! The default number of rows per block range.
+	static constexpr idx_t DEFAULT_RANGE_SIZE = 8 * STANDARD_VECTOR_SIZE;
+
+public:
+	BlockRangeIndex(const string &name, const IndexConstraintType index_constraint_type,
+	                const vector<column_t> &column_ids, TableIOManager &table_io_manager,
+	                const vector<unique_ptr<Expression>> &unbound_expressions, AttachedDatabase &db,
+	                const case_insensitive_map_t<Value> &options,
+	                const IndexStorageInfo &info = IndexStorageInfo());
+
+	//! Create a index instance of this type.
+	static unique_ptr<BoundIndex> Create(CreateIndexInput &input) {
+		auto brin = make_uniq<BlockRangeIndex>(input.name, input.constraint_type, input.column_ids,
+		                                       input.table_io_manager, input.unbound_expressions, input.db,
+		                                       input.options, input.storage_info);
+		return std::move(brin);
+	}
+
+	//! The number of rows per block range.
+	idx_t range_size;
+
+public:
+	//! Returns the block ranges that can contain keys passing the filter, or nullptr, if the filter cannot prune
+	//! any block range.
+	shared_ptr<ScanRowRanges> GetQualifyingRanges(TableFilter &filter);
+
+	//! Append a chunk by first executing the index expressions.
+	ErrorData Append(IndexLock &lock, DataChunk &input, Vector &row_ids) override;
+	//! Extend the block ranges of the row IDs by their keys.
+	ErrorData Insert(IndexLock &lock, DataChunk &data, Vector &row_ids) override;
+
+	//! A BRIN does not enforce constraints.
+	void VerifyAppend(DataChunk &chunk) override;
+	void VerifyAppend(DataChunk &chunk, ConflictManager &conflict_manager) override;
+	void CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) override;
+	string GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
+	                                     DataChunk &input) override;
+
+	//! Deleting keys does not shrink their block ranges, which remain valid (but less selective) bounds.
+	void Delete(IndexLock &lock, DataChunk &entries, Vector &row_ids) override;
+	//! Drop the BRIN.
+	void CommitDrop(IndexLock &index_lock) override;
+	//! Merge another BRIN with the same range size into this BRIN. Both must be locked.
+	bool MergeIndexes(IndexLock &state, BoundIndex &other_index) override;
+	//! A BRIN has nothing to vacuum.
+	void Vacuum(IndexLock &state) override;
+
+	//! Returns the block ranges as storage options.
+	IndexStorageInfo GetStorageInfo(const case_insensitive_map_t<Value> &options, const bool to_wal) override;
+	//! Returns the in-memory usage of the BRIN.
+	idx_t GetInMemorySize(IndexLock &index_lock) override;
+
+	//! Returns a summary of the block ranges.
+	string VerifyAndToString(IndexLock &state, const bool only_verify) override;
+	void VerifyAllocations(IndexLock &state) override;
+
+private:
+	//! The byte size of a key.
+	idx_t key_size;
+	//! The number of block ranges.
+	idx_t range_count;
+	//! Whether each block range contains any non-NULL key.
+	unsafe_vector<uint8_t> has_keys;
+	//! The minimum and the maximum key of each block range.
+	unsafe_vector<data_t> min_keys;
+	unsafe_vector<data_t> max_keys;
+
+private:
+	void Resize(const idx_t new_range_count);
+	template <class T>
+	void InsertKeys(UnifiedVectorFormat &keys, UnifiedVectorFormat &row_ids, const idx_t count);
+	template <class T>
+	void MergeRanges(BlockRangeIndex &other);
+	template <class T>
+	bool FilterRanges(TableFilter &filter, unsafe_vector<bool> &qualifying);
+	void Deserialize(const Value &block_ranges);
+};
+
+} // namespace duckdb
@@ -27,6 +27,10 @@ class FixedSizeAllocator {
 public:
 	//! We can vacuum 10% or more of the total in-memory footprint
 	static constexpr uint8_t VACUUM_THRESHOLD = 10;
+	//! We unload cold buffers, if the buffer manager uses 80% or more of its memory limit
+	static constexpr uint8_t UNLOAD_THRESHOLD = 80;
+	//! We compact the allocator online, if 50% or more of its in-memory segments are free
+	static constexpr uint8_t COMPACTION_THRESHOLD = 50;
 
 public:
 	//! Construct a new fixed-size allocator
@@ -93,6 +97,10 @@ public:
 	inline idx_t GetSegmentCount() const {
 		return total_segment_count;
 	}
+	//! Returns the number of segments that fit into all buffers.
+	inline idx_t GetSegmentCapacity() const {
+		return buffers.size() * available_segments_per_buffer;
+	}
 
 	//! Returns the upper bound of the available buffer IDs, i.e., upper_bound > max_buffer_id
 	idx_t GetUpperBoundBufferId() const;
@@ -112,6 +120,15 @@ public:
 	}
 	//! Vacuums an IndexPointer
 	IndexPointer VacuumPointer(const IndexPointer ptr);
+	//! Returns true, if the free segments of the in-memory buffers exceed the COMPACTION_THRESHOLD, and a vacuum
+	//! would release at least one buffer
+	bool NeedsCompaction() const;
+
+	//! Returns true, if the memory usage of the buffer manager exceeds the UNLOAD_THRESHOLD
+	bool UnderMemoryPressure() const;
+	//! Releases the in-memory copies of on-disk buffers that were not accessed since the previous call (clock
+	//! eviction), and returns the number of released buffers. Must not be called while holding pointers to segments
+	idx_t UnloadColdBuffers();
 
 	//! Returns all FixedSizeAllocator information for serialization
 	FixedSizeAllocatorInfo GetInfo() const;
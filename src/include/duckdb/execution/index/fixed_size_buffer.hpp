@@ -58,6 +58,8 @@ public:
 	bool dirty;
 	//! True: can be vacuumed after the vacuum operation
 	bool vacuum;
+	//! True: the buffer was accessed since the last attempt to unload cold buffers
+	bool referenced;
 
 	//! Partial block id and offset
 	BlockPointer block_pointer;
@@ -79,10 +81,14 @@ public:
 		if (dirty_p) {
 			dirty = dirty_p;
 		}
+		referenced = true;
 		return buffer_handle.Ptr();
 	}
 	//! Destroys the in-memory buffer and the on-disk block
 	void Destroy();
+	//! Releases the in-memory buffer, if it is consistent with its copy on disk. The next Get reloads the buffer.
+	//! Returns true, if the buffer was released
+	bool Unload();
 	//! Serializes a buffer (if dirty or not on disk)
 	void Serialize(PartialBlockManager &partial_block_manager, const idx_t available_segments, const idx_t segment_size,
 	               const idx_t bitmask_offset);
@@ -21,6 +21,7 @@
 
 namespace duckdb {
 
+class BlockedBloomFilter;
 class BufferManager;
 class BufferHandle;
 class ColumnDataCollection;
@@ -202,8 +203,6 @@ public:
 
 	//! BufferManager
 	BufferManager &buffer_manager;
-	//! The join conditions
-	const vector<JoinCondition> &conditions;
 	//! The types of the keys used in equality comparison
 	vector<LogicalType> equality_types;
 	//! The types of the keys
@@ -211,7 +210,7 @@ public:
 	//! The types of all conditions
 	vector<LogicalType> build_types;
 	//! Positions of the columns that need to output
-	const vector<idx_t> &output_columns;
+	vector<idx_t> output_columns;
 	//! The comparison predicates that only contain equality predicates
 	vector<ExpressionType> equality_predicates;
 	//! The comparison predicates that contain non-equality predicates
@@ -257,6 +256,8 @@ public:
 	uint64_t bitmask = DConstants::INVALID_INDEX;
 	//! Whether or not we error on multiple rows found per match in a SINGLE join
 	bool single_join_error_on_multiple_rows = true;
+	//! If set, the hashes of all keys are inserted into this Bloom filter during Finalize (for join filter pushdown)
+	shared_ptr<BlockedBloomFilter> bloom_filter;
 
 	struct {
 		mutex mj_lock;
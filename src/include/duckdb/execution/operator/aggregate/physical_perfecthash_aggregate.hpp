@@ -19,6 +19,11 @@ class PerfectAggregateHashTable;
 class PhysicalPerfectHashAggregate : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::PERFECT_HASH_GROUP_BY;
+	//! Ranges of groups that exceed the perfect_ht_threshold, but not this amount of bits, can still be aggregated with
+	//! a perfect hash table if they are moderately dense (the groups are only allocated once they are found)
+	static constexpr const idx_t MAXIMUM_SPARSE_BITS = 20;
+	//! The range of groups is considered moderately dense if it is at most this factor larger than the input
+	static constexpr const idx_t MAXIMUM_SPARSE_FACTOR = 8;
 
 public:
 	PhysicalPerfectHashAggregate(ClientContext &context, vector<LogicalType> types,
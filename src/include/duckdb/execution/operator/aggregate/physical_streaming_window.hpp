@@ -13,7 +13,8 @@
 
 namespace duckdb {
 
-//! PhysicalStreamingWindow implements streaming window functions (i.e. with an empty OVER clause)
+//! PhysicalStreamingWindow implements streaming window functions (i.e. with an empty OVER clause). Aggregates are
+//! streamed over running frames, or over frames of a constant number of preceding rows whose arguments are buffered
 class PhysicalStreamingWindow : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_WINDOW;
@@ -18,6 +18,14 @@
 
 namespace duckdb {
 
+//! Simple aggregates (MIN/MAX/COUNT) over the same numeric input column, which are computed in a single pass
+struct FusedUngroupedAggregates {
+	//! The index of the input column in the payload chunk
+	idx_t payload_idx;
+	//! The aggregates over the input column
+	vector<idx_t> aggregates;
+};
+
 //! PhysicalUngroupedAggregate is an aggregate operator that can only perform aggregates (1) without any groups, (2)
 //! without any DISTINCT aggregates, and (3) when all aggregates are combineable
 class PhysicalUngroupedAggregate : public PhysicalOperator {
@@ -32,6 +40,10 @@ public:
 	vector<unique_ptr<Expression>> aggregates;
 	unique_ptr<DistinctAggregateData> distinct_data;
 	unique_ptr<DistinctAggregateCollectionInfo> distinct_collection_info;
+	//! The sets of aggregates that are computed in a single pass over their (shared) input
+	vector<FusedUngroupedAggregates> fused_aggregates;
+	//! Whether or not an aggregate is computed as part of fused_aggregates
+	vector<bool> is_fused;
 
 public:
 	// Source interface
@@ -71,6 +83,8 @@ private:
 	void CombineDistinct(ExecutionContext &context, OperatorSinkCombineInput &input) const;
 	//! Sink the distinct aggregates
 	void SinkDistinct(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const;
+	//! Find the aggregates that can be computed in a single pass over the same input
+	void InitializeFusedAggregates();
 };
 
 } // namespace duckdb
@@ -70,6 +70,8 @@ public:
 
 public:
 	void Sink(DataChunk &payload_chunk, idx_t payload_idx, idx_t aggr_idx);
+	//! Update MIN/MAX/COUNT aggregates over the same input in a single pass over the input
+	void SinkFused(Vector &input, idx_t count, const vector<idx_t> &aggregates);
 };
 
 } // namespace duckdb
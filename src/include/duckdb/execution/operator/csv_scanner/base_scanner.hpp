@@ -12,7 +12,9 @@
 #include "duckdb/execution/operator/csv_scanner/scanner_boundary.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_state_machine.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_error.hpp"
+#include "duckdb/common/bit_utils.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/radix.hpp"
 
 namespace duckdb {
 
@@ -142,8 +144,44 @@ protected:
 	//! Initializes the scanner
 	virtual void Initialize();
 
-	inline static bool ContainsZeroByte(uint64_t v) {
-		return (v - UINT64_C(0x0101010101010101)) & ~(v)&UINT64_C(0x8080808080808080);
+	//! Returns a mask with the highest bit set of the bytes of "v" that are equal to the (replicated) byte of "pattern"
+	//! The lowest byte that is set is exact, the bytes after it can be false positives
+	inline static uint64_t MatchBytes(uint64_t v, uint64_t pattern) {
+		auto x = v ^ pattern;
+		return (x - UINT64_C(0x0101010101010101)) & ~x & UINT64_C(0x8080808080808080);
+	}
+
+	//! Skips the bytes before "to_pos" that are equal to none of the patterns, classifying 32 bytes at a time
+	//! Stops at the first byte that matches a pattern, or before the last bytes that do not fill a word
+	inline void SkipUnmatchedBytes(const idx_t to_pos, const uint64_t pattern_a, const uint64_t pattern_b,
+	                               const uint64_t pattern_c, const uint64_t pattern_d) {
+		auto &pos = iterator.pos.buffer_pos;
+		auto data = reinterpret_cast<const_data_ptr_t>(buffer_handle_ptr);
+		while (pos + 4 * sizeof(uint64_t) < to_pos) {
+			uint64_t mask = 0;
+			for (idx_t word_idx = 0; word_idx < 4; word_idx++) {
+				uint64_t value = Load<uint64_t>(data + pos + word_idx * sizeof(uint64_t));
+				mask |= MatchBytes(value, pattern_a) | MatchBytes(value, pattern_b) | MatchBytes(value, pattern_c) |
+				        MatchBytes(value, pattern_d);
+			}
+			if (mask) {
+				break;
+			}
+			pos += 4 * sizeof(uint64_t);
+		}
+		while (pos + sizeof(uint64_t) < to_pos) {
+			uint64_t value = Load<uint64_t>(data + pos);
+			uint64_t mask = MatchBytes(value, pattern_a) | MatchBytes(value, pattern_b) | MatchBytes(value, pattern_c) |
+			                MatchBytes(value, pattern_d);
+			if (mask) {
+				if (Radix::IsLittleEndian()) {
+					// jump straight to the first matching byte
+					pos += CountZeros<uint64_t>::Trailing(mask) / 8;
+				}
+				return;
+			}
+			pos += sizeof(uint64_t);
+		}
 	}
 
 	//! Process one chunk
@@ -236,15 +274,9 @@ protected:
 				ever_quoted = true;
 				T::SetQuoted(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.quote) &
-					                     (value ^ state_machine->transition_array.escape))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
+				SkipUnmatchedBytes(to_pos, state_machine->transition_array.quote,
+				                   state_machine->transition_array.escape, state_machine->transition_array.new_line,
+				                   state_machine->transition_array.carriage_return);
 
 				while (state_machine->transition_array
 				           .skip_quoted[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
@@ -258,17 +290,10 @@ protected:
 				break;
 			case CSVState::STANDARD: {
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.delimiter) &
-					                     (value ^ state_machine->transition_array.new_line) &
-					                     (value ^ state_machine->transition_array.carriage_return) &
-					                     (value ^ state_machine->transition_array.comment))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
+				SkipUnmatchedBytes(to_pos, state_machine->transition_array.delimiter,
+				                   state_machine->transition_array.new_line,
+				                   state_machine->transition_array.carriage_return,
+				                   state_machine->transition_array.comment);
 				while (state_machine->transition_array
 				           .skip_standard[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
 				       iterator.pos.buffer_pos < to_pos - 1) {
@@ -283,15 +308,10 @@ protected:
 			case CSVState::COMMENT: {
 				T::SetComment(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.new_line) &
-					                     (value ^ state_machine->transition_array.carriage_return))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
+				SkipUnmatchedBytes(to_pos, state_machine->transition_array.new_line,
+				                   state_machine->transition_array.carriage_return,
+				                   state_machine->transition_array.new_line,
+				                   state_machine->transition_array.carriage_return);
 				while (state_machine->transition_array
 				           .skip_comment[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
 				       iterator.pos.buffer_pos < to_pos - 1) {
@@ -51,8 +51,21 @@ public:
 	CSVBuffer(CSVFileHandle &file_handle, ClientContext &context, idx_t buffer_size, idx_t global_csv_current_position,
 	          idx_t file_number_p, idx_t buffer_idx);
 
+	//! Constructor for `ReadAhead()` Buffers, the read happens in the background and must be awaited with AwaitRead()
+	//! Files we can seek in are read at the position of the buffer, other files (e.g., compressed files) are read from
+	//! the current position of the file handle
+	CSVBuffer(ClientContext &context, CSVFileHandle &file_handle, idx_t buffer_size, idx_t global_csv_current_position,
+	          idx_t file_number_p, idx_t buffer_idx, idx_t read_size);
+
+	~CSVBuffer();
+
 	//! Creates a new buffer with the next part of the CSV File
 	shared_ptr<CSVBuffer> Next(CSVFileHandle &file_handle, idx_t buffer_size, idx_t file_number, bool &has_seaked);
+	//! Starts reading the next part of the CSV File in the background. Returns nullptr if this is the last part.
+	//! Reading ahead does not move the position of a file handle we can seek in.
+	shared_ptr<CSVBuffer> ReadAhead(CSVFileHandle &file_handle, idx_t buffer_size, idx_t file_number);
+	//! Waits for the background read of a `ReadAhead()` Buffer to complete
+	void AwaitRead(CSVFileHandle &file_handle);
 
 	//! Gets the buffer actual size
 	idx_t GetBufferSize();
@@ -98,6 +111,8 @@ private:
 	bool is_pipe;
 	//! Buffer Index, used as a batch index for insertion-order preservation
 	idx_t buffer_idx = 0;
+	//! The background read filling this buffer, if it has not been awaited yet
+	shared_ptr<AsyncFileRead> pending_read;
 	//! -------- Allocated Block ---------//
 	//! Block created in allocation
 	shared_ptr<BlockHandle> block;
@@ -53,6 +53,8 @@ public:
 private:
 	//! Reads next buffer in reference to cached_buffers.front()
 	bool ReadNextAndCacheIt();
+	//! Whether the buffer after the last one can be read in the background while the last one is being parsed
+	bool CanReadAhead();
 	//! The file index this Buffer Manager refers to
 	const idx_t file_idx;
 	//! The file path this Buffer Manager refers to
@@ -61,6 +63,8 @@ private:
 	vector<shared_ptr<CSVBuffer>> cached_buffers;
 	//! The last buffer it was accessed
 	shared_ptr<CSVBuffer> last_buffer;
+	//! The buffer after last_buffer, which is being read in the background
+	shared_ptr<CSVBuffer> read_ahead;
 	idx_t global_csv_pos = 0;
 	//! The size of the buffer, if the csv file has a smaller size than this, we will use that instead to malloc less
 	idx_t buffer_size;
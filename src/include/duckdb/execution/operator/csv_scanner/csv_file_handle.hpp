@@ -12,15 +12,19 @@
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/common/atomic.hpp"
 
 namespace duckdb {
 class Allocator;
+class AsyncFileRead;
+class AsyncFileReadThreads;
 class FileSystem;
 
 struct CSVFileHandle {
 public:
 	CSVFileHandle(FileSystem &fs, Allocator &allocator, unique_ptr<FileHandle> file_handle_p, const string &path_p,
 	              FileCompressionType compression);
+	~CSVFileHandle();
 
 	mutex main_mutex;
 
@@ -32,10 +36,19 @@ public:
 	void Reset();
 
 	idx_t FileSize();
+	//! The last modification time of the file on disk
+	time_t GetLastModifiedTime();
 
 	bool FinishedReading();
 
 	idx_t Read(void *buffer, idx_t nr_bytes);
+	//! Starts reading nr_bytes from the given location in the background, without moving the file position
+	shared_ptr<AsyncFileRead> ReadAsync(void *buffer, idx_t nr_bytes, idx_t location);
+	//! Starts reading nr_bytes from the current position in a background thread (e.g., decompressing the next part of a
+	//! compressed file). The handle must not be used until the read has completed and FinishRead has been called
+	shared_ptr<AsyncFileRead> ReadAsync(void *buffer, idx_t nr_bytes);
+	//! Registers a completed background read from the current position
+	void FinishRead(const AsyncFileRead &read);
 
 	string ReadLine();
 
@@ -62,6 +75,10 @@ private:
 	idx_t requested_bytes = 0;
 	//! If we finished reading the file
 	bool finished = false;
+	//! The progress of reading a compressed file, which can be requested while a background read is running
+	atomic<idx_t> compressed_progress;
+	//! The thread that performs the reads from the current position in the background
+	unique_ptr<AsyncFileReadThreads> read_thread;
 };
 
 } // namespace duckdb
@@ -146,6 +146,9 @@ public:
 	                         const DialectOptions &dialect_options, const bool is_null, const char decimal_separator);
 
 private:
+	//! Runs all steps of the sniffer, SniffCSV first checks the CSVSnifferCache for a result
+	SnifferResult SniffCSVInternal(bool force_match);
+
 	//! CSV State Machine Cache
 	CSVStateMachineCache &state_machine_cache;
 	//! Highest number of columns found
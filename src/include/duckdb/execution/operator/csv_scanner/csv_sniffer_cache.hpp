@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/csv_scanner/csv_sniffer_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/execution/operator/csv_scanner/csv_reader_options.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+
+class ClientContext;
+class CSVBufferManager;
+struct SnifferResult;
+
+//! The CSVSnifferCache keeps the results of sniffing CSV files across queries, so reading a file that did not change
+//! again (e.g., every file of a glob that is queried repeatedly) does not sniff it again.
+//! Results are keyed on the path, size and last modification time of the file, and on the options that were given to
+//! the sniffer. Only uncompressed files on disk are cached.
+class CSVSnifferCache : public ObjectCacheEntry {
+public:
+	~CSVSnifferCache() override = default;
+
+	static CSVSnifferCache &Get(ClientContext &context);
+
+	//! Computes the key of sniffing the file of the buffer manager with the given options, or returns an empty string
+	//! if the result cannot be cached
+	static string GetKey(CSVBufferManager &buffer_manager, const CSVReaderOptions &options, const string &sniff_type);
+
+	//! Looks up a cached result, on success "options" are set to the options that resulted from sniffing
+	bool TryGet(const string &key, CSVReaderOptions &options, vector<LogicalType> &return_types,
+	            vector<string> &names);
+	void Insert(const string &key, const CSVReaderOptions &options, const vector<LogicalType> &return_types,
+	            const vector<string> &names);
+
+	static string ObjectType() {
+		return "CSV_SNIFFER_CACHE";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	//! The maximum amount of cached results, the cache is emptied when it is exceeded
+	static constexpr idx_t MAXIMUM_ENTRIES = 100000;
+
+private:
+	struct CacheEntry {
+		//! The options after sniffing
+		CSVReaderOptions options;
+		vector<LogicalType> return_types;
+		vector<string> names;
+	};
+
+	mutex lock;
+	unordered_map<string, CacheEntry> entries;
+};
+
+} // namespace duckdb
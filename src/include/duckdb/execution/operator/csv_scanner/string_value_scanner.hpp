@@ -232,6 +232,10 @@ public:
 	//! (i.e., non-comment) line.
 	bool first_line_is_comment = false;
 
+	//! Whether the current column is not projected, in which case its value is only counted, and never materialized
+	inline bool IsSkippedColumn() const;
+	//! Skips the value of a column that is not projected
+	inline void SkipValue();
 	//! Specialized code for quoted values, makes sure to remove quotes and escapes
 	static inline void AddQuotedValue(StringValueResult &result, const idx_t buffer_pos);
 	//! Adds a Value to the result
@@ -14,7 +14,8 @@
 namespace duckdb {
 
 //! PhysicalReservoirSample represents a sample taken using reservoir sampling,
-//! which is a blocking sampling method
+//! which is a blocking sampling method. Every thread samples its input into a thread-local reservoir, and the
+//! thread-local reservoirs are merged into the final sample
 
 class PhysicalReservoirSample : public PhysicalOperator {
 public:
@@ -37,6 +38,7 @@ public:
 	// Sink interface
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
 	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
 	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
 	                          OperatorSinkFinalizeInput &input) const override;
@@ -38,6 +38,8 @@ public:
 
 	static void SetExtensionVariable(ClientContext &context, ExtensionOption &extension_option, const string &name,
 	                                 SetScope scope, const Value &value);
+	//! Whether or not changing the setting for a connection can change the plans of its queries
+	static bool AffectsPlans(const string &name);
 
 public:
 	const string name;
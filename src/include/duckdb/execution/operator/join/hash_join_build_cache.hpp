@@ -0,0 +1,91 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/hash_join_build_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/storage/object_cache.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
+
+namespace duckdb {
+
+class ClientContext;
+class DatabaseInstance;
+class JoinHashTable;
+class PhysicalHashJoin;
+struct DataTableInfo;
+
+//! Identifies the build side of a hash join, and the state of the data it reads
+struct HashJoinBuildCacheKey {
+	//! Fingerprint of the build side plan and the hash table layout
+	string fingerprint;
+	//! The tables that are scanned by the build side
+	vector<shared_ptr<DataTableInfo>> tables;
+	//! For every table, the commit timestamp of the last change in its database that is visible to the query
+	vector<transaction_t> commit_ids;
+};
+
+//! The HashJoinBuildCache holds finalized hash tables, so concurrent or repeated queries that join against the same
+//! build side can probe a shared, read-only hash table instead of rebuilding it.
+//! Only build sides that deterministically scan DuckDB tables are cached, and an entry is only used when the query
+//! sees exactly the same committed state of these tables as the query that built it.
+class HashJoinBuildCache : public ObjectCacheEntry {
+public:
+	~HashJoinBuildCache() override = default;
+
+	static HashJoinBuildCache &Get(ClientContext &context);
+	static HashJoinBuildCache &Get(DatabaseInstance &db);
+
+	//! Computes the cache key for the build side of the hash join, or returns nullptr if it cannot be cached
+	static unique_ptr<HashJoinBuildCacheKey> GetKey(ClientContext &context, const PhysicalHashJoin &op);
+
+	//! Returns the cached (finalized) hash table for the key, or nullptr if there is none
+	shared_ptr<JoinHashTable> Lookup(const HashJoinBuildCacheKey &key);
+	//! Adds a finalized hash table of the given size to the cache, evicting other entries to stay within maximum_size
+	void Insert(ClientContext &context, const HashJoinBuildCacheKey &key, shared_ptr<JoinHashTable> hash_table,
+	            idx_t size, idx_t maximum_size);
+	//! Evicts (least recently used) entries until the cache is within maximum_size
+	void Evict(idx_t maximum_size);
+
+	static string ObjectType() {
+		return "HASH_JOIN_BUILD_CACHE";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	void EvictInternal(idx_t maximum_size);
+
+private:
+	struct CacheEntry {
+		//! The hash table
+		shared_ptr<JoinHashTable> hash_table;
+		//! The tables (and their state) that the hash table was built from
+		vector<weak_ptr<DataTableInfo>> tables;
+		vector<transaction_t> commit_ids;
+		//! The size of the hash table (in bytes)
+		idx_t size;
+		//! Counts the memory of the hash table in the TemporaryMemoryManager for as long as it is cached
+		unique_ptr<TemporaryMemoryState> memory_state;
+		//! Used for evicting the least recently used entries
+		idx_t last_used;
+	};
+
+	mutex lock;
+	//! Fingerprint -> cached hash table
+	unordered_map<string, CacheEntry> entries;
+	//! The total size of the cached hash tables (in bytes)
+	idx_t total_size = 0;
+	//! Incremented on every access
+	idx_t current_timestamp = 0;
+};
+
+} // namespace duckdb
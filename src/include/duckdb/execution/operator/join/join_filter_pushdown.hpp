@@ -15,6 +15,7 @@
 namespace duckdb {
 class DataChunk;
 class DynamicTableFilterSet;
+class JoinHashTable;
 struct GlobalUngroupedAggregateState;
 struct LocalUngroupedAggregateState;
 
@@ -25,6 +26,15 @@ struct JoinFilterPushdownColumn {
 	ColumnBinding probe_column_index;
 };
 
+//! A scan on the probe side of the join that filters are pushed into
+struct JoinFilterPushdownTarget {
+	//! The dynamic table filter set of the scan
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! Pairs of (filter index, column index of the scan) - a filter can apply to any column of the scan that is joined
+	//! on the probe column of the filter
+	vector<pair<idx_t, idx_t>> columns;
+};
+
 struct JoinFilterGlobalState {
 	~JoinFilterGlobalState();
 
@@ -40,8 +50,16 @@ struct JoinFilterLocalState {
 };
 
 struct JoinFilterPushdownInfo {
-	//! The dynamic table filter set where to push filters into
-	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The maximum number of build-side keys for which we push the exact key set as an IN filter
+	static constexpr const idx_t MAX_IN_FILTER_KEYS = 2048;
+	//! The maximum number of build-side keys for which we push a Bloom filter
+	static constexpr const idx_t MAX_BLOOM_FILTER_KEYS = 16777216;
+
+	//! The scans where to push filters into
+	vector<JoinFilterPushdownTarget> targets;
+	//! Whether any of the scans is on the build side of a join on the probe side - the build side of this join is
+	//! then completed before these scans start, so they are filtered as well
+	bool transfers_into_build_sides = false;
 	//! The filters that we should generate
 	vector<JoinFilterPushdownColumn> filters;
 	//! Min/Max aggregates
@@ -53,7 +71,14 @@ public:
 
 	void Sink(DataChunk &chunk, JoinFilterLocalState &lstate) const;
 	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
-	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+	void PushFilters(JoinFilterGlobalState &gstate, JoinHashTable &ht, const PhysicalOperator &op) const;
+	//! Pushes a Bloom filter over the build-side keys into the probe-side scan (if beneficial)
+	//! The Bloom filter is attached to the hash table, and is filled while the hash table is finalized
+	void PushBloomFilter(JoinHashTable &ht, const PhysicalOperator &op) const;
+
+private:
+	//! Pushes the filter into every column of every scan that the filter with the given index applies to
+	void PushFilter(const PhysicalOperator &op, idx_t filter_idx, unique_ptr<TableFilter> filter) const;
 };
 
 } // namespace duckdb
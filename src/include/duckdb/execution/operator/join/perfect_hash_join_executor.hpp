@@ -20,13 +20,19 @@ class HashJoinGlobalSinkState;
 class PhysicalHashJoin;
 
 struct PerfectHashJoinStats {
-	Value build_min;
-	Value build_max;
-	Value probe_min;
-	Value probe_max;
+	//! The min/max of every join key (one entry per join condition)
+	vector<Value> build_min;
+	vector<Value> build_max;
+	vector<Value> probe_min;
+	vector<Value> probe_max;
+	//! The multiplier of every (normalized) join key in the slot of a row in the perfect hash table
+	vector<idx_t> key_strides;
 	bool is_build_small = false;
 	bool is_build_dense = false;
 	bool is_probe_in_domain = false;
+	//! Whether the build range is too large to allocate the payload for every slot, so a bitmap is used instead
+	bool is_bitmap_indexed = false;
+	//! The number of slots in the perfect hash table minus one
 	idx_t build_range = 0;
 	idx_t estimated_cardinality = 0;
 };
@@ -38,27 +44,35 @@ class PerfectHashJoinExecutor {
 public:
 	explicit PerfectHashJoinExecutor(const PhysicalHashJoin &join, JoinHashTable &ht, PerfectHashJoinStats pjoin_stats);
 
+	//! The max number of slots for which the payload is stored for every slot
+	static constexpr idx_t MAX_BUILD_SIZE = 1000000;
+	//! The max number of slots of a bitmap-indexed perfect hash table
+	static constexpr idx_t MAX_BITMAP_BUILD_SIZE = 67108864;
+	//! A bitmap-indexed perfect hash table must have at least one build key for every BITMAP_DENSITY_FACTOR slots
+	static constexpr idx_t BITMAP_DENSITY_FACTOR = 64;
+
 public:
 	bool CanDoPerfectHashJoin();
 
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context);
 	OperatorResultType ProbePerfectHashTable(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                                         OperatorState &state);
-	bool BuildPerfectHashTable(LogicalType &type);
+	bool BuildPerfectHashTable();
 
 private:
-	void FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec, SelectionVector &probe_sel_vec,
-	                                    idx_t count, idx_t &probe_sel_count);
+	//! Adds the (normalized) values of the key_idx-th join key to the slots of the rows in sel
+	//! Writes the rows without a NULL or out-of-range key to result_sel (which may be sel), and returns their count
+	idx_t ComputeSlots(Vector &source, idx_t count, idx_t key_idx, idx_t slots[], const SelectionVector &sel,
+	                   idx_t sel_count, SelectionVector &result_sel);
 	template <typename T>
-	void TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-	                                       SelectionVector &probe_sel_vec, idx_t count, idx_t &prob_sel_count);
+	idx_t TemplatedComputeSlots(Vector &source, idx_t count, idx_t key_idx, idx_t slots[],
+	                            const SelectionVector &sel, idx_t sel_count, SelectionVector &result_sel);
 
-	bool FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                    idx_t count);
-	template <typename T>
-	bool TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                       idx_t count);
-	bool FullScanHashTable(LogicalType &key_type);
+	bool FullScanHashTable();
+	//! Computes the bitmap_ranks of a bitmap-indexed perfect hash table
+	void InitializeBitmapRanks();
+	//! Returns the position of the payload of an occupied slot in the perfect hash table
+	idx_t GetPayloadIndex(idx_t slot) const;
 
 private:
 	const PhysicalHashJoin &join;
@@ -67,8 +81,10 @@ private:
 	PerfectHashTable perfect_hash_table;
 	//! Build and probe statistics
 	PerfectHashJoinStats perfect_join_statistics;
-	//! Stores the occurences of each value in the build side
-	unsafe_unique_array<bool> bitmap_build_idx;
+	//! Stores the occurences of each value in the build side (one bit per slot)
+	unsafe_unique_array<uint64_t> bitmap_build_idx;
+	//! For bitmap-indexed perfect hash tables, the number of occupied slots preceding each word of bitmap_build_idx
+	unsafe_unique_array<uint32_t> bitmap_ranks;
 	//! Stores the number of unique keys in the build side
 	idx_t unique_keys = 0;
 };
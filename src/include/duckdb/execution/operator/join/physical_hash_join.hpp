@@ -52,6 +52,8 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! The plan key under which the actual size of the build side is recorded (if any)
+	string build_feedback_key;
 
 public:
 	InsertionOrderPreservingMap<string> ParamsToString() const override;
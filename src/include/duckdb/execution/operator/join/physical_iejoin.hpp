@@ -27,6 +27,9 @@ public:
 	vector<BoundOrderByNode> lhs_orders;
 	vector<BoundOrderByNode> rhs_orders;
 
+	//! The minimum number of rows in a range partition of the sorted inputs
+	static constexpr const idx_t MIN_PARTITION_SIZE = 64 * STANDARD_VECTOR_SIZE;
+
 public:
 	// CachingOperator Interface
 	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
@@ -67,6 +70,9 @@ public:
 public:
 	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
 
+	//! The maximum number of rows in a range partition of a sorted input with count rows
+	static idx_t GetMaxPartitionSize(ClientContext &context, idx_t count);
+
 private:
 	// resolve joins that can potentially output N*M elements (INNER, LEFT, FULL)
 	void ResolveComplexJoin(ExecutionContext &context, DataChunk &result, LocalSourceState &state) const;
@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_index_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/join/physical_join.hpp"
+
+namespace duckdb {
+
+class ART;
+class TableCatalogEntry;
+
+//! PhysicalIndexJoin represents an inner equality join that probes the ART index of a table with the join keys of the
+//! other (outer) side, and fetches the matching rows of the table by their row ids, instead of scanning the table
+class PhysicalIndexJoin : public PhysicalJoin {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::INDEX_JOIN;
+
+public:
+	PhysicalIndexJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> outer, unique_ptr<PhysicalOperator> inner,
+	                  unique_ptr<Expression> outer_key, TableCatalogEntry &table, ART &index,
+	                  vector<column_t> fetch_ids, vector<LogicalType> fetch_types, idx_t inner_column_count,
+	                  vector<idx_t> outer_projection_map, bool outer_first, idx_t estimated_cardinality);
+
+	//! The join key of the outer side
+	unique_ptr<Expression> outer_key;
+	//! The table that is probed
+	TableCatalogEntry &table;
+	//! The single-column unique index of the table on the join key
+	ART &index;
+	//! The storage ids of the fetched table columns
+	vector<column_t> fetch_ids;
+	//! The types of the fetched table columns
+	vector<LogicalType> fetch_types;
+	//! The number of fetched columns that are part of the output. If no table column is part of the output, we fetch
+	//! the row id column to count the matching rows
+	idx_t inner_column_count;
+	//! The columns of the outer side that are part of the output (all columns, if empty)
+	vector<idx_t> outer_projection_map;
+	//! Whether the columns of the outer side precede the columns of the table in the output
+	bool outer_first;
+
+public:
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+
+protected:
+	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
+
+public:
+	//! We do not build a pipeline for the table: the index join only continues into the outer side
+	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
+};
+
+} // namespace duckdb
@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_merge_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/join/physical_comparison_join.hpp"
+
+namespace duckdb {
+
+//! PhysicalMergeJoin represents an inner equi-join between two inputs that are both sorted on the join keys.
+//! The RHS is materialized in its input order, and every LHS chunk is merged with it, so no hash table is built.
+class PhysicalMergeJoin : public PhysicalComparisonJoin {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::MERGE_JOIN;
+
+public:
+	PhysicalMergeJoin(LogicalComparisonJoin &op, unique_ptr<PhysicalOperator> left, unique_ptr<PhysicalOperator> right,
+	                  vector<JoinCondition> cond, vector<OrderType> key_orders, idx_t estimated_cardinality);
+
+	//! The order of the join keys in both inputs
+	vector<OrderType> key_orders;
+	//! The columns of the LHS that are part of the output
+	vector<idx_t> left_projection_map;
+	//! The columns of the RHS that are part of the output
+	vector<idx_t> right_projection_map;
+	//! The types of the materialized RHS: the projected RHS columns, followed by the sort key of the join keys
+	vector<LogicalType> rhs_types;
+
+public:
+	//! Whether or not a merge join can be used to join on keys of the given type
+	static bool SupportsKeyType(const LogicalType &type);
+
+public:
+	// Operator Interface
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+protected:
+	// CachingOperator Interface
+	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
+
+public:
+	// Sink Interface
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+	//! The RHS has to arrive in its (sorted) order
+	bool ParallelSink() const override {
+		return false;
+	}
+};
+
+} // namespace duckdb
@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_multiway_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/join/physical_join.hpp"
+
+namespace duckdb {
+
+//! The join keys between the probe side of a PhysicalMultiwayJoin and one of its build sides
+struct MultiwayJoinBuildKeys {
+	//! The columns of the probe side that are compared with the build side
+	vector<idx_t> probe_columns;
+	//! The columns of the build side that are compared with the probe side
+	vector<idx_t> build_columns;
+	//! The columns of the build side that are compared with the other build side
+	vector<idx_t> shared_columns;
+};
+
+//! PhysicalMultiwayJoin represents an inner equi-join of three inputs that are all joined with each other (a cycle).
+//! Both build sides are materialized in a hash trie: on the keys shared with the probe side, and then on the keys
+//! shared with the other build side. For every probe row, the two tries are intersected on the keys shared by the
+//! build sides (a generic join), so the (possibly much larger) join of two of the inputs is never materialized.
+//! The build sides and their tries cannot spill: their memory is reserved with the TemporaryMemoryManager.
+class PhysicalMultiwayJoin : public PhysicalJoin {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::MULTIWAY_JOIN;
+	//! An upper bound of the memory used by the hash trie for every row of a build side (the pointer to the row, and
+	//! the trie entries of its keys)
+	static constexpr const idx_t TRIE_ENTRY_SIZE = 128;
+
+public:
+	PhysicalMultiwayJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> probe, unique_ptr<PhysicalOperator> build_1,
+	                     unique_ptr<PhysicalOperator> build_2, vector<MultiwayJoinBuildKeys> build_keys,
+	                     vector<pair<idx_t, idx_t>> output_columns, vector<string> condition_names,
+	                     idx_t estimated_cardinality);
+
+	//! The join keys of both build sides
+	vector<MultiwayJoinBuildKeys> build_keys;
+	//! For every output column: the input it comes from (the probe side is input 0), and its column in that input
+	vector<pair<idx_t, idx_t>> output_columns;
+	//! The join conditions, for display purposes
+	vector<string> condition_names;
+
+public:
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+
+	//! The estimated memory needed for a build side with the given types and cardinality, including its hash trie
+	static idx_t EstimateBuildSize(const vector<LogicalType> &types, idx_t cardinality);
+
+public:
+	// Operator Interface
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+protected:
+	// CachingOperator Interface
+	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
+
+public:
+	// Sink Interface
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+	bool ParallelSink() const override {
+		return true;
+	}
+
+public:
+	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
+};
+
+} // namespace duckdb
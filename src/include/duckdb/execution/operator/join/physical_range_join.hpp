@@ -74,7 +74,8 @@ public:
 		void Print();
 
 		//! Starts the sorting process.
-		void Finalize(Pipeline &pipeline, Event &event);
+		//! If the data needs to be merged, the sorted result is split into blocks of at most max_block_capacity rows
+		void Finalize(Pipeline &pipeline, Event &event, idx_t max_block_capacity = NumericLimits<idx_t>::Maximum());
 		//! Schedules tasks to merge sort the current child's data during a Finalize phase
 		void ScheduleMergeTasks(Pipeline &pipeline, Event &event);
 
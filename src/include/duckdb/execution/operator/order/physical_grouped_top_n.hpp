@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/order/physical_grouped_top_n.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/bound_query_node.hpp"
+
+namespace duckdb {
+
+//! PhysicalGroupedTopN keeps the first "limit" rows of every partition, and emits them together with their row number.
+//! It replaces a row_number() window function that is only used to filter on (e.g. QUALIFY row_number() <= N)
+class PhysicalGroupedTopN : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::GROUPED_TOP_N;
+
+public:
+	PhysicalGroupedTopN(vector<LogicalType> types, vector<unique_ptr<Expression>> partitions,
+	                    vector<BoundOrderByNode> orders, idx_t limit, idx_t estimated_cardinality);
+
+	//! The partition expressions
+	vector<unique_ptr<Expression>> partitions;
+	//! The orders within every partition
+	vector<BoundOrderByNode> orders;
+	//! The amount of rows to keep per partition
+	idx_t limit;
+
+	//! The maximum limit for which a row_number() window is replaced by a PhysicalGroupedTopN
+	static constexpr const idx_t MAX_LIMIT = 1000;
+
+public:
+	// Source interface
+	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+	bool IsSource() const override {
+		return true;
+	}
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+	bool ParallelSink() const override {
+		return true;
+	}
+
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+};
+
+} // namespace duckdb
@@ -12,6 +12,9 @@
 #include "duckdb/planner/bound_query_node.hpp"
 
 namespace duckdb {
+class DuckTableEntry;
+class TopNOperatorState;
+struct DynamicFilterData;
 
 //! Represents a physical ordering of the data. Note that this will not change
 //! the data but only add a selection vector.
@@ -27,6 +30,22 @@ public:
 	idx_t limit;
 	idx_t offset;
 
+	//! The maximum limit + offset for which columns that are not needed for ordering are fetched late
+	static constexpr const idx_t MAX_LATE_MATERIALIZATION_ROWS = 1000;
+
+	//! The types of the rows in the heap (equal to the output types, unless columns are fetched late)
+	vector<LogicalType> payload_types;
+	//! If set, the columns that are not needed for ordering are only fetched from this table for the final rows
+	optional_ptr<DuckTableEntry> fetch_table;
+	//! The payload column that holds the row ids to fetch
+	idx_t row_id_index = DConstants::INVALID_INDEX;
+	//! The (storage) column ids of the columns that are fetched
+	vector<column_t> fetch_column_ids;
+	//! For every output column, either the index of the payload column or (payload size + index) of the fetched column
+	vector<idx_t> output_columns;
+	//! If set, the boundary value of the first order is pushed into the scan as a dynamic filter
+	shared_ptr<DynamicFilterData> dynamic_filter;
+
 public:
 	// Source interface
 	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
@@ -55,6 +74,10 @@ public:
 	}
 
 	InsertionOrderPreservingMap<string> ParamsToString() const override;
+
+private:
+	//! Fetches the columns that were not materialized in the heap for the rows in the payload
+	void FetchColumns(ClientContext &context, TopNOperatorState &state) const;
 };
 
 } // namespace duckdb
@@ -42,6 +42,8 @@ public:
 
 	bool partition_output;
 	bool write_partition_columns;
+	//! Whether partitions are buffered (and spilled to disk) first, and then written one at a time
+	bool buffer_partitions;
 	vector<idx_t> partition_columns;
 	vector<string> names;
 	vector<LogicalType> expected_types;
@@ -18,6 +18,7 @@
 
 namespace duckdb {
 class DuckTableEntry;
+class CreateARTIndexLocalSinkState;
 
 //! Physical CREATE (UNIQUE) INDEX statement
 class PhysicalCreateARTIndex : public PhysicalOperator {
@@ -54,10 +55,8 @@ public:
 	//! Sink interface, global sink state
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
 
-	//! Sink for unsorted data: insert iteratively
-	SinkResultType SinkUnsorted(OperatorSinkInput &input) const;
-	//! Sink for sorted data: build + merge
-	SinkResultType SinkSorted(OperatorSinkInput &input) const;
+	//! Constructs an ART from the buffered keys of a thread and merges it into the thread's local ART
+	void BulkLoad(CreateARTIndexLocalSinkState &l_state) const;
 
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
 	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
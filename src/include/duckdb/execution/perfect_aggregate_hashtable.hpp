@@ -8,12 +8,29 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/execution/base_aggregate_hashtable.hpp"
 #include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
 
+//! The lazily allocated storage of a range of consecutive groups of the PerfectAggregateHashTable
+struct PerfectAggregatePage {
+	//! The aggregate states of the groups
+	unsafe_unique_array<data_t> data;
+	//! Bitmap with the groups that have any entries
+	unsafe_unique_array<validity_t> group_is_set;
+};
+
+//! The PerfectAggregateHashTable computes the location of a group directly from the (offset) values of its columns.
+//! The groups are stored in pages that are only allocated once a group in their range is found, so that large ranges
+//! that are only partially filled do not have to be allocated (and initialized) completely
 class PerfectAggregateHashTable : public BaseAggregateHashTable {
+public:
+	//! The (maximum) amount of groups that are stored in a page is 2^PAGE_BITS
+	static constexpr const idx_t PAGE_BITS = 11;
+
 public:
 	PerfectAggregateHashTable(ClientContext &context, Allocator &allocator, const vector<LogicalType> &group_types,
 	                          vector<LogicalType> payload_types_p, vector<AggregateObject> aggregate_objects,
@@ -24,7 +41,8 @@ public:
 	//! Add the given data to the HT
 	void AddChunk(DataChunk &groups, DataChunk &payload);
 
-	//! Combines the target perfect aggregate HT into this one
+	//! Combines the target perfect aggregate HT into this one. Multiple threads can combine their HTs into the same HT
+	//! in parallel.
 	void Combine(PerfectAggregateHashTable &other);
 
 	//! Scan the HT starting from the scan_position
@@ -38,17 +56,20 @@ protected:
 	idx_t total_required_bits;
 	//! The total amount of groups
 	idx_t total_groups;
+	//! The amount of groups per page (2^page_bits)
+	idx_t page_bits;
+	idx_t page_size;
 	//! The tuple size
 	idx_t tuple_size;
 	//! The number of grouping columns
 	idx_t grouping_columns;
 
-	// The actual pointer to the data
-	data_ptr_t data;
-	//! The owned data of the HT
-	unsafe_unique_array<data_t> owned_data;
-	//! Information on whether or not a specific group has any entries
-	unsafe_unique_array<bool> group_is_set;
+	//! The pages of the HT, nullptr if no group in the range of the page has been found yet
+	vector<unique_ptr<PerfectAggregatePage>> pages;
+	//! The locks of the pages, which are held while combining another HT into a page
+	unsafe_unique_array<mutex> page_locks;
+	//! The page at which the next Combine starts
+	atomic<idx_t> next_combine_page {0};
 
 	//! The minimum values for each of the group columns
 	vector<Value> group_minima;
@@ -60,8 +81,12 @@ protected:
 	unique_ptr<ArenaAllocator> aggregate_allocator;
 	//! Owning arena allocators that this HT has data from
 	vector<unique_ptr<ArenaAllocator>> stored_allocators;
+	//! The lock for stored_allocators
+	mutex allocator_lock;
 
 private:
+	//! Allocate the page with the given index, and initialize the aggregate states of its groups
+	PerfectAggregatePage &CreatePage(idx_t page_idx);
 	//! Destroy the perfect aggregate HT (called automatically by the destructor)
 	void Destroy();
 };
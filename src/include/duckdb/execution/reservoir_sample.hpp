@@ -19,6 +19,9 @@ namespace duckdb {
 
 enum class SampleType : uint8_t { BLOCKING_SAMPLE = 0, RESERVOIR_SAMPLE = 1, RESERVOIR_PERCENTAGE_SAMPLE = 2 };
 
+//! The size of the samples that are maintained per table
+static constexpr const idx_t FIXED_SAMPLE_SIZE = STANDARD_VECTOR_SIZE;
+
 class BaseReservoirSampling {
 public:
 	explicit BaseReservoirSampling(int64_t seed);
@@ -61,7 +64,8 @@ public:
 	bool destroyed;
 
 public:
-	explicit BlockingSample(int64_t seed) : old_base_reservoir_sample(seed), random(old_base_reservoir_sample.random) {
+	BlockingSample(SampleType type, int64_t seed)
+	    : type(type), destroyed(false), old_base_reservoir_sample(seed), random(old_base_reservoir_sample.random) {
 		base_reservoir_sample = nullptr;
 	}
 	virtual ~BlockingSample() {
@@ -74,6 +78,9 @@ public:
 	//! Fetches a chunk from the sample. Note that this method is destructive and should only be used after the
 	//! sample is completely built.
 	virtual unique_ptr<DataChunk> GetChunk() = 0;
+	//! Merges a sample of the same type that was taken over a disjoint part of the input into this sample, such that
+	//! the result is a sample of the combined input. The other sample is consumed in the process.
+	virtual void Merge(BlockingSample &other) = 0;
 	BaseReservoirSampling old_base_reservoir_sample;
 
 	virtual void Serialize(Serializer &serializer) const;
@@ -125,6 +132,14 @@ public:
 	//! sample is completely built.
 	unique_ptr<DataChunk> GetChunk() override;
 	void Finalize() override;
+	//! Merges the reservoirs by keeping the sample_count entries with the highest keys of both reservoirs
+	void Merge(BlockingSample &other) override;
+	//! Creates a copy of the sample
+	unique_ptr<ReservoirSample> Copy();
+	//! The number of entries in the sample
+	idx_t GetSampleCount() const {
+		return reservoir_data_chunk ? reservoir_data_chunk->size() : 0;
+	}
 	void Serialize(Serializer &serializer) const override;
 	static unique_ptr<BlockingSample> Deserialize(Deserializer &deserializer);
 
@@ -166,6 +181,8 @@ public:
 	//! sample is completely built.
 	unique_ptr<DataChunk> GetChunk() override;
 	void Finalize() override;
+	//! Merges the samples by finalizing both and taking the union of their finished samples
+	void Merge(BlockingSample &other) override;
 
 	void Serialize(Serializer &serializer) const override;
 	static unique_ptr<BlockingSample> Deserialize(Deserializer &deserializer);
@@ -187,6 +187,17 @@ public:
 	virtual ~WindowExecutor() {
 	}
 
+	template <class TARGET>
+	TARGET &Cast() {
+		DynamicCastCheck<TARGET>(this);
+		return reinterpret_cast<TARGET &>(*this);
+	}
+	template <class TARGET>
+	const TARGET &Cast() const {
+		DynamicCastCheck<TARGET>(this);
+		return reinterpret_cast<const TARGET &>(*this);
+	}
+
 	virtual unique_ptr<WindowExecutorGlobalState>
 	GetGlobalState(const idx_t payload_count, const ValidityMask &partition_mask, const ValidityMask &order_mask) const;
 	virtual unique_ptr<WindowExecutorLocalState> GetLocalState(const WindowExecutorGlobalState &gstate) const;
@@ -221,6 +232,15 @@ public:
 	                                                     const ValidityMask &order_mask) const override;
 	unique_ptr<WindowExecutorLocalState> GetLocalState(const WindowExecutorGlobalState &gstate) const override;
 
+	//! Whether the aggregates of this executor can be evaluated with the aggregator of another one,
+	//! i.e., the aggregates only differ in their frames
+	bool CanShareAggregator(const WindowAggregateExecutor &other) const;
+	//! Get a global state that evaluates with the segment tree of the global state of another executor (if it has one)
+	unique_ptr<WindowExecutorGlobalState> GetSharedGlobalState(const idx_t payload_count,
+	                                                           const ValidityMask &partition_mask,
+	                                                           const ValidityMask &order_mask,
+	                                                           const WindowExecutorGlobalState &shared) const;
+
 	const WindowAggregationMode mode;
 
 protected:
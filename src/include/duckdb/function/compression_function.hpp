@@ -22,6 +22,7 @@ class ColumnData;
 class ColumnDataCheckpointer;
 class ColumnSegment;
 class SegmentStatistics;
+class TableFilter;
 struct ColumnSegmentState;
 
 struct ColumnFetchState;
@@ -169,6 +170,10 @@ typedef void (*compression_fetch_row_t)(ColumnSegment &segment, ColumnFetchState
 //! Function prototype used for skipping 'skip_count' values, non-trivial if random-access is not supported for the
 //! compressed data.
 typedef void (*compression_skip_t)(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count);
+//! Function prototype used for scanning an entire vector while evaluating a filter on the compressed data. Scans
+//! 'scan_count' values into the result (like scan_vector), and removes the rows that do not pass the filter from 'sel'
+typedef void (*compression_filter_t)(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                     SelectionVector &sel, idx_t &sel_count, const TableFilter &filter);
 
 //===--------------------------------------------------------------------===//
 // Append (optional)
@@ -210,9 +215,9 @@ public:
 	    : type(type), data_type(data_type), init_analyze(init_analyze), analyze(analyze), final_analyze(final_analyze),
 	      init_compression(init_compression), compress(compress), compress_finalize(compress_finalize),
 	      init_prefetch(init_prefetch), init_scan(init_scan), scan_vector(scan_vector), scan_partial(scan_partial),
-	      fetch_row(fetch_row), skip(skip), init_segment(init_segment), init_append(init_append), append(append),
-	      finalize_append(finalize_append), revert_append(revert_append), serialize_state(serialize_state),
-	      deserialize_state(deserialize_state), cleanup_state(cleanup_state) {
+	      fetch_row(fetch_row), skip(skip), filter(nullptr), init_segment(init_segment), init_append(init_append),
+	      append(append), finalize_append(finalize_append), revert_append(revert_append),
+	      serialize_state(serialize_state), deserialize_state(deserialize_state), cleanup_state(cleanup_state) {
 	}
 
 	//! Compression type
@@ -256,6 +261,9 @@ public:
 	compression_fetch_row_t fetch_row;
 	//! Skip forward in the compressed segment
 	compression_skip_t skip;
+	//! Scan a vector while evaluating a table filter directly on the compressed data (optional)
+	//! e.g. once per dictionary entry or once per run, instead of once per row
+	compression_filter_t filter;
 
 	// Append functions
 	//! This only really needs to be defined for uncompressed segments
@@ -46,4 +46,27 @@ struct CMStringDecompressFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+//! Identifies the per-query dictionary that strings are compressed with
+struct CMStringDictionaryFunctionData : public FunctionData {
+public:
+	explicit CMStringDictionaryFunctionData(idx_t dictionary_id);
+
+public:
+	idx_t dictionary_id;
+
+public:
+	unique_ptr<FunctionData> Copy() const override;
+	bool Equals(const FunctionData &other_p) const override;
+};
+
+struct CMStringDictionaryCompressFun {
+	static ScalarFunction GetFunction();
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct CMStringDictionaryDecompressFun {
+	static ScalarFunction GetFunction();
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 } // namespace duckdb
@@ -56,11 +56,13 @@ struct RegexpBaseBindData : public FunctionData {
 struct RegexpMatchesBindData : public RegexpBaseBindData {
 	RegexpMatchesBindData(duckdb_re2::RE2::Options options, string constant_string, bool constant_pattern);
 	RegexpMatchesBindData(duckdb_re2::RE2::Options options, string constant_string, bool constant_pattern,
-	                      string range_min, string range_max, bool range_success);
+	                      string range_min, string range_max, bool range_success, vector<string> required_literals);
 
 	string range_min;
 	string range_max;
 	bool range_success;
+	//! Literals that occur in every match of the constant pattern, checked before running the regex
+	vector<string> required_literals;
 
 	unique_ptr<FunctionData> Copy() const override;
 };
@@ -53,4 +53,8 @@ struct QueryTableFunction {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct SharedMemoryFunction {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 } // namespace duckdb
@@ -45,6 +45,10 @@ struct DuckDBSchemasFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBCheckpointsFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBColumnsFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -89,6 +93,18 @@ struct DuckDBMemoryFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBQueryTasksFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct DuckDBRunningQueriesFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct DuckDBTableSampleFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBOptimizersFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
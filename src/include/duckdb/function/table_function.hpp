@@ -26,6 +26,7 @@ class LogicalGet;
 class TableFilterSet;
 class TableCatalogEntry;
 struct MultiFileReader;
+struct SampleOptions;
 
 struct TableFunctionInfo {
 	DUCKDB_API virtual ~TableFunctionInfo();
@@ -102,14 +103,18 @@ struct TableFunctionBindInput {
 
 struct TableFunctionInitInput {
 	TableFunctionInitInput(optional_ptr<const FunctionData> bind_data_p, const vector<column_t> &column_ids_p,
-	                       const vector<idx_t> &projection_ids_p, optional_ptr<TableFilterSet> filters_p)
-	    : bind_data(bind_data_p), column_ids(column_ids_p), projection_ids(projection_ids_p), filters(filters_p) {
+	                       const vector<idx_t> &projection_ids_p, optional_ptr<TableFilterSet> filters_p,
+	                       optional_ptr<SampleOptions> sample_options_p = nullptr)
+	    : bind_data(bind_data_p), column_ids(column_ids_p), projection_ids(projection_ids_p), filters(filters_p),
+	      sample_options(sample_options_p) {
 	}
 
 	optional_ptr<const FunctionData> bind_data;
 	const vector<column_t> &column_ids;
 	const vector<idx_t> projection_ids;
 	optional_ptr<TableFilterSet> filters;
+	//! The system sample that is pushed down into the scan (if any)
+	optional_ptr<SampleOptions> sample_options;
 
 	bool CanRemoveFilterColumns() const {
 		if (projection_ids.empty()) {
@@ -301,6 +306,9 @@ public:
 	//! Whether or not the table function can immediately prune out filter columns that are unused in the remainder of
 	//! the query plan, e.g., "SELECT i FROM tbl WHERE j = 42;" - j does not need to leave the table function at all
 	bool filter_prune;
+	//! Whether or not the table function supports sampling pushdown. If supported, a system sample directly on top of
+	//! the scan is pushed into the table function, which then skips blocks of rows instead of reading them.
+	bool sampling_pushdown;
 	//! Additional function info, passed to the bind
 	shared_ptr<TableFunctionInfo> function_info;
 
@@ -9,6 +9,8 @@
 #pragma once
 
 #include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/winapi.hpp"
 #include "duckdb/main/table_description.hpp"
 
@@ -19,6 +21,12 @@ class ClientContext;
 class DuckDB;
 class TableCatalogEntry;
 class Connection;
+class RowGroupCollection;
+class OptimisticDataWriter;
+class BoundConstraint;
+class ParallelAppender;
+struct TableAppendState;
+struct ConstraintState;
 
 enum class AppenderType : uint8_t {
 	LOGICAL, // Cast input -> LogicalType
@@ -148,6 +156,66 @@ protected:
 	void FlushInternal(ColumnDataCollection &collection) override;
 };
 
+//! The LocalParallelAppender appends rows on behalf of a single thread of a ParallelAppender. Full row groups are
+//! written to disk directly. The rows only become part of the table when the ParallelAppender is committed.
+class LocalParallelAppender : public BaseAppender {
+	friend class ParallelAppender;
+
+	//! The parallel appender this appender belongs to
+	ParallelAppender &parent;
+	//! The rows appended by this appender
+	unique_ptr<RowGroupCollection> local_collection;
+	unique_ptr<TableAppendState> append_state;
+	//! The writer used to write full row groups to disk
+	optional_ptr<OptimisticDataWriter> writer;
+	unique_ptr<ConstraintState> constraint_state;
+
+public:
+	explicit LocalParallelAppender(ParallelAppender &parent);
+	DUCKDB_API ~LocalParallelAppender() override;
+
+protected:
+	void FlushInternal(ColumnDataCollection &collection) override;
+};
+
+//! The ParallelAppender loads rows into a table from multiple threads at the same time, writing row groups to disk
+//! as they fill up instead of buffering them in the transaction-local storage. Every thread appends through its own
+//! LocalParallelAppender; all appended rows are committed as a single transaction by Commit().
+//! The connection must not be used for other queries while the appender is active.
+class ParallelAppender {
+	friend class LocalParallelAppender;
+
+	//! The client context of the connection that created this appender
+	shared_ptr<ClientContext> context;
+	//! The table to append to
+	optional_ptr<TableCatalogEntry> table;
+	vector<unique_ptr<BoundConstraint>> bound_constraints;
+	//! Whether or not the appender started the transaction (and thus commits it)
+	bool owns_transaction;
+	//! Whether or not the appender was committed or rolled back
+	bool finished;
+	mutex lock;
+	vector<unique_ptr<LocalParallelAppender>> local_appenders;
+
+public:
+	DUCKDB_API ParallelAppender(Connection &con, const string &schema_name, const string &table_name);
+	DUCKDB_API ParallelAppender(Connection &con, const string &table_name);
+	DUCKDB_API ~ParallelAppender();
+
+public:
+	//! Creates an appender for a single thread. The appender is owned by the ParallelAppender.
+	DUCKDB_API LocalParallelAppender &CreateLocalAppender();
+	//! Merges the rows of all local appenders into the table and commits the transaction (if it was started by the
+	//! appender). All threads must have finished appending before calling Commit().
+	DUCKDB_API void Commit();
+	//! Discards all appended rows
+	DUCKDB_API void Rollback();
+
+private:
+	void Merge(LocalParallelAppender &local_appender);
+	void FinishTransaction(const string &query);
+};
+
 template <>
 DUCKDB_API void BaseAppender::Append(bool value);
 template <>
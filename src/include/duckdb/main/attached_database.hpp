@@ -43,6 +43,12 @@ struct AttachOptions {
 	AccessMode access_mode;
 	//! The file format type. The default type is a duckdb database file, but other file formats are possible.
 	string db_type;
+	//! Whether or not to memory-map the database file (only for read-only databases).
+	bool use_mmap = false;
+	//! The key of an encrypted database file (empty if the file is not encrypted).
+	string encryption_key;
+	//! The name of the secret that holds the encryption key, which is resolved into encryption_key when attaching.
+	string encryption_secret;
 	//! We only set this, if we detect any unrecognized option.
 	string unrecognized_option;
 };
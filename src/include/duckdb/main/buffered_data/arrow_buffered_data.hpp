@@ -0,0 +1,88 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/arrow_buffered_data.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/main/buffered_data/buffered_data.hpp"
+#include "duckdb/common/arrow/arrow_wrapper.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/parallel/interrupt.hpp"
+
+namespace duckdb {
+
+class StreamQueryResult;
+class ClientContextLock;
+
+struct BufferedArrowArray {
+	unique_ptr<ArrowArrayWrapper> array;
+	//! The (estimated) size of the data the array was converted from
+	idx_t size;
+};
+
+//! Buffers the Arrow arrays that are converted by the pipeline threads until the consumer fetches them.
+//! If the result is ordered, arrays are handed to the consumer in batch index order, otherwise as soon as they are
+//! finished
+class ArrowBufferedData : public BufferedData {
+public:
+	static constexpr const BufferedData::Type TYPE = BufferedData::Type::ARROW;
+
+public:
+	ArrowBufferedData(weak_ptr<ClientContext> context, bool ordered);
+
+public:
+	//! Appends a finished array that belongs to the given batch, the batch is ignored if the result is unordered
+	void Append(unique_ptr<ArrowArrayWrapper> array, idx_t size, idx_t batch);
+	void BlockSink(const InterruptState &blocked_sink, idx_t batch);
+	bool ShouldBlockBatch(idx_t batch);
+	//! Hands all buffered batches up to the minimum batch index to the consumer
+	void UpdateMinBatchIndex(idx_t min_batch_index);
+	bool BufferIsEmpty() override;
+	void UnblockSinks() override;
+	StreamExecutionResult ExecuteTaskInternal(StreamQueryResult &result, ClientContextLock &context_lock) override;
+	unique_ptr<DataChunk> Scan() override;
+	//! Returns the next finished array, or nullptr if there are no more arrays
+	unique_ptr<ArrowArrayWrapper> ScanArray();
+
+	inline idx_t ReadQueueCapacity() const {
+		if (!ordered) {
+			// Unordered arrays are always readable, so they are never held back in the buffer
+			return PrefetchSize();
+		}
+		return (idx_t)(static_cast<double>(PrefetchSize()) * 0.6);
+	}
+	inline idx_t BufferCapacity() const {
+		if (!ordered) {
+			return 0;
+		}
+		return (idx_t)(static_cast<double>(PrefetchSize()) * 0.4);
+	}
+
+private:
+	bool ShouldBlockBatchInternal(lock_guard<mutex> &lock, idx_t batch);
+	void MoveCompletedBatches(lock_guard<mutex> &lock);
+
+private:
+	//! Whether the arrays are handed to the consumer in batch index order
+	bool ordered;
+
+	//! The arrays of batches that cannot be read yet, because a batch with a lower index is still in progress
+	map<idx_t, deque<BufferedArrowArray>> buffer;
+	idx_t buffer_byte_count;
+
+	//! The arrays that can be read
+	deque<BufferedArrowArray> read_queue;
+	idx_t read_queue_byte_count;
+
+	//! The blocked sinks, together with the batch they were appending to
+	vector<pair<idx_t, InterruptState>> blocked_sinks;
+
+	idx_t min_batch;
+};
+
+} // namespace duckdb
@@ -44,14 +44,14 @@ public:
 	void UpdateMinBatchIndex(idx_t min_batch_index);
 	bool IsMinimumBatchIndex(lock_guard<mutex> &lock, idx_t batch);
 	void CompleteBatch(idx_t batch);
-	bool BufferIsEmpty();
+	bool BufferIsEmpty() override;
 	void UnblockSinks() override;
 
 	inline idx_t ReadQueueCapacity() const {
-		return read_queue_capacity;
+		return (idx_t)(static_cast<double>(PrefetchSize()) * 0.6);
 	}
 	inline idx_t BufferCapacity() const {
-		return buffer_capacity;
+		return (idx_t)(static_cast<double>(PrefetchSize()) * 0.4);
 	}
 
 private:
@@ -61,12 +61,10 @@ private:
 private:
 	//! The buffer where chunks are written before they are ready to be read.
 	map<idx_t, InProgressBatch> buffer;
-	idx_t buffer_capacity;
 	atomic<idx_t> buffer_byte_count;
 
 	//! The queue containing the chunks that can be read.
 	deque<unique_ptr<DataChunk>> read_queue;
-	idx_t read_queue_capacity;
 	atomic<idx_t> read_queue_byte_count;
 
 	map<idx_t, InterruptState> blocked_sinks;
@@ -18,6 +18,8 @@
 #include "duckdb/common/enums/stream_execution_result.hpp"
 #include "duckdb/common/shared_ptr.hpp"
 
+#include <chrono>
+
 namespace duckdb {
 
 class StreamQueryResult;
@@ -25,7 +27,7 @@ class ClientContextLock;
 
 class BufferedData {
 protected:
-	enum class Type { SIMPLE, BATCHED };
+	enum class Type { SIMPLE, BATCHED, ARROW };
 
 public:
 	BufferedData(Type type, weak_ptr<ClientContext> context_p);
@@ -36,6 +38,25 @@ public:
 	virtual StreamExecutionResult ExecuteTaskInternal(StreamQueryResult &result, ClientContextLock &context_lock) = 0;
 	virtual unique_ptr<DataChunk> Scan() = 0;
 	virtual void UnblockSinks() = 0;
+	//! Whether the consumer has nothing left to read
+	virtual bool BufferIsEmpty() = 0;
+
+	//! Sets the maximum amount of memory (in bytes) that is kept buffered for this result
+	void SetBufferBudget(idx_t budget);
+	idx_t GetBufferBudget() const {
+		return total_buffer_size;
+	}
+	//! The amount of memory (in bytes) the producers currently buffer ahead of the consumer
+	idx_t PrefetchSize() const {
+		return prefetch_size;
+	}
+	//! The number of times a producer was blocked because the buffer was full
+	idx_t GetBlockedSinkCount();
+	//! The total time (in seconds) during which at least one producer was blocked because the buffer was full
+	double GetBlockedSinkTime();
+	Type GetType() const {
+		return type;
+	}
 	shared_ptr<ClientContext> GetContext() {
 		return context.lock();
 	}
@@ -67,14 +88,41 @@ public:
 		return reinterpret_cast<const TARGET &>(*this);
 	}
 
+protected:
+	//! Bookkeeping for the instrumentation, must be called when a sink is blocked or rescheduled (holding 'glock')
+	void SinkBlocked(lock_guard<mutex> &lock);
+	void SinkUnblocked(lock_guard<mutex> &lock);
+
+private:
+	//! Adapts the prefetch size to the rate at which the consumer fetches, called on every fetch
+	void AdaptPrefetchSize();
+	std::chrono::steady_clock::duration BlockedSinkTimeInternal(lock_guard<mutex> &lock) const;
+
 protected:
 	Type type;
 	//! This is weak to avoid a cyclical reference
 	weak_ptr<ClientContext> context;
 	//! The maximum amount of memory we should keep buffered
 	idx_t total_buffer_size;
+	//! The amount of memory the producers buffer before they are blocked, between a fraction of the total buffer size
+	//! (for consumers that are slower than the producers) and the total buffer size (for consumers that are faster)
+	atomic<idx_t> prefetch_size;
 	//! Protect against populate/fetch race condition
 	mutex glock;
+
+private:
+	//! The number of currently blocked sinks
+	idx_t blocked_sinks_count = 0;
+	//! The number of times a sink was blocked
+	idx_t total_blocked_sinks = 0;
+	//! Since when at least one sink is blocked (if any)
+	std::chrono::steady_clock::time_point blocked_since;
+	//! The time during which at least one sink was blocked, excluding the current blocked period
+	std::chrono::steady_clock::duration blocked_time = std::chrono::steady_clock::duration::zero();
+	//! The time of the previous fetch, and the time the sinks were blocked at that moment
+	std::chrono::steady_clock::time_point last_fetch;
+	std::chrono::steady_clock::duration blocked_time_at_last_fetch = std::chrono::steady_clock::duration::zero();
+	bool fetched = false;
 };
 
 } // namespace duckdb
@@ -31,11 +31,12 @@ public:
 	void Append(const DataChunk &chunk);
 	void BlockSink(const InterruptState &blocked_sink);
 	bool BufferIsFull();
+	bool BufferIsEmpty() override;
 	void UnblockSinks() override;
 	StreamExecutionResult ExecuteTaskInternal(StreamQueryResult &result, ClientContextLock &context_lock) override;
 	unique_ptr<DataChunk> Scan() override;
 	inline idx_t BufferSize() const {
-		return buffer_size;
+		return PrefetchSize();
 	}
 
 private:
@@ -43,10 +44,8 @@ private:
 	queue<InterruptState> blocked_sinks;
 	//! The queue of chunks
 	queue<unique_ptr<DataChunk>> buffered_chunks;
-	//! The current capacity of the buffer (tuples)
+	//! The current capacity of the buffer (bytes)
 	atomic<idx_t> buffered_count;
-	//! The amount of tuples we should buffer
-	idx_t buffer_size;
 };
 
 } // namespace duckdb
@@ -422,6 +422,14 @@ typedef struct {
 	                                        duckdb_arrow_schema arrow_schema, duckdb_arrow_array arrow_array,
 	                                        duckdb_arrow_stream *out_stream);
 	duckdb_data_chunk (*duckdb_stream_fetch_chunk)(duckdb_result result);
+	// dev
+	// WARNING! the functions below are not (yet) stable
+
+	duckdb_data_chunk (*duckdb_fetch_chunk_batch)(duckdb_result result, idx_t min_rows);
+	duckdb_state (*duckdb_pending_set_ready_callback)(duckdb_pending_result pending_result,
+	                                                  duckdb_pending_ready_callback_t callback, void *user_data);
+	duckdb_state (*duckdb_execute_prepared_batch)(duckdb_prepared_statement prepared_statement,
+	                                              duckdb_data_chunk parameters, duckdb_result *out_result);
 } duckdb_ext_api_v0;
 
 //===--------------------------------------------------------------------===//
@@ -800,6 +808,9 @@ inline duckdb_ext_api_v0 CreateAPIv0() {
 	result.duckdb_arrow_scan = duckdb_arrow_scan;
 	result.duckdb_arrow_array_scan = duckdb_arrow_array_scan;
 	result.duckdb_stream_fetch_chunk = duckdb_stream_fetch_chunk;
+	result.duckdb_fetch_chunk_batch = duckdb_fetch_chunk_batch;
+	result.duckdb_pending_set_ready_callback = duckdb_pending_set_ready_callback;
+	result.duckdb_execute_prepared_batch = duckdb_execute_prepared_batch;
 	return result;
 }
 
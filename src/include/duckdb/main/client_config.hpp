@@ -12,6 +12,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/output_type.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
+#include "duckdb/common/enums/query_priority.hpp"
 #include "duckdb/common/progress_bar/progress_bar.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/main/profiling_info.hpp"
@@ -38,6 +39,8 @@ struct ClientConfig {
 	//! The file to save query profiling information to, instead of printing it to the console
 	//! (empty = print to console)
 	string profiler_save_location;
+	//! The file to write a timeline of the task execution of every query to (empty = disabled)
+	string execution_trace_output;
 	//! The custom settings for the profiler
 	//! (empty = use the default settings)
 	profiler_settings_t profiler_settings = ProfilingInfo::DefaultSettings();
@@ -91,6 +94,9 @@ struct ClientConfig {
 	//! Maximum bits allowed for using a perfect hash table (i.e. the perfect HT can hold up to 2^perfect_ht_threshold
 	//! elements)
 	idx_t perfect_ht_threshold = 12;
+	//! The maximum estimated amount of distinct strings for which compressed materialization replaces a string column
+	//! with codes from a per-query dictionary (0 disables this)
+	idx_t compressed_materialization_dictionary_threshold = 0;
 	//! The maximum number of rows to accumulate before sorting ordered aggregates.
 	idx_t ordered_aggregate_threshold = (idx_t(1) << 18);
 	//! The number of rows to accumulate before flushing during a partitioned write
@@ -101,9 +107,15 @@ struct ClientConfig {
 	idx_t nested_loop_join_threshold = 5;
 	//! The number of rows we need on either table to choose a merge join over an IE join
 	idx_t merge_join_threshold = 1000;
+	//! The minimum ratio between the rows of an indexed table and the rows probing it to choose an index join
+	idx_t index_join_threshold = 64;
 
 	//! The maximum amount of memory to keep buffered in a streaming query result. Default: 1mb.
 	idx_t streaming_buffer_size = 1000000;
+	//! The maximum amount of buffer pool memory a single query can reserve (DConstants::INVALID_INDEX = no limit)
+	idx_t query_memory_limit = DConstants::INVALID_INDEX;
+	//! The maximum amount of buffer pool memory a connection can reserve (DConstants::INVALID_INDEX = no limit)
+	idx_t session_memory_limit = DConstants::INVALID_INDEX;
 
 	//! Callback to create a progress bar display
 	progress_bar_display_create_func_t display_create_func = nullptr;
@@ -114,6 +126,13 @@ struct ClientConfig {
 	//! The maximum amount of pivot columns
 	idx_t pivot_limit = 100000;
 
+	//! The priority class of the queries of this connection, which weighs their share of the threads
+	QueryPriority query_priority = QueryPriority::NORMAL;
+
+	//! The memory a data chunk in a pipeline should span: pipelines whose rows are too wide to fit
+	//! STANDARD_VECTOR_SIZE rows in this budget push smaller chunks through their operators (0 disables this)
+	idx_t pipeline_chunk_budget = 1ULL << 20ULL;
+
 	//! The threshold at which we switch from using filtered aggregates to LIST with a dedicated pivot operator
 	idx_t pivot_filter_threshold = 20;
 
@@ -135,9 +154,16 @@ struct ClientConfig {
 	//! Variables set by the user
 	case_insensitive_map_t<Value> user_variables;
 
+	//! Whether or not settings or variables (other than the search path) were changed for this connection - the plans
+	//! of such connections are not shared through the plan cache
+	bool modified_settings = false;
+
 	//! Function that is used to create the result collector for a materialized result
 	//! Defaults to PhysicalMaterializedCollector
 	get_result_collector_t result_collector = nullptr;
+	//! Function that is used to create the result collector for a streaming result
+	//! Defaults to PhysicalBufferedCollector
+	get_result_collector_t streaming_result_collector = nullptr;
 
 	//! If HTTP logging is enabled or not.
 	bool enable_http_logging = false;
@@ -155,6 +181,7 @@ public:
 
 	void SetUserVariable(const string &name, Value value) {
 		user_variables[name] = std::move(value);
+		modified_settings = true;
 	}
 
 	bool GetUserVariable(const string &name, Value &result) {
@@ -168,6 +195,7 @@ public:
 
 	void ResetUserVariable(const string &name) {
 		user_variables.erase(name);
+		modified_settings = true;
 	}
 
 public:
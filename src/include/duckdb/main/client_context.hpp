@@ -28,6 +28,7 @@
 #include "duckdb/main/stream_query_result.hpp"
 #include "duckdb/main/table_description.hpp"
 #include "duckdb/planner/expression/bound_parameter_data.hpp"
+#include "duckdb/storage/buffer/client_memory_tracker.hpp"
 #include "duckdb/transaction/transaction_context.hpp"
 
 namespace duckdb {
@@ -67,6 +68,7 @@ class ClientContext : public enable_shared_from_this<ClientContext> {
 	friend class BufferedData;        // ExecuteTaskInternal
 	friend class SimpleBufferedData;  // ExecuteTaskInternal
 	friend class BatchedBufferedData; // ExecuteTaskInternal
+	friend class ArrowBufferedData;   // ExecuteTaskInternal
 	friend class StreamQueryResult;   // LockContext
 	friend class ConnectionManager;
 
@@ -229,6 +231,8 @@ private:
 	                                                                const PendingQueryParameters &parameters);
 	void CheckIfPreparedStatementIsExecutable(PreparedStatementData &statement);
 
+	//! Whether or not any registered client context state could request a rebind of a statement
+	bool CanRequestRebind();
 	//! Internally prepare a SQL statement. Caller must hold the context_lock.
 	shared_ptr<PreparedStatementData>
 	CreatePreparedStatement(ClientContextLock &lock, const string &query, unique_ptr<SQLStatement> statement,
@@ -287,7 +291,8 @@ private:
 
 class ClientContextLock {
 public:
-	explicit ClientContextLock(mutex &context_lock) : client_guard(context_lock) {
+	explicit ClientContextLock(mutex &context_lock, optional_ptr<ClientMemoryTracker> memory_tracker = nullptr)
+	    : client_guard(context_lock), memory_scope(memory_tracker) {
 	}
 
 	~ClientContextLock() {
@@ -295,6 +300,8 @@ public:
 
 private:
 	lock_guard<mutex> client_guard;
+	//! Memory reserved while holding the lock is charged to the client
+	ClientMemoryTracker::ActiveScope memory_scope;
 };
 
 } // namespace duckdb
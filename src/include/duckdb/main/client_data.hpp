@@ -20,10 +20,12 @@ class AttachedDatabase;
 class BufferedFileWriter;
 class ClientContext;
 class CatalogSearchPath;
+class ClientMemoryTracker;
 class FileOpener;
 class FileSystem;
 class HTTPState;
 class QueryProfiler;
+class QueryTelemetry;
 class PreparedStatementData;
 class SchemaCatalogEntry;
 class HTTPLogger;
@@ -35,6 +37,10 @@ struct ClientData {
 
 	//! Query profiler
 	shared_ptr<QueryProfiler> profiler;
+	//! Tracks the buffer pool memory reserved by the client and its queries
+	shared_ptr<ClientMemoryTracker> memory_tracker;
+	//! Live counters of the resources used by the running query
+	shared_ptr<QueryTelemetry> query_telemetry;
 
 	//! HTTP logger
 	shared_ptr<HTTPLogger> http_logger;
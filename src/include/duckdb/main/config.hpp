@@ -14,6 +14,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/encryption_state.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
 #include "duckdb/common/enums/optimizer_type.hpp"
 #include "duckdb/common/enums/order_type.hpp"
@@ -45,6 +46,7 @@ class ErrorManager;
 class CompressionFunction;
 class TableFunctionRef;
 class OperatorExtension;
+class MultiFileStatisticsProvider;
 class StorageExtension;
 class ExtensionCallback;
 class SecretManager;
@@ -124,6 +126,12 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! Whether or not to checkpoint from a background thread instead of when committing
+	bool background_checkpoint = false;
+	//! Interval in seconds at which the background checkpointer checkpoints committed changes (0: only on WAL size)
+	idx_t checkpoint_interval = 0;
+	//! Whether or not commits wait for the WAL to be synced to disk
+	bool synchronous_commit = true;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -148,6 +156,10 @@ struct DBConfigOptions {
 	idx_t maximum_memory = DConstants::INVALID_INDEX;
 	//! The maximum size of the 'temp_directory' folder when set (in bytes). Default: 90% of available disk space.
 	idx_t maximum_swap_space = DConstants::INVALID_INDEX;
+	//! Whether to compress blocks that are written to the temporary directory
+	bool temp_file_compression = false;
+	//! Whether to encrypt blocks that are written to the temporary directory with an ephemeral key
+	bool temp_file_encryption = false;
 	//! The maximum amount of CPU threads used by the database system. Default: all available.
 	idx_t maximum_threads = DConstants::INVALID_INDEX;
 	//! The number of external threads that work on DuckDB tasks. Default: 1.
@@ -162,6 +174,12 @@ struct DBConfigOptions {
 	bool trim_free_blocks = false;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool buffer_manager_track_eviction_timestamps = false;
+	//! The policy used to evict persistent blocks from the buffer pool
+	BufferEvictionPolicy buffer_eviction_policy = BufferEvictionPolicy::LRU;
+	//! Whether to allocate blocks from an arena that is backed by transparent huge pages
+	bool buffer_pool_huge_pages = false;
+	//! Whether to pre-fault the memory of the block arena when the database starts
+	bool buffer_pool_prefault = false;
 	//! Whether or not to allow printing unredacted secrets
 	bool allow_unredacted_secrets = false;
 	//! The collation type of the database
@@ -174,6 +192,20 @@ struct DBConfigOptions {
 	bool enable_external_access = true;
 	//! Whether or not object cache is used
 	bool object_cache_enable = false;
+	//! Whether the actual cardinalities of profiled table scans and hash join build sides are recorded and reused
+	bool enable_cardinality_feedback = false;
+	//! Whether the results of sniffing CSV files are cached across queries
+	bool enable_csv_sniffer_cache = false;
+	//! The maximum memory used to cache hash join build sides across queries (in bytes). Default: 0 (disabled)
+	idx_t hash_join_build_cache_size = 0;
+	//! The maximum number of optimized plans of SELECT statements cached across connections. Default: 0 (disabled)
+	idx_t plan_cache_size = 0;
+	//! Queries whose operators are all estimated to produce at most this many rows are executed on the calling
+	//! thread only, without handing their tasks to the scheduler's threads. Default: 0 (disabled)
+	idx_t inline_execution_threshold = 0;
+	//! The number of rows table scans of local database files prefetch ahead of the rows being scanned, in coalesced
+	//! reads. Default: 0 (disabled - remote files are always prefetched one vector ahead)
+	idx_t scan_read_ahead_rows = 0;
 	//! Whether or not the global http metadata cache is used
 	bool http_metadata_cache_enable = false;
 	//! HTTP Proxy config as 'hostname:port'
@@ -199,6 +231,12 @@ struct DBConfigOptions {
 	CompressionType force_compression = CompressionType::COMPRESSION_AUTO;
 	//! Force a specific bitpacking mode to be used when using the bitpacking compression method
 	BitpackingMode force_bitpacking_mode = BitpackingMode::AUTO;
+	//! Whether scans map the strings of dictionary-compressed segments to one dictionary per column
+	bool global_string_dictionary = false;
+	//! Whether or not statistics are stored for every vector of the column segments that are written
+	bool enable_vector_zonemaps = true;
+	//! Whether or not Bloom filters are built for the columns of row groups that are written
+	bool enable_row_group_bloom_filters = false;
 	//! Debug setting for window aggregation mode: (window, combine, separate)
 	WindowAggregationMode window_mode = WindowAggregationMode::WINDOW;
 	//! Whether or not preserving insertion order should be preserved
@@ -319,6 +357,8 @@ public:
 	shared_ptr<BufferManager> buffer_manager;
 	//! Set of callbacks that can be installed by extensions
 	vector<unique_ptr<ExtensionCallback>> extension_callbacks;
+	//! Sources of file statistics, which are used to skip files of multi-file scans before they are opened
+	vector<unique_ptr<MultiFileStatisticsProvider>> file_statistics_providers;
 	//! Encryption Util for OpenSSL
 	shared_ptr<EncryptionUtil> encryption_util;
 
@@ -42,6 +42,10 @@ public:
 	DUCKDB_API PendingExecutionResult CheckPulse();
 	//! Halt execution of the thread until a Task is ready to be executed (use with caution)
 	void WaitForTask();
+	//! Sets a callback that is invoked (from any thread) when ExecuteTask can be called again without blocking,
+	//! e.g. because the result is ready or an error occurred. The query is executed by the background threads in the
+	//! meantime. The callback must not call back into DuckDB
+	DUCKDB_API void SetReadyCallback(std::function<void()> callback);
 
 	//! Returns the result of the query as an actual query result.
 	//! This returns (mostly) instantly if ExecuteTask has been called until RESULT_READY was returned.
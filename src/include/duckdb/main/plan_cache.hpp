@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/plan_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/planner/expression/bound_parameter_data.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+class ClientContext;
+class DataTable;
+class DatabaseInstance;
+struct PreparedStatementData;
+class SQLStatement;
+
+//! A cached plan, together with the statistics versions of the tables it scans at the time it was planned
+struct PlanCacheEntry {
+	shared_ptr<PreparedStatementData> prepared;
+	vector<pair<reference<DataTable>, idx_t>> statistics_versions;
+	//! When the entry was last used, for LRU eviction
+	idx_t last_used = 0;
+};
+
+//! The PlanCache holds the optimized physical plans of SELECT statements, shared by all connections to the database.
+//! Plans are keyed by the normalized statement, the types of the parameters and the search path of the connection.
+//! A cached plan is re-planned when the catalog changes or when the statistics of a table it scans change, as the
+//! optimizer prunes filters and chooses join orders based on them. Since the state of a query is partially stored in
+//! its plan, a cached plan is only handed to one query at a time.
+class PlanCache : public ObjectCacheEntry {
+public:
+	~PlanCache() override = default;
+
+	static PlanCache &Get(ClientContext &context);
+	static PlanCache &Get(DatabaseInstance &db);
+
+	//! Returns the key under which the plan of the statement is cached - or an empty string if the statement cannot
+	//! be cached for the given client
+	string GetKey(ClientContext &context, SQLStatement &statement,
+	              optional_ptr<case_insensitive_map_t<BoundParameterData>> parameters);
+	//! Looks up an idle plan that is still valid - returns nullptr if there is none
+	shared_ptr<PreparedStatementData> Lookup(ClientContext &context, const string &key,
+	                                         optional_ptr<case_insensitive_map_t<BoundParameterData>> parameters);
+	//! Adds a plan to the cache if it can be shared, evicting other entries to keep at most maximum_entries plans
+	void Insert(const string &key, shared_ptr<PreparedStatementData> prepared, idx_t maximum_entries);
+	//! Evicts (least recently used) entries until the cache holds at most maximum_entries plans
+	void Evict(idx_t maximum_entries);
+	//! The amount of cached plans
+	idx_t Count();
+
+	static string ObjectType() {
+		return "PLAN_CACHE";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	void EvictInternal(idx_t maximum_entries);
+	static bool StatisticsChanged(const vector<pair<reference<DataTable>, idx_t>> &statistics_versions);
+
+private:
+	mutex lock;
+	//! Key -> cached plan
+	unordered_map<string, PlanCacheEntry> entries;
+	//! Incremented on every access
+	idx_t current_timestamp = 0;
+};
+
+} // namespace duckdb
@@ -17,7 +17,9 @@
 
 namespace duckdb {
 class ClientContext;
+class ColumnDataCollection;
 class PreparedStatementData;
+class SQLStatement;
 
 //! A prepared statement
 class PreparedStatement {
@@ -85,6 +87,11 @@ public:
 	DUCKDB_API unique_ptr<QueryResult> Execute(case_insensitive_map_t<BoundParameterData> &named_values,
 	                                           bool allow_stream_result = true);
 
+	//! Execute the prepared statement once for every row of the parameter collection, with one column per
+	//! parameter. An INSERT of a single VALUES row is executed as one INSERT that scans the parameters, other
+	//! statements are executed row-by-row. Returns the result of the last execution
+	DUCKDB_API unique_ptr<QueryResult> ExecuteBatch(shared_ptr<ColumnDataCollection> parameters);
+
 	//! Execute the prepared statement with the given set of arguments
 	template <typename... ARGS>
 	unique_ptr<QueryResult> Execute(ARGS... args) {
@@ -153,6 +160,8 @@ public:
 	}
 
 private:
+	unique_ptr<SQLStatement> CreateBatchStatement(shared_ptr<ColumnDataCollection> parameters);
+
 	unique_ptr<PendingQueryResult> PendingQueryRecursive(vector<Value> &values) {
 		return PendingQuery(values);
 	}
@@ -172,6 +181,10 @@ private:
 		values.push_back(Value::CreateValue<T>(value));
 		return ExecuteRecursive(values, args...);
 	}
+
+private:
+	//! The parameter map that positional values are bound through, kept between executions
+	case_insensitive_map_t<BoundParameterData> positional_values;
 };
 
 } // namespace duckdb
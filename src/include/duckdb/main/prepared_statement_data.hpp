@@ -51,7 +51,7 @@ public:
 	//! Whether or not the prepared statement data requires the query to rebound for the given parameters
 	bool RequireRebind(ClientContext &context, optional_ptr<case_insensitive_map_t<BoundParameterData>> values);
 	//! Bind a set of values to the prepared statement data
-	DUCKDB_API void Bind(case_insensitive_map_t<BoundParameterData> values);
+	DUCKDB_API void Bind(const case_insensitive_map_t<BoundParameterData> &values);
 	//! Get the expected SQL Type of the bound parameter
 	DUCKDB_API LogicalType GetType(const string &identifier);
 	//! Try to get the expected SQL Type of the bound parameter
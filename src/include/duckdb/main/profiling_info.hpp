@@ -50,6 +50,8 @@ public:
 public:
 	static profiler_settings_t DefaultSettings();
 	static profiler_settings_t DefaultOperatorSettings();
+	//! The metrics that are measured with hardware counters, these are not enabled by default
+	static profiler_settings_t HardwareCounterSettings();
 	static profiler_settings_t AllSettings();
 
 public:
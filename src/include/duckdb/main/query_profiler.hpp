@@ -12,6 +12,8 @@
 #include "duckdb/common/deque.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
 #include "duckdb/common/enums/explain_format.hpp"
+#include "duckdb/common/hardware_counter_profiler.hpp"
+#include "duckdb/common/io_profiler.hpp"
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/profiler.hpp"
 #include "duckdb/common/reference_map.hpp"
@@ -42,6 +44,11 @@ struct OperatorInformation {
 	double time;
 	idx_t elements_returned;
 	idx_t result_set_size;
+	hardware_counter_values_t hardware_counters {};
+	idx_t bytes_read = 0;
+	idx_t read_operations = 0;
+	//! The time spent in file reads, in seconds
+	double read_time = 0;
 	string name;
 
 	void AddTime(double n_time) {
@@ -55,6 +62,18 @@ struct OperatorInformation {
 	void AddResultSetSize(idx_t n_result_set_size) {
 		result_set_size += n_result_set_size;
 	}
+
+	void AddHardwareCounters(const HardwareCounterProfiler &counters) {
+		for (idx_t i = 0; i < HARDWARE_COUNTER_COUNT; i++) {
+			hardware_counters[i] += counters.Elapsed(static_cast<HardwareCounter>(i));
+		}
+	}
+
+	void AddIO(const IOStatistics &io) {
+		bytes_read += io.bytes_read;
+		read_operations += io.read_operations;
+		read_time += double(io.read_time) / 1e9;
+	}
 };
 
 //! The OperatorProfiler measures timings of individual operators
@@ -89,6 +108,16 @@ private:
 
 	//! The timer used to time the execution time of the individual Physical Operators
 	Profiler op;
+	//! Whether any of the hardware counter metrics is enabled
+	bool hardware_counters_enabled;
+	//! Whether the hardware counters are running for the active operator
+	bool hardware_counters_active;
+	//! The hardware counters of the individual Physical Operators
+	HardwareCounterProfiler hardware_counters;
+	//! Whether any of the I/O metrics is enabled
+	bool io_enabled;
+	//! The reads of the individual Physical Operators
+	IOProfiler io;
 	//! The stack of Physical Operators that are currently active
 	optional_ptr<const PhysicalOperator> active_operator;
 	//! A mapping of physical operators to recorded timings
@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_telemetry.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/io_profiler.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_idx.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+
+namespace duckdb {
+
+//! A snapshot of the resources used by the running query of a client
+struct QueryTelemetryInfo {
+	string query;
+	optional_idx query_id;
+	//! The wall clock time since the query started, in seconds
+	double elapsed_time = 0;
+	//! The time threads spent executing tasks of the query, in seconds
+	double cpu_time = 0;
+	idx_t temporary_bytes_written = 0;
+	idx_t local_bytes_read = 0;
+	idx_t remote_bytes_read = 0;
+	idx_t read_operations = 0;
+	//! The time spent in file reads, in seconds
+	double read_time = 0;
+	//! The number of reads per latency bucket (see IOProfiler)
+	vector<idx_t> read_latency_histogram;
+	idx_t buffer_hits = 0;
+	idx_t buffer_misses = 0;
+	idx_t prefetch_waste_bytes = 0;
+	idx_t active_threads = 0;
+};
+
+//! The QueryTelemetry keeps live counters of the resources used by the query a client is running, so they can be
+//! inspected from other connections while the query runs. The counters are updated by the threads that work on the
+//! query through the telemetry that is active on the thread (see ActiveScope).
+class QueryTelemetry {
+public:
+	QueryTelemetry();
+
+public:
+	void BeginQuery(const string &query, optional_idx query_id);
+	void EndQuery();
+
+	//! Returns a snapshot of the running query, or false if the client is not running a query
+	bool GetRunningQuery(QueryTelemetryInfo &result) const;
+
+	//! Called by threads that start and finish working on a task of the query
+	void StartTask();
+	void EndTask(int64_t task_time_ns);
+
+	void AddTemporaryBytesWritten(idx_t bytes) {
+		temporary_bytes_written += bytes;
+	}
+	//! The bytes the current (or last) query spilled to temporary files
+	idx_t GetTemporaryBytesWritten() const {
+		return temporary_bytes_written;
+	}
+	void AddRead(idx_t bytes, idx_t read_time, bool remote);
+	void AddBufferPin(bool hit) {
+		if (hit) {
+			buffer_hits++;
+		} else {
+			buffer_misses++;
+		}
+	}
+	void AddPrefetchWaste(idx_t bytes) {
+		prefetch_waste_bytes += bytes;
+	}
+
+	//! The telemetry that is active on the calling thread (if any)
+	DUCKDB_API static optional_ptr<QueryTelemetry> GetActive();
+
+	//! Makes a telemetry the active telemetry of the calling thread while in scope
+	class ActiveScope {
+	public:
+		explicit ActiveScope(optional_ptr<QueryTelemetry> telemetry);
+		~ActiveScope();
+
+	private:
+		optional_ptr<QueryTelemetry> previous;
+	};
+
+private:
+	//! Protects the query string, id and start time
+	mutable mutex lock;
+	bool running;
+	string query;
+	optional_idx query_id;
+	time_point<std::chrono::steady_clock> start_time;
+
+	atomic<int64_t> task_time_ns;
+	atomic<idx_t> temporary_bytes_written;
+	atomic<idx_t> local_bytes_read;
+	atomic<idx_t> remote_bytes_read;
+	atomic<idx_t> read_operations;
+	atomic<idx_t> read_time_ns;
+	atomic<idx_t> read_latency_histogram[IO_LATENCY_BUCKET_COUNT];
+	atomic<idx_t> buffer_hits;
+	atomic<idx_t> buffer_misses;
+	atomic<idx_t> prefetch_waste_bytes;
+	atomic<idx_t> active_threads;
+};
+
+} // namespace duckdb
@@ -33,4 +33,16 @@ protected:
 	static unique_ptr<BaseSecret> CreateHTTPSecretFromEnv(ClientContext &context, CreateSecretInput &input);
 };
 
+struct CreateEncryptionSecretFunctions {
+public:
+	//! Get the default secret types
+	static vector<SecretType> GetDefaultSecretTypes();
+	//! Get the default secret functions
+	static vector<CreateSecretFunction> GetDefaultSecretFunctions();
+
+protected:
+	//! Encryption secret CONFIG provider
+	static unique_ptr<BaseSecret> CreateEncryptionSecretFromConfig(ClientContext &context, CreateSecretInput &input);
+};
+
 } // namespace duckdb
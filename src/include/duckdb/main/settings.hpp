@@ -81,6 +81,27 @@ struct CatalogErrorMaxSchema {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BackgroundCheckpointSetting {
+	static constexpr const char *Name = "background_checkpoint";
+	static constexpr const char *Description =
+	    "Whether or not to checkpoint from a background thread, instead of in the committing transaction";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct CheckpointIntervalSetting {
+	static constexpr const char *Name = "checkpoint_interval";
+	static constexpr const char *Description =
+	    "The interval in seconds at which the background checkpointer checkpoints committed changes (0 to only "
+	    "checkpoint when the WAL exceeds the checkpoint threshold)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct CheckpointThresholdSetting {
 	static constexpr const char *Name = "checkpoint_threshold";
 	static constexpr const char *Description =
@@ -91,6 +112,17 @@ struct CheckpointThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct CompressedMaterializationDictionaryThreshold {
+	static constexpr const char *Name = "compressed_materialization_dictionary_threshold";
+	static constexpr const char *Description =
+	    "The maximum estimated amount of distinct strings for which compressed materialization replaces a string "
+	    "column with dictionary codes (0 to disable)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DebugCheckpointAbort {
 	static constexpr const char *Name = "debug_checkpoint_abort";
 	static constexpr const char *Description =
@@ -348,6 +380,60 @@ struct EnableObjectCacheSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableCardinalityFeedbackSetting {
+	static constexpr const char *Name = "enable_cardinality_feedback";
+	static constexpr const char *Description =
+	    "Whether the actual cardinalities of the filtered table scans of profiled queries and the actual sizes of hash "
+	    "join build sides are recorded and used to estimate them again";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct EnableCSVSnifferCacheSetting {
+	static constexpr const char *Name = "enable_csv_sniffer_cache";
+	static constexpr const char *Description =
+	    "Whether the results of sniffing CSV files are cached across queries, keyed on the path, size and last "
+	    "modification time of the file";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct HashJoinBuildCacheSize {
+	static constexpr const char *Name = "hash_join_build_cache_size";
+	static constexpr const char *Description =
+	    "The maximum memory used to cache hash join build sides across queries (e.g. 1GB), 0 disables the cache";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct ScanReadAheadRowsSetting {
+	static constexpr const char *Name = "scan_read_ahead_rows";
+	static constexpr const char *Description =
+	    "The number of rows table scans read ahead of the rows being scanned in coalesced block reads, 0 disables "
+	    "read-ahead for local database files";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct InlineExecutionThreshold {
+	static constexpr const char *Name = "inline_execution_threshold";
+	static constexpr const char *Description =
+	    "Queries whose operators are all estimated to produce at most this many rows run on the calling thread "
+	    "only, 0 disables this";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct StorageCompatibilityVersion {
 	static constexpr const char *Name = "storage_compatibility_version";
 	static constexpr const char *Description = "Serialize on checkpoint with compatibility for a given duckdb version";
@@ -405,6 +491,29 @@ struct EnableProgressBarPrintSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableRowGroupBloomFiltersSetting {
+	static constexpr const char *Name = "enable_row_group_bloom_filters";
+	static constexpr const char *Description =
+	    "Whether or not a Bloom filter is built for every integer and string column of a row group when checkpointing, "
+	    "so that equality and IN filters can skip row groups (only written when using storage version v1.2.0 or "
+	    "higher)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct EnableVectorZonemapsSetting {
+	static constexpr const char *Name = "enable_vector_zonemaps";
+	static constexpr const char *Description =
+	    "Whether or not statistics of every 2048 rows are stored with column segments, so that scans can skip "
+	    "individual vectors (only written when using storage version v1.2.0 or higher)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ErrorsAsJsonSetting {
 	static constexpr const char *Name = "errors_as_json";
 	static constexpr const char *Description = "Output error messages as structured JSON instead of as a raw string";
@@ -414,6 +523,17 @@ struct ErrorsAsJsonSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ExecutionTraceOutputSetting {
+	static constexpr const char *Name = "execution_trace_output";
+	static constexpr const char *Description =
+	    "The file to write a timeline of the task execution of every query to, in the Chrome trace event format "
+	    "(empty = disabled)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ExplainOutputSetting {
 	static constexpr const char *Name = "explain_output";
 	static constexpr const char *Description = "Output of EXPLAIN statements (ALL, OPTIMIZED_ONLY, PHYSICAL_ONLY)";
@@ -478,6 +598,17 @@ struct ForceBitpackingModeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct GlobalStringDictionarySetting {
+	static constexpr const char *Name = "global_string_dictionary";
+	static constexpr const char *Description =
+	    "Map the strings of dictionary-compressed segments to one dictionary per column when scanning, so that equal "
+	    "strings have the same dictionary code in all segments of the column";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct HomeDirectorySetting {
 	static constexpr const char *Name = "home_directory";
 	static constexpr const char *Description = "Sets the home directory used by the system";
@@ -593,6 +724,26 @@ struct StreamingBufferSize {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct QueryMemoryLimitSetting {
+	static constexpr const char *Name = "query_memory_limit";
+	static constexpr const char *Description =
+	    "The maximum memory a single query of this connection can reserve in the buffer pool (e.g. 1GB)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct SessionMemoryLimitSetting {
+	static constexpr const char *Name = "session_memory_limit";
+	static constexpr const char *Description =
+	    "The maximum memory this connection can reserve in the buffer pool across its queries (e.g. 1GB)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct MaximumTempDirectorySize {
 	static constexpr const char *Name = "max_temp_directory_size";
 	static constexpr const char *Description =
@@ -633,6 +784,17 @@ struct NestedLoopJoinThreshold {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct IndexJoinThreshold {
+	static constexpr const char *Name = "index_join_threshold";
+	static constexpr const char *Description =
+	    "The minimum ratio between the rows of an indexed table and the rows probing it to choose an index join (0 "
+	    "disables index joins)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct OldImplicitCasting {
 	static constexpr const char *Name = "old_implicit_casting";
 	static constexpr const char *Description = "Allow implicit casting to/from VARCHAR";
@@ -722,6 +884,17 @@ struct PerfectHashThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct PipelineChunkBudgetSetting {
+	static constexpr const char *Name = "pipeline_chunk_budget";
+	static constexpr const char *Description =
+	    "The memory a data chunk in a pipeline should span (e.g. 1MB): pipelines with wider rows process smaller "
+	    "chunks, 0 disables this";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct PivotFilterThreshold {
 	static constexpr const char *Name = "pivot_filter_threshold";
 	static constexpr const char *Description =
@@ -741,6 +914,17 @@ struct PivotLimitSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct PlanCacheSizeSetting {
+	static constexpr const char *Name = "plan_cache_size";
+	static constexpr const char *Description =
+	    "The maximum number of optimized plans of SELECT statements that are cached across connections, 0 disables "
+	    "the cache";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct PreserveIdentifierCase {
 	static constexpr const char *Name = "preserve_identifier_case";
 	static constexpr const char *Description =
@@ -822,6 +1006,17 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct QueryPrioritySetting {
+	static constexpr const char *Name = "query_priority";
+	static constexpr const char *Description =
+	    "The priority class of the queries of this connection (LOW, NORMAL, HIGH), which weighs their share of the "
+	    "threads";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ScalarSubqueryErrorOnMultipleRows {
 	static constexpr const char *Name = "scalar_subquery_error_on_multiple_rows";
 	static constexpr const char *Description =
@@ -861,6 +1056,17 @@ struct SecretDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct SynchronousCommitSetting {
+	static constexpr const char *Name = "synchronous_commit";
+	static constexpr const char *Description =
+	    "Whether or not commits wait for the WAL to be synced to disk. If disabled, commits are synced by a background "
+	    "thread shortly after they return, and a crash can lose the most recent commits";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct TempDirectorySetting {
 	static constexpr const char *Name = "temp_directory";
 	static constexpr const char *Description = "Set the directory to which to write temp files";
@@ -870,6 +1076,38 @@ struct TempDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "Compress blocks that are written to the temporary directory, if they compress well";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct TempFileEncryptionSetting {
+	static constexpr const char *Name = "temp_file_encryption";
+	static constexpr const char *Description =
+	    "Encrypt blocks that are written to the temporary directory with an ephemeral key. Takes effect when the "
+	    "temporary directory is first used";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct DirectIOSetting {
+	static constexpr const char *Name = "direct_io";
+	static constexpr const char *Description =
+	    "Bypass the operating system page cache when reading and writing database files attached and temporary files "
+	    "created from now on";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
@@ -917,6 +1155,36 @@ struct AllocatorBackgroundThreadsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BufferEvictionPolicySetting {
+	static constexpr const char *Name = "buffer_eviction_policy";
+	static constexpr const char *Description =
+	    "The policy used to evict persistent blocks from the buffer pool: LRU or TWO_QUEUE (scan-resistant)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct BufferPoolHugePagesSetting {
+	static constexpr const char *Name = "buffer_pool_huge_pages";
+	static constexpr const char *Description =
+	    "Allocate blocks from an arena of the size of the memory limit that is backed by transparent huge pages";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct BufferPoolPrefaultSetting {
+	static constexpr const char *Name = "buffer_pool_prefault";
+	static constexpr const char *Description =
+	    "Allocate blocks from an arena of the size of the memory limit that is pre-faulted when the database starts";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DuckDBApiSetting {
 	static constexpr const char *Name = "duckdb_api";
 	static constexpr const char *Description = "DuckDB API surface";
@@ -19,6 +19,7 @@ namespace duckdb {
 
 class ClientContext;
 class ClientContextLock;
+class ArrowArrayWrapper;
 class Executor;
 class MaterializedQueryResult;
 class PreparedStatementData;
@@ -46,6 +47,17 @@ public:
 	DUCKDB_API StreamExecutionResult ExecuteTask();
 	//! Fetches a DataChunk from the query result.
 	DUCKDB_API unique_ptr<DataChunk> FetchRaw() override;
+	//! Whether the result is converted to Arrow arrays while it is being produced
+	DUCKDB_API bool IsArrowStream() const;
+	//! Fetches the next Arrow array from a streaming Arrow result, returns nullptr if there are no more arrays
+	DUCKDB_API unique_ptr<ArrowArrayWrapper> FetchArrowArray();
+	//! Sets the maximum amount of memory (in bytes) that is buffered ahead of the consumer of this result, overriding
+	//! the 'streaming_buffer_size' setting. Less is buffered while the consumer is slower than the producers
+	DUCKDB_API void SetStreamingBufferSize(idx_t size);
+	//! The number of times the query was blocked because the buffer of the result was full
+	DUCKDB_API idx_t GetBlockedSinkCount() const;
+	//! The total time (in seconds) the query was blocked because the buffer of the result was full
+	DUCKDB_API double GetBlockedSinkTime() const;
 	//! Converts the QueryResult to a string
 	DUCKDB_API string ToString() override;
 	//! Materializes the query result and turns it into a materialized query result
@@ -62,6 +74,8 @@ public:
 private:
 	StreamExecutionResult ExecuteTaskInternal(ClientContextLock &lock);
 	unique_ptr<DataChunk> FetchInternal(ClientContextLock &lock);
+	unique_ptr<ArrowArrayWrapper> FetchArrowArrayInternal(ClientContextLock &lock);
+	void ProcessFetchError(ClientContextLock &lock, ErrorData error);
 	unique_ptr<ClientContextLock> LockContext();
 	void CheckExecutableInternal(ClientContextLock &lock);
 	bool IsOpenInternal(ClientContextLock &lock);
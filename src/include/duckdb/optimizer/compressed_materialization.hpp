@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/types.hpp"
 #include "duckdb/planner/column_binding_map.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
@@ -44,6 +45,8 @@ public:
 	LogicalType type;
 	bool needs_decompression;
 	unique_ptr<BaseStatistics> stats;
+	//! The dictionary the binding was compressed with (if any)
+	optional_idx dictionary_id;
 };
 
 struct CompressedMaterializationInfo {
@@ -58,6 +61,10 @@ public:
 	//! Operator child info
 	vector<idx_t> child_idxs;
 	vector<CMChildInfo> child_info;
+
+	//! Bindings whose order or equality across children must be preserved by compression (e.g., sort keys or join
+	//! keys), i.e., bindings that cannot be replaced by dictionary codes
+	column_binding_set_t order_preserving_bindings;
 };
 
 struct CompressExpression {
@@ -67,6 +74,8 @@ public:
 public:
 	unique_ptr<Expression> expression;
 	unique_ptr<BaseStatistics> stats;
+	//! The dictionary the expression compresses with (if any)
+	optional_idx dictionary_id;
 };
 
 typedef column_binding_map_t<unique_ptr<BaseStatistics>> statistics_map_t;
@@ -99,7 +108,8 @@ private:
 	//! Adds bindings referenced in expression to referenced_bindings
 	static void GetReferencedBindings(const Expression &expression, column_binding_set_t &referenced_bindings);
 	//! Updates CMBindingInfo in the binding_map in info
-	void UpdateBindingInfo(CompressedMaterializationInfo &info, const ColumnBinding &binding, bool needs_decompression);
+	void UpdateBindingInfo(CompressedMaterializationInfo &info, const ColumnBinding &binding, bool needs_decompression,
+	                       optional_idx dictionary_id);
 
 	//! Create (de)compress projections around the operator
 	void CreateProjections(unique_ptr<LogicalOperator> &op, CompressedMaterializationInfo &info);
@@ -112,10 +122,12 @@ private:
 
 	//! Create expressions that apply a scalar compression function
 	unique_ptr<CompressExpression> GetCompressExpression(const ColumnBinding &binding, const LogicalType &type,
-	                                                     const bool &can_compress);
+	                                                     const bool &can_compress, const bool &can_use_dictionary);
 	unique_ptr<CompressExpression> GetCompressExpression(unique_ptr<Expression> input, const BaseStatistics &stats);
 	unique_ptr<CompressExpression> GetIntegralCompress(unique_ptr<Expression> input, const BaseStatistics &stats);
 	unique_ptr<CompressExpression> GetStringCompress(unique_ptr<Expression> input, const BaseStatistics &stats);
+	unique_ptr<CompressExpression> GetStringDictionaryCompress(unique_ptr<Expression> input,
+	                                                           const BaseStatistics &stats);
 
 	//! Create an expression that applies a scalar decompression function
 	unique_ptr<Expression> GetDecompressExpression(unique_ptr<Expression> input, const LogicalType &result_type,
@@ -124,6 +136,7 @@ private:
 	                                             const BaseStatistics &stats);
 	unique_ptr<Expression> GetStringDecompress(unique_ptr<Expression> input, const LogicalType &result_type,
 	                                           const BaseStatistics &stats);
+	unique_ptr<Expression> GetStringDictionaryDecompress(unique_ptr<Expression> input, idx_t dictionary_id);
 
 private:
 	Optimizer &optimizer;
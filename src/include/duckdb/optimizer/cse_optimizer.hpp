@@ -14,18 +14,23 @@
 
 namespace duckdb {
 class Binder;
+class Optimizer;
 struct CSEReplacementState;
 
 //! The CommonSubExpression optimizer traverses the expressions of a LogicalOperator to look for duplicate expressions
 //! if there are any, it pushes a projection under the operator that resolves these expressions
+//! Expensive expressions that a projection shares with the filter below it are computed once in a projection under
+//! the filter
 class CommonSubExpressionOptimizer : public LogicalOperatorVisitor {
 public:
-	explicit CommonSubExpressionOptimizer(Binder &binder) : binder(binder) {
-	}
+	explicit CommonSubExpressionOptimizer(Optimizer &optimizer);
 
 public:
 	void VisitOperator(LogicalOperator &op) override;
 
+	//! Only expressions with at least this cost (according to the ExpressionHeuristics) are shared with a filter
+	static constexpr const idx_t EXPENSIVE_EXPRESSION_COST = 200;
+
 private:
 	//! First iteration: count how many times each expression occurs
 	void CountExpressions(Expression &expr, CSEReplacementState &state);
@@ -35,7 +40,13 @@ private:
 	//! Main method to extract common subexpressions
 	void ExtractCommonSubExpresions(LogicalOperator &op);
 
+	//! Collect the expensive subexpressions that a filter evaluates for every row
+	void CollectFilterExpressions(Expression &expr, expression_set_t &result);
+	//! Compute the expensive expressions that a projection shares with the filter below it under the filter
+	void ExtractFilterSubExpressions(LogicalOperator &op);
+
 private:
+	Optimizer &optimizer;
 	Binder &binder;
 };
 } // namespace duckdb
@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/eager_aggregate_optimizer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+class Optimizer;
+class LogicalAggregate;
+
+//! The aggregates that combine partial aggregates
+struct CombinedAggregates {
+	//! The combining aggregates
+	vector<unique_ptr<Expression>> aggregates;
+	//! The types of the original aggregates
+	vector<LogicalType> original_types;
+	//! Whether the original aggregate is a count
+	vector<bool> is_count;
+};
+
+//! The EagerAggregateOptimizer computes aggregates from partial aggregates over a smaller input:
+//! (1) It pushes a partial aggregate below an inner join when all aggregates are computed over one side of the join,
+//! and (according to the statistics) grouping that side on its join keys and group columns greatly reduces its
+//! cardinality.
+//! (2) It computes the grouping sets of an aggregate (e.g., a ROLLUP) from a partial aggregate over all groups,
+//! instead of aggregating the full input for every grouping set.
+//! The aggregate on top then combines the partial aggregates
+class EagerAggregateOptimizer {
+public:
+	explicit EagerAggregateOptimizer(Optimizer &optimizer);
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+	//! The partial aggregate is only pushed down if it reduces the cardinality of its input by at least this factor
+	static constexpr const idx_t MINIMUM_REDUCTION = 4;
+
+private:
+	unique_ptr<LogicalOperator> OptimizeInternal(unique_ptr<LogicalOperator> op);
+	unique_ptr<LogicalOperator> TryPushdown(unique_ptr<LogicalOperator> op);
+	unique_ptr<LogicalOperator> TryPreaggregateGroupingSets(unique_ptr<LogicalOperator> op);
+	//! Bind the aggregates that combine the partial aggregates, which are produced at "partial_aggregate_index"
+	static bool BindCombineAggregates(ClientContext &context, const vector<unique_ptr<Expression>> &partial_aggregates,
+	                                  const vector<string> &combine_names, idx_t partial_aggregate_index,
+	                                  CombinedAggregates &result);
+	//! Restore the types of the combined aggregates of "op" (e.g., a sum of counts) in a projection, if required
+	unique_ptr<LogicalOperator> FinalizeCombinedAggregates(unique_ptr<LogicalOperator> op,
+	                                                       const CombinedAggregates &combined);
+	//! Estimate the amount of distinct values of a binding that is produced by "op", returns false if unknown
+	bool GetDistinctCount(LogicalOperator &op, const ColumnBinding &binding, idx_t &result);
+
+private:
+	Optimizer &optimizer;
+	//! Replaces references to aggregates that are now produced by a projection on top of the aggregate
+	ColumnBindingReplacer replacer;
+};
+
+} // namespace duckdb
@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_elimination.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+class LogicalComparisonJoin;
+class LogicalGet;
+
+//! The JoinElimination optimizer removes joins that do not change the result of a query, based on the declared
+//! PRIMARY KEY, UNIQUE and FOREIGN KEY constraints of the joined tables and on the uniqueness of derived relations
+//! (e.g., the groups of an aggregate):
+//! (1) An inner join between a foreign key and the key it references is replaced by a NOT NULL filter on the foreign
+//! key, if no other columns of the referenced table are used.
+//! (2) A self-join of a table on a unique key is replaced by a single scan of the table.
+//! (3) A left join with a side that is unique on the join keys is removed, if no columns of that side are used.
+//! (4) An inner join with a side that is unique on the join keys is converted into a semi join, if no columns of that
+//! side are used.
+class JoinElimination {
+public:
+	JoinElimination();
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	void OptimizeInternal(unique_ptr<LogicalOperator> &op);
+	bool TryEliminateForeignKeyJoin(unique_ptr<LogicalOperator> &op, idx_t primary_side);
+	bool TryEliminateSelfJoin(unique_ptr<LogicalOperator> &op);
+	bool TryEliminateUniqueJoin(unique_ptr<LogicalOperator> &op, idx_t unique_side);
+
+	//! Counts the references to every column binding in the plan
+	void CollectReferences();
+	void CollectReferences(LogicalOperator &op);
+	//! Whether any column of "bindings" is used outside of the conditions of "join"
+	bool IsReferenced(LogicalComparisonJoin &join, const vector<ColumnBinding> &bindings);
+	//! Replace the bindings of an eliminated relation in the plan, and count the references again
+	void UpdatePlan(vector<ReplacementBinding> replacement_bindings);
+
+	//! Whether the rows of "op" are unique on the given bindings
+	static bool IsUnique(LogicalOperator &op, const column_binding_set_t &bindings, idx_t depth = 0);
+	//! Find the scan of a base table that produces a binding of "op", only passing through operators that forward the
+	//! values of a row unchanged. Returns nullptr if there is none
+	static optional_ptr<LogicalGet> TraceBinding(LogicalOperator &op, const ColumnBinding &binding,
+	                                             column_t &column_id);
+
+private:
+	//! The plan that is being optimized
+	unique_ptr<LogicalOperator> plan;
+	//! The amount of expressions that reference a column binding
+	column_binding_map_t<idx_t> references;
+	//! The column bindings that are consumed by their position (e.g., by a set operation), which cannot be removed
+	column_binding_set_t positional_references;
+};
+
+} // namespace duckdb
@@ -12,10 +12,12 @@
 #include "duckdb/planner/column_binding_map.hpp"
 
 namespace duckdb {
+class LogicalGet;
 class Optimizer;
 
 //! The JoinFilterPushdownOptimizer links comparison joins to data sources to enable dynamic execution-time filter
-//! pushdown
+//! pushdown. Filters are transferred through the join graph of the probe side, so they reach every scan whose rows are
+//! joined on the probe column - not only the scan the probe column originates from.
 class JoinFilterPushdownOptimizer : public LogicalOperatorVisitor {
 public:
 	explicit JoinFilterPushdownOptimizer(Optimizer &optimizer);
@@ -23,7 +25,23 @@ public:
 	void VisitOperator(LogicalOperator &op) override;
 
 private:
+	//! The join graph of the probe side of a join: groups of column bindings that hold the same value in every row
+	struct ProbeJoinGraph {
+		column_binding_map_t<ColumnBinding> parents;
+
+		ColumnBinding Find(const ColumnBinding &binding);
+		void Union(const ColumnBinding &left, const ColumnBinding &right);
+	};
+	//! A scan on the probe side of a join
+	struct ProbeScan {
+		reference<LogicalGet> get;
+		//! Whether the scan is on the build side of a join on the probe side
+		bool in_build_side;
+	};
+
 	void GenerateJoinFilters(LogicalComparisonJoin &join);
+	static void CollectProbeScans(LogicalOperator &op, bool in_build_side, ProbeJoinGraph &graph,
+	                              vector<ProbeScan> &scans);
 
 private:
 	Optimizer &optimizer;
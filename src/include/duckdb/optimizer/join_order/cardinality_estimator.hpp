@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include "duckdb/common/reference_map.hpp"
 #include "duckdb/planner/column_binding_map.hpp"
 #include "duckdb/optimizer/join_order/query_graph.hpp"
 
@@ -94,6 +95,8 @@ public:
 private:
 	vector<RelationsToTDom> relations_to_tdoms;
 	unordered_map<string, CardinalityHelper> relation_set_2_cardinality;
+	//! Memoized estimates of join relation sets, the plan enumerator estimates the same sets many times
+	reference_map_t<JoinRelationSet, double> estimated_cardinalities;
 	JoinRelationSetManager set_manager;
 	vector<RelationStats> relation_stats;
 
@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_order/cardinality_feedback.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+class ClientContext;
+class ConjunctionFilter;
+class LogicalComparisonJoin;
+class LogicalOperator;
+class QueryProfiler;
+class TableCatalogEntry;
+class TableFilter;
+class TableFilterSet;
+
+//! The cardinalities observed for a filtered scan of a table
+struct CardinalityFeedbackEntry {
+	//! The estimated cardinality of the scan
+	idx_t estimated_cardinality = 0;
+	//! The actual cardinality of the scan
+	idx_t actual_cardinality = 0;
+	//! The cardinality of the table when the scan was executed
+	idx_t table_cardinality = 0;
+};
+
+//! The CardinalityFeedback stores the actual cardinalities of the filtered table scans of executed queries, keyed by
+//! the table and the shape of the filters (i.e. ignoring the constants they compare with). The join order optimizer
+//! uses the observed selectivity instead of its own estimate when a table is scanned with filters of the same shape
+//! again. Cardinalities are collected from queries that are profiled, and only when enable_cardinality_feedback is set.
+//! It also stores the actual sizes of hash join build sides, which are recorded when the build finishes, keyed by the
+//! logical plan that produced them. The BuildProbeSideOptimizer uses them instead of the estimated cardinalities.
+class CardinalityFeedback : public ObjectCacheEntry {
+public:
+	~CardinalityFeedback() override = default;
+
+	static CardinalityFeedback &Get(ClientContext &context);
+
+	//! Returns the key of a scan of the table with the given filters - or an empty string if the filters depend on
+	//! information that is only available during execution
+	static string GetKey(TableCatalogEntry &table, const TableFilterSet &filters);
+	//! Records the actual cardinalities of the table scans of a finished query that was profiled
+	static void RecordQuery(ClientContext &context, QueryProfiler &profiler);
+	//! Returns the key of the result of a logical plan - or an empty string if the plan has operators that are not
+	//! supported. Flipping the children of a join does not change the key.
+	static string GetPlanKey(LogicalOperator &op);
+
+	void Record(const string &key, const CardinalityFeedbackEntry &entry);
+	//! Returns the observed selectivity of the filters of a scan - or false if the scan was not observed yet
+	bool TryGetSelectivity(const string &key, double &selectivity);
+	//! The amount of recorded scans
+	idx_t Count();
+
+	//! Records the actual size of a hash join build side that was produced by the plan with the given key
+	void RecordBuild(const string &key, idx_t cardinality);
+	//! Returns the size of the build side that was observed for the plan - or false if it was not observed yet
+	bool TryGetBuildCardinality(const string &key, idx_t &cardinality);
+
+	static string ObjectType() {
+		return "CARDINALITY_FEEDBACK";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	static bool GetFilterShape(const TableFilter &filter, string &result);
+	static bool GetConjunctionShape(const ConjunctionFilter &filter, const string &separator, string &result);
+	static bool GetPlanShape(LogicalOperator &op, string &result);
+	static bool GetJoinShape(LogicalComparisonJoin &join, string &result);
+
+private:
+	mutex lock;
+	//! Key -> the last observed cardinalities
+	unordered_map<string, CardinalityFeedbackEntry> entries;
+	//! Plan key -> the last observed size of a build side
+	unordered_map<string, idx_t> build_cardinalities;
+};
+
+} // namespace duckdb
@@ -28,6 +28,8 @@ public:
 
 	//! Compute cost of a join relation set
 	double ComputeCost(DPJoinNode &left, DPJoinNode &right);
+	//! Compute cost of joining two plans with the given costs into the combined set
+	double ComputeCost(JoinRelationSet &combination, double left_cost, double right_cost);
 
 	//! Cardinality Estimator used to calculate cost
 	CardinalityEstimator cardinality_estimator;
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/limits.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/unordered_set.hpp"
 #include "duckdb/optimizer/join_order/join_relation.hpp"
@@ -50,16 +51,19 @@ private:
 	CostModel &cost_model;
 	//! A map to store the optimal join plan found for a specific JoinRelationSet*
 	reference_map_t<JoinRelationSet, unique_ptr<DPJoinNode>> plans;
+	//! Upper bound on the cost of the optimal plan - (sub-)plans that are more expensive are not added to the DP table
+	double cost_bound = NumericLimits<double>::Maximum();
 
 	unordered_set<string> join_nodes_in_full_plan;
 
 	unique_ptr<DPJoinNode> CreateJoinTree(JoinRelationSet &set,
 	                                      const vector<reference<NeighborInfo>> &possible_connections, DPJoinNode &left,
-	                                      DPJoinNode &right);
+	                                      DPJoinNode &right, double cost);
 
 	//! Emit a pair as a potential join candidate. Returns the best plan found for the (left, right) connection (either
-	//! the newly created plan, or an existing plan)
-	DPJoinNode &EmitPair(JoinRelationSet &left, JoinRelationSet &right, const vector<reference<NeighborInfo>> &info);
+	//! the newly created plan, or an existing plan), or nullptr if the plan exceeds the cost bound
+	optional_ptr<DPJoinNode> EmitPair(JoinRelationSet &left, JoinRelationSet &right,
+	                                  const vector<reference<NeighborInfo>> &info);
 	//! Tries to emit a potential join candidate pair. Returns false if too many pairs have already been emitted,
 	//! cancelling the dynamic programming step.
 	bool TryEmitPair(JoinRelationSet &left, JoinRelationSet &right, const vector<reference<NeighborInfo>> &info);
@@ -77,6 +81,13 @@ private:
 	bool SolveJoinOrderExactly();
 	//! Solve the join order approximately using a greedy algorithm
 	void SolveJoinOrderApproximately();
+	//! Compute the cost of the join order chosen by the greedy algorithm, without modifying the DP table. Returns the
+	//! maximum double if the greedy algorithm requires a cross product.
+	double ComputeGreedyCostBound();
+	//! Improve the plan of the given set with dynamic programming over all consecutive ranges of its leaves
+	void SolveJoinOrderLinearized(JoinRelationSet &set);
+	//! Collect the relations in the plan of the given set, from left to right
+	void CollectLeafOrder(JoinRelationSet &set, vector<idx_t> &order);
 };
 
 } // namespace duckdb
@@ -0,0 +1,26 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/sampling_pushdown.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+class LogicalOperator;
+
+//! The SamplingPushdown pushes a system sample on top of a scan into the table function, which then skips the blocks
+//! of rows that are not part of the sample instead of reading them
+class SamplingPushdown {
+public:
+	//! Optimize SYSTEM SAMPLE + GET to GET with a pushed down sample
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+	//! Whether we can perform the optimization on this operator
+	static bool CanOptimize(LogicalOperator &op);
+};
+
+} // namespace duckdb
@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/parallel/execution_tracer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/common/pair.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+#include <thread>
+
+namespace duckdb {
+
+struct ExecutionTraceEvent {
+	string name;
+	const char *category;
+	//! 'X' for an event with a duration, 'i' for an instant event
+	char phase;
+	//! The thread that recorded the event
+	idx_t thread;
+	//! The start and duration of the event, in microseconds since the tracer was created
+	int64_t start;
+	int64_t duration;
+	//! An optional status of the event (e.g. the result of a task)
+	const char *status;
+	vector<pair<const char *, int64_t>> args;
+};
+
+//! The ExecutionTracer records a timeline of the execution of a query: when every task ran and on which thread, how
+//! long it waited to be scheduled and how long it was blocked, when events finished and when the buffer manager had to
+//! evict blocks. The timeline is written in the Chrome trace event format, and can be viewed with chrome://tracing or
+//! Perfetto.
+class ExecutionTracer {
+public:
+	explicit ExecutionTracer(string output_path);
+
+public:
+	//! The current time in microseconds since the tracer was created
+	int64_t Now() const;
+
+	//! Records an event with a duration that ran on the calling thread
+	void AddEvent(string name, const char *category, int64_t start, int64_t end, const char *status = nullptr,
+	              vector<pair<const char *, int64_t>> args = {});
+	//! Records an instant event on the calling thread
+	void AddInstantEvent(string name, const char *category, vector<pair<const char *, int64_t>> args = {});
+
+	//! Writes the recorded events to the output file in the Chrome trace event format
+	void WriteToFile() const;
+	string ToJSON() const;
+
+	//! The tracer that is active on the calling thread (if any)
+	static optional_ptr<ExecutionTracer> GetActive();
+
+	//! Makes a tracer the active tracer of the calling thread while in scope
+	class ActiveScope {
+	public:
+		explicit ActiveScope(optional_ptr<ExecutionTracer> tracer);
+		~ActiveScope();
+
+	private:
+		optional_ptr<ExecutionTracer> previous;
+	};
+
+private:
+	idx_t GetThreadIndex(lock_guard<mutex> &guard);
+
+private:
+	//! The file the trace is written to
+	string output_path;
+	time_point<std::chrono::steady_clock> start_time;
+	mutable mutex lock;
+	vector<ExecutionTraceEvent> events;
+	//! Maps the threads that recorded events to small consecutive thread indexes
+	unordered_map<std::thread::id, idx_t> thread_indexes;
+};
+
+} // namespace duckdb
@@ -10,6 +10,7 @@
 
 #include "duckdb/parallel/task.hpp"
 #include "duckdb/parallel/event.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/optional_ptr.hpp"
 
 namespace duckdb {
@@ -37,6 +38,17 @@ public:
 public:
 	virtual TaskExecutionResult ExecuteTask(TaskExecutionMode mode) = 0;
 	TaskExecutionResult Execute(TaskExecutionMode mode) override;
+	//! The name of the task in the execution trace
+	virtual string TaskType() const;
+
+private:
+	TaskExecutionResult ExecuteInternal(TaskExecutionMode mode);
+
+private:
+	//! When the task last became ready to run and when it was last blocked (-1 if it is not blocked), in the time of
+	//! the execution tracer. Only maintained while the execution is traced
+	atomic<int64_t> trace_ready_time {0};
+	atomic<int64_t> trace_blocked_time {-1};
 };
 
 } // namespace duckdb
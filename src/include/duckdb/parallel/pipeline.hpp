@@ -40,6 +40,7 @@ public:
 
 public:
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override;
+	string TaskType() const override;
 };
 
 class PipelineBuildState {
@@ -74,6 +75,10 @@ class Pipeline : public enable_shared_from_this<Pipeline> {
 	friend class PipelineBuildState;
 	friend class MetaPipeline;
 
+public:
+	//! The minimum number of rows the chunks that are pushed through a pipeline hold
+	static constexpr const idx_t MIN_CHUNK_CAPACITY = 1024;
+
 public:
 	explicit Pipeline(Executor &execution_context);
 
@@ -114,6 +119,10 @@ public:
 	//! Returns whether any of the operators in the pipeline care about preserving order
 	bool IsOrderDependent() const;
 
+	//! Returns the maximum number of rows of the chunks that are pushed through this pipeline, which depends on the
+	//! width of the rows the operators of the pipeline produce
+	idx_t GetChunkCapacity();
+
 	//! Registers a new batch index for a pipeline executor - returns the current minimum batch index
 	idx_t RegisterNewBatchIndex();
 
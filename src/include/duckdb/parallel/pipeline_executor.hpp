@@ -84,6 +84,16 @@ private:
 	//! The final chunk used for moving data into the sink
 	DataChunk final_chunk;
 
+	//! The maximum number of rows of the chunks that are pushed through the pipeline
+	idx_t chunk_capacity;
+	//! If the chunk capacity is smaller than STANDARD_VECTOR_SIZE, the chunk fetched from the source, which is pushed
+	//! through the pipeline in slices of at most chunk_capacity rows
+	DataChunk source_buffer;
+	//! The offset of the next slice of the source_buffer
+	idx_t source_buffer_offset = 0;
+	//! The result of the source when the source_buffer was fetched
+	SourceResultType source_buffer_result = SourceResultType::FINISHED;
+
 	//! The operators that are not yet finished executing and have data remaining
 	//! If the stack of in_process_operators is empty, we fetch from the source instead
 	stack<idx_t> in_process_operators;
@@ -120,6 +130,9 @@ private:
 	//! Reset the operator index to the first operator
 	void GoToSource(idx_t &current_idx, idx_t initial_idx);
 	SourceResultType FetchFromSource(DataChunk &result);
+	//! Fetches the next slice of at most chunk_capacity rows, and fetches from the source once all slices of the
+	//! source_buffer are done
+	SourceResultType FetchSliceFromSource(DataChunk &result);
 
 	void FinishProcessing(int32_t operator_idx = -1);
 	bool IsFinished();
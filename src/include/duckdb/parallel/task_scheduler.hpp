@@ -10,7 +10,10 @@
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/enums/query_priority.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
 
@@ -24,13 +27,48 @@ class TaskScheduler;
 
 struct SchedulerThread;
 
+//! The scheduling state of a producer (i.e. of a query), shared with the threads that execute its tasks
+struct ProducerState {
+	ProducerState(QueryPriority priority, optional_idx query_id);
+
+	//! The weights of the priority classes: under contention, the threads are shared between the producers with
+	//! queued tasks in proportion to their weight
+	static constexpr const idx_t LOW_PRIORITY_WEIGHT = 1;
+	static constexpr const idx_t NORMAL_PRIORITY_WEIGHT = 4;
+	static constexpr const idx_t HIGH_PRIORITY_WEIGHT = 16;
+
+	const QueryPriority priority;
+	//! The query that created the producer (if any)
+	const optional_idx query_id;
+	//! The amount of tasks of the producer that are in the queue
+	atomic<idx_t> queued_tasks;
+	//! The amount of tasks of the producer that are being executed by the scheduler's threads
+	atomic<idx_t> running_tasks;
+
+public:
+	idx_t GetWeight() const;
+};
+
 struct ProducerToken {
-	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
+	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token, shared_ptr<ProducerState> state);
 	~ProducerToken();
 
 	TaskScheduler &scheduler;
 	unique_ptr<QueueProducerToken> token;
+	shared_ptr<ProducerState> state;
 	mutex producer_lock;
+	//! Whether the tasks of this producer are only executed by the thread that owns it: they are kept in
+	//! inline_tasks, and never handed to the scheduler's threads
+	bool execute_inline = false;
+	deque<shared_ptr<Task>> inline_tasks;
+};
+
+//! A snapshot of the scheduling state of a producer
+struct ProducerInformation {
+	optional_idx query_id;
+	QueryPriority priority;
+	idx_t queued_tasks;
+	idx_t running_tasks;
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
@@ -45,7 +83,9 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(ClientContext &context);
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
-	unique_ptr<ProducerToken> CreateProducer();
+	//! Create a producer, the threads are shared fairly between the producers with queued tasks, weighted by priority
+	unique_ptr<ProducerToken> CreateProducer(QueryPriority priority = QueryPriority::NORMAL,
+	                                         optional_idx query_id = optional_idx());
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
@@ -67,6 +107,8 @@ public:
 
 	//! Returns the number of threads
 	DUCKDB_API int32_t NumberOfThreads();
+	//! Returns the queued and running tasks of every producer
+	DUCKDB_API vector<ProducerInformation> GetProducerInformation();
 
 	//! Send signals to n threads, signalling for them to wake up and attempt to execute a task
 	void Signal(idx_t n);
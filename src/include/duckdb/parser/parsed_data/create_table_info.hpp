@@ -32,6 +32,8 @@ struct CreateTableInfo : public CreateInfo {
 	vector<unique_ptr<Constraint>> constraints;
 	//! CREATE TABLE as QUERY
 	unique_ptr<SelectStatement> query;
+	//! The columns that inserted rows are sorted on
+	vector<string> cluster_by;
 
 public:
 	DUCKDB_API unique_ptr<CreateInfo> Copy() const override;
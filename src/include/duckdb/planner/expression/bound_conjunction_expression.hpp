@@ -11,6 +11,7 @@
 #include "duckdb/planner/expression.hpp"
 
 namespace duckdb {
+class AdaptiveFilterStatistics;
 
 class BoundConjunctionExpression : public Expression {
 public:
@@ -21,6 +22,8 @@ public:
 	BoundConjunctionExpression(ExpressionType type, unique_ptr<Expression> left, unique_ptr<Expression> right);
 
 	vector<unique_ptr<Expression>> children;
+	//! The runtime statistics of the children, used to order them when filtering
+	shared_ptr<AdaptiveFilterStatistics> statistics;
 
 public:
 	string ToString() const override;
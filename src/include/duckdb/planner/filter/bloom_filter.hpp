@@ -0,0 +1,42 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
+
+namespace duckdb {
+
+//! The BloomFilter is a probabilistic filter: rows that do not pass it definitely do not satisfy the original
+//! predicate, but rows that pass it might not satisfy it either. It is used to push down join keys from the build side
+//! of a hash join into the probe-side scan, and must therefore use the same hash function as the hash join.
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+
+public:
+	explicit BloomFilter(shared_ptr<BlockedBloomFilter> filter);
+
+	//! The (shared) Bloom filter, this can be filled after the filter has been pushed
+	shared_ptr<BlockedBloomFilter> filter;
+
+public:
+	//! Reduces the selection vector to the entries of the input that may pass the filter, returns the new count
+	idx_t Filter(Vector &input, SelectionVector &sel, idx_t count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
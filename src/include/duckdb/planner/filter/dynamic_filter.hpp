@@ -0,0 +1,57 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+
+namespace duckdb {
+
+//! The (shared) state of a DynamicFilter, which is set by an operator while the scan is running
+struct DynamicFilterData {
+	explicit DynamicFilterData(ExpressionType comparison_type);
+
+	mutex lock;
+	//! The comparison type of the filter
+	ExpressionType comparison_type;
+	//! The current filter - only valid if initialized is set
+	unique_ptr<ConstantFilter> filter;
+	bool initialized = false;
+
+	//! Sets the constant of the filter, if the filter is not set yet or if the constant is more selective
+	void SetValue(const Value &value);
+	//! Clears the filter, so it is not set until the next call to SetValue
+	void Reset();
+};
+
+//! The DynamicFilter is a constant comparison whose constant is only known (and tightened) during execution, e.g. the
+//! boundary value of a Top-N heap. Rows that pass the filter might still be discarded by the operator that set it, so
+//! it is always correct to let every row pass.
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	DynamicFilter();
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared filter data, this can be modified after the filter has been pushed
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -38,6 +38,8 @@ public:
 	bool convert_mark_to_semi = true;
 	//! Scans where we should push generated filters into (if any)
 	unique_ptr<JoinFilterPushdownInfo> filter_pushdown;
+	//! The plan key under which the actual size of the build side is recorded (if enable_cardinality_feedback is set)
+	string build_feedback_key;
 
 public:
 	InsertionOrderPreservingMap<string> ParamsToString() const override;
@@ -42,6 +42,7 @@ public:
 
 	bool partition_output;
 	bool write_partition_columns;
+	bool buffer_partitions = false;
 	vector<idx_t> partition_columns;
 	vector<string> names;
 	vector<LogicalType> expected_types;
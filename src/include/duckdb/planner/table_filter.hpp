@@ -17,6 +17,7 @@
 #include "duckdb/planner/column_binding.hpp"
 
 namespace duckdb {
+class AdaptiveFilterStatistics;
 class BaseStatistics;
 class Expression;
 class PhysicalOperator;
@@ -28,7 +29,10 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	BLOOM_FILTER = 6, // probabilistic filter on the hash of the value (e.g. pushed from a hash join)
+	IN_FILTER = 7,     // membership in a set of constants (e.g. IN (C1, C2, C3))
+	DYNAMIC_FILTER = 8 // constant comparison that is set (and tightened) during execution (e.g. by a Top-N)
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -74,7 +78,11 @@ public:
 
 class TableFilterSet {
 public:
+	TableFilterSet();
+
 	unordered_map<idx_t, unique_ptr<TableFilter>> filters;
+	//! The runtime statistics of the filters, used to order them when scanning
+	shared_ptr<AdaptiveFilterStatistics> statistics;
 
 public:
 	void PushFilter(idx_t column_index, unique_ptr<TableFilter> filter);
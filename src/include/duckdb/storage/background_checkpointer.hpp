@@ -0,0 +1,87 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/background_checkpointer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+
+#include <chrono>
+#include <condition_variable>
+
+namespace duckdb {
+class AttachedDatabase;
+class DuckTransactionManager;
+
+//! The state of the background checkpointer of a database, as reported by duckdb_checkpoints()
+struct BackgroundCheckpointInfo {
+	//! Whether or not the background thread is running
+	bool running = false;
+	//! The amount of checkpoints performed by the background thread
+	idx_t checkpoint_count = 0;
+	//! The amount of times a checkpoint was postponed because other transactions were active
+	idx_t postponed_count = 0;
+	//! The amount of checkpoints that failed
+	idx_t failed_count = 0;
+	//! Why the last checkpoint was triggered ("wal_size" or "interval")
+	string last_reason;
+	//! When the last checkpoint finished
+	timestamp_t last_checkpoint;
+	//! How long the last checkpoint took, in milliseconds
+	idx_t last_duration_ms = 0;
+	//! The error message of the last failed checkpoint
+	string last_error;
+};
+
+//! The BackgroundCheckpointer checkpoints a database from a background thread when the WAL exceeds the checkpoint
+//! threshold or when the checkpoint interval has elapsed, so committing transactions never pay for the checkpoint.
+//! It never waits for write transactions, and postpones checkpoints while read transactions are active.
+//! With synchronous_commit disabled it also syncs the WAL for commits that did not wait for it. While it runs, it also
+//! cleans up the version information of finished transactions.
+class BackgroundCheckpointer {
+public:
+	explicit BackgroundCheckpointer(AttachedDatabase &db);
+	~BackgroundCheckpointer();
+
+	//! Starts the background thread if it is not yet running - returns false if the database cannot be checkpointed
+	//! in the background (e.g. because threads are disabled)
+	bool Start();
+	//! Stops the background thread, waiting for a running checkpoint to finish
+	void Stop();
+	//! Called when a transaction that made changes commits
+	void NotifyCommit(bool wal_threshold_reached);
+	//! Called when finished transactions are waiting to be cleaned up - returns false if the background thread is not
+	//! running, in which case the caller has to clean them up
+	bool NotifyCleanup();
+	//! Returns the current state of the checkpointer
+	BackgroundCheckpointInfo GetInfo();
+
+private:
+	void Run();
+	void SyncWAL(DuckTransactionManager &transaction_manager);
+
+private:
+	AttachedDatabase &db;
+	mutex lock;
+	std::condition_variable cv;
+	unique_ptr<thread> checkpoint_thread;
+	bool shutdown = false;
+	//! Whether or not changes were committed since the last checkpoint
+	bool pending_changes = false;
+	//! Whether or not the WAL has exceeded the checkpoint threshold
+	bool wal_threshold_reached = false;
+	//! Whether or not finished transactions are waiting to be cleaned up
+	bool cleanup_requested = false;
+	//! When the last checkpoint was performed (or the checkpointer was created)
+	std::chrono::steady_clock::time_point last_checkpoint_time;
+	BackgroundCheckpointInfo info;
+};
+
+} // namespace duckdb
@@ -26,6 +26,17 @@ public:
 	block_id_t id;
 };
 
+//! A block that points into a memory mapping of the database file, rather than owning its memory
+class MappedBlock : public Block {
+public:
+	MappedBlock(Allocator &allocator, block_id_t id, data_ptr_t mapped_data, idx_t alloc_size);
+	~MappedBlock() override;
+
+	bool IsReusable() const override {
+		return false;
+	}
+};
+
 struct BlockPointer {
 	BlockPointer(block_id_t block_id_p, uint32_t offset_p) : block_id(block_id_p), offset(offset_p) {
 	}
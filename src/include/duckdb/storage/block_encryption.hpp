@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/block_encryption.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/encryption_state.hpp"
+#include "duckdb/common/file_buffer.hpp"
+
+namespace duckdb {
+
+class DatabaseInstance;
+
+//! BlockEncryption encrypts the blocks of database files and temporary files with AES-GCM.
+//! The encryption preserves the size of a block: instead of a random nonce and a tag, a block stores a single 64-bit
+//! synthetic IV in the header that otherwise holds its checksum (similar to AES-GCM-SIV). The synthetic IV is a keyed
+//! hash of the location and the plaintext of the block, which makes it both the nonce of the block and the check that
+//! detects corrupt blocks and wrong keys when the block is decrypted.
+//! The AES-GCM implementation is provided by the EncryptionUtil of the database (e.g., OpenSSL, which uses AES-NI or
+//! the ARMv8 crypto extensions), and falls back to the bundled mbedtls otherwise. Blocks are encrypted and decrypted
+//! by the thread that writes or reads them, so checkpoints and scans encrypt and decrypt in parallel.
+class BlockEncryption {
+public:
+	//! The size of the salt that is stored with the encrypted file
+	static constexpr idx_t SALT_SIZE = 16;
+	//! The size of the AES keys that are derived from the user-provided key
+	static constexpr idx_t KEY_SIZE = 32;
+	//! The PBKDF2 iterations that derive the keys from a user-provided key, which make guessing the key expensive
+	static constexpr idx_t KDF_ITERATIONS = 100000;
+	//! Set in the location of WAL entries, so they never use the same location as a block of the database file
+	static constexpr uint64_t WAL_LOCATION_FLAG = 1ULL << 63ULL;
+
+	BlockEncryption(shared_ptr<EncryptionUtil> encryption_util, const string &key, const_data_ptr_t salt,
+	                idx_t kdf_iterations = KDF_ITERATIONS);
+
+	//! Returns the AES-GCM implementation that is used for the given database
+	static shared_ptr<EncryptionUtil> GetEncryptionUtil(DatabaseInstance &db);
+	//! Creates an encryption with a random key that only lives as long as the returned object, e.g., for temporary
+	//! files
+	static unique_ptr<BlockEncryption> CreateEphemeral(DatabaseInstance &db);
+	//! Fills the buffer with cryptographically secure random data
+	static void GenerateRandomData(DatabaseInstance &db, data_ptr_t data, idx_t size);
+
+	//! A value derived from the key, which is stored with the file to detect wrong keys when it is opened
+	uint64_t GetKeyCheck() const {
+		return key_check;
+	}
+
+	//! Encrypts "size" bytes from the source into the target, and returns the synthetic IV of the data
+	uint64_t Encrypt(const_data_ptr_t source, data_ptr_t target, idx_t size, uint64_t location) const;
+	//! Decrypts "size" bytes in place. Returns false if the decrypted data does not match the synthetic IV.
+	bool Decrypt(data_ptr_t data, idx_t size, uint64_t location, uint64_t synthetic_iv) const;
+	//! Encrypts the buffer into a new buffer of the same size, whose header holds the synthetic IV
+	unique_ptr<FileBuffer> EncryptBuffer(Allocator &allocator, FileBuffer &buffer, uint64_t location) const;
+	//! Decrypts a buffer that was encrypted with EncryptBuffer in place. Returns false if the buffer is corrupt.
+	bool DecryptBuffer(FileBuffer &buffer, uint64_t location) const;
+
+private:
+	//! Computes the synthetic IV of the plaintext at the given location
+	uint64_t ComputeSyntheticIV(const_data_ptr_t data, idx_t size, uint64_t location) const;
+	//! XORs the AES-GCM key stream for the synthetic IV and location into the target
+	void ApplyKeyStream(const_data_ptr_t source, data_ptr_t target, idx_t size, uint64_t location,
+	                    uint64_t synthetic_iv) const;
+
+private:
+	shared_ptr<EncryptionUtil> encryption_util;
+	//! The key that encrypts the blocks
+	string encryption_key;
+	//! The key of the hash over the plaintext of a block
+	string hash_key;
+	//! The key that turns the hash of a block into its synthetic IV
+	string iv_key;
+	uint64_t key_check;
+};
+
+} // namespace duckdb
@@ -11,11 +11,13 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/optional_idx.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 #include "duckdb/common/unordered_map.hpp"
 
 namespace duckdb {
+class BlockEncryption;
 class BlockHandle;
 class BufferManager;
 class ClientContext;
@@ -77,6 +79,22 @@ public:
 	}
 	//! Whether or not the attached database is in-memory
 	virtual bool InMemory() = 0;
+	//! Whether or not reads bypass the operating system page cache (and its read-ahead)
+	virtual bool UsesDirectIO() const {
+		return false;
+	}
+	//! Whether or not persistent blocks point into a memory mapping of the database file
+	virtual bool IsMemoryMapped() const {
+		return false;
+	}
+	//! Returns a block that points into the memory mapping of the database file, or nullptr if the block is not mapped
+	virtual unique_ptr<Block> MapBlock(block_id_t block_id) {
+		return nullptr;
+	}
+	//! Returns the encryption of the database file, or nullptr if the file is not encrypted
+	virtual optional_ptr<const BlockEncryption> GetEncryption() const {
+		return nullptr;
+	}
 
 	//! Sync changes made to the block manager
 	virtual void FileSync() = 0;
@@ -0,0 +1,59 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/buffer/block_arena.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/allocator.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+
+namespace duckdb {
+
+//! The BlockArena is a region of memory that is reserved up front, out of which block-sized buffers are allocated.
+//! The region can be backed by transparent huge pages, which reduces the TLB misses of scanning buffer-managed data,
+//! and can be pre-faulted, so that loading a block never page faults. Freed blocks stay resident and are re-used.
+class BlockArena : public PrivateAllocatorData {
+public:
+	BlockArena(idx_t block_alloc_size, idx_t arena_size, bool huge_pages, bool prefault);
+	~BlockArena() override;
+
+	//! Creates an allocator that serves allocations of exactly block_alloc_size bytes from a block arena, and all
+	//! other allocations with the default allocator
+	static unique_ptr<Allocator> CreateAllocator(idx_t block_alloc_size, idx_t arena_size, bool huge_pages,
+	                                             bool prefault);
+
+	//! Allocates a block from the arena, returns nullptr if the size is not the block size or the arena is exhausted
+	data_ptr_t AllocateBlock(idx_t size);
+	//! Returns a block to the arena, returns false if the pointer was not allocated from the arena
+	bool FreeBlock(data_ptr_t pointer);
+	//! Whether the pointer was allocated from the arena
+	bool Contains(data_ptr_t pointer) const;
+
+private:
+	static data_ptr_t Allocate(PrivateAllocatorData *private_data, idx_t size);
+	static void Free(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t size);
+	static data_ptr_t Reallocate(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t old_size, idx_t size);
+
+private:
+	//! The size of the blocks served from the arena
+	idx_t block_alloc_size;
+	//! The reserved memory, and the (huge page aligned) start of the blocks within it
+	data_ptr_t reserved_memory = nullptr;
+	idx_t reserved_size = 0;
+	data_ptr_t blocks = nullptr;
+	//! The number of blocks that fit in the arena
+	idx_t block_count = 0;
+	//! The blocks that have never been handed out start at this index
+	atomic<idx_t> next_block;
+	//! Blocks that were handed out and freed again
+	mutex free_lock;
+	vector<data_ptr_t> free_blocks;
+};
+
+} // namespace duckdb
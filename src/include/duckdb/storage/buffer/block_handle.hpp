@@ -22,6 +22,7 @@ namespace duckdb {
 class BlockManager;
 class BufferHandle;
 class BufferPool;
+class ClientMemoryTracker;
 class DatabaseInstance;
 
 enum class BlockState : uint8_t { BLOCK_UNLOADED = 0, BLOCK_LOADED = 1 };
@@ -30,6 +31,8 @@ struct BufferPoolReservation {
 	MemoryTag tag;
 	idx_t size {0};
 	BufferPool &pool;
+	//! The client the reservation is charged to (if it was made on behalf of a client)
+	shared_ptr<ClientMemoryTracker> tracker;
 
 	BufferPoolReservation(MemoryTag tag, BufferPool &pool);
 	BufferPoolReservation(const BufferPoolReservation &) = delete;
@@ -141,6 +144,11 @@ private:
 	unique_ptr<FileBuffer> buffer;
 	//! Internal eviction sequence number
 	atomic<idx_t> eviction_seq_num;
+	//! Whether the block was pinned again while it was already loaded, i.e., it was used more than once since it was
+	//! last loaded
+	bool reused_since_load;
+	//! Whether the latest eviction node of this block is in the probation queue (see BufferEvictionPolicy::TWO_QUEUE)
+	bool in_probation_queue;
 	//! LRU timestamp (for age-based eviction)
 	atomic<int64_t> lru_timestamp_msec;
 	//! When to destroy the data buffer
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/array.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -41,7 +42,8 @@ class BufferPool {
 	friend class StandardBufferManager;
 
 public:
-	BufferPool(idx_t maximum_memory, bool track_eviction_timestamps, idx_t allocator_bulk_deallocation_flush_threshold);
+	BufferPool(idx_t maximum_memory, bool track_eviction_timestamps, idx_t allocator_bulk_deallocation_flush_threshold,
+	           BufferEvictionPolicy eviction_policy = BufferEvictionPolicy::LRU);
 	virtual ~BufferPool();
 
 	//! Set a new memory limit to the buffer pool, throws an exception if the new limit is too low and not enough
@@ -51,6 +53,15 @@ public:
 	//! If bulk deallocation larger than this occurs, flush outstanding allocations
 	void SetAllocatorBulkDeallocationFlushThreshold(idx_t threshold);
 
+	//! Set the policy used to pick persistent blocks to evict
+	void SetEvictionPolicy(BufferEvictionPolicy policy);
+	BufferEvictionPolicy GetEvictionPolicy() const;
+
+	//! Count a pin of a block with the given tag, which either found the block in memory (hit) or had to load it (miss)
+	void RecordPin(MemoryTag tag, bool hit);
+	idx_t GetPinHits(MemoryTag tag) const;
+	idx_t GetPinMisses(MemoryTag tag) const;
+
 	void UpdateUsedMemory(MemoryTag tag, int64_t size);
 
 	idx_t GetUsedMemory() const;
@@ -87,8 +98,10 @@ protected:
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
 	//! Gets the eviction queue for the specified type
 	EvictionQueue &GetEvictionQueueForType(FileBufferType type);
-	//! Increments the dead nodes for the queue with specified type
-	void IncrementDeadNodes(FileBufferType type);
+	//! Gets the eviction queue that holds the latest eviction node of the block handle
+	EvictionQueue &GetEvictionQueueForBlockHandle(const BlockHandle &handle);
+	//! Increments the dead nodes for the queue holding the latest eviction node of the block handle
+	void IncrementDeadNodes(const BlockHandle &handle);
 
 protected:
 	enum class MemoryUsageCaches {
@@ -142,8 +155,14 @@ protected:
 	atomic<idx_t> allocator_bulk_deallocation_flush_threshold;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool track_eviction_timestamps;
-	//! Eviction queues
+	//! Eviction queues, one per FileBufferType, followed by the probation queue for blocks
 	vector<unique_ptr<EvictionQueue>> queues;
+	//! The policy used to pick persistent blocks to evict
+	atomic<BufferEvictionPolicy> eviction_policy;
+	//! Pins per memory tag that found the block loaded in memory
+	array<atomic<idx_t>, MEMORY_TAG_COUNT> pin_hits;
+	//! Pins per memory tag that had to load the block
+	array<atomic<idx_t>, MEMORY_TAG_COUNT> pin_misses;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
 	//! To improve performance, MemoryUsage maintains counter caches based on current cpu or thread id,
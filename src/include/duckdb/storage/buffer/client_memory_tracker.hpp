@@ -0,0 +1,79 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/buffer/client_memory_tracker.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/memory_tag.hpp"
+#include "duckdb/common/optional_idx.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+
+namespace duckdb {
+
+//! The ClientMemoryTracker keeps track of the buffer pool memory that is reserved on behalf of a client, and of the
+//! part of it that was reserved by the query the client is running. Reservations are charged to the tracker that is
+//! active on the thread making them (see ActiveScope), and released from the same tracker.
+class ClientMemoryTracker : public enable_shared_from_this<ClientMemoryTracker> {
+public:
+	ClientMemoryTracker();
+
+public:
+	//! Starts a new query, the query memory is the memory charged from now on. A limit of DConstants::INVALID_INDEX
+	//! means there is no limit.
+	void BeginQuery(idx_t query_limit, idx_t session_limit);
+
+	//! Charges memory to the client, throws an OutOfMemoryException if this exceeds the query or the session limit
+	void Charge(MemoryTag tag, idx_t size);
+	//! Charges memory to the client without checking the limits
+	void ForceCharge(MemoryTag tag, idx_t size);
+	//! Releases memory that was charged to the client
+	void Release(MemoryTag tag, idx_t size);
+
+	//! The memory that is currently charged to the client
+	idx_t GetSessionMemory() const;
+	idx_t GetSessionMemory(MemoryTag tag) const;
+	//! The memory that was charged to the client by the current query
+	idx_t GetQueryMemory() const;
+	//! The highest query memory of the current query
+	idx_t GetQueryPeakMemory() const;
+	//! The memory the current query can still reserve before exceeding a limit (invalid if there is no limit)
+	optional_idx GetRemainingQueryMemory() const;
+
+	//! Whether reservations with the given tag are charged to clients. Memory that outlives queries and is shared
+	//! between clients (table data, indexes, metadata) is not.
+	static bool IsTracked(MemoryTag tag);
+	//! The tracker that is active on the calling thread (if any)
+	static optional_ptr<ClientMemoryTracker> GetActive();
+
+	//! Makes a tracker the active tracker of the calling thread while in scope
+	class ActiveScope {
+	public:
+		explicit ActiveScope(optional_ptr<ClientMemoryTracker> tracker);
+		~ActiveScope();
+
+	private:
+		optional_ptr<ClientMemoryTracker> previous;
+	};
+
+private:
+	idx_t GetQueryMemory(idx_t session_memory) const;
+
+private:
+	//! The memory charged to the client, in total and per tag
+	atomic<idx_t> session_memory;
+	atomic<idx_t> tag_memory[MEMORY_TAG_COUNT];
+	//! The session memory when the current query started
+	atomic<idx_t> query_start_memory;
+	atomic<idx_t> query_peak_memory;
+	//! The limits, DConstants::INVALID_INDEX if there is no limit
+	atomic<idx_t> query_limit;
+	atomic<idx_t> session_limit;
+};
+
+} // namespace duckdb
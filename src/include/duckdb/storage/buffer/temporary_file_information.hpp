@@ -9,11 +9,17 @@ struct MemoryInformation {
 	MemoryTag tag;
 	idx_t size;
 	idx_t evicted_data;
+	//! The number of pins that found the block in memory
+	idx_t buffer_hits;
+	//! The number of pins that had to load the block (from disk or from temporary storage)
+	idx_t buffer_misses;
 };
 
 struct TemporaryFileInformation {
 	string path;
 	idx_t size;
+	//! The size the blocks in the file would take up without compression
+	idx_t uncompressed_size;
 };
 
 } // namespace duckdb
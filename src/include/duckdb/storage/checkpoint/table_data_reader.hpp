@@ -12,17 +12,21 @@
 
 namespace duckdb {
 struct BoundCreateTableInfo;
+class PersistentTableData;
 
 //! The table data reader is responsible for reading the data of a table from the block manager
 class TableDataReader {
 public:
 	TableDataReader(MetadataReader &reader, BoundCreateTableInfo &info);
+	//! Reads the table data of a table with the given physical column types into the persistent table data
+	TableDataReader(MetadataReader &reader, vector<LogicalType> types, PersistentTableData &data);
 
 	void ReadTableData();
 
 private:
 	MetadataReader &reader;
-	BoundCreateTableInfo &info;
+	vector<LogicalType> types;
+	PersistentTableData &data;
 };
 
 } // namespace duckdb
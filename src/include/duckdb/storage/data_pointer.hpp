@@ -59,6 +59,8 @@ struct DataPointer {
 	BaseStatistics statistics;
 	//! Serialized segment state
 	unique_ptr<ColumnSegmentState> segment_state;
+	//! Statistics of the vectors of the segment (if any)
+	vector<BaseStatistics> vector_statistics;
 
 	void Serialize(Serializer &serializer) const;
 	static DataPointer Deserialize(Deserializer &source);
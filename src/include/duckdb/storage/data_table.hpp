@@ -92,9 +92,11 @@ public:
 	//! Returns true if all pushed down filters were executed during data fetching
 	void Scan(DuckTransaction &transaction, DataChunk &result, TableScanState &state);
 
-	//! Fetch data from the specific row identifiers from the base table
+	//! Fetch data from the specific row identifiers from the base table. Rows that are not visible are skipped.
+	//! If fetch_sel is set, it receives the position in row_ids of each fetched row.
 	void Fetch(DuckTransaction &transaction, DataChunk &result, const vector<column_t> &column_ids,
-	           const Vector &row_ids, idx_t fetch_count, ColumnFetchState &state);
+	           const Vector &row_ids, idx_t fetch_count, ColumnFetchState &state,
+	           optional_ptr<SelectionVector> fetch_sel = nullptr);
 
 	//! Initializes an append to transaction-local storage
 	void InitializeLocalAppend(LocalAppendState &state, TableCatalogEntry &table, ClientContext &context,
@@ -182,6 +184,14 @@ public:
 	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id);
 	//! Sets statistics of a physical column within the table
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
+	//! Get the histogram of a column, if the column was analyzed
+	unique_ptr<HistogramStatistics> GetHistogram(column_t column_id);
+	//! Sets the histogram of a column
+	void SetHistogram(column_t column_id, unique_ptr<HistogramStatistics> histogram);
+	//! Returns a counter that changes whenever the statistics of the table (might) change
+	idx_t GetStatisticsVersion();
+	//! Returns a copy of the sample of the rows that were appended to the table, or nullptr if there is none
+	unique_ptr<ReservoirSample> GetSample();
 
 	//! Obtains a shared lock to prevent checkpointing while operations are running
 	unique_ptr<StorageLockKey> GetSharedCheckpointLock();
@@ -220,6 +230,7 @@ public:
 	void SetIndexStorageInfo(vector<IndexStorageInfo> index_storage_info);
 	void VacuumIndexes();
 	void CleanupAppend(transaction_t lowest_transaction, idx_t start, idx_t count);
+	void CleanupDelete(transaction_t lowest_transaction, idx_t row);
 
 	string GetTableName() const;
 	void SetTableName(string new_name);
@@ -62,8 +62,9 @@ struct IndexStorageInfo {
 	BlockPointer root_block_ptr;
 
 	//! Returns true, if IndexStorageInfo holds information to deserialize an index.
+	//! Indexes that do not use fixed-size allocators store their data in the options.
 	bool IsValid() const {
-		return root_block_ptr.IsValid() || !allocator_infos.empty();
+		return root_block_ptr.IsValid() || !allocator_infos.empty() || !options.empty();
 	}
 
 	void Serialize(Serializer &serializer) const;
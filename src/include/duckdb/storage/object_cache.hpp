@@ -65,7 +65,7 @@ public:
 
 	void Put(string key, shared_ptr<ObjectCacheEntry> value) {
 		lock_guard<mutex> glock(lock);
-		cache.insert(make_pair(std::move(key), std::move(value)));
+		cache[std::move(key)] = std::move(value);
 	}
 
 	void Delete(const string &key) {
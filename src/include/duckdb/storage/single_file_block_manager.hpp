@@ -8,9 +8,12 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/checksum.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/block.hpp"
+#include "duckdb/storage/block_encryption.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/unordered_set.hpp"
 #include "duckdb/common/set.hpp"
@@ -25,8 +28,14 @@ struct MetadataHandle;
 struct StorageManagerOptions {
 	bool read_only = false;
 	bool use_direct_io = false;
+	//! Whether or not to memory-map the database file (read-only databases only)
+	bool use_mmap = false;
 	DebugInitialize debug_initialize = DebugInitialize::NO_INITIALIZE;
 	optional_idx block_alloc_size = optional_idx();
+	//! The checksum algorithm used for the blocks of newly created database files
+	ChecksumType checksum_type = ChecksumType::LEGACY;
+	//! The key of the database file - the file is encrypted if the key is not empty
+	string encryption_key;
 };
 
 //! SingleFileBlockManager is an implementation for a BlockManager which manages blocks in a single file
@@ -36,6 +45,7 @@ class SingleFileBlockManager : public BlockManager {
 
 public:
 	SingleFileBlockManager(AttachedDatabase &db, const string &path, const StorageManagerOptions &options);
+	~SingleFileBlockManager() override;
 
 	FileOpenFlags GetFileFlags(bool create_new) const;
 	//! Creates a new database.
@@ -85,16 +95,35 @@ public:
 	idx_t FreeBlocks() override;
 	//! Whether or not the attached database is a remote file
 	bool IsRemote() override;
+	bool UsesDirectIO() const override {
+		return options.use_direct_io;
+	}
+	bool IsMemoryMapped() const override {
+		return mapped_data != nullptr;
+	}
+	//! Returns a block that points into the mapped file, verifying its checksum the first time it is mapped
+	unique_ptr<Block> MapBlock(block_id_t block_id) override;
+	optional_ptr<const BlockEncryption> GetEncryption() const override {
+		return encryption.get();
+	}
 
 private:
 	//! Loads the free list of the file.
 	void LoadFreeList();
+	//! Maps the database file into memory
+	void MapFile();
 	//! Initializes the database header. We pass the provided block allocation size as a parameter
 	//!	to detect inconsistencies with the file header.
 	void Initialize(const DatabaseHeader &header, const optional_idx block_alloc_size);
 
 	void ReadAndChecksum(FileBuffer &handle, uint64_t location) const;
 	void ChecksumAndWrite(FileBuffer &handle, uint64_t location) const;
+	//! Computes the checksum of a block using the checksum algorithm of the file
+	uint64_t ComputeChecksum(data_ptr_t buffer, idx_t size) const;
+	//! Decrypts a block (starting with its header) in place, and verifies its contents
+	void DecryptBlock(data_ptr_t block_ptr, idx_t size, uint64_t location) const;
+	//! Creates the encryption of an encrypted database file from the salt in its main header
+	unique_ptr<BlockEncryption> CreateEncryption(const MainHeader &main_header) const;
 
 	idx_t GetBlockLocation(block_id_t block_id);
 
@@ -137,7 +166,18 @@ private:
 	uint64_t iteration_count;
 	//! The storage manager options
 	StorageManagerOptions options;
+	//! The checksum algorithm of the database file - the main header always uses the legacy checksum
+	ChecksumType checksum_type = ChecksumType::LEGACY;
+	//! The encryption of the blocks and database headers of the file, if it is encrypted
+	//! The main header is never encrypted, as it holds the salt of the key
+	unique_ptr<BlockEncryption> encryption;
 	//! Lock for performing various operations in the single file block manager
 	mutex block_lock;
+	//! The memory mapping of the database file (if use_mmap is set)
+	data_ptr_t mapped_data = nullptr;
+	//! The size of the memory mapping
+	idx_t mapped_size = 0;
+	//! For each block in the mapping, whether or not its checksum was verified
+	unique_ptr<atomic<bool>[]> mapped_block_verified;
 };
 } // namespace duckdb
@@ -10,6 +10,7 @@
 
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/storage/statistics/histogram_statistics.hpp"
 
 namespace duckdb {
 class Serializer;
@@ -32,6 +33,10 @@ public:
 	DistinctStatistics &DistinctStats();
 	void SetDistinct(unique_ptr<DistinctStatistics> distinct_stats);
 
+	bool HasHistogram();
+	HistogramStatistics &Histogram();
+	void SetHistogram(unique_ptr<HistogramStatistics> histogram);
+
 	shared_ptr<ColumnStatistics> Copy() const;
 
 	void Serialize(Serializer &serializer) const;
@@ -41,6 +46,8 @@ private:
 	BaseStatistics stats;
 	//! The approximate count distinct stats of the column
 	unique_ptr<DistinctStatistics> distinct_stats;
+	//! The most common values and histogram of the column (if the column was analyzed)
+	unique_ptr<HistogramStatistics> histogram;
 };
 
 } // namespace duckdb
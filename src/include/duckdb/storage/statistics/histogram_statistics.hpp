@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/statistics/histogram_statistics.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/common/types/value.hpp"
+
+namespace duckdb {
+class Vector;
+class Serializer;
+class Deserializer;
+
+//! The most common values and an equi-depth histogram of the remaining values of a column, built by ANALYZE from a
+//! sample of the column. All frequencies are fractions of the total row count of the column.
+class HistogramStatistics {
+public:
+	HistogramStatistics(LogicalType type, double null_fraction, vector<Value> most_common_values,
+	                    vector<double> most_common_frequencies, vector<Value> boundaries, double histogram_fraction);
+
+	//! The type of the column
+	LogicalType type;
+	//! The fraction of NULL values
+	double null_fraction;
+	//! The most common values of the column
+	vector<Value> most_common_values;
+	//! The frequency of each of the most common values
+	vector<double> most_common_frequencies;
+	//! The bucket boundaries of the equi-depth histogram over the values that are not in the most common values:
+	//! boundaries.size() - 1 buckets that each hold the same amount of values
+	vector<Value> boundaries;
+	//! The fraction of the values covered by the histogram (i.e. non-NULL and not a most common value)
+	double histogram_fraction;
+
+public:
+	unique_ptr<HistogramStatistics> Copy() const;
+
+	//! Estimates the fraction of rows that are equal to the given value, the distinct count is used for the values
+	//! that are not among the most common values (if it is 0, the sample is used instead)
+	double EstimateEquality(const Value &value, idx_t distinct_count) const;
+	//! Estimates the fraction of rows that lie between the given bounds, a NULL bound is unbounded
+	double EstimateRange(const Value &lower, bool lower_inclusive, const Value &upper, bool upper_inclusive) const;
+
+	string ToString() const;
+
+	static bool TypeIsSupported(const LogicalType &type);
+
+	void Serialize(Serializer &serializer) const;
+	static unique_ptr<HistogramStatistics> Deserialize(Deserializer &deserializer);
+
+private:
+	//! The fraction of rows in the histogram that are smaller than (or equal to, if inclusive) the given value
+	double HistogramFractionBelow(const Value &value, bool inclusive) const;
+	//! Whether or not the value lies within the given bounds
+	static bool InRange(const Value &value, const Value &lower, bool lower_inclusive, const Value &upper,
+	                    bool upper_inclusive);
+};
+
+//! A uniform reservoir sample of a column from which the HistogramStatistics are built
+class HistogramSample {
+public:
+	explicit HistogramSample(LogicalType type);
+
+	//! The amount of values kept in the sample
+	static constexpr const idx_t SAMPLE_SIZE = 4096;
+	//! The maximum amount of buckets of the equi-depth histogram
+	static constexpr const idx_t HISTOGRAM_BUCKETS = 64;
+	//! The maximum amount of most common values
+	static constexpr const idx_t MAX_MOST_COMMON_VALUES = 16;
+
+public:
+	void Update(Vector &update, idx_t count);
+	void Merge(HistogramSample &other);
+
+	//! Builds the histogram from the sample - returns nullptr if no values were sampled
+	unique_ptr<HistogramStatistics> Build() const;
+
+private:
+	LogicalType type;
+	//! The sampled (non-NULL) values
+	vector<Value> sample;
+	//! The amount of non-NULL values that were offered to the sample
+	idx_t value_count;
+	//! The amount of NULL values
+	idx_t null_count;
+	RandomEngine random;
+};
+
+} // namespace duckdb
@@ -56,6 +56,10 @@ struct NumericStats {
 	//! Check whether or not a given comparison with a constant could possibly be satisfied by rows given the statistics
 	DUCKDB_API static FilterPropagateResult CheckZonemap(const BaseStatistics &stats, ExpressionType comparison_type,
 	                                                     const Value &constant);
+	//! Check whether or not a given comparison with a constant could possibly be satisfied by values in [min, max]
+	template <class T>
+	DUCKDB_API static FilterPropagateResult CheckZonemap(ExpressionType comparison_type, T min_value, T max_value,
+	                                                     T constant);
 
 	DUCKDB_API static void Merge(BaseStatistics &stats, const BaseStatistics &other_p);
 
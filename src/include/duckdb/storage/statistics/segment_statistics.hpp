@@ -15,12 +15,26 @@
 namespace duckdb {
 
 class SegmentStatistics {
+public:
+	//! The number of rows that are covered by every entry of the vector statistics
+	static constexpr const idx_t VECTOR_STATISTICS_SIZE = 2048;
+	//! The storage version from which on vector statistics are written
+	static constexpr const idx_t VECTOR_STATISTICS_SERIALIZATION_VERSION = 4;
+
 public:
 	explicit SegmentStatistics(LogicalType type);
 	explicit SegmentStatistics(BaseStatistics statistics);
 
 	//! Type-specific statistics of the segment
 	BaseStatistics statistics;
+	//! (Optional) statistics of every VECTOR_STATISTICS_SIZE-aligned range of rows that overlaps the segment, the
+	//! first entry covers the range that contains the first row of the segment. Entries can include rows of adjacent
+	//! segments.
+	vector<BaseStatistics> vector_statistics;
+
+public:
+	//! Returns a copy of the vector statistics
+	vector<BaseStatistics> CopyVectorStatistics() const;
 };
 
 } // namespace duckdb
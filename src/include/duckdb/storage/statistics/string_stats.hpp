@@ -66,6 +66,12 @@ struct StringStats {
 	DUCKDB_API static FilterPropagateResult CheckZonemap(const_data_ptr_t min_data, idx_t min_len,
 	                                                     const_data_ptr_t max_data, idx_t max_len,
 	                                                     ExpressionType comparison_type, const string &value);
+	//! Checks whether strings starting with the given prefix can be present - this also takes the maximum string
+	//! length and whether or not the strings can contain unicode into account
+	DUCKDB_API static FilterPropagateResult CheckPrefix(const BaseStatistics &stats, const string &prefix);
+	//! Computes the smallest string that is bigger than all strings starting with the given prefix, i.e. prefix
+	//! predicates can be turned into the range [prefix, upper_bound). Returns false if there is no such string.
+	DUCKDB_API static bool GetPrefixUpperBound(const string &prefix, string &upper_bound);
 
 	DUCKDB_API static void Update(BaseStatistics &stats, const string_t &value);
 	DUCKDB_API static void Merge(BaseStatistics &stats, const BaseStatistics &other);
@@ -70,6 +70,13 @@ struct MainHeader {
 	static constexpr idx_t MAGIC_BYTE_SIZE = 4;
 	static constexpr idx_t MAGIC_BYTE_OFFSET = Storage::DEFAULT_BLOCK_HEADER_SIZE;
 	static constexpr idx_t FLAG_COUNT = 4;
+	//! Set in flags[0] if the blocks and database headers of the file are checksummed using CRC32C
+	static constexpr uint64_t CRC32C_CHECKSUM_FLAG = 1;
+	//! Set in flags[0] if the blocks and database headers of the file are encrypted
+	//! flags[1] and flags[2] then hold the salt of the encryption key, and flags[3] holds its key check
+	static constexpr uint64_t ENCRYPTED_FLAG = 2;
+	//! The flags in flags[0] that this version of DuckDB can read
+	static constexpr uint64_t SUPPORTED_FLAGS = CRC32C_CHECKSUM_FLAG | ENCRYPTED_FLAG;
 	//! The magic bytes in front of the file should be "DUCK"
 	static const char MAGIC_BYTES[];
 	//! The version of the database
@@ -14,6 +14,7 @@
 #include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/storage/database_size.hpp"
+#include "duckdb/storage/background_checkpointer.hpp"
 #include "duckdb/common/enums/checkpoint_type.hpp"
 
 namespace duckdb {
@@ -36,6 +37,9 @@ public:
 	virtual void RevertCommit() = 0;
 	// Make the commit persistent
 	virtual void FlushCommit() = 0;
+	//! Wait until the flushed commit is durable - returns right away if commits are synced asynchronously
+	virtual void SyncCommit() {
+	}
 
 	virtual void AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
 	                             unique_ptr<PersistentCollectionData> row_group_data) = 0;
@@ -57,6 +61,20 @@ struct CheckpointOptions {
 	CheckpointType type;
 };
 
+//! Statistics of the WAL replay that was performed when loading the database
+struct WALReplayInfo {
+	//! The size of the WAL in bytes
+	idx_t wal_size = 0;
+	//! The amount of bytes of the WAL that were replayed - less than the WAL size if the WAL was torn
+	idx_t replayed_bytes = 0;
+	//! The amount of replayed entries
+	idx_t replayed_entries = 0;
+	//! The amount of row group sized appends that were applied in parallel
+	idx_t parallel_appends = 0;
+	//! How long the replay took, in milliseconds
+	idx_t duration_ms = 0;
+};
+
 //! StorageManager is responsible for managing the physical storage of the
 //! database on disk
 class StorageManager {
@@ -96,6 +114,18 @@ public:
 	string GetWALPath();
 	bool InMemory();
 
+	//! Returns the background checkpointer, or nullptr if the database is in-memory or read-only
+	optional_ptr<BackgroundCheckpointer> GetBackgroundCheckpointer() {
+		return background_checkpointer.get();
+	}
+	//! Returns the statistics of the WAL replay performed when the database was loaded
+	const WALReplayInfo &GetWALReplayInfo() const {
+		return wal_replay_info;
+	}
+	void SetWALReplayInfo(const WALReplayInfo &info) {
+		wal_replay_info = info;
+	}
+
 	virtual bool AutomaticCheckpoint(idx_t estimated_wal_bytes) = 0;
 	virtual unique_ptr<StorageCommitState> GenStorageCommitState(WriteAheadLog &wal) = 0;
 	virtual bool IsCheckpointClean(MetaBlockPointer checkpoint_id) = 0;
@@ -120,6 +150,10 @@ protected:
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
 	//! return nullptr when loading a database
 	bool load_complete = false;
+	//! Checkpoints the database in the background if background_checkpoint is enabled
+	unique_ptr<BackgroundCheckpointer> background_checkpointer;
+	//! The statistics of the WAL replay performed when loading the database
+	WALReplayInfo wal_replay_info;
 
 public:
 	template <class TARGET>
@@ -138,12 +172,17 @@ public:
 class SingleFileStorageManager : public StorageManager {
 public:
 	SingleFileStorageManager() = delete;
-	SingleFileStorageManager(AttachedDatabase &db, string path, bool read_only);
+	SingleFileStorageManager(AttachedDatabase &db, string path, bool read_only, bool use_mmap = false,
+	                         string encryption_key = string());
 
 	//! The BlockManager to read/store meta information and data in blocks
 	unique_ptr<BlockManager> block_manager;
 	//! TableIoManager
 	unique_ptr<TableIOManager> table_io_manager;
+	//! Whether or not the database file is memory-mapped
+	bool use_mmap;
+	//! The key of the encrypted database file (empty if the file is not encrypted)
+	string encryption_key;
 
 public:
 	bool AutomaticCheckpoint(idx_t estimated_wal_bytes) override;
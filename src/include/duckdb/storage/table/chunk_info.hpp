@@ -21,7 +21,7 @@ struct DeleteInfo;
 class Serializer;
 class Deserializer;
 
-enum class ChunkInfoType : uint8_t { CONSTANT_INFO, VECTOR_INFO, EMPTY_INFO };
+enum class ChunkInfoType : uint8_t { CONSTANT_INFO, VECTOR_INFO, EMPTY_INFO, BITMAP_INFO };
 
 class ChunkInfo {
 public:
@@ -148,4 +148,45 @@ private:
 	                            idx_t max_count) const;
 };
 
+//! The ChunkBitmapInfo stores which rows of a vector are deleted as a bitmap. It is used once all inserts and deletes
+//! of the vector are visible to every transaction, so the transaction ids of the rows are no longer required.
+class ChunkBitmapInfo : public ChunkInfo {
+public:
+	static constexpr const ChunkInfoType TYPE = ChunkInfoType::BITMAP_INFO;
+	static constexpr const idx_t BITS_PER_WORD = 64;
+	static constexpr const idx_t WORD_COUNT = (STANDARD_VECTOR_SIZE + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+public:
+	explicit ChunkBitmapInfo(idx_t start);
+
+	//! Bit i is set if row i is deleted
+	uint64_t deleted[WORD_COUNT];
+
+public:
+	idx_t GetSelVector(TransactionData transaction, SelectionVector &sel_vector, idx_t max_count) override;
+	idx_t GetCommittedSelVector(transaction_t min_start_id, transaction_t min_transaction_id,
+	                            SelectionVector &sel_vector, idx_t max_count) override;
+	bool Fetch(TransactionData transaction, row_t row) override;
+	void CommitAppend(transaction_t commit_id, idx_t start, idx_t end) override;
+	idx_t GetCommittedDeletedCount(idx_t max_count) override;
+
+	bool HasDeletes() const override;
+
+	bool IsDeleted(idx_t row) const {
+		return deleted[row / BITS_PER_WORD] & (uint64_t(1) << (row % BITS_PER_WORD));
+	}
+	void SetDeleted(idx_t row) {
+		deleted[row / BITS_PER_WORD] |= uint64_t(1) << (row % BITS_PER_WORD);
+	}
+
+	//! Converts the bitmap back into a ChunkVectorInfo, so rows can be appended or deleted
+	unique_ptr<ChunkVectorInfo> ToVectorInfo() const;
+
+	void Write(WriteStream &writer) const override;
+	static unique_ptr<ChunkInfo> Read(ReadStream &reader);
+
+private:
+	idx_t GetSelVector(SelectionVector &sel_vector, idx_t max_count) const;
+};
+
 } // namespace duckdb
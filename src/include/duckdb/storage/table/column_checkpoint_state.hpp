@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/data_pointer.hpp"
@@ -25,6 +26,9 @@ class PartialBlockManager;
 class TableDataWriter;
 
 struct ColumnCheckpointState {
+	//! The storage version from which on Bloom filters are written
+	static constexpr const idx_t BLOOM_FILTER_SERIALIZATION_VERSION = 4;
+
 	ColumnCheckpointState(RowGroup &row_group, ColumnData &column_data, PartialBlockManager &partial_block_manager);
 	virtual ~ColumnCheckpointState();
 
@@ -33,13 +37,25 @@ struct ColumnCheckpointState {
 	ColumnSegmentTree new_tree;
 	vector<DataPointer> data_pointers;
 	unique_ptr<BaseStatistics> global_stats;
+	//! The Bloom filter over the values of the column (if any)
+	shared_ptr<BlockedBloomFilter> bloom_filter;
 
 protected:
 	PartialBlockManager &partial_block_manager;
+	//! Whether or not statistics are kept for every vector of the written segments
+	bool write_vector_statistics;
+	//! The statistics of every vector of rows that was written, starting at the vector that contains the first row
+	vector<BaseStatistics> vector_statistics;
+	idx_t vector_statistics_start;
 
 public:
 	virtual unique_ptr<BaseStatistics> GetStatistics();
 
+	//! Updates the vector statistics with the rows [row_start, row_start + count) that are about to be written
+	void UpdateVectorStatistics(Vector &scan_vector, idx_t row_start, idx_t count);
+	//! Inserts the values that are about to be written into the Bloom filter
+	void UpdateBloomFilter(Vector &scan_vector, idx_t count);
+
 	virtual void FlushSegment(unique_ptr<ColumnSegment> segment, idx_t segment_size);
 	virtual PersistentColumnData ToPersistentData();
 
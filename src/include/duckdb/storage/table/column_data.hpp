@@ -20,7 +20,9 @@
 #include "duckdb/common/serializer/serialization_traits.hpp"
 
 namespace duckdb {
+class BlockedBloomFilter;
 class ColumnData;
+class ColumnDictionary;
 class ColumnSegment;
 class DatabaseInstance;
 class RowGroup;
@@ -70,6 +72,9 @@ public:
 
 public:
 	virtual FilterPropagateResult CheckZonemap(ColumnScanState &state, TableFilter &filter);
+	//! Checks the filter against the vector statistics of the segment that contains the rows [row_start, row_start +
+	//! count) - returns FILTER_ALWAYS_FALSE only if none of the rows can match the filter
+	FilterPropagateResult CheckVectorZonemap(ColumnScanState &state, TableFilter &filter, idx_t row_start, idx_t count);
 
 	BlockManager &GetBlockManager() {
 		return block_manager;
@@ -87,6 +92,8 @@ public:
 	const LogicalType &RootType() const;
 	//! Whether or not the column has any updates
 	bool HasUpdates() const;
+	//! Whether or not any of the rows in the given range have updates
+	bool HasUpdates(idx_t row_start, idx_t count) const;
 	//! Whether or not we can scan an entire vector
 	virtual ScanVectorType GetVectorScanType(ColumnScanState &state, idx_t scan_count);
 
@@ -162,6 +169,8 @@ public:
 	virtual void Verify(RowGroup &parent);
 
 	FilterPropagateResult CheckZonemap(TableFilter &filter);
+	//! Returns the Bloom filter over the values of the column, if there is one
+	shared_ptr<BlockedBloomFilter> GetBloomFilter();
 
 	static shared_ptr<ColumnData> CreateColumn(BlockManager &block_manager, DataTableInfo &info, idx_t column_index,
 	                                           idx_t start_row, const LogicalType &type,
@@ -177,9 +186,19 @@ public:
 protected:
 	//! Append a transient segment
 	void AppendTransientSegment(SegmentLock &l, idx_t start_row);
+	//! Returns the dictionary that scans map the strings of dictionary-compressed segments to, if it is enabled
+	optional_ptr<ColumnDictionary> GetColumnDictionary();
 
 	//! Scans a base vector from the column
 	idx_t ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, ScanVectorType scan_type);
+	//! Positions the scan state at the current row index of the current segment
+	void BeginScanVectorInternal(ColumnScanState &state);
+	//! Whether or not the next "scan_count" rows are stored in the current segment, and the filter can be evaluated on
+	//! the compressed data of that segment
+	bool CanFilterInSegment(ColumnScanState &state, idx_t scan_count, const TableFilter &filter);
+	//! Scans the next vector while evaluating the filter on the compressed data of the current segment
+	void FilterInSegment(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel, idx_t &count,
+	                     const TableFilter &filter);
 	//! Scans a vector from the column merged with any potential updates
 	//! If ALLOW_UPDATES is set to false, the function will instead throw an exception if any updates are found
 	template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
@@ -206,6 +225,9 @@ protected:
 	mutable mutex stats_lock;
 	//! The stats of the root segment
 	unique_ptr<SegmentStatistics> stats;
+	//! The Bloom filter over the values of the column that was built during the last checkpoint (if any), also
+	//! protected by the stats lock
+	shared_ptr<BlockedBloomFilter> bloom_filter;
 	//! Total transient allocation size
 	idx_t allocation_size;
 };
@@ -225,6 +247,8 @@ struct PersistentColumnData {
 	vector<DataPointer> pointers;
 	vector<PersistentColumnData> child_columns;
 	bool has_updates = false;
+	//! The Bloom filter over the values of the column (optional)
+	shared_ptr<BlockedBloomFilter> bloom_filter;
 
 	void Serialize(Serializer &serializer) const;
 	static PersistentColumnData Deserialize(Deserializer &deserializer);
@@ -16,6 +16,12 @@ namespace duckdb {
 struct TableScanOptions;
 
 class ColumnDataCheckpointer {
+public:
+	//! Columns with at least this many vectors select their compression method on a sample of the vectors first
+	static constexpr const idx_t COMPRESSION_SAMPLE_MIN_VECTORS = 16;
+	//! One out of every COMPRESSION_SAMPLE_INTERVAL vectors is part of the sample
+	static constexpr const idx_t COMPRESSION_SAMPLE_INTERVAL = 4;
+
 public:
 	ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup &row_group_p, ColumnCheckpointState &state_p,
 	                       ColumnCheckpointInfo &checkpoint_info);
@@ -31,8 +37,14 @@ public:
 	CompressionFunction &GetCompressionFunction(CompressionType type);
 
 private:
-	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback);
+	//! Scans one out of every vector_interval vectors of the segments
+	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback, idx_t vector_interval = 1);
 	unique_ptr<AnalyzeState> DetectBestCompressionMethod(idx_t &compression_idx);
+	//! Runs the analyze step of the compression functions over all of the data, and returns the best method
+	unique_ptr<AnalyzeState> AnalyzeCompressionMethods(CompressionType forced_method, idx_t &compression_idx);
+	//! Returns the index of the compression function that compresses a sample of the vectors best, or
+	//! DConstants::INVALID_INDEX if the column is too small to be sampled
+	idx_t SampleCompressionMethods();
 	void WriteToDisk();
 	bool HasChanges();
 	void WritePersistentSegments();
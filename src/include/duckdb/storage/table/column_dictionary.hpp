@@ -0,0 +1,46 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/table/column_dictionary.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/string_map_set.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+//! A dictionary of the strings of a column that is shared by all dictionary-compressed segments of the column. Scans
+//! map the dictionaries of the segments to it, so that they emit dictionary vectors with codes that are the same for
+//! equal strings across segments and row groups. Codes are never removed or reassigned.
+class ColumnDictionary {
+public:
+	//! The maximum number of strings in the dictionary - segments with strings that do not fit are scanned as usual
+	static constexpr const idx_t MAXIMUM_SIZE = 65536;
+
+public:
+	ColumnDictionary();
+
+	//! Looks up (or adds) the codes of the "count" strings of a flat vector. Returns false if they do not all fit.
+	bool GetCodes(Vector &strings, idx_t count, sel_t *codes);
+	//! Slices the strings of the dictionary with a selection of codes that were handed out by GetCodes
+	void Slice(Vector &result, const SelectionVector &sel, idx_t count);
+
+private:
+	void Grow();
+
+private:
+	mutex lock;
+	//! The strings of the dictionary, in the order of their codes
+	unique_ptr<Vector> values;
+	idx_t size;
+	idx_t capacity;
+	//! The code of every string in the dictionary
+	string_map_t<sel_t> codes;
+};
+
+} // namespace duckdb
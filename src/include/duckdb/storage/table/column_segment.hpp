@@ -74,6 +74,30 @@ public:
 
 	static idx_t FilterSelection(SelectionVector &sel, Vector &vector, UnifiedVectorFormat &vdata,
 	                             const TableFilter &filter, idx_t scan_count, idx_t &approved_tuple_count);
+	//! Whether or not the filter can be evaluated on the compressed data of this segment
+	bool CanFilter(const TableFilter &filter) const;
+	//! Scan one entire vector from this segment, while evaluating the filter on the compressed data
+	void Filter(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel, idx_t &sel_count,
+	            const TableFilter &filter);
+	//! Evaluates the filter once for each of the 'count' values, and sets 'matches' for the values that pass it.
+	//! Used to evaluate a filter once per distinct value, e.g. per dictionary entry or per run.
+	static void FilterValues(Vector &values, idx_t count, const TableFilter &filter, bool *matches);
+	//! Whether or not the result of the filter for a value can change during a scan (e.g. dynamic filters)
+	static bool FilterIsDynamic(const TableFilter &filter);
+	//! Removes the rows for which "match(row)" is false from the selection vector
+	template <class MATCH>
+	static void RefineSelection(SelectionVector &sel, idx_t &sel_count, MATCH &&match) {
+		SelectionVector new_sel(sel_count);
+		idx_t result_count = 0;
+		for (idx_t i = 0; i < sel_count; i++) {
+			auto idx = sel.get_index(i);
+			if (match(idx)) {
+				new_sel.set_index(result_count++, idx);
+			}
+		}
+		sel.Initialize(new_sel);
+		sel_count = result_count;
+	}
 
 	//! Skip a scan forward to the row_index specified in the scan state
 	void Skip(ColumnScanState &state);
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/storage/table/column_dictionary.hpp"
 #include "duckdb/storage/table/table_index_list.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 
@@ -52,6 +53,9 @@ public:
 	string GetTableName();
 	void SetTableName(string name);
 
+	//! Returns the dictionary that the dictionary-compressed segments of the column are mapped to
+	ColumnDictionary &GetColumnDictionary(idx_t column_index);
+
 private:
 	//! The database instance of the table
 	AttachedDatabase &db;
@@ -69,6 +73,10 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! Lock for creating column dictionaries
+	mutex dictionary_lock;
+	//! The column dictionaries, created when they are first used
+	vector<unique_ptr<ColumnDictionary>> column_dictionaries;
 };
 
 } // namespace duckdb
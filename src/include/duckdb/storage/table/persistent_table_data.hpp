@@ -26,6 +26,14 @@ public:
 	idx_t total_rows;
 	idx_t row_group_count;
 	MetaBlockPointer block_pointer;
+	//! The pointer to the table statistics and row group pointers, if they have not been read yet.
+	//! Tables are loaded lazily: their statistics and row group pointers are only read when they are first accessed
+	MetaBlockPointer table_pointer;
+
+public:
+	bool IsLoaded() const {
+		return !table_pointer.IsValid();
+	}
 };
 
 } // namespace duckdb
@@ -68,6 +68,9 @@ class RowGroup : public SegmentBase<RowGroup> {
 public:
 	friend class ColumnData;
 
+	//! Row groups with at least this many columns checkpoint their columns in parallel
+	static constexpr const idx_t PARALLEL_CHECKPOINT_COLUMN_COUNT = 8;
+
 public:
 	RowGroup(RowGroupCollection &collection, idx_t start, idx_t count);
 	RowGroup(RowGroupCollection &collection, RowGroupPointer pointer);
@@ -134,11 +137,15 @@ public:
 	void RevertAppend(idx_t start);
 	//! Clean up append states that can either be compressed or deleted
 	void CleanupAppend(transaction_t lowest_transaction, idx_t start, idx_t count);
+	//! Compress the version info of the vector containing the given row once its deletes are visible to everyone
+	void CleanupDelete(transaction_t lowest_transaction, idx_t row);
 
 	//! Delete the given set of rows in the version manager
 	idx_t Delete(TransactionData transaction, DataTable &table, row_t *row_ids, idx_t count);
 
 	RowGroupWriteData WriteToDisk(RowGroupWriteInfo &info);
+	//! Checkpoints a single column of the row group - different columns can be checkpointed concurrently
+	unique_ptr<ColumnCheckpointState> CheckpointColumn(RowGroupWriteInfo &info, idx_t column_idx);
 	//! Returns the number of committed rows (count - committed deletes)
 	idx_t GetCommittedRowCount();
 	RowGroupWriteData WriteToDisk(RowGroupWriter &writer);
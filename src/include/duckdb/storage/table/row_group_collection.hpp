@@ -39,6 +39,7 @@ class RowGroupCollection {
 public:
 	RowGroupCollection(shared_ptr<DataTableInfo> info, BlockManager &block_manager, vector<LogicalType> types,
 	                   idx_t row_start, idx_t total_rows = 0);
+	~RowGroupCollection();
 
 public:
 	idx_t GetTotalRows() const;
@@ -47,6 +48,8 @@ public:
 	void Initialize(PersistentCollectionData &data);
 	void Initialize(PersistentTableData &data);
 	void InitializeEmpty();
+	//! Reads the statistics and row group pointers of a lazily loaded table from disk, if they have not been read yet
+	PersistentTableData &LoadTableData();
 
 	bool IsEmpty() const;
 
@@ -69,7 +72,8 @@ public:
 	bool Scan(DuckTransaction &transaction, const std::function<bool(DataChunk &chunk)> &fun);
 
 	void Fetch(TransactionData transaction, DataChunk &result, const vector<column_t> &column_ids,
-	           const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state);
+	           const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state,
+	           optional_ptr<SelectionVector> fetch_sel = nullptr);
 
 	//! Initialize an append of a variable number of rows. FinalizeAppend must be called after appending is done.
 	void InitializeAppend(TableAppendState &state);
@@ -83,6 +87,7 @@ public:
 	void CommitAppend(transaction_t commit_id, idx_t row_start, idx_t count);
 	void RevertAppendInternal(idx_t start_row);
 	void CleanupAppend(transaction_t lowest_transaction, idx_t start, idx_t count);
+	void CleanupDelete(transaction_t lowest_transaction, idx_t row);
 
 	void MergeStorage(RowGroupCollection &data, optional_ptr<DataTable> table,
 	                  optional_ptr<StorageCommitState> commit_state);
@@ -119,6 +124,10 @@ public:
 	void CopyStats(TableStatistics &stats);
 	unique_ptr<BaseStatistics> CopyStats(column_t column_id);
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
+	unique_ptr<HistogramStatistics> CopyHistogram(column_t column_id);
+	void SetHistogram(column_t column_id, unique_ptr<HistogramStatistics> histogram);
+	idx_t GetStatisticsVersion();
+	unique_ptr<ReservoirSample> GetSample();
 
 	AttachedDatabase &GetAttached();
 	BlockManager &GetBlockManager() {
@@ -135,6 +144,8 @@ public:
 
 private:
 	bool IsEmpty(SegmentLock &) const;
+	//! Returns the table statistics, reading them from disk first if the table is loaded lazily
+	TableStatistics &Stats();
 
 private:
 	//! BlockManager
@@ -152,6 +163,13 @@ private:
 	TableStatistics stats;
 	//! Allocation size, only tracked for appends
 	idx_t allocation_size;
+	//! The persistent data of a table that is loaded lazily, i.e. whose statistics and row group pointers are only
+	//! read from disk when they are first accessed
+	unique_ptr<PersistentTableData> lazy_data;
+	//! Whether or not the statistics and row group pointers of the table have been read
+	atomic<bool> lazy_data_loaded;
+	//! Lock for reading the lazily loaded table data
+	mutex lazy_data_lock;
 };
 
 } // namespace duckdb
@@ -22,6 +22,8 @@ public:
 	~RowGroupSegmentTree() override;
 
 	void Initialize(PersistentTableData &data);
+	//! Initialize the row groups of a table whose row group pointers have not been read yet
+	void InitializeLazy();
 
 protected:
 	unique_ptr<RowGroup> LoadSegment() override;
@@ -30,6 +32,8 @@ protected:
 	idx_t current_row_group;
 	idx_t max_row_group;
 	unique_ptr<MetadataReader> reader;
+	//! Whether the row group pointers still have to be read, see RowGroupCollection::LoadTableData
+	bool load_table_data;
 };
 
 } // namespace duckdb
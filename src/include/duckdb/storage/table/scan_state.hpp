@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/map.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
@@ -31,11 +32,14 @@ class ColumnSegmentTree;
 class ValiditySegment;
 class TableFilterSet;
 class ColumnData;
+class ColumnDictionary;
 class DuckTransaction;
 class RowGroupSegmentTree;
 class TableFilter;
 struct AdaptiveFilterState;
 struct TableScanOptions;
+struct SampleOptions;
+class ClientContext;
 
 struct SegmentScanState {
 	virtual ~SegmentScanState() {
@@ -95,6 +99,8 @@ struct ColumnScanState {
 	idx_t last_offset = 0;
 	//! Contains TableScan level config for scanning
 	optional_ptr<TableScanOptions> scan_options;
+	//! The dictionary that the strings of dictionary-compressed segments are mapped to (if any)
+	optional_ptr<ColumnDictionary> column_dictionary;
 
 public:
 	void Initialize(const LogicalType &type, optional_ptr<TableScanOptions> options);
@@ -126,6 +132,40 @@ struct ScanFilter {
 	}
 };
 
+//! The row ranges of a table that can contain rows passing the filters of a scan, as determined by an index.
+//! Scans skip the vectors that do not overlap any qualifying range.
+struct ScanRowRanges {
+	explicit ScanRowRanges(idx_t range_size) : range_size(range_size) {
+	}
+
+	//! The number of rows per range
+	idx_t range_size;
+	//! Whether each range can contain qualifying rows. The rows after the last range always qualify
+	unsafe_vector<bool> qualifying;
+
+	//! Returns true, if any row in [row_start, row_start + count) can qualify
+	bool ContainsRows(idx_t row_start, idx_t count) const;
+};
+
+//! A system sample that is pushed down into a scan. Every block of rows (a vector of a table, or a range of a row
+//! group of a file) is part of the sample with the sample rate, as decided by a hash of its position and the seed.
+//! Which blocks are scanned therefore does not depend on how the scan is parallelized.
+struct ScanSamplingInfo {
+	ScanSamplingInfo(double sample_rate, hash_t seed);
+
+	//! The fraction of the blocks that is part of the sample
+	double sample_rate;
+	hash_t seed;
+
+	//! Creates the sampling info of sample options, with a random seed if the options do not specify one
+	static shared_ptr<ScanSamplingInfo> Create(ClientContext &context, const SampleOptions &options);
+
+	//! Whether the block of rows at a position is part of the sample
+	bool IsSampled(hash_t position) const;
+	//! Returns true, if any vector of the table overlapping [row_start, row_start + count) is part of the sample
+	bool ContainsRows(idx_t row_start, idx_t count) const;
+};
+
 class ScanFilterInfo {
 public:
 	~ScanFilterInfo();
@@ -138,7 +178,8 @@ public:
 
 	optional_ptr<AdaptiveFilter> GetAdaptiveFilter();
 	AdaptiveFilterState BeginFilter() const;
-	void EndFilter(AdaptiveFilterState state);
+	void EndPredicate(AdaptiveFilterState &state, idx_t idx, idx_t tuples_in, idx_t tuples_out);
+	void EndFilter();
 
 	//! Whether or not there is any filter we need to execute
 	bool HasFilters() const;
@@ -152,6 +193,13 @@ public:
 	//! We do not need to execute them anymore until CheckAllFilters is called
 	void SetFilterAlwaysTrue(idx_t filter_idx);
 
+	//! Restricts the scan to rows within the qualifying row ranges
+	void AddRowRanges(shared_ptr<ScanRowRanges> ranges);
+	//! Restricts the scan to the vectors that are part of a system sample
+	void SetSampling(shared_ptr<ScanSamplingInfo> sampling);
+	//! Returns false, if no row in [row_start, row_start + count) can pass the filters (or be part of the sample)
+	bool CanContainRows(idx_t row_start, idx_t count) const;
+
 private:
 	//! The table filters (if any)
 	optional_ptr<TableFilterSet> table_filters;
@@ -165,6 +213,10 @@ private:
 	unsafe_vector<bool> base_column_has_filter;
 	//! The amount of filters that are always true currently
 	idx_t always_true_filters = 0;
+	//! The row ranges that can contain rows passing the filters
+	vector<shared_ptr<ScanRowRanges>> row_ranges;
+	//! The system sample the scan is restricted to (if any)
+	shared_ptr<ScanSamplingInfo> sampling;
 };
 
 class CollectionScanState {
@@ -175,6 +227,8 @@ public:
 	RowGroup *row_group;
 	//! The vector index within the row_group
 	idx_t vector_index;
+	//! The vector index up to which the blocks of the row_group have been prefetched
+	idx_t prefetch_vector_index;
 	//! The maximum row within the row group
 	idx_t max_row_group_row;
 	//! Child column scans
@@ -187,6 +241,10 @@ public:
 	idx_t batch_index;
 	//! The valid selection
 	SelectionVector valid_sel;
+	//! The number of rows in the morsel handed out by the last parallel scan call
+	idx_t morsel_rows;
+	//! The time at which that morsel was handed out
+	time_point<high_resolution_clock> morsel_start;
 
 public:
 	void Initialize(const vector<LogicalType> &types);
@@ -246,6 +304,14 @@ private:
 struct ParallelCollectionScanState {
 	ParallelCollectionScanState();
 
+	//! Every thread gets at least this many morsels over the remaining rows of a parallel scan. Morsels are therefore
+	//! shrinking towards the end of the scan, which balances the tail over the threads.
+	static constexpr idx_t MORSELS_PER_THREAD = 4;
+	//! The minimum amount of vectors handed out at a time, avoids per-morsel overhead dominating small scans
+	static constexpr idx_t MIN_MORSEL_VECTOR_COUNT = 4;
+	//! Morsels are kept below this runtime (as observed for earlier morsels), so expensive pipelines split up finer
+	static constexpr int64_t TARGET_MORSEL_NANOS = 10000000;
+
 	//! The row group collection we are scanning
 	RowGroupCollection *collection;
 	RowGroup *current_row_group;
@@ -253,6 +319,8 @@ struct ParallelCollectionScanState {
 	idx_t max_row;
 	idx_t batch_index;
 	atomic<idx_t> processed_rows;
+	//! Running average of the observed time spent per row of a morsel (0 if nothing was observed yet)
+	double nanos_per_row;
 	mutex lock;
 };
 
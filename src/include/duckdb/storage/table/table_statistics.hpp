@@ -15,7 +15,6 @@
 #include "duckdb/storage/statistics/column_statistics.hpp"
 
 namespace duckdb {
-class ColumnList;
 class PersistentTableData;
 class Serializer;
 class Deserializer;
@@ -45,24 +44,36 @@ public:
 	void CopyStats(TableStatistics &other);
 	void CopyStats(TableStatisticsLock &lock, TableStatistics &other);
 	unique_ptr<BaseStatistics> CopyStats(idx_t i);
+	//! Copies the histogram of the given column - returns nullptr if the column has no histogram
+	unique_ptr<HistogramStatistics> CopyHistogram(idx_t i);
 	//! Get a reference to the stats - this requires us to hold the lock.
 	//! The reference can only be safely accessed while the lock is held
 	ColumnStatistics &GetStats(TableStatisticsLock &lock, idx_t i);
+	//! Adds the rows of an appended chunk to the table sample
+	void AddToSample(TableStatisticsLock &lock, DataChunk &chunk);
+	//! Merges the table sample of the statistics of another (disjoint) set of rows into the table sample
+	void MergeSample(TableStatisticsLock &lock, TableStatistics &other);
+	//! Copies the table sample - returns nullptr if no rows have been sampled
+	unique_ptr<ReservoirSample> CopySample();
+	//! Returns a counter that is incremented whenever the statistics (might) change
+	idx_t GetVersion();
 
 	bool Empty();
 
 	unique_ptr<TableStatisticsLock> GetLock();
 
 	void Serialize(Serializer &serializer) const;
-	void Deserialize(Deserializer &deserializer, ColumnList &columns);
+	//! Deserializes the statistics of a table with the given physical column types
+	void Deserialize(Deserializer &deserializer, const vector<LogicalType> &types);
 
 private:
 	//! The statistics lock
 	shared_ptr<mutex> stats_lock;
 	//! Column statistics
 	vector<shared_ptr<ColumnStatistics>> column_stats;
-	//! The table sample
-	//! Sample for table
+	//! The version of the statistics, protected by the stats lock
+	idx_t version = 0;
+	//! A fixed-size sample of the rows that were appended to the table, maintained in-memory only
 	unique_ptr<BlockingSample> table_sample;
 };
 
@@ -12,6 +12,7 @@
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/storage/block_encryption.hpp"
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
@@ -27,7 +28,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t slot_size);
 	BlockIndexManager();
 
 public:
@@ -45,6 +46,8 @@ private:
 
 private:
 	idx_t max_index;
+	//! The size on disk of every block index
+	idx_t slot_size;
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
@@ -75,7 +78,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    TemporaryFileManager &manager, idx_t slot_size);
 
 public:
 	struct TemporaryFileLock {
@@ -88,8 +91,17 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
-	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, block_id_t block_id);
+	//! Writes a compressed block, which starts with the size of its compressed data (and its synthetic IV if the file
+	//! is encrypted). Encrypted blocks are encrypted in place.
+	void WriteCompressedTemporaryFile(data_ptr_t data, idx_t size, TemporaryFileIndex index, block_id_t block_id);
+	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t block_id, idx_t block_index,
+	                                           unique_ptr<FileBuffer> reusable_buffer);
+	//! The size of the slot of every block in the file, files with a slot size below the block allocation size
+	//! contain compressed blocks
+	idx_t GetSlotSize() const {
+		return slot_size;
+	}
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
@@ -104,9 +116,12 @@ private:
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
+	idx_t slot_size;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
+	//! The encryption of the blocks in the file, if temporary files are encrypted
+	optional_ptr<BlockEncryption> encryption;
 };
 
 //===--------------------------------------------------------------------===//
@@ -145,7 +160,12 @@ public:
 		lock_guard<mutex> lock;
 	};
 
-	void WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer);
+	//! Compressed blocks are stored in files whose slots are a multiple of this size
+	static constexpr idx_t COMPRESSED_SLOT_ALIGNMENT = 32768ULL;
+	//! The maximum number of blocks of a memory tag that are written uncompressed after failing to compress a block
+	static constexpr idx_t MAX_COMPRESSION_BACKOFF = 64ULL;
+
+	void WriteTemporaryBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer);
 	bool HasTemporaryBuffer(block_id_t block_id);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, unique_ptr<FileBuffer> reusable_buffer);
 	void DeleteTemporaryBuffer(block_id_t id);
@@ -157,6 +177,11 @@ public:
 	void IncreaseSizeOnDisk(idx_t amount);
 	//! Register temporary file size decrease
 	void DecreaseSizeOnDisk(idx_t amount);
+	//! Returns the encryption of the temporary files, if temp_file_encryption was enabled when the temporary
+	//! directory was first used
+	optional_ptr<BlockEncryption> GetEncryption() {
+		return encryption.get();
+	}
 
 private:
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
@@ -164,6 +189,9 @@ private:
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
 	TemporaryFileIndex GetTempBlockIndex(TemporaryManagerLock &, block_id_t id);
 	void EraseFileHandle(TemporaryManagerLock &, idx_t file_index);
+	//! Compresses the buffer if temp_file_compression is enabled and the buffer compresses to a smaller slot.
+	//! Returns the compressed size (including the header), or 0 if the buffer should be written uncompressed.
+	idx_t CompressBuffer(MemoryTag tag, FileBuffer &buffer, AllocatedData &compressed);
 
 private:
 	DatabaseInstance &db;
@@ -180,6 +208,12 @@ private:
 	atomic<idx_t> size_on_disk;
 	//! The max amount of disk space that can be used
 	idx_t max_swap_space;
+	//! The number of upcoming blocks of every memory tag that are written without trying to compress them
+	atomic<idx_t> compression_skip[MEMORY_TAG_COUNT];
+	//! The number of blocks to skip after the next block that does not compress, doubles on every failure
+	atomic<idx_t> compression_backoff[MEMORY_TAG_COUNT];
+	//! The encryption of the temporary files with an ephemeral key, if temporary files are encrypted
+	unique_ptr<BlockEncryption> encryption;
 };
 
 } // namespace duckdb
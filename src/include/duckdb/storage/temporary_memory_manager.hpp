@@ -11,6 +11,7 @@
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/reference_map.hpp"
+#include "duckdb/common/vector.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
 namespace duckdb {
@@ -18,6 +19,18 @@ namespace duckdb {
 class ClientContext;
 class TemporaryMemoryManager;
 
+//! A point on the cost curve of a TemporaryMemoryState
+struct TemporaryMemoryCost {
+	TemporaryMemoryCost(idx_t reservation_p, idx_t expected_io_p)
+	    : reservation(reservation_p), expected_io(expected_io_p) {
+	}
+
+	//! The reservation
+	idx_t reservation;
+	//! The expected I/O (bytes written to and read from temporary files) if the state gets at least this reservation
+	idx_t expected_io;
+};
+
 //! State of the temporary memory to be managed concurrently with other states
 //! As long as this is within scope, it is active
 class TemporaryMemoryState {
@@ -50,6 +63,17 @@ public:
 	void SetMaterializationPenalty(idx_t new_materialization_penalty);
 	//! Get the materialization penalty for this state
 	idx_t GetMaterializationPenalty() const;
+	//! Set the cost curve for this state, sorted by reservation and starting at 0 (NOTE: does not update the
+	//! reservation!). Without a cost curve, the expected I/O is assumed to be linear in the part of the remaining size
+	//! that does not fit
+	void SetCostCurve(vector<TemporaryMemoryCost> new_cost_curve);
+	//! Whether other states released memory since the reservation of this state was last updated, i.e., whether
+	//! calling UpdateReservation could increase the reservation
+	bool CanRebalance() const;
+
+private:
+	//! Get the expected I/O of this state for the given reservation (must hold the lock)
+	double GetExpectedIO(idx_t for_reservation) const;
 
 private:
 	//! The TemporaryMemoryManager that owns this state
@@ -63,6 +87,10 @@ private:
 	atomic<idx_t> reservation;
 	//! The weight used for determining the reservation for this state
 	atomic<idx_t> materialization_penalty;
+	//! The expected I/O for increasing reservations (protected by the lock of the TemporaryMemoryManager)
+	vector<TemporaryMemoryCost> cost_curve;
+	//! The rebalance generation of the TemporaryMemoryManager when the reservation was last updated
+	atomic<idx_t> rebalance_generation;
 };
 
 //! TemporaryMemoryManager is a one-of class owned by the buffer pool that tries to dynamically assign memory
@@ -110,6 +138,8 @@ private:
 	void SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation);
 	//! Computes optimal reservation of a TemporaryMemoryState based on a cost function
 	idx_t ComputeReservation(const TemporaryMemoryState &temporary_memory_state) const;
+	//! Computes the reservation of a TemporaryMemoryState by greedily assigning memory where it saves the most I/O
+	idx_t ComputeReservationFromCostCurves(const TemporaryMemoryState &temporary_memory_state) const;
 	//! Verify internal counts (must hold the lock)
 	void Verify() const;
 
@@ -132,6 +162,8 @@ private:
 	idx_t reservation;
 	//! The sum of the remaining size of all active states
 	idx_t remaining_size;
+	//! Incremented whenever a state releases (part of) its reservation
+	atomic<idx_t> rebalance_generation;
 };
 
 } // namespace duckdb
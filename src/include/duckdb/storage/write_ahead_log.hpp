@@ -20,11 +20,14 @@
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
 
 class AttachedDatabase;
+class BlockEncryption;
 class Catalog;
 class DatabaseInstance;
 class SchemaCatalogEntry;
@@ -63,6 +66,8 @@ public:
 	}
 	//! Initializes the file of the WAL by creating the file writer.
 	BufferedFileWriter &Initialize();
+	//! Returns the encryption of the database file, which also encrypts the WAL entries, or nullptr
+	optional_ptr<const BlockEncryption> GetEncryption();
 
 	void WriteVersion();
 
@@ -113,6 +118,14 @@ public:
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
 	void Flush();
+	//! Marks the end of a committed transaction and writes it to the WAL file without syncing it. Returns the sequence
+	//! number to pass to SyncCommit.
+	idx_t FlushCommit();
+	//! Waits until the commit with the given sequence number is synced to disk. Concurrent committers are synced
+	//! together: one of them syncs the WAL on behalf of everything that was flushed before it started (group commit).
+	void SyncCommit(idx_t commit_sequence);
+	//! Syncs all commits that have been flushed but not yet synced
+	void SyncCommits();
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -123,6 +136,15 @@ protected:
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<bool> initialized;
+	//! The sequence number of the last commit that was flushed to the WAL file
+	atomic<idx_t> flushed_commit_sequence;
+	//! Protects the group commit state below
+	mutex sync_lock;
+	std::condition_variable sync_cv;
+	//! The sequence number of the last commit that was synced to disk
+	idx_t synced_commit_sequence = 0;
+	//! Whether or not a committer is currently syncing the WAL
+	bool sync_in_progress = false;
 };
 
 } // namespace duckdb
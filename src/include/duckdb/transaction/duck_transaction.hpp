@@ -9,9 +9,11 @@
 #pragma once
 
 #include "duckdb/transaction/transaction.hpp"
+#include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/reference_map.hpp"
 
 namespace duckdb {
+class CatalogSet;
 class CheckpointLock;
 class RowGroupCollection;
 class RowVersionManager;
@@ -48,11 +50,14 @@ public:
 	void SetReadWrite() override;
 
 	bool ShouldWriteToWAL(AttachedDatabase &db);
+	//! Prepares the commit of the transaction. This is called before the commit is serialized with other commits,
+	//! hence it must not take any lock that is shared with other transactions
+	ErrorData PrepareCommit() noexcept;
 	ErrorData WriteToWAL(AttachedDatabase &db, unique_ptr<StorageCommitState> &commit_state) noexcept;
 	//! Commit the current transaction with the given commit identifier. Returns an error message if the transaction
 	//! commit failed, or an empty string if the commit was sucessful
 	ErrorData Commit(AttachedDatabase &db, transaction_t commit_id,
-	                 unique_ptr<StorageCommitState> commit_state) noexcept;
+	                 optional_ptr<StorageCommitState> commit_state) noexcept;
 	//! Returns whether or not a commit of this transaction should trigger an automatic checkpoint
 	bool AutomaticCheckpoint(AttachedDatabase &db, const UndoBufferProperties &properties);
 
@@ -84,6 +89,12 @@ public:
 	//! Get a shared lock on a table
 	shared_ptr<CheckpointLock> SharedLockTable(DataTableInfo &info);
 
+	//! Returns the entry of the catalog set that this transaction looked up before, if the catalog set still has the
+	//! same version, and nullptr otherwise
+	optional_ptr<CatalogEntry> GetCachedCatalogEntry(CatalogSet &set, const string &name, idx_t set_version);
+	//! Caches an entry of the catalog set that is valid for this transaction
+	void CacheCatalogEntry(CatalogSet &set, const string &name, idx_t set_version, CatalogEntry &entry);
+
 private:
 	DuckTransactionManager &transaction_manager;
 	//! The undo buffer is used to store old versions of rows that are updated
@@ -103,6 +114,10 @@ private:
 	mutex active_locks_lock;
 	//! Active locks on tables
 	reference_map_t<DataTableInfo, weak_ptr<CheckpointLock>> active_locks;
+	//! Lock for the catalog_cache map
+	mutex catalog_cache_lock;
+	//! Catalog entries looked up by this transaction, and the version of their catalog set at the time of the lookup
+	reference_map_t<CatalogSet, case_insensitive_map_t<pair<idx_t, reference<CatalogEntry>>>> catalog_cache;
 };
 
 } // namespace duckdb
@@ -11,6 +11,7 @@
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/enums/checkpoint_type.hpp"
+#include "duckdb/common/deque.hpp"
 
 namespace duckdb {
 class DuckTransaction;
@@ -33,6 +34,16 @@ public:
 	void RollbackTransaction(Transaction &transaction) override;
 
 	void Checkpoint(ClientContext &context, bool force = false) override;
+	//! Checkpoints the database on behalf of the background checkpointer. Never waits for write transactions, and
+	//! yields to active read transactions until the WAL has grown to twice the checkpoint threshold. Returns false if
+	//! the checkpoint was postponed.
+	bool TryBackgroundCheckpoint();
+	//! Syncs the commits that were written to the WAL without waiting for the sync (synchronous_commit=false)
+	void SyncWAL();
+	//! Cleans up the version information of finished transactions that is no longer required by any transaction.
+	//! Cleans up one transaction at a time without holding the transaction lock, and returns right away if another
+	//! thread is already cleaning up.
+	void CleanupTransactions();
 
 	transaction_t LowestActiveId() const {
 		return lowest_active_id;
@@ -43,6 +54,11 @@ public:
 	transaction_t GetLastCommit() const {
 		return last_commit;
 	}
+	//! The commit timestamp of the last committed transaction that made changes
+	//! If this is smaller than the start time of a transaction, the transaction sees all committed changes
+	transaction_t GetLastChangeCommit() const {
+		return last_change_commit;
+	}
 
 	bool IsDuckTransactionManager() override {
 		return true;
@@ -69,6 +85,15 @@ protected:
 		CheckpointType type;
 	};
 
+	//! A finished transaction that is waiting for its version information to be cleaned up
+	struct PendingCleanup {
+		unique_ptr<DuckTransaction> transaction;
+		//! The lowest start time of any active transaction when the transaction was queued
+		transaction_t lowest_active_start;
+		//! Whether or not the transaction needs to be kept around until running queries have finished
+		bool store_transaction;
+	};
+
 private:
 	//! Generates a new commit timestamp
 	transaction_t GetCommitTimestamp();
@@ -77,6 +102,12 @@ private:
 	//! Remove the given transaction from the list of active transactions
 	void RemoveTransaction(DuckTransaction &transaction, bool store_transaction) noexcept;
 
+	//! Cleans up the version information of finished transactions in the background if the background checkpointer
+	//! is running, or in the calling thread otherwise. The transaction lock must not be held.
+	void ScheduleCleanup();
+	//! Cleans up all queued transactions - the cleanup lock must be held
+	void CleanupTransactionsInternal();
+
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
@@ -92,12 +123,16 @@ private:
 	atomic<transaction_t> lowest_active_start;
 	//! The last commit timestamp
 	atomic<transaction_t> last_commit;
+	//! The last commit timestamp of a transaction that made changes
+	atomic<transaction_t> last_change_commit;
 	//! Set of currently running transactions
 	vector<unique_ptr<DuckTransaction>> active_transactions;
 	//! Set of recently committed transactions
 	vector<unique_ptr<DuckTransaction>> recently_committed_transactions;
 	//! Transactions awaiting GC
 	vector<unique_ptr<DuckTransaction>> old_transactions;
+	//! Finished transactions whose version information still needs to be cleaned up, in the order they finished
+	deque<PendingCleanup> cleanup_queue;
 	//! The lock used for transaction operations
 	mutex transaction_lock;
 	//! The checkpoint lock
@@ -106,6 +141,9 @@ private:
 	mutex start_transaction_lock;
 	//! Mutex used to control writes to the WAL - separate from the transaction lock
 	mutex wal_lock;
+	//! Held while cleaning up transactions, serializes the cleanup with checkpoints. Must be obtained before the
+	//! transaction lock
+	mutex cleanup_lock;
 
 	atomic<idx_t> last_uncommitted_catalog_version = {TRANSACTION_ID_START};
 	idx_t last_committed_version = 0;
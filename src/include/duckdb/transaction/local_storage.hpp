@@ -55,12 +55,18 @@ public:
 	bool merged_storage = false;
 	//! Whether or not the storage was dropped
 	bool is_dropped = false;
+	//! Whether or not the last row group was written to disk
+	bool wrote_last_row_group = false;
 
 public:
 	void InitializeScan(CollectionScanState &state, optional_ptr<TableFilterSet> table_filters = nullptr);
 	//! Write a new row group to disk (if possible)
 	void WriteNewRowGroup();
+	//! Write the last row group to disk (if possible)
+	void WriteLastRowGroup();
 	void FlushBlocks();
+	//! Whether the storage is merged into the table as-is when committing, regardless of the table contents
+	bool IsBulkAppend();
 	void Rollback();
 	idx_t EstimatedSize();
 
@@ -83,6 +89,8 @@ public:
 	idx_t EstimatedSize();
 	bool IsEmpty();
 	void InsertEntry(DataTable &table, shared_ptr<LocalTableStorage> entry);
+	//! Returns all entries, without moving them out of the manager
+	vector<shared_ptr<LocalTableStorage>> GetEntries();
 
 private:
 	mutex table_storage_lock;
@@ -136,6 +144,8 @@ public:
 	//! Update a set of rows in the local storage
 	void Update(DataTable &table, Vector &row_ids, const vector<PhysicalIndex> &column_ids, DataChunk &data);
 
+	//! Prepares the commit of the local storage, without holding any lock of the tables or the WAL
+	void PrepareCommit();
 	//! Commits the local storage, writing it to the WAL and completing the commit
 	void Commit(optional_ptr<StorageCommitState> commit_state);
 	//! Rollback the local storage
@@ -157,7 +167,7 @@ public:
 
 	void MoveStorage(DataTable &old_dt, DataTable &new_dt);
 	void FetchChunk(DataTable &table, Vector &row_ids, idx_t count, const vector<column_t> &col_ids, DataChunk &chunk,
-	                ColumnFetchState &fetch_state);
+	                ColumnFetchState &fetch_state, optional_ptr<SelectionVector> fetch_sel = nullptr);
 	TableIndexList &GetIndexes(DataTable &table);
 
 	void VerifyNewConstraint(DataTable &parent, const BoundConstraint &constraint);
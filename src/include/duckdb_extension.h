@@ -486,6 +486,16 @@ typedef struct {
 	duckdb_data_chunk (*duckdb_stream_fetch_chunk)(duckdb_result result);
 #endif
 
+#ifdef DUCKDB_EXTENSION_API_VERSION_DEV // dev
+	// WARNING! the functions below are not (yet) stable
+
+	duckdb_data_chunk (*duckdb_fetch_chunk_batch)(duckdb_result result, idx_t min_rows);
+	duckdb_state (*duckdb_pending_set_ready_callback)(duckdb_pending_result pending_result,
+	                                                  duckdb_pending_ready_callback_t callback, void *user_data);
+	duckdb_state (*duckdb_execute_prepared_batch)(duckdb_prepared_statement prepared_statement,
+	                                              duckdb_data_chunk parameters, duckdb_result *out_result);
+#endif
+
 } duckdb_ext_api_v0;
 
 //===--------------------------------------------------------------------===//
@@ -865,6 +875,11 @@ typedef struct {
 #define duckdb_register_cast_function               duckdb_ext_api.duckdb_register_cast_function
 #define duckdb_destroy_cast_function                duckdb_ext_api.duckdb_destroy_cast_function
 
+// Version dev
+#define duckdb_fetch_chunk_batch          duckdb_ext_api.duckdb_fetch_chunk_batch
+#define duckdb_pending_set_ready_callback duckdb_ext_api.duckdb_pending_set_ready_callback
+#define duckdb_execute_prepared_batch     duckdb_ext_api.duckdb_execute_prepared_batch
+
 //===--------------------------------------------------------------------===//
 // Struct Global Macros
 //===--------------------------------------------------------------------===//
@@ -12,6 +12,12 @@
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/optimistic_data_writer.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table/row_group_collection.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/planner/expression_binder/constant_binder.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/execution/expression_executor.hpp"
@@ -433,4 +439,177 @@ void BaseAppender::Close() {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Parallel Appender
+//===--------------------------------------------------------------------===//
+LocalParallelAppender::LocalParallelAppender(ParallelAppender &parent_p)
+    : BaseAppender(Allocator::DefaultAllocator(), parent_p.table->GetTypes(), AppenderType::LOGICAL,
+                   STANDARD_VECTOR_SIZE),
+      parent(parent_p), append_state(make_uniq<TableAppendState>()) {
+}
+
+LocalParallelAppender::~LocalParallelAppender() {
+	// rows that were not flushed before the ParallelAppender was committed are discarded
+}
+
+void LocalParallelAppender::FlushInternal(ColumnDataCollection &collection) {
+	auto &table = *parent.table;
+	auto &storage = table.GetStorage();
+	if (!local_collection) {
+		lock_guard<mutex> guard(parent.lock);
+		if (parent.finished) {
+			throw InvalidInputException("Failed to append: the parallel appender was already committed or rolled back");
+		}
+		auto &block_manager = TableIOManager::Get(storage).GetBlockManagerForRowData();
+		local_collection = make_uniq<RowGroupCollection>(storage.GetDataTableInfo(), block_manager, table.GetTypes(),
+		                                                 NumericCast<idx_t>(MAX_ROW_ID));
+		local_collection->InitializeEmpty();
+		local_collection->InitializeAppend(*append_state);
+		writer = &storage.CreateOptimisticWriter(*parent.context);
+		constraint_state = storage.InitializeConstraintState(table, parent.bound_constraints);
+	}
+	for (auto &chunk : collection.Chunks()) {
+		storage.VerifyAppendConstraints(*constraint_state, *parent.context, chunk);
+		auto new_row_group = local_collection->Append(chunk, *append_state);
+		if (new_row_group) {
+			// a row group was filled up - write it to disk
+			writer->WriteNewRowGroup(*local_collection);
+		}
+	}
+}
+
+ParallelAppender::ParallelAppender(Connection &con, const string &schema_name, const string &table_name)
+    : context(con.context), owns_transaction(false), finished(false) {
+	if (context->transaction.IsAutoCommit()) {
+		// all rows are committed as a single transaction
+		auto result = context->Query("BEGIN TRANSACTION", false);
+		if (result->HasError()) {
+			result->ThrowError();
+		}
+		owns_transaction = true;
+	}
+	try {
+		context->RunFunctionInTransaction([&]() {
+			auto &table_entry =
+			    Catalog::GetEntry<TableCatalogEntry>(*context, INVALID_CATALOG, schema_name, table_name);
+			if (!table_entry.IsDuckTable()) {
+				throw InvalidInputException("Parallel appends are only supported for DuckDB tables");
+			}
+			auto binder = Binder::CreateBinder(*context);
+			bound_constraints = binder->BindConstraints(table_entry);
+			MetaTransaction::Get(*context).ModifyDatabase(table_entry.ParentCatalog().GetAttached());
+			table = &table_entry;
+		});
+	} catch (...) {
+		if (owns_transaction) {
+			context->Query("ROLLBACK", false);
+		}
+		throw;
+	}
+}
+
+ParallelAppender::ParallelAppender(Connection &con, const string &table_name)
+    : ParallelAppender(con, DEFAULT_SCHEMA, table_name) {
+}
+
+ParallelAppender::~ParallelAppender() {
+	if (finished) {
+		return;
+	}
+	// the appender was not committed: discard the appended rows
+	try {
+		Rollback();
+	} catch (...) { // NOLINT
+	}
+}
+
+LocalParallelAppender &ParallelAppender::CreateLocalAppender() {
+	lock_guard<mutex> guard(lock);
+	if (finished) {
+		throw InvalidInputException("Failed to create appender: the parallel appender was already committed or rolled "
+		                            "back");
+	}
+	local_appenders.push_back(make_uniq<LocalParallelAppender>(*this));
+	return *local_appenders.back();
+}
+
+void ParallelAppender::Merge(LocalParallelAppender &local_appender) {
+	if (!local_appender.local_collection) {
+		return;
+	}
+	auto &storage = table->GetStorage();
+	TransactionData tdata(0, 0);
+	local_appender.local_collection->FinalizeAppend(tdata, *local_appender.append_state);
+	auto append_count = local_appender.local_collection->GetTotalRows();
+	if (append_count < Storage::ROW_GROUP_SIZE) {
+		// we have few rows - append to the local storage directly
+		LocalAppendState append_state;
+		storage.InitializeLocalAppend(append_state, *table, *context, bound_constraints);
+		auto &transaction = DuckTransaction::Get(*context, table->catalog);
+		local_appender.local_collection->Scan(transaction, [&](DataChunk &insert_chunk) {
+			storage.LocalAppend(append_state, *table, *context, insert_chunk);
+			return true;
+		});
+		storage.FinalizeLocalAppend(append_state);
+	} else {
+		// we have written rows to disk optimistically - merge directly into the transaction-local storage
+		storage.LocalMerge(*context, *local_appender.local_collection);
+	}
+	storage.FinalizeOptimisticWriter(*context, *local_appender.writer);
+}
+
+void ParallelAppender::FinishTransaction(const string &query) {
+	finished = true;
+	local_appenders.clear();
+	if (!owns_transaction) {
+		return;
+	}
+	auto result = context->Query(query, false);
+	if (result->HasError()) {
+		result->ThrowError();
+	}
+}
+
+void ParallelAppender::Commit() {
+	lock_guard<mutex> guard(lock);
+	if (finished) {
+		throw InvalidInputException("Failed to commit: the parallel appender was already committed or rolled back");
+	}
+	try {
+		for (auto &local_appender : local_appenders) {
+			local_appender->Close();
+		}
+		context->RunFunctionInTransaction([&]() {
+			for (auto &local_appender : local_appenders) {
+				Merge(*local_appender);
+			}
+		});
+	} catch (...) {
+		FinishTransaction("ROLLBACK");
+		throw;
+	}
+	FinishTransaction("COMMIT");
+}
+
+void ParallelAppender::Rollback() {
+	lock_guard<mutex> guard(lock);
+	if (finished) {
+		throw InvalidInputException("Failed to rollback: the parallel appender was already committed or rolled back");
+	}
+	if (!owns_transaction) {
+		// the transaction continues: discard the row groups that were already written to disk
+		context->RunFunctionInTransaction([&]() {
+			auto &storage = table->GetStorage();
+			for (auto &local_appender : local_appenders) {
+				if (!local_appender->writer) {
+					continue;
+				}
+				local_appender->writer->Rollback();
+				storage.FinalizeOptimisticWriter(*context, *local_appender->writer);
+			}
+		});
+	}
+	FinishTransaction("ROLLBACK");
+}
+
 } // namespace duckdb
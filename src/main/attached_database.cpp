@@ -56,12 +56,37 @@ AttachOptions::AttachOptions(const unique_ptr<AttachInfo> &info, const AccessMod
 			continue;
 		}
 
+		if (entry.first == "mmap") {
+			// Map the database file into memory instead of reading it into the buffer pool.
+			use_mmap = BooleanValue::Get(entry.second.DefaultCastAs(LogicalType::BOOLEAN));
+			continue;
+		}
+
+		if (entry.first == "encryption_key") {
+			// Encrypt the database file with the given key.
+			encryption_key = StringValue::Get(entry.second.DefaultCastAs(LogicalType::VARCHAR));
+			continue;
+		}
+
+		if (entry.first == "encryption_secret") {
+			// Encrypt the database file with the key of an encryption secret.
+			encryption_secret = StringValue::Get(entry.second.DefaultCastAs(LogicalType::VARCHAR));
+			continue;
+		}
+
 		// We allow unrecognized options in storage extensions. To track that we saw an unrecognized option,
 		// we set unrecognized_option.
 		if (unrecognized_option.empty()) {
 			unrecognized_option = entry.first;
 		}
 	}
+
+	if (use_mmap && access_mode != AccessMode::READ_ONLY) {
+		throw BinderException("The MMAP option can only be used for databases that are attached in READ_ONLY mode");
+	}
+	if (!encryption_key.empty() && !encryption_secret.empty()) {
+		throw BinderException("The ENCRYPTION_KEY and ENCRYPTION_SECRET options cannot be combined");
+	}
 }
 
 //===--------------------------------------------------------------------===//
@@ -97,7 +122,8 @@ AttachedDatabase::AttachedDatabase(DatabaseInstance &db, Catalog &catalog_p, str
 	// We create the storage after the catalog to guarantee we allow extensions to instantiate the DuckCatalog.
 	catalog = make_uniq<DuckCatalog>(*this);
 	auto read_only = options.access_mode == AccessMode::READ_ONLY;
-	storage = make_uniq<SingleFileStorageManager>(*this, std::move(file_path_p), read_only);
+	storage = make_uniq<SingleFileStorageManager>(*this, std::move(file_path_p), read_only, options.use_mmap,
+	                                                 options.encryption_key);
 	transaction_manager = make_uniq<DuckTransactionManager>(*this);
 	internal = true;
 }
@@ -122,7 +148,8 @@ AttachedDatabase::AttachedDatabase(DatabaseInstance &db, Catalog &catalog_p, Sto
 	if (catalog->IsDuckCatalog()) {
 		// The attached database uses the DuckCatalog.
 		auto read_only = options.access_mode == AccessMode::READ_ONLY;
-		storage = make_uniq<SingleFileStorageManager>(*this, info.path, read_only);
+		storage = make_uniq<SingleFileStorageManager>(*this, info.path, read_only, options.use_mmap,
+		                                              options.encryption_key);
 	}
 	transaction_manager = storage_extension->create_transaction_manager(storage_info, *this, *catalog);
 	if (!transaction_manager) {
@@ -219,6 +246,17 @@ void AttachedDatabase::Close() {
 	if (!IsSystem() && !catalog->InMemory()) {
 		db.GetDatabaseManager().EraseDatabasePath(catalog->GetDBPath());
 	}
+	if (storage) {
+		// stop checkpointing in the background before the database is shut down
+		auto background_checkpointer = storage->GetBackgroundCheckpointer();
+		if (background_checkpointer) {
+			background_checkpointer->Stop();
+		}
+	}
+	if (transaction_manager && transaction_manager->IsDuckTransactionManager()) {
+		// clean up finished transactions that the background checkpointer did not get to
+		DuckTransactionManager::Get(*this).CleanupTransactions();
+	}
 
 	if (Exception::UncaughtException()) {
 		return;
@@ -0,0 +1,152 @@
+#include "duckdb/main/buffered_data/arrow_buffered_data.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/stream_query_result.hpp"
+#include "duckdb/common/helper.hpp"
+
+namespace duckdb {
+
+ArrowBufferedData::ArrowBufferedData(weak_ptr<ClientContext> context, bool ordered)
+    : BufferedData(BufferedData::Type::ARROW, std::move(context)), ordered(ordered), buffer_byte_count(0),
+      read_queue_byte_count(0), min_batch(0) {
+}
+
+bool ArrowBufferedData::ShouldBlockBatchInternal(lock_guard<mutex> &lock, idx_t batch) {
+	if (!ordered || batch == min_batch) {
+		return read_queue_byte_count >= ReadQueueCapacity();
+	}
+	return buffer_byte_count >= BufferCapacity();
+}
+
+bool ArrowBufferedData::ShouldBlockBatch(idx_t batch) {
+	lock_guard<mutex> lock(glock);
+	return ShouldBlockBatchInternal(lock, batch);
+}
+
+void ArrowBufferedData::BlockSink(const InterruptState &blocked_sink, idx_t batch) {
+	lock_guard<mutex> lock(glock);
+	blocked_sinks.emplace_back(batch, blocked_sink);
+	SinkBlocked(lock);
+}
+
+bool ArrowBufferedData::BufferIsEmpty() {
+	lock_guard<mutex> lock(glock);
+	return read_queue.empty();
+}
+
+void ArrowBufferedData::UnblockSinks() {
+	lock_guard<mutex> lock(glock);
+	idx_t remaining = 0;
+	for (idx_t i = 0; i < blocked_sinks.size(); i++) {
+		auto &blocked_sink = blocked_sinks[i];
+		if (ShouldBlockBatchInternal(lock, blocked_sink.first)) {
+			blocked_sinks[remaining++] = std::move(blocked_sink);
+			continue;
+		}
+		blocked_sink.second.Callback();
+		SinkUnblocked(lock);
+	}
+	blocked_sinks.erase(blocked_sinks.begin() + NumericCast<int64_t>(remaining), blocked_sinks.end());
+}
+
+void ArrowBufferedData::MoveCompletedBatches(lock_guard<mutex> &lock) {
+	while (!buffer.empty()) {
+		auto entry = buffer.begin();
+		if (entry->first > min_batch) {
+			break;
+		}
+		// All batches below the minimum batch index are complete, so their arrays can be read in order
+		for (auto &array : entry->second) {
+			buffer_byte_count -= array.size;
+			read_queue_byte_count += array.size;
+			read_queue.push_back(std::move(array));
+		}
+		buffer.erase(entry);
+	}
+}
+
+void ArrowBufferedData::UpdateMinBatchIndex(idx_t min_batch_index) {
+	lock_guard<mutex> lock(glock);
+	if (min_batch_index <= min_batch) {
+		// No change, early out
+		return;
+	}
+	min_batch = min_batch_index;
+	MoveCompletedBatches(lock);
+}
+
+void ArrowBufferedData::Append(unique_ptr<ArrowArrayWrapper> array, idx_t size, idx_t batch) {
+	lock_guard<mutex> lock(glock);
+	if (!ordered || batch == min_batch) {
+		D_ASSERT(!ordered || buffer.empty() || buffer.begin()->first >= min_batch);
+		read_queue_byte_count += size;
+		read_queue.push_back(BufferedArrowArray {std::move(array), size});
+		return;
+	}
+	D_ASSERT(batch > min_batch);
+	buffer_byte_count += size;
+	buffer[batch].push_back(BufferedArrowArray {std::move(array), size});
+}
+
+StreamExecutionResult ArrowBufferedData::ExecuteTaskInternal(StreamQueryResult &result,
+                                                             ClientContextLock &context_lock) {
+	auto cc = context.lock();
+	if (!cc) {
+		return StreamExecutionResult::EXECUTION_CANCELLED;
+	}
+	if (!cc->IsActiveResult(context_lock, result)) {
+		return StreamExecutionResult::EXECUTION_CANCELLED;
+	}
+	if (!BufferIsEmpty()) {
+		// The buffer isn't empty yet, just return
+		return StreamExecutionResult::CHUNK_READY;
+	}
+	// Unblock any pending sinks if the buffer isnt full
+	UnblockSinks();
+	// Let the executor run until the buffer is no longer empty
+	auto execution_result = cc->ExecuteTaskInternal(context_lock, result);
+	if (!BufferIsEmpty()) {
+		return StreamExecutionResult::CHUNK_READY;
+	}
+	if (execution_result == PendingExecutionResult::BLOCKED ||
+	    execution_result == PendingExecutionResult::RESULT_READY) {
+		return StreamExecutionResult::BLOCKED;
+	}
+	if (result.HasError()) {
+		Close();
+	}
+	switch (execution_result) {
+	case PendingExecutionResult::NO_TASKS_AVAILABLE:
+	case PendingExecutionResult::RESULT_NOT_READY:
+		return StreamExecutionResult::CHUNK_NOT_READY;
+	case PendingExecutionResult::EXECUTION_FINISHED:
+		return StreamExecutionResult::EXECUTION_FINISHED;
+	case PendingExecutionResult::EXECUTION_ERROR:
+		return StreamExecutionResult::EXECUTION_ERROR;
+	default:
+		throw InternalException("No conversion from PendingExecutionResult (%s) -> StreamExecutionResult",
+		                        EnumUtil::ToString(execution_result));
+	}
+}
+
+unique_ptr<DataChunk> ArrowBufferedData::Scan() {
+	throw NotImplementedException("Can't 'Fetch' from a streaming Arrow result, use 'FetchArrowArray' instead");
+}
+
+unique_ptr<ArrowArrayWrapper> ArrowBufferedData::ScanArray() {
+	if (Closed()) {
+		return nullptr;
+	}
+	lock_guard<mutex> lock(glock);
+	if (read_queue.empty()) {
+		context.reset();
+		D_ASSERT(blocked_sinks.empty());
+		D_ASSERT(buffer.empty());
+		return nullptr;
+	}
+	auto array = std::move(read_queue.front());
+	read_queue.pop_front();
+	read_queue_byte_count -= array.size;
+	return std::move(array.array);
+}
+
+} // namespace duckdb
@@ -12,13 +12,12 @@ void BatchedBufferedData::BlockSink(const InterruptState &blocked_sink, idx_t ba
 	lock_guard<mutex> lock(glock);
 	D_ASSERT(!blocked_sinks.count(batch));
 	blocked_sinks.emplace(batch, blocked_sink);
+	SinkBlocked(lock);
 }
 
 BatchedBufferedData::BatchedBufferedData(weak_ptr<ClientContext> context)
     : BufferedData(BufferedData::Type::BATCHED, std::move(context)), buffer_byte_count(0), read_queue_byte_count(0),
       min_batch(0) {
-	read_queue_capacity = (idx_t)(static_cast<double>(total_buffer_size) * 0.6);
-	buffer_capacity = (idx_t)(static_cast<double>(total_buffer_size) * 0.4);
 }
 
 bool BatchedBufferedData::ShouldBlockBatch(idx_t batch) {
@@ -57,6 +56,7 @@ void BatchedBufferedData::UnblockSinks() {
 			}
 		}
 		blocked_sink.Callback();
+		SinkUnblocked(lock);
 		to_remove.push(batch);
 	}
 	while (!to_remove.empty()) {
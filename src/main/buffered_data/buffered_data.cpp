@@ -4,21 +4,93 @@
 
 namespace duckdb {
 
+//! The prefetch size does not shrink below this fraction of the total buffer size
+static constexpr const idx_t MINIMUM_PREFETCH_DIVISOR = 8;
+
 BufferedData::BufferedData(Type type, weak_ptr<ClientContext> context_p) : type(type), context(std::move(context_p)) {
 	auto client_context = context.lock();
 	auto &config = ClientConfig::GetConfig(*client_context);
 	total_buffer_size = config.streaming_buffer_size;
+	prefetch_size = total_buffer_size;
 }
 
 BufferedData::~BufferedData() {
 }
 
+void BufferedData::SetBufferBudget(idx_t budget) {
+	{
+		lock_guard<mutex> lock(glock);
+		total_buffer_size = budget;
+		prefetch_size = budget;
+	}
+	// the buffer might have room for the blocked sinks now
+	UnblockSinks();
+}
+
+void BufferedData::SinkBlocked(lock_guard<mutex> &lock) {
+	if (blocked_sinks_count == 0) {
+		blocked_since = std::chrono::steady_clock::now();
+	}
+	blocked_sinks_count++;
+	total_blocked_sinks++;
+}
+
+void BufferedData::SinkUnblocked(lock_guard<mutex> &lock) {
+	D_ASSERT(blocked_sinks_count > 0);
+	blocked_sinks_count--;
+	if (blocked_sinks_count == 0) {
+		blocked_time += std::chrono::steady_clock::now() - blocked_since;
+	}
+}
+
+std::chrono::steady_clock::duration BufferedData::BlockedSinkTimeInternal(lock_guard<mutex> &lock) const {
+	if (blocked_sinks_count == 0) {
+		return blocked_time;
+	}
+	return blocked_time + (std::chrono::steady_clock::now() - blocked_since);
+}
+
+idx_t BufferedData::GetBlockedSinkCount() {
+	lock_guard<mutex> lock(glock);
+	return total_blocked_sinks;
+}
+
+double BufferedData::GetBlockedSinkTime() {
+	lock_guard<mutex> lock(glock);
+	return std::chrono::duration<double>(BlockedSinkTimeInternal(lock)).count();
+}
+
+void BufferedData::AdaptPrefetchSize() {
+	auto buffer_is_empty = BufferIsEmpty();
+	auto now = std::chrono::steady_clock::now();
+
+	lock_guard<mutex> lock(glock);
+	auto current_blocked_time = BlockedSinkTimeInternal(lock);
+	if (fetched) {
+		auto fetch_interval = now - last_fetch;
+		auto blocked_interval = current_blocked_time - blocked_time_at_last_fetch;
+		if (buffer_is_empty) {
+			// the consumer has to wait for the producers: let them buffer further ahead
+			prefetch_size = MinValue<idx_t>(prefetch_size * 2, total_buffer_size);
+		} else if (blocked_interval * 2 > fetch_interval) {
+			// the producers spent most of the time since the previous fetch waiting for the consumer:
+			// buffering less ahead of it saves memory without slowing it down
+			auto minimum_prefetch_size = MaxValue<idx_t>(total_buffer_size / MINIMUM_PREFETCH_DIVISOR, 1);
+			prefetch_size = MaxValue<idx_t>(prefetch_size / 2, minimum_prefetch_size);
+		}
+	}
+	fetched = true;
+	last_fetch = now;
+	blocked_time_at_last_fetch = current_blocked_time;
+}
+
 StreamExecutionResult BufferedData::ReplenishBuffer(StreamQueryResult &result, ClientContextLock &context_lock) {
 	auto cc = context.lock();
 	if (!cc) {
 		return StreamExecutionResult::EXECUTION_CANCELLED;
 	}
 
+	AdaptPrefetchSize();
 	StreamExecutionResult execution_result;
 	while (!StreamQueryResult::IsChunkReady(execution_result = ExecuteTaskInternal(result, context_lock))) {
 		if (execution_result == StreamExecutionResult::BLOCKED) {
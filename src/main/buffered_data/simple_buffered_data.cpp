@@ -9,7 +9,6 @@ namespace duckdb {
 SimpleBufferedData::SimpleBufferedData(weak_ptr<ClientContext> context)
     : BufferedData(BufferedData::Type::SIMPLE, std::move(context)) {
 	buffered_count = 0;
-	buffer_size = total_buffer_size;
 }
 
 SimpleBufferedData::~SimpleBufferedData() {
@@ -18,12 +17,18 @@ SimpleBufferedData::~SimpleBufferedData() {
 void SimpleBufferedData::BlockSink(const InterruptState &blocked_sink) {
 	lock_guard<mutex> lock(glock);
 	blocked_sinks.push(blocked_sink);
+	SinkBlocked(lock);
 }
 
 bool SimpleBufferedData::BufferIsFull() {
 	return buffered_count >= BufferSize();
 }
 
+bool SimpleBufferedData::BufferIsEmpty() {
+	lock_guard<mutex> lock(glock);
+	return buffered_chunks.empty();
+}
+
 void SimpleBufferedData::UnblockSinks() {
 	auto cc = context.lock();
 	if (!cc) {
@@ -44,6 +49,7 @@ void SimpleBufferedData::UnblockSinks() {
 		}
 		blocked_sink.Callback();
 		blocked_sinks.pop();
+		SinkUnblocked(lock);
 	}
 }
 
@@ -85,6 +85,7 @@ duckdb_pending_state duckdb_pending_execute_check_state(duckdb_pending_result pe
 		return DUCKDB_PENDING_ERROR;
 	}
 	switch (return_value) {
+	case PendingExecutionResult::EXECUTION_FINISHED:
 	case PendingExecutionResult::BLOCKED:
 	case PendingExecutionResult::RESULT_READY:
 		return DUCKDB_PENDING_RESULT_READY;
@@ -144,6 +145,30 @@ bool duckdb_pending_execution_is_finished(duckdb_pending_state pending_state) {
 	}
 }
 
+duckdb_state duckdb_pending_set_ready_callback(duckdb_pending_result pending_result,
+                                               duckdb_pending_ready_callback_t callback, void *user_data) {
+	if (!pending_result) {
+		return DuckDBError;
+	}
+	auto wrapper = reinterpret_cast<PendingStatementWrapper *>(pending_result);
+	if (!wrapper->statement || wrapper->statement->HasError()) {
+		return DuckDBError;
+	}
+	std::function<void()> ready_callback;
+	if (callback) {
+		ready_callback = [callback, user_data]() {
+			callback(user_data);
+		};
+	}
+	try {
+		wrapper->statement->SetReadyCallback(std::move(ready_callback));
+	} catch (std::exception &ex) {
+		wrapper->statement->SetError(duckdb::ErrorData(ex));
+		return DuckDBError;
+	}
+	return DuckDBSuccess;
+}
+
 duckdb_state duckdb_execute_pending(duckdb_pending_result pending_result, duckdb_result *out_result) {
 	if (!pending_result || !out_result) {
 		return DuckDBError;
@@ -5,6 +5,7 @@
 #include "duckdb/common/uhugeint.hpp"
 #include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 
 using duckdb::case_insensitive_map_t;
 using duckdb::Connection;
@@ -347,6 +348,26 @@ duckdb_state duckdb_execute_prepared(duckdb_prepared_statement prepared_statemen
 	return DuckDBTranslateResult(std::move(result), out_result);
 }
 
+duckdb_state duckdb_execute_prepared_batch(duckdb_prepared_statement prepared_statement, duckdb_data_chunk parameters,
+                                           duckdb_result *out_result) {
+	auto wrapper = reinterpret_cast<PreparedStatementWrapper *>(prepared_statement);
+	if (!wrapper || !wrapper->statement || wrapper->statement->HasError() || !parameters) {
+		return DuckDBError;
+	}
+	auto &parameter_chunk = *reinterpret_cast<duckdb::DataChunk *>(parameters);
+
+	duckdb::unique_ptr<duckdb::QueryResult> result;
+	try {
+		auto collection = duckdb::make_shared_ptr<duckdb::ColumnDataCollection>(duckdb::Allocator::DefaultAllocator(),
+		                                                                         parameter_chunk.GetTypes());
+		collection->Append(parameter_chunk);
+		result = wrapper->statement->ExecuteBatch(std::move(collection));
+	} catch (...) {
+		return DuckDBError;
+	}
+	return DuckDBTranslateResult(std::move(result), out_result);
+}
+
 duckdb_state duckdb_execute_prepared_streaming(duckdb_prepared_statement prepared_statement,
                                                duckdb_result *out_result) {
 	auto wrapper = reinterpret_cast<PreparedStatementWrapper *>(prepared_statement);
@@ -32,3 +32,36 @@ duckdb_data_chunk duckdb_fetch_chunk(duckdb_result result) {
 		return nullptr;
 	}
 }
+
+duckdb_data_chunk duckdb_fetch_chunk_batch(duckdb_result result, idx_t min_rows) {
+	if (!result.internal_data || min_rows == 0) {
+		return nullptr;
+	}
+	auto &result_data = *((duckdb::DuckDBResultData *)result.internal_data);
+	if (result_data.result_set_type == duckdb::CAPIResultSetType::CAPI_RESULT_TYPE_DEPRECATED) {
+		return nullptr;
+	}
+	result_data.result_set_type = duckdb::CAPIResultSetType::CAPI_RESULT_TYPE_STREAMING;
+	auto &result_instance = (duckdb::QueryResult &)*result_data.result;
+	try {
+		auto chunk = result_instance.Fetch();
+		if (!chunk || chunk->size() >= min_rows) {
+			// a single chunk is enough: hand it out without copying it
+			return reinterpret_cast<duckdb_data_chunk>(chunk.release());
+		}
+		// the last fetched chunk overshoots min_rows by less than a full chunk, so the batch is never resized
+		auto batch = duckdb::make_uniq<duckdb::DataChunk>();
+		batch->Initialize(duckdb::Allocator::DefaultAllocator(), chunk->GetTypes(), min_rows + STANDARD_VECTOR_SIZE);
+		batch->Append(*chunk, true);
+		while (batch->size() < min_rows) {
+			chunk = result_instance.Fetch();
+			if (!chunk || chunk->size() == 0) {
+				break;
+			}
+			batch->Append(*chunk, true);
+		}
+		return reinterpret_cast<duckdb_data_chunk>(batch.release());
+	} catch (std::exception &e) {
+		return nullptr;
+	}
+}
@@ -20,11 +20,15 @@
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/query_result.hpp"
+#include "duckdb/main/query_telemetry.hpp"
 #include "duckdb/main/relation.hpp"
 #include "duckdb/main/stream_query_result.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/parallel/execution_tracer.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/parameter_expression.hpp"
 #include "duckdb/parser/parsed_data/create_function_info.hpp"
@@ -151,7 +155,7 @@ ClientContext::~ClientContext() {
 }
 
 unique_ptr<ClientContextLock> ClientContext::LockContext() {
-	return make_uniq<ClientContextLock>(context_lock);
+	return make_uniq<ClientContextLock>(context_lock, client_data ? client_data->memory_tracker.get() : nullptr);
 }
 
 void ClientContext::Destroy() {
@@ -193,8 +197,10 @@ void ClientContext::BeginQueryInternal(ClientContextLock &lock, const string &qu
 	transaction.SetActiveQuery(db->GetDatabaseManager().GetNewQueryNumber());
 	LogQueryInternal(lock, query);
 	active_query->query = query;
+	client_data->query_telemetry->BeginQuery(query, transaction.GetActiveQuery());
 
 	query_progress.Initialize();
+	client_data->memory_tracker->BeginQuery(config.query_memory_limit, config.session_memory_limit);
 	// Notify any registered state of query begin
 	for (auto &state : registered_state->States()) {
 		state->QueryBegin(*this);
@@ -203,17 +209,30 @@ void ClientContext::BeginQueryInternal(ClientContextLock &lock, const string &qu
 
 ErrorData ClientContext::EndQueryInternal(ClientContextLock &lock, bool success, bool invalidate_transaction,
                                           optional_ptr<ErrorData> previous_error) {
+	if (success && active_query->executor && active_query->executor->ExecutionIsFinished() &&
+	    !active_query->executor->HasError()) {
+		CardinalityFeedback::RecordQuery(*this, *client_data->profiler);
+	}
 	client_data->profiler->EndQuery();
 
 	if (active_query->executor) {
 		active_query->executor->CancelTasks();
 	}
 	active_query->progress_bar.reset();
+	client_data->query_telemetry->EndQuery();
 
+	ErrorData error;
 	D_ASSERT(active_query.get());
+	if (active_query->executor && active_query->executor->GetTracer()) {
+		// all tasks have finished: write the execution timeline of the query
+		try {
+			active_query->executor->GetTracer()->WriteToFile();
+		} catch (std::exception &ex) {
+			error = ErrorData(ex);
+		}
+	}
 	active_query.reset();
 	query_progress.Initialize();
-	ErrorData error;
 	try {
 		if (transaction.HasActiveTransaction()) {
 			transaction.ResetActiveQuery();
@@ -376,18 +395,21 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 	return result;
 }
 
+bool ClientContext::CanRequestRebind() {
+	for (auto &state : registered_state->States()) {
+		if (state->CanRequestRebind()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 shared_ptr<PreparedStatementData>
 ClientContext::CreatePreparedStatement(ClientContextLock &lock, const string &query, unique_ptr<SQLStatement> statement,
                                        optional_ptr<case_insensitive_map_t<BoundParameterData>> values,
                                        PreparedStatementMode mode) {
 	// check if any client context state could request a rebind
-	bool can_request_rebind = false;
-	for (auto &state : registered_state->States()) {
-		if (state->CanRequestRebind()) {
-			can_request_rebind = true;
-		}
-	}
-	if (can_request_rebind) {
+	if (CanRequestRebind()) {
 		bool rebind = false;
 		// if any registered state can request a rebind we do the binding on a copy first
 		shared_ptr<PreparedStatementData> result;
@@ -429,14 +451,12 @@ QueryProgress ClientContext::GetQueryProgress() {
 }
 
 void BindPreparedStatementParameters(PreparedStatementData &statement, const PendingQueryParameters &parameters) {
-	case_insensitive_map_t<BoundParameterData> owned_values;
 	if (parameters.parameters) {
-		auto &params = *parameters.parameters;
-		for (auto &val : params) {
-			owned_values.emplace(val);
-		}
+		// the values are copied into the statement, so there is no need to copy the parameter map first
+		statement.Bind(*parameters.parameters);
+		return;
 	}
-	statement.Bind(std::move(owned_values));
+	statement.Bind(case_insensitive_map_t<BoundParameterData>());
 }
 
 void ClientContext::RebindPreparedStatement(ClientContextLock &lock, const string &query,
@@ -504,6 +524,8 @@ ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock, shared_
 	auto &client_config = ClientConfig::GetConfig(*this);
 	if (!stream_result && client_config.result_collector) {
 		get_method = client_config.result_collector;
+	} else if (stream_result && client_config.streaming_result_collector) {
+		get_method = client_config.streaming_result_collector;
 	}
 	statement.is_streaming = stream_result;
 	auto collector = get_method(*this, statement);
@@ -734,9 +756,26 @@ unique_ptr<QueryResult> ClientContext::Execute(const string &query, shared_ptr<P
 unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientContextLock &lock, const string &query,
                                                                        unique_ptr<SQLStatement> statement,
                                                                        const PendingQueryParameters &parameters) {
-	// prepare the query for execution
-	auto prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters,
-	                                        PreparedStatementMode::PREPARE_AND_EXECUTE);
+	// prepare the query for execution - or reuse a cached plan of the query
+	auto &plan_cache = PlanCache::Get(*this);
+	string plan_cache_key;
+	if (!CanRequestRebind()) {
+		plan_cache_key = plan_cache.GetKey(*this, *statement, parameters.parameters);
+	}
+	shared_ptr<PreparedStatementData> prepared;
+	if (!plan_cache_key.empty()) {
+		prepared = plan_cache.Lookup(*this, plan_cache_key, parameters.parameters);
+	}
+	if (!prepared) {
+		auto unbound_statement = plan_cache_key.empty() ? nullptr : statement->Copy();
+		prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters,
+		                                   PreparedStatementMode::PREPARE_AND_EXECUTE);
+		if (unbound_statement) {
+			// the unbound statement is used to verify that the cached plan is still valid
+			prepared->unbound_statement = std::move(unbound_statement);
+			plan_cache.Insert(plan_cache_key, prepared, DBConfig::GetConfig(*this).options.plan_cache_size);
+		}
+	}
 	idx_t parameter_count = !parameters.parameters ? 0 : parameters.parameters->size();
 	if (prepared->properties.parameter_count > 0 && parameter_count == 0) {
 		string error_message = StringUtil::Format("Expected %lld parameters, but none were supplied",
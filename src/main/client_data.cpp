@@ -12,6 +12,8 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/query_telemetry.hpp"
+#include "duckdb/storage/buffer/client_memory_tracker.hpp"
 
 namespace duckdb {
 
@@ -36,6 +38,8 @@ private:
 ClientData::ClientData(ClientContext &context) : catalog_search_path(make_uniq<CatalogSearchPath>(context)) {
 	auto &db = DatabaseInstance::GetDatabase(context);
 	profiler = make_shared_ptr<QueryProfiler>(context);
+	memory_tracker = make_shared_ptr<ClientMemoryTracker>();
+	query_telemetry = make_shared_ptr<QueryTelemetry>();
 	http_logger = make_shared_ptr<HTTPLogger>(context);
 	temporary_objects = make_shared_ptr<AttachedDatabase>(db, AttachedDatabaseType::TEMP_DATABASE);
 	temporary_objects->oid = DatabaseManager::Get(db).NextOid();
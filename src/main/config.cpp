@@ -2,6 +2,7 @@
 
 #include "duckdb/common/cgroups.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/multi_file_list.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/operator/multiply.hpp"
 #include "duckdb/common/string_util.hpp"
@@ -60,7 +61,10 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AccessModeSetting),
     DUCKDB_GLOBAL(AllowPersistentSecrets),
     DUCKDB_GLOBAL(CatalogErrorMaxSchema),
+    DUCKDB_GLOBAL(BackgroundCheckpointSetting),
+    DUCKDB_GLOBAL(CheckpointIntervalSetting),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
+    DUCKDB_LOCAL(CompressedMaterializationDictionaryThreshold),
     DUCKDB_GLOBAL(DebugCheckpointAbort),
     DUCKDB_GLOBAL(DebugSkipCheckpointOnCommit),
     DUCKDB_GLOBAL(StorageCompatibilityVersion),
@@ -85,17 +89,26 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AutoinstallKnownExtensions),
     DUCKDB_GLOBAL(AutoloadKnownExtensions),
     DUCKDB_GLOBAL(EnableObjectCacheSetting),
+    DUCKDB_GLOBAL(EnableCardinalityFeedbackSetting),
+    DUCKDB_GLOBAL(EnableCSVSnifferCacheSetting),
+    DUCKDB_GLOBAL(EnableRowGroupBloomFiltersSetting),
+    DUCKDB_GLOBAL(EnableVectorZonemapsSetting),
+    DUCKDB_GLOBAL(HashJoinBuildCacheSize),
+    DUCKDB_GLOBAL(InlineExecutionThreshold),
+    DUCKDB_GLOBAL(ScanReadAheadRowsSetting),
     DUCKDB_GLOBAL(EnableHTTPMetadataCacheSetting),
     DUCKDB_LOCAL(EnableProfilingSetting),
     DUCKDB_LOCAL(EnableProgressBarSetting),
     DUCKDB_LOCAL(EnableProgressBarPrintSetting),
     DUCKDB_LOCAL(ErrorsAsJsonSetting),
+    DUCKDB_LOCAL(ExecutionTraceOutputSetting),
     DUCKDB_LOCAL(ExplainOutputSetting),
     DUCKDB_GLOBAL(ExtensionDirectorySetting),
     DUCKDB_GLOBAL(ExternalThreadsSetting),
     DUCKDB_LOCAL(FileSearchPathSetting),
     DUCKDB_GLOBAL(ForceCompressionSetting),
     DUCKDB_GLOBAL(ForceBitpackingModeSetting),
+    DUCKDB_GLOBAL(GlobalStringDictionarySetting),
     DUCKDB_LOCAL(HomeDirectorySetting),
     DUCKDB_GLOBAL(HTTPProxy),
     DUCKDB_GLOBAL(HTTPProxyUsername),
@@ -109,11 +122,14 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(IntegerDivisionSetting),
     DUCKDB_LOCAL(MaximumExpressionDepthSetting),
     DUCKDB_LOCAL(StreamingBufferSize),
+    DUCKDB_LOCAL(QueryMemoryLimitSetting),
+    DUCKDB_LOCAL(SessionMemoryLimitSetting),
     DUCKDB_GLOBAL(MaximumMemorySetting),
     DUCKDB_GLOBAL(MaximumTempDirectorySize),
     DUCKDB_GLOBAL(MaximumVacuumTasks),
     DUCKDB_LOCAL(MergeJoinThreshold),
     DUCKDB_LOCAL(NestedLoopJoinThreshold),
+    DUCKDB_LOCAL(IndexJoinThreshold),
     DUCKDB_GLOBAL(OldImplicitCasting),
     DUCKDB_GLOBAL_ALIAS("memory_limit", MaximumMemorySetting),
     DUCKDB_GLOBAL_ALIAS("null_order", DefaultNullOrderSetting),
@@ -121,8 +137,10 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(OrderedAggregateThreshold),
     DUCKDB_GLOBAL(PasswordSetting),
     DUCKDB_LOCAL(PerfectHashThresholdSetting),
+    DUCKDB_LOCAL(PipelineChunkBudgetSetting),
     DUCKDB_LOCAL(PivotFilterThreshold),
     DUCKDB_LOCAL(PivotLimitSetting),
+    DUCKDB_GLOBAL(PlanCacheSizeSetting),
     DUCKDB_LOCAL(PreserveIdentifierCase),
     DUCKDB_GLOBAL(PreserveInsertionOrder),
     DUCKDB_LOCAL(ProfileOutputSetting),
@@ -130,12 +148,17 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL_ALIAS("profiling_output", ProfileOutputSetting),
     DUCKDB_LOCAL(CustomProfilingSettings),
     DUCKDB_LOCAL(ProgressBarTimeSetting),
+    DUCKDB_LOCAL(QueryPrioritySetting),
     DUCKDB_LOCAL(SchemaSetting),
     DUCKDB_LOCAL(SearchPathSetting),
     DUCKDB_LOCAL(ScalarSubqueryErrorOnMultipleRows),
     DUCKDB_GLOBAL(SecretDirectorySetting),
     DUCKDB_GLOBAL(DefaultSecretStorage),
+    DUCKDB_GLOBAL(SynchronousCommitSetting),
     DUCKDB_GLOBAL(TempDirectorySetting),
+    DUCKDB_GLOBAL(TempFileCompressionSetting),
+    DUCKDB_GLOBAL(TempFileEncryptionSetting),
+    DUCKDB_GLOBAL(DirectIOSetting),
     DUCKDB_GLOBAL(ThreadsSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
@@ -148,6 +171,9 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AllocatorFlushThreshold),
     DUCKDB_GLOBAL(AllocatorBulkDeallocationFlushThreshold),
     DUCKDB_GLOBAL(AllocatorBackgroundThreadsSetting),
+    DUCKDB_GLOBAL(BufferEvictionPolicySetting),
+    DUCKDB_GLOBAL(BufferPoolHugePagesSetting),
+    DUCKDB_GLOBAL(BufferPoolPrefaultSetting),
     DUCKDB_GLOBAL(DuckDBApiSetting),
     DUCKDB_GLOBAL(CustomUserAgentSetting),
     DUCKDB_LOCAL(PartitionedWriteFlushThreshold),
@@ -1,6 +1,7 @@
 #include "duckdb/main/database.hpp"
 
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/multi_file_list.hpp"
 #include "duckdb/common/virtual_file_system.hpp"
 #include "duckdb/execution/index/index_type_set.hpp"
 #include "duckdb/execution/operator/helper/physical_set.hpp"
@@ -20,6 +21,7 @@
 #include "duckdb/parser/parsed_data/attach_info.hpp"
 #include "duckdb/planner/collation_binding.hpp"
 #include "duckdb/planner/extension_callback.hpp"
+#include "duckdb/storage/buffer/block_arena.hpp"
 #include "duckdb/storage/object_cache.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
 #include "duckdb/storage/storage_extension.hpp"
@@ -303,13 +305,14 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 
 	LoadExtensionSettings();
 
+	// launch the threads before loading the main database, so the WAL can be replayed in parallel
+	// the threads only execute tasks that are explicitly scheduled, so they do not touch the catalog while loading
+	scheduler->SetThreads(config.options.maximum_threads, config.options.external_threads);
+	scheduler->RelaunchThreads();
+
 	if (!db_manager->HasDefaultDatabase()) {
 		CreateMainDatabase();
 	}
-
-	// only increase thread count after storage init because we get races on catalog otherwise
-	scheduler->SetThreads(config.options.maximum_threads, config.options.external_threads);
-	scheduler->RelaunchThreads();
 }
 
 DuckDB::DuckDB(const char *path, DBConfig *new_config) : instance(make_shared_ptr<DatabaseInstance>()) {
@@ -421,7 +424,13 @@ void DatabaseInstance::Configure(DBConfig &new_config, const char *database_path
 	}
 	config.allocator = std::move(new_config.allocator);
 	if (!config.allocator) {
-		config.allocator = make_uniq<Allocator>();
+		if (config.options.buffer_pool_huge_pages || config.options.buffer_pool_prefault) {
+			config.allocator =
+			    BlockArena::CreateAllocator(config.options.default_block_alloc_size, config.options.maximum_memory,
+			                                config.options.buffer_pool_huge_pages, config.options.buffer_pool_prefault);
+		} else {
+			config.allocator = make_uniq<Allocator>();
+		}
 	}
 	config.replacement_scans = std::move(new_config.replacement_scans);
 	config.parser_extensions = std::move(new_config.parser_extensions);
@@ -437,7 +446,8 @@ void DatabaseInstance::Configure(DBConfig &new_config, const char *database_path
 	} else {
 		config.buffer_pool = make_shared_ptr<BufferPool>(config.options.maximum_memory,
 		                                                 config.options.buffer_manager_track_eviction_timestamps,
-		                                                 config.options.allocator_bulk_deallocation_flush_threshold);
+		                                                 config.options.allocator_bulk_deallocation_flush_threshold,
+		                                                 config.options.buffer_eviction_policy);
 	}
 }
 
@@ -59,6 +59,12 @@ PendingExecutionResult PendingQueryResult::CheckPulse() {
 	return context->ExecuteTaskInternal(*lock, *this, true);
 }
 
+void PendingQueryResult::SetReadyCallback(std::function<void()> callback) {
+	auto lock = LockContext();
+	CheckExecutableInternal(*lock);
+	context->GetExecutor().SetReadyCallback(std::move(callback));
+}
+
 bool PendingQueryResult::AllowStreamResult() const {
 	return allow_stream_result;
 }
@@ -0,0 +1,196 @@
+#include "duckdb/main/plan_cache.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/sql_statement.hpp"
+#include "duckdb/storage/data_table.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+PlanCache &PlanCache::Get(ClientContext &context) {
+	return Get(DatabaseInstance::GetDatabase(context));
+}
+
+PlanCache &PlanCache::Get(DatabaseInstance &db) {
+	return *db.GetObjectCache().GetOrCreate<PlanCache>(PlanCache::ObjectType());
+}
+
+string PlanCache::GetKey(ClientContext &context, SQLStatement &statement,
+                         optional_ptr<case_insensitive_map_t<BoundParameterData>> parameters) {
+	if (DBConfig::GetConfig(context).options.plan_cache_size == 0 ||
+	    statement.type != StatementType::SELECT_STATEMENT) {
+		return string();
+	}
+	auto &client_config = ClientConfig::GetConfig(context);
+	if (client_config.AnyVerification() || client_config.modified_settings) {
+		// the plan depends on settings of this connection
+		return string();
+	}
+	auto &client_data = ClientData::Get(context);
+	auto temp_version = client_data.temporary_objects->GetCatalog().GetCatalogVersion(context);
+	if (temp_version.IsValid() && temp_version.GetIndex() != 0) {
+		// temporary objects can shadow the tables of other connections
+		return string();
+	}
+	string key;
+	try {
+		key = statement.ToString();
+	} catch (std::exception &ex) {
+		// not every statement can be converted back to SQL
+		return string();
+	}
+	key += '\n';
+	key += CatalogSearchEntry::ListToString(client_data.catalog_search_path->Get());
+	if (parameters) {
+		vector<string> parameter_types;
+		for (auto &entry : *parameters) {
+			parameter_types.push_back(entry.first + ":" + entry.second.GetValue().type().ToString());
+		}
+		std::sort(parameter_types.begin(), parameter_types.end());
+		for (auto &parameter_type : parameter_types) {
+			key += '\n';
+			key += parameter_type;
+		}
+	}
+	return key;
+}
+
+static bool GetScannedTables(const PhysicalOperator &op, vector<pair<reference<DataTable>, idx_t>> &result) {
+	if (op.type == PhysicalOperatorType::TABLE_SCAN) {
+		auto &scan = op.Cast<PhysicalTableScan>();
+		if (!scan.function.get_bind_info) {
+			return false;
+		}
+		auto bind_info = scan.function.get_bind_info(scan.bind_data.get());
+		if (!bind_info.table || !bind_info.table->IsDuckTable()) {
+			// the bind data of other table functions (e.g. the files matched by a glob) can go stale
+			return false;
+		}
+		auto &storage = bind_info.table->GetStorage();
+		result.emplace_back(storage, storage.GetStatisticsVersion());
+	}
+	for (auto &child : op.GetChildren()) {
+		if (!GetScannedTables(child.get(), result)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool PlanCache::StatisticsChanged(const vector<pair<reference<DataTable>, idx_t>> &statistics_versions) {
+	for (auto &entry : statistics_versions) {
+		if (entry.first.get().GetStatisticsVersion() != entry.second) {
+			return true;
+		}
+	}
+	return false;
+}
+
+shared_ptr<PreparedStatementData>
+PlanCache::Lookup(ClientContext &context, const string &key,
+                  optional_ptr<case_insensitive_map_t<BoundParameterData>> parameters) {
+	shared_ptr<PreparedStatementData> result;
+	vector<pair<reference<DataTable>, idx_t>> statistics_versions;
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = entries.find(key);
+		if (entry == entries.end() || entry->second.prepared.use_count() > 1) {
+			// not cached - or the plan is in use by another query
+			return nullptr;
+		}
+		entry->second.last_used = ++current_timestamp;
+		// holding a reference marks the plan as in use
+		result = entry->second.prepared;
+		statistics_versions = entry->second.statistics_versions;
+	}
+	bool valid;
+	try {
+		// the catalog check has to happen first: it guarantees the scanned tables still exist
+		valid = !result->RequireRebind(context, parameters) && !StatisticsChanged(statistics_versions);
+	} catch (std::exception &ex) {
+		valid = false;
+	}
+	if (!valid) {
+		lock_guard<mutex> guard(lock);
+		auto entry = entries.find(key);
+		if (entry != entries.end() && entry->second.prepared == result) {
+			entries.erase(entry);
+		}
+		return nullptr;
+	}
+	return result;
+}
+
+void PlanCache::Insert(const string &key, shared_ptr<PreparedStatementData> prepared, idx_t maximum_entries) {
+	auto &properties = prepared->properties;
+	if (!properties.bound_all_parameters || properties.always_require_rebind ||
+	    !properties.modified_databases.empty()) {
+		return;
+	}
+	for (auto &entry : properties.read_databases) {
+		auto &catalog_version = entry.second.catalog_version;
+		if (entry.first == TEMP_CATALOG || !catalog_version.IsValid() ||
+		    catalog_version.GetIndex() >= TRANSACTION_ID_START) {
+			// the plan depends on catalog changes that are not visible to other connections
+			return;
+		}
+	}
+	PlanCacheEntry new_entry;
+	if (!prepared->plan || !GetScannedTables(*prepared->plan, new_entry.statistics_versions)) {
+		return;
+	}
+	new_entry.prepared = std::move(prepared);
+
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(key);
+	if (entry != entries.end()) {
+		if (entry->second.prepared.use_count() > 1) {
+			// the cached plan is in use - keep it
+			return;
+		}
+		entries.erase(entry);
+	}
+	if (maximum_entries == 0) {
+		return;
+	}
+	EvictInternal(maximum_entries - 1);
+	new_entry.last_used = ++current_timestamp;
+	entries.insert(make_pair(key, std::move(new_entry)));
+}
+
+void PlanCache::Evict(idx_t maximum_entries) {
+	lock_guard<mutex> guard(lock);
+	EvictInternal(maximum_entries);
+}
+
+void PlanCache::EvictInternal(idx_t maximum_entries) {
+	while (entries.size() > maximum_entries) {
+		// evict the least recently used plan
+		auto evict = entries.begin();
+		for (auto it = entries.begin(); it != entries.end(); it++) {
+			if (it->second.last_used < evict->second.last_used) {
+				evict = it;
+			}
+		}
+		entries.erase(evict);
+	}
+}
+
+idx_t PlanCache::Count() {
+	lock_guard<mutex> guard(lock);
+	return entries.size();
+}
+
+} // namespace duckdb
@@ -2,6 +2,14 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/parser/expression/columnref_expression.hpp"
+#include "duckdb/parser/expression/parameter_expression.hpp"
+#include "duckdb/parser/parsed_expression_iterator.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/statement/insert_statement.hpp"
+#include "duckdb/parser/tableref/column_data_ref.hpp"
+#include "duckdb/parser/tableref/expressionlistref.hpp"
 
 namespace duckdb {
 
@@ -86,12 +94,116 @@ unique_ptr<QueryResult> PreparedStatement::Execute(vector<Value> &values, bool a
 }
 
 unique_ptr<PendingQueryResult> PreparedStatement::PendingQuery(vector<Value> &values, bool allow_stream_result) {
-	case_insensitive_map_t<BoundParameterData> named_values;
+	// the parameter map is kept between executions, so that its entries do not have to be allocated every time
+	if (positional_values.size() != values.size()) {
+		positional_values.clear();
+	}
 	for (idx_t i = 0; i < values.size(); i++) {
-		auto &val = values[i];
-		named_values[std::to_string(i + 1)] = BoundParameterData(val);
+		positional_values[std::to_string(i + 1)] = BoundParameterData(values[i]);
+	}
+	return PendingQuery(positional_values, allow_stream_result);
+}
+
+static bool ReplaceParameters(unique_ptr<ParsedExpression> &expr, case_insensitive_set_t &replaced) {
+	if (expr->GetExpressionType() == ExpressionType::VALUE_DEFAULT) {
+		// DEFAULT is only valid directly in a VALUES list
+		return false;
+	}
+	if (expr->GetExpressionClass() == ExpressionClass::PARAMETER) {
+		auto &identifier = expr->Cast<ParameterExpression>().identifier;
+		replaced.insert(identifier);
+		expr = make_uniq<ColumnRefExpression>(identifier);
+		return true;
+	}
+	bool success = true;
+	ParsedExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<ParsedExpression> &child) {
+		if (!ReplaceParameters(child, replaced)) {
+			success = false;
+		}
+	});
+	return success;
+}
+
+unique_ptr<SQLStatement> PreparedStatement::CreateBatchStatement(shared_ptr<ColumnDataCollection> parameters) {
+	// only "INSERT INTO tbl VALUES (...)" with a single row can be rewritten into an INSERT that scans the parameters
+	if (!data->unbound_statement || data->unbound_statement->type != StatementType::INSERT_STATEMENT) {
+		return nullptr;
+	}
+	auto statement = data->unbound_statement->Copy();
+	auto &insert = statement->Cast<InsertStatement>();
+	if (insert.on_conflict_info) {
+		// conflicts between the rows of the batch would behave differently than when inserting row-by-row
+		return nullptr;
+	}
+	auto values_list = insert.GetValuesList();
+	if (!values_list || values_list->values.size() != 1) {
+		return nullptr;
+	}
+	// replace every parameter in the row with a reference to the parameter column
+	auto select_list = std::move(values_list->values[0]);
+	case_insensitive_set_t replaced;
+	for (auto &expr : select_list) {
+		if (!ReplaceParameters(expr, replaced)) {
+			return nullptr;
+		}
+	}
+	if (replaced.size() != named_param_map.size()) {
+		// parameters are also used outside of the VALUES list
+		return nullptr;
+	}
+	vector<string> parameter_names(named_param_map.size());
+	for (auto &entry : named_param_map) {
+		parameter_names[entry.second - 1] = entry.first;
+	}
+	auto &node = insert.select_statement->node->Cast<SelectNode>();
+	node.select_list = std::move(select_list);
+	auto parameter_ref = make_uniq<ColumnDataRef>(std::move(parameters), std::move(parameter_names));
+	parameter_ref->alias = values_list->alias;
+	node.from_table = std::move(parameter_ref);
+	return statement;
+}
+
+unique_ptr<QueryResult> PreparedStatement::ExecuteBatch(shared_ptr<ColumnDataCollection> parameters) {
+	if (!success) {
+		auto exception = InvalidInputException("Attempting to execute an unsuccessfully prepared statement!");
+		return make_uniq<MaterializedQueryResult>(ErrorData(exception));
+	}
+	D_ASSERT(parameters);
+	if (parameters->ColumnCount() != named_param_map.size()) {
+		auto exception =
+		    InvalidInputException("Prepared statement needs %d parameters, the batch has %d parameter columns",
+		                          named_param_map.size(), parameters->ColumnCount());
+		return make_uniq<MaterializedQueryResult>(ErrorData(exception));
+	}
+	unique_ptr<SQLStatement> batch_statement;
+	try {
+		batch_statement = CreateBatchStatement(parameters);
+	} catch (const std::exception &ex) {
+		return make_uniq<MaterializedQueryResult>(ErrorData(ex));
+	}
+	if (batch_statement) {
+		// execute a single INSERT that scans all parameter rows
+		return context->Query(std::move(batch_statement), false);
 	}
-	return PendingQuery(named_values, allow_stream_result);
+	// execute the statement once for every row of parameters
+	unique_ptr<QueryResult> result;
+	vector<Value> values(parameters->ColumnCount());
+	for (auto &chunk : parameters->Chunks()) {
+		for (idx_t r = 0; r < chunk.size(); r++) {
+			for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
+				values[c] = chunk.GetValue(c, r);
+			}
+			result = Execute(values, false);
+			if (result->HasError()) {
+				return result;
+			}
+		}
+	}
+	if (!result) {
+		auto exception = InvalidInputException("Attempting to execute a prepared statement with an empty batch");
+		return make_uniq<MaterializedQueryResult>(ErrorData(exception));
+	}
+	return result;
 }
 
 unique_ptr<PendingQueryResult> PreparedStatement::PendingQuery(case_insensitive_map_t<BoundParameterData> &named_values,
@@ -79,7 +79,7 @@ bool PreparedStatementData::RequireRebind(ClientContext &context,
 	return false;
 }
 
-void PreparedStatementData::Bind(case_insensitive_map_t<BoundParameterData> values) {
+void PreparedStatementData::Bind(const case_insensitive_map_t<BoundParameterData> &values) {
 	// set parameters
 	D_ASSERT(!unbound_statement || unbound_statement->named_param_map.size() == properties.parameter_count);
 	CheckParameterCount(values.size());
@@ -10,21 +10,51 @@ using namespace duckdb_yyjson; // NOLINT
 namespace duckdb {
 
 profiler_settings_t ProfilingInfo::DefaultSettings() {
-	return {MetricsType::QUERY_NAME,           MetricsType::BLOCKED_THREAD_TIME,     MetricsType::CPU_TIME,
-	        MetricsType::EXTRA_INFO,           MetricsType::CUMULATIVE_CARDINALITY,  MetricsType::OPERATOR_TYPE,
-	        MetricsType::OPERATOR_CARDINALITY, MetricsType::CUMULATIVE_ROWS_SCANNED, MetricsType::OPERATOR_ROWS_SCANNED,
-	        MetricsType::OPERATOR_TIMING,      MetricsType::RESULT_SET_SIZE};
+	return {MetricsType::QUERY_NAME,
+	        MetricsType::BLOCKED_THREAD_TIME,
+	        MetricsType::CPU_TIME,
+	        MetricsType::EXTRA_INFO,
+	        MetricsType::CUMULATIVE_CARDINALITY,
+	        MetricsType::OPERATOR_TYPE,
+	        MetricsType::OPERATOR_CARDINALITY,
+	        MetricsType::CUMULATIVE_ROWS_SCANNED,
+	        MetricsType::OPERATOR_ROWS_SCANNED,
+	        MetricsType::OPERATOR_TIMING,
+	        MetricsType::RESULT_SET_SIZE,
+	        MetricsType::OPERATOR_BYTES_READ,
+	        MetricsType::OPERATOR_READ_OPERATIONS,
+	        MetricsType::OPERATOR_READ_TIME};
 }
 
 profiler_settings_t ProfilingInfo::DefaultOperatorSettings() {
-	return {MetricsType::OPERATOR_CARDINALITY, MetricsType::OPERATOR_ROWS_SCANNED, MetricsType::OPERATOR_TIMING,
-	        MetricsType::RESULT_SET_SIZE};
+	return {MetricsType::OPERATOR_CARDINALITY,
+	        MetricsType::OPERATOR_ROWS_SCANNED,
+	        MetricsType::OPERATOR_TIMING,
+	        MetricsType::RESULT_SET_SIZE,
+	        MetricsType::OPERATOR_CPU_CYCLES,
+	        MetricsType::OPERATOR_INSTRUCTIONS,
+	        MetricsType::OPERATOR_CACHE_MISSES,
+	        MetricsType::OPERATOR_BRANCH_MISSES,
+	        MetricsType::OPERATOR_BYTES_READ,
+	        MetricsType::OPERATOR_READ_OPERATIONS,
+	        MetricsType::OPERATOR_READ_TIME};
+}
+
+profiler_settings_t ProfilingInfo::HardwareCounterSettings() {
+	return {MetricsType::OPERATOR_CPU_CYCLES, MetricsType::OPERATOR_INSTRUCTIONS, MetricsType::OPERATOR_CACHE_MISSES,
+	        MetricsType::OPERATOR_BRANCH_MISSES};
 }
 
 profiler_settings_t ProfilingInfo::AllSettings() {
 	auto all_settings = DefaultSettings();
 	auto optimizer_settings = MetricsUtils::GetOptimizerMetrics();
 	auto phase_timings = MetricsUtils::GetPhaseTimingMetrics();
+	// not enabled by default
+	all_settings.insert(MetricsType::PEAK_QUERY_MEMORY);
+	all_settings.insert(MetricsType::TEMPORARY_BYTES_WRITTEN);
+	for (auto &setting : HardwareCounterSettings()) {
+		all_settings.insert(setting);
+	}
 
 	for (auto &setting : optimizer_settings) {
 		all_settings.insert(setting);
@@ -56,7 +86,8 @@ void ProfilingInfo::ResetMetrics() {
 		case MetricsType::QUERY_NAME:
 		case MetricsType::BLOCKED_THREAD_TIME:
 		case MetricsType::CPU_TIME:
-		case MetricsType::OPERATOR_TIMING: {
+		case MetricsType::OPERATOR_TIMING:
+		case MetricsType::OPERATOR_READ_TIME: {
 			metrics[metric] = Value::CreateValue(0.0);
 			break;
 		}
@@ -65,10 +96,18 @@ void ProfilingInfo::ResetMetrics() {
 			break;
 		}
 		case MetricsType::RESULT_SET_SIZE:
+		case MetricsType::PEAK_QUERY_MEMORY:
+		case MetricsType::TEMPORARY_BYTES_WRITTEN:
 		case MetricsType::CUMULATIVE_CARDINALITY:
 		case MetricsType::OPERATOR_CARDINALITY:
 		case MetricsType::CUMULATIVE_ROWS_SCANNED:
-		case MetricsType::OPERATOR_ROWS_SCANNED: {
+		case MetricsType::OPERATOR_ROWS_SCANNED:
+		case MetricsType::OPERATOR_CPU_CYCLES:
+		case MetricsType::OPERATOR_INSTRUCTIONS:
+		case MetricsType::OPERATOR_CACHE_MISSES:
+		case MetricsType::OPERATOR_BRANCH_MISSES:
+		case MetricsType::OPERATOR_BYTES_READ:
+		case MetricsType::OPERATOR_READ_OPERATIONS: {
 			metrics[metric] = Value::CreateValue<uint64_t>(0);
 			break;
 		}
@@ -171,7 +210,8 @@ void ProfilingInfo::WriteMetricsToJSON(yyjson_mut_doc *doc, yyjson_mut_val *dest
 			break;
 		case MetricsType::BLOCKED_THREAD_TIME:
 		case MetricsType::CPU_TIME:
-		case MetricsType::OPERATOR_TIMING: {
+		case MetricsType::OPERATOR_TIMING:
+		case MetricsType::OPERATOR_READ_TIME: {
 			yyjson_mut_obj_add_real(doc, dest, key_ptr, metrics[metric].GetValue<double>());
 			break;
 		}
@@ -180,10 +220,18 @@ void ProfilingInfo::WriteMetricsToJSON(yyjson_mut_doc *doc, yyjson_mut_val *dest
 			break;
 		}
 		case MetricsType::RESULT_SET_SIZE:
+		case MetricsType::PEAK_QUERY_MEMORY:
+		case MetricsType::TEMPORARY_BYTES_WRITTEN:
 		case MetricsType::CUMULATIVE_CARDINALITY:
 		case MetricsType::OPERATOR_CARDINALITY:
 		case MetricsType::CUMULATIVE_ROWS_SCANNED:
-		case MetricsType::OPERATOR_ROWS_SCANNED: {
+		case MetricsType::OPERATOR_ROWS_SCANNED:
+		case MetricsType::OPERATOR_CPU_CYCLES:
+		case MetricsType::OPERATOR_INSTRUCTIONS:
+		case MetricsType::OPERATOR_CACHE_MISSES:
+		case MetricsType::OPERATOR_BRANCH_MISSES:
+		case MetricsType::OPERATOR_BYTES_READ:
+		case MetricsType::OPERATOR_READ_OPERATIONS: {
 			yyjson_mut_obj_add_uint(doc, dest, key_ptr, metrics[metric].GetValue<uint64_t>());
 			break;
 		}
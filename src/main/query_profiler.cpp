@@ -12,6 +12,7 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/main/query_telemetry.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 
@@ -99,10 +100,12 @@ bool QueryProfiler::OperatorRequiresProfiling(PhysicalOperatorType op_type) {
 	case PhysicalOperatorType::LIMIT_PERCENT:
 	case PhysicalOperatorType::STREAMING_LIMIT:
 	case PhysicalOperatorType::TOP_N:
+	case PhysicalOperatorType::GROUPED_TOP_N:
 	case PhysicalOperatorType::WINDOW:
 	case PhysicalOperatorType::UNNEST:
 	case PhysicalOperatorType::UNGROUPED_AGGREGATE:
 	case PhysicalOperatorType::HASH_GROUP_BY:
+	case PhysicalOperatorType::STREAMING_GROUP_BY:
 	case PhysicalOperatorType::FILTER:
 	case PhysicalOperatorType::PROJECTION:
 	case PhysicalOperatorType::COPY_TO_FILE:
@@ -115,6 +118,8 @@ bool QueryProfiler::OperatorRequiresProfiling(PhysicalOperatorType op_type) {
 	case PhysicalOperatorType::HASH_JOIN:
 	case PhysicalOperatorType::CROSS_PRODUCT:
 	case PhysicalOperatorType::PIECEWISE_MERGE_JOIN:
+	case PhysicalOperatorType::MERGE_JOIN:
+	case PhysicalOperatorType::MULTIWAY_JOIN:
 	case PhysicalOperatorType::IE_JOIN:
 	case PhysicalOperatorType::LEFT_DELIM_JOIN:
 	case PhysicalOperatorType::RIGHT_DELIM_JOIN:
@@ -156,6 +161,15 @@ static void GetCumulativeMetric(ProfilingNode &node, MetricsType cumulative_metr
 	}
 }
 
+template <class METRIC_TYPE>
+static METRIC_TYPE GetTotalMetric(ProfilingNode &node, MetricsType metric) {
+	auto total = node.GetProfilingInfo().GetMetricValue<METRIC_TYPE>(metric);
+	for (idx_t i = 0; i < node.GetChildCount(); i++) {
+		total += GetTotalMetric<METRIC_TYPE>(*node.GetChild(i), metric);
+	}
+	return total;
+}
+
 Value GetCumulativeOptimizers(ProfilingNode &node) {
 	auto &metrics = node.GetProfilingInfo().metrics;
 	double count = 0;
@@ -219,6 +233,30 @@ void QueryProfiler::EndQuery() {
 				info.metrics[MetricsType::RESULT_SET_SIZE] =
 				    root->children[0]->GetProfilingInfo().metrics[MetricsType::RESULT_SET_SIZE];
 			}
+			for (auto &metric : ProfilingInfo::HardwareCounterSettings()) {
+				if (info.Enabled(metric)) {
+					// the query root holds the total of all operators
+					info.metrics[metric] = Value::UBIGINT(GetTotalMetric<idx_t>(*root->GetChild(0), metric));
+				}
+			}
+			for (auto metric : {MetricsType::OPERATOR_BYTES_READ, MetricsType::OPERATOR_READ_OPERATIONS}) {
+				if (info.Enabled(metric)) {
+					info.metrics[metric] = Value::UBIGINT(GetTotalMetric<idx_t>(*root->GetChild(0), metric));
+				}
+			}
+			if (info.Enabled(MetricsType::OPERATOR_READ_TIME)) {
+				info.metrics[MetricsType::OPERATOR_READ_TIME] =
+				    GetTotalMetric<double>(*root->GetChild(0), MetricsType::OPERATOR_READ_TIME);
+			}
+			if (info.Enabled(MetricsType::PEAK_QUERY_MEMORY)) {
+				auto &memory_tracker = *ClientData::Get(context).memory_tracker;
+				info.metrics[MetricsType::PEAK_QUERY_MEMORY] = Value::UBIGINT(memory_tracker.GetQueryPeakMemory());
+			}
+			if (info.Enabled(MetricsType::TEMPORARY_BYTES_WRITTEN)) {
+				auto &telemetry = *ClientData::Get(context).query_telemetry;
+				info.metrics[MetricsType::TEMPORARY_BYTES_WRITTEN] =
+				    Value::UBIGINT(telemetry.GetTemporaryBytesWritten());
+			}
 		}
 
 		string tree = ToString();
@@ -302,7 +340,23 @@ bool SettingIsEnabled(const profiler_settings_t &settings, MetricsType metric) {
 	return false;
 }
 
-OperatorProfiler::OperatorProfiler(ClientContext &context) : context(context) {
+static HardwareCounter GetHardwareCounter(MetricsType metric) {
+	switch (metric) {
+	case MetricsType::OPERATOR_CPU_CYCLES:
+		return HardwareCounter::CPU_CYCLES;
+	case MetricsType::OPERATOR_INSTRUCTIONS:
+		return HardwareCounter::INSTRUCTIONS;
+	case MetricsType::OPERATOR_CACHE_MISSES:
+		return HardwareCounter::CACHE_MISSES;
+	case MetricsType::OPERATOR_BRANCH_MISSES:
+		return HardwareCounter::BRANCH_MISSES;
+	default:
+		throw InternalException("MetricsType %s is not a hardware counter", EnumUtil::ToString(metric));
+	}
+}
+
+OperatorProfiler::OperatorProfiler(ClientContext &context)
+    : context(context), hardware_counters_enabled(false), hardware_counters_active(false), io_enabled(false) {
 	enabled = QueryProfiler::Get(context).IsEnabled();
 	auto &settings = ClientConfig::GetConfig(context).profiler_settings;
 
@@ -312,6 +366,14 @@ OperatorProfiler::OperatorProfiler(ClientContext &context) : context(context) {
 			operator_settings.insert(metric);
 		}
 	}
+	for (auto &metric : ProfilingInfo::HardwareCounterSettings()) {
+		if (HasOperatorSetting(metric)) {
+			hardware_counters_enabled = true;
+		}
+	}
+	io_enabled = HasOperatorSetting(MetricsType::OPERATOR_BYTES_READ) ||
+	             HasOperatorSetting(MetricsType::OPERATOR_READ_OPERATIONS) ||
+	             HasOperatorSetting(MetricsType::OPERATOR_READ_TIME);
 }
 
 void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_op) {
@@ -329,6 +391,12 @@ void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_o
 	if (HasOperatorSetting(MetricsType::OPERATOR_TIMING)) {
 		op.Start();
 	}
+	if (hardware_counters_enabled) {
+		hardware_counters_active = hardware_counters.Start();
+	}
+	if (io_enabled) {
+		io.Start();
+	}
 }
 
 void OperatorProfiler::EndOperator(optional_ptr<DataChunk> chunk) {
@@ -349,6 +417,15 @@ void OperatorProfiler::EndOperator(optional_ptr<DataChunk> chunk) {
 			op.End();
 			curr_operator_info.AddTime(op.Elapsed());
 		}
+		if (hardware_counters_active) {
+			hardware_counters.End();
+			curr_operator_info.AddHardwareCounters(hardware_counters);
+			hardware_counters_active = false;
+		}
+		if (io_enabled) {
+			io.End();
+			curr_operator_info.AddIO(io.Elapsed());
+		}
 		if (HasOperatorSetting(MetricsType::OPERATOR_CARDINALITY) && chunk) {
 			curr_operator_info.AddReturnedElements(chunk->size());
 		}
@@ -414,6 +491,22 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 		if (profiler.HasOperatorSetting(MetricsType::RESULT_SET_SIZE)) {
 			tree_node.GetProfilingInfo().AddToMetric<idx_t>(MetricsType::RESULT_SET_SIZE, node.second.result_set_size);
 		}
+		for (auto &metric : ProfilingInfo::HardwareCounterSettings()) {
+			if (profiler.HasOperatorSetting(metric)) {
+				auto counter = static_cast<idx_t>(GetHardwareCounter(metric));
+				tree_node.GetProfilingInfo().AddToMetric<idx_t>(metric, node.second.hardware_counters[counter]);
+			}
+		}
+		if (profiler.HasOperatorSetting(MetricsType::OPERATOR_BYTES_READ)) {
+			tree_node.GetProfilingInfo().AddToMetric<idx_t>(MetricsType::OPERATOR_BYTES_READ, node.second.bytes_read);
+		}
+		if (profiler.HasOperatorSetting(MetricsType::OPERATOR_READ_OPERATIONS)) {
+			tree_node.GetProfilingInfo().AddToMetric<idx_t>(MetricsType::OPERATOR_READ_OPERATIONS,
+			                                                node.second.read_operations);
+		}
+		if (profiler.HasOperatorSetting(MetricsType::OPERATOR_READ_TIME)) {
+			tree_node.GetProfilingInfo().AddToMetric<double>(MetricsType::OPERATOR_READ_TIME, node.second.read_time);
+		}
 	}
 	profiler.timings.clear();
 }
@@ -520,6 +613,9 @@ void PrintPhaseTimingsToStream(std::ostream &ss, const ProfilingInfo &info, idx_
 				physical_planner_timings[metric.substr(17)] = entry.second.GetValue<double>();
 			} else if (StringUtil::StartsWith(metric, "PLANNER") && entry.first != MetricsType::PLANNER) {
 				planner_timings[metric.substr(8)] = entry.second.GetValue<double>();
+			} else if (StringUtil::StartsWith(metric, "JOIN_ORDER")) {
+				// the stages of the join order optimizer are listed right after it
+				optimizer_timings[metric] = entry.second.GetValue<double>();
 			}
 		}
 	}
@@ -689,7 +785,8 @@ profiler_settings_t EraseQueryRootSettings(profiler_settings_t settings) {
 
 	for (auto &setting : settings) {
 		if (MetricsUtils::IsOptimizerMetric(setting) || MetricsUtils::IsPhaseTimingMetric(setting) ||
-		    setting == MetricsType::BLOCKED_THREAD_TIME) {
+		    setting == MetricsType::BLOCKED_THREAD_TIME || setting == MetricsType::PEAK_QUERY_MEMORY ||
+		    setting == MetricsType::TEMPORARY_BYTES_WRITTEN) {
 			phase_timing_settings_to_erase.insert(setting);
 		}
 	}
@@ -0,0 +1,103 @@
+#include "duckdb/main/query_telemetry.hpp"
+
+namespace duckdb {
+
+//! The telemetry that the work of the current thread is accounted to
+static thread_local QueryTelemetry *active_telemetry = nullptr;
+
+QueryTelemetry::QueryTelemetry()
+    : running(false), task_time_ns(0), temporary_bytes_written(0), local_bytes_read(0), remote_bytes_read(0),
+      read_operations(0), read_time_ns(0), buffer_hits(0), buffer_misses(0), prefetch_waste_bytes(0),
+      active_threads(0) {
+	for (idx_t i = 0; i < IO_LATENCY_BUCKET_COUNT; i++) {
+		read_latency_histogram[i] = 0;
+	}
+}
+
+void QueryTelemetry::BeginQuery(const string &query_p, optional_idx query_id_p) {
+	lock_guard<mutex> guard(lock);
+	running = true;
+	query = query_p;
+	query_id = query_id_p;
+	start_time = std::chrono::steady_clock::now();
+	task_time_ns = 0;
+	temporary_bytes_written = 0;
+	local_bytes_read = 0;
+	remote_bytes_read = 0;
+	read_operations = 0;
+	read_time_ns = 0;
+	for (idx_t i = 0; i < IO_LATENCY_BUCKET_COUNT; i++) {
+		read_latency_histogram[i] = 0;
+	}
+	buffer_hits = 0;
+	buffer_misses = 0;
+	prefetch_waste_bytes = 0;
+}
+
+void QueryTelemetry::EndQuery() {
+	lock_guard<mutex> guard(lock);
+	running = false;
+	query.clear();
+	query_id = optional_idx();
+}
+
+bool QueryTelemetry::GetRunningQuery(QueryTelemetryInfo &result) const {
+	lock_guard<mutex> guard(lock);
+	if (!running) {
+		return false;
+	}
+	result.query = query;
+	result.query_id = query_id;
+	result.elapsed_time =
+	    std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start_time)
+	        .count();
+	result.cpu_time = double(task_time_ns.load()) / 1e9;
+	result.temporary_bytes_written = temporary_bytes_written;
+	result.local_bytes_read = local_bytes_read;
+	result.remote_bytes_read = remote_bytes_read;
+	result.read_operations = read_operations;
+	result.read_time = double(read_time_ns.load()) / 1e9;
+	result.read_latency_histogram.clear();
+	for (idx_t i = 0; i < IO_LATENCY_BUCKET_COUNT; i++) {
+		result.read_latency_histogram.push_back(read_latency_histogram[i]);
+	}
+	result.buffer_hits = buffer_hits;
+	result.buffer_misses = buffer_misses;
+	result.prefetch_waste_bytes = prefetch_waste_bytes;
+	result.active_threads = active_threads;
+	return true;
+}
+
+void QueryTelemetry::AddRead(idx_t bytes, idx_t read_time, bool remote) {
+	if (remote) {
+		remote_bytes_read += bytes;
+	} else {
+		local_bytes_read += bytes;
+	}
+	read_operations++;
+	read_time_ns += read_time;
+	read_latency_histogram[IOProfiler::GetLatencyBucket(read_time)]++;
+}
+
+void QueryTelemetry::StartTask() {
+	active_threads++;
+}
+
+void QueryTelemetry::EndTask(int64_t task_time) {
+	task_time_ns += task_time;
+	active_threads--;
+}
+
+optional_ptr<QueryTelemetry> QueryTelemetry::GetActive() {
+	return active_telemetry;
+}
+
+QueryTelemetry::ActiveScope::ActiveScope(optional_ptr<QueryTelemetry> telemetry) : previous(active_telemetry) {
+	active_telemetry = telemetry.get();
+}
+
+QueryTelemetry::ActiveScope::~ActiveScope() {
+	active_telemetry = previous.get();
+}
+
+} // namespace duckdb
@@ -7,9 +7,10 @@
 namespace duckdb {
 
 CreateTableRelation::CreateTableRelation(shared_ptr<Relation> child_p, string schema_name, string table_name,
-                                         bool temporary_p)
+                                         bool temporary_p, OnCreateConflict on_conflict)
     : Relation(child_p->context, RelationType::CREATE_TABLE_RELATION), child(std::move(child_p)),
-      schema_name(std::move(schema_name)), table_name(std::move(table_name)), temporary(temporary_p) {
+      schema_name(std::move(schema_name)), table_name(std::move(table_name)), temporary(temporary_p),
+      on_conflict(on_conflict) {
 	context.GetContext()->TryBindRelation(*this, this->columns);
 }
 
@@ -22,7 +23,7 @@ BoundStatement CreateTableRelation::Bind(Binder &binder) {
 	info->schema = schema_name;
 	info->table = table_name;
 	info->query = std::move(select);
-	info->on_conflict = OnCreateConflict::ERROR_ON_CONFLICT;
+	info->on_conflict = on_conflict;
 	info->temporary = temporary;
 	stmt.info = std::move(info);
 	return binder.Bind(stmt.Cast<SQLStatement>());
@@ -105,4 +105,46 @@ unique_ptr<BaseSecret> CreateHTTPSecretFunctions::CreateHTTPSecretFromConfig(Cli
 	return std::move(secret);
 }
 
+vector<SecretType> CreateEncryptionSecretFunctions::GetDefaultSecretTypes() {
+	vector<SecretType> result;
+
+	// Encryption secret, which holds the key of encrypted database files
+	SecretType secret_type;
+	secret_type.name = "encryption";
+	secret_type.deserializer = KeyValueSecret::Deserialize<KeyValueSecret>;
+	secret_type.default_provider = "config";
+	result.push_back(std::move(secret_type));
+
+	return result;
+}
+
+vector<CreateSecretFunction> CreateEncryptionSecretFunctions::GetDefaultSecretFunctions() {
+	vector<CreateSecretFunction> result;
+
+	// Encryption secret CONFIG provider
+	CreateSecretFunction encryption_config_fun;
+	encryption_config_fun.secret_type = "encryption";
+	encryption_config_fun.provider = "config";
+	encryption_config_fun.function = CreateEncryptionSecretFromConfig;
+	encryption_config_fun.named_parameters["key"] = LogicalType::VARCHAR;
+	result.push_back(std::move(encryption_config_fun));
+
+	return result;
+}
+
+unique_ptr<BaseSecret> CreateEncryptionSecretFunctions::CreateEncryptionSecretFromConfig(ClientContext &context,
+                                                                                         CreateSecretInput &input) {
+	auto secret = make_uniq<KeyValueSecret>(input.scope, input.type, input.provider, input.name);
+
+	secret->TrySetValue("key", input);
+	if (!secret->secret_map.count("key")) {
+		throw InvalidInputException("An encryption secret requires a KEY");
+	}
+
+	//! Set redact keys
+	secret->redact_keys = {"key"};
+
+	return std::move(secret);
+}
+
 } // namespace duckdb
@@ -66,6 +66,12 @@ void SecretManager::Initialize(DatabaseInstance &db) {
 	for (auto &function : CreateHTTPSecretFunctions::GetDefaultSecretFunctions()) {
 		RegisterSecretFunctionInternal(function, OnCreateConflict::ERROR_ON_CONFLICT);
 	}
+	for (auto &type : CreateEncryptionSecretFunctions::GetDefaultSecretTypes()) {
+		RegisterSecretTypeInternal(type);
+	}
+	for (auto &function : CreateEncryptionSecretFunctions::GetDefaultSecretFunctions()) {
+		RegisterSecretFunctionInternal(function, OnCreateConflict::ERROR_ON_CONFLICT);
+	}
 }
 
 void SecretManager::LoadSecretStorage(unique_ptr<SecretStorage> storage) {
@@ -2,12 +2,14 @@
 
 #include "duckdb/catalog/catalog_search_path.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/execution/operator/join/hash_join_build_cache.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
@@ -95,6 +97,38 @@ Value CatalogErrorMaxSchema::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(config.options.catalog_error_max_schemas);
 }
 
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = input.GetValue<bool>();
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfig().options.background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
+//===--------------------------------------------------------------------===//
+// Checkpoint Interval
+//===--------------------------------------------------------------------===//
+void CheckpointIntervalSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.checkpoint_interval = UBigIntValue::Get(input);
+}
+
+void CheckpointIntervalSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.checkpoint_interval = DBConfig().options.checkpoint_interval;
+}
+
+Value CheckpointIntervalSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.checkpoint_interval);
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -112,6 +146,22 @@ Value CheckpointThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Compressed Materialization Dictionary Threshold
+//===--------------------------------------------------------------------===//
+void CompressedMaterializationDictionaryThreshold::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).compressed_materialization_dictionary_threshold = input.GetValue<uint64_t>();
+}
+
+void CompressedMaterializationDictionaryThreshold::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).compressed_materialization_dictionary_threshold =
+	    ClientConfig().compressed_materialization_dictionary_threshold;
+}
+
+Value CompressedMaterializationDictionaryThreshold::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).compressed_materialization_dictionary_threshold);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -627,6 +677,92 @@ Value EnableObjectCacheSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.object_cache_enable);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Cardinality Feedback
+//===--------------------------------------------------------------------===//
+void EnableCardinalityFeedbackSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_cardinality_feedback = input.GetValue<bool>();
+}
+
+void EnableCardinalityFeedbackSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_cardinality_feedback = DBConfig().options.enable_cardinality_feedback;
+}
+
+Value EnableCardinalityFeedbackSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_cardinality_feedback);
+}
+
+//===--------------------------------------------------------------------===//
+// Enable CSV Sniffer Cache
+//===--------------------------------------------------------------------===//
+void EnableCSVSnifferCacheSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_csv_sniffer_cache = input.GetValue<bool>();
+}
+
+void EnableCSVSnifferCacheSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_csv_sniffer_cache = DBConfig().options.enable_csv_sniffer_cache;
+}
+
+Value EnableCSVSnifferCacheSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_csv_sniffer_cache);
+}
+
+//===--------------------------------------------------------------------===//
+// Hash Join Build Cache Size
+//===--------------------------------------------------------------------===//
+void HashJoinBuildCacheSize::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.hash_join_build_cache_size = DBConfig::ParseMemoryLimit(input.ToString());
+	if (db) {
+		HashJoinBuildCache::Get(*db).Evict(config.options.hash_join_build_cache_size);
+	}
+}
+
+void HashJoinBuildCacheSize::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.hash_join_build_cache_size = DBConfig().options.hash_join_build_cache_size;
+	if (db) {
+		HashJoinBuildCache::Get(*db).Evict(config.options.hash_join_build_cache_size);
+	}
+}
+
+Value HashJoinBuildCacheSize::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.hash_join_build_cache_size));
+}
+
+//===--------------------------------------------------------------------===//
+// Scan Read Ahead Rows
+//===--------------------------------------------------------------------===//
+void ScanReadAheadRowsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.scan_read_ahead_rows = input.GetValue<idx_t>();
+}
+
+void ScanReadAheadRowsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.scan_read_ahead_rows = DBConfig().options.scan_read_ahead_rows;
+}
+
+Value ScanReadAheadRowsSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.scan_read_ahead_rows);
+}
+
+//===--------------------------------------------------------------------===//
+// Inline Execution Threshold
+//===--------------------------------------------------------------------===//
+void InlineExecutionThreshold::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.inline_execution_threshold = input.GetValue<idx_t>();
+}
+
+void InlineExecutionThreshold::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.inline_execution_threshold = DBConfig().options.inline_execution_threshold;
+}
+
+Value InlineExecutionThreshold::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.inline_execution_threshold);
+}
+
 //===--------------------------------------------------------------------===//
 // Storage Compatibility Version (for serialization)
 //===--------------------------------------------------------------------===//
@@ -923,6 +1059,38 @@ Value EnableProgressBarPrintSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).print_progress_bar);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Row Group Bloom Filters
+//===--------------------------------------------------------------------===//
+void EnableRowGroupBloomFiltersSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_row_group_bloom_filters = input.GetValue<bool>();
+}
+
+void EnableRowGroupBloomFiltersSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_row_group_bloom_filters = DBConfig().options.enable_row_group_bloom_filters;
+}
+
+Value EnableRowGroupBloomFiltersSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_row_group_bloom_filters);
+}
+
+//===--------------------------------------------------------------------===//
+// Enable Vector Zonemaps
+//===--------------------------------------------------------------------===//
+void EnableVectorZonemapsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_vector_zonemaps = input.GetValue<bool>();
+}
+
+void EnableVectorZonemapsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_vector_zonemaps = DBConfig().options.enable_vector_zonemaps;
+}
+
+Value EnableVectorZonemapsSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_vector_zonemaps);
+}
+
 //===--------------------------------------------------------------------===//
 // Errors As JSON
 //===--------------------------------------------------------------------===//
@@ -938,6 +1106,21 @@ Value ErrorsAsJsonSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).errors_as_json);
 }
 
+//===--------------------------------------------------------------------===//
+// Execution Trace Output
+//===--------------------------------------------------------------------===//
+void ExecutionTraceOutputSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).execution_trace_output = ClientConfig().execution_trace_output;
+}
+
+void ExecutionTraceOutputSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).execution_trace_output = input.ToString();
+}
+
+Value ExecutionTraceOutputSetting::GetSetting(const ClientContext &context) {
+	return Value(ClientConfig::GetConfig(context).execution_trace_output);
+}
+
 //===--------------------------------------------------------------------===//
 // Explain Output
 //===--------------------------------------------------------------------===//
@@ -1072,7 +1255,7 @@ void ForceBitpackingModeSetting::SetGlobal(DatabaseInstance *db, DBConfig &confi
 	auto mode = BitpackingModeFromString(mode_str);
 	if (mode == BitpackingMode::INVALID) {
 		throw ParserException("Unrecognized option for force_bitpacking_mode, expected none, constant, constant_delta, "
-		                      "delta_for, or for");
+		                      "delta_for, for, or for_interleaved");
 	}
 	config.options.force_bitpacking_mode = mode;
 }
@@ -1085,6 +1268,22 @@ Value ForceBitpackingModeSetting::GetSetting(const ClientContext &context) {
 	return Value(BitpackingModeToString(context.db->config.options.force_bitpacking_mode));
 }
 
+//===--------------------------------------------------------------------===//
+// Global String Dictionary
+//===--------------------------------------------------------------------===//
+void GlobalStringDictionarySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.global_string_dictionary = input.GetValue<bool>();
+}
+
+void GlobalStringDictionarySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.global_string_dictionary = DBConfig().options.global_string_dictionary;
+}
+
+Value GlobalStringDictionarySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.global_string_dictionary);
+}
+
 //===--------------------------------------------------------------------===//
 // Home Directory
 //===--------------------------------------------------------------------===//
@@ -1299,6 +1498,45 @@ Value StreamingBufferSize::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.streaming_buffer_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Query Memory Limit
+//===--------------------------------------------------------------------===//
+static Value GetClientMemoryLimit(idx_t limit) {
+	if (limit == DConstants::INVALID_INDEX) {
+		return Value("none");
+	}
+	return Value(StringUtil::BytesToHumanReadableString(limit));
+}
+
+void QueryMemoryLimitSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.query_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void QueryMemoryLimitSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_memory_limit = ClientConfig().query_memory_limit;
+}
+
+Value QueryMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	return GetClientMemoryLimit(ClientConfig::GetConfig(context).query_memory_limit);
+}
+
+//===--------------------------------------------------------------------===//
+// Session Memory Limit
+//===--------------------------------------------------------------------===//
+void SessionMemoryLimitSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.session_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void SessionMemoryLimitSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).session_memory_limit = ClientConfig().session_memory_limit;
+}
+
+Value SessionMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	return GetClientMemoryLimit(ClientConfig::GetConfig(context).session_memory_limit);
+}
+
 //===--------------------------------------------------------------------===//
 // Maximum Temp Directory Size
 //===--------------------------------------------------------------------===//
@@ -1394,6 +1632,23 @@ Value NestedLoopJoinThreshold::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(config.nested_loop_join_threshold);
 }
 
+//===--------------------------------------------------------------------===//
+// Index Join Threshold
+//===--------------------------------------------------------------------===//
+void IndexJoinThreshold::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.index_join_threshold = input.GetValue<idx_t>();
+}
+
+void IndexJoinThreshold::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).index_join_threshold = ClientConfig().index_join_threshold;
+}
+
+Value IndexJoinThreshold::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::UBIGINT(config.index_join_threshold);
+}
+
 //===--------------------------------------------------------------------===//
 // Old Implicit Casting
 //===--------------------------------------------------------------------===//
@@ -1546,6 +1801,21 @@ Value PerfectHashThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(NumericCast<int64_t>(ClientConfig::GetConfig(context).perfect_ht_threshold));
 }
 
+//===--------------------------------------------------------------------===//
+// Pipeline Chunk Budget
+//===--------------------------------------------------------------------===//
+void PipelineChunkBudgetSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).pipeline_chunk_budget = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void PipelineChunkBudgetSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).pipeline_chunk_budget = ClientConfig().pipeline_chunk_budget;
+}
+
+Value PipelineChunkBudgetSetting::GetSetting(const ClientContext &context) {
+	return Value(StringUtil::BytesToHumanReadableString(ClientConfig::GetConfig(context).pipeline_chunk_budget));
+}
+
 //===--------------------------------------------------------------------===//
 // Pivot Filter Threshold
 //===--------------------------------------------------------------------===//
@@ -1576,6 +1846,28 @@ Value PivotLimitSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(NumericCast<int64_t>(ClientConfig::GetConfig(context).pivot_limit));
 }
 
+//===--------------------------------------------------------------------===//
+// Plan Cache Size
+//===--------------------------------------------------------------------===//
+void PlanCacheSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.plan_cache_size = input.GetValue<idx_t>();
+	if (db) {
+		PlanCache::Get(*db).Evict(config.options.plan_cache_size);
+	}
+}
+
+void PlanCacheSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.plan_cache_size = DBConfig().options.plan_cache_size;
+	if (db) {
+		PlanCache::Get(*db).Evict(config.options.plan_cache_size);
+	}
+}
+
+Value PlanCacheSizeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.plan_cache_size);
+}
+
 //===--------------------------------------------------------------------===//
 // PreserveIdentifierCase
 //===--------------------------------------------------------------------===//
@@ -1778,6 +2070,31 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Priority
+//===--------------------------------------------------------------------===//
+void QueryPrioritySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_priority = ClientConfig().query_priority;
+}
+
+void QueryPrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	auto parameter = StringUtil::Upper(input.ToString());
+	if (parameter == "LOW") {
+		ClientConfig::GetConfig(context).query_priority = QueryPriority::LOW;
+	} else if (parameter == "NORMAL") {
+		ClientConfig::GetConfig(context).query_priority = QueryPriority::NORMAL;
+	} else if (parameter == "HIGH") {
+		ClientConfig::GetConfig(context).query_priority = QueryPriority::HIGH;
+	} else {
+		throw InvalidInputException("Unrecognized query priority \"%s\", expected either LOW, NORMAL or HIGH",
+		                            input.ToString());
+	}
+}
+
+Value QueryPrioritySetting::GetSetting(const ClientContext &context) {
+	return Value(EnumUtil::ToString(ClientConfig::GetConfig(context).query_priority));
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1835,6 +2152,22 @@ Value SecretDirectorySetting::GetSetting(const ClientContext &context) {
 	return config.secret_manager->PersistentSecretPath();
 }
 
+//===--------------------------------------------------------------------===//
+// Synchronous Commit
+//===--------------------------------------------------------------------===//
+void SynchronousCommitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.synchronous_commit = input.GetValue<bool>();
+}
+
+void SynchronousCommitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.synchronous_commit = DBConfig().options.synchronous_commit;
+}
+
+Value SynchronousCommitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.synchronous_commit);
+}
+
 //===--------------------------------------------------------------------===//
 // Temp Directory
 //===--------------------------------------------------------------------===//
@@ -1862,6 +2195,54 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
+//===--------------------------------------------------------------------===//
+// Temp File Encryption
+//===--------------------------------------------------------------------===//
+void TempFileEncryptionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_encryption = input.GetValue<bool>();
+}
+
+void TempFileEncryptionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_encryption = DBConfig().options.temp_file_encryption;
+}
+
+Value TempFileEncryptionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_encryption);
+}
+
+//===--------------------------------------------------------------------===//
+// Direct IO
+//===--------------------------------------------------------------------===//
+void DirectIOSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.use_direct_io = input.GetValue<bool>();
+}
+
+void DirectIOSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.use_direct_io = DBConfig().options.use_direct_io;
+}
+
+Value DirectIOSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.use_direct_io);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -1974,6 +2355,80 @@ Value AllocatorBackgroundThreadsSetting::GetSetting(const ClientContext &context
 	return Value(config.options.allocator_background_threads);
 }
 
+//===--------------------------------------------------------------------===//
+// Buffer Eviction Policy
+//===--------------------------------------------------------------------===//
+void BufferEvictionPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Upper(input.ToString());
+	if (parameter == "LRU") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::LRU;
+	} else if (parameter == "TWO_QUEUE" || parameter == "2Q") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::TWO_QUEUE;
+	} else {
+		throw InvalidInputException("Unrecognized buffer eviction policy \"%s\", expected either LRU or TWO_QUEUE",
+		                            input.ToString());
+	}
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+void BufferEvictionPolicySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.buffer_eviction_policy = DBConfig().options.buffer_eviction_policy;
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+Value BufferEvictionPolicySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(EnumUtil::ToString(config.options.buffer_eviction_policy));
+}
+
+//===--------------------------------------------------------------------===//
+// Buffer Pool Huge Pages
+//===--------------------------------------------------------------------===//
+void BufferPoolHugePagesSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (db) {
+		throw InvalidInputException("Cannot change buffer_pool_huge_pages setting while database is running");
+	}
+	config.options.buffer_pool_huge_pages = input.GetValue<bool>();
+}
+
+void BufferPoolHugePagesSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	if (db) {
+		throw InvalidInputException("Cannot change buffer_pool_huge_pages setting while database is running");
+	}
+	config.options.buffer_pool_huge_pages = DBConfig().options.buffer_pool_huge_pages;
+}
+
+Value BufferPoolHugePagesSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.buffer_pool_huge_pages);
+}
+
+//===--------------------------------------------------------------------===//
+// Buffer Pool Prefault
+//===--------------------------------------------------------------------===//
+void BufferPoolPrefaultSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (db) {
+		throw InvalidInputException("Cannot change buffer_pool_prefault setting while database is running");
+	}
+	config.options.buffer_pool_prefault = input.GetValue<bool>();
+}
+
+void BufferPoolPrefaultSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	if (db) {
+		throw InvalidInputException("Cannot change buffer_pool_prefault setting while database is running");
+	}
+	config.options.buffer_pool_prefault = DBConfig().options.buffer_pool_prefault;
+}
+
+Value BufferPoolPrefaultSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.buffer_pool_prefault);
+}
+
 //===--------------------------------------------------------------------===//
 // DuckDBApi Setting
 //===--------------------------------------------------------------------===//
@@ -4,6 +4,7 @@
 #include "duckdb/main/materialized_query_result.hpp"
 #include "duckdb/common/box_renderer.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/buffered_data/arrow_buffered_data.hpp"
 
 namespace duckdb {
 
@@ -69,8 +70,25 @@ static bool ExecutionErrorOccurred(StreamExecutionResult result) {
 	return false;
 }
 
-unique_ptr<DataChunk> StreamQueryResult::FetchInternal(ClientContextLock &lock) {
+void StreamQueryResult::ProcessFetchError(ClientContextLock &lock, ErrorData error) {
 	bool invalidate_query = true;
+	if (!Exception::InvalidatesTransaction(error.Type())) {
+		// standard exceptions do not invalidate the current transaction
+		invalidate_query = false;
+	} else if (Exception::InvalidatesDatabase(error.Type())) {
+		// fatal exceptions invalidate the entire database
+		auto &config = context->config;
+		if (!config.query_verification_enabled) {
+			auto &db_instance = DatabaseInstance::GetDatabase(*context);
+			ValidChecker::Invalidate(db_instance, error.RawMessage());
+		}
+	}
+	context->ProcessError(error, context->GetCurrentQuery());
+	SetError(std::move(error));
+	context->CleanupInternal(lock, this, invalidate_query);
+}
+
+unique_ptr<DataChunk> StreamQueryResult::FetchInternal(ClientContextLock &lock) {
 	unique_ptr<DataChunk> chunk;
 	try {
 		// fetch the chunk and return it
@@ -85,24 +103,33 @@ unique_ptr<DataChunk> StreamQueryResult::FetchInternal(ClientContextLock &lock)
 		}
 		return chunk;
 	} catch (std::exception &ex) {
-		ErrorData error(ex);
-		if (!Exception::InvalidatesTransaction(error.Type())) {
-			// standard exceptions do not invalidate the current transaction
-			invalidate_query = false;
-		} else if (Exception::InvalidatesDatabase(error.Type())) {
-			// fatal exceptions invalidate the entire database
-			auto &config = context->config;
-			if (!config.query_verification_enabled) {
-				auto &db_instance = DatabaseInstance::GetDatabase(*context);
-				ValidChecker::Invalidate(db_instance, error.RawMessage());
-			}
-		}
-		context->ProcessError(error, context->GetCurrentQuery());
-		SetError(std::move(error));
+		ProcessFetchError(lock, ErrorData(ex));
 	} catch (...) { // LCOV_EXCL_START
 		SetError(ErrorData("Unhandled exception in FetchInternal"));
+		context->CleanupInternal(lock, this, true);
+	} // LCOV_EXCL_STOP
+	return nullptr;
+}
+
+unique_ptr<ArrowArrayWrapper> StreamQueryResult::FetchArrowArrayInternal(ClientContextLock &lock) {
+	unique_ptr<ArrowArrayWrapper> array;
+	try {
+		// fetch the next finished array and return it
+		auto stream_execution_result = buffered_data->ReplenishBuffer(*this, lock);
+		if (ExecutionErrorOccurred(stream_execution_result)) {
+			return array;
+		}
+		array = buffered_data->Cast<ArrowBufferedData>().ScanArray();
+		if (!array) {
+			context->CleanupInternal(lock, this);
+		}
+		return array;
+	} catch (std::exception &ex) {
+		ProcessFetchError(lock, ErrorData(ex));
+	} catch (...) { // LCOV_EXCL_START
+		SetError(ErrorData("Unhandled exception in FetchArrowArrayInternal"));
+		context->CleanupInternal(lock, this, true);
 	} // LCOV_EXCL_STOP
-	context->CleanupInternal(lock, this, invalidate_query);
 	return nullptr;
 }
 
@@ -120,6 +147,47 @@ unique_ptr<DataChunk> StreamQueryResult::FetchRaw() {
 	return chunk;
 }
 
+bool StreamQueryResult::IsArrowStream() const {
+	return buffered_data && buffered_data->GetType() == ArrowBufferedData::TYPE;
+}
+
+unique_ptr<ArrowArrayWrapper> StreamQueryResult::FetchArrowArray() {
+	if (!IsArrowStream()) {
+		throw InvalidInputException("Arrow arrays can only be fetched from a streaming Arrow result");
+	}
+	unique_ptr<ArrowArrayWrapper> array;
+	{
+		auto lock = LockContext();
+		CheckExecutableInternal(*lock);
+		array = FetchArrowArrayInternal(*lock);
+	}
+	if (!array) {
+		Close();
+	}
+	return array;
+}
+
+void StreamQueryResult::SetStreamingBufferSize(idx_t size) {
+	if (!buffered_data) {
+		throw InvalidInputException("Attempting to set the buffer size of an unsuccessful streaming result");
+	}
+	buffered_data->SetBufferBudget(size);
+}
+
+idx_t StreamQueryResult::GetBlockedSinkCount() const {
+	if (!buffered_data) {
+		return 0;
+	}
+	return buffered_data->GetBlockedSinkCount();
+}
+
+double StreamQueryResult::GetBlockedSinkTime() const {
+	if (!buffered_data) {
+		return 0;
+	}
+	return buffered_data->GetBlockedSinkTime();
+}
+
 #ifdef DUCKDB_ALTERNATIVE_VERIFY
 static unique_ptr<DataChunk> AlternativeFetch(StreamQueryResult &stream_result) {
 	// We first use StreamQueryResult::ExecuteTask until IsChunkReady becomes true
@@ -4,6 +4,8 @@
 #include "duckdb/common/type_visitor.hpp"
 #include "duckdb/common/types/row/tuple_data_layout.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/planner/operator/logical_any_join.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
@@ -135,10 +137,25 @@ idx_t BuildProbeSideOptimizer::ChildHasJoins(LogicalOperator &op) {
 void BuildProbeSideOptimizer::TryFlipJoinChildren(LogicalOperator &op) {
 	auto &left_child = *op.children[0];
 	auto &right_child = *op.children[1];
-	const auto lhs_cardinality = left_child.has_estimated_cardinality ? left_child.estimated_cardinality
-	                                                                  : left_child.EstimateCardinality(context);
-	const auto rhs_cardinality = right_child.has_estimated_cardinality ? right_child.estimated_cardinality
-	                                                                   : right_child.EstimateCardinality(context);
+	auto lhs_cardinality = left_child.has_estimated_cardinality ? left_child.estimated_cardinality
+	                                                            : left_child.EstimateCardinality(context);
+	auto rhs_cardinality = right_child.has_estimated_cardinality ? right_child.estimated_cardinality
+	                                                             : right_child.EstimateCardinality(context);
+	string left_key;
+	string right_key;
+	if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN &&
+	    DBConfig::GetConfig(context).options.enable_cardinality_feedback) {
+		// if a hash join was built on a child before, we know its actual size
+		auto &feedback = CardinalityFeedback::Get(context);
+		left_key = CardinalityFeedback::GetPlanKey(left_child);
+		right_key = CardinalityFeedback::GetPlanKey(right_child);
+		if (!left_key.empty()) {
+			feedback.TryGetBuildCardinality(left_key, lhs_cardinality);
+		}
+		if (!right_key.empty()) {
+			feedback.TryGetBuildCardinality(right_key, rhs_cardinality);
+		}
+	}
 
 	auto build_sizes = GetBuildSizes(op, lhs_cardinality, rhs_cardinality);
 	auto &left_side_build_cost = build_sizes.left_side;
@@ -184,6 +201,9 @@ void BuildProbeSideOptimizer::TryFlipJoinChildren(LogicalOperator &op) {
 	if (swap) {
 		FlipChildren(op);
 	}
+	if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		op.Cast<LogicalComparisonJoin>().build_feedback_key = swap ? left_key : right_key;
+	}
 }
 
 void BuildProbeSideOptimizer::VisitOperator(LogicalOperator &op) {
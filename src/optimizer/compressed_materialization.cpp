@@ -3,6 +3,7 @@
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/scalar/compressed_materialization_functions.hpp"
 #include "duckdb/function/scalar/operators.hpp"
+#include "duckdb/main/client_config.hpp"
 #include "duckdb/optimizer/column_binding_replacer.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
 #include "duckdb/optimizer/topn_optimizer.hpp"
@@ -59,7 +60,7 @@ void CompressedMaterialization::GetReferencedBindings(const Expression &expressi
 }
 
 void CompressedMaterialization::UpdateBindingInfo(CompressedMaterializationInfo &info, const ColumnBinding &binding,
-                                                  bool needs_decompression) {
+                                                  bool needs_decompression, optional_idx dictionary_id) {
 	auto &binding_map = info.binding_map;
 	auto binding_it = binding_map.find(binding);
 	if (binding_it == binding_map.end()) {
@@ -68,6 +69,7 @@ void CompressedMaterialization::UpdateBindingInfo(CompressedMaterializationInfo
 
 	auto &binding_info = binding_it->second;
 	binding_info.needs_decompression = needs_decompression;
+	binding_info.dictionary_id = dictionary_id;
 	auto stats_it = statistics_map.find(binding);
 	if (stats_it != statistics_map.end()) {
 		binding_info.stats = statistics_map[binding]->ToUnique();
@@ -138,9 +140,13 @@ bool CompressedMaterialization::TryCompressChild(CompressedMaterializationInfo &
 		const auto child_binding = child_info.bindings_before[child_i];
 		const auto &child_type = child_info.types[child_i];
 		const auto &can_compress = child_info.can_compress[child_i];
-		auto compress_expr = GetCompressExpression(child_binding, child_type, can_compress);
+		const auto can_use_dictionary =
+		    info.order_preserving_bindings.find(child_binding) == info.order_preserving_bindings.end();
+		auto compress_expr = GetCompressExpression(child_binding, child_type, can_compress, can_use_dictionary);
 		bool compressed = false;
+		optional_idx dictionary_id;
 		if (compress_expr) { // We compressed, mark the outgoing binding in need of decompression
+			dictionary_id = compress_expr->dictionary_id;
 			compress_exprs.emplace_back(std::move(compress_expr));
 			compressed = true;
 		} else { // We did not compress, just push a colref
@@ -149,7 +155,7 @@ bool CompressedMaterialization::TryCompressChild(CompressedMaterializationInfo &
 			unique_ptr<BaseStatistics> colref_stats = it != statistics_map.end() ? it->second->ToUnique() : nullptr;
 			compress_exprs.emplace_back(make_uniq<CompressExpression>(std::move(colref_expr), std::move(colref_stats)));
 		}
-		UpdateBindingInfo(info, child_binding, compressed);
+		UpdateBindingInfo(info, child_binding, compressed, dictionary_id);
 		compressed_anything = compressed_anything || compressed;
 	}
 	if (!compressed_anything) {
@@ -250,7 +256,10 @@ void CompressedMaterialization::CreateDecompressProjection(unique_ptr<LogicalOpe
 				continue;
 			}
 			stats = binding_info.stats.get();
-			if (binding_info.needs_decompression) {
+			if (binding_info.needs_decompression && binding_info.dictionary_id.IsValid()) {
+				decompress_expr =
+				    GetStringDictionaryDecompress(std::move(decompress_expr), binding_info.dictionary_id.GetIndex());
+			} else if (binding_info.needs_decompression) {
 				decompress_expr = GetDecompressExpression(std::move(decompress_expr), binding_info.type, *stats);
 			}
 		}
@@ -302,12 +311,18 @@ void CompressedMaterialization::CreateDecompressProjection(unique_ptr<LogicalOpe
 
 unique_ptr<CompressExpression> CompressedMaterialization::GetCompressExpression(const ColumnBinding &binding,
                                                                                 const LogicalType &type,
-                                                                                const bool &can_compress) {
+                                                                                const bool &can_compress,
+                                                                                const bool &can_use_dictionary) {
 	auto it = statistics_map.find(binding);
 	if (can_compress && it != statistics_map.end() && it->second) {
 		auto input = make_uniq<BoundColumnRefExpression>(type, binding);
 		const auto &stats = *it->second;
-		return GetCompressExpression(std::move(input), stats);
+		auto result = GetCompressExpression(input->Copy(), stats);
+		if (!result && can_use_dictionary && type.id() == LogicalTypeId::VARCHAR && type == stats.GetType()) {
+			// Strings that are too long to fit in an integer can be replaced by codes from a dictionary
+			result = GetStringDictionaryCompress(std::move(input), stats);
+		}
+		return result;
 	}
 	return nullptr;
 }
@@ -448,6 +463,33 @@ unique_ptr<CompressExpression> CompressedMaterialization::GetStringCompress(uniq
 	return make_uniq<CompressExpression>(std::move(compress_expr), compress_stats.ToUnique());
 }
 
+unique_ptr<CompressExpression> CompressedMaterialization::GetStringDictionaryCompress(unique_ptr<Expression> input,
+                                                                                      const BaseStatistics &stats) {
+	// The dictionary is built while compressing, only do this if we expect it to be small
+	const auto threshold = ClientConfig::GetConfig(context).compressed_materialization_dictionary_threshold;
+	const auto distinct_count = stats.GetDistinctCount();
+	if (distinct_count == 0 || distinct_count > threshold) {
+		return nullptr;
+	}
+
+	// Every compress projection gets its own dictionary
+	const auto dictionary_id = optimizer.binder.GenerateTableIndex();
+	auto compress_function = CMStringDictionaryCompressFun::GetFunction();
+	vector<unique_ptr<Expression>> arguments;
+	arguments.emplace_back(std::move(input));
+	auto compress_expr =
+	    make_uniq<BoundFunctionExpression>(LogicalType::UINTEGER, compress_function, std::move(arguments),
+	                                       make_uniq<CMStringDictionaryFunctionData>(dictionary_id));
+
+	// The codes are assigned in the order in which the strings arrive, we only know how many there are (roughly)
+	auto compress_stats = BaseStatistics::CreateUnknown(LogicalType::UINTEGER);
+	compress_stats.CopyBase(stats);
+
+	auto result = make_uniq<CompressExpression>(std::move(compress_expr), compress_stats.ToUnique());
+	result->dictionary_id = dictionary_id;
+	return result;
+}
+
 unique_ptr<Expression> CompressedMaterialization::GetDecompressExpression(unique_ptr<Expression> input,
                                                                           const LogicalType &result_type,
                                                                           const BaseStatistics &stats) {
@@ -482,4 +524,13 @@ unique_ptr<Expression> CompressedMaterialization::GetStringDecompress(unique_ptr
 	return make_uniq<BoundFunctionExpression>(result_type, decompress_function, std::move(arguments), nullptr);
 }
 
+unique_ptr<Expression> CompressedMaterialization::GetStringDictionaryDecompress(unique_ptr<Expression> input,
+                                                                                idx_t dictionary_id) {
+	auto decompress_function = CMStringDictionaryDecompressFun::GetFunction();
+	vector<unique_ptr<Expression>> arguments;
+	arguments.emplace_back(std::move(input));
+	return make_uniq<BoundFunctionExpression>(LogicalType::VARCHAR, decompress_function, std::move(arguments),
+	                                          make_uniq<CMStringDictionaryFunctionData>(dictionary_id));
+}
+
 } // namespace duckdb
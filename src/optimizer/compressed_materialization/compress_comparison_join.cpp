@@ -44,24 +44,37 @@ void CompressedMaterialization::CompressComparisonJoin(unique_ptr<LogicalOperato
 	}
 #endif
 
+	// Count how often every binding shows up in the join conditions
+	column_binding_map_t<idx_t> condition_binding_counts;
+	for (const auto &condition : join.conditions) {
+		column_binding_set_t condition_bindings;
+		GetReferencedBindings(*condition.left, condition_bindings);
+		GetReferencedBindings(*condition.right, condition_bindings);
+		for (auto &binding : condition_bindings) {
+			condition_binding_counts[binding]++;
+		}
+	}
+
 	// Find all bindings referenced by non-colref expressions in the conditions
 	// These are excluded from compression by projection
 	// But we can try to compress the expression directly
 	column_binding_set_t probe_compress_bindings;
 	column_binding_set_t referenced_bindings;
 	for (const auto &condition : join.conditions) {
-		if (join.conditions.size() == 1 && join.type != LogicalOperatorType::LOGICAL_DELIM_JOIN) {
-			// We only try to compress the join condition cols if there's one join condition
-			// Else it gets messy with the stats if one column shows up in multiple conditions
+		if (join.type != LogicalOperatorType::LOGICAL_DELIM_JOIN) {
 			if (condition.left->GetExpressionType() == ExpressionType::BOUND_COLUMN_REF &&
 			    condition.right->GetExpressionType() == ExpressionType::BOUND_COLUMN_REF) {
 				// Both are bound column refs, see if both can be compressed generically to the same type
 				auto &lhs_colref = condition.left->Cast<BoundColumnRefExpression>();
 				auto &rhs_colref = condition.right->Cast<BoundColumnRefExpression>();
+				// We only try to compress the columns if they show up in a single join condition
+				// Else it gets messy with the stats, as both sides of every condition need the same stats
+				const auto single_condition = condition_binding_counts[lhs_colref.binding] == 1 &&
+				                              condition_binding_counts[rhs_colref.binding] == 1;
 				auto lhs_it = statistics_map.find(lhs_colref.binding);
 				auto rhs_it = statistics_map.find(rhs_colref.binding);
-				if (lhs_it != statistics_map.end() && rhs_it != statistics_map.end() && lhs_it->second &&
-				    rhs_it->second) {
+				if (single_condition && lhs_it != statistics_map.end() && rhs_it != statistics_map.end() &&
+				    lhs_it->second && rhs_it->second) {
 					// For joins we need to compress both using the same statistics, otherwise comparisons don't work
 					auto merged_stats = lhs_it->second->Copy();
 					merged_stats.Merge(*rhs_it->second);
@@ -106,6 +119,12 @@ void CompressedMaterialization::CompressComparisonJoin(unique_ptr<LogicalOperato
 	PopulateBindingMap(info, bindings_out, types, left_child);
 	PopulateBindingMap(info, bindings_out, types, right_child);
 
+	// Both sides of the conditions have to be compressed the same way, so we cannot use a dictionary for them
+	for (const auto &condition : join.conditions) {
+		GetReferencedBindings(*condition.left, info.order_preserving_bindings);
+		GetReferencedBindings(*condition.right, info.order_preserving_bindings);
+	}
+
 	// Now try to compress
 	CreateProjections(op, info);
 
@@ -35,6 +35,13 @@ void CompressedMaterialization::CompressDistinct(unique_ptr<LogicalOperator> &op
 		info.binding_map.emplace(bindings[col_idx], CMBindingInfo(bindings[col_idx], types[col_idx]));
 	}
 
+	// Dictionary codes do not preserve the order of the strings, so we cannot use them for the order keys
+	if (distinct.order_by) {
+		for (auto &order : distinct.order_by->orders) {
+			GetReferencedBindings(*order.expression, info.order_preserving_bindings);
+		}
+	}
+
 	// Now try to compress
 	CreateProjections(op, info);
 }
@@ -34,6 +34,11 @@ void CompressedMaterialization::CompressOrder(unique_ptr<LogicalOperator> &op) {
 		info.binding_map.emplace(bindings[col_idx], CMBindingInfo(bindings[col_idx], types[col_idx]));
 	}
 
+	// Dictionary codes do not preserve the order of the strings, so we cannot use them for the order keys
+	for (auto &bound_order : order.orders) {
+		GetReferencedBindings(*bound_order.expression, info.order_preserving_bindings);
+	}
+
 	// Now try to compress
 	CreateProjections(op, info);
 
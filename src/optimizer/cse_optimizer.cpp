@@ -1,5 +1,7 @@
 #include "duckdb/optimizer/cse_optimizer.hpp"
 
+#include "duckdb/optimizer/expression_heuristics.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/operator/logical_filter.hpp"
@@ -33,9 +35,16 @@ struct CSEReplacementState {
 	vector<unique_ptr<Expression>> cached_expressions;
 };
 
+CommonSubExpressionOptimizer::CommonSubExpressionOptimizer(Optimizer &optimizer)
+    : optimizer(optimizer), binder(optimizer.binder) {
+}
+
 void CommonSubExpressionOptimizer::VisitOperator(LogicalOperator &op) {
 	switch (op.type) {
 	case LogicalOperatorType::LOGICAL_PROJECTION:
+		ExtractFilterSubExpressions(op);
+		ExtractCommonSubExpresions(op);
+		break;
 	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
 		ExtractCommonSubExpresions(op);
 		break;
@@ -156,4 +165,114 @@ void CommonSubExpressionOptimizer::ExtractCommonSubExpresions(LogicalOperator &o
 	op.children[0] = std::move(projection);
 }
 
+void CommonSubExpressionOptimizer::CollectFilterExpressions(Expression &expr, expression_set_t &result) {
+	switch (expr.expression_class) {
+	case ExpressionClass::BOUND_COLUMN_REF:
+	case ExpressionClass::BOUND_CONSTANT:
+	case ExpressionClass::BOUND_PARAMETER:
+	// the children of conjunctions and case are not evaluated for every row
+	case ExpressionClass::BOUND_CONJUNCTION:
+	case ExpressionClass::BOUND_CASE:
+		return;
+	case ExpressionClass::BOUND_OPERATOR:
+		if (expr.type == ExpressionType::OPERATOR_COALESCE) {
+			return;
+		}
+		break;
+	default:
+		break;
+	}
+	ExpressionHeuristics heuristics(optimizer);
+	if (!expr.IsVolatile() && heuristics.Cost(expr) >= EXPENSIVE_EXPRESSION_COST) {
+		result.insert(expr);
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { CollectFilterExpressions(child, result); });
+}
+
+//! Finds the expressions that the filter evaluates for every row in the given expression
+static void FindSharedExpressions(Expression &expr, const expression_set_t &filter_expressions,
+                                  vector<unique_ptr<Expression>> &shared, expression_map_t<idx_t> &shared_map) {
+	if (filter_expressions.find(expr) != filter_expressions.end()) {
+		if (shared_map.find(expr) == shared_map.end()) {
+			shared.push_back(expr.Copy());
+			shared_map[*shared.back()] = shared.size() - 1;
+		}
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(
+	    expr, [&](Expression &child) { FindSharedExpressions(child, filter_expressions, shared, shared_map); });
+}
+
+//! Replaces the shared expressions with references to the projection, and moves the other references to it
+static void ReplaceSharedExpressions(unique_ptr<Expression> &expr, const expression_map_t<idx_t> &shared_map,
+                                     const column_binding_map_t<idx_t> &column_map, idx_t projection_index) {
+	auto entry = shared_map.find(*expr);
+	if (entry != shared_map.end()) {
+		expr = make_uniq<BoundColumnRefExpression>(expr->alias, expr->return_type,
+		                                           ColumnBinding(projection_index, column_map.size() + entry->second));
+		return;
+	}
+	if (expr->expression_class == ExpressionClass::BOUND_COLUMN_REF) {
+		auto &colref = expr->Cast<BoundColumnRefExpression>();
+		auto column_entry = column_map.find(colref.binding);
+		if (column_entry != column_map.end()) {
+			colref.binding = ColumnBinding(projection_index, column_entry->second);
+		}
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<Expression> &child) {
+		ReplaceSharedExpressions(child, shared_map, column_map, projection_index);
+	});
+}
+
+void CommonSubExpressionOptimizer::ExtractFilterSubExpressions(LogicalOperator &op) {
+	D_ASSERT(op.type == LogicalOperatorType::LOGICAL_PROJECTION);
+	auto &filter = *op.children[0];
+	// only the first expression of a filter is evaluated for every row
+	if (filter.type != LogicalOperatorType::LOGICAL_FILTER || filter.expressions.size() != 1 ||
+	    !filter.Cast<LogicalFilter>().projection_map.empty()) {
+		return;
+	}
+	expression_set_t filter_expressions;
+	CollectFilterExpressions(*filter.expressions[0], filter_expressions);
+	if (filter_expressions.empty()) {
+		return;
+	}
+	vector<unique_ptr<Expression>> shared;
+	expression_map_t<idx_t> shared_map;
+	for (auto &expr : op.expressions) {
+		FindSharedExpressions(*expr, filter_expressions, shared, shared_map);
+	}
+	if (shared.empty()) {
+		return;
+	}
+
+	// compute the shared expressions in a projection under the filter, which also passes through all columns
+	auto &child = filter.children[0];
+	child->ResolveOperatorTypes();
+	auto bindings = child->GetColumnBindings();
+	const auto projection_index = binder.GenerateTableIndex();
+	column_binding_map_t<idx_t> column_map;
+	vector<unique_ptr<Expression>> expressions;
+	for (idx_t col_idx = 0; col_idx < bindings.size(); col_idx++) {
+		column_map[bindings[col_idx]] = col_idx;
+		expressions.push_back(make_uniq<BoundColumnRefExpression>(child->types[col_idx], bindings[col_idx]));
+	}
+
+	for (auto &expr : op.expressions) {
+		ReplaceSharedExpressions(expr, shared_map, column_map, projection_index);
+	}
+	ReplaceSharedExpressions(filter.expressions[0], shared_map, column_map, projection_index);
+	for (auto &expr : shared) {
+		expressions.push_back(std::move(expr));
+	}
+
+	auto projection = make_uniq<LogicalProjection>(projection_index, std::move(expressions));
+	if (child->has_estimated_cardinality) {
+		projection->SetEstimatedCardinality(child->estimated_cardinality);
+	}
+	projection->children.push_back(std::move(child));
+	filter.children[0] = std::move(projection);
+}
+
 } // namespace duckdb
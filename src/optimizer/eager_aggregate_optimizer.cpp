@@ -0,0 +1,401 @@
+#include "duckdb/optimizer/eager_aggregate_optimizer.hpp"
+
+#include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/optimizer/join_order/relation_statistics_helper.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+EagerAggregateOptimizer::EagerAggregateOptimizer(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
+unique_ptr<LogicalOperator> EagerAggregateOptimizer::Optimize(unique_ptr<LogicalOperator> op) {
+	op = OptimizeInternal(std::move(op));
+	if (!replacer.replacement_bindings.empty()) {
+		replacer.VisitOperator(*op);
+	}
+	return op;
+}
+
+unique_ptr<LogicalOperator> EagerAggregateOptimizer::OptimizeInternal(unique_ptr<LogicalOperator> op) {
+	for (auto &child : op->children) {
+		child = OptimizeInternal(std::move(child));
+	}
+	if (op->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		if (op->Cast<LogicalAggregate>().grouping_sets.size() > 1) {
+			return TryPreaggregateGroupingSets(std::move(op));
+		}
+		return TryPushdown(std::move(op));
+	}
+	return op;
+}
+
+static void GetColumnReferences(const Expression &expr, vector<reference<const BoundColumnRefExpression>> &result) {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		result.push_back(expr.Cast<BoundColumnRefExpression>());
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) { GetColumnReferences(child, result); });
+}
+
+//! Returns the aggregate that combines the partial aggregates of "aggr", or an empty string if there is none
+static string GetCombineFunctionName(const BoundAggregateExpression &aggr) {
+	if (aggr.IsDistinct() || aggr.filter || aggr.order_bys) {
+		return string();
+	}
+	for (auto &child : aggr.children) {
+		if (child->IsVolatile()) {
+			return string();
+		}
+	}
+	auto &name = aggr.function.name;
+	if (name == "sum" || name == "count" || name == "count_star") {
+		return "sum";
+	}
+	if (name == "min" || name == "max") {
+		return name;
+	}
+	return string();
+}
+
+bool EagerAggregateOptimizer::BindCombineAggregates(ClientContext &context,
+                                                    const vector<unique_ptr<Expression>> &partial_aggregates,
+                                                    const vector<string> &combine_names,
+                                                    idx_t partial_aggregate_index, CombinedAggregates &result) {
+	FunctionBinder function_binder(context);
+	for (idx_t i = 0; i < partial_aggregates.size(); i++) {
+		auto &partial = partial_aggregates[i]->Cast<BoundAggregateExpression>();
+		auto &partial_type = partial.return_type;
+		auto &func = Catalog::GetEntry<AggregateFunctionCatalogEntry>(context, SYSTEM_CATALOG, DEFAULT_SCHEMA,
+		                                                              combine_names[i]);
+		ErrorData error;
+		auto best_function = function_binder.BindFunction(func.name, func.functions, {partial_type}, error);
+		if (!best_function.IsValid()) {
+			return false;
+		}
+		vector<unique_ptr<Expression>> children;
+		children.push_back(
+		    make_uniq<BoundColumnRefExpression>(partial_type, ColumnBinding(partial_aggregate_index, i)));
+		auto combine = function_binder.BindAggregateFunction(
+		    func.functions.GetFunctionByOffset(best_function.GetIndex()), std::move(children));
+		result.aggregates.push_back(std::move(combine));
+		result.original_types.push_back(partial_type);
+		result.is_count.push_back(partial.function.name == "count" || partial.function.name == "count_star");
+	}
+	return true;
+}
+
+bool EagerAggregateOptimizer::GetDistinctCount(LogicalOperator &op, const ColumnBinding &binding, idx_t &result) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		if (get.table_index != binding.table_index) {
+			return false;
+		}
+		// the column index of a binding of a scan already refers to its column ids, even if it has projection ids
+		auto stats = RelationStatisticsHelper::ExtractGetStats(get, optimizer.context);
+		if (binding.column_index >= stats.column_distinct_count.size()) {
+			return false;
+		}
+		auto &distinct_count = stats.column_distinct_count[binding.column_index];
+		if (!distinct_count.from_hll) {
+			// without statistics the distinct count is just the cardinality of the table
+			return false;
+		}
+		result = distinct_count.distinct_count;
+		return true;
+	}
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		auto &proj = op.Cast<LogicalProjection>();
+		if (proj.table_index != binding.table_index) {
+			return false;
+		}
+		auto &expr = *proj.expressions[binding.column_index];
+		if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+			return false;
+		}
+		return GetDistinctCount(*op.children[0], expr.Cast<BoundColumnRefExpression>().binding, result);
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+	case LogicalOperatorType::LOGICAL_CROSS_PRODUCT: {
+		// these operators emit the bindings of their children, filters can only reduce the distinct count
+		for (auto &child : op.children) {
+			if (GetDistinctCount(*child, binding, result)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+unique_ptr<LogicalOperator> EagerAggregateOptimizer::TryPushdown(unique_ptr<LogicalOperator> op) {
+	auto &aggr = op->Cast<LogicalAggregate>();
+	if (aggr.groups.empty() || aggr.grouping_sets.size() > 1 || !aggr.grouping_functions.empty()) {
+		// an ungrouped aggregate over an empty join still emits a row, e.g. a count of zero, which is a NULL sum
+		return op;
+	}
+	if (aggr.children[0]->type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		return op;
+	}
+	auto &join = aggr.children[0]->Cast<LogicalComparisonJoin>();
+	if (join.join_type != JoinType::INNER || !join.left_projection_map.empty() ||
+	    !join.right_projection_map.empty()) {
+		return op;
+	}
+
+	// all aggregates have to be computed over the same side of the join
+	column_binding_set_t left_bindings;
+	for (auto &binding : join.children[0]->GetColumnBindings()) {
+		left_bindings.insert(binding);
+	}
+	idx_t side = DConstants::INVALID_INDEX;
+	vector<string> combine_names;
+	for (auto &expr : aggr.expressions) {
+		if (expr->GetExpressionClass() != ExpressionClass::BOUND_AGGREGATE) {
+			return op;
+		}
+		auto &bound_aggr = expr->Cast<BoundAggregateExpression>();
+		auto combine_name = GetCombineFunctionName(bound_aggr);
+		if (combine_name.empty()) {
+			return op;
+		}
+		combine_names.push_back(std::move(combine_name));
+		vector<reference<const BoundColumnRefExpression>> references;
+		for (auto &child : bound_aggr.children) {
+			GetColumnReferences(*child, references);
+		}
+		for (auto &ref : references) {
+			idx_t ref_side = left_bindings.find(ref.get().binding) != left_bindings.end() ? 0 : 1;
+			if (side != DConstants::INVALID_INDEX && side != ref_side) {
+				return op;
+			}
+			side = ref_side;
+		}
+	}
+	auto &context = optimizer.context;
+	if (side == DConstants::INVALID_INDEX) {
+		// only count(*): aggregate the larger side
+		side = join.children[0]->EstimateCardinality(context) >= join.children[1]->EstimateCardinality(context) ? 0
+		                                                                                                          : 1;
+	}
+	auto &child = *join.children[side];
+	column_binding_set_t side_bindings;
+	for (auto &binding : child.GetColumnBindings()) {
+		side_bindings.insert(binding);
+	}
+
+	// the partial aggregate groups on the columns of its side that are used by the join conditions and the groups
+	vector<reference<const BoundColumnRefExpression>> references;
+	for (auto &cond : join.conditions) {
+		GetColumnReferences(*cond.left, references);
+		GetColumnReferences(*cond.right, references);
+	}
+	for (auto &group : aggr.groups) {
+		GetColumnReferences(*group, references);
+	}
+	vector<unique_ptr<Expression>> partial_groups;
+	column_binding_set_t partial_group_bindings;
+	for (auto &ref : references) {
+		auto &binding = ref.get().binding;
+		if (side_bindings.find(binding) == side_bindings.end() ||
+		    partial_group_bindings.find(binding) != partial_group_bindings.end()) {
+			continue;
+		}
+		partial_group_bindings.insert(binding);
+		partial_groups.push_back(make_uniq<BoundColumnRefExpression>(ref.get().return_type, binding));
+	}
+	if (partial_groups.empty()) {
+		return op;
+	}
+
+	// only push the aggregate down if the statistics tell us that it considerably reduces the input of the join
+	auto input_count = child.EstimateCardinality(context);
+	double group_count = 1;
+	for (auto &group : partial_groups) {
+		idx_t distinct_count;
+		if (!GetDistinctCount(child, group->Cast<BoundColumnRefExpression>().binding, distinct_count)) {
+			return op;
+		}
+		group_count *= static_cast<double>(distinct_count);
+	}
+	if (group_count * static_cast<double>(MINIMUM_REDUCTION) > static_cast<double>(input_count)) {
+		return op;
+	}
+
+	// bind the aggregates that combine the partial aggregates before modifying the plan
+	auto &binder = optimizer.binder;
+	auto partial_group_index = binder.GenerateTableIndex();
+	auto partial_aggregate_index = binder.GenerateTableIndex();
+	CombinedAggregates combined;
+	if (!BindCombineAggregates(context, aggr.expressions, combine_names, partial_aggregate_index, combined)) {
+		return op;
+	}
+
+	// insert the partial aggregate below the join
+	ColumnBindingReplacer group_replacer;
+	for (idx_t i = 0; i < partial_groups.size(); i++) {
+		auto &binding = partial_groups[i]->Cast<BoundColumnRefExpression>().binding;
+		group_replacer.replacement_bindings.emplace_back(binding, ColumnBinding(partial_group_index, i));
+	}
+	auto partial =
+	    make_uniq<LogicalAggregate>(partial_group_index, partial_aggregate_index, std::move(aggr.expressions));
+	partial->groups = std::move(partial_groups);
+	partial->children.push_back(std::move(join.children[side]));
+	partial->SetEstimatedCardinality(LossyNumericCast<idx_t>(group_count));
+	partial->ResolveOperatorTypes();
+	group_replacer.stop_operator = partial.get();
+	join.children[side] = std::move(partial);
+	aggr.expressions = std::move(combined.aggregates);
+
+	// the join conditions and the groups now refer to the groups of the partial aggregate
+	group_replacer.VisitOperator(aggr);
+	join.ResolveOperatorTypes();
+	aggr.ResolveOperatorTypes();
+	return FinalizeCombinedAggregates(std::move(op), combined);
+}
+
+unique_ptr<LogicalOperator> EagerAggregateOptimizer::TryPreaggregateGroupingSets(unique_ptr<LogicalOperator> op) {
+	auto &aggr = op->Cast<LogicalAggregate>();
+	D_ASSERT(aggr.grouping_sets.size() > 1);
+	vector<string> combine_names;
+	for (auto &expr : aggr.expressions) {
+		if (expr->GetExpressionClass() != ExpressionClass::BOUND_AGGREGATE) {
+			return op;
+		}
+		auto combine_name = GetCombineFunctionName(expr->Cast<BoundAggregateExpression>());
+		if (combine_name.empty()) {
+			return op;
+		}
+		combine_names.push_back(std::move(combine_name));
+	}
+	for (auto &group : aggr.groups) {
+		if (group->IsVolatile()) {
+			return op;
+		}
+	}
+
+	// only pre-aggregate if the statistics tell us that the aggregate over all groups considerably reduces the input
+	auto &context = optimizer.context;
+	auto &child = *aggr.children[0];
+	auto input_count = child.EstimateCardinality(context);
+	double group_count = 1;
+	for (auto &group : aggr.groups) {
+		idx_t distinct_count;
+		if (group->GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF ||
+		    !GetDistinctCount(child, group->Cast<BoundColumnRefExpression>().binding, distinct_count)) {
+			return op;
+		}
+		group_count *= static_cast<double>(distinct_count);
+	}
+	if (group_count * static_cast<double>(MINIMUM_REDUCTION) > static_cast<double>(input_count)) {
+		return op;
+	}
+
+	// bind the aggregates that combine the partial aggregates before modifying the plan
+	auto &binder = optimizer.binder;
+	auto partial_group_index = binder.GenerateTableIndex();
+	auto partial_aggregate_index = binder.GenerateTableIndex();
+	CombinedAggregates combined;
+	if (!BindCombineAggregates(context, aggr.expressions, combine_names, partial_aggregate_index, combined)) {
+		return op;
+	}
+
+	// aggregate the input on all groups once, the grouping sets are then computed from this (much smaller) result
+	vector<unique_ptr<Expression>> groups;
+	for (idx_t i = 0; i < aggr.groups.size(); i++) {
+		groups.push_back(
+		    make_uniq<BoundColumnRefExpression>(aggr.groups[i]->return_type, ColumnBinding(partial_group_index, i)));
+	}
+	auto partial =
+	    make_uniq<LogicalAggregate>(partial_group_index, partial_aggregate_index, std::move(aggr.expressions));
+	partial->groups = std::move(aggr.groups);
+	partial->children.push_back(std::move(aggr.children[0]));
+	partial->SetEstimatedCardinality(LossyNumericCast<idx_t>(group_count));
+	partial->ResolveOperatorTypes();
+	aggr.children[0] = std::move(partial);
+	aggr.groups = std::move(groups);
+	aggr.expressions = std::move(combined.aggregates);
+	aggr.ResolveOperatorTypes();
+	return FinalizeCombinedAggregates(std::move(op), combined);
+}
+
+unique_ptr<LogicalOperator> EagerAggregateOptimizer::FinalizeCombinedAggregates(unique_ptr<LogicalOperator> op,
+                                                                              const CombinedAggregates &combined) {
+	auto &aggr = op->Cast<LogicalAggregate>();
+	bool requires_projection = false;
+	for (idx_t i = 0; i < aggr.expressions.size(); i++) {
+		requires_projection = requires_projection || combined.is_count[i] ||
+		                      aggr.expressions[i]->return_type != combined.original_types[i];
+	}
+	if (!requires_projection) {
+		return op;
+	}
+
+	// some of the combined aggregates have a different type (e.g., a sum of counts): cast them back in a projection
+	// as a sum of counts is NULL if there are no input rows (e.g., for the empty grouping set), replace it with 0
+	auto &context = optimizer.context;
+	auto &binder = optimizer.binder;
+	auto group_index = aggr.group_index;
+	auto aggregate_index = aggr.aggregate_index;
+	aggr.group_index = binder.GenerateTableIndex();
+	aggr.aggregate_index = binder.GenerateTableIndex();
+	auto projection_index = binder.GenerateTableIndex();
+	vector<unique_ptr<Expression>> projections;
+	for (idx_t i = 0; i < aggr.groups.size(); i++) {
+		projections.push_back(
+		    make_uniq<BoundColumnRefExpression>(aggr.groups[i]->return_type, ColumnBinding(aggr.group_index, i)));
+		replacer.replacement_bindings.emplace_back(ColumnBinding(group_index, i),
+		                                           ColumnBinding(projection_index, projections.size() - 1));
+	}
+	for (idx_t i = 0; i < aggr.expressions.size(); i++) {
+		auto ref = make_uniq<BoundColumnRefExpression>(aggr.expressions[i]->return_type,
+		                                               ColumnBinding(aggr.aggregate_index, i));
+		auto combined_aggregate =
+		    BoundCastExpression::AddCastToType(context, std::move(ref), combined.original_types[i]);
+		if (combined.is_count[i]) {
+			auto coalesce = make_uniq<BoundOperatorExpression>(ExpressionType::OPERATOR_COALESCE,
+			                                                   combined.original_types[i]);
+			coalesce->children.push_back(std::move(combined_aggregate));
+			coalesce->children.push_back(make_uniq<BoundConstantExpression>(Value::BIGINT(0)));
+			combined_aggregate = std::move(coalesce);
+		}
+		projections.push_back(std::move(combined_aggregate));
+		replacer.replacement_bindings.emplace_back(ColumnBinding(aggregate_index, i),
+		                                           ColumnBinding(projection_index, projections.size() - 1));
+	}
+	if (!aggr.grouping_functions.empty()) {
+		auto groupings_index = aggr.groupings_index;
+		aggr.groupings_index = binder.GenerateTableIndex();
+		for (idx_t i = 0; i < aggr.grouping_functions.size(); i++) {
+			projections.push_back(
+			    make_uniq<BoundColumnRefExpression>(LogicalType::BIGINT, ColumnBinding(aggr.groupings_index, i)));
+			replacer.replacement_bindings.emplace_back(ColumnBinding(groupings_index, i),
+			                                           ColumnBinding(projection_index, projections.size() - 1));
+		}
+	}
+	auto projection = make_uniq<LogicalProjection>(projection_index, std::move(projections));
+	if (aggr.has_estimated_cardinality) {
+		projection->SetEstimatedCardinality(aggr.estimated_cardinality);
+	}
+	projection->children.push_back(std::move(op));
+	projection->ResolveOperatorTypes();
+	return std::move(projection);
+}
+
+} // namespace duckdb
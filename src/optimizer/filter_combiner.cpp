@@ -15,6 +15,7 @@
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/storage/statistics/string_stats.hpp"
 
 namespace duckdb {
 
@@ -435,6 +436,22 @@ static unique_ptr<TableFilter> PushDownFilterIntoExpr(const Expression &expr, un
 	return inner_filter;
 }
 
+static bool IsPrefixFunction(const string &name) {
+	return name == "prefix" || name == "starts_with" || name == "^@";
+}
+
+//! Pushes the range [prefix, upper_bound) of strings starting with the prefix
+static void PushPrefixFilters(TableFilterSet &table_filters, idx_t column_index, const string &prefix) {
+	table_filters.PushFilter(column_index,
+	                         make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, Value(prefix)));
+	string upper_bound;
+	if (StringStats::GetPrefixUpperBound(prefix, upper_bound)) {
+		table_filters.PushFilter(column_index,
+		                         make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHAN, Value(upper_bound)));
+	}
+	table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
+}
+
 TableFilterSet FilterCombiner::GenerateTableScanFilters(const vector<idx_t> &column_ids) {
 	TableFilterSet table_filters;
 	//! First, we figure the filters that have constant expressions that we can push down to the table scan
@@ -488,25 +505,22 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(const vector<idx_t> &col
 		auto &remaining_filter = remaining_filters[rem_fil_idx];
 		if (remaining_filter->expression_class == ExpressionClass::BOUND_FUNCTION) {
 			auto &func = remaining_filter->Cast<BoundFunctionExpression>();
-			if (func.function.name == "prefix" &&
+			if (IsPrefixFunction(func.function.name) &&
 			    func.children[0]->expression_class == ExpressionClass::BOUND_COLUMN_REF &&
 			    func.children[1]->type == ExpressionType::VALUE_CONSTANT) {
 				//! This is a like function.
 				auto &column_ref = func.children[0]->Cast<BoundColumnRefExpression>();
 				auto &constant_value_expr = func.children[1]->Cast<BoundConstantExpression>();
-				auto like_string = StringValue::Get(constant_value_expr.value);
+				if (constant_value_expr.value.IsNull()) {
+					continue;
+				}
+				auto &like_string = StringValue::Get(constant_value_expr.value);
 				if (like_string.empty()) {
 					continue;
 				}
 				auto column_index = column_ids[column_ref.binding.column_index];
 				//! Here the like must be transformed to a BOUND COMPARISON geq le
-				auto lower_bound =
-				    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, Value(like_string));
-				like_string[like_string.size() - 1]++;
-				auto upper_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHAN, Value(like_string));
-				table_filters.PushFilter(column_index, std::move(lower_bound));
-				table_filters.PushFilter(column_index, std::move(upper_bound));
-				table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
+				PushPrefixFilters(table_filters, column_index, like_string);
 			}
 			if (func.function.name == "~~" && func.children[0]->expression_class == ExpressionClass::BOUND_COLUMN_REF &&
 			    func.children[1]->type == ExpressionType::VALUE_CONSTANT) {
@@ -524,7 +538,7 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(const vector<idx_t> &col
 				auto &like_string = StringValue::Get(constant_value_expr.value);
 				if (like_string[0] == '%' || like_string[0] == '_') {
 					//! We have no prefix so nothing to pushdown
-					break;
+					continue;
 				}
 				string prefix;
 				bool equality = true;
@@ -542,13 +556,7 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(const vector<idx_t> &col
 					table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
 				} else {
 					//! Here the like must be transformed to a BOUND COMPARISON geq le
-					auto lower_bound =
-					    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, Value(prefix));
-					prefix[prefix.size() - 1]++;
-					auto upper_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHAN, Value(prefix));
-					table_filters.PushFilter(column_index, std::move(lower_bound));
-					table_filters.PushFilter(column_index, std::move(upper_bound));
-					table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
+					PushPrefixFilters(table_filters, column_index, prefix);
 				}
 			}
 		} else if (remaining_filter->type == ExpressionType::COMPARE_IN) {
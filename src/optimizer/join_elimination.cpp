@@ -0,0 +1,599 @@
+#include "duckdb/optimizer/join_elimination.hpp"
+
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/set.hpp"
+#include "duckdb/parser/constraints/foreign_key_constraint.hpp"
+#include "duckdb/parser/constraints/unique_constraint.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/filter/null_filter.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_distinct.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+//! The maximum depth up to which the uniqueness of a relation is derived
+static constexpr const idx_t MAXIMUM_UNIQUE_DEPTH = 12;
+
+JoinElimination::JoinElimination() {
+}
+
+unique_ptr<LogicalOperator> JoinElimination::Optimize(unique_ptr<LogicalOperator> op) {
+	plan = std::move(op);
+	CollectReferences();
+	OptimizeInternal(plan);
+	return std::move(plan);
+}
+
+void JoinElimination::OptimizeInternal(unique_ptr<LogicalOperator> &op) {
+	for (auto &child : op->children) {
+		OptimizeInternal(child);
+	}
+	if (op->type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		return;
+	}
+	auto &join = op->Cast<LogicalComparisonJoin>();
+	if (!join.left_projection_map.empty() || !join.right_projection_map.empty()) {
+		return;
+	}
+	switch (join.join_type) {
+	case JoinType::INNER:
+		if (TryEliminateForeignKeyJoin(op, 1) || TryEliminateForeignKeyJoin(op, 0) || TryEliminateSelfJoin(op)) {
+			return;
+		}
+		if (TryEliminateUniqueJoin(op, 1)) {
+			return;
+		}
+		TryEliminateUniqueJoin(op, 0);
+		break;
+	case JoinType::LEFT:
+		TryEliminateUniqueJoin(op, 1);
+		break;
+	default:
+		break;
+	}
+}
+
+static bool ReferencesColumnsByBinding(LogicalOperatorType type) {
+	switch (type) {
+	case LogicalOperatorType::LOGICAL_PROJECTION:
+	case LogicalOperatorType::LOGICAL_FILTER:
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
+	case LogicalOperatorType::LOGICAL_WINDOW:
+	case LogicalOperatorType::LOGICAL_UNNEST:
+	case LogicalOperatorType::LOGICAL_LIMIT:
+	case LogicalOperatorType::LOGICAL_ORDER_BY:
+	case LogicalOperatorType::LOGICAL_TOP_N:
+	case LogicalOperatorType::LOGICAL_DISTINCT:
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+	case LogicalOperatorType::LOGICAL_ANY_JOIN:
+	case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
+	case LogicalOperatorType::LOGICAL_POSITIONAL_JOIN:
+	case LogicalOperatorType::LOGICAL_ASOF_JOIN:
+	case LogicalOperatorType::LOGICAL_DELIM_JOIN:
+	case LogicalOperatorType::LOGICAL_GET:
+	case LogicalOperatorType::LOGICAL_CHUNK_GET:
+	case LogicalOperatorType::LOGICAL_DELIM_GET:
+	case LogicalOperatorType::LOGICAL_EXPRESSION_GET:
+	case LogicalOperatorType::LOGICAL_DUMMY_SCAN:
+	case LogicalOperatorType::LOGICAL_EMPTY_RESULT:
+	case LogicalOperatorType::LOGICAL_CTE_REF:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static void CountReferences(Expression &expr, column_binding_map_t<idx_t> &result) {
+	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+		result[expr.Cast<BoundColumnRefExpression>().binding]++;
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { CountReferences(child, result); });
+}
+
+void JoinElimination::CollectReferences() {
+	references.clear();
+	positional_references.clear();
+	for (auto &binding : plan->GetColumnBindings()) {
+		positional_references.insert(binding);
+	}
+	CollectReferences(*plan);
+}
+
+void JoinElimination::CollectReferences(LogicalOperator &op) {
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    op, [&](unique_ptr<Expression> *child) { CountReferences(**child, references); });
+	if (!ReferencesColumnsByBinding(op.type)) {
+		// e.g., a set operation: the columns of the children cannot be removed without changing the result
+		for (auto &child : op.children) {
+			for (auto &binding : child->GetColumnBindings()) {
+				positional_references.insert(binding);
+			}
+		}
+	}
+	for (auto &child : op.children) {
+		CollectReferences(*child);
+	}
+}
+
+bool JoinElimination::IsReferenced(LogicalComparisonJoin &join, const vector<ColumnBinding> &bindings) {
+	column_binding_map_t<idx_t> condition_references;
+	for (auto &cond : join.conditions) {
+		CountReferences(*cond.left, condition_references);
+		CountReferences(*cond.right, condition_references);
+	}
+	for (auto &binding : bindings) {
+		if (positional_references.find(binding) != positional_references.end()) {
+			return true;
+		}
+		auto entry = references.find(binding);
+		if (entry == references.end()) {
+			continue;
+		}
+		auto condition_entry = condition_references.find(binding);
+		auto condition_count = condition_entry == condition_references.end() ? 0 : condition_entry->second;
+		if (entry->second > condition_count) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void JoinElimination::UpdatePlan(vector<ReplacementBinding> replacement_bindings) {
+	if (!replacement_bindings.empty()) {
+		ColumnBindingReplacer replacer;
+		replacer.replacement_bindings = std::move(replacement_bindings);
+		replacer.VisitOperator(*plan);
+	}
+	CollectReferences();
+}
+
+static optional_ptr<TableCatalogEntry> GetDuckTable(LogicalGet &get) {
+	auto table = get.GetTable();
+	if (!table || !table->IsDuckTable() || !get.children.empty()) {
+		return nullptr;
+	}
+	return table;
+}
+
+bool JoinElimination::IsUnique(LogicalOperator &op, const column_binding_set_t &bindings, idx_t depth) {
+	if (depth > MAXIMUM_UNIQUE_DEPTH) {
+		return false;
+	}
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		auto table = GetDuckTable(get);
+		if (!table) {
+			return false;
+		}
+		auto &column_ids = get.GetColumnIds();
+		unordered_set<column_t> unique_columns;
+		for (auto &binding : bindings) {
+			if (binding.table_index == get.table_index && binding.column_index < column_ids.size()) {
+				unique_columns.insert(column_ids[binding.column_index]);
+			}
+		}
+		if (unique_columns.find(COLUMN_IDENTIFIER_ROW_ID) != unique_columns.end()) {
+			return true;
+		}
+		for (auto &constraint : table->GetConstraints()) {
+			if (constraint->type != ConstraintType::UNIQUE) {
+				continue;
+			}
+			auto &unique = constraint->Cast<UniqueConstraint>();
+			if (unique.HasIndex()) {
+				if (unique_columns.find(unique.GetIndex().index) != unique_columns.end()) {
+					return true;
+				}
+				continue;
+			}
+			bool covered = true;
+			for (auto &name : unique.GetColumnNames()) {
+				if (!table->ColumnExists(name) ||
+				    unique_columns.find(table->GetColumn(name).Logical().index) == unique_columns.end()) {
+					covered = false;
+					break;
+				}
+			}
+			if (covered) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+	case LogicalOperatorType::LOGICAL_ORDER_BY:
+	case LogicalOperatorType::LOGICAL_LIMIT:
+	case LogicalOperatorType::LOGICAL_TOP_N:
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+		return IsUnique(*op.children[0], bindings, depth + 1);
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		auto &proj = op.Cast<LogicalProjection>();
+		column_binding_set_t child_bindings;
+		for (auto &binding : bindings) {
+			if (binding.table_index != proj.table_index || binding.column_index >= proj.expressions.size()) {
+				continue;
+			}
+			auto &expr = *proj.expressions[binding.column_index];
+			if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+				child_bindings.insert(expr.Cast<BoundColumnRefExpression>().binding);
+			}
+		}
+		return IsUnique(*op.children[0], child_bindings, depth + 1);
+	}
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY: {
+		auto &aggr = op.Cast<LogicalAggregate>();
+		if (aggr.grouping_sets.size() > 1) {
+			return false;
+		}
+		// an aggregate produces a single row per group
+		for (idx_t group_idx = 0; group_idx < aggr.groups.size(); group_idx++) {
+			if (bindings.find(ColumnBinding(aggr.group_index, group_idx)) == bindings.end()) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case LogicalOperatorType::LOGICAL_DISTINCT: {
+		auto &distinct = op.Cast<LogicalDistinct>();
+		for (auto &target : distinct.distinct_targets) {
+			if (target->type != ExpressionType::BOUND_COLUMN_REF ||
+			    bindings.find(target->Cast<BoundColumnRefExpression>().binding) == bindings.end()) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN: {
+		auto &join = op.Cast<LogicalComparisonJoin>();
+		if (join.join_type == JoinType::SEMI || join.join_type == JoinType::ANTI) {
+			return IsUnique(*op.children[0], bindings, depth + 1);
+		}
+		if (join.join_type != JoinType::INNER && join.join_type != JoinType::LEFT) {
+			return false;
+		}
+		// a join preserves the uniqueness of one side if every row of that side matches at most one row
+		column_binding_set_t left_keys;
+		column_binding_set_t right_keys;
+		for (auto &cond : join.conditions) {
+			if (cond.comparison != ExpressionType::COMPARE_EQUAL) {
+				continue;
+			}
+			if (cond.left->type == ExpressionType::BOUND_COLUMN_REF) {
+				left_keys.insert(cond.left->Cast<BoundColumnRefExpression>().binding);
+			}
+			if (cond.right->type == ExpressionType::BOUND_COLUMN_REF) {
+				right_keys.insert(cond.right->Cast<BoundColumnRefExpression>().binding);
+			}
+		}
+		if (IsUnique(*op.children[1], right_keys, depth + 1) && IsUnique(*op.children[0], bindings, depth + 1)) {
+			return true;
+		}
+		return join.join_type == JoinType::INNER && IsUnique(*op.children[0], left_keys, depth + 1) &&
+		       IsUnique(*op.children[1], bindings, depth + 1);
+	}
+	default:
+		return false;
+	}
+}
+
+optional_ptr<LogicalGet> JoinElimination::TraceBinding(LogicalOperator &op, const ColumnBinding &binding,
+                                                       column_t &column_id) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		auto &column_ids = get.GetColumnIds();
+		if (get.table_index != binding.table_index || binding.column_index >= column_ids.size() || !GetDuckTable(get)) {
+			return nullptr;
+		}
+		column_id = column_ids[binding.column_index];
+		return &get;
+	}
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		auto &proj = op.Cast<LogicalProjection>();
+		if (proj.table_index != binding.table_index || binding.column_index >= proj.expressions.size()) {
+			return nullptr;
+		}
+		auto &expr = *proj.expressions[binding.column_index];
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			return nullptr;
+		}
+		return TraceBinding(*op.children[0], expr.Cast<BoundColumnRefExpression>().binding, column_id);
+	}
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY: {
+		auto &aggr = op.Cast<LogicalAggregate>();
+		if (aggr.group_index != binding.table_index || binding.column_index >= aggr.groups.size()) {
+			return nullptr;
+		}
+		auto &group = *aggr.groups[binding.column_index];
+		if (group.type != ExpressionType::BOUND_COLUMN_REF) {
+			return nullptr;
+		}
+		return TraceBinding(*op.children[0], group.Cast<BoundColumnRefExpression>().binding, column_id);
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+	case LogicalOperatorType::LOGICAL_ORDER_BY:
+	case LogicalOperatorType::LOGICAL_LIMIT:
+	case LogicalOperatorType::LOGICAL_TOP_N:
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+	case LogicalOperatorType::LOGICAL_ANY_JOIN:
+	case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
+	case LogicalOperatorType::LOGICAL_DELIM_JOIN:
+		for (auto &child : op.children) {
+			auto result = TraceBinding(*child, binding, column_id);
+			if (result) {
+				return result;
+			}
+		}
+		return nullptr;
+	default:
+		return nullptr;
+	}
+}
+
+//! Whether the foreign key "foreign_columns" of "foreign_table" references "primary_columns" of "primary_table"
+static bool ReferencesForeignKey(TableCatalogEntry &foreign_table, TableCatalogEntry &primary_table,
+                                 const vector<string> &foreign_columns, const vector<string> &primary_columns) {
+	if (&foreign_table.ParentCatalog() != &primary_table.ParentCatalog()) {
+		return false;
+	}
+	bool same_table = StringUtil::CIEquals(foreign_table.schema.name, primary_table.schema.name) &&
+	                  StringUtil::CIEquals(foreign_table.name, primary_table.name);
+	if (!same_table) {
+		// the referenced table registers the foreign key as well: this disambiguates a schema that was not specified
+		bool registered = false;
+		for (auto &constraint : primary_table.GetConstraints()) {
+			if (constraint->type != ConstraintType::FOREIGN_KEY) {
+				continue;
+			}
+			auto &fk = constraint->Cast<ForeignKeyConstraint>();
+			if (fk.info.type == ForeignKeyType::FK_TYPE_PRIMARY_KEY_TABLE &&
+			    StringUtil::CIEquals(fk.info.table, foreign_table.name)) {
+				registered = true;
+				break;
+			}
+		}
+		if (!registered) {
+			return false;
+		}
+	}
+	for (auto &constraint : foreign_table.GetConstraints()) {
+		if (constraint->type != ConstraintType::FOREIGN_KEY) {
+			continue;
+		}
+		auto &fk = constraint->Cast<ForeignKeyConstraint>();
+		if (fk.info.type == ForeignKeyType::FK_TYPE_SELF_REFERENCE_TABLE) {
+			if (!same_table) {
+				continue;
+			}
+		} else if (fk.info.type == ForeignKeyType::FK_TYPE_FOREIGN_KEY_TABLE) {
+			auto &schema_name = fk.info.schema.empty() ? foreign_table.schema.name : fk.info.schema;
+			if (!StringUtil::CIEquals(fk.info.table, primary_table.name) ||
+			    !StringUtil::CIEquals(schema_name, primary_table.schema.name)) {
+				continue;
+			}
+		} else {
+			continue;
+		}
+		if (fk.fk_columns.size() != foreign_columns.size() || fk.pk_columns.size() != primary_columns.size()) {
+			continue;
+		}
+		// every column of the key has to be joined with the column it references
+		vector<bool> matched(fk.fk_columns.size(), false);
+		bool matches_key = true;
+		for (idx_t col_idx = 0; col_idx < foreign_columns.size() && matches_key; col_idx++) {
+			matches_key = false;
+			for (idx_t key_idx = 0; key_idx < fk.fk_columns.size(); key_idx++) {
+				if (!matched[key_idx] && StringUtil::CIEquals(fk.fk_columns[key_idx], foreign_columns[col_idx]) &&
+				    StringUtil::CIEquals(fk.pk_columns[key_idx], primary_columns[col_idx])) {
+					matched[key_idx] = true;
+					matches_key = true;
+					break;
+				}
+			}
+		}
+		if (matches_key) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool JoinElimination::TryEliminateForeignKeyJoin(unique_ptr<LogicalOperator> &op, idx_t primary_side) {
+	auto &join = op->Cast<LogicalComparisonJoin>();
+	auto foreign_side = 1 - primary_side;
+	if (join.children[primary_side]->type != LogicalOperatorType::LOGICAL_GET) {
+		return false;
+	}
+	// the referenced table has to be scanned without filters: every foreign key then has a match
+	auto &primary_get = join.children[primary_side]->Cast<LogicalGet>();
+	auto primary_table = GetDuckTable(primary_get);
+	if (!primary_table || !primary_get.table_filters.filters.empty() || join.conditions.empty()) {
+		return false;
+	}
+	optional_ptr<LogicalGet> foreign_get;
+	vector<string> foreign_columns;
+	vector<string> primary_columns;
+	for (auto &cond : join.conditions) {
+		auto &primary_expr = primary_side == 0 ? *cond.left : *cond.right;
+		auto &foreign_expr = primary_side == 0 ? *cond.right : *cond.left;
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL || primary_expr.type != ExpressionType::BOUND_COLUMN_REF ||
+		    foreign_expr.type != ExpressionType::BOUND_COLUMN_REF ||
+		    primary_expr.return_type != foreign_expr.return_type) {
+			return false;
+		}
+		auto &primary_binding = primary_expr.Cast<BoundColumnRefExpression>().binding;
+		auto &foreign_binding = foreign_expr.Cast<BoundColumnRefExpression>().binding;
+		column_t foreign_column_id;
+		auto get = TraceBinding(*join.children[foreign_side], foreign_binding, foreign_column_id);
+		// all columns of the foreign key have to originate from the same row
+		if (!get || (foreign_get && get.get() != foreign_get.get())) {
+			return false;
+		}
+		foreign_get = get;
+		auto primary_column_id = primary_get.GetColumnIds()[primary_binding.column_index];
+		if (IsRowIdColumnId(primary_column_id) || IsRowIdColumnId(foreign_column_id)) {
+			return false;
+		}
+		auto &foreign_table = *foreign_get->GetTable();
+		foreign_columns.push_back(foreign_table.GetColumn(LogicalIndex(foreign_column_id)).Name());
+		primary_columns.push_back(primary_table->GetColumn(LogicalIndex(primary_column_id)).Name());
+	}
+	if (!ReferencesForeignKey(*foreign_get->GetTable(), *primary_table, foreign_columns, primary_columns)) {
+		return false;
+	}
+	// the only columns of the referenced table that can be used are the referenced keys
+	vector<ReplacementBinding> replacement_bindings;
+	for (auto &binding : primary_get.GetColumnBindings()) {
+		if (!IsReferenced(join, {binding})) {
+			continue;
+		}
+		if (positional_references.find(binding) != positional_references.end()) {
+			return false;
+		}
+		bool replaced = false;
+		for (auto &cond : join.conditions) {
+			auto &primary_expr = primary_side == 0 ? *cond.left : *cond.right;
+			auto &foreign_expr = primary_side == 0 ? *cond.right : *cond.left;
+			if (primary_expr.Cast<BoundColumnRefExpression>().binding == binding) {
+				replacement_bindings.emplace_back(binding, foreign_expr.Cast<BoundColumnRefExpression>().binding);
+				replaced = true;
+				break;
+			}
+		}
+		if (!replaced) {
+			return false;
+		}
+	}
+	// the join only removes the rows with a NULL foreign key
+	auto filter = make_uniq<LogicalFilter>();
+	for (auto &cond : join.conditions) {
+		auto is_not_null =
+		    make_uniq<BoundOperatorExpression>(ExpressionType::OPERATOR_IS_NOT_NULL, LogicalType::BOOLEAN);
+		is_not_null->children.push_back(std::move(primary_side == 0 ? cond.right : cond.left));
+		filter->expressions.push_back(std::move(is_not_null));
+	}
+	filter->children.push_back(std::move(join.children[foreign_side]));
+	op = std::move(filter);
+	UpdatePlan(std::move(replacement_bindings));
+	return true;
+}
+
+bool JoinElimination::TryEliminateSelfJoin(unique_ptr<LogicalOperator> &op) {
+	auto &join = op->Cast<LogicalComparisonJoin>();
+	if (join.children[0]->type != LogicalOperatorType::LOGICAL_GET ||
+	    join.children[1]->type != LogicalOperatorType::LOGICAL_GET || join.conditions.empty()) {
+		return false;
+	}
+	auto &left_get = join.children[0]->Cast<LogicalGet>();
+	auto &right_get = join.children[1]->Cast<LogicalGet>();
+	auto left_table = GetDuckTable(left_get);
+	auto right_table = GetDuckTable(right_get);
+	if (!left_table || !right_table || left_table.get() != right_table.get() || !left_get.projection_ids.empty()) {
+		return false;
+	}
+	// every condition has to compare a column with the same column of the other scan
+	auto &left_column_ids = left_get.GetColumnIds();
+	auto &right_column_ids = right_get.GetColumnIds();
+	column_binding_set_t keys;
+	set<column_t> key_columns;
+	for (auto &cond : join.conditions) {
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL || cond.left->type != ExpressionType::BOUND_COLUMN_REF ||
+		    cond.right->type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		auto &left_binding = cond.left->Cast<BoundColumnRefExpression>().binding;
+		auto &right_binding = cond.right->Cast<BoundColumnRefExpression>().binding;
+		if (left_column_ids[left_binding.column_index] != right_column_ids[right_binding.column_index]) {
+			return false;
+		}
+		keys.insert(left_binding);
+		key_columns.insert(left_column_ids[left_binding.column_index]);
+	}
+	if (!IsUnique(left_get, keys)) {
+		return false;
+	}
+	vector<ColumnBinding> referenced_bindings;
+	for (auto &binding : right_get.GetColumnBindings()) {
+		if (!IsReferenced(join, {binding})) {
+			continue;
+		}
+		if (positional_references.find(binding) != positional_references.end()) {
+			return false;
+		}
+		referenced_bindings.push_back(binding);
+	}
+	// both scans produce the same rows: the columns of the right scan are scanned by the left scan instead
+	auto get_column_index = [&](column_t column_id) {
+		for (idx_t col_idx = 0; col_idx < left_column_ids.size(); col_idx++) {
+			if (left_column_ids[col_idx] == column_id) {
+				return col_idx;
+			}
+		}
+		left_get.AddColumnId(column_id);
+		return left_column_ids.size() - 1;
+	};
+	vector<ReplacementBinding> replacement_bindings;
+	for (auto &binding : referenced_bindings) {
+		auto column_index = get_column_index(right_column_ids[binding.column_index]);
+		replacement_bindings.emplace_back(binding, ColumnBinding(left_get.table_index, column_index));
+	}
+	for (auto &entry : right_get.table_filters.filters) {
+		get_column_index(entry.first);
+		left_get.table_filters.PushFilter(entry.first, std::move(entry.second));
+	}
+	// the join removes the rows with a NULL key
+	for (auto &column_id : key_columns) {
+		if (!IsRowIdColumnId(column_id)) {
+			left_get.table_filters.PushFilter(column_id, make_uniq<IsNotNullFilter>());
+		}
+	}
+	left_get.ResolveOperatorTypes();
+	op = std::move(join.children[0]);
+	UpdatePlan(std::move(replacement_bindings));
+	return true;
+}
+
+bool JoinElimination::TryEliminateUniqueJoin(unique_ptr<LogicalOperator> &op, idx_t unique_side) {
+	auto &join = op->Cast<LogicalComparisonJoin>();
+	auto &unique_child = *join.children[unique_side];
+	if (IsReferenced(join, unique_child.GetColumnBindings())) {
+		return false;
+	}
+	// every row of the other side matches at most one row if the unique side is unique on the equality keys
+	column_binding_set_t keys;
+	for (auto &cond : join.conditions) {
+		auto &expr = unique_side == 0 ? *cond.left : *cond.right;
+		if (cond.comparison == ExpressionType::COMPARE_EQUAL && expr.type == ExpressionType::BOUND_COLUMN_REF) {
+			keys.insert(expr.Cast<BoundColumnRefExpression>().binding);
+		}
+	}
+	if (!IsUnique(unique_child, keys)) {
+		return false;
+	}
+	if (join.join_type == JoinType::LEFT) {
+		D_ASSERT(unique_side == 1);
+		op = std::move(join.children[0]);
+		UpdatePlan(vector<ReplacementBinding>());
+		return true;
+	}
+	if (unique_side == 0) {
+		std::swap(join.children[0], join.children[1]);
+		for (auto &cond : join.conditions) {
+			std::swap(cond.left, cond.right);
+			cond.comparison = FlipComparisonExpression(cond.comparison);
+		}
+	}
+	join.join_type = JoinType::SEMI;
+	return true;
+}
+
+} // namespace duckdb
@@ -15,6 +15,83 @@ namespace duckdb {
 JoinFilterPushdownOptimizer::JoinFilterPushdownOptimizer(Optimizer &optimizer) : optimizer(optimizer) {
 }
 
+ColumnBinding JoinFilterPushdownOptimizer::ProbeJoinGraph::Find(const ColumnBinding &binding) {
+	auto entry = parents.find(binding);
+	if (entry == parents.end()) {
+		return binding;
+	}
+	auto root = Find(entry->second);
+	entry->second = root;
+	return root;
+}
+
+void JoinFilterPushdownOptimizer::ProbeJoinGraph::Union(const ColumnBinding &left, const ColumnBinding &right) {
+	auto left_root = Find(left);
+	auto right_root = Find(right);
+	if (left_root != right_root) {
+		parents[left_root] = right_root;
+	}
+}
+
+void JoinFilterPushdownOptimizer::CollectProbeScans(LogicalOperator &op, bool in_build_side, ProbeJoinGraph &graph,
+                                                    vector<ProbeScan> &scans) {
+	// we can only push filters through operators that only remove rows that do not reach the join anyway
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		if (get.function.filter_pushdown && !get.GetColumnIds().empty()) {
+			scans.push_back(ProbeScan {get, in_build_side});
+		}
+		return;
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+	case LogicalOperatorType::LOGICAL_ORDER_BY:
+	case LogicalOperatorType::LOGICAL_DISTINCT:
+		CollectProbeScans(*op.children[0], in_build_side, graph, scans);
+		return;
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		// column references pass through the value of their child column
+		auto &proj = op.Cast<LogicalProjection>();
+		for (idx_t expr_idx = 0; expr_idx < proj.expressions.size(); expr_idx++) {
+			auto &expr = *proj.expressions[expr_idx];
+			if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+				graph.Union(ColumnBinding(proj.table_index, expr_idx), expr.Cast<BoundColumnRefExpression>().binding);
+			}
+		}
+		CollectProbeScans(*op.children[0], in_build_side, graph, scans);
+		return;
+	}
+	case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
+		CollectProbeScans(*op.children[0], in_build_side, graph, scans);
+		CollectProbeScans(*op.children[1], true, graph, scans);
+		return;
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN: {
+		auto &comparison_join = op.Cast<LogicalComparisonJoin>();
+		if (comparison_join.join_type != JoinType::INNER && comparison_join.join_type != JoinType::SEMI) {
+			// rows of the preserved side can only be removed based on the columns of the preserved side
+			CollectProbeScans(*op.children[0], in_build_side, graph, scans);
+			return;
+		}
+		// every row of an inner or semi join satisfies the equality conditions: this is an edge of the join graph
+		for (auto &cond : comparison_join.conditions) {
+			if (cond.comparison != ExpressionType::COMPARE_EQUAL ||
+			    cond.left->type != ExpressionType::BOUND_COLUMN_REF ||
+			    cond.right->type != ExpressionType::BOUND_COLUMN_REF) {
+				continue;
+			}
+			graph.Union(cond.left->Cast<BoundColumnRefExpression>().binding,
+			            cond.right->Cast<BoundColumnRefExpression>().binding);
+		}
+		CollectProbeScans(*op.children[0], in_build_side, graph, scans);
+		CollectProbeScans(*op.children[1], true, graph, scans);
+		return;
+	}
+	default:
+		// unsupported operator (e.g. LIMIT/TOP_N: removing rows below it changes which rows are returned)
+		return;
+	}
+}
+
 void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &join) {
 	switch (join.join_type) {
 	case JoinType::MARK:
@@ -64,65 +141,57 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 		// could not generate any filters - bail-out
 		return;
 	}
-	// find the child LogicalGet (if possible)
-	reference<LogicalOperator> probe_source(*join.children[0]);
-	while (probe_source.get().type != LogicalOperatorType::LOGICAL_GET) {
-		auto &probe_child = probe_source.get();
-		switch (probe_child.type) {
-		case LogicalOperatorType::LOGICAL_LIMIT:
-		case LogicalOperatorType::LOGICAL_FILTER:
-		case LogicalOperatorType::LOGICAL_ORDER_BY:
-		case LogicalOperatorType::LOGICAL_TOP_N:
-		case LogicalOperatorType::LOGICAL_DISTINCT:
-		case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
-		case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
-			// does not affect probe side - continue into left child
-			// FIXME: we can probably recurse into more operators here (e.g. window, set operation, unnest)
-			probe_source = *probe_child.children[0];
-			break;
-		case LogicalOperatorType::LOGICAL_PROJECTION: {
-			// projection - check if we all of the expressions are only column references
-			auto &proj = probe_source.get().Cast<LogicalProjection>();
-			for (auto &filter : pushdown_info->filters) {
-				if (filter.probe_column_index.table_index != proj.table_index) {
-					// index does not belong to this projection - bail-out
-					return;
-				}
-				auto &expr = *proj.expressions[filter.probe_column_index.column_index];
-				if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
-					// not a simple column ref - bail-out
-					return;
+	// find the scans on the probe side that the filters can be pushed into
+	// filters are transferred through the join graph of the probe side: a filter on the probe column also applies to
+	// every column that is joined on it, in all tables that are (transitively) inner-joined with each other
+	ProbeJoinGraph graph;
+	vector<ProbeScan> scans;
+	CollectProbeScans(*join.children[0], false, graph, scans);
+
+	vector<JoinFilterPushdownColumn> filters;
+	vector<JoinFilterPushdownTarget> targets(scans.size());
+	for (auto &filter : pushdown_info->filters) {
+		auto probe_root = graph.Find(filter.probe_column_index);
+		bool has_target = false;
+		for (idx_t scan_idx = 0; scan_idx < scans.size(); scan_idx++) {
+			auto &get = scans[scan_idx].get.get();
+			for (auto &binding : get.GetColumnBindings()) {
+				if (binding.table_index != get.table_index || graph.Find(binding) != probe_root) {
+					// not a column of the scan itself (e.g. the projected input of a table in-out function)
+					// or not joined on the probe column
+					continue;
 				}
-				// column-ref - pass through the new column binding
-				auto &colref = expr.Cast<BoundColumnRefExpression>();
-				filter.probe_column_index = colref.binding;
+				targets[scan_idx].columns.emplace_back(filters.size(), binding.column_index);
+				has_target = true;
 			}
-			probe_source = *probe_child.children[0];
-			break;
 		}
-		default:
-			// unsupported child type
-			return;
+		if (has_target) {
+			filters.push_back(filter);
 		}
 	}
-	// found the LogicalGet
-	auto &get = probe_source.get().Cast<LogicalGet>();
-	if (!get.function.filter_pushdown) {
-		// filter pushdown is not supported - bail-out
+	if (filters.empty()) {
+		// none of the filters can be pushed into a scan - bail-out
 		return;
 	}
-	for (auto &filter : pushdown_info->filters) {
-		if (filter.probe_column_index.table_index != get.table_index) {
-			// the filter does not apply to the probe side here - bail-out
-			return;
-		}
-	}
+	pushdown_info->filters = std::move(filters);
+
 	// pushdown can be performed
-	// set up the dynamic filters (if we don't have any yet)
-	if (!get.dynamic_filters) {
-		get.dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
+	// set up the dynamic filters of the scans (if they don't have any yet)
+	for (idx_t scan_idx = 0; scan_idx < scans.size(); scan_idx++) {
+		auto &target = targets[scan_idx];
+		if (target.columns.empty()) {
+			continue;
+		}
+		auto &get = scans[scan_idx].get.get();
+		if (!get.dynamic_filters) {
+			get.dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
+		}
+		target.dynamic_filters = get.dynamic_filters;
+		if (scans[scan_idx].in_build_side) {
+			pushdown_info->transfers_into_build_sides = true;
+		}
+		pushdown_info->targets.push_back(std::move(target));
 	}
-	pushdown_info->dynamic_filters = get.dynamic_filters;
 
 	// set up the min/max aggregates for each of the filters
 	vector<AggregateFunction> aggr_functions;
@@ -372,9 +372,17 @@ DenomInfo CardinalityEstimator::GetDenominator(JoinRelationSet &set) {
 
 template <>
 double CardinalityEstimator::EstimateCardinalityWithSet(JoinRelationSet &new_set) {
+	auto estimate = estimated_cardinalities.find(new_set);
+	if (estimate != estimated_cardinalities.end()) {
+		return estimate->second;
+	}
 
-	if (relation_set_2_cardinality.find(new_set.ToString()) != relation_set_2_cardinality.end()) {
-		return relation_set_2_cardinality[new_set.ToString()].cardinality_before_filters;
+	auto set_string = new_set.ToString();
+	auto entry = relation_set_2_cardinality.find(set_string);
+	if (entry != relation_set_2_cardinality.end()) {
+		auto result = entry->second.cardinality_before_filters;
+		estimated_cardinalities[new_set] = result;
+		return result;
 	}
 
 	// can happen if a table has cardinality 0, or a tdom is set to 0
@@ -383,7 +391,8 @@ double CardinalityEstimator::EstimateCardinalityWithSet(JoinRelationSet &new_set
 
 	double result = numerator / denom.denominator;
 	auto new_entry = CardinalityHelper(result);
-	relation_set_2_cardinality[new_set.ToString()] = new_entry;
+	relation_set_2_cardinality[set_string] = new_entry;
+	estimated_cardinalities[new_set] = result;
 	return result;
 }
 
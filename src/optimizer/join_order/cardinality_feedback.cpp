@@ -0,0 +1,282 @@
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/query_profiler.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/struct_filter.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/data_table.hpp"
+
+namespace duckdb {
+
+CardinalityFeedback &CardinalityFeedback::Get(ClientContext &context) {
+	auto &db = DatabaseInstance::GetDatabase(context);
+	return *db.GetObjectCache().GetOrCreate<CardinalityFeedback>(CardinalityFeedback::ObjectType());
+}
+
+bool CardinalityFeedback::GetConjunctionShape(const ConjunctionFilter &filter, const string &separator,
+                                              string &result) {
+	result += "(";
+	for (idx_t i = 0; i < filter.child_filters.size(); i++) {
+		if (i > 0) {
+			result += separator;
+		}
+		if (!GetFilterShape(*filter.child_filters[i], result)) {
+			return false;
+		}
+	}
+	result += ")";
+	return true;
+}
+
+bool CardinalityFeedback::GetFilterShape(const TableFilter &filter, string &result) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		result += ExpressionTypeToOperator(constant_filter.comparison_type) + "?";
+		return true;
+	}
+	case TableFilterType::IS_NULL:
+		result += "IS NULL";
+		return true;
+	case TableFilterType::IS_NOT_NULL:
+		result += "IS NOT NULL";
+		return true;
+	case TableFilterType::IN_FILTER:
+		result += "IN (?)";
+		return true;
+	case TableFilterType::CONJUNCTION_AND:
+		return GetConjunctionShape(filter.Cast<ConjunctionAndFilter>(), " AND ", result);
+	case TableFilterType::CONJUNCTION_OR:
+		return GetConjunctionShape(filter.Cast<ConjunctionOrFilter>(), " OR ", result);
+	case TableFilterType::STRUCT_EXTRACT: {
+		auto &struct_filter = filter.Cast<StructFilter>();
+		result += "." + struct_filter.child_name + " ";
+		return GetFilterShape(*struct_filter.child_filter, result);
+	}
+	default:
+		// bloom filters and dynamic filters are only known during execution
+		return false;
+	}
+}
+
+string CardinalityFeedback::GetKey(TableCatalogEntry &table, const TableFilterSet &filters) {
+	string result = table.ParentCatalog().GetName() + "." + table.schema.name + "." + table.name;
+	// the filters are ordered by column index
+	for (auto &entry : filters.filters) {
+		result += " #" + to_string(entry.first) + " ";
+		if (!GetFilterShape(*entry.second, result)) {
+			return string();
+		}
+	}
+	return result;
+}
+
+static string GetExpressionsShape(const vector<unique_ptr<Expression>> &expressions) {
+	vector<string> result;
+	for (auto &expr : expressions) {
+		result.push_back(expr->ToString());
+	}
+	return StringUtil::Join(result, ", ");
+}
+
+bool CardinalityFeedback::GetJoinShape(LogicalComparisonJoin &join, string &result) {
+	string left;
+	string right;
+	if (!GetPlanShape(*join.children[0], left) || !GetPlanShape(*join.children[1], right)) {
+		return false;
+	}
+	// flipping the children of a join inverts its type and its conditions: write every join in one orientation
+	bool symmetric = false;
+	bool flip = false;
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::OUTER:
+		symmetric = left == right;
+		flip = right < left;
+		break;
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+	case JoinType::RIGHT_ANTI:
+		flip = true;
+		break;
+	default:
+		break;
+	}
+	vector<string> conditions;
+	for (auto &cond : join.conditions) {
+		auto condition = cond.left->ToString() + " " + ExpressionTypeToOperator(cond.comparison) + " " +
+		                 cond.right->ToString();
+		auto flipped_condition = cond.right->ToString() + " " +
+		                         ExpressionTypeToOperator(FlipComparisonExpression(cond.comparison)) + " " +
+		                         cond.left->ToString();
+		if (symmetric) {
+			// both children have the same key, so either orientation of the condition can occur
+			conditions.push_back(MinValue(condition, flipped_condition));
+		} else {
+			conditions.push_back(flip ? flipped_condition : condition);
+		}
+	}
+	std::sort(conditions.begin(), conditions.end());
+	auto join_type = flip ? InverseJoinType(join.join_type) : join.join_type;
+	result += "JOIN " + EnumUtil::ToString(join_type) + " (" + StringUtil::Join(conditions, " AND ") + ")";
+	result += flip ? "[" + right + "][" + left + "]" : "[" + left + "][" + right + "]";
+	return true;
+}
+
+bool CardinalityFeedback::GetPlanShape(LogicalOperator &op, string &result) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		auto table = get.GetTable();
+		if (!table || !table->IsDuckTable()) {
+			return false;
+		}
+		result += "SCAN " + table->ParentCatalog().GetName() + "." + table->schema.name + "." + table->name;
+		for (auto &entry : get.table_filters.filters) {
+			result += " " + entry.second->ToString("#" + to_string(entry.first));
+		}
+		return true;
+	}
+	case LogicalOperatorType::LOGICAL_PROJECTION:
+		// projections do not change the cardinality
+		return GetPlanShape(*op.children[0], result);
+	case LogicalOperatorType::LOGICAL_FILTER:
+		result += "FILTER (" + GetExpressionsShape(op.expressions) + ") ";
+		return GetPlanShape(*op.children[0], result);
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY: {
+		auto &aggregate = op.Cast<LogicalAggregate>();
+		if (aggregate.grouping_sets.size() > 1) {
+			return false;
+		}
+		result += "AGGREGATE (" + GetExpressionsShape(aggregate.groups) + ") ";
+		return GetPlanShape(*op.children[0], result);
+	}
+	case LogicalOperatorType::LOGICAL_CROSS_PRODUCT: {
+		string left;
+		string right;
+		if (!GetPlanShape(*op.children[0], left) || !GetPlanShape(*op.children[1], right)) {
+			return false;
+		}
+		if (right < left) {
+			std::swap(left, right);
+		}
+		result += "CROSS_PRODUCT [" + left + "][" + right + "]";
+		return true;
+	}
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+		return GetJoinShape(op.Cast<LogicalComparisonJoin>(), result);
+	default:
+		return false;
+	}
+}
+
+string CardinalityFeedback::GetPlanKey(LogicalOperator &op) {
+	string result;
+	if (!GetPlanShape(op, result)) {
+		return string();
+	}
+	return result;
+}
+
+void CardinalityFeedback::RecordQuery(ClientContext &context, QueryProfiler &profiler) {
+	if (!DBConfig::GetConfig(context).options.enable_cardinality_feedback || !profiler.IsEnabled()) {
+		return;
+	}
+	vector<pair<string, CardinalityFeedbackEntry>> observed;
+	for (auto &entry : profiler.GetTreeMap()) {
+		auto &op = entry.first.get();
+		auto &info = entry.second.get().GetProfilingInfo();
+		switch (op.type) {
+		case PhysicalOperatorType::LIMIT:
+		case PhysicalOperatorType::STREAMING_LIMIT:
+		case PhysicalOperatorType::LIMIT_PERCENT:
+			// scans can be stopped before they are finished
+			return;
+		default:
+			break;
+		}
+		if (op.type != PhysicalOperatorType::TABLE_SCAN || !info.Enabled(MetricsType::OPERATOR_CARDINALITY)) {
+			continue;
+		}
+		auto &scan = op.Cast<PhysicalTableScan>();
+		if (!scan.table_filters || scan.table_filters->filters.empty() || !scan.function.get_bind_info) {
+			continue;
+		}
+		if (scan.dynamic_filters && scan.dynamic_filters->HasFilters()) {
+			// filters pushed by a join reduce the cardinality as well
+			continue;
+		}
+		auto bind_info = scan.function.get_bind_info(scan.bind_data.get());
+		if (!bind_info.table || !bind_info.table->IsDuckTable()) {
+			continue;
+		}
+		auto key = GetKey(*bind_info.table, *scan.table_filters);
+		if (key.empty()) {
+			continue;
+		}
+		CardinalityFeedbackEntry feedback;
+		feedback.estimated_cardinality = scan.estimated_cardinality;
+		feedback.actual_cardinality = info.GetMetricValue<idx_t>(MetricsType::OPERATOR_CARDINALITY);
+		feedback.table_cardinality = bind_info.table->GetStorage().GetTotalRows();
+		observed.emplace_back(std::move(key), feedback);
+	}
+	if (observed.empty()) {
+		return;
+	}
+	auto &cardinality_feedback = CardinalityFeedback::Get(context);
+	for (auto &entry : observed) {
+		cardinality_feedback.Record(entry.first, entry.second);
+	}
+}
+
+void CardinalityFeedback::Record(const string &key, const CardinalityFeedbackEntry &entry) {
+	if (entry.table_cardinality == 0) {
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	entries[key] = entry;
+}
+
+bool CardinalityFeedback::TryGetSelectivity(const string &key, double &selectivity) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(key);
+	if (entry == entries.end()) {
+		return false;
+	}
+	auto &feedback = entry->second;
+	selectivity = static_cast<double>(feedback.actual_cardinality) / static_cast<double>(feedback.table_cardinality);
+	selectivity = MinValue<double>(selectivity, 1);
+	return true;
+}
+
+idx_t CardinalityFeedback::Count() {
+	lock_guard<mutex> guard(lock);
+	return entries.size();
+}
+
+void CardinalityFeedback::RecordBuild(const string &key, idx_t cardinality) {
+	lock_guard<mutex> guard(lock);
+	build_cardinalities[key] = cardinality;
+}
+
+bool CardinalityFeedback::TryGetBuildCardinality(const string &key, idx_t &cardinality) {
+	lock_guard<mutex> guard(lock);
+	auto entry = build_cardinalities.find(key);
+	if (entry == build_cardinalities.end()) {
+		return false;
+	}
+	cardinality = entry->second;
+	return true;
+}
+
+} // namespace duckdb
@@ -10,9 +10,14 @@ CostModel::CostModel(QueryGraphManager &query_graph_manager)
 
 double CostModel::ComputeCost(DPJoinNode &left, DPJoinNode &right) {
 	auto &combination = query_graph_manager.set_manager.Union(left.set, right.set);
+	return ComputeCost(combination, left.cost, right.cost);
+}
+
+double CostModel::ComputeCost(JoinRelationSet &combination, double left_cost, double right_cost) {
 	auto join_card = cardinality_estimator.EstimateCardinalityWithSet<double>(combination);
 	auto join_cost = join_card;
-	return join_cost + left.cost + right.cost;
+	// the costs of the children are added first so that the cost does not depend on which side is the left side
+	return join_cost + (left_cost + right_cost);
 }
 
 } // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/optimizer/join_order/plan_enumerator.hpp"
 
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/query_profiler.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/optimizer/join_order/query_graph_manager.hpp"
 
@@ -8,6 +9,12 @@
 
 namespace duckdb {
 
+//! The greedy cost bound is computed up to this amount of relations: it is cubic in the amount of relations, and larger
+//! join graphs are too large to be solved exactly anyway
+static constexpr idx_t COST_BOUND_MAX_RELATIONS = 64;
+//! The greedy plan is refined with dynamic programming over its join order up to this amount of relations
+static constexpr idx_t LINEARIZED_DP_MAX_RELATIONS = 128;
+
 static vector<unordered_set<idx_t>> AddSuperSets(const vector<unordered_set<idx_t>> &current,
                                                  const vector<idx_t> &all_neighbors) {
 	vector<unordered_set<idx_t>> ret;
@@ -100,7 +107,7 @@ const reference_map_t<JoinRelationSet, unique_ptr<DPJoinNode>> &PlanEnumerator::
 //! Create a new JoinTree node by joining together two previous JoinTree nodes
 unique_ptr<DPJoinNode> PlanEnumerator::CreateJoinTree(JoinRelationSet &set,
                                                       const vector<reference<NeighborInfo>> &possible_connections,
-                                                      DPJoinNode &left, DPJoinNode &right) {
+                                                      DPJoinNode &left, DPJoinNode &right, double cost) {
 
 	// FIXME: should consider different join algorithms, should we pick a join algorithm here as well? (probably)
 	optional_ptr<NeighborInfo> best_connection = possible_connections.back().get();
@@ -131,15 +138,13 @@ unique_ptr<DPJoinNode> PlanEnumerator::CreateJoinTree(JoinRelationSet &set,
 			break;
 		}
 	}
-	// need the filter info from the Neighborhood info.
-	auto cost = cost_model.ComputeCost(left, right);
 	auto result = make_uniq<DPJoinNode>(set, best_connection, left.set, right.set, cost);
 	result->cardinality = cost_model.cardinality_estimator.EstimateCardinalityWithSet<idx_t>(set);
 	return result;
 }
 
-DPJoinNode &PlanEnumerator::EmitPair(JoinRelationSet &left, JoinRelationSet &right,
-                                     const vector<reference<NeighborInfo>> &info) {
+optional_ptr<DPJoinNode> PlanEnumerator::EmitPair(JoinRelationSet &left, JoinRelationSet &right,
+                                                   const vector<reference<NeighborInfo>> &info) {
 	// get the left and right join plans
 	auto left_plan = plans.find(left);
 	auto right_plan = plans.find(right);
@@ -147,22 +152,22 @@ DPJoinNode &PlanEnumerator::EmitPair(JoinRelationSet &left, JoinRelationSet &rig
 		throw InternalException("No left or right plan: internal error in join order optimizer");
 	}
 	auto &new_set = query_graph_manager.set_manager.Union(left, right);
-	// create the join tree based on combining the two plans
-	auto new_plan = CreateJoinTree(new_set, info, *left_plan->second, *right_plan->second);
-	// check if this plan is the optimal plan we found for this set of relations
+	// check if this plan is the optimal plan we found for this set of relations before creating the join tree
+	auto new_cost = cost_model.ComputeCost(new_set, left_plan->second->cost, right_plan->second->cost);
 	auto entry = plans.find(new_set);
-	auto new_cost = new_plan->cost;
-	double old_cost = NumericLimits<double>::Maximum();
-	if (entry != plans.end()) {
-		old_cost = entry->second->cost;
-	}
-	if (entry == plans.end() || new_cost < old_cost) {
-		// the new plan costs less than the old plan. Update our DP table.
-		plans[new_set] = std::move(new_plan);
-		return *plans[new_set];
-	}
-	// Create join node from the plan currently in the DP table.
-	return *entry->second;
+	if (entry != plans.end() && entry->second->cost <= new_cost) {
+		// the plan currently in the DP table is at least as cheap
+		return entry->second.get();
+	}
+	if (new_cost > cost_bound) {
+		// the plan is more expensive than the bound on the cost of the optimal plan: it cannot be part of it
+		return nullptr;
+	}
+	// the new plan costs less than the old plan. Update our DP table.
+	auto new_plan = CreateJoinTree(new_set, info, *left_plan->second, *right_plan->second, new_cost);
+	auto &result = *new_plan;
+	plans[new_set] = std::move(new_plan);
+	return result;
 }
 
 bool PlanEnumerator::TryEmitPair(JoinRelationSet &left, JoinRelationSet &right,
@@ -362,16 +367,11 @@ void PlanEnumerator::SolveJoinOrderApproximately() {
 				auto connection = query_graph.GetConnections(left, right);
 				if (!connection.empty()) {
 					// we can check the cost of this connection
-					auto node = EmitPair(left, right, connection);
-
-					// update the DP tree in case a plan created by the DP algorithm uses the node
-					// that was potentially just updated by EmitPair. You will get a use-after-free
-					// error if future plans rely on the old node that was just replaced.
-					// if node in FullPath, then updateDP tree.
-
+					// the join relations are disjoint, so the plan cannot be replaced by another pair in this step
+					auto &node = *EmitPair(left, right, connection);
 					if (!best_connection || node.cost < best_connection->cost) {
 						// best pair found so far
-						best_connection = &EmitPair(left, right, connection);
+						best_connection = node;
 						best_left = i;
 						best_right = j;
 					}
@@ -420,7 +420,7 @@ void PlanEnumerator::SolveJoinOrderApproximately() {
 			auto connections = query_graph.GetConnections(left, right);
 			D_ASSERT(!connections.empty());
 
-			best_connection = &EmitPair(left, right, connections);
+			best_connection = EmitPair(left, right, connections);
 			best_left = smallest_index[0];
 			best_right = smallest_index[1];
 
@@ -441,6 +441,94 @@ void PlanEnumerator::SolveJoinOrderApproximately() {
 		join_relations.erase(join_relations.begin() + (int64_t)best_left);
 		join_relations.push_back(new_set);
 	}
+	// the greedy algorithm does not reconsider earlier decisions - refine its plan using dynamic programming
+	if (join_relations.size() == 1 && join_relations[0].get().count <= LINEARIZED_DP_MAX_RELATIONS) {
+		SolveJoinOrderLinearized(join_relations[0]);
+	}
+}
+
+void PlanEnumerator::CollectLeafOrder(JoinRelationSet &set, vector<idx_t> &order) {
+	auto &plan = *plans[set];
+	if (plan.is_leaf) {
+		D_ASSERT(set.count == 1);
+		order.push_back(set.relations[0]);
+		return;
+	}
+	CollectLeafOrder(plan.left_set, order);
+	CollectLeafOrder(plan.right_set, order);
+}
+
+void PlanEnumerator::SolveJoinOrderLinearized(JoinRelationSet &set) {
+	// every subtree of a join tree joins a consecutive range of the leaves of the tree. Dynamic programming over all
+	// consecutive ranges of the leaves of the current plan considers all plans with the same order of the leaves - so
+	// the resulting plan is at least as cheap. This is cubic in the amount of relations (see "Adaptive Optimization of
+	// Very Large Join Queries" by Thomas Neumann and Bernhard Radke)
+	vector<idx_t> order;
+	CollectLeafOrder(set, order);
+	auto &set_manager = query_graph_manager.set_manager;
+	// ranges[start][length - 1] is the set of the relations order[start] ... order[start + length - 1]
+	vector<vector<reference<JoinRelationSet>>> ranges(order.size());
+	for (idx_t start = 0; start < order.size(); start++) {
+		ranges[start].push_back(set_manager.GetJoinRelation(order[start]));
+	}
+	for (idx_t length = 2; length <= order.size(); length++) {
+		for (idx_t start = 0; start + length <= order.size(); start++) {
+			auto &last = set_manager.GetJoinRelation(order[start + length - 1]);
+			ranges[start].push_back(set_manager.Union(ranges[start][length - 2], last));
+			for (idx_t split = 1; split < length; split++) {
+				auto &left = ranges[start][split - 1].get();
+				auto &right = ranges[start + split][length - split - 1].get();
+				if (plans.find(left) == plans.end() || plans.find(right) == plans.end()) {
+					// no plan without cross products exists for one of the sides
+					continue;
+				}
+				auto connections = query_graph.GetConnections(left, right);
+				if (!connections.empty()) {
+					EmitPair(left, right, connections);
+				}
+			}
+		}
+	}
+}
+
+double PlanEnumerator::ComputeGreedyCostBound() {
+	// this follows the greedy algorithm in SolveJoinOrderApproximately, but only tracks the cost of the plan
+	auto &set_manager = query_graph_manager.set_manager;
+	vector<pair<reference<JoinRelationSet>, double>> join_relations;
+	for (idx_t i = 0; i < query_graph_manager.relation_manager.NumRelations(); i++) {
+		join_relations.emplace_back(set_manager.GetJoinRelation(i), 0.0);
+	}
+	while (join_relations.size() > 1) {
+		idx_t best_left = 0, best_right = 0;
+		double best_cost = NumericLimits<double>::Maximum();
+		bool found_connection = false;
+		for (idx_t i = 0; i < join_relations.size(); i++) {
+			auto &left = join_relations[i];
+			for (idx_t j = i + 1; j < join_relations.size(); j++) {
+				auto &right = join_relations[j];
+				if (query_graph.GetConnections(left.first, right.first).empty()) {
+					continue;
+				}
+				auto &combination = set_manager.Union(left.first, right.first);
+				auto cost = cost_model.ComputeCost(combination, left.second, right.second);
+				if (!found_connection || cost < best_cost) {
+					found_connection = true;
+					best_cost = cost;
+					best_left = i;
+					best_right = j;
+				}
+			}
+		}
+		if (!found_connection) {
+			// the exact enumeration does not consider cross products either: there is no bound
+			return NumericLimits<double>::Maximum();
+		}
+		auto &new_set = set_manager.Union(join_relations[best_left].first, join_relations[best_right].first);
+		join_relations.erase(join_relations.begin() + NumericCast<int64_t>(best_right));
+		join_relations.erase(join_relations.begin() + NumericCast<int64_t>(best_left));
+		join_relations.emplace_back(new_set, best_cost);
+	}
+	return join_relations[0].second;
 }
 
 void PlanEnumerator::InitLeafPlans() {
@@ -471,10 +559,21 @@ void PlanEnumerator::InitLeafPlans() {
 // https://db.in.tum.de/teaching/ws1415/queryopt/chapter3.pdf?lang=de
 void PlanEnumerator::SolveJoinOrder() {
 	bool force_no_cross_product = query_graph_manager.context.config.force_no_cross_product;
+	auto &profiler = QueryProfiler::Get(query_graph_manager.context);
 	// first try to solve the join order exactly
-	if (!SolveJoinOrderExactly()) {
+	profiler.StartPhase(MetricsType::JOIN_ORDER_EXACT_ENUMERATION);
+	if (query_graph_manager.relation_manager.NumRelations() <= COST_BOUND_MAX_RELATIONS) {
+		// the cost of the greedy plan bounds the cost of the optimal plan, this prunes the search space
+		cost_bound = ComputeGreedyCostBound();
+	}
+	auto solved_exactly = SolveJoinOrderExactly();
+	cost_bound = NumericLimits<double>::Maximum();
+	profiler.EndPhase();
+	if (!solved_exactly) {
 		// otherwise, if that times out we resort to a greedy algorithm
+		profiler.StartPhase(MetricsType::JOIN_ORDER_APPROXIMATE_ENUMERATION);
 		SolveJoinOrderApproximately();
+		profiler.EndPhase();
 	}
 
 	// now the optimal join path should have been found
@@ -5,9 +5,12 @@
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/storage/statistics/histogram_statistics.hpp"
 
 namespace duckdb {
 
@@ -106,11 +109,29 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 
 	if (!get.table_filters.filters.empty()) {
 		column_statistics = nullptr;
+		// the combined selectivity of the filters that could be estimated from a histogram
+		double histogram_selectivity = 1;
+		bool has_histogram_estimate = false;
 		for (auto &it : get.table_filters.filters) {
 			if (get.bind_data && get.function.statistics) {
 				column_statistics = get.function.statistics(context, get.bind_data.get(), it.first);
 			}
 
+			if (catalog_table && catalog_table->IsDuckTable() && it.first != COLUMN_IDENTIFIER_ROW_ID &&
+			    !catalog_table->GetColumn(LogicalIndex(it.first)).Generated()) {
+				// columns that were analyzed have a histogram: use it to estimate the filter selectivity
+				auto &column = catalog_table->GetColumn(LogicalIndex(it.first));
+				auto histogram = catalog_table->GetStorage().GetHistogram(column.StorageOid());
+				double selectivity;
+				auto distinct_count = column_statistics ? column_statistics->GetDistinctCount() : 0;
+				if (histogram && InspectHistogram(*it.second, *histogram, distinct_count, selectivity)) {
+					// assume the filters on different columns are independent
+					histogram_selectivity *= selectivity;
+					has_histogram_estimate = true;
+					continue;
+				}
+			}
+
 			if (column_statistics && it.second->filter_type == TableFilterType::CONJUNCTION_AND) {
 				auto &filter = it.second->Cast<ConjunctionAndFilter>();
 				idx_t cardinality_with_and_filter = RelationStatisticsHelper::InspectConjunctionAND(
@@ -121,7 +142,11 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 		// if the above code didn't find an equality filter (i.e country_code = "[us]")
 		// and there are other table filters (i.e cost > 50), use default selectivity.
 		bool has_equality_filter = (cardinality_after_filters != base_table_cardinality);
-		if (!has_equality_filter && !get.table_filters.filters.empty()) {
+		if (has_histogram_estimate) {
+			auto histogram_cardinality =
+			    MaxValue<idx_t>(LossyNumericCast<idx_t>(double(base_table_cardinality) * histogram_selectivity), 1U);
+			cardinality_after_filters = MinValue(cardinality_after_filters, histogram_cardinality);
+		} else if (!has_equality_filter && !get.table_filters.filters.empty()) {
 			cardinality_after_filters = MaxValue<idx_t>(
 			    LossyNumericCast<idx_t>(double(base_table_cardinality) * RelationStatisticsHelper::DEFAULT_SELECTIVITY),
 			    1U);
@@ -129,6 +154,17 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 		if (base_table_cardinality == 0) {
 			cardinality_after_filters = 0;
 		}
+		if (catalog_table && catalog_table->IsDuckTable() &&
+		    DBConfig::GetConfig(context).options.enable_cardinality_feedback) {
+			// the table was scanned with filters of the same shape before: use their actual selectivity
+			auto key = CardinalityFeedback::GetKey(*catalog_table, get.table_filters);
+			double selectivity;
+			if (!key.empty() && CardinalityFeedback::Get(context).TryGetSelectivity(key, selectivity)) {
+				auto feedback_cardinality =
+				    MaxValue<idx_t>(LossyNumericCast<idx_t>(double(base_table_cardinality) * selectivity), 1U);
+				cardinality_after_filters = MinValue(feedback_cardinality, base_table_cardinality);
+			}
+		}
 	}
 	return_stats.cardinality = cardinality_after_filters;
 	// update the estimated cardinality of the get as well.
@@ -393,6 +429,111 @@ idx_t RelationStatisticsHelper::InspectConjunctionAND(idx_t cardinality, idx_t c
 	return cardinality_after_filters;
 }
 
+bool RelationStatisticsHelper::InspectHistogram(TableFilter &filter, const HistogramStatistics &histogram,
+                                                idx_t distinct_count, double &selectivity) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &comparison_filter = filter.Cast<ConstantFilter>();
+		auto &constant = comparison_filter.constant;
+		if (constant.IsNull() || constant.type() != histogram.type) {
+			return false;
+		}
+		Value unbounded(histogram.type);
+		switch (comparison_filter.comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+			selectivity = histogram.EstimateEquality(constant, distinct_count);
+			return true;
+		case ExpressionType::COMPARE_NOTEQUAL:
+			selectivity =
+			    MaxValue<double>(1 - histogram.null_fraction - histogram.EstimateEquality(constant, distinct_count), 0);
+			return true;
+		case ExpressionType::COMPARE_GREATERTHAN:
+			selectivity = histogram.EstimateRange(constant, false, unbounded, false);
+			return true;
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			selectivity = histogram.EstimateRange(constant, true, unbounded, false);
+			return true;
+		case ExpressionType::COMPARE_LESSTHAN:
+			selectivity = histogram.EstimateRange(unbounded, false, constant, false);
+			return true;
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			selectivity = histogram.EstimateRange(unbounded, false, constant, true);
+			return true;
+		default:
+			return false;
+		}
+	}
+	case TableFilterType::IS_NULL:
+		selectivity = histogram.null_fraction;
+		return true;
+	case TableFilterType::IS_NOT_NULL:
+		selectivity = 1 - histogram.null_fraction;
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		// combine the comparisons into a single range, so that e.g. "x > 10 AND x < 20" is estimated together
+		Value lower(histogram.type);
+		Value upper(histogram.type);
+		bool lower_inclusive = false;
+		bool upper_inclusive = false;
+		bool has_range = false;
+		bool found_estimate = false;
+		double result = 1;
+		for (auto &child_filter : and_filter.child_filters) {
+			if (child_filter->filter_type == TableFilterType::IS_NOT_NULL) {
+				// comparisons already exclude NULL values
+				continue;
+			}
+			if (child_filter->filter_type == TableFilterType::CONSTANT_COMPARISON) {
+				auto &comparison_filter = child_filter->Cast<ConstantFilter>();
+				auto &constant = comparison_filter.constant;
+				if (!constant.IsNull() && constant.type() == histogram.type) {
+					auto comparison_type = comparison_filter.comparison_type;
+					bool is_lower = comparison_type == ExpressionType::COMPARE_GREATERTHAN ||
+					                comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+					bool is_upper = comparison_type == ExpressionType::COMPARE_LESSTHAN ||
+					                comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+					bool inclusive = comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
+					                 comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+					if (is_lower) {
+						if (lower.IsNull() || constant > lower || (constant == lower && !inclusive)) {
+							lower = constant;
+							lower_inclusive = inclusive;
+						}
+						has_range = true;
+						continue;
+					}
+					if (is_upper) {
+						if (upper.IsNull() || constant < upper || (constant == upper && !inclusive)) {
+							upper = constant;
+							upper_inclusive = inclusive;
+						}
+						has_range = true;
+						continue;
+					}
+				}
+			}
+			double child_selectivity;
+			if (InspectHistogram(*child_filter, histogram, distinct_count, child_selectivity)) {
+				result = MinValue(result, child_selectivity);
+				found_estimate = true;
+			}
+		}
+		if (has_range) {
+			result = MinValue(result, histogram.EstimateRange(lower, lower_inclusive, upper, upper_inclusive));
+			found_estimate = true;
+		}
+		if (!found_estimate) {
+			return false;
+		}
+		selectivity = result;
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
 // TODO: Currently only simple AND filters are pushed into table scans.
 //  When OR filters are pushed this function can be added
 // idx_t RelationStatisticsHelper::InspectConjunctionOR(idx_t cardinality, idx_t column_index, ConjunctionOrFilter
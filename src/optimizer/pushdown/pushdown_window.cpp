@@ -10,23 +10,44 @@ namespace duckdb {
 
 using Filter = FilterPushdown::Filter;
 
-bool CanPushdownFilter(vector<column_binding_set_t> window_exprs_partition_bindings,
-                       const vector<ColumnBinding> &bindings) {
-	auto filter_on_all_partitions = true;
-	for (auto &partition_binding_set : window_exprs_partition_bindings) {
-		auto filter_on_binding_set = true;
-		for (auto &binding : bindings) {
-			if (partition_binding_set.find(binding) == partition_binding_set.end()) {
-				filter_on_binding_set = false;
-				break;
-			}
+//! The partitions of a window expression
+struct WindowPartitionInfo {
+	//! The columns the window expression is partitioned by
+	column_binding_set_t bindings;
+	//! The (non-column) expressions the window expression is partitioned by
+	vector<reference<Expression>> expressions;
+};
+
+//! Whether the value of the expression only depends on the partition of a row - i.e. whether it is the same for every
+//! row in the partition
+static bool ExpressionIsOnPartition(const Expression &expr, const WindowPartitionInfo &partition) {
+	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		return partition.bindings.find(colref.binding) != partition.bindings.end();
+	}
+	for (auto &partition_expr : partition.expressions) {
+		if (expr.Equals(partition_expr.get())) {
+			return true;
 		}
-		filter_on_all_partitions = filter_on_all_partitions && filter_on_binding_set;
-		if (!filter_on_all_partitions) {
-			break;
+	}
+	bool is_on_partition = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) {
+		is_on_partition = is_on_partition && ExpressionIsOnPartition(child, partition);
+	});
+	return is_on_partition;
+}
+
+//! A filter can be pushed through the window if it removes entire partitions of every window expression
+static bool CanPushdownFilter(const vector<WindowPartitionInfo> &window_exprs_partitions, const Expression &filter) {
+	if (filter.IsVolatile()) {
+		return false;
+	}
+	for (auto &partition : window_exprs_partitions) {
+		if (!ExpressionIsOnPartition(filter, partition)) {
+			return false;
 		}
 	}
-	return filter_on_all_partitions;
+	return true;
 }
 
 unique_ptr<LogicalOperator> FilterPushdown::PushdownWindow(unique_ptr<LogicalOperator> op) {
@@ -37,7 +58,7 @@ unique_ptr<LogicalOperator> FilterPushdown::PushdownWindow(unique_ptr<LogicalOpe
 	// 1. Loop throguh the expressions, find the window expressions and investigate the partitions
 	// if a filter applies to a partition in each window expression then you can push the filter
 	// into the children.
-	vector<column_binding_set_t> window_exprs_partition_bindings;
+	vector<WindowPartitionInfo> window_exprs_partitions;
 	for (auto &expr : window.expressions) {
 		if (expr->expression_class != ExpressionClass::BOUND_WINDOW) {
 			continue;
@@ -50,24 +71,27 @@ unique_ptr<LogicalOperator> FilterPushdown::PushdownWindow(unique_ptr<LogicalOpe
 			// in order to push down the window.
 			return FinishPushdown(std::move(op));
 		}
-		column_binding_set_t partition_bindings;
+		WindowPartitionInfo partition_info;
 		// 2. Get the binding information of the partitions of the window expression
 		for (auto &partition_expr : partitions) {
 			switch (partition_expr->type) {
-			// TODO: Add expressions for function expressions like FLOOR, CEIL etc.
 			case ExpressionType::BOUND_COLUMN_REF: {
 				auto &partition_col = partition_expr->Cast<BoundColumnRefExpression>();
-				partition_bindings.insert(partition_col.binding);
+				partition_info.bindings.insert(partition_col.binding);
 				break;
 			}
 			default:
+				// expressions like FLOOR(x) or date_trunc('month', x): filters on the same expression can be pushed
+				if (!partition_expr->IsVolatile()) {
+					partition_info.expressions.push_back(*partition_expr);
+				}
 				break;
 			}
 		}
-		window_exprs_partition_bindings.push_back(partition_bindings);
+		window_exprs_partitions.push_back(std::move(partition_info));
 	}
 
-	if (window_exprs_partition_bindings.empty()) {
+	if (window_exprs_partitions.empty()) {
 		return FinishPushdown(std::move(op));
 	}
 
@@ -75,10 +99,8 @@ unique_ptr<LogicalOperator> FilterPushdown::PushdownWindow(unique_ptr<LogicalOpe
 	// Loop through the filters. If a filter is on a partition in every window expression
 	// it can be pushed down.
 	for (idx_t i = 0; i < filters.size(); i++) {
-		// the filter must be on all partition bindings
-		vector<ColumnBinding> bindings;
-		ExtractFilterBindings(*filters.at(i)->filter, bindings);
-		if (CanPushdownFilter(window_exprs_partition_bindings, bindings)) {
+		// the filter must be on the partitions of all window expressions
+		if (CanPushdownFilter(window_exprs_partitions, *filters.at(i)->filter)) {
 			pushdown.filters.push_back(std::move(filters.at(i)));
 		} else {
 			leftover_filters.push_back(std::move(filters.at(i)));
@@ -0,0 +1,36 @@
+#include "duckdb/optimizer/sampling_pushdown.hpp"
+
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_sample.hpp"
+
+namespace duckdb {
+
+bool SamplingPushdown::CanOptimize(LogicalOperator &op) {
+	if (op.type != LogicalOperatorType::LOGICAL_SAMPLE ||
+	    op.children[0]->type != LogicalOperatorType::LOGICAL_GET) {
+		return false;
+	}
+	auto &sample = op.Cast<LogicalSample>();
+	auto &get = op.children[0]->Cast<LogicalGet>();
+	// only system samples are taken per block of rows, bernoulli and reservoir samples need to see every row
+	auto &options = *sample.sample_options;
+	if (options.method != SampleMethod::SYSTEM_SAMPLE || !options.is_percentage) {
+		return false;
+	}
+	return get.function.sampling_pushdown && !get.extra_info.sample_options;
+}
+
+unique_ptr<LogicalOperator> SamplingPushdown::Optimize(unique_ptr<LogicalOperator> op) {
+	if (CanOptimize(*op)) {
+		auto &sample = op->Cast<LogicalSample>();
+		auto get = std::move(op->children[0]);
+		get->Cast<LogicalGet>().extra_info.sample_options = std::move(sample.sample_options);
+		op = std::move(get);
+	}
+	for (auto &child : op->children) {
+		child = Optimize(std::move(child));
+	}
+	return op;
+}
+
+} // namespace duckdb
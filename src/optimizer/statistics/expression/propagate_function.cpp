@@ -1,8 +1,33 @@
+#include "duckdb/optimizer/expression_rewriter.hpp"
 #include "duckdb/optimizer/statistics_propagator.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/storage/statistics/string_stats.hpp"
 
 namespace duckdb {
 
+//! Returns the constant prefix that strings must start with to satisfy a prefix or LIKE function - or an empty string
+//! if there is none
+static string GetConstantPrefix(BoundFunctionExpression &func) {
+	auto &name = func.function.name;
+	bool is_prefix = name == "prefix" || name == "starts_with" || name == "^@";
+	if ((!is_prefix && name != "~~") || func.children.size() != 2 ||
+	    func.children[0]->return_type.id() != LogicalTypeId::VARCHAR ||
+	    func.children[1]->type != ExpressionType::VALUE_CONSTANT) {
+		return string();
+	}
+	auto &constant = func.children[1]->Cast<BoundConstantExpression>().value;
+	if (constant.IsNull() || constant.type().id() != LogicalTypeId::VARCHAR) {
+		return string();
+	}
+	auto &pattern = StringValue::Get(constant);
+	if (is_prefix) {
+		return pattern;
+	}
+	// the characters of the LIKE pattern before the first wildcard
+	return pattern.substr(0, MinValue<idx_t>(pattern.find_first_of("%_"), pattern.size()));
+}
+
 unique_ptr<BaseStatistics> StatisticsPropagator::PropagateExpression(BoundFunctionExpression &func,
                                                                      unique_ptr<Expression> &expr_ptr) {
 	vector<BaseStatistics> stats;
@@ -15,6 +40,18 @@ unique_ptr<BaseStatistics> StatisticsPropagator::PropagateExpression(BoundFuncti
 			stats.push_back(stat->Copy());
 		}
 	}
+	auto prefix = GetConstantPrefix(func);
+	if (!prefix.empty() && StringStats::CheckPrefix(stats[0], prefix) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+		// no string can start with the prefix
+		if (!stats[0].CanHaveNull()) {
+			expr_ptr = make_uniq<BoundConstantExpression>(Value::BOOLEAN(false));
+			return PropagateExpression(expr_ptr);
+		}
+		vector<unique_ptr<Expression>> children;
+		children.push_back(std::move(func.children[0]));
+		expr_ptr = ExpressionRewriter::ConstantOrNull(std::move(children), Value::BOOLEAN(false));
+		return nullptr;
+	}
 	if (!func.function.statistics) {
 		return nullptr;
 	}
@@ -3,6 +3,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/execution/executor.hpp"
+#include "duckdb/parallel/execution_tracer.hpp"
 
 namespace duckdb {
 
@@ -28,6 +29,10 @@ void Event::Finish() {
 	D_ASSERT(!finished);
 	FinishEvent();
 	finished = true;
+	auto tracer = executor.GetTracer();
+	if (tracer) {
+		tracer->AddInstantEvent("event finished", "event", {{"tasks", NumericCast<int64_t>(total_tasks.load())}});
+	}
 	// finished processing the pipeline, now we can schedule pipelines that depend on this pipeline
 	for (auto &parent_entry : parents) {
 		auto parent = parent_entry.lock();
@@ -0,0 +1,141 @@
+#include "duckdb/parallel/execution_tracer.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/fstream.hpp"
+
+#include "yyjson.hpp"
+
+using namespace duckdb_yyjson; // NOLINT
+
+namespace duckdb {
+
+static thread_local ExecutionTracer *active_tracer = nullptr;
+
+ExecutionTracer::ExecutionTracer(string output_path_p)
+    : output_path(std::move(output_path_p)), start_time(std::chrono::steady_clock::now()) {
+}
+
+int64_t ExecutionTracer::Now() const {
+	auto elapsed = std::chrono::steady_clock::now() - start_time;
+	return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+idx_t ExecutionTracer::GetThreadIndex(lock_guard<mutex> &guard) {
+	auto entry = thread_indexes.find(std::this_thread::get_id());
+	if (entry != thread_indexes.end()) {
+		return entry->second;
+	}
+	auto index = thread_indexes.size();
+	thread_indexes[std::this_thread::get_id()] = index;
+	return index;
+}
+
+void ExecutionTracer::AddEvent(string name, const char *category, int64_t start, int64_t end, const char *status,
+                               vector<pair<const char *, int64_t>> args) {
+	ExecutionTraceEvent event;
+	event.name = std::move(name);
+	event.category = category;
+	event.phase = 'X';
+	event.start = start;
+	event.duration = end - start;
+	event.status = status;
+	event.args = std::move(args);
+
+	lock_guard<mutex> guard(lock);
+	event.thread = GetThreadIndex(guard);
+	events.push_back(std::move(event));
+}
+
+void ExecutionTracer::AddInstantEvent(string name, const char *category, vector<pair<const char *, int64_t>> args) {
+	ExecutionTraceEvent event;
+	event.name = std::move(name);
+	event.category = category;
+	event.phase = 'i';
+	event.start = Now();
+	event.duration = 0;
+	event.status = nullptr;
+	event.args = std::move(args);
+
+	lock_guard<mutex> guard(lock);
+	event.thread = GetThreadIndex(guard);
+	events.push_back(std::move(event));
+}
+
+string ExecutionTracer::ToJSON() const {
+	lock_guard<mutex> guard(lock);
+	auto doc = yyjson_mut_doc_new(nullptr);
+	auto root = yyjson_mut_obj(doc);
+	yyjson_mut_doc_set_root(doc, root);
+	auto trace_events = yyjson_mut_arr(doc);
+	for (idx_t thread = 0; thread < thread_indexes.size(); thread++) {
+		// name the threads in the order in which they first recorded an event
+		auto metadata = yyjson_mut_arr_add_obj(doc, trace_events);
+		yyjson_mut_obj_add_str(doc, metadata, "name", "thread_name");
+		yyjson_mut_obj_add_str(doc, metadata, "ph", "M");
+		yyjson_mut_obj_add_uint(doc, metadata, "pid", 1);
+		yyjson_mut_obj_add_uint(doc, metadata, "tid", thread);
+		auto args = yyjson_mut_obj_add_obj(doc, metadata, "args");
+		auto thread_name = "thread " + std::to_string(thread);
+		yyjson_mut_obj_add_strcpy(doc, args, "name", thread_name.c_str());
+	}
+	for (auto &event : events) {
+		auto obj = yyjson_mut_arr_add_obj(doc, trace_events);
+		yyjson_mut_obj_add_strcpy(doc, obj, "name", event.name.c_str());
+		yyjson_mut_obj_add_str(doc, obj, "cat", event.category);
+		yyjson_mut_obj_add_strn(doc, obj, "ph", &event.phase, 1);
+		yyjson_mut_obj_add_uint(doc, obj, "pid", 1);
+		yyjson_mut_obj_add_uint(doc, obj, "tid", event.thread);
+		yyjson_mut_obj_add_int(doc, obj, "ts", event.start);
+		if (event.phase == 'X') {
+			yyjson_mut_obj_add_int(doc, obj, "dur", event.duration);
+		} else {
+			// instant events are scoped to the thread that recorded them
+			yyjson_mut_obj_add_str(doc, obj, "s", "t");
+		}
+		if (event.status || !event.args.empty()) {
+			auto args = yyjson_mut_obj_add_obj(doc, obj, "args");
+			if (event.status) {
+				yyjson_mut_obj_add_str(doc, args, "status", event.status);
+			}
+			for (auto &arg : event.args) {
+				yyjson_mut_obj_add_int(doc, args, arg.first, arg.second);
+			}
+		}
+	}
+	yyjson_mut_obj_add_val(doc, root, "traceEvents", trace_events);
+	yyjson_mut_obj_add_str(doc, root, "displayTimeUnit", "ms");
+
+	auto data = yyjson_mut_write(doc, 0, nullptr);
+	if (!data) {
+		yyjson_mut_doc_free(doc);
+		throw InternalException("The execution trace could not be rendered as JSON, yyjson failed");
+	}
+	auto result = string(data);
+	free(data);
+	yyjson_mut_doc_free(doc);
+	return result;
+}
+
+void ExecutionTracer::WriteToFile() const {
+	auto trace = ToJSON();
+	ofstream out(output_path);
+	out << trace;
+	out.close();
+	if (out.fail()) {
+		throw IOException("Could not write execution trace to \"%s\"", output_path);
+	}
+}
+
+optional_ptr<ExecutionTracer> ExecutionTracer::GetActive() {
+	return active_tracer;
+}
+
+ExecutionTracer::ActiveScope::ActiveScope(optional_ptr<ExecutionTracer> tracer) : previous(active_tracer) {
+	active_tracer = tracer.get();
+}
+
+ExecutionTracer::ActiveScope::~ActiveScope() {
+	active_tracer = previous.get();
+}
+
+} // namespace duckdb
@@ -8,6 +8,7 @@
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/parallel/execution_tracer.hpp"
 #include "duckdb/parallel/meta_pipeline.hpp"
 #include "duckdb/parallel/pipeline_complete_event.hpp"
 #include "duckdb/parallel/pipeline_event.hpp"
@@ -384,6 +385,32 @@ void Executor::Initialize(PhysicalOperator &plan) {
 	InitializeInternal(plan);
 }
 
+static bool AllOperatorsBelowThreshold(const PhysicalOperator &op, idx_t threshold) {
+	if (op.estimated_cardinality > threshold) {
+		return false;
+	}
+	if (op.type == PhysicalOperatorType::TABLE_SCAN && !op.Cast<PhysicalTableScan>().function.cardinality) {
+		// table functions without a cardinality estimate are estimated to produce a single row
+		return false;
+	}
+	for (auto &child : op.children) {
+		if (!AllOperatorsBelowThreshold(*child, threshold)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Tiny queries are executed on the calling thread only: handing their tasks to other threads costs more than it
+//! gains
+static bool CanExecuteInline(ClientContext &context, const PhysicalOperator &plan) {
+	auto threshold = DBConfig::GetConfig(context).options.inline_execution_threshold;
+	if (threshold == 0 || ClientConfig::GetConfig(context).verify_parallelism) {
+		return false;
+	}
+	return AllOperatorsBelowThreshold(plan, threshold);
+}
+
 void Executor::InitializeInternal(PhysicalOperator &plan) {
 
 	auto &scheduler = TaskScheduler::GetScheduler(context);
@@ -393,7 +420,16 @@ void Executor::InitializeInternal(PhysicalOperator &plan) {
 
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
-		this->producer = scheduler.CreateProducer();
+		auto &trace_output = ClientConfig::GetConfig(context).execution_trace_output;
+		if (!trace_output.empty()) {
+			tracer = make_uniq<ExecutionTracer>(trace_output);
+		}
+		optional_idx query_id;
+		if (context.transaction.HasActiveTransaction()) {
+			query_id = context.transaction.GetActiveQuery();
+		}
+		this->producer = scheduler.CreateProducer(ClientConfig::GetConfig(context).query_priority, query_id);
+		producer->execute_inline = CanExecuteInline(context, plan);
 
 		// build and ready the pipelines
 		PipelineBuildState state;
@@ -527,20 +563,57 @@ bool Executor::ResultCollectorIsBlocked() {
 }
 
 void Executor::AddToBeRescheduled(shared_ptr<Task> &task_p) {
-	lock_guard<mutex> l(executor_lock);
-	if (cancelled) {
-		return;
+	bool result_collector_blocked;
+	{
+		lock_guard<mutex> l(executor_lock);
+		if (cancelled) {
+			return;
+		}
+		if (to_be_rescheduled_tasks.find(task_p.get()) != to_be_rescheduled_tasks.end()) {
+			return;
+		}
+		to_be_rescheduled_tasks[task_p.get()] = std::move(task_p);
+		result_collector_blocked = ResultCollectorIsBlocked();
 	}
-	if (to_be_rescheduled_tasks.find(task_p.get()) != to_be_rescheduled_tasks.end()) {
-		return;
+	if (result_collector_blocked) {
+		// the streaming result has buffered data, and is waiting for the client to fetch it
+		SignalReady();
+	}
+}
+
+void Executor::CompletePipeline() {
+	if (++completed_pipelines == total_pipelines) {
+		SignalReady();
 	}
-	to_be_rescheduled_tasks[task_p.get()] = std::move(task_p);
 }
 
 bool Executor::ExecutionIsFinished() {
 	return completed_pipelines >= total_pipelines || HasError();
 }
 
+void Executor::SetReadyCallback(std::function<void()> callback) {
+	{
+		lock_guard<mutex> l(ready_lock);
+		ready_callback = std::move(callback);
+	}
+	bool result_collector_blocked;
+	{
+		lock_guard<mutex> l(executor_lock);
+		result_collector_blocked = ResultCollectorIsBlocked();
+	}
+	if (result_collector_blocked || ExecutionIsFinished()) {
+		// the execution can already be continued: don't wait for an event that has already happened
+		SignalReady();
+	}
+}
+
+void Executor::SignalReady() {
+	lock_guard<mutex> l(ready_lock);
+	if (ready_callback) {
+		ready_callback();
+	}
+}
+
 PendingExecutionResult Executor::ExecuteTask(bool dry_run) {
 	// Only executor should return NO_TASKS_AVAILABLE
 	D_ASSERT(execution_result != PendingExecutionResult::NO_TASKS_AVAILABLE);
@@ -626,6 +699,7 @@ void Executor::Reset() {
 	pipelines.clear();
 	events.clear();
 	to_be_rescheduled_tasks.clear();
+	tracer.reset();
 	execution_result = PendingExecutionResult::RESULT_NOT_READY;
 }
 
@@ -659,6 +733,7 @@ void Executor::PushError(ErrorData exception) {
 	error_manager.PushError(std::move(exception));
 	// interrupt execution of any other pipelines that belong to this executor
 	context.interrupted = true;
+	SignalReady();
 }
 
 bool Executor::HasError() {
@@ -1,6 +1,11 @@
 #include "duckdb/parallel/task.hpp"
+#include "duckdb/common/enum_util.hpp"
 #include "duckdb/execution/executor.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/query_telemetry.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/parallel/execution_tracer.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 
 namespace duckdb {
@@ -8,12 +13,20 @@ namespace duckdb {
 ExecutorTask::ExecutorTask(Executor &executor_p, shared_ptr<Event> event_p)
     : executor(executor_p), event(std::move(event_p)) {
 	executor.RegisterTask();
+	auto tracer = executor.GetTracer();
+	if (tracer) {
+		trace_ready_time = tracer->Now();
+	}
 }
 
 ExecutorTask::ExecutorTask(ClientContext &context, shared_ptr<Event> event_p, const PhysicalOperator &op_p)
     : executor(Executor::Get(context)), event(std::move(event_p)), op(&op_p) {
 	thread_context = make_uniq<ThreadContext>(context);
 	executor.RegisterTask();
+	auto tracer = executor.GetTracer();
+	if (tracer) {
+		trace_ready_time = tracer->Now();
+	}
 }
 
 ExecutorTask::~ExecutorTask() {
@@ -29,11 +42,70 @@ void ExecutorTask::Deschedule() {
 }
 
 void ExecutorTask::Reschedule() {
+	auto tracer = executor.GetTracer();
+	if (tracer) {
+		trace_ready_time = tracer->Now();
+	}
 	auto this_ptr = shared_from_this();
 	executor.RescheduleTask(this_ptr);
 }
 
+string ExecutorTask::TaskType() const {
+	return op ? op->GetName() : "ExecutorTask";
+}
+
+//! Counts the thread as working on the query and measures the time it spends on the task
+struct TelemetryTaskScope {
+	explicit TelemetryTaskScope(QueryTelemetry &telemetry_p)
+	    : telemetry(telemetry_p), start(std::chrono::steady_clock::now()) {
+		telemetry.StartTask();
+	}
+	~TelemetryTaskScope() {
+		auto elapsed = std::chrono::steady_clock::now() - start;
+		telemetry.EndTask(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+	}
+
+	QueryTelemetry &telemetry;
+	time_point<std::chrono::steady_clock> start;
+};
+
 TaskExecutionResult ExecutorTask::Execute(TaskExecutionMode mode) {
+	auto tracer = executor.GetTracer();
+	if (!tracer) {
+		return ExecuteInternal(mode);
+	}
+	// record how long the task waited in the queue and how long it was blocked before this run
+	auto start = tracer->Now();
+	int64_t blocked_us = 0;
+	if (trace_blocked_time >= 0) {
+		// the task can be rescheduled before the run that blocked it has ended
+		blocked_us = MaxValue<int64_t>(trace_ready_time - trace_blocked_time, 0);
+	}
+	auto queued_us = MaxValue<int64_t>(start - trace_ready_time, 0);
+	auto name = TaskType();
+
+	ExecutionTracer::ActiveScope trace_scope(tracer);
+	auto result = ExecuteInternal(mode);
+	auto end = tracer->Now();
+	tracer->AddEvent(std::move(name), "task", start, end, EnumUtil::ToChars(result),
+	                 {{"queued_us", queued_us}, {"blocked_us", blocked_us}});
+	if (result == TaskExecutionResult::TASK_BLOCKED) {
+		// the task is ready again once it is rescheduled
+		trace_blocked_time = end;
+	} else {
+		trace_blocked_time = -1;
+		trace_ready_time = end;
+	}
+	return result;
+}
+
+TaskExecutionResult ExecutorTask::ExecuteInternal(TaskExecutionMode mode) {
+	auto &client_data = ClientData::Get(executor.context);
+	// memory reserved by the task is charged to the client that runs the query
+	ClientMemoryTracker::ActiveScope memory_scope(client_data.memory_tracker.get());
+	// the time, reads and spills of the task are accounted to the running query
+	QueryTelemetry::ActiveScope telemetry_scope(client_data.query_telemetry.get());
+	TelemetryTaskScope task_scope(*client_data.query_telemetry);
 	try {
 		if (thread_context) {
 			thread_context->profiler.StartOperator(op);
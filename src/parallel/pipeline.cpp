@@ -29,6 +29,16 @@ const PipelineExecutor &PipelineTask::GetPipelineExecutor() const {
 	return *pipeline_executor;
 }
 
+string PipelineTask::TaskType() const {
+	auto source = pipeline.GetSource();
+	auto sink = pipeline.GetSink();
+	string result = source ? source->GetName() : "Pipeline";
+	if (sink) {
+		result += " -> " + sink->GetName();
+	}
+	return result;
+}
+
 TaskExecutionResult PipelineTask::ExecuteTask(TaskExecutionMode mode) {
 	if (!pipeline_executor) {
 		pipeline_executor = make_uniq<PipelineExecutor>(pipeline.GetClientContext(), pipeline);
@@ -114,6 +124,10 @@ bool Pipeline::ScheduleParallel(shared_ptr<Event> &event) {
 	auto max_threads = source_state->MaxThreads();
 	auto &scheduler = TaskScheduler::GetScheduler(executor.context);
 	auto active_threads = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	if (executor.GetToken().execute_inline) {
+		// all tasks are executed by the calling thread
+		active_threads = 1;
+	}
 	if (max_threads > active_threads) {
 		max_threads = active_threads;
 	}
@@ -238,6 +252,52 @@ void Pipeline::Ready() {
 	std::reverse(operators.begin(), operators.end());
 }
 
+//! Estimates the number of bytes a row of the given type takes up in a vector
+static idx_t EstimateRowWidth(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::STRUCT: {
+		idx_t width = 0;
+		for (auto &child_type : StructType::GetChildTypes(type)) {
+			width += EstimateRowWidth(child_type.second);
+		}
+		return width;
+	}
+	case PhysicalType::LIST:
+		// we assume a single element per list
+		return sizeof(list_entry_t) + EstimateRowWidth(ListType::GetChildType(type));
+	case PhysicalType::ARRAY:
+		return ArrayType::GetSize(type) * EstimateRowWidth(ArrayType::GetChildType(type));
+	default:
+		return GetTypeIdSize(type.InternalType());
+	}
+}
+
+idx_t Pipeline::GetChunkCapacity() {
+	auto chunk_budget = ClientConfig::GetConfig(GetClientContext()).pipeline_chunk_budget;
+	if (chunk_budget == 0 || !source) {
+		return STANDARD_VECTOR_SIZE;
+	}
+	// the widest chunk that is pushed through the pipeline determines how many rows the chunks can hold
+	vector<const_reference<PhysicalOperator>> chunk_producers {*source};
+	chunk_producers.insert(chunk_producers.end(), operators.begin(), operators.end());
+	idx_t row_width = 0;
+	for (auto &op : chunk_producers) {
+		idx_t width = 0;
+		for (auto &type : op.get().GetTypes()) {
+			width += EstimateRowWidth(type);
+		}
+		row_width = MaxValue(row_width, width);
+	}
+	// halve the capacity until the widest chunk fits in the budget, but keep it large enough to amortize the
+	// per-chunk overhead of the operators
+	auto min_capacity = MinValue<idx_t>(MIN_CHUNK_CAPACITY, STANDARD_VECTOR_SIZE);
+	idx_t capacity = STANDARD_VECTOR_SIZE;
+	while (capacity > min_capacity && capacity * row_width > chunk_budget) {
+		capacity /= 2;
+	}
+	return MaxValue(capacity, min_capacity);
+}
+
 void Pipeline::AddDependency(shared_ptr<Pipeline> &pipeline) {
 	D_ASSERT(pipeline);
 	dependencies.push_back(weak_ptr<Pipeline>(pipeline));
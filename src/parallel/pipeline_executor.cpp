@@ -25,6 +25,10 @@ PipelineExecutor::PipelineExecutor(ClientContext &context_p, Pipeline &pipeline_
 		}
 	}
 	local_source_state = pipeline.source->GetLocalSourceState(context, *pipeline.source_state);
+	chunk_capacity = pipeline.GetChunkCapacity();
+	if (chunk_capacity < STANDARD_VECTOR_SIZE) {
+		source_buffer.Initialize(Allocator::Get(context.client), pipeline.source->GetTypes());
+	}
 
 	intermediate_chunks.reserve(pipeline.operators.size());
 	intermediate_states.reserve(pipeline.operators.size());
@@ -201,7 +205,11 @@ PipelineExecuteResult PipelineExecutor::Execute(idx_t max_chunks) {
 			if (!next_batch_blocked) {
 				// "Regular" path: fetch a chunk from the source and push it through the pipeline
 				source_chunk.Reset();
-				source_result = FetchFromSource(source_chunk);
+				if (chunk_capacity < STANDARD_VECTOR_SIZE) {
+					source_result = FetchSliceFromSource(source_chunk);
+				} else {
+					source_result = FetchFromSource(source_chunk);
+				}
 				if (source_result == SourceResultType::BLOCKED) {
 					return PipelineExecuteResult::INTERRUPTED;
 				}
@@ -511,6 +519,30 @@ SourceResultType PipelineExecutor::FetchFromSource(DataChunk &result) {
 	return res;
 }
 
+SourceResultType PipelineExecutor::FetchSliceFromSource(DataChunk &result) {
+	if (source_buffer_offset >= source_buffer.size()) {
+		// all slices of the buffered chunk have been pushed through the pipeline: fetch the next chunk
+		source_buffer.Reset();
+		source_buffer_offset = 0;
+		source_buffer_result = FetchFromSource(source_buffer);
+		if (source_buffer_result == SourceResultType::BLOCKED) {
+			return SourceResultType::BLOCKED;
+		}
+	}
+	// the slice references the buffered chunk, which stays alive until all of its slices are done
+	auto slice_end = MinValue<idx_t>(source_buffer_offset + chunk_capacity, source_buffer.size());
+	for (idx_t col_idx = 0; col_idx < result.ColumnCount(); col_idx++) {
+		result.data[col_idx].Slice(source_buffer.data[col_idx], source_buffer_offset, slice_end);
+	}
+	result.SetCardinality(slice_end - source_buffer_offset);
+	source_buffer_offset = slice_end;
+	// the source is only finished once the last slice has been returned
+	if (source_buffer_offset < source_buffer.size()) {
+		return SourceResultType::HAVE_MORE_OUTPUT;
+	}
+	return source_buffer_result;
+}
+
 void PipelineExecutor::InitializeChunk(DataChunk &chunk) {
 	auto &last_op = pipeline.operators.empty() ? *pipeline.source : pipeline.operators.back().get();
 	chunk.Initialize(Allocator::DefaultAllocator(), last_op.GetTypes());
@@ -2,6 +2,7 @@
 
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/numa.hpp"
 #include "duckdb/common/numeric_utils.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
@@ -23,6 +24,10 @@
 #include <unistd.h>
 #endif
 
+#if defined(__linux__) && !defined(DUCKDB_WASM) && !defined(DUCKDB_NO_THREADS)
+#include <pthread.h>
+#endif
+
 namespace duckdb {
 
 struct SchedulerThread {
@@ -34,43 +39,233 @@ struct SchedulerThread {
 #endif
 };
 
+ProducerState::ProducerState(QueryPriority priority, optional_idx query_id)
+    : priority(priority), query_id(query_id), queued_tasks(0), running_tasks(0) {
+}
+
+idx_t ProducerState::GetWeight() const {
+	switch (priority) {
+	case QueryPriority::LOW:
+		return LOW_PRIORITY_WEIGHT;
+	case QueryPriority::HIGH:
+		return HIGH_PRIORITY_WEIGHT;
+	default:
+		return NORMAL_PRIORITY_WEIGHT;
+	}
+}
+
 #ifndef DUCKDB_NO_THREADS
-typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
+//! A task in the queue, together with the producer that scheduled it
+struct QueuedTask {
+	shared_ptr<Task> task;
+	shared_ptr<ProducerState> producer;
+};
+
+typedef duckdb_moodycamel::ConcurrentQueue<QueuedTask> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
+//! The state and the per-node queue tokens of a producer. It is shared by the token of the producer and the producer
+//! snapshots of the threads, so that it stays alive while a thread may still dequeue from it.
+struct QueueProducer {
+	QueueProducer(ConcurrentQueue &queue, shared_ptr<ProducerState> state_p);
+
+	shared_ptr<ProducerState> state;
+	//! The token of the producer for every node queue
+	vector<unique_ptr<duckdb_moodycamel::ProducerToken>> queue_tokens;
+};
+
+//! A thread's copy of the live producers of the queue. The copy is only refreshed when producers are added or
+//! removed, so that threads pick the next producer without taking a lock shared by all threads.
+struct ProducerSnapshot {
+	//! The version of the producers the copy was taken from
+	idx_t version = DConstants::INVALID_INDEX;
+	vector<shared_ptr<QueueProducer>> producers;
+};
+
+//! The task queue: one queue per NUMA node. Tasks are enqueued on the node of the thread that schedules them, so
+//! that the data they produce is preferably processed on the same node. Threads dequeue from their own node first,
+//! and steal from the other nodes if it is empty.
 struct ConcurrentQueue {
-	concurrent_queue_t q;
+	ConcurrentQueue();
+
+	vector<unique_ptr<concurrent_queue_t>> queues;
+	//! The CPUs of every node
+	const vector<vector<idx_t>> &node_cpus;
+	//! Counts the tasks in all queues
 	lightweight_semaphore_t semaphore;
+	//! The live producers, which are only locked to add or remove a producer and to refresh a snapshot
+	mutex producers_lock;
+	vector<shared_ptr<QueueProducer>> producers;
+	//! Incremented whenever a producer is added or removed
+	atomic<idx_t> producers_version {0};
 
 	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	//! Dequeue a task of the producer with queued tasks that has the least running tasks relative to its weight,
+	//! preferring the node of the calling thread
+	bool Dequeue(ProducerSnapshot &snapshot, QueuedTask &task);
+	//! Restrict a worker thread to the CPUs of a node, the workers are spread over the nodes round-robin
+	void PinThread(thread &worker_thread, idx_t worker_idx);
+
+	void AddProducer(shared_ptr<QueueProducer> producer);
+	void RemoveProducer(QueueProducer &producer);
+
+private:
+	bool DequeueFromProducer(QueueProducer &producer, QueuedTask &task);
 };
 
+QueueProducer::QueueProducer(ConcurrentQueue &queue, shared_ptr<ProducerState> state_p) : state(std::move(state_p)) {
+	for (auto &node_queue : queue.queues) {
+		queue_tokens.push_back(make_uniq<duckdb_moodycamel::ProducerToken>(*node_queue));
+	}
+}
+
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	QueueProducerToken(ConcurrentQueue &queue, shared_ptr<ProducerState> state_p)
+	    : queue(queue), producer(make_shared_ptr<QueueProducer>(queue, std::move(state_p))) {
+		queue.AddProducer(producer);
+	}
+
+	~QueueProducerToken() {
+		queue.RemoveProducer(*producer);
 	}
 
-	duckdb_moodycamel::ProducerToken queue_token;
+	ConcurrentQueue &queue;
+	shared_ptr<QueueProducer> producer;
 };
 
+ConcurrentQueue::ConcurrentQueue() : node_cpus(NumaTopology::Get().node_cpus) {
+	for (idx_t node = 0; node < node_cpus.size(); node++) {
+		queues.push_back(make_uniq<concurrent_queue_t>());
+	}
+}
+
+void ConcurrentQueue::AddProducer(shared_ptr<QueueProducer> producer) {
+	lock_guard<mutex> guard(producers_lock);
+	producers.push_back(std::move(producer));
+	producers_version++;
+}
+
+void ConcurrentQueue::RemoveProducer(QueueProducer &producer) {
+	lock_guard<mutex> guard(producers_lock);
+	for (idx_t i = 0; i < producers.size(); i++) {
+		if (RefersToSameObject(*producers[i], producer)) {
+			producers.erase_at(i);
+			break;
+		}
+	}
+	producers_version++;
+}
+
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
+	auto node = NumaTopology::GetCurrentNode();
+	auto &producer = *token.token->producer;
+	producer.state->queued_tasks++;
+	if (queues[node]->enqueue(*producer.queue_tokens[node], QueuedTask {std::move(task), producer.state})) {
 		semaphore.signal();
 	} else {
+		producer.state->queued_tasks--;
 		throw InternalException("Could not schedule task!");
 	}
 }
 
+bool ConcurrentQueue::DequeueFromProducer(QueueProducer &producer, QueuedTask &task) {
+	auto node = NumaTopology::GetCurrentNode();
+	for (idx_t i = 0; i < queues.size(); i++) {
+		auto queue_idx = (node + i) % queues.size();
+		if (queues[queue_idx]->try_dequeue_from_producer(*producer.queue_tokens[queue_idx], task)) {
+			task.producer->queued_tasks--;
+			return true;
+		}
+	}
+	return false;
+}
+
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	QueuedTask queued_task;
+	if (!DequeueFromProducer(*token.token->producer, queued_task)) {
+		return false;
+	}
+	task = std::move(queued_task.task);
+	return true;
+}
+
+bool ConcurrentQueue::Dequeue(ProducerSnapshot &snapshot, QueuedTask &task) {
+	auto version = producers_version.load();
+	if (snapshot.version != version) {
+		// producers were added or removed since the snapshot was taken
+		lock_guard<mutex> guard(producers_lock);
+		snapshot.producers = producers;
+		snapshot.version = producers_version.load();
+	}
+	optional_ptr<QueueProducer> next_producer;
+	for (auto &producer_ptr : snapshot.producers) {
+		auto &producer = *producer_ptr;
+		if (producer.state->queued_tasks == 0) {
+			continue;
+		}
+		if (!next_producer || producer.state->running_tasks * next_producer->state->GetWeight() <
+		                          next_producer->state->running_tasks * producer.state->GetWeight()) {
+			next_producer = producer;
+		}
+	}
+	if (next_producer && DequeueFromProducer(*next_producer, task)) {
+		return true;
+	}
+	// the tasks of producers that were destroyed remain in the queue, so fall back to any task
+	auto node = NumaTopology::GetCurrentNode();
+	for (idx_t i = 0; i < queues.size(); i++) {
+		if (queues[(node + i) % queues.size()]->try_dequeue(task)) {
+			task.producer->queued_tasks--;
+			return true;
+		}
+	}
+	return false;
+}
+
+void ConcurrentQueue::PinThread(thread &worker_thread, idx_t worker_idx) {
+	if (node_cpus.size() <= 1) {
+		// nothing to gain from pinning threads on a single node
+		return;
+	}
+#if defined(__linux__) && !defined(DUCKDB_WASM)
+	cpu_set_t cpus;
+	CPU_ZERO(&cpus);
+	for (auto cpu : node_cpus[worker_idx % node_cpus.size()]) {
+		if (cpu < CPU_SETSIZE) {
+			CPU_SET(cpu, &cpus);
+		}
+	}
+	// failing to pin the thread is not an error: it is just a hint
+	pthread_setaffinity_np(worker_thread.native_handle(), sizeof(cpus), &cpus);
+#endif
+}
+
+static ProducerState &GetProducerState(const shared_ptr<QueueProducer> &producer) {
+	return *producer->state;
 }
 
+//! Counts a task of a producer as running while it is being executed
+struct RunningTask {
+	explicit RunningTask(ProducerState &producer) : producer(producer) {
+		producer.running_tasks++;
+	}
+	~RunningTask() {
+		producer.running_tasks--;
+	}
+
+	ProducerState &producer;
+};
+
 #else
 struct ConcurrentQueue {
 	reference_map_t<QueueProducerToken, std::queue<shared_ptr<Task>>> q;
 	mutex qlock;
+	//! The live producers
+	mutex producers_lock;
+	vector<reference<QueueProducerToken>> producers;
 
 	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
@@ -78,6 +273,7 @@ struct ConcurrentQueue {
 
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 	lock_guard<mutex> lock(qlock);
+	token.state->queued_tasks++;
 	q[std::ref(*token.token)].push(std::move(task));
 }
 
@@ -92,26 +288,46 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task>
 
 	task = std::move(it->second.front());
 	it->second.pop();
+	token.state->queued_tasks--;
 
 	return true;
 }
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue(&queue) {
+	QueueProducerToken(ConcurrentQueue &queue, shared_ptr<ProducerState> state_p)
+	    : state(std::move(state_p)), queue(&queue) {
+		lock_guard<mutex> guard(queue.producers_lock);
+		queue.producers.push_back(*this);
 	}
 
 	~QueueProducerToken() {
+		{
+			lock_guard<mutex> guard(queue->producers_lock);
+			for (idx_t i = 0; i < queue->producers.size(); i++) {
+				if (RefersToSameObject(queue->producers[i].get(), *this)) {
+					queue->producers.erase_at(i);
+					break;
+				}
+			}
+		}
 		lock_guard<mutex> lock(queue->qlock);
 		queue->q.erase(*this);
 	}
 
+	shared_ptr<ProducerState> state;
+
 private:
 	ConcurrentQueue *queue;
 };
+
+static ProducerState &GetProducerState(const reference<QueueProducerToken> &producer) {
+	return *producer.get().state;
+}
 #endif
 
-ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
-    : scheduler(scheduler), token(std::move(token)) {
+ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token,
+                             shared_ptr<ProducerState> state)
+    : scheduler(scheduler), token(std::move(token)), state(std::move(state)) {
 }
 
 ProducerToken::~ProducerToken() {
@@ -143,17 +359,33 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 	return db.GetScheduler();
 }
 
-unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
-	auto token = make_uniq<QueueProducerToken>(*queue);
-	return make_uniq<ProducerToken>(*this, std::move(token));
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(QueryPriority priority, optional_idx query_id) {
+	auto state = make_shared_ptr<ProducerState>(priority, query_id);
+	auto token = make_uniq<QueueProducerToken>(*queue, state);
+	return make_uniq<ProducerToken>(*this, std::move(token), std::move(state));
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
+	if (token.execute_inline) {
+		// the owner of the token executes the task itself, no need to wake up any thread
+		lock_guard<mutex> producer_lock(token.producer_lock);
+		token.inline_tasks.push_back(std::move(task));
+		return;
+	}
 	// Enqueue a task for the given producer token and signal any sleeping threads
 	queue->Enqueue(token, std::move(task));
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
+	if (token.execute_inline) {
+		lock_guard<mutex> producer_lock(token.producer_lock);
+		if (token.inline_tasks.empty()) {
+			return false;
+		}
+		task = std::move(token.inline_tasks.front());
+		token.inline_tasks.pop_front();
+		return true;
+	}
 	return queue->DequeueFromProducer(token, task);
 }
 
@@ -161,7 +393,8 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 #ifndef DUCKDB_NO_THREADS
 	static constexpr const int64_t INITIAL_FLUSH_WAIT = 500000; // initial wait time of 0.5s (in mus) before flushing
 
-	shared_ptr<Task> task;
+	QueuedTask queued_task;
+	ProducerSnapshot producers;
 	// loop until the marker is set to false
 	while (*marker) {
 		if (!Allocator::SupportsFlush()) {
@@ -185,7 +418,9 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				}
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
+		if (queue->Dequeue(producers, queued_task)) {
+			RunningTask running_task(*queued_task.producer);
+			auto &task = queued_task.task;
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -215,12 +450,15 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	idx_t completed_tasks = 0;
+	ProducerSnapshot producers;
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
-		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		QueuedTask queued_task;
+		if (!queue->Dequeue(producers, queued_task)) {
 			return completed_tasks;
 		}
+		RunningTask running_task(*queued_task.producer);
+		auto &task = queued_task.task;
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 		switch (execute_result) {
@@ -245,12 +483,15 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 
 void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
-	shared_ptr<Task> task;
+	QueuedTask queued_task;
+	ProducerSnapshot producers;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->Dequeue(producers, queued_task)) {
 			return;
 		}
+		RunningTask running_task(*queued_task.producer);
+		auto &task = queued_task.task;
 		try {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 			switch (execute_result) {
@@ -284,6 +525,21 @@ int32_t TaskScheduler::NumberOfThreads() {
 	return current_thread_count.load();
 }
 
+vector<ProducerInformation> TaskScheduler::GetProducerInformation() {
+	vector<ProducerInformation> result;
+	lock_guard<mutex> guard(queue->producers_lock);
+	for (auto &producer_ref : queue->producers) {
+		auto &state = GetProducerState(producer_ref);
+		ProducerInformation info;
+		info.query_id = state.query_id;
+		info.priority = state.priority;
+		info.queued_tasks = state.queued_tasks;
+		info.running_tasks = state.running_tasks;
+		result.push_back(info);
+	}
+	return result;
+}
+
 void TaskScheduler::SetThreads(idx_t total_threads, idx_t external_threads) {
 	if (total_threads == 0) {
 		throw SyntaxException("Number of threads must be positive!");
@@ -393,6 +649,7 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 				// in this case we cannot allocate more threads - stop launching them
 				break;
 			}
+			queue->PinThread(*worker_thread, threads.size());
 			auto thread_wrapper = make_uniq<SchedulerThread>(std::move(worker_thread));
 
 			threads.push_back(std::move(thread_wrapper));
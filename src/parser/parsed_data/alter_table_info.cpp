@@ -399,6 +399,45 @@ string AlterForeignKeyInfo::ToString() const {
 	throw NotImplementedException("NOT PARSABLE CURRENTLY");
 }
 
+//===--------------------------------------------------------------------===//
+// SetClusterByInfo
+//===--------------------------------------------------------------------===//
+SetClusterByInfo::SetClusterByInfo() : AlterTableInfo(AlterTableType::SET_CLUSTER_BY) {
+}
+
+SetClusterByInfo::SetClusterByInfo(AlterEntryData data, vector<string> cluster_by_p)
+    : AlterTableInfo(AlterTableType::SET_CLUSTER_BY, std::move(data)), cluster_by(std::move(cluster_by_p)) {
+}
+SetClusterByInfo::~SetClusterByInfo() {
+}
+
+unique_ptr<AlterInfo> SetClusterByInfo::Copy() const {
+	return make_uniq_base<AlterInfo, SetClusterByInfo>(GetAlterEntryData(), cluster_by);
+}
+
+string SetClusterByInfo::ToString() const {
+	string result = "";
+	result += "ALTER TABLE ";
+	if (if_not_found == OnEntryNotFound::RETURN_NULL) {
+		result += " IF EXISTS";
+	}
+	result += QualifierToString(catalog, schema, name);
+	if (cluster_by.empty()) {
+		result += " RESET (cluster_by)";
+	} else {
+		string columns;
+		for (idx_t i = 0; i < cluster_by.size(); i++) {
+			if (i > 0) {
+				columns += ", ";
+			}
+			columns += KeywordHelper::WriteOptionallyQuoted(cluster_by[i]);
+		}
+		result += " SET (cluster_by=" + KeywordHelper::WriteQuoted(columns, '\'') + ")";
+	}
+	result += ";";
+	return result;
+}
+
 //===--------------------------------------------------------------------===//
 // Alter View
 //===--------------------------------------------------------------------===//
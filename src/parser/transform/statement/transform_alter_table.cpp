@@ -92,6 +92,42 @@ unique_ptr<AlterStatement> Transformer::TransformAlter(duckdb_libpgquery::PGAlte
 			result->info = make_uniq<DropNotNullInfo>(std::move(data), command->name);
 			break;
 		}
+		case duckdb_libpgquery::PG_AT_SetRelOptions:
+		case duckdb_libpgquery::PG_AT_ResetRelOptions: {
+			if (stmt.relkind != duckdb_libpgquery::PG_OBJECT_TABLE) {
+				throw ParserException("Setting options is only supported for tables");
+			}
+			auto options = PGPointerCast<duckdb_libpgquery::PGList>(command->def);
+			if (options->length != 1) {
+				throw ParserException("Only one table option per ALTER TABLE statement is supported");
+			}
+			auto def_elem = PGPointerCast<duckdb_libpgquery::PGDefElem>(options->head->data.ptr_value);
+			if (!StringUtil::CIEquals(def_elem->defname, "cluster_by")) {
+				throw ParserException("Unrecognized table option \"%s\"", def_elem->defname);
+			}
+			vector<string> cluster_by;
+			if (command->subtype == duckdb_libpgquery::PG_AT_SetRelOptions) {
+				auto value = PGPointerCast<duckdb_libpgquery::PGValue>(def_elem->arg);
+				if (!value || value->type != duckdb_libpgquery::T_PGString) {
+					throw ParserException("Table option \"cluster_by\" expects a string with a list of columns, "
+					                      "e.g. SET (cluster_by='a, b')");
+				}
+				for (auto &column_name : StringUtil::Split(value->val.str, ',')) {
+					StringUtil::Trim(column_name);
+					if (column_name.empty()) {
+						throw ParserException("Table option \"cluster_by\" contains an empty column name");
+					}
+					cluster_by.push_back(column_name);
+				}
+				if (cluster_by.empty()) {
+					throw ParserException("Table option \"cluster_by\" requires at least one column");
+				}
+			} else if (def_elem->arg) {
+				throw ParserException("RESET does not accept a value for table option \"cluster_by\"");
+			}
+			result->info = make_uniq<SetClusterByInfo>(std::move(data), std::move(cluster_by));
+			break;
+		}
 		case duckdb_libpgquery::PG_AT_DropConstraint:
 		default:
 			throw NotImplementedException("No support for that ALTER TABLE option yet!");
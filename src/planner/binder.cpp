@@ -22,6 +22,7 @@
 #include "duckdb/planner/operator/logical_sample.hpp"
 #include "duckdb/planner/query_node/list.hpp"
 #include "duckdb/planner/tableref/list.hpp"
+#include "duckdb/storage/data_table.hpp"
 
 #include <algorithm>
 
@@ -249,6 +250,174 @@ static bool ParsedExpressionIsAggregate(Binder &binder, const ParsedExpression &
 	return is_aggregate;
 }
 
+//! A rough estimate of the cost of computing a query node and of the amount of rows it produces
+struct CTECostEstimate {
+	double cost = 0;
+	double cardinality = 0;
+	//! Whether the node only scans, filters and projects a single table - inlining such a node allows filters to be
+	//! pushed into the scan, which is nearly always cheaper than scanning a materialized result
+	bool is_simple_scan = true;
+};
+
+//! The cardinality that is assumed for table functions and tables whose size is unknown
+static constexpr double CTE_DEFAULT_CARDINALITY = 1000;
+//! The fraction of rows that is assumed to pass a WHERE or HAVING clause
+static constexpr double CTE_FILTER_SELECTIVITY = 0.2;
+//! The fraction of rows that is assumed to remain after grouping
+static constexpr double CTE_GROUP_SELECTIVITY = 0.1;
+
+static CTECostEstimate EstimateCTECost(Binder &binder, QueryNode &node);
+
+static void AddSubqueryCosts(Binder &binder, ParsedExpression &expr, CTECostEstimate &result) {
+	if (expr.type == ExpressionType::SUBQUERY) {
+		auto &subquery = expr.Cast<SubqueryExpression>();
+		auto subquery_cost = EstimateCTECost(binder, *subquery.subquery->node);
+		result.cost += subquery_cost.cost;
+		result.is_simple_scan = false;
+		return;
+	}
+	if (expr.GetExpressionClass() == ExpressionClass::WINDOW) {
+		// window functions have to sort or partition their input
+		result.cost += result.cardinality;
+		result.is_simple_scan = false;
+	}
+	ParsedExpressionIterator::EnumerateChildren(
+	    expr, [&](ParsedExpression &child) { AddSubqueryCosts(binder, child, result); });
+}
+
+static CTECostEstimate EstimateCTECost(Binder &binder, TableRef &ref) {
+	CTECostEstimate result;
+	switch (ref.type) {
+	case TableReferenceType::BASE_TABLE: {
+		auto &table_ref = ref.Cast<BaseTableRef>();
+		result.cardinality = CTE_DEFAULT_CARDINALITY;
+		try {
+			QueryErrorContext error_context;
+			auto entry = binder.GetCatalogEntry(CatalogType::TABLE_ENTRY, table_ref.catalog_name, table_ref.schema_name,
+			                                    table_ref.table_name, OnEntryNotFound::RETURN_NULL, error_context);
+			if (entry && entry->type == CatalogType::TABLE_ENTRY) {
+				auto &table = entry->Cast<TableCatalogEntry>();
+				if (table.IsDuckTable()) {
+					result.cardinality = static_cast<double>(table.GetStorage().GetTotalRows());
+				}
+			} else if (entry) {
+				// views are expanded when they are bound
+				result.is_simple_scan = false;
+			}
+		} catch (std::exception &ex) {
+			// the error is reported when the reference is bound
+		}
+		result.cost = result.cardinality;
+		break;
+	}
+	case TableReferenceType::SUBQUERY:
+		result = EstimateCTECost(binder, *ref.Cast<SubqueryRef>().subquery->node);
+		break;
+	case TableReferenceType::JOIN: {
+		auto &join = ref.Cast<JoinRef>();
+		auto left = EstimateCTECost(binder, *join.left);
+		auto right = EstimateCTECost(binder, *join.right);
+		result.cost = left.cost + right.cost;
+		if (join.ref_type == JoinRefType::CROSS || (!join.condition && join.using_columns.empty() &&
+		                                            join.ref_type != JoinRefType::NATURAL)) {
+			result.cardinality = left.cardinality * right.cardinality;
+		} else {
+			// building and probing a hash table
+			result.cost += left.cardinality + right.cardinality;
+			result.cardinality = MaxValue<double>(left.cardinality, right.cardinality);
+		}
+		result.cost += result.cardinality;
+		result.is_simple_scan = false;
+		break;
+	}
+	case TableReferenceType::EMPTY_FROM:
+		result.cardinality = 1;
+		break;
+	default:
+		result.cardinality = CTE_DEFAULT_CARDINALITY;
+		result.cost = result.cardinality;
+		result.is_simple_scan = false;
+		break;
+	}
+	return result;
+}
+
+static CTECostEstimate EstimateCTECost(Binder &binder, QueryNode &node) {
+	CTECostEstimate result;
+	switch (node.type) {
+	case QueryNodeType::SELECT_NODE: {
+		auto &select = node.Cast<SelectNode>();
+		result = EstimateCTECost(binder, *select.from_table);
+		if (select.where_clause) {
+			AddSubqueryCosts(binder, *select.where_clause, result);
+			result.cardinality *= CTE_FILTER_SELECTIVITY;
+		}
+		for (auto &expr : select.select_list) {
+			AddSubqueryCosts(binder, *expr, result);
+		}
+		if (!select.groups.group_expressions.empty() || !select.groups.grouping_sets.empty()) {
+			result.cost += result.cardinality;
+			result.cardinality *= CTE_GROUP_SELECTIVITY;
+			result.is_simple_scan = false;
+		}
+		if (select.having) {
+			AddSubqueryCosts(binder, *select.having, result);
+			result.cardinality *= CTE_FILTER_SELECTIVITY;
+			result.is_simple_scan = false;
+		}
+		break;
+	}
+	case QueryNodeType::SET_OPERATION_NODE: {
+		auto &setop = node.Cast<SetOperationNode>();
+		auto left = EstimateCTECost(binder, *setop.left);
+		auto right = EstimateCTECost(binder, *setop.right);
+		result.cost = left.cost + right.cost;
+		result.cardinality = left.cardinality + right.cardinality;
+		if (!setop.setop_all || setop.setop_type != SetOperationType::UNION) {
+			// eliminating duplicates, or computing the intersection or difference, requires a hash table
+			result.cost += result.cardinality;
+		}
+		result.is_simple_scan = false;
+		break;
+	}
+	default:
+		result.cardinality = CTE_DEFAULT_CARDINALITY;
+		result.cost = result.cardinality;
+		result.is_simple_scan = false;
+		break;
+	}
+	for (auto &modifier : node.modifiers) {
+		switch (modifier->type) {
+		case ResultModifierType::DISTINCT_MODIFIER:
+		case ResultModifierType::ORDER_MODIFIER:
+			result.cost += result.cardinality;
+			result.is_simple_scan = false;
+			break;
+		case ResultModifierType::LIMIT_MODIFIER:
+		case ResultModifierType::LIMIT_PERCENT_MODIFIER:
+			// filters cannot be pushed through a limit
+			result.is_simple_scan = false;
+			break;
+		default:
+			break;
+		}
+	}
+	return result;
+}
+
+//! Whether materializing a CTE that is referenced "ref_count" times is expected to be cheaper than inlining it
+static bool MaterializationIsCheaper(const CTECostEstimate &estimate, idx_t ref_count) {
+	if (estimate.is_simple_scan) {
+		return false;
+	}
+	auto references = static_cast<double>(ref_count);
+	// materializing computes the CTE once, writes its result and scans it for every reference
+	auto materialized_cost = estimate.cost + (references + 1) * estimate.cardinality;
+	// inlining computes the CTE for every reference
+	auto inlined_cost = references * estimate.cost;
+	return materialized_cost < inlined_cost;
+}
+
 bool Binder::OptimizeCTEs(QueryNode &node) {
 	D_ASSERT(context.config.enable_optimizer);
 
@@ -308,6 +477,10 @@ bool Binder::OptimizeCTEs(QueryNode &node) {
 			}
 			materialize |= ParsedExpressionIsAggregate(*this, *sel);
 		}
+		// or if computing it once is expected to be cheaper than computing it for every reference
+		if (!materialize) {
+			materialize = MaterializationIsCheaper(EstimateCTECost(*this, cte_node), cte_ref_counts_it->second);
+		}
 
 		if (materialize) {
 			cte.second->materialized = CTEMaterialize::CTE_MATERIALIZE_ALWAYS;
@@ -62,6 +62,7 @@ BoundStatement Binder::BindCopyTo(CopyStatement &stmt, CopyToType copy_to_type)
 	bool seen_overwrite_mode = false;
 	bool seen_filepattern = false;
 	bool write_partition_columns = false;
+	bool buffer_partitions = false;
 	CopyFunctionReturnType return_type = CopyFunctionReturnType::CHANGED_ROWS;
 
 	CopyFunctionBindInput bind_input(*stmt.info);
@@ -129,6 +130,8 @@ BoundStatement Binder::BindCopyTo(CopyStatement &stmt, CopyToType copy_to_type)
 			}
 		} else if (loption == "write_partition_columns") {
 			write_partition_columns = true;
+		} else if (loption == "buffer_partitions") {
+			buffer_partitions = GetBooleanArg(context, option.second);
 		} else {
 			stmt.info->options[option.first] = option.second;
 		}
@@ -148,8 +151,12 @@ BoundStatement Binder::BindCopyTo(CopyStatement &stmt, CopyToType copy_to_type)
 	if (per_thread_output && !partition_cols.empty()) {
 		throw NotImplementedException("Can't combine PER_THREAD_OUTPUT and PARTITION_BY for COPY");
 	}
+	if (buffer_partitions && partition_cols.empty()) {
+		throw BinderException("BUFFER_PARTITIONS can only be used in combination with PARTITION_BY");
+	}
 	if (file_size_bytes.IsValid() && !partition_cols.empty()) {
-		throw NotImplementedException("Can't combine FILE_SIZE_BYTES and PARTITION_BY for COPY");
+		// the files of a partition can only be rotated if the partition is written by a single writer
+		buffer_partitions = true;
 	}
 	if (!write_partition_columns) {
 		if (partition_cols.size() == select_node.names.size()) {
@@ -164,8 +171,10 @@ BoundStatement Binder::BindCopyTo(CopyStatement &stmt, CopyToType copy_to_type)
 		auto &fs = FileSystem::GetFileSystem(context);
 		bool is_file_and_exists = fs.FileExists(stmt.info->file_path);
 		bool is_stdout = stmt.info->file_path == "/dev/stdout";
+		// a shared memory stream is consumed while it is written, so it has to be written in place
+		bool is_stream = is_stdout || copy_function.function.name == "shared_memory";
 		if (!user_set_use_tmp_file) {
-			use_tmp_file = is_file_and_exists && !per_thread_output && partition_cols.empty() && !is_stdout;
+			use_tmp_file = is_file_and_exists && !per_thread_output && partition_cols.empty() && !is_stream;
 		}
 	}
 
@@ -223,9 +232,9 @@ BoundStatement Binder::BindCopyTo(CopyStatement &stmt, CopyToType copy_to_type)
 			throw NotImplementedException(
 			    "Can't combine USE_TMP_FILE and file rotation (e.g., ROW_GROUPS_PER_FILE) for COPY");
 		}
-		if (!partition_cols.empty()) {
-			throw NotImplementedException(
-			    "Can't combine file rotation (e.g., ROW_GROUPS_PER_FILE) and PARTITION_BY for COPY");
+		if (!partition_cols.empty() && !buffer_partitions) {
+			throw NotImplementedException("Can't combine file rotation (e.g., ROW_GROUPS_PER_FILE) and PARTITION_BY "
+			                              "for COPY without BUFFER_PARTITIONS");
 		}
 	}
 
@@ -243,6 +252,7 @@ BoundStatement Binder::BindCopyTo(CopyStatement &stmt, CopyToType copy_to_type)
 	copy->rotate = rotate;
 	copy->partition_output = !partition_cols.empty();
 	copy->write_partition_columns = write_partition_columns;
+	copy->buffer_partitions = buffer_partitions;
 	copy->partition_columns = std::move(partition_cols);
 	copy->return_type = return_type;
 
@@ -11,6 +11,8 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/planner/operator/logical_dummy_scan.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/expression_binder/where_binder.hpp"
@@ -461,6 +463,33 @@ void Binder::BindOnConflictClause(LogicalInsert &insert, TableCatalogEntry &tabl
 	}
 }
 
+//! Sorts the rows that are inserted into a clustered table on its cluster columns
+static unique_ptr<LogicalOperator> ClusterInsertedRows(TableCatalogEntry &table,
+                                                       const vector<LogicalIndex> &named_column_map,
+                                                       unique_ptr<LogicalOperator> root) {
+	root->ResolveOperatorTypes();
+	auto bindings = root->GetColumnBindings();
+	D_ASSERT(bindings.size() == named_column_map.size());
+	vector<BoundOrderByNode> orders;
+	for (auto cluster_column : table.GetClusterBy()) {
+		auto cluster_idx = table.GetColumnIndex(cluster_column, true);
+		for (idx_t col_idx = 0; col_idx < named_column_map.size(); col_idx++) {
+			if (named_column_map[col_idx] != cluster_idx) {
+				continue;
+			}
+			// columns that are not inserted get their default value, so there is nothing to sort on
+			auto colref = make_uniq<BoundColumnRefExpression>(root->types[col_idx], bindings[col_idx]);
+			orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST, std::move(colref));
+		}
+	}
+	if (orders.empty()) {
+		return root;
+	}
+	auto order = make_uniq<LogicalOrder>(std::move(orders));
+	order->AddChild(std::move(root));
+	return std::move(order);
+}
+
 BoundStatement Binder::Bind(InsertStatement &stmt) {
 	BoundStatement result;
 	result.names = {"Count"};
@@ -592,6 +621,9 @@ BoundStatement Binder::Bind(InsertStatement &stmt) {
 		                               table.name.c_str());
 
 		root = CastLogicalOperatorToTypes(root_select.types, insert->expected_types, std::move(root_select.plan));
+		if (!table.GetClusterBy().empty()) {
+			root = ClusterInsertedRows(table, named_column_map, std::move(root));
+		}
 	} else {
 		root = make_uniq<LogicalDummyScan>(GenerateTableIndex());
 	}
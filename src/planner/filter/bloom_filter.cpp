@@ -0,0 +1,43 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilter(shared_ptr<BlockedBloomFilter> filter_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), filter(std::move(filter_p)) {
+	D_ASSERT(filter);
+}
+
+idx_t BloomFilter::Filter(Vector &input, SelectionVector &sel, idx_t count) const {
+	return filter->Lookup(input, sel, count);
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	// the Bloom filter holds hashes - we cannot compare them against min/max statistics
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return "BLOOM_FILTER(" + column_name + ")";
+}
+
+unique_ptr<Expression> BloomFilter::ToExpression(const Expression &column) const {
+	// the Bloom filter can have false positives, so it is always correct to let every row pass
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.filter.get() == filter.get();
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	// the filter data is shared between copies
+	return make_uniq<BloomFilter>(filter);
+}
+
+} // namespace duckdb
@@ -0,0 +1,89 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+DynamicFilterData::DynamicFilterData(ExpressionType comparison_type_p) : comparison_type(comparison_type_p) {
+}
+
+void DynamicFilterData::SetValue(const Value &value) {
+	if (value.IsNull()) {
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	if (initialized) {
+		bool more_selective;
+		switch (comparison_type) {
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			more_selective = value < filter->constant;
+			break;
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			more_selective = value > filter->constant;
+			break;
+		default:
+			throw InternalException("Unsupported comparison type for DynamicFilter");
+		}
+		if (!more_selective) {
+			return;
+		}
+	}
+	filter = make_uniq<ConstantFilter>(comparison_type, value);
+	initialized = true;
+}
+
+void DynamicFilterData::Reset() {
+	lock_guard<mutex> guard(lock);
+	filter.reset();
+	initialized = false;
+}
+
+DynamicFilter::DynamicFilter() : TableFilter(TableFilterType::DYNAMIC_FILTER) {
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!filter_data) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	lock_guard<mutex> guard(filter_data->lock);
+	if (!filter_data->initialized) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return filter_data->filter->CheckStatistics(stats);
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	if (filter_data) {
+		lock_guard<mutex> guard(filter_data->lock);
+		if (filter_data->initialized) {
+			return "Dynamic Filter (" + filter_data->filter->ToString(column_name) + ")";
+		}
+	}
+	return "Dynamic Filter (" + column_name + ")";
+}
+
+unique_ptr<Expression> DynamicFilter::ToExpression(const Expression &column) const {
+	// the operator that sets the filter discards the rows anyway, so it is always correct to let every row pass
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data.get() == filter_data.get();
+}
+
+unique_ptr<TableFilter> DynamicFilter::Copy() const {
+	// the filter data is shared between copies
+	return make_uniq<DynamicFilter>(filter_data);
+}
+
+} // namespace duckdb
@@ -0,0 +1,157 @@
+#include "duckdb/planner/filter/in_filter.hpp"
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+InFilter::InFilter(vector<Value> values_p) : TableFilter(TableFilterType::IN_FILTER), values(std::move(values_p)) {
+	for (auto &value : values) {
+		if (value.IsNull()) {
+			throw InternalException("InFilter constant cannot be NULL - use IsNullFilter instead");
+		}
+	}
+	std::sort(values.begin(), values.end());
+	values.erase(std::unique(values.begin(), values.end()), values.end());
+}
+
+template <class T>
+static idx_t TemplatedInFilter(UnifiedVectorFormat &vdata, const vector<Value> &values, SelectionVector &sel,
+                               idx_t count) {
+	// the values are sorted, so we can binary search in the typed copy of them
+	vector<T> typed_values;
+	typed_values.reserve(values.size());
+	for (auto &value : values) {
+		typed_values.push_back(value.GetValueUnsafe<T>());
+	}
+	auto less_than = [](const T &a, const T &b) {
+		return LessThan::Operation<T>(a, b);
+	};
+
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	SelectionVector result_sel(count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = sel.get_index(i);
+		auto vector_idx = vdata.sel->get_index(idx);
+		if (!vdata.validity.RowIsValid(vector_idx)) {
+			continue;
+		}
+		auto &input = data[vector_idx];
+		auto entry = std::lower_bound(typed_values.begin(), typed_values.end(), input, less_than);
+		if (entry != typed_values.end() && Equals::Operation<T>(*entry, input)) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(result_sel);
+	return result_count;
+}
+
+idx_t InFilter::Filter(UnifiedVectorFormat &vdata, PhysicalType type, SelectionVector &sel, idx_t count) const {
+	switch (type) {
+	case PhysicalType::BOOL:
+		return TemplatedInFilter<bool>(vdata, values, sel, count);
+	case PhysicalType::UINT8:
+		return TemplatedInFilter<uint8_t>(vdata, values, sel, count);
+	case PhysicalType::UINT16:
+		return TemplatedInFilter<uint16_t>(vdata, values, sel, count);
+	case PhysicalType::UINT32:
+		return TemplatedInFilter<uint32_t>(vdata, values, sel, count);
+	case PhysicalType::UINT64:
+		return TemplatedInFilter<uint64_t>(vdata, values, sel, count);
+	case PhysicalType::UINT128:
+		return TemplatedInFilter<uhugeint_t>(vdata, values, sel, count);
+	case PhysicalType::INT8:
+		return TemplatedInFilter<int8_t>(vdata, values, sel, count);
+	case PhysicalType::INT16:
+		return TemplatedInFilter<int16_t>(vdata, values, sel, count);
+	case PhysicalType::INT32:
+		return TemplatedInFilter<int32_t>(vdata, values, sel, count);
+	case PhysicalType::INT64:
+		return TemplatedInFilter<int64_t>(vdata, values, sel, count);
+	case PhysicalType::INT128:
+		return TemplatedInFilter<hugeint_t>(vdata, values, sel, count);
+	case PhysicalType::FLOAT:
+		return TemplatedInFilter<float>(vdata, values, sel, count);
+	case PhysicalType::DOUBLE:
+		return TemplatedInFilter<double>(vdata, values, sel, count);
+	case PhysicalType::VARCHAR:
+		return TemplatedInFilter<string_t>(vdata, values, sel, count);
+	default:
+		throw InternalException("Unsupported type for InFilter: %s", TypeIdToString(type));
+	}
+}
+
+FilterPropagateResult InFilter::CheckStatistics(BaseStatistics &stats) {
+	auto result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	for (auto &value : values) {
+		FilterPropagateResult value_result;
+		switch (value.type().InternalType()) {
+		case PhysicalType::UINT8:
+		case PhysicalType::UINT16:
+		case PhysicalType::UINT32:
+		case PhysicalType::UINT64:
+		case PhysicalType::UINT128:
+		case PhysicalType::INT8:
+		case PhysicalType::INT16:
+		case PhysicalType::INT32:
+		case PhysicalType::INT64:
+		case PhysicalType::INT128:
+		case PhysicalType::FLOAT:
+		case PhysicalType::DOUBLE:
+			value_result = NumericStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, value);
+			break;
+		case PhysicalType::VARCHAR:
+			value_result = StringStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, StringValue::Get(value));
+			break;
+		default:
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		if (value_result == FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+			// all values in the segment are equal to this value
+			return FilterPropagateResult::FILTER_ALWAYS_TRUE;
+		}
+		if (value_result == FilterPropagateResult::NO_PRUNING_POSSIBLE) {
+			result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+	}
+	return result;
+}
+
+string InFilter::ToString(const string &column_name) {
+	string in_list;
+	for (auto &value : values) {
+		if (!in_list.empty()) {
+			in_list += ", ";
+		}
+		in_list += value.ToSQLString();
+	}
+	return column_name + " IN (" + in_list + ")";
+}
+
+unique_ptr<Expression> InFilter::ToExpression(const Expression &column) const {
+	auto result = make_uniq<BoundOperatorExpression>(ExpressionType::COMPARE_IN, LogicalType::BOOLEAN);
+	result->children.push_back(column.Copy());
+	for (auto &value : values) {
+		result->children.push_back(make_uniq<BoundConstantExpression>(value));
+	}
+	return std::move(result);
+}
+
+bool InFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<InFilter>();
+	return other.values == values;
+}
+
+unique_ptr<TableFilter> InFilter::Copy() const {
+	return make_uniq<InFilter>(values);
+}
+
+} // namespace duckdb
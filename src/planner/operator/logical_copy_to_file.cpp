@@ -66,6 +66,7 @@ void LogicalCopyToFile::Serialize(Serializer &serializer) const {
 	serializer.WriteProperty(214, "rotate", rotate);
 	serializer.WriteProperty(215, "return_type", return_type);
 	serializer.WriteProperty(216, "write_partition_columns", write_partition_columns);
+	serializer.WritePropertyWithDefault(217, "buffer_partitions", buffer_partitions, false);
 }
 
 unique_ptr<LogicalOperator> LogicalCopyToFile::Deserialize(Deserializer &deserializer) {
@@ -110,6 +111,7 @@ unique_ptr<LogicalOperator> LogicalCopyToFile::Deserialize(Deserializer &deseria
 	auto return_type =
 	    deserializer.ReadPropertyWithExplicitDefault(215, "return_type", CopyFunctionReturnType::CHANGED_ROWS);
 	auto write_partition_columns = deserializer.ReadProperty<bool>(216, "write_partition_columns");
+	auto buffer_partitions = deserializer.ReadPropertyWithExplicitDefault(217, "buffer_partitions", false);
 
 	if (!has_serialize) {
 		// If not serialized, re-bind with the copy info
@@ -137,6 +139,7 @@ unique_ptr<LogicalOperator> LogicalCopyToFile::Deserialize(Deserializer &deseria
 	result->rotate = rotate;
 	result->return_type = return_type;
 	result->write_partition_columns = write_partition_columns;
+	result->buffer_partitions = buffer_partitions;
 
 	return std::move(result);
 }
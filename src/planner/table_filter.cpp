@@ -4,9 +4,13 @@
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/execution/adaptive_filter.hpp"
 
 namespace duckdb {
 
+TableFilterSet::TableFilterSet() : statistics(make_shared_ptr<AdaptiveFilterStatistics>()) {
+}
+
 void TableFilterSet::PushFilter(idx_t column_index, unique_ptr<TableFilter> filter) {
 	auto entry = filters.find(column_index);
 	if (entry == filters.end()) {
@@ -66,7 +70,8 @@ DynamicTableFilterSet::GetFinalTableFilters(const PhysicalTableScan &scan,
 				// skip row id filters
 				continue;
 			}
-			result->filters[filter.first] = filter.second->Copy();
+			// multiple joins can push filters into the same column: combine them with the existing filters
+			result->PushFilter(filter.first, filter.second->Copy());
 		}
 	}
 	if (result->filters.empty()) {
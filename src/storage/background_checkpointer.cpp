@@ -0,0 +1,173 @@
+#include "duckdb/storage/background_checkpointer.hpp"
+
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/valid_checker.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
+
+namespace duckdb {
+
+//! How often the background thread wakes up to check whether it needs to checkpoint
+static constexpr const int64_t BACKGROUND_CHECKPOINT_POLL_MS = 100;
+
+BackgroundCheckpointer::BackgroundCheckpointer(AttachedDatabase &db)
+    : db(db), last_checkpoint_time(std::chrono::steady_clock::now()) {
+}
+
+BackgroundCheckpointer::~BackgroundCheckpointer() {
+	Stop();
+}
+
+bool BackgroundCheckpointer::Start() {
+#ifdef DUCKDB_NO_THREADS
+	return false;
+#else
+	lock_guard<mutex> guard(lock);
+	if (checkpoint_thread) {
+		return true;
+	}
+	if (shutdown || !db.GetTransactionManager().IsDuckTransactionManager()) {
+		return false;
+	}
+	checkpoint_thread = make_uniq<thread>([this]() { Run(); });
+	info.running = true;
+	return true;
+#endif
+}
+
+void BackgroundCheckpointer::Stop() {
+	unique_ptr<thread> to_join;
+	{
+		lock_guard<mutex> guard(lock);
+		shutdown = true;
+		to_join = std::move(checkpoint_thread);
+		info.running = false;
+	}
+	cv.notify_all();
+	if (to_join) {
+		to_join->join();
+	}
+}
+
+void BackgroundCheckpointer::NotifyCommit(bool threshold_reached) {
+	{
+		lock_guard<mutex> guard(lock);
+		pending_changes = true;
+		if (!threshold_reached || wal_threshold_reached) {
+			return;
+		}
+		wal_threshold_reached = true;
+	}
+	cv.notify_one();
+}
+
+bool BackgroundCheckpointer::NotifyCleanup() {
+	{
+		lock_guard<mutex> guard(lock);
+		if (!checkpoint_thread || shutdown) {
+			return false;
+		}
+		cleanup_requested = true;
+	}
+	cv.notify_one();
+	return true;
+}
+
+BackgroundCheckpointInfo BackgroundCheckpointer::GetInfo() {
+	lock_guard<mutex> guard(lock);
+	return info;
+}
+
+void BackgroundCheckpointer::SyncWAL(DuckTransactionManager &transaction_manager) {
+	try {
+		transaction_manager.SyncWAL();
+	} catch (std::exception &ex) {
+		// the commits are already visible, so they can no longer be reverted
+		ErrorData error(ex);
+		ValidChecker::Invalidate(db.GetDatabase(), "Failed to sync the WAL: " + error.RawMessage());
+		lock_guard<mutex> guard(lock);
+		info.failed_count++;
+		info.last_error = error.RawMessage();
+	}
+}
+
+void BackgroundCheckpointer::Run() {
+	auto &transaction_manager = DuckTransactionManager::Get(db);
+	unique_lock<mutex> guard(lock);
+	while (true) {
+		cv.wait_for(guard, std::chrono::milliseconds(BACKGROUND_CHECKPOINT_POLL_MS),
+		            [&] { return shutdown || wal_threshold_reached || cleanup_requested; });
+		if (cleanup_requested) {
+			cleanup_requested = false;
+			guard.unlock();
+			transaction_manager.CleanupTransactions();
+			guard.lock();
+		}
+		auto &config = DBConfig::Get(db);
+		if (!config.options.synchronous_commit || shutdown) {
+			// sync the commits that did not wait for the WAL to be synced
+			guard.unlock();
+			SyncWAL(transaction_manager);
+			guard.lock();
+		}
+		if (shutdown) {
+			return;
+		}
+		if (!config.options.background_checkpoint || !pending_changes) {
+			continue;
+		}
+		auto now = std::chrono::steady_clock::now();
+		string reason;
+		if (wal_threshold_reached) {
+			reason = "wal_size";
+		} else if (config.options.checkpoint_interval > 0 &&
+		           now - last_checkpoint_time >= std::chrono::seconds(config.options.checkpoint_interval)) {
+			reason = "interval";
+		} else {
+			continue;
+		}
+		// clear the flags before checkpointing: transactions that commit before the checkpoint starts set them again,
+		// which at worst leads to a redundant checkpoint
+		pending_changes = false;
+		wal_threshold_reached = false;
+		guard.unlock();
+
+		bool checkpointed = false;
+		ErrorData error;
+		try {
+			checkpointed = transaction_manager.TryBackgroundCheckpoint();
+		} catch (std::exception &ex) {
+			error = ErrorData(ex);
+		} catch (...) { // LCOV_EXCL_START
+			error = ErrorData("Unknown exception in background checkpoint");
+		} // LCOV_EXCL_STOP
+		auto end = std::chrono::steady_clock::now();
+
+		guard.lock();
+		if (error.HasError()) {
+			info.failed_count++;
+			info.last_error = error.RawMessage();
+			last_checkpoint_time = end;
+		} else if (checkpointed) {
+			info.checkpoint_count++;
+			info.last_reason = reason;
+			info.last_checkpoint = Timestamp::GetCurrentTimestamp();
+			info.last_duration_ms =
+			    NumericCast<idx_t>(std::chrono::duration_cast<std::chrono::milliseconds>(end - now).count());
+			last_checkpoint_time = end;
+		} else {
+			// other transactions are active: try again later
+			info.postponed_count++;
+			pending_changes = true;
+			if (reason == "wal_size") {
+				wal_threshold_reached = true;
+				// do not retry right away - give the active transactions a chance to finish
+				cv.wait_for(guard, std::chrono::milliseconds(BACKGROUND_CHECKPOINT_POLL_MS),
+				            [&] { return shutdown; });
+			}
+		}
+	}
+}
+
+} // namespace duckdb
@@ -17,4 +17,18 @@ Block::Block(FileBuffer &source, block_id_t id) : FileBuffer(source, FileBufferT
 	D_ASSERT((AllocSize() & (Storage::SECTOR_SIZE - 1)) == 0);
 }
 
+MappedBlock::MappedBlock(Allocator &allocator, block_id_t id, data_ptr_t mapped_data, idx_t alloc_size)
+    : Block(allocator, id, idx_t(0)) {
+	D_ASSERT((alloc_size & (Storage::SECTOR_SIZE - 1)) == 0);
+	internal_buffer = mapped_data;
+	internal_size = alloc_size;
+	buffer = internal_buffer + Storage::DEFAULT_BLOCK_HEADER_SIZE;
+	size = internal_size - Storage::DEFAULT_BLOCK_HEADER_SIZE;
+}
+
+MappedBlock::~MappedBlock() {
+	// the memory belongs to the mapping - do not free it
+	Init();
+}
+
 } // namespace duckdb
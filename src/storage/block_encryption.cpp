@@ -0,0 +1,126 @@
+#include "duckdb/storage/block_encryption.hpp"
+
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "mbedtls_wrapper.hpp"
+
+namespace duckdb {
+
+//! The size of the IVs that are passed to AES-GCM
+static constexpr idx_t GCM_IV_SIZE = 12;
+//! The size of the GCM tag that is used as the hash of a block
+static constexpr idx_t GCM_TAG_SIZE = 16;
+//! The size of the scratch space that receives the (unused) output of hashing a block
+static constexpr idx_t HASH_SCRATCH_SIZE = 4096;
+
+static string DeriveKey(const char *master_key, const string &label) {
+	char result[duckdb_mbedtls::MbedTlsWrapper::SHA256_HASH_LENGTH_BYTES];
+	duckdb_mbedtls::MbedTlsWrapper::Hmac256(master_key, duckdb_mbedtls::MbedTlsWrapper::SHA256_HASH_LENGTH_BYTES,
+	                                        label.c_str(), label.size(), result);
+	return string(result, BlockEncryption::KEY_SIZE);
+}
+
+BlockEncryption::BlockEncryption(shared_ptr<EncryptionUtil> encryption_util_p, const string &key,
+                                 const_data_ptr_t salt, idx_t kdf_iterations)
+    : encryption_util(std::move(encryption_util_p)) {
+	if (key.empty()) {
+		throw InvalidInputException("The encryption key cannot be empty");
+	}
+	// the master key is PBKDF2-HMAC-SHA256(key, salt): the key check stored in the file would otherwise allow a fast
+	// offline search for the key - every purpose gets its own key that is derived from the master key
+	char master_key[duckdb_mbedtls::MbedTlsWrapper::SHA256_HASH_LENGTH_BYTES];
+	duckdb_mbedtls::MbedTlsWrapper::Pbkdf2Hmac256(key.c_str(), key.size(), const_char_ptr_cast(salt), SALT_SIZE,
+	                                              kdf_iterations, master_key);
+	encryption_key = DeriveKey(master_key, "duckdb block encryption");
+	hash_key = DeriveKey(master_key, "duckdb block hash");
+	iv_key = DeriveKey(master_key, "duckdb block iv");
+	auto check = DeriveKey(master_key, "duckdb key check");
+	key_check = Load<uint64_t>(const_data_ptr_cast(check.c_str()));
+}
+
+shared_ptr<EncryptionUtil> BlockEncryption::GetEncryptionUtil(DatabaseInstance &db) {
+	auto &config = DBConfig::GetConfig(db);
+	if (config.encryption_util) {
+		return config.encryption_util;
+	}
+	return make_shared_ptr<duckdb_mbedtls::MbedTlsWrapper::AESGCMStateMBEDTLSFactory>();
+}
+
+void BlockEncryption::GenerateRandomData(DatabaseInstance &db, data_ptr_t data, idx_t size) {
+	auto state = GetEncryptionUtil(db)->CreateEncryptionState();
+	state->GenerateRandomData(data, size);
+}
+
+unique_ptr<BlockEncryption> BlockEncryption::CreateEphemeral(DatabaseInstance &db) {
+	data_t key[KEY_SIZE];
+	data_t salt[SALT_SIZE];
+	GenerateRandomData(db, key, KEY_SIZE);
+	GenerateRandomData(db, salt, SALT_SIZE);
+	// the key is random, so it does not need to be stretched
+	return make_uniq<BlockEncryption>(GetEncryptionUtil(db), string(const_char_ptr_cast(key), KEY_SIZE), salt, 1);
+}
+
+uint64_t BlockEncryption::ComputeSyntheticIV(const_data_ptr_t data, idx_t size, uint64_t location) const {
+	// hash the plaintext: this is the GCM tag of the data, using the location as the IV
+	data_t location_iv[GCM_IV_SIZE];
+	memset(location_iv, 0, GCM_IV_SIZE);
+	Store<uint64_t>(location, location_iv);
+	data_t scratch[HASH_SCRATCH_SIZE];
+	auto hash_state = encryption_util->CreateEncryptionState();
+	hash_state->InitializeEncryption(location_iv, GCM_IV_SIZE, &hash_key);
+	for (idx_t offset = 0; offset < size; offset += HASH_SCRATCH_SIZE) {
+		auto chunk_size = MinValue<idx_t>(size - offset, HASH_SCRATCH_SIZE);
+		hash_state->Process(data + offset, chunk_size, scratch, HASH_SCRATCH_SIZE);
+	}
+	data_t hash[GCM_TAG_SIZE];
+	hash_state->Finalize(scratch, HASH_SCRATCH_SIZE, hash, GCM_TAG_SIZE);
+
+	// the GCM tag is a polynomial hash, which must not be revealed: encrypt it with a separate key
+	// this is the AES encryption of the hash (used as the IV), so the synthetic IV does not leak the hash key
+	data_t zeros[sizeof(uint64_t)];
+	data_t synthetic_iv[sizeof(uint64_t)];
+	memset(zeros, 0, sizeof(uint64_t));
+	auto iv_state = encryption_util->CreateEncryptionState();
+	iv_state->InitializeEncryption(hash, GCM_IV_SIZE, &iv_key);
+	iv_state->Process(zeros, sizeof(uint64_t), synthetic_iv, sizeof(uint64_t));
+	return Load<uint64_t>(synthetic_iv);
+}
+
+void BlockEncryption::ApplyKeyStream(const_data_ptr_t source, data_ptr_t target, idx_t size, uint64_t location,
+                                     uint64_t synthetic_iv) const {
+	// the IV is the synthetic IV followed by the (folded) location of the block
+	data_t iv[GCM_IV_SIZE];
+	Store<uint64_t>(synthetic_iv, iv);
+	Store<uint32_t>(static_cast<uint32_t>(location ^ (location >> 32)), iv + sizeof(uint64_t));
+	// the authentication tag of GCM is not used, so encryption and decryption both apply the key stream
+	auto state = encryption_util->CreateEncryptionState();
+	state->InitializeEncryption(iv, GCM_IV_SIZE, &encryption_key);
+	state->Process(source, size, target, size);
+}
+
+uint64_t BlockEncryption::Encrypt(const_data_ptr_t source, data_ptr_t target, idx_t size, uint64_t location) const {
+	auto synthetic_iv = ComputeSyntheticIV(source, size, location);
+	ApplyKeyStream(source, target, size, location, synthetic_iv);
+	return synthetic_iv;
+}
+
+bool BlockEncryption::Decrypt(data_ptr_t data, idx_t size, uint64_t location, uint64_t synthetic_iv) const {
+	ApplyKeyStream(data, data, size, location, synthetic_iv);
+	return ComputeSyntheticIV(data, size, location) == synthetic_iv;
+}
+
+unique_ptr<FileBuffer> BlockEncryption::EncryptBuffer(Allocator &allocator, FileBuffer &buffer,
+                                                      uint64_t location) const {
+	auto result = make_uniq<FileBuffer>(allocator, FileBufferType::MANAGED_BUFFER, buffer.size);
+	D_ASSERT(result->AllocSize() == buffer.AllocSize());
+	auto synthetic_iv = Encrypt(buffer.buffer, result->buffer, buffer.size, location);
+	Store<uint64_t>(synthetic_iv, result->InternalBuffer());
+	return result;
+}
+
+bool BlockEncryption::DecryptBuffer(FileBuffer &buffer, uint64_t location) const {
+	auto synthetic_iv = Load<uint64_t>(buffer.InternalBuffer());
+	return Decrypt(buffer.buffer, buffer.size, location, synthetic_iv);
+}
+
+} // namespace duckdb
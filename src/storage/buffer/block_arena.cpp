@@ -0,0 +1,132 @@
+#include "duckdb/storage/buffer/block_arena.hpp"
+
+#include "duckdb/common/helper.hpp"
+
+#include <cstring>
+
+#if defined(__linux__) && !defined(DUCKDB_WASM)
+#include <sys/mman.h>
+#define DUCKDB_BLOCK_ARENA
+#endif
+
+namespace duckdb {
+
+//! Transparent huge pages are 2MB on all platforms we support them on
+static constexpr idx_t HUGE_PAGE_SIZE = 2097152ULL;
+
+BlockArena::BlockArena(idx_t block_alloc_size_p, idx_t arena_size, bool huge_pages, bool prefault)
+    : block_alloc_size(block_alloc_size_p), next_block(0) {
+#ifdef DUCKDB_BLOCK_ARENA
+	auto count = arena_size / block_alloc_size;
+	if (count == 0) {
+		return;
+	}
+	// over-reserve so that the blocks can start at a huge page boundary
+	auto size = AlignValue<idx_t, HUGE_PAGE_SIZE>(count * block_alloc_size) + HUGE_PAGE_SIZE;
+	auto memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (memory == MAP_FAILED) {
+		// the address space could not be reserved - fall back to the default allocator for all blocks
+		return;
+	}
+	reserved_memory = static_cast<data_ptr_t>(memory);
+	reserved_size = size;
+	auto offset = CastPointerToValue(reserved_memory) % HUGE_PAGE_SIZE;
+	blocks = offset == 0 ? reserved_memory : reserved_memory + (HUGE_PAGE_SIZE - offset);
+	block_count = count;
+#ifdef MADV_HUGEPAGE
+	if (huge_pages) {
+		// this is advice - the kernel might not have transparent huge pages enabled, so we ignore failures
+		madvise(blocks, AlignValue<idx_t, HUGE_PAGE_SIZE>(block_count * block_alloc_size), MADV_HUGEPAGE);
+	}
+#endif
+	if (prefault) {
+		// touch every page so that the kernel backs the whole arena right away
+		for (idx_t position = 0; position < block_count * block_alloc_size; position += 4096) {
+			blocks[position] = 0;
+		}
+	}
+#endif
+}
+
+BlockArena::~BlockArena() {
+#ifdef DUCKDB_BLOCK_ARENA
+	if (reserved_memory) {
+		munmap(reserved_memory, reserved_size);
+	}
+#endif
+}
+
+unique_ptr<Allocator> BlockArena::CreateAllocator(idx_t block_alloc_size, idx_t arena_size, bool huge_pages,
+                                                  bool prefault) {
+	return make_uniq<Allocator>(Allocate, Free, Reallocate,
+	                            make_uniq<BlockArena>(block_alloc_size, arena_size, huge_pages, prefault));
+}
+
+data_ptr_t BlockArena::AllocateBlock(idx_t size) {
+	if (size != block_alloc_size || block_count == 0) {
+		return nullptr;
+	}
+	{
+		lock_guard<mutex> guard(free_lock);
+		if (!free_blocks.empty()) {
+			auto result = free_blocks.back();
+			free_blocks.pop_back();
+			return result;
+		}
+	}
+	auto block_idx = next_block++;
+	if (block_idx >= block_count) {
+		// the arena is exhausted
+		next_block = block_count;
+		return nullptr;
+	}
+	return blocks + block_idx * block_alloc_size;
+}
+
+bool BlockArena::FreeBlock(data_ptr_t pointer) {
+	if (!Contains(pointer)) {
+		return false;
+	}
+	lock_guard<mutex> guard(free_lock);
+	free_blocks.push_back(pointer);
+	return true;
+}
+
+bool BlockArena::Contains(data_ptr_t pointer) const {
+	return block_count > 0 && pointer >= blocks && pointer < blocks + block_count * block_alloc_size;
+}
+
+data_ptr_t BlockArena::Allocate(PrivateAllocatorData *private_data, idx_t size) {
+	auto &arena = private_data->Cast<BlockArena>();
+	auto result = arena.AllocateBlock(size);
+	if (result) {
+		return result;
+	}
+	return Allocator::DefaultAllocate(private_data, size);
+}
+
+void BlockArena::Free(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t size) {
+	auto &arena = private_data->Cast<BlockArena>();
+	if (arena.FreeBlock(pointer)) {
+		return;
+	}
+	Allocator::DefaultFree(private_data, pointer, size);
+}
+
+data_ptr_t BlockArena::Reallocate(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t old_size,
+                                  idx_t size) {
+	auto &arena = private_data->Cast<BlockArena>();
+	if (!arena.Contains(pointer) && size != arena.block_alloc_size) {
+		return Allocator::DefaultReallocate(private_data, pointer, old_size, size);
+	}
+	if (old_size == size) {
+		return pointer;
+	}
+	// moving into or out of the arena
+	auto result = Allocate(private_data, size);
+	memcpy(result, pointer, MinValue<idx_t>(old_size, size));
+	Free(private_data, pointer, old_size);
+	return result;
+}
+
+} // namespace duckdb
@@ -3,8 +3,11 @@
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/io_profiler.hpp"
+#include "duckdb/common/numa.hpp"
 #include "duckdb/common/typedefs.hpp"
 #include "duckdb/parallel/concurrentqueue.hpp"
+#include "duckdb/parallel/execution_tracer.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
@@ -195,22 +198,25 @@ void EvictionQueue::PurgeIteration(const idx_t purge_size) {
 }
 
 BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps,
-                       idx_t allocator_bulk_deallocation_flush_threshold)
+                       idx_t allocator_bulk_deallocation_flush_threshold, BufferEvictionPolicy eviction_policy)
     : maximum_memory(maximum_memory),
       allocator_bulk_deallocation_flush_threshold(allocator_bulk_deallocation_flush_threshold),
-      track_eviction_timestamps(track_eviction_timestamps),
+      track_eviction_timestamps(track_eviction_timestamps), eviction_policy(eviction_policy),
       temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
-	queues.reserve(FILE_BUFFER_TYPE_COUNT);
-	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT; i++) {
+	// one queue per buffer type, plus the probation queue for blocks
+	queues.reserve(FILE_BUFFER_TYPE_COUNT + 1);
+	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT + 1; i++) {
 		queues.push_back(make_uniq<EvictionQueue>());
 	}
+	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
+		pin_hits[i] = 0;
+		pin_misses[i] = 0;
+	}
 }
 BufferPool::~BufferPool() {
 }
 
 bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
-	auto &queue = GetEvictionQueueForType(handle->buffer->type);
-
 	// The block handle is locked during this operation (Unpin),
 	// or the block handle is still a local variable (ConvertToPersistent)
 	D_ASSERT(handle->readers == 0);
@@ -224,10 +230,15 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
-		queue.IncrementDeadNodes();
+		GetEvictionQueueForBlockHandle(*handle).IncrementDeadNodes();
 	}
+	// with the two-queue policy, blocks that were used only once since they were loaded (e.g., by a sequential scan)
+	// are put on probation, and are only moved to the regular queue once they are used again
+	handle->in_probation_queue = !handle->reused_since_load && handle->buffer->type == FileBufferType::BLOCK &&
+	                             eviction_policy == BufferEvictionPolicy::TWO_QUEUE;
 
 	// Get the eviction queue for the buffer type and add it
+	auto &queue = GetEvictionQueueForBlockHandle(*handle);
 	return queue.AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ts));
 }
 
@@ -235,8 +246,15 @@ EvictionQueue &BufferPool::GetEvictionQueueForType(FileBufferType type) {
 	return *queues[uint8_t(type) - 1];
 }
 
-void BufferPool::IncrementDeadNodes(FileBufferType type) {
-	GetEvictionQueueForType(type).IncrementDeadNodes();
+EvictionQueue &BufferPool::GetEvictionQueueForBlockHandle(const BlockHandle &handle) {
+	if (handle.in_probation_queue) {
+		return *queues[FILE_BUFFER_TYPE_COUNT];
+	}
+	return GetEvictionQueueForType(handle.buffer->type);
+}
+
+void BufferPool::IncrementDeadNodes(const BlockHandle &handle) {
+	GetEvictionQueueForBlockHandle(handle).IncrementDeadNodes();
 }
 
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
@@ -259,9 +277,38 @@ TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
 	return *temporary_memory_manager;
 }
 
+void BufferPool::SetEvictionPolicy(BufferEvictionPolicy policy) {
+	eviction_policy = policy;
+}
+
+BufferEvictionPolicy BufferPool::GetEvictionPolicy() const {
+	return eviction_policy;
+}
+
+void BufferPool::RecordPin(MemoryTag tag, bool hit) {
+	auto &counter = hit ? pin_hits[static_cast<idx_t>(tag)] : pin_misses[static_cast<idx_t>(tag)];
+	counter.fetch_add(1, std::memory_order_relaxed);
+	IOProfiler::RecordBufferPin(hit);
+}
+
+idx_t BufferPool::GetPinHits(MemoryTag tag) const {
+	return pin_hits[static_cast<idx_t>(tag)].load(std::memory_order_relaxed);
+}
+
+idx_t BufferPool::GetPinMisses(MemoryTag tag) const {
+	return pin_misses[static_cast<idx_t>(tag)].load(std::memory_order_relaxed);
+}
+
 BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
                                                    unique_ptr<FileBuffer> *buffer) {
-	// First, we try to evict persistent table data
+	// First, we try to evict persistent table data that is on probation, i.e., that was only used once
+	auto probation_result =
+	    EvictBlocksInternal(*queues[FILE_BUFFER_TYPE_COUNT], tag, extra_memory, memory_limit, buffer);
+	if (probation_result.success) {
+		return probation_result;
+	}
+
+	// Then, we try to evict the remaining persistent table data
 	auto block_result =
 	    EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::BLOCK), tag, extra_memory, memory_limit, buffer);
 	if (block_result.success) {
@@ -292,9 +339,19 @@ BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue,
 		return {true, std::move(r)};
 	}
 
+	// only re-use memory that was allocated on the node of this thread, otherwise the block that is loaded into it
+	// is accessed remotely for as long as it stays in memory
+	auto current_node = buffer ? NumaTopology::GetCurrentNode() : 0;
+	// evictions that happen while executing a traced query are recorded in its execution trace
+	auto tracer = ExecutionTracer::GetActive();
+	auto trace_start = tracer ? tracer->Now() : 0;
+	int64_t evicted_blocks = 0;
+	int64_t evicted_bytes = 0;
 	queue.IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
 		// hooray, we can unload the block
-		if (buffer && handle->buffer->AllocSize() == extra_memory) {
+		evicted_blocks++;
+		evicted_bytes += NumericCast<int64_t>(handle->buffer->AllocSize());
+		if (buffer && handle->buffer->AllocSize() == extra_memory && handle->buffer->numa_node == current_node) {
 			// we can re-use the memory directly
 			*buffer = handle->UnloadAndTakeBlock();
 			found = true;
@@ -318,6 +375,10 @@ BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue,
 	} else if (Allocator::SupportsFlush() && extra_memory > allocator_bulk_deallocation_flush_threshold) {
 		Allocator::FlushAll();
 	}
+	if (tracer && evicted_blocks > 0) {
+		tracer->AddEvent("evict blocks", "buffer_manager", trace_start, tracer->Now(), nullptr,
+		                 {{"blocks", evicted_blocks}, {"bytes", evicted_bytes}});
+	}
 
 	return {found, std::move(r)};
 }
@@ -383,6 +444,9 @@ void EvictionQueue::IterateUnloadableBlocks(FN fn) {
 
 void BufferPool::PurgeQueue(FileBufferType type) {
 	GetEvictionQueueForType(type).Purge();
+	if (type == FileBufferType::BLOCK) {
+		queues[FILE_BUFFER_TYPE_COUNT]->Purge();
+	}
 }
 
 void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
@@ -1,12 +1,14 @@
 #include "duckdb/storage/buffer/block_handle.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
+#include "duckdb/storage/buffer/client_memory_tracker.hpp"
 
 namespace duckdb {
 
 BufferPoolReservation::BufferPoolReservation(MemoryTag tag, BufferPool &pool) : tag(tag), pool(pool) {
 }
 
-BufferPoolReservation::BufferPoolReservation(BufferPoolReservation &&src) noexcept : tag(src.tag), pool(src.pool) {
+BufferPoolReservation::BufferPoolReservation(BufferPoolReservation &&src) noexcept
+    : tag(src.tag), pool(src.pool), tracker(std::move(src.tracker)) {
 	size = src.size;
 	src.size = 0;
 }
@@ -14,6 +16,7 @@ BufferPoolReservation::BufferPoolReservation(BufferPoolReservation &&src) noexce
 BufferPoolReservation &BufferPoolReservation::operator=(BufferPoolReservation &&src) noexcept {
 	tag = src.tag;
 	size = src.size;
+	tracker = std::move(src.tracker);
 	src.size = 0;
 	return *this;
 }
@@ -24,11 +27,37 @@ BufferPoolReservation::~BufferPoolReservation() {
 
 void BufferPoolReservation::Resize(idx_t new_size) {
 	auto delta = UnsafeNumericCast<int64_t>(new_size) - UnsafeNumericCast<int64_t>(size);
+	if (delta > 0) {
+		if (!tracker && ClientMemoryTracker::IsTracked(tag)) {
+			// charge the reservation to the client on whose behalf it is made
+			auto active_tracker = ClientMemoryTracker::GetActive();
+			if (active_tracker) {
+				tracker = active_tracker->shared_from_this();
+			}
+		}
+		if (tracker) {
+			// this throws if the client exceeds its memory limit - before the buffer pool is updated
+			tracker->Charge(tag, UnsafeNumericCast<idx_t>(delta));
+		}
+	} else if (delta < 0 && tracker) {
+		tracker->Release(tag, UnsafeNumericCast<idx_t>(-delta));
+	}
 	pool.UpdateUsedMemory(tag, delta);
 	size = new_size;
 }
 
 void BufferPoolReservation::Merge(BufferPoolReservation src) {
+	if (src.tracker) {
+		// move the charge of the merged reservation over to the client of this reservation
+		src.tracker->Release(src.tag, src.size);
+		if (!tracker && ClientMemoryTracker::IsTracked(tag)) {
+			tracker = src.tracker;
+			tracker->ForceCharge(tag, size);
+		}
+	}
+	if (tracker) {
+		tracker->ForceCharge(tag, src.size);
+	}
 	size += src.size;
 	src.size = 0;
 }
@@ -0,0 +1,133 @@
+#include "duckdb/storage/buffer/client_memory_tracker.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+
+namespace duckdb {
+
+//! The tracker that reservations made by the current thread are charged to
+static thread_local ClientMemoryTracker *active_tracker = nullptr;
+
+ClientMemoryTracker::ClientMemoryTracker()
+    : session_memory(0), query_start_memory(0), query_peak_memory(0), query_limit(DConstants::INVALID_INDEX),
+      session_limit(DConstants::INVALID_INDEX) {
+	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
+		tag_memory[i] = 0;
+	}
+}
+
+void ClientMemoryTracker::BeginQuery(idx_t query_limit_p, idx_t session_limit_p) {
+	query_limit = query_limit_p;
+	session_limit = session_limit_p;
+	query_start_memory = session_memory.load();
+	query_peak_memory = 0;
+}
+
+void ClientMemoryTracker::Charge(MemoryTag tag, idx_t size) {
+	auto new_session_memory = session_memory.fetch_add(size) + size;
+	auto new_query_memory = GetQueryMemory(new_session_memory);
+	auto current_query_limit = query_limit.load();
+	auto current_session_limit = session_limit.load();
+	if (new_query_memory > current_query_limit) {
+		session_memory -= size;
+		throw OutOfMemoryException(
+		    "could not reserve %s of memory: the query would use %s, which exceeds the query memory limit of %s\nThe "
+		    "limit can be raised with SET query_memory_limit='...'",
+		    StringUtil::BytesToHumanReadableString(size), StringUtil::BytesToHumanReadableString(new_query_memory),
+		    StringUtil::BytesToHumanReadableString(current_query_limit));
+	}
+	if (new_session_memory > current_session_limit) {
+		session_memory -= size;
+		throw OutOfMemoryException(
+		    "could not reserve %s of memory: the connection would use %s, which exceeds the session memory limit of "
+		    "%s\nThe limit can be raised with SET session_memory_limit='...'",
+		    StringUtil::BytesToHumanReadableString(size), StringUtil::BytesToHumanReadableString(new_session_memory),
+		    StringUtil::BytesToHumanReadableString(current_session_limit));
+	}
+	tag_memory[static_cast<uint8_t>(tag)] += size;
+	auto peak = query_peak_memory.load();
+	while (new_query_memory > peak && !query_peak_memory.compare_exchange_weak(peak, new_query_memory)) {
+	}
+}
+
+void ClientMemoryTracker::ForceCharge(MemoryTag tag, idx_t size) {
+	session_memory += size;
+	tag_memory[static_cast<uint8_t>(tag)] += size;
+}
+
+void ClientMemoryTracker::Release(MemoryTag tag, idx_t size) {
+	D_ASSERT(session_memory >= size);
+	session_memory -= size;
+	tag_memory[static_cast<uint8_t>(tag)] -= size;
+}
+
+idx_t ClientMemoryTracker::GetSessionMemory() const {
+	return session_memory.load();
+}
+
+idx_t ClientMemoryTracker::GetSessionMemory(MemoryTag tag) const {
+	return tag_memory[static_cast<uint8_t>(tag)].load();
+}
+
+idx_t ClientMemoryTracker::GetQueryMemory(idx_t current_session_memory) const {
+	// memory that was charged before the query started might be released during the query
+	auto start_memory = query_start_memory.load();
+	return current_session_memory > start_memory ? current_session_memory - start_memory : 0;
+}
+
+idx_t ClientMemoryTracker::GetQueryMemory() const {
+	return GetQueryMemory(session_memory.load());
+}
+
+idx_t ClientMemoryTracker::GetQueryPeakMemory() const {
+	return query_peak_memory.load();
+}
+
+optional_idx ClientMemoryTracker::GetRemainingQueryMemory() const {
+	auto current_session_memory = session_memory.load();
+	auto current_query_memory = GetQueryMemory(current_session_memory);
+	auto current_query_limit = query_limit.load();
+	auto current_session_limit = session_limit.load();
+	optional_idx result;
+	if (current_query_limit != DConstants::INVALID_INDEX) {
+		result = current_query_limit > current_query_memory ? current_query_limit - current_query_memory : 0;
+	}
+	if (current_session_limit != DConstants::INVALID_INDEX) {
+		auto remaining =
+		    current_session_limit > current_session_memory ? current_session_limit - current_session_memory : 0;
+		result = result.IsValid() ? MinValue(result.GetIndex(), remaining) : remaining;
+	}
+	return result;
+}
+
+bool ClientMemoryTracker::IsTracked(MemoryTag tag) {
+	switch (tag) {
+	case MemoryTag::HASH_TABLE:
+	case MemoryTag::PARQUET_READER:
+	case MemoryTag::CSV_READER:
+	case MemoryTag::ORDER_BY:
+	case MemoryTag::COLUMN_DATA:
+	case MemoryTag::EXTENSION:
+		return true;
+	case MemoryTag::ALLOCATOR:
+		// the buffer allocator frees its memory without knowing the client that allocated it, so it can not release
+		// the charge again
+		return false;
+	default:
+		return false;
+	}
+}
+
+optional_ptr<ClientMemoryTracker> ClientMemoryTracker::GetActive() {
+	return active_tracker;
+}
+
+ClientMemoryTracker::ActiveScope::ActiveScope(optional_ptr<ClientMemoryTracker> tracker) : previous(active_tracker) {
+	active_tracker = tracker.get();
+}
+
+ClientMemoryTracker::ActiveScope::~ActiveScope() {
+	active_tracker = previous.get();
+}
+
+} // namespace duckdb
@@ -4,6 +4,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
+#include "duckdb/storage/buffer/client_memory_tracker.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
 
 namespace duckdb {
@@ -61,7 +62,16 @@ bool BufferManager::HasTemporaryDirectory() const {
 
 //! Returns the maximum available memory for a given query
 idx_t BufferManager::GetQueryMaxMemory() const {
-	return GetBufferPool().GetQueryMaxMemory();
+	auto query_max_memory = GetBufferPool().GetQueryMaxMemory();
+	// the query can not use more than the client it runs for has left
+	auto tracker = ClientMemoryTracker::GetActive();
+	if (tracker) {
+		auto remaining_memory = tracker->GetRemainingQueryMemory();
+		if (remaining_memory.IsValid()) {
+			query_max_memory = MinValue(query_max_memory, tracker->GetQueryMemory() + remaining_memory.GetIndex());
+		}
+	}
+	return query_max_memory;
 }
 
 unique_ptr<FileBuffer> BufferManager::ConstructManagedBuffer(idx_t size, unique_ptr<FileBuffer> &&,
@@ -28,6 +28,7 @@
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/storage/table/persistent_table_data.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 
@@ -571,6 +572,15 @@ void CheckpointReader::ReadTableData(CatalogTransaction transaction, Deserialize
 		}
 	}
 
+	if (total_rows > 0) {
+		// the table statistics and row group pointers are only read when the table is first accessed
+		// this keeps opening databases with many tables fast
+		bound_info.data = make_uniq<PersistentTableData>(bound_info.Base().columns.LogicalColumnCount());
+		bound_info.data->table_pointer = table_pointer;
+		bound_info.data->total_rows = total_rows;
+		return;
+	}
+
 	// FIXME: icky downcast to get the underlying MetadataReader
 	auto &binary_deserializer = dynamic_cast<BinaryDeserializer &>(deserializer);
 	auto &reader = dynamic_cast<MetadataReader &>(binary_deserializer.GetStream());
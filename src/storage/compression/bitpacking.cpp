@@ -9,8 +9,10 @@
 #include "duckdb/function/compression/compression.hpp"
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/compression/bitpacking.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -20,6 +22,11 @@
 namespace duckdb {
 
 static constexpr const idx_t BITPACKING_METADATA_GROUP_SIZE = STANDARD_VECTOR_SIZE > 512 ? STANDARD_VECTOR_SIZE : 2048;
+//! The storage (serialization) version that introduced FOR_INTERLEAVED groups
+static constexpr const idx_t BITPACKING_INTERLEAVED_SERIALIZATION_VERSION = 4;
+
+static_assert(BITPACKING_METADATA_GROUP_SIZE % BitpackingPrimitives::INTERLEAVED_BLOCK_SIZE == 0,
+              "metadata groups must consist of whole interleaved blocks");
 
 BitpackingMode BitpackingModeFromString(const string &str) {
 	auto mode = StringUtil::Lower(str);
@@ -33,6 +40,8 @@ BitpackingMode BitpackingModeFromString(const string &str) {
 		return BitpackingMode::DELTA_FOR;
 	} else if (mode == "for") {
 		return BitpackingMode::FOR;
+	} else if (mode == "for_interleaved") {
+		return BitpackingMode::FOR_INTERLEAVED;
 	} else {
 		return BitpackingMode::INVALID;
 	}
@@ -50,6 +59,8 @@ string BitpackingModeToString(const BitpackingMode &mode) {
 		return "delta_for";
 	case BitpackingMode::FOR:
 		return "for";
+	case BitpackingMode::FOR_INTERLEAVED:
+		return "for_interleaved";
 	default:
 		throw NotImplementedException("Unknown bitpacking mode: " + to_string((uint8_t)mode) + "\n");
 	}
@@ -91,8 +102,22 @@ struct EmptyBitpackingWriter {
 	static void WriteFor(T *values, bool *validity, bitpacking_width_t width, T frame_of_reference, idx_t count,
 	                     void *data_ptr) {
 	}
+	template <class T>
+	static void WriteForInterleaved(T *values, bool *validity, bitpacking_width_t width, T frame_of_reference,
+	                                idx_t count, void *data_ptr) {
+	}
 };
 
+//! Whether FOR groups of type T are written in the interleaved layout
+template <class T>
+static bool UseInterleavedLayout(const DBConfig &config) {
+	if (!NumericLimits<T>::IsIntegral() || sizeof(T) > sizeof(uint64_t)) {
+		return false;
+	}
+	// older versions can not read interleaved groups
+	return config.options.serialization_compatibility.Compare(BITPACKING_INTERLEAVED_SERIALIZATION_VERSION);
+}
+
 template <class T, class T_S = typename MakeSigned<T>::type>
 struct BitpackingState {
 public:
@@ -129,6 +154,8 @@ public:
 
 	// Used to force a specific mode, useful in testing
 	BitpackingMode mode = BitpackingMode::AUTO;
+	// Whether FOR groups are written in the interleaved layout
+	bool interleaved = false;
 
 public:
 	void Reset() {
@@ -242,7 +269,8 @@ public:
 		CalculateDeltaStats();
 
 		if (can_do_delta) {
-			if (maximum_delta == minimum_delta && mode != BitpackingMode::FOR && mode != BitpackingMode::DELTA_FOR) {
+			if (maximum_delta == minimum_delta && mode != BitpackingMode::FOR &&
+			    mode != BitpackingMode::FOR_INTERLEAVED && mode != BitpackingMode::DELTA_FOR) {
 				// FOR needs to be T (considering hugeint is bigger than idx_t)
 				T frame_of_reference = compression_buffer[0];
 
@@ -257,7 +285,8 @@ public:
 			    BitpackingPrimitives::MinimumBitWidth<T, false>(static_cast<T>(min_max_delta_diff));
 			auto regular_required_bitwidth = BitpackingPrimitives::MinimumBitWidth(min_max_diff);
 
-			if (delta_required_bitwidth < regular_required_bitwidth && mode != BitpackingMode::FOR) {
+			if (delta_required_bitwidth < regular_required_bitwidth && mode != BitpackingMode::FOR &&
+			    mode != BitpackingMode::FOR_INTERLEAVED) {
 				SubtractFrameOfReference(delta_buffer, minimum_delta);
 
 				OP::WriteDeltaFor(reinterpret_cast<T *>(delta_buffer), compression_buffer_validity,
@@ -276,6 +305,16 @@ public:
 		if (can_do_for) {
 			auto width = BitpackingPrimitives::MinimumBitWidth<T, false>(min_max_diff);
 			SubtractFrameOfReference(compression_buffer, minimum);
+			if (interleaved && mode != BitpackingMode::FOR) {
+				OP::WriteForInterleaved(compression_buffer, compression_buffer_validity, width, minimum,
+				                        compression_buffer_idx, data_ptr);
+
+				total_size += BitpackingPrimitives::GetRequiredInterleavedSize(compression_buffer_idx, width);
+				total_size += sizeof(T); // FOR value
+				total_size += AlignValue(sizeof(bitpacking_width_t));
+
+				return true;
+			}
 			OP::WriteFor(compression_buffer, compression_buffer_validity, width, minimum, compression_buffer_idx,
 			             data_ptr);
 
@@ -328,6 +367,7 @@ unique_ptr<AnalyzeState> BitpackingInitAnalyze(ColumnData &col_data, PhysicalTyp
 	CompressionInfo info(col_data.GetBlockManager().GetBlockSize());
 	auto state = make_uniq<BitpackingAnalyzeState<T>>(info);
 	state->state.mode = config.options.force_bitpacking_mode;
+	state->state.interleaved = UseInterleavedLayout<T>(config);
 
 	return std::move(state);
 }
@@ -382,6 +422,7 @@ public:
 
 		auto &config = DBConfig::GetConfig(checkpointer.GetDatabase());
 		state.mode = config.options.force_bitpacking_mode;
+		state.interleaved = UseInterleavedLayout<T>(config);
 	}
 
 	ColumnDataCheckpointer &checkpointer;
@@ -454,6 +495,31 @@ public:
 			UpdateStats(state, count);
 		}
 
+		static void WriteForInterleaved(T *values, bool *validity, bitpacking_width_t width, T frame_of_reference,
+		                                idx_t count, void *data_ptr) {
+			auto state = reinterpret_cast<BitpackingCompressState<T, WRITE_STATISTICS> *>(data_ptr);
+
+			auto bp_size = BitpackingPrimitives::GetRequiredInterleavedSize(count, width);
+			// reserve space for aligning the group, the packed values are read as T
+			ReserveSpace(state, bp_size + 2 * sizeof(T) + sizeof(uint64_t));
+			state->AlignDataPointer();
+
+			WriteMetaData(state, BitpackingMode::FOR_INTERLEAVED);
+			WriteData(state->data_ptr, frame_of_reference);
+			WriteData(state->data_ptr, (T)width);
+
+			// pad the last block with zeros
+			auto padded_count = AlignValue<idx_t, BitpackingPrimitives::INTERLEAVED_BLOCK_SIZE>(count);
+			D_ASSERT(padded_count <= BITPACKING_METADATA_GROUP_SIZE);
+			std::fill(values + count, values + padded_count, T(0));
+			for (idx_t i = 0; i < padded_count; i += BitpackingPrimitives::INTERLEAVED_BLOCK_SIZE) {
+				BitpackingPrimitives::PackInterleaved<T>(state->data_ptr + i * width / 8, values + i, width);
+			}
+			state->data_ptr += bp_size;
+
+			UpdateStats(state, count);
+		}
+
 		template <class T_OUT>
 		static void WriteData(data_ptr_t &ptr, T_OUT val) {
 			*reinterpret_cast<T_OUT *>(ptr) = val;
@@ -506,6 +572,13 @@ public:
 		metadata_ptr = handle.Ptr() + info.GetBlockSize();
 	}
 
+	void AlignDataPointer() {
+		auto offset = NumericCast<idx_t>(data_ptr - handle.Ptr());
+		auto aligned_offset = AlignValue(offset);
+		memset(data_ptr, 0, aligned_offset - offset);
+		data_ptr = handle.Ptr() + aligned_offset;
+	}
+
 	void Append(UnifiedVectorFormat &vdata, idx_t count) {
 		auto data = UnifiedVectorFormat::GetData<T>(vdata);
 
@@ -653,6 +726,9 @@ public:
 	data_ptr_t current_group_ptr;
 	data_ptr_t bitpacking_metadata_ptr;
 
+	//! The interleaved block of the current group that is unpacked in the decompression buffer
+	idx_t unpacked_block = DConstants::INVALID_INDEX;
+
 public:
 	//! Loads the metadata for the current metadata group. This will set bitpacking_metadata_ptr to the next group.
 	//! It also loads any metadata at the start of a compressed buffer (e.g. the width, for, or constant value)
@@ -662,6 +738,7 @@ public:
 		         bitpacking_metadata_ptr < handle.Ptr() + current_segment.GetBlockManager().GetBlockSize());
 		current_group_offset = 0;
 		current_group = DecodeMeta(reinterpret_cast<bitpacking_metadata_encoded_t *>(bitpacking_metadata_ptr));
+		unpacked_block = DConstants::INVALID_INDEX;
 
 		bitpacking_metadata_ptr -= sizeof(bitpacking_metadata_encoded_t);
 		current_group_ptr = GetPtr(current_group);
@@ -673,6 +750,7 @@ public:
 			current_group_ptr += sizeof(T);
 			break;
 		case BitpackingMode::FOR:
+		case BitpackingMode::FOR_INTERLEAVED:
 		case BitpackingMode::CONSTANT_DELTA:
 		case BitpackingMode::DELTA_FOR:
 			current_frame_of_reference = *reinterpret_cast<T *>(current_group_ptr);
@@ -689,6 +767,7 @@ public:
 			current_group_ptr += sizeof(T);
 			break;
 		case BitpackingMode::FOR:
+		case BitpackingMode::FOR_INTERLEAVED:
 		case BitpackingMode::DELTA_FOR:
 			current_width = (bitpacking_width_t)(*reinterpret_cast<T *>(current_group_ptr));
 			current_group_ptr += MaxValue(sizeof(T), sizeof(bitpacking_width_t));
@@ -730,7 +809,7 @@ public:
 		D_ASSERT(current_group_offset + remaining_to_skip < BITPACKING_METADATA_GROUP_SIZE);
 
 		if (current_group.mode == BitpackingMode::CONSTANT || current_group.mode == BitpackingMode::CONSTANT_DELTA ||
-		    current_group.mode == BitpackingMode::FOR) {
+		    current_group.mode == BitpackingMode::FOR || current_group.mode == BitpackingMode::FOR_INTERLEAVED) {
 			// Skipping within a constant or constant delta is done by increasing the current_group_offset
 			skipped += remaining_to_skip;
 			current_group_offset += remaining_to_skip;
@@ -771,6 +850,61 @@ public:
 		D_ASSERT(skipped == skip_count);
 	}
 
+	//! Computes bounds of the next "count" values of the current group from its metadata, without unpacking them.
+	//! Returns false if the values can not be bounded (i.e. for DELTA_FOR groups, or FOR groups that use all bits).
+	bool GetBounds(idx_t count, T &min_value, T &max_value) {
+		using T_U = typename MakeUnsigned<T>::type;
+		D_ASSERT(count > 0 && current_group_offset + count <= BITPACKING_METADATA_GROUP_SIZE);
+		switch (current_group.mode) {
+		case BitpackingMode::CONSTANT:
+			min_value = current_constant;
+			max_value = current_constant;
+			return true;
+		case BitpackingMode::CONSTANT_DELTA: {
+			// the values are an arithmetic sequence, so the bounds are its first and last value
+			auto first = static_cast<T>((static_cast<T_U>(current_constant) * current_group_offset) +
+			                            static_cast<T_U>(current_frame_of_reference));
+			auto last = static_cast<T>((static_cast<T_U>(current_constant) * (current_group_offset + count - 1)) +
+			                           static_cast<T_U>(current_frame_of_reference));
+			min_value = MinValue(first, last);
+			max_value = MaxValue(first, last);
+			return true;
+		}
+		case BitpackingMode::FOR:
+		case BitpackingMode::FOR_INTERLEAVED: {
+			// the values are [for, for + 2^width - 1]
+			if (current_width >= sizeof(T) * 8) {
+				return false;
+			}
+			auto range = static_cast<T_U>((static_cast<uint64_t>(1) << current_width) - 1);
+			auto headroom = static_cast<T_U>(static_cast<T_U>(NumericLimits<T>::Maximum()) -
+			                                 static_cast<T_U>(current_frame_of_reference));
+			min_value = current_frame_of_reference;
+			max_value = range >= headroom
+			                ? NumericLimits<T>::Maximum()
+			                : static_cast<T>(static_cast<T_U>(current_frame_of_reference) + range);
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+	//! Returns the packed values of the interleaved block of the current group with the given index
+	data_ptr_t GetInterleavedBlockPtr(idx_t block_idx) {
+		return current_group_ptr + block_idx * BitpackingPrimitives::INTERLEAVED_BLOCK_SIZE * current_width / 8;
+	}
+
+	//! Unpacks an interleaved block of the current group into the decompression buffer, if it is not unpacked yet
+	void UnPackInterleavedBlock(idx_t block_idx) {
+		if (unpacked_block == block_idx) {
+			return;
+		}
+		BitpackingPrimitives::UnPackInterleaved<T>(data_ptr_cast(decompression_buffer),
+		                                           GetInterleavedBlockPtr(block_idx), current_width);
+		unpacked_block = block_idx;
+	}
+
 	data_ptr_t GetPtr(bitpacking_metadata_t group) {
 		return handle.Ptr() + current_segment.GetBlockOffset() + group.offset;
 	}
@@ -834,6 +968,28 @@ void BitpackingScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t
 			scan_state.current_group_offset += to_scan;
 			continue;
 		}
+		if (scan_state.current_group.mode == BitpackingMode::FOR_INTERLEAVED) {
+			idx_t block_idx = scan_state.current_group_offset / BitpackingPrimitives::INTERLEAVED_BLOCK_SIZE;
+			idx_t offset_in_block = scan_state.current_group_offset % BitpackingPrimitives::INTERLEAVED_BLOCK_SIZE;
+			idx_t to_scan =
+			    MinValue<idx_t>(scan_count - scanned, BitpackingPrimitives::INTERLEAVED_BLOCK_SIZE - offset_in_block);
+			T *current_result_ptr = result_data + result_offset + scanned;
+
+			if (to_scan == BitpackingPrimitives::INTERLEAVED_BLOCK_SIZE) {
+				// Decompress directly into result vector
+				BitpackingPrimitives::UnPackInterleaved<T>(data_ptr_cast(current_result_ptr),
+				                                           scan_state.GetInterleavedBlockPtr(block_idx),
+				                                           scan_state.current_width);
+			} else {
+				scan_state.UnPackInterleavedBlock(block_idx);
+				memcpy(current_result_ptr, scan_state.decompression_buffer + offset_in_block, to_scan * sizeof(T));
+			}
+			ApplyFrameOfReference<T>(current_result_ptr, scan_state.current_frame_of_reference, to_scan);
+
+			scanned += to_scan;
+			scan_state.current_group_offset += to_scan;
+			continue;
+		}
 		D_ASSERT(scan_state.current_group.mode == BitpackingMode::FOR ||
 		         scan_state.current_group.mode == BitpackingMode::DELTA_FOR);
 
@@ -881,6 +1037,78 @@ void BitpackingScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_c
 	BitpackingScanPartial<T>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void BitpackingFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                      SelectionVector &sel, idx_t &sel_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<BitpackingScanState<T>>();
+
+	optional_ptr<const ConstantFilter> constant_filter;
+	if (filter.filter_type == TableFilterType::CONSTANT_COMPARISON) {
+		auto &candidate = filter.Cast<ConstantFilter>();
+		switch (candidate.comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+		case ExpressionType::COMPARE_NOTEQUAL:
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			if (!candidate.constant.IsNull() &&
+			    candidate.constant.type().InternalType() == segment.type.InternalType()) {
+				constant_filter = &candidate;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	// a vector spans at most two metadata groups - decide the filter for each part of the vector using the bounds of
+	// the group, which are known from the metadata of the group without unpacking any values
+	static_assert(BITPACKING_METADATA_GROUP_SIZE >= STANDARD_VECTOR_SIZE, "a vector must span at most two groups");
+	FilterPropagateResult decisions[2];
+	idx_t part_ends[2];
+	idx_t part_count = 0;
+	bool all_decided = true;
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		D_ASSERT(part_count < 2);
+		if (scan_state.current_group_offset == BITPACKING_METADATA_GROUP_SIZE) {
+			scan_state.LoadNextGroup();
+		}
+		idx_t to_scan =
+		    MinValue(scan_count - scanned, BITPACKING_METADATA_GROUP_SIZE - scan_state.current_group_offset);
+
+		auto decision = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		T min_value, max_value;
+		if (constant_filter && scan_state.GetBounds(to_scan, min_value, max_value)) {
+			decision = NumericStats::CheckZonemap<T>(constant_filter->comparison_type, min_value, max_value,
+			                                         constant_filter->constant.GetValueUnsafe<T>());
+		}
+		all_decided = all_decided && decision != FilterPropagateResult::NO_PRUNING_POSSIBLE;
+
+		BitpackingScanPartial<T>(segment, state, to_scan, result, scanned);
+		scanned += to_scan;
+		decisions[part_count] = decision;
+		part_ends[part_count] = scanned;
+		part_count++;
+	}
+
+	if (!all_decided) {
+		// at least one part of the vector has to be compared value by value
+		UnifiedVectorFormat vdata;
+		result.ToUnifiedFormat(scan_count, vdata);
+		ColumnSegment::FilterSelection(sel, result, vdata, filter, scan_count, sel_count);
+		return;
+	}
+	ColumnSegment::RefineSelection(sel, sel_count, [&](idx_t row) {
+		auto part_idx = row < part_ends[0] ? 0 : 1;
+		return decisions[part_idx] == FilterPropagateResult::FILTER_ALWAYS_TRUE;
+	});
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -927,6 +1155,16 @@ void BitpackingFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t r
 		return;
 	}
 
+	if (scan_state.current_group.mode == BitpackingMode::FOR_INTERLEAVED) {
+		idx_t block_idx = scan_state.current_group_offset / BitpackingPrimitives::INTERLEAVED_BLOCK_SIZE;
+		idx_t offset_in_block = scan_state.current_group_offset % BitpackingPrimitives::INTERLEAVED_BLOCK_SIZE;
+		BitpackingPrimitives::UnPackInterleavedValue<T>(data_ptr_cast(current_result_ptr),
+		                                                scan_state.GetInterleavedBlockPtr(block_idx), offset_in_block,
+		                                                scan_state.current_width);
+		ApplyFrameOfReference<T>(current_result_ptr, scan_state.current_frame_of_reference, 1);
+		return;
+	}
+
 	D_ASSERT(scan_state.current_group.mode == BitpackingMode::FOR ||
 	         scan_state.current_group.mode == BitpackingMode::DELTA_FOR);
 
@@ -959,25 +1197,33 @@ CompressionFunction GetBitpackingFunction(PhysicalType data_type) {
 	                           BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>, BitpackingSkip<T>);
 }
 
+template <class T>
+CompressionFunction GetBitpackingFilterFunction(PhysicalType data_type) {
+	auto function = GetBitpackingFunction<T>(data_type);
+	function.filter = BitpackingFilter<T>;
+	return function;
+}
+
 CompressionFunction BitpackingFun::GetFunction(PhysicalType type) {
 	switch (type) {
 	case PhysicalType::BOOL:
-	case PhysicalType::INT8:
 		return GetBitpackingFunction<int8_t>(type);
+	case PhysicalType::INT8:
+		return GetBitpackingFilterFunction<int8_t>(type);
 	case PhysicalType::INT16:
-		return GetBitpackingFunction<int16_t>(type);
+		return GetBitpackingFilterFunction<int16_t>(type);
 	case PhysicalType::INT32:
-		return GetBitpackingFunction<int32_t>(type);
+		return GetBitpackingFilterFunction<int32_t>(type);
 	case PhysicalType::INT64:
-		return GetBitpackingFunction<int64_t>(type);
+		return GetBitpackingFilterFunction<int64_t>(type);
 	case PhysicalType::UINT8:
-		return GetBitpackingFunction<uint8_t>(type);
+		return GetBitpackingFilterFunction<uint8_t>(type);
 	case PhysicalType::UINT16:
-		return GetBitpackingFunction<uint16_t>(type);
+		return GetBitpackingFilterFunction<uint16_t>(type);
 	case PhysicalType::UINT32:
-		return GetBitpackingFunction<uint32_t>(type);
+		return GetBitpackingFilterFunction<uint32_t>(type);
 	case PhysicalType::UINT64:
-		return GetBitpackingFunction<uint64_t>(type);
+		return GetBitpackingFilterFunction<uint64_t>(type);
 	case PhysicalType::INT128:
 		return GetBitpackingFunction<hugeint_t>(type);
 	case PhysicalType::UINT128:
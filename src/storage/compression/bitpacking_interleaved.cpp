@@ -0,0 +1,143 @@
+#include "duckdb/common/bitpacking.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DUCKDB_INTERLEAVED_AVX2
+#include <immintrin.h>
+#endif
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// AVX2 Unpacking
+//===--------------------------------------------------------------------===//
+// The portable kernels are vectorized for the SIMD width of the build target (SSE2 for the default x86-64 build).
+// On CPUs with AVX2, the lanes are unpacked 256 bits at a time instead.
+#ifdef DUCKDB_INTERLEAVED_AVX2
+#define DUCKDB_INTERLEAVED_AVX2_TARGET __attribute__((target("avx2")))
+
+static bool HasInterleavedAVX2() {
+	static const bool supported = []() {
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+	}();
+	return supported;
+}
+
+template <class T>
+struct InterleavedAVX2Ops {};
+
+template <>
+struct InterleavedAVX2Ops<uint16_t> {
+	DUCKDB_INTERLEAVED_AVX2_TARGET static inline __m256i Broadcast(uint16_t value) {
+		return _mm256_set1_epi16(static_cast<int16_t>(value));
+	}
+	DUCKDB_INTERLEAVED_AVX2_TARGET static inline __m256i ShiftRight(__m256i value, __m128i count) {
+		return _mm256_srl_epi16(value, count);
+	}
+	DUCKDB_INTERLEAVED_AVX2_TARGET static inline __m256i ShiftLeft(__m256i value, __m128i count) {
+		return _mm256_sll_epi16(value, count);
+	}
+};
+
+template <>
+struct InterleavedAVX2Ops<uint32_t> {
+	DUCKDB_INTERLEAVED_AVX2_TARGET static inline __m256i Broadcast(uint32_t value) {
+		return _mm256_set1_epi32(static_cast<int32_t>(value));
+	}
+	DUCKDB_INTERLEAVED_AVX2_TARGET static inline __m256i ShiftRight(__m256i value, __m128i count) {
+		return _mm256_srl_epi32(value, count);
+	}
+	DUCKDB_INTERLEAVED_AVX2_TARGET static inline __m256i ShiftLeft(__m256i value, __m128i count) {
+		return _mm256_sll_epi32(value, count);
+	}
+};
+
+template <>
+struct InterleavedAVX2Ops<uint64_t> {
+	DUCKDB_INTERLEAVED_AVX2_TARGET static inline __m256i Broadcast(uint64_t value) {
+		return _mm256_set1_epi64x(static_cast<int64_t>(value));
+	}
+	DUCKDB_INTERLEAVED_AVX2_TARGET static inline __m256i ShiftRight(__m256i value, __m128i count) {
+		return _mm256_srl_epi64(value, count);
+	}
+	DUCKDB_INTERLEAVED_AVX2_TARGET static inline __m256i ShiftLeft(__m256i value, __m128i count) {
+		return _mm256_sll_epi64(value, count);
+	}
+};
+
+//! Same as BitpackingPrimitives::UnPackInterleavedBlock, for a width between 1 and the bits of T
+template <class T>
+DUCKDB_INTERLEAVED_AVX2_TARGET static void UnPackInterleavedAVX2(T *__restrict dst, const T *__restrict src,
+                                                                  bitpacking_width_t width) {
+	using OPS = InterleavedAVX2Ops<T>;
+	static constexpr idx_t TYPE_BITS = sizeof(T) * 8;
+	static constexpr idx_t LANES = BitpackingPrimitives::INTERLEAVED_BLOCK_SIZE / TYPE_BITS;
+	static constexpr idx_t REGISTER_LANES = sizeof(__m256i) / sizeof(T);
+	static_assert(LANES % REGISTER_LANES == 0, "the lanes of a row must fill whole registers");
+
+	const T mask_value = width >= TYPE_BITS ? NumericLimits<T>::Maximum() : static_cast<T>((T(1) << width) - 1);
+	const auto mask = OPS::Broadcast(mask_value);
+	idx_t word = 0;
+	idx_t shift = 0;
+	for (idx_t row = 0; row < TYPE_BITS; row++) {
+		auto dst_row = dst + row * LANES;
+		auto src_word = src + word * LANES;
+		const auto shift_count = _mm_cvtsi64_si128(static_cast<int64_t>(shift));
+		if (shift + width <= TYPE_BITS) {
+			for (idx_t lane = 0; lane < LANES; lane += REGISTER_LANES) {
+				auto words = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src_word + lane));
+				auto values = _mm256_and_si256(OPS::ShiftRight(words, shift_count), mask);
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst_row + lane), values);
+			}
+		} else {
+			// the values continue in the next word of their lane
+			auto next_word = src_word + LANES;
+			const auto remaining_count = _mm_cvtsi64_si128(static_cast<int64_t>(TYPE_BITS - shift));
+			for (idx_t lane = 0; lane < LANES; lane += REGISTER_LANES) {
+				auto words = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src_word + lane));
+				auto next_words = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(next_word + lane));
+				auto values = _mm256_or_si256(OPS::ShiftRight(words, shift_count),
+				                              OPS::ShiftLeft(next_words, remaining_count));
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst_row + lane), _mm256_and_si256(values, mask));
+			}
+		}
+		shift += width;
+		word += shift / TYPE_BITS;
+		shift %= TYPE_BITS;
+	}
+}
+#endif
+
+template <class T>
+static inline bool UnPackInterleavedWithAVX2(T *__restrict dst, const T *__restrict src, bitpacking_width_t width) {
+#ifdef DUCKDB_INTERLEAVED_AVX2
+	if (width != 0 && HasInterleavedAVX2()) {
+		UnPackInterleavedAVX2<T>(dst, src, width);
+		return true;
+	}
+#endif
+	return false;
+}
+
+void BitpackingPrimitives::UnPackInterleavedSIMD(uint16_t *__restrict dst, const uint16_t *__restrict src,
+                                                 bitpacking_width_t width) {
+	if (!UnPackInterleavedWithAVX2(dst, src, width)) {
+		UnPackInterleavedBlock(dst, src, width);
+	}
+}
+
+void BitpackingPrimitives::UnPackInterleavedSIMD(uint32_t *__restrict dst, const uint32_t *__restrict src,
+                                                 bitpacking_width_t width) {
+	if (!UnPackInterleavedWithAVX2(dst, src, width)) {
+		UnPackInterleavedBlock(dst, src, width);
+	}
+}
+
+void BitpackingPrimitives::UnPackInterleavedSIMD(uint64_t *__restrict dst, const uint64_t *__restrict src,
+                                                 bitpacking_width_t width) {
+	if (!UnPackInterleavedWithAVX2(dst, src, width)) {
+		UnPackInterleavedBlock(dst, src, width);
+	}
+}
+
+} // namespace duckdb
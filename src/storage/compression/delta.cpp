@@ -0,0 +1,465 @@
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/segment/uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+namespace duckdb {
+
+// Delta-of-delta ("Gorilla-style") encoding for monotonic integer columns, such as timestamps and dates.
+// Values are stored in groups of DELTA_GROUP_SIZE values. A group stores its first value and its first delta, and the
+// differences between consecutive deltas (the delta-of-deltas) relative to their minimum, bitpacked at a fixed width.
+// Regular series (e.g. one reading per second) have delta-of-deltas that are (close to) zero, which pack into 0-2 bits.
+//
+// A segment consists of a header (the offset of the group directory), the groups, and a directory with the offset of
+// every group. Every group but the last one of a segment holds exactly DELTA_GROUP_SIZE values.
+// All arithmetic happens on the unsigned type, so that (intended) overflows wrap around instead of being undefined.
+static constexpr const idx_t DELTA_GROUP_SIZE = 1024;
+
+typedef uint32_t delta_group_offset_t;
+
+template <class T>
+struct DeltaGroupHeader {
+	T first_value;
+	T first_delta;
+	//! The minimum delta-of-delta of the group, the packed residuals are relative to it
+	T minimum_delta_of_delta;
+	//! The bit width of the packed residuals (stored as T to keep the packed data aligned)
+	T width;
+};
+
+struct DeltaStorage {
+	//! The storage (serialization) version that introduced delta segments
+	static constexpr idx_t DELTA_SERIALIZATION_VERSION = 4;
+	static constexpr idx_t DELTA_HEADER_SIZE = sizeof(uint64_t);
+};
+
+//===--------------------------------------------------------------------===//
+// Group Encoding
+//===--------------------------------------------------------------------===//
+//! Computes the delta-of-delta residuals of a group of values
+template <class T, class T_U = typename MakeUnsigned<T>::type, class T_S = typename MakeSigned<T>::type>
+struct DeltaGroupEncoder {
+	T_U residuals[DELTA_GROUP_SIZE];
+	DeltaGroupHeader<T> header;
+	bitpacking_width_t width;
+
+	//! Encodes "count" values, and returns the size of the encoded group
+	idx_t Encode(const T *values, idx_t count) {
+		D_ASSERT(count > 0 && count <= DELTA_GROUP_SIZE);
+		auto data = reinterpret_cast<const T_U *>(values);
+		T_U first_delta = count > 1 ? data[1] - data[0] : 0;
+
+		// the residuals of the first two values are zero, they are stored in the header
+		T_S minimum = 0;
+		T_S maximum = 0;
+		if (count > 2) {
+			minimum = NumericLimits<T_S>::Maximum();
+			maximum = NumericLimits<T_S>::Minimum();
+			for (idx_t i = 2; i < count; i++) {
+				auto delta_of_delta = static_cast<T_S>((data[i] - data[i - 1]) - (data[i - 1] - data[i - 2]));
+				residuals[i] = static_cast<T_U>(delta_of_delta);
+				minimum = MinValue(minimum, delta_of_delta);
+				maximum = MaxValue(maximum, delta_of_delta);
+			}
+		}
+		residuals[0] = static_cast<T_U>(minimum);
+		residuals[1] = static_cast<T_U>(minimum);
+		for (idx_t i = 0; i < count; i++) {
+			residuals[i] -= static_cast<T_U>(minimum);
+		}
+		width = BitpackingPrimitives::MinimumBitWidth<T_U>(static_cast<T_U>(maximum) - static_cast<T_U>(minimum));
+
+		header.first_value = values[0];
+		header.first_delta = static_cast<T>(first_delta);
+		header.minimum_delta_of_delta = static_cast<T>(minimum);
+		header.width = static_cast<T>(width);
+		return GetGroupSize(count, width);
+	}
+
+	//! Writes the group that was last encoded to "target"
+	void Write(data_ptr_t target, idx_t count) {
+		memcpy(target, &header, sizeof(DeltaGroupHeader<T>));
+		if (width > 0) {
+			BitpackingPrimitives::PackBuffer<T_U, false>(target + sizeof(DeltaGroupHeader<T>), residuals, count,
+			                                             width);
+		}
+	}
+
+	static idx_t GetGroupSize(idx_t count, bitpacking_width_t width) {
+		return AlignValue(sizeof(DeltaGroupHeader<T>) + BitpackingPrimitives::GetRequiredSize(count, width));
+	}
+
+	//! The maximum size of a group, every group has to fit into an empty segment
+	static idx_t GetMaximumGroupSize() {
+		return GetGroupSize(DELTA_GROUP_SIZE, sizeof(T) * 8);
+	}
+};
+
+//! Decodes the group at "group_ptr" into "target"
+template <class T, class T_U = typename MakeUnsigned<T>::type>
+static void DeltaDecodeGroup(data_ptr_t group_ptr, idx_t count, T *target) {
+	DeltaGroupHeader<T> header;
+	memcpy(&header, group_ptr, sizeof(DeltaGroupHeader<T>));
+	auto width = static_cast<bitpacking_width_t>(header.width);
+	auto result = reinterpret_cast<T_U *>(target);
+
+	// unpack the residuals and add the minimum - these loops have no dependencies between iterations and vectorize
+	if (width == 0) {
+		for (idx_t i = 0; i < count; i++) {
+			result[i] = static_cast<T_U>(header.minimum_delta_of_delta);
+		}
+	} else {
+		BitpackingPrimitives::UnPackBuffer<T_U>(data_ptr_cast(result), group_ptr + sizeof(DeltaGroupHeader<T>),
+		                                        BitpackingPrimitives::RoundUpToAlgorithmGroupSize(count), width, true);
+		for (idx_t i = 0; i < count; i++) {
+			result[i] += static_cast<T_U>(header.minimum_delta_of_delta);
+		}
+	}
+
+	// reconstruct the deltas and then the values with two prefix sums
+	T_U delta = static_cast<T_U>(header.first_delta);
+	T_U value = static_cast<T_U>(header.first_value);
+	result[0] = value;
+	if (count > 1) {
+		value += delta;
+		result[1] = value;
+	}
+	for (idx_t i = 2; i < count; i++) {
+		delta += result[i];
+		value += delta;
+		result[i] = value;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+template <class T>
+struct DeltaAnalyzeState : public AnalyzeState {
+	explicit DeltaAnalyzeState(const CompressionInfo &info) : AnalyzeState(info) {
+	}
+
+	DeltaGroupEncoder<T> encoder;
+	T values[DELTA_GROUP_SIZE];
+	idx_t value_count = 0;
+	idx_t group_count = 0;
+	idx_t total_size = 0;
+	T previous_value = T(0);
+
+	void Append(T value) {
+		values[value_count++] = value;
+		previous_value = value;
+		if (value_count == DELTA_GROUP_SIZE) {
+			Flush();
+		}
+	}
+
+	void Flush() {
+		if (value_count == 0) {
+			return;
+		}
+		total_size += encoder.Encode(values, value_count);
+		group_count++;
+		value_count = 0;
+	}
+};
+
+template <class T>
+unique_ptr<AnalyzeState> DeltaInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	auto &config = DBConfig::GetConfig(col_data.GetDatabase());
+	if (!config.options.serialization_compatibility.Compare(DeltaStorage::DELTA_SERIALIZATION_VERSION)) {
+		// older versions can not read delta segments
+		return nullptr;
+	}
+	CompressionInfo info(col_data.GetBlockManager().GetBlockSize());
+	if (DeltaStorage::DELTA_HEADER_SIZE + DeltaGroupEncoder<T>::GetMaximumGroupSize() + sizeof(delta_group_offset_t) >
+	    info.GetBlockSize()) {
+		// the block size is too small to hold a group
+		return nullptr;
+	}
+	return make_uniq<DeltaAnalyzeState<T>>(info);
+}
+
+//! Returns the value to store at the given row - nulls repeat the previous value so that they do not disturb the deltas
+template <class T>
+static T DeltaGetValue(const UnifiedVectorFormat &vdata, idx_t idx, T previous_value) {
+	if (!vdata.validity.RowIsValid(idx)) {
+		return previous_value;
+	}
+	return UnifiedVectorFormat::GetData<T>(vdata)[idx];
+}
+
+template <class T>
+bool DeltaAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<DeltaAnalyzeState<T>>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		state.Append(DeltaGetValue<T>(vdata, idx, state.previous_value));
+	}
+	return true;
+}
+
+template <class T>
+idx_t DeltaFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<DeltaAnalyzeState<T>>();
+	state.Flush();
+	if (state.group_count == 0) {
+		return DConstants::INVALID_INDEX;
+	}
+	auto directory_size = state.group_count * sizeof(delta_group_offset_t);
+	auto segment_count = (state.total_size + directory_size) / state.info.GetBlockSize() + 1;
+	return state.total_size + directory_size + segment_count * DeltaStorage::DELTA_HEADER_SIZE;
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+template <class T>
+class DeltaCompressionState : public CompressionState {
+public:
+	DeltaCompressionState(ColumnDataCheckpointer &checkpointer, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_DELTA)) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+	//! The offset of the next group in the current segment
+	idx_t data_offset;
+	//! The offsets of the groups in the current segment
+	vector<delta_group_offset_t> directory;
+
+	DeltaGroupEncoder<T> encoder;
+	T values[DELTA_GROUP_SIZE];
+	idx_t value_count = 0;
+	T previous_value = T(0);
+	//! The statistics of the buffered values, they are added to the segment the group ends up in
+	T minimum;
+	T maximum;
+	bool has_valid = false;
+
+public:
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		current_segment =
+		    ColumnSegment::CreateTransientSegment(db, type, row_start, info.GetBlockSize(), info.GetBlockSize());
+		current_segment->function = function;
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+		data_offset = DeltaStorage::DELTA_HEADER_SIZE;
+		directory.clear();
+	}
+
+	void Append(T value, bool is_valid) {
+		if (is_valid) {
+			minimum = has_valid ? MinValue(minimum, value) : value;
+			maximum = has_valid ? MaxValue(maximum, value) : value;
+			has_valid = true;
+		}
+		values[value_count++] = value;
+		previous_value = value;
+		if (value_count == DELTA_GROUP_SIZE) {
+			FlushGroup();
+		}
+	}
+
+	bool CanStore(idx_t group_size) const {
+		auto directory_size = (directory.size() + 1) * sizeof(delta_group_offset_t);
+		return data_offset + group_size + directory_size <= info.GetBlockSize();
+	}
+
+	void FlushGroup() {
+		if (value_count == 0) {
+			return;
+		}
+		auto group_size = encoder.Encode(values, value_count);
+		if (!CanStore(group_size)) {
+			auto next_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(next_start);
+			D_ASSERT(CanStore(group_size));
+		}
+		auto group_ptr = handle.Ptr() + data_offset;
+		memset(group_ptr, 0, group_size);
+		encoder.Write(group_ptr, value_count);
+		directory.push_back(NumericCast<delta_group_offset_t>(data_offset));
+		data_offset += group_size;
+
+		current_segment->count += value_count;
+		if (has_valid) {
+			current_segment->stats.statistics.UpdateNumericStats<T>(minimum);
+			current_segment->stats.statistics.UpdateNumericStats<T>(maximum);
+		}
+		value_count = 0;
+		has_valid = false;
+	}
+
+	void FlushSegment() {
+		auto base_ptr = handle.Ptr();
+		// the directory is placed directly after the groups
+		auto directory_size = directory.size() * sizeof(delta_group_offset_t);
+		Store<uint64_t>(data_offset, base_ptr);
+		memcpy(base_ptr + data_offset, directory.data(), directory_size);
+		auto total_size = data_offset + directory_size;
+		handle.Destroy();
+
+		auto &state = checkpointer.GetCheckpointState();
+		if (total_size >= info.GetCompactionFlushLimit()) {
+			total_size = info.GetBlockSize();
+		}
+		state.FlushSegment(std::move(current_segment), total_size);
+	}
+
+	void Finalize() {
+		FlushGroup();
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+template <class T>
+unique_ptr<CompressionState> DeltaInitCompression(ColumnDataCheckpointer &checkpointer,
+                                                  unique_ptr<AnalyzeState> state) {
+	return make_uniq<DeltaCompressionState<T>>(checkpointer, state->info);
+}
+
+template <class T>
+void DeltaCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<DeltaCompressionState<T>>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		state.Append(DeltaGetValue<T>(vdata, idx, state.previous_value), vdata.validity.RowIsValid(idx));
+	}
+}
+
+template <class T>
+void DeltaFinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<DeltaCompressionState<T>>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+template <class T>
+struct DeltaScanState : public SegmentScanState {
+	explicit DeltaScanState(ColumnSegment &segment) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		base_ptr = handle.Ptr() + segment.GetBlockOffset();
+		directory_ptr = base_ptr + Load<uint64_t>(base_ptr);
+		segment_count = segment.count;
+	}
+
+	BufferHandle handle;
+	data_ptr_t base_ptr;
+	data_ptr_t directory_ptr;
+	idx_t segment_count;
+	//! The index of the decoded group (or INVALID_INDEX)
+	idx_t group_idx = DConstants::INVALID_INDEX;
+	T decoded[DELTA_GROUP_SIZE];
+
+public:
+	//! Decodes the group that holds the given row (relative to the start of the segment), if it is not decoded yet
+	const T *GetGroup(idx_t row) {
+		auto new_group_idx = row / DELTA_GROUP_SIZE;
+		if (new_group_idx != group_idx) {
+			auto group_offset =
+			    Load<delta_group_offset_t>(directory_ptr + new_group_idx * sizeof(delta_group_offset_t));
+			auto group_count = MinValue<idx_t>(DELTA_GROUP_SIZE, segment_count - new_group_idx * DELTA_GROUP_SIZE);
+			DeltaDecodeGroup<T>(base_ptr + group_offset, group_count, decoded);
+			group_idx = new_group_idx;
+		}
+		return decoded;
+	}
+};
+
+template <class T>
+unique_ptr<SegmentScanState> DeltaInitScan(ColumnSegment &segment) {
+	return make_uniq<DeltaScanState<T>>(segment);
+}
+
+template <class T>
+void DeltaScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                      idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<DeltaScanState<T>>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+
+	D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<T>(result) + result_offset;
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto row = start + scanned;
+		auto group = scan_state.GetGroup(row);
+		auto offset_in_group = row % DELTA_GROUP_SIZE;
+		auto to_scan = MinValue<idx_t>(scan_count - scanned, DELTA_GROUP_SIZE - offset_in_group);
+		memcpy(result_data + scanned, group + offset_in_group, to_scan * sizeof(T));
+		scanned += to_scan;
+	}
+}
+
+template <class T>
+void DeltaScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	DeltaScanPartial<T>(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+template <class T>
+void DeltaFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) {
+	DeltaScanState<T> scan_state(segment);
+	auto row = UnsafeNumericCast<idx_t>(row_id);
+	auto group = scan_state.GetGroup(row);
+	FlatVector::GetData<T>(result)[result_idx] = group[row % DELTA_GROUP_SIZE];
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+template <class T>
+CompressionFunction GetDeltaFunction(PhysicalType data_type) {
+	return CompressionFunction(CompressionType::COMPRESSION_DELTA, data_type, DeltaInitAnalyze<T>, DeltaAnalyze<T>,
+	                           DeltaFinalAnalyze<T>, DeltaInitCompression<T>, DeltaCompress<T>,
+	                           DeltaFinalizeCompress<T>, DeltaInitScan<T>, DeltaScan<T>, DeltaScanPartial<T>,
+	                           DeltaFetchRow<T>, UncompressedFunctions::EmptySkip);
+}
+
+CompressionFunction DeltaFun::GetFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT32:
+		return GetDeltaFunction<int32_t>(type);
+	case PhysicalType::INT64:
+		return GetDeltaFunction<int64_t>(type);
+	default:
+		throw InternalException("Unsupported type for Delta");
+	}
+}
+
+bool DeltaFun::TypeIsSupported(const PhysicalType physical_type) {
+	switch (physical_type) {
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
@@ -7,6 +7,7 @@
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/storage/segment/uncompressed.hpp"
 #include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_dictionary.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 
 namespace duckdb {
@@ -109,6 +110,8 @@ struct DictionaryCompressionStorage {
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
+	static void StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                         SelectionVector &sel, idx_t &sel_count, const TableFilter &filter);
 
 	static bool HasEnoughSpace(idx_t current_count, idx_t index_count, idx_t dict_size,
 	                           bitpacking_width_t packing_width, const idx_t block_size);
@@ -444,8 +447,46 @@ struct CompressedStringScanState : public StringScanState {
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
+	idx_t dictionary_size = 0;
+	//! The filter that was evaluated against the dictionary, and the dictionary entries that pass it
+	optional_ptr<const TableFilter> filter;
+	unsafe_unique_array<bool> filter_matches;
+	//! The codes of the dictionary entries in the dictionary shared by all segments of the column (if any)
+	unsafe_unique_array<sel_t> column_codes;
+	bool column_codes_unavailable = false;
+	buffer_ptr<SelectionVector> column_sel;
 };
 
+//! Emits the unpacked dictionary indexes in sel_vec as a dictionary vector - over the dictionary that is shared by all
+//! segments of the column if there is one, or over the dictionary of this segment otherwise
+static void EmitDictionaryVector(ColumnScanState &state, CompressedStringScanState &scan_state, idx_t scan_count,
+                                 Vector &result) {
+	if (state.column_dictionary && !scan_state.column_codes_unavailable) {
+		if (!scan_state.column_codes) {
+			scan_state.column_codes = make_unsafe_uniq_array<sel_t>(MaxValue<idx_t>(scan_state.dictionary_size, 1));
+			if (!state.column_dictionary->GetCodes(*scan_state.dictionary, scan_state.dictionary_size,
+			                                       scan_state.column_codes.get())) {
+				// the shared dictionary is full - use the dictionary of the segment instead
+				scan_state.column_codes_unavailable = true;
+			}
+		}
+		if (!scan_state.column_codes_unavailable) {
+			if (!scan_state.column_sel) {
+				scan_state.column_sel = make_buffer<SelectionVector>(STANDARD_VECTOR_SIZE);
+			}
+			auto codes = scan_state.column_codes.get();
+			auto indexes = scan_state.sel_vec->data();
+			auto column_indexes = scan_state.column_sel->data();
+			for (idx_t i = 0; i < scan_count; i++) {
+				column_indexes[i] = codes[indexes[i]];
+			}
+			state.column_dictionary->Slice(result, *scan_state.column_sel, scan_count);
+			return;
+		}
+	}
+	result.Slice(*(scan_state.dictionary), *scan_state.sel_vec, scan_count);
+}
+
 unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(ColumnSegment &segment) {
 	auto state = make_uniq<CompressedStringScanState>();
 	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
@@ -463,6 +504,7 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 	auto index_buffer_ptr = reinterpret_cast<uint32_t *>(baseptr + index_buffer_offset);
 
 	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
+	state->dictionary_size = index_buffer_count;
 	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
 
 	for (uint32_t i = 0; i < index_buffer_count; i++) {
@@ -545,7 +587,7 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 
 		BitpackingPrimitives::UnPackBuffer<sel_t>(dst, src, scan_count, scan_state.current_width);
 
-		result.Slice(*(scan_state.dictionary), *scan_state.sel_vec, scan_count);
+		EmitDictionaryVector(state, scan_state, scan_count, result);
 	}
 }
 
@@ -554,6 +596,52 @@ void DictionaryCompressionStorage::StringScan(ColumnSegment &segment, ColumnScan
 	StringScanPartial<true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+void DictionaryCompressionStorage::StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
+                                                Vector &result, SelectionVector &sel, idx_t &sel_count,
+                                                const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<CompressedStringScanState>();
+
+	// evaluate the filter once per dictionary entry - the result is reused for all vectors of the segment, unless the
+	// filter can change while scanning
+	if (scan_state.filter.get() != &filter || ColumnSegment::FilterIsDynamic(filter)) {
+		if (!scan_state.filter_matches) {
+			scan_state.filter_matches = make_unsafe_uniq_array<bool>(MaxValue<idx_t>(scan_state.dictionary_size, 1));
+		}
+		ColumnSegment::FilterValues(*scan_state.dictionary, scan_state.dictionary_size, filter,
+		                            scan_state.filter_matches.get());
+		scan_state.filter = &filter;
+	}
+
+	// unpack the dictionary indexes of the rows, and look up whether their dictionary entry passed the filter
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto baseptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto base_data = data_ptr_cast(baseptr + DICTIONARY_HEADER_SIZE);
+
+	idx_t start_offset = start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+	idx_t decompress_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(scan_count + start_offset);
+	if (!scan_state.sel_vec || scan_state.sel_vec_size < decompress_count) {
+		scan_state.sel_vec_size = decompress_count;
+		scan_state.sel_vec = make_buffer<SelectionVector>(decompress_count);
+	}
+	data_ptr_t src = &base_data[((start - start_offset) * scan_state.current_width) / 8];
+	BitpackingPrimitives::UnPackBuffer<sel_t>(data_ptr_cast(scan_state.sel_vec->data()), src, decompress_count,
+	                                          scan_state.current_width);
+
+	auto indexes = scan_state.sel_vec->data() + start_offset;
+	auto matches = scan_state.filter_matches.get();
+	ColumnSegment::RefineSelection(sel, sel_count, [&](idx_t row) { return matches[indexes[row]]; });
+
+	// emit the rows as a dictionary vector if possible, so that the strings are never copied
+	if (start_offset == 0 && scan_count == STANDARD_VECTOR_SIZE) {
+		EmitDictionaryVector(state, scan_state, scan_count, result);
+	} else {
+		StringScanPartial<false>(segment, state, scan_count, result, 0);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -651,13 +739,15 @@ uint16_t DictionaryCompressionStorage::GetStringLength(uint32_t *index_buffer_pt
 // Get Function
 //===--------------------------------------------------------------------===//
 CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type) {
-	return CompressionFunction(
+	CompressionFunction function(
 	    CompressionType::COMPRESSION_DICTIONARY, data_type, DictionaryCompressionStorage ::StringInitAnalyze,
 	    DictionaryCompressionStorage::StringAnalyze, DictionaryCompressionStorage::StringFinalAnalyze,
 	    DictionaryCompressionStorage::InitCompression, DictionaryCompressionStorage::Compress,
 	    DictionaryCompressionStorage::FinalizeCompress, DictionaryCompressionStorage::StringInitScan,
 	    DictionaryCompressionStorage::StringScan, DictionaryCompressionStorage::StringScanPartial<false>,
 	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	function.filter = DictionaryCompressionStorage::StringFilter;
+	return function;
 }
 
 bool DictionaryCompressionFun::TypeIsSupported(const PhysicalType physical_type) {
@@ -87,6 +87,21 @@ void ConstantFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row
 	ConstantFillFunction<T>(segment, result, result_idx, 1);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void ConstantFilterFunction(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                            SelectionVector &sel, idx_t &sel_count, const TableFilter &filter) {
+	// the value is stored in the statistics: the filter is evaluated once, and either passes or rejects all rows
+	ConstantScanFunction<T>(segment, state, scan_count, result);
+	bool match;
+	ColumnSegment::FilterValues(result, 1, filter, &match);
+	if (!match) {
+		sel_count = 0;
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Get Function
 //===--------------------------------------------------------------------===//
@@ -99,9 +114,11 @@ CompressionFunction ConstantGetFunctionValidity(PhysicalType data_type) {
 
 template <class T>
 CompressionFunction ConstantGetFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
-	                           nullptr, nullptr, ConstantInitScan, ConstantScanFunction<T>, ConstantScanPartial<T>,
-	                           ConstantFetchRow<T>, UncompressedFunctions::EmptySkip);
+	CompressionFunction function(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
+	                             nullptr, nullptr, ConstantInitScan, ConstantScanFunction<T>, ConstantScanPartial<T>,
+	                             ConstantFetchRow<T>, UncompressedFunctions::EmptySkip);
+	function.filter = ConstantFilterFunction<T>;
+	return function;
 }
 
 CompressionFunction ConstantFun::GetFunction(PhysicalType data_type) {
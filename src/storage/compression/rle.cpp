@@ -1,3 +1,4 @@
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/function/compression/compression.hpp"
 #include "duckdb/function/compression_function.hpp"
@@ -117,6 +118,8 @@ idx_t RLEFinalAnalyze(AnalyzeState &state) {
 //===--------------------------------------------------------------------===//
 struct RLEConstants {
 	static constexpr const idx_t RLE_HEADER_SIZE = sizeof(uint64_t);
+	//! An entire vector is emitted as a dictionary vector over its runs if they are at least this long on average
+	static constexpr const idx_t DICTIONARY_MIN_RUN_LENGTH = 8;
 };
 
 template <class T, bool WRITE_STATISTICS>
@@ -276,6 +279,13 @@ struct RLEScanState : public SegmentScanState {
 	idx_t entry_pos;
 	idx_t position_in_entry;
 	uint32_t rle_count_offset;
+	//! The values of the runs, and the selection of the rows into them, of a vector that is emitted as a dictionary
+	unique_ptr<Vector> run_values;
+	buffer_ptr<SelectionVector> run_sel;
+	//! The values, ends and filter results of the runs of a vector that is filtered
+	unique_ptr<Vector> filter_values;
+	unsafe_unique_array<idx_t> filter_run_ends;
+	unsafe_unique_array<bool> filter_matches;
 };
 
 template <class T>
@@ -335,6 +345,45 @@ static void RLEScanConstant(RLEScanState<T> &scan_state, rle_count_t *index_poin
 	return;
 }
 
+template <class T>
+static bool RLEScanDictionary(RLEScanState<T> &scan_state, rle_count_t *index_pointer, T *data_pointer,
+                              idx_t scan_count, Vector &result) {
+	// Count the runs in this vector
+	idx_t run_count = 0;
+	idx_t covered = 0;
+	for (auto entry_pos = scan_state.entry_pos; covered < scan_count; entry_pos++) {
+		covered += index_pointer[entry_pos] - (run_count == 0 ? scan_state.position_in_entry : 0);
+		run_count++;
+		if (run_count * RLEConstants::DICTIONARY_MIN_RUN_LENGTH > scan_count) {
+			return false;
+		}
+	}
+
+	if (!scan_state.run_values) {
+		scan_state.run_values = make_uniq<Vector>(result.GetType());
+		scan_state.run_sel = make_buffer<SelectionVector>(STANDARD_VECTOR_SIZE);
+	}
+	auto run_data = FlatVector::GetData<T>(*scan_state.run_values);
+	auto &run_sel = *scan_state.run_sel;
+	idx_t row_idx = 0;
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		run_data[run_idx] = data_pointer[scan_state.entry_pos];
+		const idx_t remaining_in_run = index_pointer[scan_state.entry_pos] - scan_state.position_in_entry;
+		const auto run_scan_count = MinValue<idx_t>(remaining_in_run, scan_count - row_idx);
+		for (idx_t i = 0; i < run_scan_count; i++) {
+			run_sel.set_index(row_idx + i, run_idx);
+		}
+		row_idx += run_scan_count;
+		scan_state.position_in_entry += run_scan_count;
+		if (ExhaustedRun(scan_state, index_pointer)) {
+			ForwardToNextRun(scan_state);
+		}
+	}
+	D_ASSERT(row_idx == scan_count);
+	result.Slice(*scan_state.run_values, run_sel, scan_count);
+	return true;
+}
+
 template <class T, bool ENTIRE_VECTOR>
 void RLEScanPartialInternal(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
                             idx_t result_offset) {
@@ -351,6 +400,12 @@ void RLEScanPartialInternal(ColumnSegment &segment, ColumnScanState &state, idx_
 		return;
 	}
 
+	// If we are scanning an entire Vector that contains a few long runs
+	if (ENTIRE_VECTOR && scan_count == STANDARD_VECTOR_SIZE &&
+	    RLEScanDictionary<T>(scan_state, index_pointer, data_pointer, scan_count, result)) {
+		return;
+	}
+
 	auto result_data = FlatVector::GetData<T>(result);
 	result.SetVectorType(VectorType::FLAT_VECTOR);
 	for (idx_t i = 0; i < scan_count; i++) {
@@ -374,6 +429,50 @@ void RLEScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, V
 	RLEScanPartialInternal<T, true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void RLEFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+               idx_t &sel_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<RLEScanState<T>>();
+
+	auto data = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto data_pointer = reinterpret_cast<T *>(data + RLEConstants::RLE_HEADER_SIZE);
+	auto index_pointer = reinterpret_cast<rle_count_t *>(data + scan_state.rle_count_offset);
+
+	if (!scan_state.filter_values) {
+		scan_state.filter_values = make_uniq<Vector>(result.GetType());
+		scan_state.filter_run_ends = make_unsafe_uniq_array<idx_t>(STANDARD_VECTOR_SIZE);
+		scan_state.filter_matches = make_unsafe_uniq_array<bool>(STANDARD_VECTOR_SIZE);
+	}
+	// gather the runs of this vector, and evaluate the filter once per run
+	auto run_values = FlatVector::GetData<T>(*scan_state.filter_values);
+	auto run_ends = scan_state.filter_run_ends.get();
+	auto matches = scan_state.filter_matches.get();
+	idx_t run_count = 0;
+	idx_t covered = 0;
+	for (auto entry_pos = scan_state.entry_pos; covered < scan_count; entry_pos++) {
+		covered += index_pointer[entry_pos] - (run_count == 0 ? scan_state.position_in_entry : 0);
+		run_values[run_count] = data_pointer[entry_pos];
+		run_ends[run_count] = MinValue(covered, scan_count);
+		run_count++;
+	}
+	ColumnSegment::FilterValues(*scan_state.filter_values, run_count, filter, matches);
+
+	if (run_count == 1) {
+		if (!matches[0]) {
+			sel_count = 0;
+		}
+	} else {
+		ColumnSegment::RefineSelection(sel, sel_count, [&](idx_t row) {
+			auto run_idx = std::upper_bound(run_ends, run_ends + run_count, row) - run_ends;
+			return matches[run_idx];
+		});
+	}
+	RLEScan<T>(segment, state, scan_count, result);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -393,10 +492,15 @@ void RLEFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id,
 //===--------------------------------------------------------------------===//
 template <class T, bool WRITE_STATISTICS = true>
 CompressionFunction GetRLEFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
-	                           RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
-	                           RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
-	                           RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	CompressionFunction function(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
+	                             RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
+	                             RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
+	                             RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	if (WRITE_STATISTICS) {
+		// list offsets are never filtered
+		function.filter = RLEFilter<T>;
+	}
+	return function;
 }
 
 CompressionFunction RLEFun::GetFunction(PhysicalType type) {
@@ -0,0 +1,478 @@
+#include "duckdb/common/constants.hpp"
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/segment/uncompressed.hpp"
+#include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+
+#include "zstd.h"
+
+namespace duckdb {
+
+// A ZSTD segment consists of a header, a directory with one entry per frame, and the compressed frames.
+// Every frame holds a contiguous range of rows: the lengths of the strings (as uint32_t), followed by their data.
+// Frames are compressed independently, so a single row can be fetched by decompressing only the frame it is in.
+typedef struct {
+	uint32_t frame_count;
+	uint32_t unused_padding;
+} zstd_segment_header_t;
+
+typedef struct {
+	//! The first row of the frame (relative to the start of the segment)
+	uint32_t row_start;
+	//! The offset of the compressed frame (relative to the start of the segment)
+	uint32_t offset;
+	//! The size of the compressed frame
+	uint32_t compressed_size;
+	//! The size of the frame after decompressing it
+	uint32_t uncompressed_size;
+} zstd_frame_entry_t;
+
+struct ZSTDStorage {
+	static constexpr double MINIMUM_COMPRESSION_RATIO = 1.2;
+	static constexpr double ANALYSIS_SAMPLE_SIZE = 0.25;
+	//! Strings that are shorter than this (on average) are better served by dictionary compression or FSST
+	static constexpr idx_t MINIMUM_AVERAGE_STRING_LENGTH = 32;
+	//! The ZSTD compression level
+	static constexpr int COMPRESSION_LEVEL = 3;
+	//! The storage (serialization) version that introduced ZSTD segments
+	static constexpr idx_t ZSTD_SERIALIZATION_VERSION = 4;
+
+	//! The maximum (uncompressed) size of a frame - a compressed frame always fits in an empty segment
+	static idx_t GetMaximumFrameSize(idx_t block_size) {
+		return block_size / 2;
+	}
+
+	static unique_ptr<AnalyzeState> StringInitAnalyze(ColumnData &col_data, PhysicalType type);
+	static bool StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count);
+	static idx_t StringFinalAnalyze(AnalyzeState &state_p);
+
+	static unique_ptr<CompressionState> InitCompression(ColumnDataCheckpointer &checkpointer,
+	                                                    unique_ptr<AnalyzeState> analyze_state_p);
+	static void Compress(CompressionState &state_p, Vector &scan_vector, idx_t count);
+	static void FinalizeCompress(CompressionState &state_p);
+
+	static unique_ptr<SegmentScanState> StringInitScan(ColumnSegment &segment);
+	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                              idx_t result_offset);
+	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+	                           idx_t result_idx);
+};
+
+//===--------------------------------------------------------------------===//
+// Frames
+//===--------------------------------------------------------------------===//
+//! Builds the uncompressed contents of a frame
+struct ZSTDFrameBuilder {
+	vector<uint32_t> lengths;
+	vector<char> data;
+
+	idx_t Count() const {
+		return lengths.size();
+	}
+	idx_t Size() const {
+		return lengths.size() * sizeof(uint32_t) + data.size();
+	}
+	void Add(const char *str, idx_t size) {
+		lengths.push_back(NumericCast<uint32_t>(size));
+		data.insert(data.end(), str, str + size);
+	}
+	void Clear() {
+		lengths.clear();
+		data.clear();
+	}
+	//! Compresses the frame into "target", returns the compressed size
+	idx_t Compress(duckdb_zstd::ZSTD_CCtx *context, vector<char> &target) {
+		vector<char> frame(Size());
+		memcpy(frame.data(), lengths.data(), lengths.size() * sizeof(uint32_t));
+		if (!data.empty()) {
+			memcpy(frame.data() + lengths.size() * sizeof(uint32_t), data.data(), data.size());
+		}
+		target.resize(duckdb_zstd::ZSTD_compressBound(frame.size()));
+		auto compressed_size = duckdb_zstd::ZSTD_compressCCtx(context, target.data(), target.size(), frame.data(),
+		                                                      frame.size(), ZSTDStorage::COMPRESSION_LEVEL);
+		if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+			throw InternalException("ZSTD compression failed: %s", duckdb_zstd::ZSTD_getErrorName(compressed_size));
+		}
+		return compressed_size;
+	}
+};
+
+//! Decompresses frames of a segment
+struct ZSTDFrameReader {
+	ZSTDFrameReader() : context(duckdb_zstd::ZSTD_createDCtx()) {
+	}
+	~ZSTDFrameReader() {
+		duckdb_zstd::ZSTD_freeDCtx(context);
+	}
+
+	duckdb_zstd::ZSTD_DCtx *context;
+	//! The index of the decompressed frame (or INVALID_INDEX)
+	idx_t frame_idx = DConstants::INVALID_INDEX;
+	//! The first row of the decompressed frame
+	idx_t row_start = 0;
+	vector<char> buffer;
+	//! The offsets of the strings in the decompressed frame
+	vector<uint32_t> offsets;
+
+	static zstd_frame_entry_t GetEntry(data_ptr_t base_ptr, idx_t frame_idx) {
+		zstd_frame_entry_t entry;
+		memcpy(&entry, base_ptr + sizeof(zstd_segment_header_t) + frame_idx * sizeof(zstd_frame_entry_t),
+		       sizeof(zstd_frame_entry_t));
+		return entry;
+	}
+
+	//! Finds the frame that holds the given row (relative to the start of the segment)
+	static idx_t FindFrame(data_ptr_t base_ptr, idx_t row) {
+		idx_t lower = 0;
+		idx_t upper = Load<uint32_t>(base_ptr);
+		while (upper - lower > 1) {
+			auto middle = lower + (upper - lower) / 2;
+			if (GetEntry(base_ptr, middle).row_start <= row) {
+				lower = middle;
+			} else {
+				upper = middle;
+			}
+		}
+		return lower;
+	}
+
+	//! Decompresses the frame that holds the given row (if it is not decompressed already)
+	void Decompress(data_ptr_t base_ptr, idx_t row, idx_t segment_count) {
+		if (frame_idx != DConstants::INVALID_INDEX && row >= row_start && row < row_start + offsets.size()) {
+			return;
+		}
+		auto new_frame_idx = FindFrame(base_ptr, row);
+		auto entry = GetEntry(base_ptr, new_frame_idx);
+		auto frame_count = Load<uint32_t>(base_ptr);
+		auto row_end =
+		    new_frame_idx + 1 < frame_count ? GetEntry(base_ptr, new_frame_idx + 1).row_start : segment_count;
+
+		buffer.resize(entry.uncompressed_size);
+		auto result = duckdb_zstd::ZSTD_decompressDCtx(context, buffer.data(), buffer.size(), base_ptr + entry.offset,
+		                                               entry.compressed_size);
+		if (duckdb_zstd::ZSTD_isError(result) || result != entry.uncompressed_size) {
+			throw IOException("Corrupt database file: failed to decompress ZSTD frame");
+		}
+		// compute the offsets of the strings from their lengths
+		auto row_count = row_end - entry.row_start;
+		offsets.resize(row_count);
+		idx_t offset = row_count * sizeof(uint32_t);
+		for (idx_t i = 0; i < row_count; i++) {
+			offsets[i] = NumericCast<uint32_t>(offset);
+			offset += Load<uint32_t>(const_data_ptr_cast(buffer.data() + i * sizeof(uint32_t)));
+		}
+		if (offset != entry.uncompressed_size) {
+			throw IOException("Corrupt database file: ZSTD frame does not match its string lengths");
+		}
+		frame_idx = new_frame_idx;
+		row_start = entry.row_start;
+	}
+
+	//! Reads the string at the given row (relative to the start of the segment) into the result vector
+	void ReadString(data_ptr_t base_ptr, idx_t row, idx_t segment_count, Vector &result, string_t &target) {
+		Decompress(base_ptr, row, segment_count);
+		auto frame_row = row - row_start;
+		auto length = Load<uint32_t>(const_data_ptr_cast(buffer.data() + frame_row * sizeof(uint32_t)));
+		string_t str(buffer.data() + offsets[frame_row], length);
+		target = str.IsInlined() ? str : StringVector::AddStringOrBlob(result, str);
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ZSTDAnalyzeState : public AnalyzeState {
+	explicit ZSTDAnalyzeState(const CompressionInfo &info)
+	    : AnalyzeState(info), context(duckdb_zstd::ZSTD_createCCtx()) {
+	}
+	~ZSTDAnalyzeState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	duckdb_zstd::ZSTD_CCtx *context;
+	RandomEngine random_engine;
+
+	idx_t count = 0;
+	idx_t string_count = 0;
+	idx_t total_size = 0;
+	idx_t frame_count = 0;
+
+	idx_t sampled_size = 0;
+	idx_t sampled_compressed_size = 0;
+
+	ZSTDFrameBuilder frame;
+	vector<char> compressed_buffer;
+};
+
+unique_ptr<AnalyzeState> ZSTDStorage::StringInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	auto &config = DBConfig::GetConfig(col_data.GetDatabase());
+	if (!config.options.serialization_compatibility.Compare(ZSTD_SERIALIZATION_VERSION)) {
+		// older versions can not read ZSTD segments
+		return nullptr;
+	}
+	CompressionInfo info(col_data.GetBlockManager().GetBlockSize());
+	return make_uniq<ZSTDAnalyzeState>(info);
+}
+
+bool ZSTDStorage::StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	auto maximum_frame_size = GetMaximumFrameSize(state.info.GetBlockSize());
+	bool sample_selected = state.sampled_size == 0 || state.random_engine.NextRandom() < ANALYSIS_SAMPLE_SIZE;
+	state.frame.Clear();
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		idx_t string_size = 0;
+		if (vdata.validity.RowIsValid(idx)) {
+			string_size = data[idx].GetSize();
+			state.string_count++;
+		}
+		// every string has to fit into a frame on its own
+		if (string_size + sizeof(uint32_t) > maximum_frame_size) {
+			return false;
+		}
+		state.total_size += string_size + sizeof(uint32_t);
+		if (sample_selected) {
+			state.frame.Add(string_size ? data[idx].GetData() : nullptr, string_size);
+		}
+	}
+	state.count += count;
+	state.frame_count++;
+	if (sample_selected && state.frame.Size() > 0) {
+		state.sampled_size += state.frame.Size();
+		state.sampled_compressed_size += state.frame.Compress(state.context, state.compressed_buffer);
+	}
+	return true;
+}
+
+idx_t ZSTDStorage::StringFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	if (state.string_count == 0 || state.sampled_size == 0) {
+		return DConstants::INVALID_INDEX;
+	}
+	auto average_length = (state.total_size - state.count * sizeof(uint32_t)) / state.string_count;
+	if (average_length < MINIMUM_AVERAGE_STRING_LENGTH) {
+		return DConstants::INVALID_INDEX;
+	}
+	auto compression_ratio = double(state.sampled_compressed_size) / double(state.sampled_size);
+	auto estimated_data_size = double(state.total_size) * compression_ratio;
+	auto estimated_directory_size = double(state.frame_count * sizeof(zstd_frame_entry_t));
+	auto num_blocks = estimated_data_size / double(state.info.GetBlockSize());
+	auto estimated_size = estimated_data_size + estimated_directory_size + num_blocks * sizeof(zstd_segment_header_t);
+	return LossyNumericCast<idx_t>(estimated_size * MINIMUM_COMPRESSION_RATIO);
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+class ZSTDCompressionState : public CompressionState {
+public:
+	ZSTDCompressionState(ColumnDataCheckpointer &checkpointer, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ZSTD)),
+	      context(duckdb_zstd::ZSTD_createCCtx()) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	~ZSTDCompressionState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		current_segment =
+		    ColumnSegment::CreateTransientSegment(db, type, row_start, info.GetBlockSize(), info.GetBlockSize());
+		current_segment->function = function;
+		directory.clear();
+		segment_data.clear();
+	}
+
+	idx_t GetSegmentSize(idx_t frame_count, idx_t data_size) const {
+		return sizeof(zstd_segment_header_t) + frame_count * sizeof(zstd_frame_entry_t) + data_size;
+	}
+
+	void Append(const string_t *str) {
+		idx_t string_size = str ? str->GetSize() : 0;
+		if (frame.Size() + string_size + sizeof(uint32_t) > GetMaximumFrameSize()) {
+			FlushFrame();
+		}
+		frame.Add(string_size ? str->GetData() : nullptr, string_size);
+		if (str) {
+			UncompressedStringStorage::UpdateStringStats(current_segment->stats, *str);
+		}
+	}
+
+	idx_t GetMaximumFrameSize() const {
+		return ZSTDStorage::GetMaximumFrameSize(info.GetBlockSize());
+	}
+
+	//! Compresses the current frame and adds it to the segment
+	void FlushFrame() {
+		if (frame.Count() == 0) {
+			return;
+		}
+		auto compressed_size = frame.Compress(context, compressed_buffer);
+		if (GetSegmentSize(directory.size() + 1, segment_data.size() + compressed_size) > info.GetBlockSize()) {
+			FlushSegment();
+			if (GetSegmentSize(1, compressed_size) > info.GetBlockSize()) {
+				throw InternalException("ZSTD string compression failed due to insufficient space in empty block");
+			}
+		}
+		zstd_frame_entry_t entry;
+		entry.row_start = NumericCast<uint32_t>(current_segment->count.load());
+		entry.offset = NumericCast<uint32_t>(segment_data.size());
+		entry.compressed_size = NumericCast<uint32_t>(compressed_size);
+		entry.uncompressed_size = NumericCast<uint32_t>(frame.Size());
+		directory.push_back(entry);
+		segment_data.insert(segment_data.end(), compressed_buffer.begin(),
+		                    compressed_buffer.begin() + NumericCast<int64_t>(compressed_size));
+		current_segment->count += frame.Count();
+		frame.Clear();
+	}
+
+	void FlushSegment(bool final = false) {
+		auto next_start = current_segment->start + current_segment->count;
+		auto segment_size = Finalize();
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), segment_size);
+		if (!final) {
+			CreateEmptySegment(next_start);
+		}
+	}
+
+	idx_t Finalize() {
+		auto &buffer_manager = BufferManager::GetBufferManager(current_segment->db);
+		auto handle = buffer_manager.Pin(current_segment->block);
+		auto base_ptr = handle.Ptr();
+
+		auto data_offset = GetSegmentSize(directory.size(), 0);
+		auto total_size = data_offset + segment_data.size();
+		D_ASSERT(total_size <= info.GetBlockSize());
+
+		Store<uint32_t>(NumericCast<uint32_t>(directory.size()), base_ptr);
+		Store<uint32_t>(0, base_ptr + sizeof(uint32_t));
+		for (auto &entry : directory) {
+			// the offsets are relative to the start of the segment
+			entry.offset += NumericCast<uint32_t>(data_offset);
+		}
+		if (!directory.empty()) {
+			memcpy(base_ptr + sizeof(zstd_segment_header_t), directory.data(),
+			       directory.size() * sizeof(zstd_frame_entry_t));
+		}
+		if (!segment_data.empty()) {
+			memcpy(base_ptr + data_offset, segment_data.data(), segment_data.size());
+		}
+		if (total_size >= info.GetCompactionFlushLimit()) {
+			return info.GetBlockSize();
+		}
+		return total_size;
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	duckdb_zstd::ZSTD_CCtx *context;
+
+	unique_ptr<ColumnSegment> current_segment;
+	//! The directory and compressed frames of the current segment
+	vector<zstd_frame_entry_t> directory;
+	vector<char> segment_data;
+
+	ZSTDFrameBuilder frame;
+	vector<char> compressed_buffer;
+};
+
+unique_ptr<CompressionState> ZSTDStorage::InitCompression(ColumnDataCheckpointer &checkpointer,
+                                                          unique_ptr<AnalyzeState> analyze_state_p) {
+	return make_uniq<ZSTDCompressionState>(checkpointer, analyze_state_p->info);
+}
+
+void ZSTDStorage::Compress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	// every vector starts a new frame, so that a scan of a vector decompresses (about) one frame
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		// nulls are stored as empty strings - the validity is stored separately
+		state.Append(vdata.validity.RowIsValid(idx) ? &data[idx] : nullptr);
+	}
+	state.FlushFrame();
+}
+
+void ZSTDStorage::FinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	state.FlushFrame();
+	state.FlushSegment(true);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ZSTDScanState : public StringScanState {
+	ZSTDFrameReader reader;
+};
+
+unique_ptr<SegmentScanState> ZSTDStorage::StringInitScan(ColumnSegment &segment) {
+	auto state = make_uniq<ZSTDScanState>();
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	state->handle = buffer_manager.Pin(segment.block);
+	return std::move(state);
+}
+
+void ZSTDStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                    idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto base_ptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+
+	D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	for (idx_t i = 0; i < scan_count; i++) {
+		scan_state.reader.ReadString(base_ptr, start + i, segment.count, result, result_data[result_offset + i]);
+	}
+}
+
+void ZSTDStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	StringScanPartial(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                                 idx_t result_idx) {
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	auto handle = buffer_manager.Pin(segment.block);
+	auto base_ptr = handle.Ptr() + segment.GetBlockOffset();
+
+	ZSTDFrameReader reader;
+	auto result_data = FlatVector::GetData<string_t>(result);
+	reader.ReadString(base_ptr, UnsafeNumericCast<idx_t>(row_id), segment.count, result, result_data[result_idx]);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ZSTDFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::VARCHAR);
+	return CompressionFunction(
+	    CompressionType::COMPRESSION_ZSTD, data_type, ZSTDStorage::StringInitAnalyze, ZSTDStorage::StringAnalyze,
+	    ZSTDStorage::StringFinalAnalyze, ZSTDStorage::InitCompression, ZSTDStorage::Compress,
+	    ZSTDStorage::FinalizeCompress, ZSTDStorage::StringInitScan, ZSTDStorage::StringScan,
+	    ZSTDStorage::StringScanPartial, ZSTDStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+}
+
+bool ZSTDFun::TypeIsSupported(const PhysicalType physical_type) {
+	return physical_type == PhysicalType::VARCHAR;
+}
+
+} // namespace duckdb
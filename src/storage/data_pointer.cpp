@@ -15,6 +15,7 @@ DataPointer::DataPointer(DataPointer &&other) noexcept : statistics(std::move(ot
 	std::swap(block_pointer, other.block_pointer);
 	std::swap(compression_type, other.compression_type);
 	std::swap(segment_state, other.segment_state);
+	std::swap(vector_statistics, other.vector_statistics);
 }
 
 DataPointer &DataPointer::operator=(DataPointer &&other) noexcept {
@@ -24,6 +25,7 @@ DataPointer &DataPointer::operator=(DataPointer &&other) noexcept {
 	std::swap(compression_type, other.compression_type);
 	std::swap(statistics, other.statistics);
 	std::swap(segment_state, other.segment_state);
+	std::swap(vector_statistics, other.vector_statistics);
 	return *this;
 }
 
@@ -52,7 +52,7 @@ DataTable::DataTable(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_m
 	auto types = GetTypes();
 	this->row_groups =
 	    make_shared_ptr<RowGroupCollection>(info, TableIOManager::Get(*this).GetBlockManagerForRowData(), types, 0);
-	if (data && data->row_group_count > 0) {
+	if (data && (data->row_group_count > 0 || !data->IsLoaded())) {
 		this->row_groups->Initialize(*data);
 	} else {
 		this->row_groups->InitializeEmpty();
@@ -250,7 +250,8 @@ void DataTable::InitializeScanWithOffset(TableScanState &state, const vector<col
 }
 
 idx_t DataTable::MaxThreads(ClientContext &context) {
-	idx_t parallel_scan_vector_count = Storage::ROW_GROUP_VECTOR_COUNT;
+	// parallel scans can split row groups into morsels of MIN_MORSEL_VECTOR_COUNT vectors
+	idx_t parallel_scan_vector_count = ParallelCollectionScanState::MIN_MORSEL_VECTOR_COUNT;
 	if (ClientConfig::GetConfig(context).verify_parallelism) {
 		parallel_scan_vector_count = 1;
 	}
@@ -336,6 +337,10 @@ void DataTable::CleanupAppend(transaction_t lowest_transaction, idx_t start, idx
 	row_groups->CleanupAppend(lowest_transaction, start, count);
 }
 
+void DataTable::CleanupDelete(transaction_t lowest_transaction, idx_t row) {
+	row_groups->CleanupDelete(lowest_transaction, row);
+}
+
 bool DataTable::IndexNameIsUnique(const string &name) {
 	return info->indexes.NameIsUnique(name);
 }
@@ -354,6 +359,18 @@ void DataTableInfo::SetTableName(string name) {
 	table = std::move(name);
 }
 
+ColumnDictionary &DataTableInfo::GetColumnDictionary(idx_t column_index) {
+	// note that column indexes can be shifted by ALTER TABLE - sharing a dictionary between columns is harmless
+	lock_guard<mutex> l(dictionary_lock);
+	if (column_index >= column_dictionaries.size()) {
+		column_dictionaries.resize(column_index + 1);
+	}
+	if (!column_dictionaries[column_index]) {
+		column_dictionaries[column_index] = make_uniq<ColumnDictionary>();
+	}
+	return *column_dictionaries[column_index];
+}
+
 string DataTable::GetTableName() const {
 	return info->GetTableName();
 }
@@ -381,9 +398,10 @@ TableStorageInfo DataTable::GetStorageInfo() {
 // Fetch
 //===--------------------------------------------------------------------===//
 void DataTable::Fetch(DuckTransaction &transaction, DataChunk &result, const vector<column_t> &column_ids,
-                      const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state) {
+                      const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state,
+                      optional_ptr<SelectionVector> fetch_sel) {
 	auto lock = info->checkpoint_lock.GetSharedLock();
-	row_groups->Fetch(transaction, result, column_ids, row_identifiers, fetch_count, state);
+	row_groups->Fetch(transaction, result, column_ids, row_identifiers, fetch_count, state, fetch_sel);
 }
 
 //===--------------------------------------------------------------------===//
@@ -1409,6 +1427,26 @@ void DataTable::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> d
 	row_groups->SetDistinct(column_id, std::move(distinct_stats));
 }
 
+unique_ptr<HistogramStatistics> DataTable::GetHistogram(column_t column_id) {
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return nullptr;
+	}
+	return row_groups->CopyHistogram(column_id);
+}
+
+void DataTable::SetHistogram(column_t column_id, unique_ptr<HistogramStatistics> histogram) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	row_groups->SetHistogram(column_id, std::move(histogram));
+}
+
+idx_t DataTable::GetStatisticsVersion() {
+	return row_groups->GetStatisticsVersion();
+}
+
+unique_ptr<ReservoirSample> DataTable::GetSample() {
+	return row_groups->GetSample();
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
@@ -109,13 +109,22 @@ void LocalTableStorage::WriteNewRowGroup() {
 	optimistic_writer.WriteNewRowGroup(*row_groups);
 }
 
-void LocalTableStorage::FlushBlocks() {
-	if (!merged_storage && row_groups->GetTotalRows() > Storage::ROW_GROUP_SIZE) {
+void LocalTableStorage::WriteLastRowGroup() {
+	if (!merged_storage && !wrote_last_row_group && row_groups->GetTotalRows() > Storage::ROW_GROUP_SIZE) {
 		optimistic_writer.WriteLastRowGroup(*row_groups);
+		wrote_last_row_group = true;
 	}
+}
+
+void LocalTableStorage::FlushBlocks() {
+	WriteLastRowGroup();
 	optimistic_writer.FinalFlush();
 }
 
+bool LocalTableStorage::IsBulkAppend() {
+	return row_groups->GetTotalRows() >= LocalStorage::MERGE_THRESHOLD && deleted_rows == 0;
+}
+
 ErrorData LocalTableStorage::AppendToIndexes(DuckTransaction &transaction, RowGroupCollection &source,
                                              TableIndexList &index_list, const vector<LogicalType> &table_types,
                                              row_t &start_row) {
@@ -258,6 +267,15 @@ bool LocalTableManager::IsEmpty() {
 	return table_storage.empty();
 }
 
+vector<shared_ptr<LocalTableStorage>> LocalTableManager::GetEntries() {
+	lock_guard<mutex> l(table_storage_lock);
+	vector<shared_ptr<LocalTableStorage>> result;
+	for (auto &entry : table_storage) {
+		result.push_back(entry.second);
+	}
+	return result;
+}
+
 shared_ptr<LocalTableStorage> LocalTableManager::MoveEntry(DataTable &table) {
 	lock_guard<mutex> l(table_storage_lock);
 	auto entry = table_storage.find(table);
@@ -452,8 +470,7 @@ void LocalStorage::Flush(DataTable &table, LocalTableStorage &storage, optional_
 	TableAppendState append_state;
 	table.AppendLock(append_state);
 	transaction.PushAppend(table, NumericCast<idx_t>(append_state.row_start), append_count);
-	if ((append_state.row_start == 0 || storage.row_groups->GetTotalRows() >= MERGE_THRESHOLD) &&
-	    storage.deleted_rows == 0) {
+	if ((append_state.row_start == 0 || storage.IsBulkAppend()) && storage.deleted_rows == 0) {
 		// table is currently empty OR we are bulk appending: move over the storage directly
 		// first flush any outstanding blocks
 		storage.FlushBlocks();
@@ -478,6 +495,16 @@ void LocalStorage::Flush(DataTable &table, LocalTableStorage &storage, optional_
 	table.VacuumIndexes();
 }
 
+void LocalStorage::PrepareCommit() {
+	// bulk appends are merged into the table as-is: we write their last row group now, instead of while holding the
+	// append lock of the table and the WAL lock, so that concurrent commits do not wait for each other's writes
+	for (auto &storage : table_manager.GetEntries()) {
+		if (!storage->is_dropped && storage->IsBulkAppend()) {
+			storage->WriteLastRowGroup();
+		}
+	}
+}
+
 void LocalStorage::Commit(optional_ptr<StorageCommitState> commit_state) {
 	// commit local storage
 	// iterate over all entries in the table storage map and commit them
@@ -567,13 +594,14 @@ void LocalStorage::ChangeType(DataTable &old_dt, DataTable &new_dt, idx_t change
 }
 
 void LocalStorage::FetchChunk(DataTable &table, Vector &row_ids, idx_t count, const vector<column_t> &col_ids,
-                              DataChunk &chunk, ColumnFetchState &fetch_state) {
+                              DataChunk &chunk, ColumnFetchState &fetch_state,
+                              optional_ptr<SelectionVector> fetch_sel) {
 	auto storage = table_manager.GetStorage(table);
 	if (!storage) {
 		throw InternalException("LocalStorage::FetchChunk - local storage not found");
 	}
 
-	storage->row_groups->Fetch(transaction, chunk, col_ids, row_ids, count, fetch_state);
+	storage->row_groups->Fetch(transaction, chunk, col_ids, row_ids, count, fetch_state, fetch_sel);
 }
 
 TableIndexList &LocalStorage::GetIndexes(DataTable &table) {
@@ -144,6 +144,9 @@ unique_ptr<AlterInfo> AlterTableInfo::Deserialize(Deserializer &deserializer) {
 	case AlterTableType::RENAME_TABLE:
 		result = RenameTableInfo::Deserialize(deserializer);
 		break;
+	case AlterTableType::SET_CLUSTER_BY:
+		result = SetClusterByInfo::Deserialize(deserializer);
+		break;
 	case AlterTableType::SET_DEFAULT:
 		result = SetDefaultInfo::Deserialize(deserializer);
 		break;
@@ -428,6 +431,17 @@ unique_ptr<AlterViewInfo> RenameViewInfo::Deserialize(Deserializer &deserializer
 	return std::move(result);
 }
 
+void SetClusterByInfo::Serialize(Serializer &serializer) const {
+	AlterTableInfo::Serialize(serializer);
+	serializer.WritePropertyWithDefault<vector<string>>(400, "cluster_by", cluster_by);
+}
+
+unique_ptr<AlterTableInfo> SetClusterByInfo::Deserialize(Deserializer &deserializer) {
+	auto result = duckdb::unique_ptr<SetClusterByInfo>(new SetClusterByInfo());
+	deserializer.ReadPropertyWithDefault<vector<string>>(400, "cluster_by", result->cluster_by);
+	return std::move(result);
+}
+
 void SetColumnCommentInfo::Serialize(Serializer &serializer) const {
 	AlterInfo::Serialize(serializer);
 	serializer.WriteProperty<CatalogType>(300, "catalog_entry_type", catalog_entry_type);
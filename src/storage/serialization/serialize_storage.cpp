@@ -9,6 +9,7 @@
 #include "duckdb/storage/table_storage_info.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/storage/statistics/histogram_statistics.hpp"
 
 namespace duckdb {
 
@@ -31,6 +32,7 @@ void DataPointer::Serialize(Serializer &serializer) const {
 	serializer.WriteProperty<CompressionType>(103, "compression_type", compression_type);
 	serializer.WriteProperty<BaseStatistics>(104, "statistics", statistics);
 	serializer.WritePropertyWithDefault<unique_ptr<ColumnSegmentState>>(105, "segment_state", segment_state);
+	serializer.WritePropertyWithDefault<vector<BaseStatistics>>(106, "vector_statistics", vector_statistics);
 }
 
 DataPointer DataPointer::Deserialize(Deserializer &deserializer) {
@@ -46,6 +48,7 @@ DataPointer DataPointer::Deserialize(Deserializer &deserializer) {
 	result.compression_type = compression_type;
 	deserializer.Set<CompressionType>(compression_type);
 	deserializer.ReadPropertyWithDefault<unique_ptr<ColumnSegmentState>>(105, "segment_state", result.segment_state);
+	deserializer.ReadPropertyWithDefault<vector<BaseStatistics>>(106, "vector_statistics", result.vector_statistics);
 	deserializer.Unset<CompressionType>();
 	return result;
 }
@@ -84,6 +87,26 @@ FixedSizeAllocatorInfo FixedSizeAllocatorInfo::Deserialize(Deserializer &deseria
 	return result;
 }
 
+void HistogramStatistics::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty<LogicalType>(100, "type", type);
+	serializer.WriteProperty<double>(101, "null_fraction", null_fraction);
+	serializer.WritePropertyWithDefault<vector<Value>>(102, "most_common_values", most_common_values);
+	serializer.WritePropertyWithDefault<vector<double>>(103, "most_common_frequencies", most_common_frequencies);
+	serializer.WritePropertyWithDefault<vector<Value>>(104, "boundaries", boundaries);
+	serializer.WriteProperty<double>(105, "histogram_fraction", histogram_fraction);
+}
+
+unique_ptr<HistogramStatistics> HistogramStatistics::Deserialize(Deserializer &deserializer) {
+	auto type = deserializer.ReadProperty<LogicalType>(100, "type");
+	auto null_fraction = deserializer.ReadProperty<double>(101, "null_fraction");
+	auto most_common_values = deserializer.ReadPropertyWithDefault<vector<Value>>(102, "most_common_values");
+	auto most_common_frequencies = deserializer.ReadPropertyWithDefault<vector<double>>(103, "most_common_frequencies");
+	auto boundaries = deserializer.ReadPropertyWithDefault<vector<Value>>(104, "boundaries");
+	auto histogram_fraction = deserializer.ReadProperty<double>(105, "histogram_fraction");
+	auto result = duckdb::unique_ptr<HistogramStatistics>(new HistogramStatistics(std::move(type), null_fraction, std::move(most_common_values), std::move(most_common_frequencies), std::move(boundaries), histogram_fraction));
+	return result;
+}
+
 void IndexStorageInfo::Serialize(Serializer &serializer) const {
 	serializer.WritePropertyWithDefault<string>(100, "name", name);
 	serializer.WritePropertyWithDefault<idx_t>(101, "root", root);
@@ -4,6 +4,7 @@
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -13,6 +14,14 @@
 #include <algorithm>
 #include <cstring>
 
+#if !defined(_WIN32) && !defined(DUCKDB_WASM)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define DUCKDB_MAPPED_DATABASE
+#endif
+
 namespace duckdb {
 
 const char MainHeader::MAGIC_BYTES[] = "DUCK";
@@ -147,6 +156,14 @@ SingleFileBlockManager::SingleFileBlockManager(AttachedDatabase &db, const strin
       iteration_count(0), options(options) {
 }
 
+SingleFileBlockManager::~SingleFileBlockManager() {
+#ifdef DUCKDB_MAPPED_DATABASE
+	if (mapped_data) {
+		munmap(mapped_data, mapped_size);
+	}
+#endif
+}
+
 FileOpenFlags SingleFileBlockManager::GetFileFlags(bool create_new) const {
 	FileOpenFlags result;
 	if (options.read_only) {
@@ -180,11 +197,27 @@ void SingleFileBlockManager::CreateNewDatabase() {
 	MainHeader main_header;
 	main_header.version_number = VERSION_NUMBER;
 	memset(main_header.flags, 0, sizeof(uint64_t) * 4);
+	if (options.checksum_type == ChecksumType::CRC32C) {
+		main_header.flags[0] |= MainHeader::CRC32C_CHECKSUM_FLAG;
+	}
+	unique_ptr<BlockEncryption> file_encryption;
+	if (!options.encryption_key.empty()) {
+		// every file gets its own salt, so the same key encrypts different files with different block keys
+		main_header.flags[0] |= MainHeader::ENCRYPTED_FLAG;
+		BlockEncryption::GenerateRandomData(db.GetDatabase(), data_ptr_cast(&main_header.flags[1]),
+		                                    BlockEncryption::SALT_SIZE);
+		file_encryption = CreateEncryption(main_header);
+		main_header.flags[3] = file_encryption->GetKeyCheck();
+	}
 
 	SerializeHeaderStructure<MainHeader>(main_header, header_buffer.buffer);
-	// now write the header to the file
+	// now write the header to the file - the main header always uses the legacy checksum and is never encrypted
+	// so we can find out which checksum and encryption the rest of the file uses
+	checksum_type = ChecksumType::LEGACY;
 	ChecksumAndWrite(header_buffer, 0);
 	header_buffer.Clear();
+	checksum_type = options.checksum_type;
+	encryption = std::move(file_encryption);
 
 	// write the database headers
 	// initialize meta_block and free_list to INVALID_BLOCK because the database file does not contain any actual
@@ -234,8 +267,35 @@ void SingleFileBlockManager::LoadExistingDatabase() {
 
 	MainHeader::CheckMagicBytes(*handle);
 	// otherwise, we check the metadata of the file
+	checksum_type = ChecksumType::LEGACY;
 	ReadAndChecksum(header_buffer, 0);
-	DeserializeHeaderStructure<MainHeader>(header_buffer.buffer);
+	auto main_header = DeserializeHeaderStructure<MainHeader>(header_buffer.buffer);
+	auto unsupported_flags = main_header.flags[0] & ~MainHeader::SUPPORTED_FLAGS;
+	if (unsupported_flags != 0) {
+		throw IOException("Cannot read database file \"%s\": the file uses storage features (flags %llu) that are not "
+		                  "supported by this version of DuckDB",
+		                  path, unsupported_flags);
+	}
+	if (main_header.flags[0] & MainHeader::CRC32C_CHECKSUM_FLAG) {
+		checksum_type = ChecksumType::CRC32C;
+	}
+	if (main_header.flags[0] & MainHeader::ENCRYPTED_FLAG) {
+		if (options.encryption_key.empty()) {
+			throw IOException("Cannot open database \"%s\": the database file is encrypted, but no ENCRYPTION_KEY or "
+			                  "ENCRYPTION_SECRET was provided",
+			                  path);
+		}
+		encryption = CreateEncryption(main_header);
+		if (encryption->GetKeyCheck() != main_header.flags[3]) {
+			throw IOException("Cannot open database \"%s\": wrong encryption key", path);
+		}
+		if (options.use_mmap) {
+			throw InvalidInputException("Cannot memory-map database \"%s\": the database file is encrypted", path);
+		}
+	} else if (!options.encryption_key.empty()) {
+		throw IOException("Cannot open database \"%s\" with an encryption key: the database file is not encrypted",
+		                  path);
+	}
 
 	// read the database headers from disk
 	DatabaseHeader h1;
@@ -257,15 +317,75 @@ void SingleFileBlockManager::LoadExistingDatabase() {
 		Initialize(h2, GetOptionalBlockAllocSize());
 	}
 	LoadFreeList();
+	if (options.use_mmap) {
+		MapFile();
+	}
+}
+
+void SingleFileBlockManager::MapFile() {
+	D_ASSERT(options.read_only);
+	if (!handle->OnDiskFile()) {
+		throw InvalidInputException("Cannot memory-map database \"%s\": only local database files can be mapped", path);
+	}
+#ifdef DUCKDB_MAPPED_DATABASE
+	auto file_size = handle->GetFileSize();
+	if (file_size <= BLOCK_START) {
+		// the file does not contain any blocks
+		return;
+	}
+	// map the file through a separate descriptor - the mapping stays valid after it is closed
+	auto fd = open(path.c_str(), O_RDONLY);
+	if (fd == -1) {
+		throw IOException("Cannot memory-map database \"%s\": %s", path, strerror(errno));
+	}
+	auto memory = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+	auto mmap_error = errno;
+	close(fd);
+	if (memory == MAP_FAILED) {
+		throw IOException("Cannot memory-map database \"%s\": %s", path, strerror(mmap_error));
+	}
+	mapped_data = static_cast<data_ptr_t>(memory);
+	mapped_size = file_size;
+	auto block_count = (mapped_size - BLOCK_START) / GetBlockAllocSize();
+	mapped_block_verified = unique_ptr<atomic<bool>[]>(new atomic<bool>[block_count]);
+	for (idx_t i = 0; i < block_count; i++) {
+		mapped_block_verified[i] = false;
+	}
+#else
+	throw NotImplementedException("Memory-mapping database files is not supported on this platform");
+#endif
+}
+
+uint64_t SingleFileBlockManager::ComputeChecksum(data_ptr_t buffer, idx_t size) const {
+	return Checksum(buffer, size, checksum_type);
+}
+
+unique_ptr<BlockEncryption> SingleFileBlockManager::CreateEncryption(const MainHeader &main_header) const {
+	return make_uniq<BlockEncryption>(BlockEncryption::GetEncryptionUtil(db.GetDatabase()), options.encryption_key,
+	                                  const_data_ptr_cast(&main_header.flags[1]));
+}
+
+void SingleFileBlockManager::DecryptBlock(data_ptr_t block_ptr, idx_t size, uint64_t location) const {
+	// the header of an encrypted block holds its synthetic IV instead of its checksum
+	auto synthetic_iv = Load<uint64_t>(block_ptr);
+	if (!encryption->Decrypt(block_ptr + Storage::DEFAULT_BLOCK_HEADER_SIZE, size, location, synthetic_iv)) {
+		throw IOException("Corrupt database file: the block at location %llu does not match its synthetic IV after "
+		                  "decryption",
+		                  location);
+	}
 }
 
 void SingleFileBlockManager::ReadAndChecksum(FileBuffer &block, uint64_t location) const {
 	// read the buffer from disk
 	block.Read(*handle, location);
+	if (encryption) {
+		DecryptBlock(block.InternalBuffer(), block.size, location);
+		return;
+	}
 
 	// compute the checksum
 	auto stored_checksum = Load<uint64_t>(block.InternalBuffer());
-	auto computed_checksum = Checksum(block.buffer, block.size);
+	auto computed_checksum = ComputeChecksum(block.buffer, block.size);
 
 	// verify the checksum
 	if (stored_checksum != computed_checksum) {
@@ -276,8 +396,14 @@ void SingleFileBlockManager::ReadAndChecksum(FileBuffer &block, uint64_t locatio
 }
 
 void SingleFileBlockManager::ChecksumAndWrite(FileBuffer &block, uint64_t location) const {
+	if (encryption) {
+		// the block can be read while it is written: encrypt it into a separate buffer
+		auto encrypted = encryption->EncryptBuffer(Allocator::Get(db), block, location);
+		encrypted->Write(*handle, location);
+		return;
+	}
 	// compute the checksum and write it to the start of the buffer (if not temp buffer)
-	uint64_t checksum = Checksum(block.buffer, block.size);
+	uint64_t checksum = ComputeChecksum(block.buffer, block.size);
 	Store<uint64_t>(checksum, block.InternalBuffer());
 	// now write the buffer
 	block.Write(*handle, location);
@@ -523,6 +649,30 @@ void SingleFileBlockManager::Read(Block &block) {
 	ReadAndChecksum(block, GetBlockLocation(block.id));
 }
 
+unique_ptr<Block> SingleFileBlockManager::MapBlock(block_id_t block_id) {
+	D_ASSERT(block_id >= 0);
+	auto location = GetBlockLocation(block_id);
+	if (!mapped_data || location + GetBlockAllocSize() > mapped_size) {
+		// the block lies outside of the mapping - it is read instead
+		return nullptr;
+	}
+	auto block_ptr = mapped_data + location;
+	auto block_idx = NumericCast<idx_t>(block_id);
+	if (!mapped_block_verified[block_idx]) {
+		// verify the checksum the first time the block is used - the mapping does not change afterwards
+		auto stored_checksum = Load<uint64_t>(block_ptr);
+		uint64_t computed_checksum = ComputeChecksum(block_ptr + Storage::DEFAULT_BLOCK_HEADER_SIZE, GetBlockSize());
+		if (stored_checksum != computed_checksum) {
+			throw IOException(
+			    "Corrupt database file: computed checksum %llu does not match stored checksum %llu in block "
+			    "at location %llu",
+			    computed_checksum, stored_checksum, location);
+		}
+		mapped_block_verified[block_idx] = true;
+	}
+	return make_uniq<MappedBlock>(Allocator::Get(db), block_id, block_ptr, GetBlockAllocSize());
+}
+
 void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) {
 	D_ASSERT(start_block >= 0);
 	D_ASSERT(block_count >= 1);
@@ -531,13 +681,17 @@ void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_blo
 	auto location = GetBlockLocation(start_block);
 	buffer.Read(*handle, location);
 
-	// for each of the blocks - verify the checksum
+	// for each of the blocks - verify the checksum, or decrypt the block
 	auto ptr = buffer.InternalBuffer();
 	for (idx_t i = 0; i < block_count; i++) {
-		// compute the checksum
 		auto start_ptr = ptr + i * GetBlockAllocSize();
+		if (encryption) {
+			DecryptBlock(start_ptr, GetBlockSize(), location + i * GetBlockAllocSize());
+			continue;
+		}
+		// compute the checksum
 		auto stored_checksum = Load<uint64_t>(start_ptr);
-		uint64_t computed_checksum = Checksum(start_ptr + Storage::DEFAULT_BLOCK_HEADER_SIZE, GetBlockSize());
+		uint64_t computed_checksum = ComputeChecksum(start_ptr + Storage::DEFAULT_BLOCK_HEADER_SIZE, GetBlockSize());
 		// verify the checksum
 		if (stored_checksum != computed_checksum) {
 			throw IOException(
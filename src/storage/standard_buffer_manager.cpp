@@ -3,9 +3,11 @@
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/io_profiler.hpp"
 #include "duckdb/common/set.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/query_telemetry.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/in_memory_block_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
@@ -14,6 +16,9 @@
 
 namespace duckdb {
 
+//! The maximum number of unrequested blocks a prefetch reads to coalesce the reads on either side of them
+static constexpr idx_t MAXIMUM_COALESCED_READ_GAP = 8;
+
 #ifdef DUCKDB_DEBUG_DESTROY_BLOCKS
 static void WriteGarbageIntoBuffer(FileBuffer &buffer) {
 	memset(buffer.buffer, 0xa5, buffer.size); // 0xa5 is default memory in debug mode
@@ -227,7 +232,11 @@ void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles,
 	for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
 		block_id_t block_id = first_block + NumericCast<block_id_t>(block_idx);
 		auto entry = load_map.find(block_id);
-		D_ASSERT(entry != load_map.end()); // if we allow gaps we might not return true here
+		if (entry == load_map.end()) {
+			// this block lies in a gap that was read to coalesce the reads on either side of it
+			IOProfiler::RecordPrefetchWaste(block_manager.GetBlockAllocSize());
+			continue;
+		}
 		auto &handle = handles[entry->second];
 
 		// reserve memory for the block
@@ -245,6 +254,7 @@ void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles,
 			if (handle->state == BlockState::BLOCK_LOADED) {
 				// the block is loaded already by another thread - free up the reservation and continue
 				reservation.Resize(0);
+				IOProfiler::RecordPrefetchWaste(block_manager.GetBlockAllocSize());
 				continue;
 			}
 			auto block_ptr =
@@ -259,29 +269,64 @@ void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles,
 void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 	// figure out which set of blocks we should load
 	map<block_id_t, idx_t> to_be_loaded;
+	set<block_id_t> temporary_to_be_loaded;
+	vector<idx_t> temporary_blocks;
 	for (idx_t block_idx = 0; block_idx < handles.size(); block_idx++) {
 		auto &handle = handles[block_idx];
 		lock_guard<mutex> lock(handle->lock);
-		if (handle->state != BlockState::BLOCK_LOADED) {
-			// need to load this block - add it to the map
-			to_be_loaded.insert(make_pair(handle->BlockId(), block_idx));
+		if (handle->state == BlockState::BLOCK_LOADED) {
+			continue;
+		}
+		if (handle->BlockId() >= MAXIMUM_BLOCK) {
+			// temporary blocks can only be loaded if they were written to a temporary file
+			if (handle->MustWriteToTemporaryFile() && temporary_to_be_loaded.insert(handle->BlockId()).second) {
+				temporary_blocks.push_back(block_idx);
+			}
+			continue;
 		}
+		// need to load this block - add it to the map
+		to_be_loaded.insert(make_pair(handle->BlockId(), block_idx));
+	}
+	// read the temporary blocks back ahead of time, they stay loaded after unpinning (until they are evicted again)
+	// this is only a suggestion, so we stop reading ahead once it would require evicting other blocks
+	for (auto &block_idx : temporary_blocks) {
+		auto &handle = handles[block_idx];
+		if (GetUsedMemory() + handle->GetMemoryUsage() > GetMaxMemory()) {
+			break;
+		}
+		Pin(handle);
 	}
 	if (to_be_loaded.empty()) {
 		// nothing to fetch
 		return;
 	}
+	auto &block_manager = handles[to_be_loaded.begin()->second]->block_manager;
+	if (block_manager.IsMemoryMapped()) {
+		// blocks point into the mapping when they are pinned - reading them ahead would only copy them
+		return;
+	}
+	// without the page cache, the operating system does not read ahead for us
+	// in that case we coalesce reads across small gaps, as long as at most half of the read data is wasted
+	const idx_t maximum_gap = block_manager.UsesDirectIO() ? MAXIMUM_COALESCED_READ_GAP : 0;
+	idx_t batch_blocks = 0;
+	idx_t batch_gap_blocks = 0;
+
 	// iterate over the blocks and perform bulk reads
 	block_id_t first_block = -1;
 	block_id_t previous_block_id = -1;
 	for (auto &entry : to_be_loaded) {
+		const auto gap = previous_block_id < 0 ? 0 : NumericCast<idx_t>(entry.first - previous_block_id - 1);
 		if (previous_block_id < 0) {
 			// this the first block we are seeing
 			first_block = entry.first;
 			previous_block_id = first_block;
-		} else if (previous_block_id + 1 == entry.first) {
-			// this block is adjacent to the previous block - add it to the batch read
+			batch_blocks = 1;
+		} else if (previous_block_id + 1 == entry.first ||
+		           (gap <= maximum_gap && batch_gap_blocks + gap < batch_blocks)) {
+			// this block is adjacent (or close enough) to the previous block - add it to the batch read
 			previous_block_id = entry.first;
+			batch_blocks++;
+			batch_gap_blocks += gap;
 		} else {
 			// this block is not adjacent to the previous block
 			// perform the batch read for the previous batch
@@ -290,6 +335,8 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 			// set the first_block and previous_block_id to the current block
 			first_block = entry.first;
 			previous_block_id = entry.first;
+			batch_blocks = 1;
+			batch_gap_blocks = 0;
 		}
 	}
 	// batch read the final batch
@@ -310,12 +357,14 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and set the BufferHandle
 			handle->readers++;
+			handle->reused_since_load = true;
 			buf = handle->Load();
 		}
 		required_memory = handle->memory_usage;
 	}
 
 	if (buf.IsValid()) {
+		buffer_pool.RecordPin(handle->tag, true);
 		return buf; // the block was already loaded, return it without holding the BlockHandle's lock
 	} else {
 		// evict blocks until we have space for the current block
@@ -330,12 +379,16 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
 			handle->readers++;
+			handle->reused_since_load = true;
 			reservation.Resize(0);
 			buf = handle->Load();
+			buffer_pool.RecordPin(handle->tag, true);
 		} else {
 			// now we can actually load the current block
 			D_ASSERT(handle->readers == 0);
 			buf = handle->Load(std::move(reusable_buffer));
+			buffer_pool.RecordPin(handle->tag, false);
+			handle->reused_since_load = false;
 			handle->readers = 1;
 			handle->memory_charge = std::move(reservation);
 			// in the case of a variable sized block, the buffer may be smaller than a full block.
@@ -366,6 +419,10 @@ void StandardBufferManager::AddToEvictionQueue(shared_ptr<BlockHandle> &handle)
 
 void StandardBufferManager::VerifyZeroReaders(shared_ptr<BlockHandle> &handle) {
 #ifdef DUCKDB_DEBUG_DESTROY_BLOCKS
+	if (!handle->buffer->IsReusable()) {
+		// the buffer does not own its memory (e.g., a read-only memory mapping of the database file)
+		return;
+	}
 	auto replacement_buffer = make_uniq<FileBuffer>(Allocator::Get(db), handle->buffer->type,
 	                                                handle->memory_usage - Storage::DEFAULT_BLOCK_HEADER_SIZE);
 	memcpy(replacement_buffer->buffer, handle->buffer->buffer, handle->buffer->size);
@@ -419,6 +476,8 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 		info.tag = MemoryTag(k);
 		info.size = buffer_pool.memory_usage.GetUsedMemory(MemoryTag(k), BufferPool::MemoryUsageCaches::FLUSH);
 		info.evicted_data = evicted_data_per_tag[k].load();
+		info.buffer_hits = buffer_pool.GetPinHits(MemoryTag(k));
+		info.buffer_misses = buffer_pool.GetPinMisses(MemoryTag(k));
 		result.push_back(info);
 	}
 	return result;
@@ -457,10 +516,16 @@ void StandardBufferManager::WriteTemporaryBuffer(MemoryTag tag, block_id_t block
 	// WriteTemporaryBuffer assumes that we never write a buffer below DEFAULT_BLOCK_ALLOC_SIZE.
 	RequireTemporaryDirectory();
 
+	// The spill is accounted to the query whose reservation forced the eviction
+	auto telemetry = QueryTelemetry::GetActive();
+	if (telemetry) {
+		telemetry->AddTemporaryBytesWritten(buffer.size);
+	}
+
 	// Append to a few grouped files.
 	if (buffer.size == GetBlockSize()) {
 		evicted_data_per_tag[uint8_t(tag)] += GetBlockSize();
-		temporary_directory.handle->GetTempFile().WriteTemporaryBuffer(block_id, buffer);
+		temporary_directory.handle->GetTempFile().WriteTemporaryBuffer(tag, block_id, buffer);
 		return;
 	}
 
@@ -473,6 +538,12 @@ void StandardBufferManager::WriteTemporaryBuffer(MemoryTag tag, block_id_t block
 	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
 	temporary_directory.handle->GetTempFile().IncreaseSizeOnDisk(buffer.AllocSize() + sizeof(idx_t));
 	handle->Write(&buffer.size, sizeof(idx_t), 0);
+	auto encryption = temporary_directory.handle->GetTempFile().GetEncryption();
+	if (encryption) {
+		auto encrypted = encryption->EncryptBuffer(Allocator::Get(db), buffer, NumericCast<uint64_t>(block_id));
+		encrypted->Write(*handle, sizeof(idx_t));
+		return;
+	}
 	buffer.Write(*handle, sizeof(idx_t));
 }
 
@@ -496,6 +567,10 @@ unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(MemoryTag tag,
 	// Allocate a buffer of the file's size and read the data into that buffer.
 	auto buffer = ReadTemporaryBufferInternal(*this, *handle, sizeof(idx_t), block_size, std::move(reusable_buffer));
 	handle.reset();
+	auto encryption = temporary_directory.handle->GetTempFile().GetEncryption();
+	if (encryption && !encryption->DecryptBuffer(*buffer, NumericCast<uint64_t>(id))) {
+		throw IOException("Corrupt encrypted temporary file \"%s\"", path);
+	}
 
 	// Delete the file and return the buffer.
 	DeleteTemporaryFile(block);
@@ -568,6 +643,7 @@ vector<TemporaryFileInformation> StandardBufferManager::GetTemporaryFiles() {
 		TemporaryFileInformation info;
 		info.path = name;
 		info.size = NumericCast<idx_t>(fs.GetFileSize(*handle));
+		info.uncompressed_size = info.size;
 		handle.reset();
 		result.push_back(info);
 	});
@@ -45,6 +45,21 @@ void ColumnStatistics::SetDistinct(unique_ptr<DistinctStatistics> distinct) {
 	this->distinct_stats = std::move(distinct);
 }
 
+bool ColumnStatistics::HasHistogram() {
+	return histogram.get();
+}
+
+HistogramStatistics &ColumnStatistics::Histogram() {
+	if (!histogram) {
+		throw InternalException("Histogram called without histogram");
+	}
+	return *histogram;
+}
+
+void ColumnStatistics::SetHistogram(unique_ptr<HistogramStatistics> histogram_p) {
+	this->histogram = std::move(histogram_p);
+}
+
 void ColumnStatistics::UpdateDistinctStatistics(Vector &v, idx_t count) {
 	if (!distinct_stats) {
 		return;
@@ -54,19 +69,28 @@ void ColumnStatistics::UpdateDistinctStatistics(Vector &v, idx_t count) {
 }
 
 shared_ptr<ColumnStatistics> ColumnStatistics::Copy() const {
-	return make_shared_ptr<ColumnStatistics>(stats.Copy(), distinct_stats ? distinct_stats->Copy() : nullptr);
+	auto result = make_shared_ptr<ColumnStatistics>(stats.Copy(), distinct_stats ? distinct_stats->Copy() : nullptr);
+	if (histogram) {
+		result->histogram = histogram->Copy();
+	}
+	return result;
 }
 
 void ColumnStatistics::Serialize(Serializer &serializer) const {
 	serializer.WriteProperty(100, "statistics", stats);
 	serializer.WritePropertyWithDefault(101, "distinct", distinct_stats, unique_ptr<DistinctStatistics>());
+	serializer.WritePropertyWithDefault(102, "histogram", histogram, unique_ptr<HistogramStatistics>());
 }
 
 shared_ptr<ColumnStatistics> ColumnStatistics::Deserialize(Deserializer &deserializer) {
 	auto stats = deserializer.ReadProperty<BaseStatistics>(100, "statistics");
 	auto distinct_stats = deserializer.ReadPropertyWithExplicitDefault<unique_ptr<DistinctStatistics>>(
 	    101, "distinct", unique_ptr<DistinctStatistics>());
-	return make_shared_ptr<ColumnStatistics>(std::move(stats), std::move(distinct_stats));
+	auto histogram = deserializer.ReadPropertyWithExplicitDefault<unique_ptr<HistogramStatistics>>(
+	    102, "histogram", unique_ptr<HistogramStatistics>());
+	auto result = make_shared_ptr<ColumnStatistics>(std::move(stats), std::move(distinct_stats));
+	result->histogram = std::move(histogram);
+	return result;
 }
 
 } // namespace duckdb
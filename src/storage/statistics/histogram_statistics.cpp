@@ -0,0 +1,241 @@
+#include "duckdb/storage/statistics/histogram_statistics.hpp"
+
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+HistogramStatistics::HistogramStatistics(LogicalType type_p, double null_fraction, vector<Value> most_common_values,
+                                         vector<double> most_common_frequencies, vector<Value> boundaries,
+                                         double histogram_fraction)
+    : type(std::move(type_p)), null_fraction(null_fraction), most_common_values(std::move(most_common_values)),
+      most_common_frequencies(std::move(most_common_frequencies)), boundaries(std::move(boundaries)),
+      histogram_fraction(histogram_fraction) {
+	D_ASSERT(this->most_common_values.size() == this->most_common_frequencies.size());
+}
+
+unique_ptr<HistogramStatistics> HistogramStatistics::Copy() const {
+	return make_uniq<HistogramStatistics>(type, null_fraction, most_common_values, most_common_frequencies, boundaries,
+	                                      histogram_fraction);
+}
+
+bool HistogramStatistics::TypeIsSupported(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::LIST:
+	case PhysicalType::STRUCT:
+	case PhysicalType::ARRAY:
+	case PhysicalType::BIT:
+	case PhysicalType::BOOL:
+	case PhysicalType::INTERVAL:
+		return false;
+	default:
+		break;
+	}
+	if (type.id() == LogicalTypeId::BLOB || type.id() == LogicalTypeId::ENUM) {
+		return false;
+	}
+	return true;
+}
+
+double HistogramStatistics::HistogramFractionBelow(const Value &value, bool inclusive) const {
+	if (boundaries.empty()) {
+		return 0;
+	}
+	if (value < boundaries[0] || (!inclusive && value == boundaries[0])) {
+		return 0;
+	}
+	if (value > boundaries.back() || (inclusive && value == boundaries.back())) {
+		return histogram_fraction;
+	}
+	// find the bucket the value falls into
+	auto bucket_count = boundaries.size() - 1;
+	auto entry = std::upper_bound(boundaries.begin(), boundaries.end(), value);
+	auto bucket = MinValue<idx_t>(NumericCast<idx_t>(entry - boundaries.begin()) - 1, bucket_count - 1);
+	auto &bucket_start = boundaries[bucket];
+	auto &bucket_end = boundaries[bucket + 1];
+	// assume the values are spread evenly over the bucket
+	double position = 0.5;
+	if (type.IsNumeric() && bucket_end > bucket_start) {
+		auto start = bucket_start.GetValue<double>();
+		auto end = bucket_end.GetValue<double>();
+		position = (value.GetValue<double>() - start) / (end - start);
+	}
+	position = MaxValue<double>(MinValue<double>(position, 1), 0);
+	return (static_cast<double>(bucket) + position) / static_cast<double>(bucket_count) * histogram_fraction;
+}
+
+bool HistogramStatistics::InRange(const Value &value, const Value &lower, bool lower_inclusive, const Value &upper,
+                                  bool upper_inclusive) {
+	if (!lower.IsNull() && (value < lower || (!lower_inclusive && value == lower))) {
+		return false;
+	}
+	if (!upper.IsNull() && (value > upper || (!upper_inclusive && value == upper))) {
+		return false;
+	}
+	return true;
+}
+
+double HistogramStatistics::EstimateEquality(const Value &value, idx_t distinct_count) const {
+	for (idx_t i = 0; i < most_common_values.size(); i++) {
+		if (most_common_values[i] == value) {
+			return most_common_frequencies[i];
+		}
+	}
+	if (boundaries.empty() || value < boundaries[0] || value > boundaries.back()) {
+		// the value is not in the sample, and lies outside of the sampled range
+		return 0;
+	}
+	// the value is not a most common value: assume the remaining values are equally common
+	auto bucket_count = boundaries.size() - 1;
+	idx_t remaining_distinct = distinct_count > most_common_values.size() ? distinct_count - most_common_values.size()
+	                                                                        : bucket_count;
+	remaining_distinct = MaxValue<idx_t>(remaining_distinct, 1);
+	return histogram_fraction / static_cast<double>(remaining_distinct);
+}
+
+double HistogramStatistics::EstimateRange(const Value &lower, bool lower_inclusive, const Value &upper,
+                                          bool upper_inclusive) const {
+	double result = 0;
+	for (idx_t i = 0; i < most_common_values.size(); i++) {
+		if (InRange(most_common_values[i], lower, lower_inclusive, upper, upper_inclusive)) {
+			result += most_common_frequencies[i];
+		}
+	}
+	double below_upper = upper.IsNull() ? histogram_fraction : HistogramFractionBelow(upper, upper_inclusive);
+	double below_lower = lower.IsNull() ? 0 : HistogramFractionBelow(lower, !lower_inclusive);
+	result += MaxValue<double>(below_upper - below_lower, 0);
+	return MinValue<double>(result, 1);
+}
+
+string HistogramStatistics::ToString() const {
+	return StringUtil::Format("[Most Common Values: %llu, Histogram Buckets: %llu]", most_common_values.size(),
+	                          boundaries.empty() ? 0 : boundaries.size() - 1);
+}
+
+HistogramSample::HistogramSample(LogicalType type_p) : type(std::move(type_p)), value_count(0), null_count(0) {
+}
+
+void HistogramSample::Update(Vector &update, idx_t count) {
+	UnifiedVectorFormat vdata;
+	update.ToUnifiedFormat(count, vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			null_count++;
+			continue;
+		}
+		value_count++;
+		if (sample.size() < SAMPLE_SIZE) {
+			sample.push_back(update.GetValue(i));
+			continue;
+		}
+		// reservoir sampling: replace a random element of the sample with a probability of SAMPLE_SIZE / value_count
+		auto position = LossyNumericCast<idx_t>(random.NextRandom() * static_cast<double>(value_count));
+		if (position < SAMPLE_SIZE) {
+			sample[position] = update.GetValue(i);
+		}
+	}
+}
+
+void HistogramSample::Merge(HistogramSample &other) {
+	if (other.value_count == 0) {
+		null_count += other.null_count;
+		return;
+	}
+	if (sample.size() + other.sample.size() <= SAMPLE_SIZE) {
+		// both samples fit: they hold all values that were offered to them
+		D_ASSERT(sample.size() == value_count && other.sample.size() == other.value_count);
+		for (auto &value : other.sample) {
+			sample.push_back(std::move(value));
+		}
+	} else {
+		// take a part of each sample proportional to the amount of values it represents
+		auto total_count = value_count + other.value_count;
+		auto own_count = LossyNumericCast<idx_t>(static_cast<double>(SAMPLE_SIZE) * static_cast<double>(value_count) /
+		                                         static_cast<double>(total_count));
+		own_count = MinValue<idx_t>(own_count, sample.size());
+		auto other_count = MinValue<idx_t>(SAMPLE_SIZE - own_count, other.sample.size());
+		// pick random elements by partially shuffling the samples
+		for (idx_t i = 0; i < own_count; i++) {
+			auto swap_idx = MinValue<idx_t>(
+			    random.NextRandomInteger(NumericCast<uint32_t>(i), NumericCast<uint32_t>(sample.size())),
+			    sample.size() - 1);
+			std::swap(sample[i], sample[swap_idx]);
+		}
+		sample.resize(own_count);
+		for (idx_t i = 0; i < other_count; i++) {
+			auto swap_idx = MinValue<idx_t>(
+			    random.NextRandomInteger(NumericCast<uint32_t>(i), NumericCast<uint32_t>(other.sample.size())),
+			    other.sample.size() - 1);
+			std::swap(other.sample[i], other.sample[swap_idx]);
+			sample.push_back(std::move(other.sample[i]));
+		}
+	}
+	value_count += other.value_count;
+	null_count += other.null_count;
+	other.sample.clear();
+}
+
+unique_ptr<HistogramStatistics> HistogramSample::Build() const {
+	if (sample.empty()) {
+		return nullptr;
+	}
+	auto total_count = static_cast<double>(value_count + null_count);
+	auto null_fraction = static_cast<double>(null_count) / total_count;
+	auto value_fraction = 1 - null_fraction;
+	auto sample_size = static_cast<double>(sample.size());
+
+	auto sorted = sample;
+	std::sort(sorted.begin(), sorted.end());
+
+	// count the occurrences of every distinct value in the sample
+	vector<pair<idx_t, idx_t>> runs; // (count, start)
+	for (idx_t i = 0; i < sorted.size();) {
+		idx_t end = i + 1;
+		while (end < sorted.size() && sorted[end] == sorted[i]) {
+			end++;
+		}
+		runs.emplace_back(end - i, i);
+		i = end;
+	}
+	// a value is a most common value if it would take up at least half a bucket of the histogram
+	auto min_count = MaxValue<idx_t>(sorted.size() / (2 * HISTOGRAM_BUCKETS), 2);
+	std::sort(runs.begin(), runs.end(),
+	          [](const pair<idx_t, idx_t> &a, const pair<idx_t, idx_t> &b) { return a.first > b.first; });
+	vector<Value> most_common_values;
+	vector<double> most_common_frequencies;
+	vector<bool> is_common(sorted.size(), false);
+	for (auto &run : runs) {
+		if (run.first < min_count || most_common_values.size() >= MAX_MOST_COMMON_VALUES) {
+			break;
+		}
+		most_common_values.push_back(sorted[run.second]);
+		most_common_frequencies.push_back(static_cast<double>(run.first) / sample_size * value_fraction);
+		for (idx_t i = run.second; i < run.second + run.first; i++) {
+			is_common[i] = true;
+		}
+	}
+
+	// build an equi-depth histogram over the remaining values
+	vector<reference<const Value>> remaining;
+	for (idx_t i = 0; i < sorted.size(); i++) {
+		if (!is_common[i]) {
+			remaining.push_back(sorted[i]);
+		}
+	}
+	vector<Value> boundaries;
+	if (!remaining.empty()) {
+		auto bucket_count = MaxValue<idx_t>(MinValue<idx_t>(HISTOGRAM_BUCKETS, remaining.size() - 1), 1);
+		for (idx_t bucket = 0; bucket <= bucket_count; bucket++) {
+			boundaries.push_back(remaining[bucket * (remaining.size() - 1) / bucket_count].get());
+		}
+	}
+	auto histogram_fraction = static_cast<double>(remaining.size()) / sample_size * value_fraction;
+	return make_uniq<HistogramStatistics>(type, null_fraction, std::move(most_common_values),
+	                                      std::move(most_common_frequencies), std::move(boundaries),
+	                                      histogram_fraction);
+}
+
+} // namespace duckdb
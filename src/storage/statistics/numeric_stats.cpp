@@ -143,11 +143,8 @@ bool ConstantValueInRange(T min, T max, T constant) {
 }
 
 template <class T>
-FilterPropagateResult CheckZonemapTemplated(const BaseStatistics &stats, ExpressionType comparison_type,
-                                            const Value &constant_value) {
-	T min_value = NumericStats::GetMinUnsafe<T>(stats);
-	T max_value = NumericStats::GetMaxUnsafe<T>(stats);
-	T constant = constant_value.GetValueUnsafe<T>();
+FilterPropagateResult NumericStats::CheckZonemap(ExpressionType comparison_type, T min_value, T max_value,
+                                                 T constant) {
 	switch (comparison_type) {
 	case ExpressionType::COMPARE_EQUAL:
 		if (ConstantExactRange(min_value, max_value, constant)) {
@@ -214,6 +211,24 @@ FilterPropagateResult CheckZonemapTemplated(const BaseStatistics &stats, Express
 	}
 }
 
+template FilterPropagateResult NumericStats::CheckZonemap(ExpressionType, int8_t, int8_t, int8_t);
+template FilterPropagateResult NumericStats::CheckZonemap(ExpressionType, int16_t, int16_t, int16_t);
+template FilterPropagateResult NumericStats::CheckZonemap(ExpressionType, int32_t, int32_t, int32_t);
+template FilterPropagateResult NumericStats::CheckZonemap(ExpressionType, int64_t, int64_t, int64_t);
+template FilterPropagateResult NumericStats::CheckZonemap(ExpressionType, uint8_t, uint8_t, uint8_t);
+template FilterPropagateResult NumericStats::CheckZonemap(ExpressionType, uint16_t, uint16_t, uint16_t);
+template FilterPropagateResult NumericStats::CheckZonemap(ExpressionType, uint32_t, uint32_t, uint32_t);
+template FilterPropagateResult NumericStats::CheckZonemap(ExpressionType, uint64_t, uint64_t, uint64_t);
+
+template <class T>
+FilterPropagateResult CheckZonemapTemplated(const BaseStatistics &stats, ExpressionType comparison_type,
+                                            const Value &constant_value) {
+	T min_value = NumericStats::GetMinUnsafe<T>(stats);
+	T max_value = NumericStats::GetMaxUnsafe<T>(stats);
+	T constant = constant_value.GetValueUnsafe<T>();
+	return NumericStats::CheckZonemap<T>(comparison_type, min_value, max_value, constant);
+}
+
 FilterPropagateResult NumericStats::CheckZonemap(const BaseStatistics &stats, ExpressionType comparison_type,
                                                  const Value &constant) {
 	D_ASSERT(constant.type() == stats.GetType());
@@ -10,4 +10,13 @@ SegmentStatistics::SegmentStatistics(LogicalType type) : statistics(BaseStatisti
 SegmentStatistics::SegmentStatistics(BaseStatistics stats) : statistics(std::move(stats)) {
 }
 
+vector<BaseStatistics> SegmentStatistics::CopyVectorStatistics() const {
+	vector<BaseStatistics> result;
+	result.reserve(vector_statistics.size());
+	for (auto &stats : vector_statistics) {
+		result.push_back(stats.Copy());
+	}
+	return result;
+}
+
 } // namespace duckdb
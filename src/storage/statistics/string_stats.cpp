@@ -228,6 +228,66 @@ FilterPropagateResult StringStats::CheckZonemap(const_data_ptr_t min_data, idx_t
 	}
 }
 
+FilterPropagateResult StringStats::CheckPrefix(const BaseStatistics &stats, const string &prefix) {
+	if (prefix.empty()) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	if (HasMaxStringLength(stats) && prefix.size() > MaxStringLength(stats)) {
+		// the prefix is longer than any of the strings
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	if (!CanContainUnicode(stats)) {
+		for (auto c : prefix) {
+			if (c & 0x80) {
+				// the prefix contains unicode characters but the strings do not
+				return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+			}
+		}
+	}
+	// strings starting with the prefix are in the range [prefix, upper_bound)
+	if (CheckZonemap(stats, ExpressionType::COMPARE_GREATERTHANOREQUALTO, prefix) ==
+	    FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	string upper_bound;
+	if (GetPrefixUpperBound(prefix, upper_bound) &&
+	    CheckZonemap(stats, ExpressionType::COMPARE_LESSTHAN, upper_bound) ==
+	        FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+bool StringStats::GetPrefixUpperBound(const string &prefix, string &upper_bound) {
+	// increment the last character of the prefix
+	// incrementing its last byte instead could result in an invalid UTF-8 string
+	upper_bound = prefix;
+	while (!upper_bound.empty()) {
+		auto start = upper_bound.size() - 1;
+		while (start > 0 && (static_cast<unsigned char>(upper_bound[start]) & 0xC0) == 0x80) {
+			start--;
+		}
+		int size;
+		auto codepoint = Utf8Proc::UTF8ToCodepoint(upper_bound.c_str() + start, size);
+		upper_bound.erase(start);
+		if (codepoint < 0) {
+			return false;
+		}
+		codepoint++;
+		if (codepoint >= 0xD800 && codepoint <= 0xDFFF) {
+			// skip the surrogates
+			codepoint = 0xE000;
+		}
+		char buffer[4];
+		if (codepoint <= 0x10FFFF && Utf8Proc::CodepointToUtf8(codepoint, size, buffer)) {
+			upper_bound.append(buffer, NumericCast<idx_t>(size));
+			return true;
+		}
+		// the last character is the largest code point: increment the character before it
+	}
+	return false;
+}
+
 static idx_t GetValidMinMaxSubstring(const_data_ptr_t data) {
 	for (idx_t i = 0; i < StringStatsData::MAX_STRING_MINMAX_SIZE; i++) {
 		if (data[i] == '\0') {
@@ -117,6 +117,13 @@ void StorageManager::Initialize(const optional_idx block_alloc_size) {
 
 	// Create or load the database from disk, if not in-memory mode.
 	LoadDatabase(block_alloc_size);
+
+	if (!in_memory && !read_only) {
+		background_checkpointer = make_uniq<BackgroundCheckpointer>(db);
+		if (DBConfig::Get(db).options.background_checkpoint) {
+			background_checkpointer->Start();
+		}
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -139,10 +146,14 @@ public:
 	}
 };
 
-SingleFileStorageManager::SingleFileStorageManager(AttachedDatabase &db, string path, bool read_only)
-    : StorageManager(db, std::move(path), read_only) {
+SingleFileStorageManager::SingleFileStorageManager(AttachedDatabase &db, string path, bool read_only, bool use_mmap,
+                                                   string encryption_key_p)
+    : StorageManager(db, std::move(path), read_only), use_mmap(use_mmap), encryption_key(std::move(encryption_key_p)) {
 }
 
+//! The serialization version from which new database files are checksummed using CRC32C
+static constexpr idx_t CRC32C_CHECKSUM_SERIALIZATION_VERSION = 4;
+
 void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size) {
 	if (InMemory()) {
 		block_manager = make_uniq<InMemoryBlockManager>(BufferManager::GetBufferManager(db), DEFAULT_BLOCK_ALLOC_SIZE);
@@ -161,7 +172,9 @@ void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size)
 	StorageManagerOptions options;
 	options.read_only = read_only;
 	options.use_direct_io = config.options.use_direct_io;
+	options.use_mmap = use_mmap;
 	options.debug_initialize = config.options.debug_initialize;
+	options.encryption_key = encryption_key;
 
 	// Check if the database file already exists.
 	// Note: a file can also exist if there was a ROLLBACK on a previous transaction creating that file.
@@ -177,6 +190,11 @@ void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size)
 			fs.RemoveFile(wal_path);
 		}
 
+		// new database files use CRC32C checksums if the storage version allows it
+		if (config.options.serialization_compatibility.Compare(CRC32C_CHECKSUM_SERIALIZATION_VERSION)) {
+			options.checksum_type = ChecksumType::CRC32C;
+		}
+
 		// Set the block allocation size for the new database file.
 		if (block_alloc_size.IsValid()) {
 			// Use the option provided by the user.
@@ -251,6 +269,7 @@ public:
 	void RevertCommit() override;
 	// Make the commit persistent
 	void FlushCommit() override;
+	void SyncCommit() override;
 
 	void AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
 	                     unique_ptr<PersistentCollectionData> row_group_data) override;
@@ -258,15 +277,18 @@ public:
 	bool HasRowGroupData() override;
 
 private:
+	StorageManager &storage;
 	idx_t initial_wal_size = 0;
 	idx_t initial_written = 0;
+	//! The sequence number of the commit in the WAL, set when the commit is flushed
+	idx_t commit_sequence = 0;
 	WriteAheadLog &wal;
 	WALCommitState state;
 	reference_map_t<DataTable, unordered_map<idx_t, OptimisticallyWrittenRowGroupData>> optimistically_written_data;
 };
 
 SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &storage, WriteAheadLog &wal)
-    : wal(wal), state(WALCommitState::IN_PROGRESS) {
+    : storage(storage), wal(wal), state(WALCommitState::IN_PROGRESS) {
 	auto initial_size = storage.GetWALSize();
 	initial_written = wal.GetTotalWritten();
 	initial_wal_size = initial_size;
@@ -298,10 +320,25 @@ void SingleFileStorageCommitState::FlushCommit() {
 	if (state != WALCommitState::IN_PROGRESS) {
 		return;
 	}
-	wal.Flush();
+	commit_sequence = wal.FlushCommit();
 	state = WALCommitState::FLUSHED;
 }
 
+void SingleFileStorageCommitState::SyncCommit() {
+	if (state != WALCommitState::FLUSHED) {
+		return;
+	}
+	auto &config = DBConfig::Get(storage.GetAttached());
+	if (!config.options.synchronous_commit) {
+		auto background_checkpointer = storage.GetBackgroundCheckpointer();
+		if (background_checkpointer && background_checkpointer->Start()) {
+			// the background thread syncs the WAL shortly
+			return;
+		}
+	}
+	wal.SyncCommit(commit_sequence);
+}
+
 void SingleFileStorageCommitState::AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
                                                    unique_ptr<PersistentCollectionData> row_group_data) {
 	if (row_group_data->HasUpdates()) {
@@ -397,9 +434,16 @@ vector<MetadataBlockInfo> SingleFileStorageManager::GetMetadataInfo() {
 }
 
 bool SingleFileStorageManager::AutomaticCheckpoint(idx_t estimated_wal_bytes) {
+	auto &config = DBConfig::Get(db);
 	auto initial_size = NumericCast<idx_t>(GetWALSize());
 	idx_t expected_wal_size = initial_size + estimated_wal_bytes;
-	return expected_wal_size > DBConfig::Get(db).options.checkpoint_wal_size;
+	bool threshold_reached = expected_wal_size > config.options.checkpoint_wal_size;
+	if (config.options.background_checkpoint && background_checkpointer && background_checkpointer->Start()) {
+		// leave the checkpoint to the background checkpointer so the committing transaction does not wait for it
+		background_checkpointer->NotifyCommit(threshold_reached);
+		return false;
+	}
+	return threshold_reached;
 }
 
 shared_ptr<TableIOManager> SingleFileStorageManager::GetTableIOManager(BoundCreateTableInfo *info /*info*/) {
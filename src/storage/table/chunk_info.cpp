@@ -48,7 +48,7 @@ unique_ptr<ChunkInfo> ChunkInfo::Read(ReadStream &reader) {
 	case ChunkInfoType::CONSTANT_INFO:
 		return ChunkConstantInfo::Read(reader);
 	case ChunkInfoType::VECTOR_INFO:
-		return ChunkVectorInfo::Read(reader);
+		return ChunkBitmapInfo::Read(reader);
 	default:
 		throw SerializationException("Could not deserialize Chunk Info Type: unrecognized type");
 	}
@@ -250,13 +250,9 @@ void ChunkVectorInfo::CommitAppend(transaction_t commit_id, idx_t start, idx_t e
 }
 
 bool ChunkVectorInfo::Cleanup(transaction_t lowest_transaction, unique_ptr<ChunkInfo> &result) const {
-	if (any_deleted) {
-		// if any rows are deleted we can't clean-up
-		return false;
-	}
 	// check if the insertion markers have to be used by all transactions going forward
 	if (!same_inserted_id) {
-		for (idx_t idx = 1; idx < STANDARD_VECTOR_SIZE; idx++) {
+		for (idx_t idx = 0; idx < STANDARD_VECTOR_SIZE; idx++) {
 			if (inserted[idx] > lowest_transaction) {
 				// transaction was inserted after the lowest transaction start
 				// we still need to use an older version - cannot compress
@@ -268,6 +264,22 @@ bool ChunkVectorInfo::Cleanup(transaction_t lowest_transaction, unique_ptr<Chunk
 		// we still need to use an older version - cannot compress
 		return false;
 	}
+	if (!any_deleted) {
+		return true;
+	}
+	// if all deletes are visible to every transaction we only need to know which rows are deleted
+	auto bitmap = make_uniq<ChunkBitmapInfo>(start);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+		if (deleted[i] == NOT_DELETED_ID) {
+			continue;
+		}
+		if (deleted[i] >= lowest_transaction) {
+			// the delete is not yet committed, or there are transactions that still need to see the row
+			return false;
+		}
+		bitmap->SetDeleted(i);
+	}
+	result = std::move(bitmap);
 	return true;
 }
 
@@ -329,4 +341,126 @@ unique_ptr<ChunkInfo> ChunkVectorInfo::Read(ReadStream &reader) {
 	return std::move(result);
 }
 
+//===--------------------------------------------------------------------===//
+// Bitmap info
+//===--------------------------------------------------------------------===//
+ChunkBitmapInfo::ChunkBitmapInfo(idx_t start) : ChunkInfo(start, ChunkInfoType::BITMAP_INFO) {
+	for (idx_t i = 0; i < WORD_COUNT; i++) {
+		deleted[i] = 0;
+	}
+}
+
+idx_t ChunkBitmapInfo::GetSelVector(SelectionVector &sel_vector, idx_t max_count) const {
+	idx_t count = 0;
+	for (idx_t word_idx = 0, word_start = 0; word_start < max_count; word_idx++, word_start += BITS_PER_WORD) {
+		auto word_end = MinValue<idx_t>(word_start + BITS_PER_WORD, max_count);
+		auto word = deleted[word_idx];
+		if (word == 0) {
+			// no deletes in this word
+			for (idx_t i = word_start; i < word_end; i++) {
+				sel_vector.set_index(count++, i);
+			}
+			continue;
+		}
+		for (idx_t i = word_start; i < word_end; i++) {
+			if (!(word & (uint64_t(1) << (i - word_start)))) {
+				sel_vector.set_index(count++, i);
+			}
+		}
+	}
+	return count;
+}
+
+idx_t ChunkBitmapInfo::GetSelVector(TransactionData transaction, SelectionVector &sel_vector, idx_t max_count) {
+	return GetSelVector(sel_vector, max_count);
+}
+
+idx_t ChunkBitmapInfo::GetCommittedSelVector(transaction_t min_start_id, transaction_t min_transaction_id,
+                                             SelectionVector &sel_vector, idx_t max_count) {
+	return GetSelVector(sel_vector, max_count);
+}
+
+bool ChunkBitmapInfo::Fetch(TransactionData transaction, row_t row) {
+	return !IsDeleted(UnsafeNumericCast<idx_t>(row));
+}
+
+void ChunkBitmapInfo::CommitAppend(transaction_t commit_id, idx_t start, idx_t end) {
+	throw InternalException("ChunkBitmapInfo::CommitAppend - bitmaps are only created for vectors without pending "
+	                        "appends");
+}
+
+idx_t ChunkBitmapInfo::GetCommittedDeletedCount(idx_t max_count) {
+	idx_t delete_count = 0;
+	for (idx_t word_idx = 0, word_start = 0; word_start < max_count; word_idx++, word_start += BITS_PER_WORD) {
+		auto word = deleted[word_idx];
+		auto bits_in_word = MinValue<idx_t>(BITS_PER_WORD, max_count - word_start);
+		if (bits_in_word < BITS_PER_WORD) {
+			word &= (uint64_t(1) << bits_in_word) - 1;
+		}
+		for (; word; word &= word - 1) {
+			delete_count++;
+		}
+	}
+	return delete_count;
+}
+
+bool ChunkBitmapInfo::HasDeletes() const {
+	for (idx_t i = 0; i < WORD_COUNT; i++) {
+		if (deleted[i]) {
+			return true;
+		}
+	}
+	return false;
+}
+
+unique_ptr<ChunkVectorInfo> ChunkBitmapInfo::ToVectorInfo() const {
+	auto result = make_uniq<ChunkVectorInfo>(start);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+		if (IsDeleted(i)) {
+			result->deleted[i] = 0;
+			result->any_deleted = true;
+		}
+	}
+	return result;
+}
+
+void ChunkBitmapInfo::Write(WriteStream &writer) const {
+	// bitmaps are written in the same format as vector infos
+	idx_t delete_count = 0;
+	ValidityMask mask(STANDARD_VECTOR_SIZE);
+	mask.Initialize(STANDARD_VECTOR_SIZE);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+		if (IsDeleted(i)) {
+			delete_count++;
+		} else {
+			mask.SetInvalid(i);
+		}
+	}
+	if (delete_count == 0) {
+		writer.Write<ChunkInfoType>(ChunkInfoType::EMPTY_INFO);
+		return;
+	}
+	if (delete_count == STANDARD_VECTOR_SIZE) {
+		writer.Write<ChunkInfoType>(ChunkInfoType::CONSTANT_INFO);
+		writer.Write<idx_t>(start);
+		return;
+	}
+	writer.Write<ChunkInfoType>(ChunkInfoType::VECTOR_INFO);
+	writer.Write<idx_t>(start);
+	mask.Write(writer, STANDARD_VECTOR_SIZE);
+}
+
+unique_ptr<ChunkInfo> ChunkBitmapInfo::Read(ReadStream &reader) {
+	auto start = reader.Read<idx_t>();
+	auto result = make_uniq<ChunkBitmapInfo>(start);
+	ValidityMask mask;
+	mask.Read(reader, STANDARD_VECTOR_SIZE);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+		if (mask.RowIsValid(i)) {
+			result->SetDeleted(i);
+		}
+	}
+	return std::move(result);
+}
+
 } // namespace duckdb
@@ -5,13 +5,42 @@
 #include "duckdb/storage/table/row_group.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/main/config.hpp"
 
 namespace duckdb {
 
 ColumnCheckpointState::ColumnCheckpointState(RowGroup &row_group, ColumnData &column_data,
                                              PartialBlockManager &partial_block_manager)
-    : row_group(row_group), column_data(column_data), partial_block_manager(partial_block_manager) {
+    : row_group(row_group), column_data(column_data), partial_block_manager(partial_block_manager),
+      write_vector_statistics(false), vector_statistics_start(0) {
+	auto &config = DBConfig::GetConfig(column_data.GetDatabase());
+	auto &compatibility = config.options.serialization_compatibility;
+	if (config.options.enable_vector_zonemaps &&
+	    compatibility.Compare(SegmentStatistics::VECTOR_STATISTICS_SERIALIZATION_VERSION)) {
+		auto stats_type = BaseStatistics::GetStatsType(column_data.type);
+		write_vector_statistics =
+		    stats_type == StatisticsType::NUMERIC_STATS || stats_type == StatisticsType::STRING_STATS;
+	}
+	if (config.options.enable_row_group_bloom_filters && !column_data.parent &&
+	    config.options.serialization_compatibility.Compare(BLOOM_FILTER_SERIALIZATION_VERSION)) {
+		// Bloom filters are only useful for equality lookups on high-cardinality columns
+		switch (column_data.type.InternalType()) {
+		case PhysicalType::INT16:
+		case PhysicalType::INT32:
+		case PhysicalType::INT64:
+		case PhysicalType::UINT16:
+		case PhysicalType::UINT32:
+		case PhysicalType::UINT64:
+		case PhysicalType::INT128:
+		case PhysicalType::UINT128:
+		case PhysicalType::VARCHAR:
+			bloom_filter = make_shared_ptr<BlockedBloomFilter>(row_group.count.load());
+			break;
+		default:
+			break;
+		}
+	}
 }
 
 ColumnCheckpointState::~ColumnCheckpointState() {
@@ -22,6 +51,125 @@ unique_ptr<BaseStatistics> ColumnCheckpointState::GetStatistics() {
 	return std::move(global_stats);
 }
 
+template <class T>
+static void UpdateNumericVectorStatistics(BaseStatistics &stats, UnifiedVectorFormat &vdata, idx_t offset,
+                                          idx_t count) {
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = offset; i < offset + count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			stats.SetHasNullFast();
+			continue;
+		}
+		stats.UpdateNumericStats<T>(data[idx]);
+	}
+}
+
+static void UpdateStringVectorStatistics(BaseStatistics &stats, UnifiedVectorFormat &vdata, idx_t offset,
+                                         idx_t count) {
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+	for (idx_t i = offset; i < offset + count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			stats.SetHasNullFast();
+			continue;
+		}
+		StringStats::Update(stats, data[idx]);
+	}
+}
+
+static void UpdateVectorStatisticsInternal(BaseStatistics &stats, UnifiedVectorFormat &vdata, idx_t offset,
+                                           idx_t count) {
+	switch (stats.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		UpdateNumericVectorStatistics<int8_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::INT16:
+		UpdateNumericVectorStatistics<int16_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::INT32:
+		UpdateNumericVectorStatistics<int32_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::INT64:
+		UpdateNumericVectorStatistics<int64_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::UINT8:
+		UpdateNumericVectorStatistics<uint8_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::UINT16:
+		UpdateNumericVectorStatistics<uint16_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::UINT32:
+		UpdateNumericVectorStatistics<uint32_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::UINT64:
+		UpdateNumericVectorStatistics<uint64_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::INT128:
+		UpdateNumericVectorStatistics<hugeint_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::UINT128:
+		UpdateNumericVectorStatistics<uhugeint_t>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::FLOAT:
+		UpdateNumericVectorStatistics<float>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::DOUBLE:
+		UpdateNumericVectorStatistics<double>(stats, vdata, offset, count);
+		break;
+	case PhysicalType::VARCHAR:
+		UpdateStringVectorStatistics(stats, vdata, offset, count);
+		break;
+	default:
+		throw InternalException("Unsupported type for vector statistics");
+	}
+}
+
+void ColumnCheckpointState::UpdateBloomFilter(Vector &scan_vector, idx_t count) {
+	if (!bloom_filter || count == 0) {
+		return;
+	}
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(scan_vector, hashes, count);
+	hashes.Flatten(count);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	for (idx_t i = 0; i < count; i++) {
+		// NULL values never match an equality filter
+		if (vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+			bloom_filter->InsertHash(hash_data[i]);
+		}
+	}
+}
+
+void ColumnCheckpointState::UpdateVectorStatistics(Vector &scan_vector, idx_t row_start, idx_t count) {
+	if (!write_vector_statistics || count == 0) {
+		return;
+	}
+	static constexpr idx_t VECTOR_SIZE = SegmentStatistics::VECTOR_STATISTICS_SIZE;
+	if (vector_statistics.empty()) {
+		vector_statistics_start = row_start / VECTOR_SIZE;
+	}
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	idx_t offset = 0;
+	while (offset < count) {
+		// update the statistics of the vector that contains this row with the rows up to the end of that vector
+		auto vector_idx = (row_start + offset) / VECTOR_SIZE;
+		auto vector_count = MinValue<idx_t>(count - offset, (vector_idx + 1) * VECTOR_SIZE - (row_start + offset));
+		D_ASSERT(vector_idx >= vector_statistics_start);
+		while (vector_statistics.size() <= vector_idx - vector_statistics_start) {
+			vector_statistics.push_back(BaseStatistics::CreateEmpty(column_data.type));
+		}
+		UpdateVectorStatisticsInternal(vector_statistics[vector_idx - vector_statistics_start], vdata, offset,
+		                               vector_count);
+		offset += vector_count;
+	}
+}
+
 PartialBlockForCheckpoint::PartialBlockForCheckpoint(ColumnData &data, ColumnSegment &segment, PartialBlockState state,
                                                      BlockManager &block_manager)
     : PartialBlock(state, block_manager, segment.block) {
@@ -174,6 +322,17 @@ void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_
 		segment->ConvertToPersistent(nullptr, INVALID_BLOCK);
 	}
 
+	if (write_vector_statistics && !segment->stats.statistics.IsConstant()) {
+		// copy the statistics of the vectors that overlap the segment
+		auto first_vector = segment->start / SegmentStatistics::VECTOR_STATISTICS_SIZE;
+		auto last_vector = (segment->start + tuple_count - 1) / SegmentStatistics::VECTOR_STATISTICS_SIZE;
+		D_ASSERT(first_vector >= vector_statistics_start);
+		D_ASSERT(last_vector - vector_statistics_start < vector_statistics.size());
+		for (auto vector_idx = first_vector; vector_idx <= last_vector; vector_idx++) {
+			segment->stats.vector_statistics.push_back(vector_statistics[vector_idx - vector_statistics_start].Copy());
+		}
+	}
+
 	// construct the data pointer
 	DataPointer data_pointer(segment->stats.statistics.Copy());
 	data_pointer.block_pointer.block_id = block_id;
@@ -188,6 +347,7 @@ void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_
 	if (segment->function.get().serialize_state) {
 		data_pointer.segment_state = segment->function.get().serialize_state(*segment);
 	}
+	data_pointer.vector_statistics = segment->stats.CopyVectorStatistics();
 
 	// append the segment to the new segment tree
 	new_tree.AppendSegment(std::move(segment));
@@ -197,6 +357,7 @@ void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_
 PersistentColumnData ColumnCheckpointState::ToPersistentData() {
 	PersistentColumnData data(column_data.type.InternalType());
 	data.pointers = std::move(data_pointers);
+	data.bloom_filter = bloom_filter;
 	return data;
 }
 
@@ -1,9 +1,14 @@
 #include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/compression_function.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
@@ -63,6 +68,15 @@ bool ColumnData::HasUpdates() const {
 	return updates.get();
 }
 
+bool ColumnData::HasUpdates(idx_t row_start, idx_t count) const {
+	lock_guard<mutex> update_guard(update_lock);
+	if (!updates || count == 0) {
+		return false;
+	}
+	D_ASSERT(row_start >= start);
+	return updates->HasUpdates(row_start - start, row_start - start + count - 1);
+}
+
 void ColumnData::ClearUpdates() {
 	lock_guard<mutex> update_guard(update_lock);
 	updates.reset();
@@ -80,6 +94,7 @@ void ColumnData::InitializeScan(ColumnScanState &state) {
 	state.initialized = false;
 	state.scan_state.reset();
 	state.last_offset = 0;
+	state.column_dictionary = GetColumnDictionary();
 }
 
 void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx) {
@@ -90,12 +105,25 @@ void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx)
 	state.initialized = false;
 	state.scan_state.reset();
 	state.last_offset = 0;
+	state.column_dictionary = GetColumnDictionary();
+}
+
+optional_ptr<ColumnDictionary> ColumnData::GetColumnDictionary() {
+	if (type.InternalType() != PhysicalType::VARCHAR) {
+		return nullptr;
+	}
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	if (!config.options.global_string_dictionary) {
+		return nullptr;
+	}
+	return info.GetColumnDictionary(column_index);
 }
 
 ScanVectorType ColumnData::GetVectorScanType(ColumnScanState &state, idx_t scan_count) {
-	if (HasUpdates()) {
-		// if we have updates we need to merge in the updates
+	if (HasUpdates(state.row_index, scan_count)) {
+		// if the vector has updates we need to merge in the updates
 		// always need to scan flat vectors
+		// vectors without updates can still be emitted in their compressed form
 		return ScanVectorType::SCAN_FLAT_VECTOR;
 	}
 	// check if the current segment has enough data remaining
@@ -137,19 +165,7 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 	if (scan_type == ScanVectorType::SCAN_FLAT_VECTOR && result.GetVectorType() != VectorType::FLAT_VECTOR) {
 		throw InternalException("ScanVector called with SCAN_FLAT_VECTOR but result is not a flat vector");
 	}
-	state.previous_states.clear();
-	if (!state.initialized) {
-		D_ASSERT(state.current);
-		state.current->InitializeScan(state);
-		state.internal_index = state.current->start;
-		state.initialized = true;
-	}
-	D_ASSERT(data.HasSegment(state.current));
-	D_ASSERT(state.internal_index <= state.row_index);
-	if (state.internal_index < state.row_index) {
-		state.current->Skip(state);
-	}
-	D_ASSERT(state.current->type == type);
+	BeginScanVectorInternal(state);
 	idx_t initial_remaining = remaining;
 	while (remaining > 0) {
 		D_ASSERT(state.row_index >= state.current->start &&
@@ -188,6 +204,43 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 	return initial_remaining - remaining;
 }
 
+void ColumnData::BeginScanVectorInternal(ColumnScanState &state) {
+	state.previous_states.clear();
+	if (!state.initialized) {
+		D_ASSERT(state.current);
+		state.current->InitializeScan(state);
+		state.internal_index = state.current->start;
+		state.initialized = true;
+	}
+	D_ASSERT(data.HasSegment(state.current));
+	D_ASSERT(state.internal_index <= state.row_index);
+	if (state.internal_index < state.row_index) {
+		state.current->Skip(state);
+	}
+	D_ASSERT(state.current->type == type);
+}
+
+bool ColumnData::CanFilterInSegment(ColumnScanState &state, idx_t scan_count, const TableFilter &filter) {
+	if ((state.scan_options && state.scan_options->force_fetch_row) || HasUpdates(state.row_index, scan_count)) {
+		return false;
+	}
+	auto segment = state.current;
+	if (!segment || state.row_index < segment->start ||
+	    state.row_index + scan_count > segment->start + segment->count) {
+		// the vector is not (entirely) stored in the current segment
+		return false;
+	}
+	return segment->CanFilter(filter);
+}
+
+void ColumnData::FilterInSegment(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+                                 idx_t &count, const TableFilter &filter) {
+	BeginScanVectorInternal(state);
+	state.current->Filter(state, scan_count, result, sel, count, filter);
+	state.row_index += scan_count;
+	state.internal_index = state.row_index;
+}
+
 unique_ptr<BaseStatistics> ColumnData::GetUpdateStatistics() {
 	lock_guard<mutex> update_guard(update_lock);
 	return updates ? updates->GetStatistics() : nullptr;
@@ -367,12 +420,112 @@ FilterPropagateResult ColumnData::CheckZonemap(ColumnScanState &state, TableFilt
 	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
 }
 
+FilterPropagateResult ColumnData::CheckVectorZonemap(ColumnScanState &state, TableFilter &filter, idx_t row_start,
+                                                     idx_t count) {
+	if (!state.current || count == 0) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	optional_ptr<ColumnSegment> segment = state.current;
+	if (row_start >= segment->start + segment->count) {
+		// the scan is positioned at the end of the previous segment
+		segment = data.GetNextSegment(segment.get());
+		if (!segment) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+	}
+	auto &vector_stats = segment->stats.vector_statistics;
+	if (vector_stats.empty() || row_start < segment->start || row_start + count > segment->start + segment->count) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	if (HasUpdates(row_start, count)) {
+		// the vector statistics do not include updates
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto first_vector = segment->start / SegmentStatistics::VECTOR_STATISTICS_SIZE;
+	auto start_idx = row_start / SegmentStatistics::VECTOR_STATISTICS_SIZE - first_vector;
+	auto end_idx = (row_start + count - 1) / SegmentStatistics::VECTOR_STATISTICS_SIZE - first_vector;
+	if (end_idx >= vector_stats.size()) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	for (idx_t idx = start_idx; idx <= end_idx; idx++) {
+		if (filter.CheckStatistics(vector_stats[idx]) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+	}
+	return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+}
+
+static bool BloomFilterMayContain(const BlockedBloomFilter &bloom_filter, const LogicalType &type,
+                                  const Value &constant) {
+	if (constant.IsNull() || constant.type() != type) {
+		return true;
+	}
+	Vector constant_vector(constant);
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(constant_vector, hashes, 1);
+	return bloom_filter.LookupHash(*ConstantVector::GetData<hash_t>(hashes));
+}
+
+//! Returns false if no value in the Bloom filter can match the filter
+static bool BloomFilterMayMatch(const BlockedBloomFilter &bloom_filter, const LogicalType &type,
+                                const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL) {
+			return true;
+		}
+		return BloomFilterMayContain(bloom_filter, type, constant_filter.constant);
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		for (auto &value : in_filter.values) {
+			if (BloomFilterMayContain(bloom_filter, type, value)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!BloomFilterMayMatch(bloom_filter, type, *child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (BloomFilterMayMatch(bloom_filter, type, *child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return true;
+	}
+}
+
 FilterPropagateResult ColumnData::CheckZonemap(TableFilter &filter) {
 	if (!stats) {
 		throw InternalException("ColumnData::CheckZonemap called on a column without stats");
 	}
 	lock_guard<mutex> l(stats_lock);
-	return filter.CheckStatistics(stats->statistics);
+	auto prune_result = filter.CheckStatistics(stats->statistics);
+	if (prune_result == FilterPropagateResult::NO_PRUNING_POSSIBLE && bloom_filter &&
+	    !BloomFilterMayMatch(*bloom_filter, type, filter)) {
+		// the values that the filter looks for are not in the Bloom filter
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	return prune_result;
+}
+
+shared_ptr<BlockedBloomFilter> ColumnData::GetBloomFilter() {
+	lock_guard<mutex> l(stats_lock);
+	return bloom_filter;
 }
 
 unique_ptr<BaseStatistics> ColumnData::GetStatistics() {
@@ -400,6 +553,11 @@ void ColumnData::MergeIntoStatistics(BaseStatistics &other) {
 }
 
 void ColumnData::InitializeAppend(ColumnAppendState &state) {
+	{
+		// the Bloom filter does not contain the appended values
+		lock_guard<mutex> l(stats_lock);
+		bloom_filter.reset();
+	}
 	auto l = data.Lock();
 	if (data.IsEmpty(l)) {
 		// no segments yet, append an empty segment
@@ -497,6 +655,11 @@ void ColumnData::Update(TransactionData transaction, idx_t column_index, Vector
 	auto fetch_count = Fetch(state, row_ids[0], base_vector);
 
 	base_vector.Flatten(fetch_count);
+	{
+		// the Bloom filter does not contain the updated values
+		lock_guard<mutex> l(stats_lock);
+		bloom_filter.reset();
+	}
 	UpdateInternal(transaction, column_index, update_vector, row_ids, update_count, base_vector);
 }
 
@@ -576,6 +739,10 @@ unique_ptr<ColumnCheckpointState> ColumnData::Checkpoint(RowGroup &row_group, Co
 	// replace the old tree with the new one
 	data.Replace(l, checkpoint_state->new_tree);
 	ClearUpdates();
+	{
+		lock_guard<mutex> stats_guard(stats_lock);
+		bloom_filter = checkpoint_state->bloom_filter;
+	}
 
 	return checkpoint_state;
 }
@@ -602,9 +769,11 @@ void ColumnData::InitializeColumn(PersistentColumnData &column_data, BaseStatist
 		    GetDatabase(), block_manager, data_pointer.block_pointer.block_id, data_pointer.block_pointer.offset, type,
 		    data_pointer.row_start, data_pointer.tuple_count, data_pointer.compression_type,
 		    std::move(data_pointer.statistics), std::move(data_pointer.segment_state));
+		segment->stats.vector_statistics = std::move(data_pointer.vector_statistics);
 
 		data.AppendSegment(std::move(segment));
 	}
+	bloom_filter = std::move(column_data.bloom_filter);
 }
 
 bool ColumnData::IsPersistent() {
@@ -653,6 +822,7 @@ void PersistentColumnData::Serialize(Serializer &serializer) const {
 		serializer.WriteList(102, "sub_columns", child_columns.size() - 1,
 		                     [&](Serializer::List &list, idx_t i) { list.WriteElement(child_columns[i + 1]); });
 	}
+	serializer.WritePropertyWithDefault(103, "bloom_filter", bloom_filter);
 }
 
 void PersistentColumnData::DeserializeField(Deserializer &deserializer, field_id_t field_idx, const char *field_name,
@@ -691,6 +861,7 @@ PersistentColumnData PersistentColumnData::Deserialize(Deserializer &deserialize
 	default:
 		break;
 	}
+	deserializer.ReadPropertyWithDefault(103, "bloom_filter", result.bloom_filter);
 	return result;
 }
 
@@ -760,6 +931,7 @@ bool PersistentCollectionData::HasUpdates() const {
 PersistentColumnData ColumnData::Serialize() {
 	PersistentColumnData result(type.InternalType(), GetDataPointers());
 	result.has_updates = HasUpdates();
+	result.bloom_filter = GetBloomFilter();
 	return result;
 }
 
@@ -41,21 +41,32 @@ ColumnCheckpointState &ColumnDataCheckpointer::GetCheckpointState() {
 	return state;
 }
 
-void ColumnDataCheckpointer::ScanSegments(const std::function<void(Vector &, idx_t)> &callback) {
+void ColumnDataCheckpointer::ScanSegments(const std::function<void(Vector &, idx_t)> &callback,
+                                          idx_t vector_interval) {
 	Vector scan_vector(intermediate.GetType(), nullptr);
+	idx_t vector_idx = 0;
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
 		auto &segment = *nodes[segment_idx].node;
 		ColumnScanState scan_state;
 		scan_state.current = &segment;
 		segment.InitializeScan(scan_state);
+		scan_state.internal_index = segment.start;
 
 		for (idx_t base_row_index = 0; base_row_index < segment.count; base_row_index += STANDARD_VECTOR_SIZE) {
+			if (vector_idx++ % vector_interval != 0) {
+				// this vector is not part of the sample
+				continue;
+			}
 			scan_vector.Reference(intermediate);
 
 			idx_t count = MinValue<idx_t>(segment.count - base_row_index, STANDARD_VECTOR_SIZE);
 			scan_state.row_index = segment.start + base_row_index;
+			if (scan_state.internal_index < scan_state.row_index) {
+				segment.Skip(scan_state);
+			}
 
 			col_data.CheckpointScan(segment, scan_state, row_group.start, count, scan_vector);
+			scan_state.internal_index = scan_state.row_index + count;
 
 			callback(scan_vector, count);
 		}
@@ -109,6 +120,90 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 	    config.options.force_compression != CompressionType::COMPRESSION_AUTO) {
 		forced_method = ForceCompression(compression_functions, config.options.force_compression);
 	}
+	if (forced_method != CompressionType::COMPRESSION_AUTO) {
+		return AnalyzeCompressionMethods(forced_method, compression_idx);
+	}
+
+	// analyzing every method on all of the data is expensive (e.g. zstd compresses the data while analyzing)
+	// for larger columns we first select the best method on a sample, and only analyze that method on all of the data
+	auto sample_idx = SampleCompressionMethods();
+	if (sample_idx != DConstants::INVALID_INDEX) {
+		auto candidates = compression_functions;
+		for (idx_t i = 0; i < compression_functions.size(); i++) {
+			if (i != sample_idx) {
+				compression_functions[i] = nullptr;
+			}
+		}
+		auto state = AnalyzeCompressionMethods(forced_method, compression_idx);
+		if (state) {
+			return state;
+		}
+		// the best method on the sample cannot be used for all of the data - fall back to analyzing the other methods
+		compression_functions = std::move(candidates);
+		compression_functions[sample_idx] = nullptr;
+	}
+	return AnalyzeCompressionMethods(forced_method, compression_idx);
+}
+
+idx_t ColumnDataCheckpointer::SampleCompressionMethods() {
+	idx_t vector_count = 0;
+	for (auto &node : nodes) {
+		vector_count += (node.node->count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+	}
+	if (vector_count < COMPRESSION_SAMPLE_MIN_VECTORS) {
+		return DConstants::INVALID_INDEX;
+	}
+	idx_t candidate_count = 0;
+	vector<unique_ptr<AnalyzeState>> analyze_states;
+	analyze_states.reserve(compression_functions.size());
+	for (idx_t i = 0; i < compression_functions.size(); i++) {
+		if (!compression_functions[i]) {
+			analyze_states.push_back(nullptr);
+			continue;
+		}
+		analyze_states.push_back(compression_functions[i]->init_analyze(col_data, col_data.type.InternalType()));
+		candidate_count++;
+	}
+	if (candidate_count < 2) {
+		// nothing to select
+		return DConstants::INVALID_INDEX;
+	}
+
+	ScanSegments(
+	    [&](Vector &scan_vector, idx_t count) {
+		    for (idx_t i = 0; i < compression_functions.size(); i++) {
+			    if (!analyze_states[i]) {
+				    continue;
+			    }
+			    if (!compression_functions[i]->analyze(*analyze_states[i], scan_vector, count)) {
+				    // this method cannot be used for the sample, so it cannot be used for all of the data either
+				    compression_functions[i] = nullptr;
+				    analyze_states[i].reset();
+			    }
+		    }
+	    },
+	    COMPRESSION_SAMPLE_INTERVAL);
+
+	idx_t sample_idx = DConstants::INVALID_INDEX;
+	idx_t best_score = NumericLimits<idx_t>::Maximum();
+	for (idx_t i = 0; i < compression_functions.size(); i++) {
+		if (!analyze_states[i]) {
+			continue;
+		}
+		auto score = compression_functions[i]->final_analyze(*analyze_states[i]);
+		if (score == DConstants::INVALID_INDEX) {
+			continue;
+		}
+		if (score < best_score) {
+			sample_idx = i;
+			best_score = score;
+		}
+	}
+	return sample_idx;
+}
+
+unique_ptr<AnalyzeState> ColumnDataCheckpointer::AnalyzeCompressionMethods(CompressionType forced_method,
+                                                                           idx_t &compression_idx) {
 	// set up the analyze states for each compression method
 	vector<unique_ptr<AnalyzeState>> analyze_states;
 	analyze_states.reserve(compression_functions.size());
@@ -198,8 +293,14 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	auto best_function = compression_functions[compression_idx];
 	auto compress_state = best_function->init_compression(*this, std::move(analyze_state));
 
-	ScanSegments(
-	    [&](Vector &scan_vector, idx_t count) { best_function->compress(*compress_state, scan_vector, count); });
+	idx_t row_start = nodes[0].node->start;
+	ScanSegments([&](Vector &scan_vector, idx_t count) {
+		// the vector statistics have to be updated first, since the rows can be flushed while compressing them
+		state.UpdateVectorStatistics(scan_vector, row_start, count);
+		state.UpdateBloomFilter(scan_vector, count);
+		best_function->compress(*compress_state, scan_vector, count);
+		row_start += count;
+	});
 	best_function->compress_finalize(*compress_state);
 
 	nodes.clear();
@@ -225,7 +326,8 @@ bool ColumnDataCheckpointer::HasChanges() {
 
 void ColumnDataCheckpointer::WritePersistentSegments() {
 	// all segments are persistent and there are no updates
-	// we only need to write the metadata
+	// we only need to write the metadata, and we keep the Bloom filter of the column (if any)
+	state.bloom_filter = col_data.GetBloomFilter();
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
 		auto segment = nodes[segment_idx].node.get();
 		auto pointer = segment->GetDataPointer();
@@ -0,0 +1,50 @@
+#include "duckdb/storage/table/column_dictionary.hpp"
+
+namespace duckdb {
+
+ColumnDictionary::ColumnDictionary() : size(0), capacity(STANDARD_VECTOR_SIZE) {
+	values = make_uniq<Vector>(LogicalType::VARCHAR, capacity);
+}
+
+void ColumnDictionary::Grow() {
+	// emitted vectors keep referencing the old strings, so we copy them to a new vector instead of resizing
+	auto new_capacity = MinValue<idx_t>(capacity * 2, MAXIMUM_SIZE);
+	auto new_values = make_uniq<Vector>(LogicalType::VARCHAR, new_capacity);
+	memcpy(FlatVector::GetData<string_t>(*new_values), FlatVector::GetData<string_t>(*values), size * sizeof(string_t));
+	StringVector::AddHeapReference(*new_values, *values);
+	values = std::move(new_values);
+	capacity = new_capacity;
+}
+
+bool ColumnDictionary::GetCodes(Vector &strings, idx_t count, sel_t *result) {
+	D_ASSERT(strings.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto string_data = FlatVector::GetData<string_t>(strings);
+
+	lock_guard<mutex> guard(lock);
+	for (idx_t i = 0; i < count; i++) {
+		auto entry = codes.find(string_data[i]);
+		if (entry != codes.end()) {
+			result[i] = entry->second;
+			continue;
+		}
+		if (size >= MAXIMUM_SIZE) {
+			return false;
+		}
+		if (size == capacity) {
+			Grow();
+		}
+		auto code = UnsafeNumericCast<sel_t>(size);
+		auto value = StringVector::AddStringOrBlob(*values, string_data[i]);
+		FlatVector::GetData<string_t>(*values)[size++] = value;
+		codes.emplace(value, code);
+		result[i] = code;
+	}
+	return true;
+}
+
+void ColumnDictionary::Slice(Vector &result, const SelectionVector &sel, idx_t count) {
+	lock_guard<mutex> guard(lock);
+	result.Slice(*values, sel, count);
+}
+
+} // namespace duckdb
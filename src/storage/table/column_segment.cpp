@@ -4,8 +4,11 @@
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/storage_manager.hpp"
@@ -139,6 +142,17 @@ void ColumnSegment::ScanPartial(ColumnScanState &state, idx_t scan_count, Vector
 	function.get().scan_partial(*this, state, scan_count, result, result_offset);
 }
 
+bool ColumnSegment::CanFilter(const TableFilter &filter) const {
+	// struct filters are evaluated on the child columns
+	return function.get().filter && filter.filter_type != TableFilterType::STRUCT_EXTRACT;
+}
+
+void ColumnSegment::Filter(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+                           idx_t &sel_count, const TableFilter &filter) {
+	D_ASSERT(CanFilter(filter));
+	function.get().filter(*this, state, scan_count, result, sel, sel_count, filter);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -250,6 +264,7 @@ DataPointer ColumnSegment::GetDataPointer() {
 	if (function.get().serialize_state) {
 		pointer.segment_state = function.get().serialize_state(*this);
 	}
+	pointer.vector_statistics = stats.CopyVectorStatistics();
 	return pointer;
 }
 
@@ -530,9 +545,72 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		return FilterSelection(sel, *child_vec, child_data, *struct_filter.child_filter, scan_count,
 		                       approved_tuple_count);
 	}
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		approved_tuple_count = bloom_filter.Filter(vector, sel, approved_tuple_count);
+		return approved_tuple_count;
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		approved_tuple_count = in_filter.Filter(vdata, vector.GetType().InternalType(), sel, approved_tuple_count);
+		return approved_tuple_count;
+	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		if (!dynamic_filter.filter_data) {
+			return approved_tuple_count;
+		}
+		lock_guard<mutex> guard(dynamic_filter.filter_data->lock);
+		if (!dynamic_filter.filter_data->initialized) {
+			// the filter has not been set yet - everything passes
+			return approved_tuple_count;
+		}
+		return FilterSelection(sel, vector, vdata, *dynamic_filter.filter_data->filter, scan_count,
+		                       approved_tuple_count);
+	}
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
 }
 
+void ColumnSegment::FilterValues(Vector &values, idx_t count, const TableFilter &filter, bool *matches) {
+	SelectionVector sel;
+	idx_t approved_count = count;
+	UnifiedVectorFormat vdata;
+	values.ToUnifiedFormat(count, vdata);
+	FilterSelection(sel, values, vdata, filter, count, approved_count);
+
+	memset(matches, 0, count * sizeof(bool));
+	for (idx_t i = 0; i < approved_count; i++) {
+		matches[sel.get_index(i)] = true;
+	}
+}
+
+bool ColumnSegment::FilterIsDynamic(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONJUNCTION_OR: {
+		for (auto &child_filter : filter.Cast<ConjunctionOrFilter>().child_filters) {
+			if (FilterIsDynamic(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+			if (FilterIsDynamic(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::DYNAMIC_FILTER:
+	case TableFilterType::BLOOM_FILTER:
+		// these filters can be (re)filled while the scan is running
+		return true;
+	default:
+		return false;
+	}
+}
+
 } // namespace duckdb
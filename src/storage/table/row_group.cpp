@@ -22,6 +22,8 @@
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 namespace duckdb {
 
@@ -197,6 +199,7 @@ bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector
 
 	state.row_group = this;
 	state.vector_index = vector_offset;
+	state.prefetch_vector_index = vector_offset;
 	state.max_row_group_row =
 	    this->start > state.max_row ? 0 : MinValue<idx_t>(this->count, state.max_row - this->start);
 	auto row_number = start + vector_offset * STANDARD_VECTOR_SIZE;
@@ -226,6 +229,7 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 	}
 	state.row_group = this;
 	state.vector_index = 0;
+	state.prefetch_vector_index = 0;
 	state.max_row_group_row =
 	    this->start > state.max_row ? 0 : MinValue<idx_t>(this->count, state.max_row - this->start);
 	if (state.max_row_group_row == 0) {
@@ -389,7 +393,8 @@ bool RowGroup::CheckZonemap(ScanFilterInfo &filters) {
 			filters.SetFilterAlwaysTrue(i);
 		}
 	}
-	return true;
+	// skip row groups outside of the qualifying row ranges of indexes
+	return filters.CanContainRows(this->start, this->count);
 }
 
 static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
@@ -419,6 +424,9 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
+	case TableFilterType::IN_FILTER:
+	case TableFilterType::DYNAMIC_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -428,6 +436,13 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 
 bool RowGroup::CheckZonemapSegments(CollectionScanState &state) {
 	auto &filters = state.GetFilterInfo();
+	idx_t current_row = state.vector_index * STANDARD_VECTOR_SIZE;
+	idx_t current_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, state.max_row_group_row - current_row);
+	if (!filters.CanContainRows(this->start + current_row, current_count)) {
+		// the vector is outside of the qualifying row ranges of indexes
+		NextVector(state);
+		return false;
+	}
 	for (auto &entry : filters.GetFilterList()) {
 		if (entry.IsAlwaysTrue()) {
 			// filter is always true - avoid checking
@@ -437,7 +452,18 @@ bool RowGroup::CheckZonemapSegments(CollectionScanState &state) {
 		auto base_column_idx = entry.table_column_index;
 		auto &filter = entry.filter;
 
-		auto prune_result = GetColumn(base_column_idx).CheckZonemap(state.column_scans[column_idx], filter);
+		auto &column = GetColumn(base_column_idx);
+		auto prune_result = column.CheckZonemap(state.column_scans[column_idx], filter);
+		if (prune_result == FilterPropagateResult::NO_PRUNING_POSSIBLE) {
+			// the segment can not be skipped - check if the vector we are about to scan can be skipped
+			idx_t vector_row = state.vector_index * STANDARD_VECTOR_SIZE;
+			idx_t vector_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, state.max_row_group_row - vector_row);
+			if (column.CheckVectorZonemap(state.column_scans[column_idx], filter, this->start + vector_row,
+			                              vector_count) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				NextVector(state);
+				return false;
+			}
+		}
 		if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 			continue;
 		}
@@ -507,23 +533,32 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 			count = max_count;
 		}
 		auto &block_manager = GetBlockManager();
+		const auto read_ahead_rows = DBConfig::Get(GetCollection().GetAttached()).options.scan_read_ahead_rows;
 #ifndef DUCKDB_ALTERNATIVE_VERIFY
-		// // in regular operation we only prefetch from remote file systems
+		// // in regular operation we only prefetch from remote file systems, or if read-ahead is enabled
 		// // when alternative verify is set, we always prefetch for testing purposes
-		if (block_manager.IsRemote())
+		if ((block_manager.IsRemote() || (read_ahead_rows > 0 && !block_manager.InMemory())) &&
+		    state.vector_index >= state.prefetch_vector_index)
 #else
-		if (!block_manager.InMemory())
+		if (!block_manager.InMemory() && state.vector_index >= state.prefetch_vector_index)
 #endif
 		{
+			// prefetch the blocks of this vector and of the vectors we read ahead, the reads of adjacent blocks are
+			// coalesced by the buffer manager
+			const auto prefetch_count =
+			    MinValue<idx_t>(AlignValue<idx_t, STANDARD_VECTOR_SIZE>(MaxValue<idx_t>(read_ahead_rows, max_count)),
+			                    state.max_row_group_row - current_row);
 			PrefetchState prefetch_state;
 			for (idx_t i = 0; i < column_ids.size(); i++) {
 				const auto &column = column_ids[i];
 				if (column != COLUMN_IDENTIFIER_ROW_ID) {
-					GetColumn(column).InitializePrefetch(prefetch_state, state.column_scans[i], max_count);
+					GetColumn(column).InitializePrefetch(prefetch_state, state.column_scans[i], prefetch_count);
 				}
 			}
 			auto &buffer_manager = block_manager.buffer_manager;
 			buffer_manager.Prefetch(prefetch_state.blocks);
+			state.prefetch_vector_index =
+			    state.vector_index + (prefetch_count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
 		}
 
 		bool has_filters = filter_info.HasFilters();
@@ -570,8 +605,10 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 					}
 					auto scan_idx = filter.scan_column_index;
 					auto &col_data = GetColumn(filter.table_column_index);
+					auto tuples_in = approved_tuple_count;
 					col_data.Select(transaction, state.vector_index, state.column_scans[scan_idx],
 					                result.data[scan_idx], sel, approved_tuple_count, filter.filter);
+					filter_info.EndPredicate(filter_state, i, tuples_in, approved_tuple_count);
 				}
 				for (auto &table_filter : filter_list) {
 					if (table_filter.IsAlwaysTrue()) {
@@ -625,7 +662,7 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 					}
 				}
 			}
-			filter_info.EndFilter(filter_state);
+			filter_info.EndFilter();
 
 			D_ASSERT(approved_tuple_count > 0);
 			count = approved_tuple_count;
@@ -823,6 +860,14 @@ void RowGroup::CleanupAppend(transaction_t lowest_transaction, idx_t start, idx_
 	vinfo.CleanupAppend(lowest_transaction, start, count);
 }
 
+void RowGroup::CleanupDelete(transaction_t lowest_transaction, idx_t row) {
+	auto vinfo = GetVersionInfo();
+	if (!vinfo) {
+		return;
+	}
+	vinfo->CleanupDelete(lowest_transaction, row / STANDARD_VECTOR_SIZE);
+}
+
 void RowGroup::Update(TransactionData transaction, DataChunk &update_chunk, row_t *ids, idx_t offset, idx_t count,
                       const vector<PhysicalIndex> &column_ids) {
 #ifdef DEBUG
@@ -885,10 +930,41 @@ CompressionType ColumnCheckpointInfo::GetCompressionType() {
 	return info.compression_types[column_idx];
 }
 
+unique_ptr<ColumnCheckpointState> RowGroup::CheckpointColumn(RowGroupWriteInfo &info, idx_t column_idx) {
+	auto &column = GetColumn(column_idx);
+	ColumnCheckpointInfo checkpoint_info(info, column_idx);
+	auto checkpoint_state = column.Checkpoint(*this, checkpoint_info);
+	D_ASSERT(checkpoint_state);
+	return checkpoint_state;
+}
+
+//! Checkpoints columns of a row group until all columns have been claimed by one of the tasks
+class ColumnCheckpointTask : public BaseExecutorTask {
+public:
+	ColumnCheckpointTask(TaskExecutor &executor, RowGroup &row_group, RowGroupWriteInfo &info,
+	                     atomic<idx_t> &next_column, vector<unique_ptr<ColumnCheckpointState>> &states)
+	    : BaseExecutorTask(executor), row_group(row_group), info(info), next_column(next_column), states(states) {
+	}
+
+	void ExecuteTask() override {
+		while (true) {
+			auto column_idx = next_column++;
+			if (column_idx >= states.size()) {
+				break;
+			}
+			states[column_idx] = row_group.CheckpointColumn(info, column_idx);
+		}
+	}
+
+private:
+	RowGroup &row_group;
+	RowGroupWriteInfo &info;
+	atomic<idx_t> &next_column;
+	vector<unique_ptr<ColumnCheckpointState>> &states;
+};
+
 RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
-	RowGroupWriteData result;
-	result.states.reserve(columns.size());
-	result.statistics.reserve(columns.size());
+	auto column_count = GetColumnCount();
 
 	// Checkpoint the individual columns of the row group
 	// Here we're iterating over columns. Each column can have multiple segments.
@@ -898,12 +974,28 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 	// Some of these columns are composite (list, struct). The data is written
 	// first sequentially, and the pointers are written later, so that the
 	// pointers all end up densely packed, and thus more cache-friendly.
-	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
-		auto &column = GetColumn(column_idx);
-		ColumnCheckpointInfo checkpoint_info(info, column_idx);
-		auto checkpoint_state = column.Checkpoint(*this, checkpoint_info);
-		D_ASSERT(checkpoint_state);
+	vector<unique_ptr<ColumnCheckpointState>> states(column_count);
+	auto &scheduler = TaskScheduler::GetScheduler(GetCollection().GetAttached().GetDatabase());
+	auto thread_count = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	if (column_count >= PARALLEL_CHECKPOINT_COLUMN_COUNT && thread_count > 1) {
+		// wide row group: the columns are analyzed and compressed in parallel
+		TaskExecutor executor(scheduler);
+		atomic<idx_t> next_column(0);
+		auto task_count = MinValue<idx_t>(thread_count, column_count);
+		for (idx_t task_idx = 0; task_idx < task_count; task_idx++) {
+			executor.ScheduleTask(make_uniq<ColumnCheckpointTask>(executor, *this, info, next_column, states));
+		}
+		executor.WorkOnTasks();
+	} else {
+		for (idx_t column_idx = 0; column_idx < column_count; column_idx++) {
+			states[column_idx] = CheckpointColumn(info, column_idx);
+		}
+	}
 
+	RowGroupWriteData result;
+	result.states.reserve(column_count);
+	result.statistics.reserve(column_count);
+	for (auto &checkpoint_state : states) {
 		auto stats = checkpoint_state->GetStatistics();
 		D_ASSERT(stats);
 
@@ -6,7 +6,9 @@
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/constraints/bound_not_null_constraint.hpp"
+#include "duckdb/storage/checkpoint/table_data_reader.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
@@ -23,7 +25,8 @@ namespace duckdb {
 // Row Group Segment Tree
 //===--------------------------------------------------------------------===//
 RowGroupSegmentTree::RowGroupSegmentTree(RowGroupCollection &collection)
-    : SegmentTree<RowGroup, true>(), collection(collection), current_row_group(0), max_row_group(0) {
+    : SegmentTree<RowGroup, true>(), collection(collection), current_row_group(0), max_row_group(0),
+      load_table_data(false) {
 }
 RowGroupSegmentTree::~RowGroupSegmentTree() {
 }
@@ -33,10 +36,22 @@ void RowGroupSegmentTree::Initialize(PersistentTableData &data) {
 	current_row_group = 0;
 	max_row_group = data.row_group_count;
 	finished_loading = false;
+	load_table_data = false;
 	reader = make_uniq<MetadataReader>(collection.GetMetadataManager(), data.block_pointer);
 }
 
+void RowGroupSegmentTree::InitializeLazy() {
+	current_row_group = 0;
+	max_row_group = 0;
+	finished_loading = false;
+	load_table_data = true;
+}
+
 unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
+	if (load_table_data) {
+		// the row group pointers are stored after the table statistics, which have to be read first
+		Initialize(collection.LoadTableData());
+	}
 	if (current_row_group >= max_row_group) {
 		reader.reset();
 		finished_loading = true;
@@ -56,10 +71,13 @@ unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
 RowGroupCollection::RowGroupCollection(shared_ptr<DataTableInfo> info_p, BlockManager &block_manager,
                                        vector<LogicalType> types_p, idx_t row_start_p, idx_t total_rows_p)
     : block_manager(block_manager), total_rows(total_rows_p), info(std::move(info_p)), types(std::move(types_p)),
-      row_start(row_start_p), allocation_size(0) {
+      row_start(row_start_p), allocation_size(0), lazy_data_loaded(true) {
 	row_groups = make_shared_ptr<RowGroupSegmentTree>(*this);
 }
 
+RowGroupCollection::~RowGroupCollection() {
+}
+
 idx_t RowGroupCollection::GetTotalRows() const {
 	return total_rows.load();
 }
@@ -87,10 +105,40 @@ void RowGroupCollection::Initialize(PersistentTableData &data) {
 	D_ASSERT(this->row_start == 0);
 	auto l = row_groups->Lock();
 	this->total_rows = data.total_rows;
+	if (!data.IsLoaded()) {
+		// the statistics and row group pointers are read when they are first accessed, see LoadTableData
+		lazy_data = make_uniq<PersistentTableData>(types.size());
+		lazy_data->table_pointer = data.table_pointer;
+		lazy_data->total_rows = data.total_rows;
+		lazy_data_loaded = false;
+		row_groups->InitializeLazy();
+		return;
+	}
 	row_groups->Initialize(data);
 	stats.Initialize(types, data);
 }
 
+PersistentTableData &RowGroupCollection::LoadTableData() {
+	lock_guard<mutex> guard(lazy_data_lock);
+	D_ASSERT(lazy_data);
+	if (!lazy_data->IsLoaded()) {
+		MetadataReader reader(GetMetadataManager(), lazy_data->table_pointer);
+		TableDataReader data_reader(reader, types, *lazy_data);
+		data_reader.ReadTableData();
+		lazy_data->table_pointer = MetaBlockPointer();
+		stats.Initialize(types, *lazy_data);
+		lazy_data_loaded = true;
+	}
+	return *lazy_data;
+}
+
+TableStatistics &RowGroupCollection::Stats() {
+	if (!lazy_data_loaded) {
+		LoadTableData();
+	}
+	return stats;
+}
+
 void RowGroupCollection::Initialize(PersistentCollectionData &data) {
 	stats.InitializeEmpty(types);
 	auto l = row_groups->Lock();
@@ -183,8 +231,52 @@ void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &sta
 	state.processed_rows = 0;
 }
 
+static idx_t GetMorselVectorCount(ParallelCollectionScanState &state, idx_t thread_count) {
+	auto &row_group = *state.current_row_group;
+	auto row_group_vectors = (row_group.count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+	if (thread_count <= 1) {
+		// nothing to balance - scan whole row groups
+		return row_group_vectors;
+	}
+	// hand out a fraction of the remaining rows, so that morsels get smaller as the scan nears its end
+	auto scan_position = row_group.start + state.vector_index * STANDARD_VECTOR_SIZE;
+	auto remaining_rows = state.max_row > scan_position ? state.max_row - scan_position : 0;
+	auto morsel_vectors =
+	    remaining_rows / (thread_count * ParallelCollectionScanState::MORSELS_PER_THREAD * STANDARD_VECTOR_SIZE);
+	if (state.nanos_per_row > 0) {
+		// cap the morsel so it is expected to finish within the target runtime
+		auto target_rows = static_cast<double>(ParallelCollectionScanState::TARGET_MORSEL_NANOS) / state.nanos_per_row;
+		auto target_vectors = static_cast<idx_t>(target_rows / static_cast<double>(STANDARD_VECTOR_SIZE));
+		morsel_vectors = MinValue<idx_t>(morsel_vectors, target_vectors);
+	}
+	morsel_vectors = MaxValue<idx_t>(morsel_vectors, ParallelCollectionScanState::MIN_MORSEL_VECTOR_COUNT);
+	return MinValue<idx_t>(morsel_vectors, row_group_vectors);
+}
+
+static void UpdateMorselRuntime(ParallelCollectionScanState &state, CollectionScanState &scan_state,
+                                time_point<high_resolution_clock> now) {
+	if (scan_state.morsel_rows == 0) {
+		return;
+	}
+	auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - scan_state.morsel_start).count();
+	auto nanos_per_row = static_cast<double>(elapsed) / static_cast<double>(scan_state.morsel_rows);
+	scan_state.morsel_rows = 0;
+	if (state.nanos_per_row == 0) {
+		state.nanos_per_row = nanos_per_row;
+	} else {
+		// exponential moving average, so the estimate follows changes in e.g. filter selectivity
+		state.nanos_per_row = 0.75 * state.nanos_per_row + 0.25 * nanos_per_row;
+	}
+}
+
 bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollectionScanState &state,
                                           CollectionScanState &scan_state) {
+	auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	auto now = high_resolution_clock::now();
+	{
+		lock_guard<mutex> l(state.lock);
+		UpdateMorselRuntime(state, scan_state, now);
+	}
 	while (true) {
 		idx_t vector_index;
 		idx_t max_row;
@@ -211,13 +303,25 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 					state.vector_index = 0;
 				}
 			} else {
-				state.processed_rows += state.current_row_group->count;
-				vector_index = 0;
-				max_row = state.current_row_group->start + state.current_row_group->count;
-				state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+				auto row_group_count = state.current_row_group->count.load();
+				auto row_group_vectors = (row_group_count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+				auto end_vector = state.vector_index + GetMorselVectorCount(state, thread_count);
+				auto end_row = MinValue<idx_t>(row_group_count, end_vector * STANDARD_VECTOR_SIZE);
+				vector_index = state.vector_index;
+				max_row = state.current_row_group->start + end_row;
+				state.processed_rows += end_row - vector_index * STANDARD_VECTOR_SIZE;
+				if (end_vector >= row_group_vectors) {
+					state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+					state.vector_index = 0;
+				} else {
+					state.vector_index = end_vector;
+				}
 			}
 			max_row = MinValue<idx_t>(max_row, state.max_row);
 			scan_state.batch_index = ++state.batch_index;
+			auto morsel_start_row = row_group->start + vector_index * STANDARD_VECTOR_SIZE;
+			scan_state.morsel_rows = max_row > morsel_start_row ? max_row - morsel_start_row : 0;
+			scan_state.morsel_start = now;
 		}
 		D_ASSERT(collection);
 		D_ASSERT(row_group);
@@ -274,7 +378,8 @@ bool RowGroupCollection::Scan(DuckTransaction &transaction, const std::function<
 // Fetch
 //===--------------------------------------------------------------------===//
 void RowGroupCollection::Fetch(TransactionData transaction, DataChunk &result, const vector<column_t> &column_ids,
-                               const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state) {
+                               const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state,
+                               optional_ptr<SelectionVector> fetch_sel) {
 	// figure out which row_group to fetch from
 	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
 	idx_t count = 0;
@@ -294,6 +399,9 @@ void RowGroupCollection::Fetch(TransactionData transaction, DataChunk &result, c
 			continue;
 		}
 		row_group->FetchRow(transaction, state, column_ids, row_id, result, count);
+		if (fetch_sel) {
+			fetch_sel->set_index(count, i);
+		}
 		count++;
 	}
 	result.SetCardinality(count);
@@ -352,6 +460,11 @@ bool RowGroupCollection::Append(DataChunk &chunk, TableAppendState &state) {
 	idx_t total_append_count = chunk.size();
 	idx_t remaining = chunk.size();
 	state.total_append_count += total_append_count;
+	{
+		// sample the chunk before it is sliced below
+		auto local_stats_lock = state.stats.GetLock();
+		state.stats.AddToSample(*local_stats_lock, chunk);
+	}
 	while (true) {
 		auto current_row_group = state.row_group_append_state.row_group;
 		// check how much we can fit into the current row_group
@@ -362,7 +475,7 @@ bool RowGroupCollection::Append(DataChunk &chunk, TableAppendState &state) {
 			current_row_group->Append(state.row_group_append_state, chunk, append_count);
 			allocation_size += current_row_group->GetAllocationSize() - previous_allocation_size;
 			// merge the stats
-			current_row_group->MergeIntoStatistics(stats);
+			current_row_group->MergeIntoStatistics(Stats());
 		}
 		remaining -= append_count;
 		if (remaining > 0) {
@@ -409,10 +522,10 @@ void RowGroupCollection::FinalizeAppend(TransactionData transaction, TableAppend
 	state.total_append_count = 0;
 	state.start_row_group = nullptr;
 
-	auto global_stats_lock = stats.GetLock();
+	auto global_stats_lock = Stats().GetLock();
 	auto local_stats_lock = state.stats.GetLock();
 	for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
-		auto &global_stats = stats.GetStats(*global_stats_lock, col_idx);
+		auto &global_stats = Stats().GetStats(*global_stats_lock, col_idx);
 		if (!global_stats.HasDistinctStats()) {
 			continue;
 		}
@@ -422,6 +535,7 @@ void RowGroupCollection::FinalizeAppend(TransactionData transaction, TableAppend
 		}
 		global_stats.DistinctStats().Merge(local_stats.DistinctStats());
 	}
+	Stats().MergeSample(*global_stats_lock, state.stats);
 
 	Verify();
 }
@@ -490,6 +604,17 @@ void RowGroupCollection::CleanupAppend(transaction_t lowest_transaction, idx_t s
 	}
 }
 
+void RowGroupCollection::CleanupDelete(transaction_t lowest_transaction, idx_t row) {
+	auto l = row_groups->Lock();
+	idx_t segment_index;
+	if (!row_groups->TryGetSegmentIndex(l, row, segment_index)) {
+		// the row no longer exists (e.g. because the row groups were vacuumed)
+		return;
+	}
+	auto row_group = row_groups->GetSegmentByIndex(l, UnsafeNumericCast<int64_t>(segment_index));
+	row_group->CleanupDelete(lowest_transaction, row - row_group->start);
+}
+
 bool RowGroupCollection::IsPersistent() const {
 	for (auto &row_group : row_groups->Segments()) {
 		if (!row_group.IsPersistent()) {
@@ -539,7 +664,7 @@ void RowGroupCollection::MergeStorage(RowGroupCollection &data, optional_ptr<Dat
 		// if we have serialized the row groups - push the serialized block pointers into the commit state
 		commit_state->AddRowGroupData(*table, start_index, optimistically_written_count, std::move(row_group_data));
 	}
-	stats.MergeStats(data.stats);
+	Stats().MergeStats(data.stats);
 	total_rows += data.total_rows.load();
 }
 
@@ -601,10 +726,10 @@ void RowGroupCollection::Update(TransactionData transaction, row_t *ids, const v
 		}
 		row_group->Update(transaction, updates, ids, start, pos - start, column_ids);
 
-		auto l = stats.GetLock();
+		auto l = Stats().GetLock();
 		for (idx_t i = 0; i < column_ids.size(); i++) {
 			auto column_id = column_ids[i];
-			stats.MergeStats(*l, column_id.index, *row_group->GetStatistics(column_id.index));
+			Stats().MergeStats(*l, column_id.index, *row_group->GetStatistics(column_id.index));
 		}
 	} while (pos < updates.size());
 }
@@ -685,8 +810,8 @@ void RowGroupCollection::UpdateColumn(TransactionData transaction, Vector &row_i
 	auto row_group = row_groups->GetSegment(UnsafeNumericCast<idx_t>(first_id));
 	row_group->UpdateColumn(transaction, updates, row_ids, column_path);
 
-	auto lock = stats.GetLock();
-	row_group->MergeIntoStatistics(primary_column_idx, stats.GetStats(*lock, primary_column_idx).Statistics());
+	auto lock = Stats().GetLock();
+	row_group->MergeIntoStatistics(primary_column_idx, Stats().GetStats(*lock, primary_column_idx).Statistics());
 }
 
 //===--------------------------------------------------------------------===//
@@ -1056,7 +1181,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AddColumn(ClientContext &cont
 	DataChunk dummy_chunk;
 	Vector default_vector(new_column.GetType());
 
-	result->stats.InitializeAddColumn(stats, new_column.GetType());
+	result->stats.InitializeAddColumn(Stats(), new_column.GetType());
 	auto lock = result->stats.GetLock();
 	auto &new_column_stats = result->stats.GetStats(*lock, new_column_idx);
 
@@ -1079,7 +1204,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::RemoveColumn(idx_t col_idx) {
 
 	auto result =
 	    make_shared_ptr<RowGroupCollection>(info, block_manager, std::move(new_types), row_start, total_rows.load());
-	result->stats.InitializeRemoveColumn(stats, col_idx);
+	result->stats.InitializeRemoveColumn(Stats(), col_idx);
 
 	for (auto &current_row_group : row_groups->Segments()) {
 		auto new_row_group = current_row_group.RemoveColumn(*result, col_idx);
@@ -1097,7 +1222,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AlterType(ClientContext &cont
 
 	auto result =
 	    make_shared_ptr<RowGroupCollection>(info, block_manager, std::move(new_types), row_start, total_rows.load());
-	result->stats.InitializeAlterType(stats, changed_idx, target_type);
+	result->stats.InitializeAlterType(Stats(), changed_idx, target_type);
 
 	vector<LogicalType> scan_types;
 	for (idx_t i = 0; i < bound_columns.size(); i++) {
@@ -1169,17 +1294,35 @@ void RowGroupCollection::VerifyNewConstraint(DataTable &parent, const BoundConst
 // Statistics
 //===--------------------------------------------------------------------===//
 void RowGroupCollection::CopyStats(TableStatistics &other_stats) {
-	stats.CopyStats(other_stats);
+	Stats().CopyStats(other_stats);
 }
 
 unique_ptr<BaseStatistics> RowGroupCollection::CopyStats(column_t column_id) {
-	return stats.CopyStats(column_id);
+	return Stats().CopyStats(column_id);
+}
+
+unique_ptr<ReservoirSample> RowGroupCollection::GetSample() {
+	return Stats().CopySample();
 }
 
 void RowGroupCollection::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats) {
 	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
-	auto stats_lock = stats.GetLock();
-	stats.GetStats(*stats_lock, column_id).SetDistinct(std::move(distinct_stats));
+	auto stats_lock = Stats().GetLock();
+	Stats().GetStats(*stats_lock, column_id).SetDistinct(std::move(distinct_stats));
+}
+
+unique_ptr<HistogramStatistics> RowGroupCollection::CopyHistogram(column_t column_id) {
+	return Stats().CopyHistogram(column_id);
+}
+
+void RowGroupCollection::SetHistogram(column_t column_id, unique_ptr<HistogramStatistics> histogram) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	auto stats_lock = Stats().GetLock();
+	Stats().GetStats(*stats_lock, column_id).SetHistogram(std::move(histogram));
+}
+
+idx_t RowGroupCollection::GetStatisticsVersion() {
+	return Stats().GetVersion();
 }
 
 } // namespace duckdb
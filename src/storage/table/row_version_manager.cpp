@@ -100,9 +100,14 @@ void RowVersionManager::AppendVersionInfo(TransactionData transaction, idx_t cou
 			} else if (vector_info[vector_idx]->type == ChunkInfoType::VECTOR_INFO) {
 				// use existing vector
 				new_info = &vector_info[vector_idx]->Cast<ChunkVectorInfo>();
+			} else if (vector_info[vector_idx]->type == ChunkInfoType::BITMAP_INFO) {
+				// the vector only has a deletion bitmap: convert it back into a vector info
+				auto insert_info = vector_info[vector_idx]->Cast<ChunkBitmapInfo>().ToVectorInfo();
+				new_info = insert_info.get();
+				vector_info[vector_idx] = std::move(insert_info);
 			} else {
 				throw InternalException("Error in RowVersionManager::AppendVersionInfo - expected either a "
-				                        "ChunkVectorInfo or no version info");
+				                        "ChunkVectorInfo, a ChunkBitmapInfo or no version info");
 			}
 			new_info->Append(vector_start, vector_end, transaction.transaction_id);
 		}
@@ -174,6 +179,9 @@ ChunkVectorInfo &RowVersionManager::GetVectorInfo(idx_t vector_idx) {
 			new_info->inserted[i] = constant.insert_id;
 		}
 		vector_info[vector_idx] = std::move(new_info);
+	} else if (vector_info[vector_idx]->type == ChunkInfoType::BITMAP_INFO) {
+		// info exists but it's a bitmap: convert to a vector info
+		vector_info[vector_idx] = vector_info[vector_idx]->Cast<ChunkBitmapInfo>().ToVectorInfo();
 	}
 	D_ASSERT(vector_info[vector_idx]->type == ChunkInfoType::VECTOR_INFO);
 	return vector_info[vector_idx]->Cast<ChunkVectorInfo>();
@@ -191,6 +199,24 @@ void RowVersionManager::CommitDelete(idx_t vector_idx, transaction_t commit_id,
 	GetVectorInfo(vector_idx).CommitDelete(commit_id, info);
 }
 
+void RowVersionManager::CleanupDelete(transaction_t lowest_active_transaction, idx_t vector_idx) {
+	lock_guard<mutex> lock(version_lock);
+	if (vector_idx >= Storage::ROW_GROUP_VECTOR_COUNT || !vector_info[vector_idx]) {
+		// the rows were reverted (or never appended) in the meantime
+		return;
+	}
+	auto &info = vector_info[vector_idx];
+	if (info->type != ChunkInfoType::VECTOR_INFO) {
+		return;
+	}
+	// if the deletes are visible to all transactions we can compress the version info into a bitmap
+	unique_ptr<ChunkInfo> new_info;
+	auto cleanup = info->Cleanup(lowest_active_transaction, new_info);
+	if (cleanup && new_info) {
+		info = std::move(new_info);
+	}
+}
+
 vector<MetaBlockPointer> RowVersionManager::Checkpoint(MetadataManager &manager) {
 	if (!has_changes && !storage_pointers.empty()) {
 		// the row version manager already exists on disk and no changes were made
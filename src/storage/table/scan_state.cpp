@@ -1,6 +1,9 @@
 #include "duckdb/storage/table/scan_state.hpp"
 
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/common/types/hash.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
+#include "duckdb/parser/parsed_data/sample_options.hpp"
 #include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/table/row_group.hpp"
@@ -42,7 +45,7 @@ ScanFilter::ScanFilter(idx_t index, const vector<column_t> &column_ids, TableFil
 void ScanFilterInfo::Initialize(TableFilterSet &filters, const vector<column_t> &column_ids) {
 	D_ASSERT(!filters.filters.empty());
 	table_filters = &filters;
-	adaptive_filter = make_uniq<AdaptiveFilter>(filters);
+	adaptive_filter = make_uniq<AdaptiveFilter>(filters, filters.statistics);
 	filter_list.reserve(filters.filters.size());
 	for (auto &entry : filters.filters) {
 		filter_list.emplace_back(entry.first, column_ids, *entry.second);
@@ -91,6 +94,73 @@ void ScanFilterInfo::SetFilterAlwaysTrue(idx_t filter_idx) {
 	always_true_filters++;
 }
 
+bool ScanRowRanges::ContainsRows(idx_t row_start, idx_t count) const {
+	D_ASSERT(count > 0);
+	auto last_range = (row_start + count - 1) / range_size;
+	for (auto range_idx = row_start / range_size; range_idx <= last_range; range_idx++) {
+		if (range_idx >= qualifying.size() || qualifying[range_idx]) {
+			return true;
+		}
+	}
+	return false;
+}
+
+ScanSamplingInfo::ScanSamplingInfo(double sample_rate, hash_t seed) : sample_rate(sample_rate), seed(seed) {
+}
+
+shared_ptr<ScanSamplingInfo> ScanSamplingInfo::Create(ClientContext &context, const SampleOptions &options) {
+	D_ASSERT(options.method == SampleMethod::SYSTEM_SAMPLE && options.is_percentage);
+	hash_t seed;
+	if (options.seed >= 0) {
+		seed = Hash<uint64_t>(NumericCast<uint64_t>(options.seed));
+	} else {
+		auto &random_engine = RandomEngine::Get(context);
+		lock_guard<mutex> guard(random_engine.lock);
+		auto upper = static_cast<uint64_t>(random_engine.NextRandomInteger());
+		seed = Hash<uint64_t>(upper << 32 | random_engine.NextRandomInteger());
+	}
+	return make_shared_ptr<ScanSamplingInfo>(options.sample_size.GetValue<double>() / 100, seed);
+}
+
+bool ScanSamplingInfo::IsSampled(hash_t position) const {
+	if (sample_rate >= 1) {
+		return true;
+	}
+	auto hash = Hash<uint64_t>(position ^ seed);
+	return static_cast<double>(hash) < sample_rate * static_cast<double>(NumericLimits<hash_t>::Maximum());
+}
+
+bool ScanSamplingInfo::ContainsRows(idx_t row_start, idx_t count) const {
+	D_ASSERT(count > 0);
+	auto last_vector = (row_start + count - 1) / STANDARD_VECTOR_SIZE;
+	for (auto vector_idx = row_start / STANDARD_VECTOR_SIZE; vector_idx <= last_vector; vector_idx++) {
+		if (IsSampled(vector_idx)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void ScanFilterInfo::AddRowRanges(shared_ptr<ScanRowRanges> ranges) {
+	row_ranges.push_back(std::move(ranges));
+}
+
+void ScanFilterInfo::SetSampling(shared_ptr<ScanSamplingInfo> sampling_p) {
+	sampling = std::move(sampling_p);
+}
+
+bool ScanFilterInfo::CanContainRows(idx_t row_start, idx_t count) const {
+	for (auto &ranges : row_ranges) {
+		if (!ranges->ContainsRows(row_start, count)) {
+			return false;
+		}
+	}
+	if (sampling && !sampling->ContainsRows(row_start, count)) {
+		return false;
+	}
+	return true;
+}
+
 optional_ptr<AdaptiveFilter> ScanFilterInfo::GetAdaptiveFilter() {
 	return adaptive_filter.get();
 }
@@ -102,11 +172,18 @@ AdaptiveFilterState ScanFilterInfo::BeginFilter() const {
 	return adaptive_filter->BeginFilter();
 }
 
-void ScanFilterInfo::EndFilter(AdaptiveFilterState state) {
+void ScanFilterInfo::EndPredicate(AdaptiveFilterState &state, idx_t idx, idx_t tuples_in, idx_t tuples_out) {
+	if (!adaptive_filter) {
+		return;
+	}
+	adaptive_filter->EndPredicate(state, idx, tuples_in, tuples_out);
+}
+
+void ScanFilterInfo::EndFilter() {
 	if (!adaptive_filter) {
 		return;
 	}
-	adaptive_filter->EndFilter(state);
+	adaptive_filter->EndFilter();
 }
 
 void ColumnScanState::NextInternal(idx_t count) {
@@ -148,12 +225,12 @@ TableScanOptions &CollectionScanState::GetOptions() {
 }
 
 ParallelCollectionScanState::ParallelCollectionScanState()
-    : collection(nullptr), current_row_group(nullptr), processed_rows(0) {
+    : collection(nullptr), current_row_group(nullptr), processed_rows(0), nanos_per_row(0) {
 }
 
 CollectionScanState::CollectionScanState(TableScanState &parent_p)
-    : row_group(nullptr), vector_index(0), max_row_group_row(0), row_groups(nullptr), max_row(0), batch_index(0),
-      valid_sel(STANDARD_VECTOR_SIZE), parent(parent_p) {
+    : row_group(nullptr), vector_index(0), prefetch_vector_index(0), max_row_group_row(0), row_groups(nullptr),
+      max_row(0), batch_index(0), valid_sel(STANDARD_VECTOR_SIZE), morsel_rows(0), parent(parent_p) {
 }
 
 bool CollectionScanState::Scan(DuckTransaction &transaction, DataChunk &result) {
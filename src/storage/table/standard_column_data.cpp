@@ -76,6 +76,35 @@ idx_t StandardColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_
 	return scan_count;
 }
 
+//! Whether or not the next "scan_count" rows are known to be valid without scanning the validity
+static bool IsConstantValid(ValidityColumnData &validity, ColumnScanState &state, idx_t scan_count) {
+	if (validity.HasUpdates(state.row_index, scan_count)) {
+		return false;
+	}
+	auto segment = state.current;
+	if (!segment || state.row_index < segment->start ||
+	    state.row_index + scan_count > segment->start + segment->count) {
+		return false;
+	}
+	return segment->function.get().type == CompressionType::COMPRESSION_CONSTANT &&
+	       !segment->stats.statistics.CanHaveNull();
+}
+
+void StandardColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
+                                Vector &result, SelectionVector &sel, idx_t &count, const TableFilter &filter) {
+	// if the vector has no NULL values and is stored in a single segment, we can evaluate the filter directly on the
+	// compressed data of the segment (e.g. once per dictionary entry or per run)
+	auto scan_count = GetVectorCount(vector_index);
+	auto &validity_state = state.child_states[0];
+	if (!CanFilterInSegment(state, scan_count, filter) || !IsConstantValid(validity, validity_state, scan_count)) {
+		ColumnData::Select(transaction, vector_index, state, result, sel, count, filter);
+		return;
+	}
+	FilterInSegment(state, scan_count, result, sel, count, filter);
+	// the validity does not need to be scanned: all rows are valid
+	validity.Skip(validity_state, scan_count);
+}
+
 void StandardColumnData::InitializeAppend(ColumnAppendState &state) {
 	ColumnData::InitializeAppend(state);
 	ColumnAppendState child_append;
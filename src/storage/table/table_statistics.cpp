@@ -74,17 +74,22 @@ void TableStatistics::InitializeAddConstraint(TableStatistics &parent) {
 	for (idx_t i = 0; i < parent.column_stats.size(); i++) {
 		column_stats.push_back(parent.column_stats[i]);
 	}
+	if (parent.table_sample) {
+		table_sample = parent.table_sample->Cast<ReservoirSample>().Copy();
+	}
 }
 
 void TableStatistics::MergeStats(TableStatistics &other) {
 	auto l = GetLock();
 	D_ASSERT(column_stats.size() == other.column_stats.size());
+	version++;
 	for (idx_t i = 0; i < column_stats.size(); i++) {
 		if (column_stats[i]) {
 			D_ASSERT(other.column_stats[i]);
 			column_stats[i]->Merge(*other.column_stats[i]);
 		}
 	}
+	MergeSample(*l, other);
 }
 
 void TableStatistics::MergeStats(idx_t i, BaseStatistics &stats) {
@@ -93,13 +98,56 @@ void TableStatistics::MergeStats(idx_t i, BaseStatistics &stats) {
 }
 
 void TableStatistics::MergeStats(TableStatisticsLock &lock, idx_t i, BaseStatistics &stats) {
+	version++;
 	column_stats[i]->Statistics().Merge(stats);
 }
 
 ColumnStatistics &TableStatistics::GetStats(TableStatisticsLock &lock, idx_t i) {
+	// the caller can modify the statistics through the reference
+	version++;
 	return *column_stats[i];
 }
 
+void TableStatistics::AddToSample(TableStatisticsLock &lock, DataChunk &chunk) {
+	if (chunk.size() == 0) {
+		return;
+	}
+	if (!table_sample) {
+		// every set of appended rows uses a different seed, so the keys of the samples that are merged are independent
+		table_sample = make_uniq<ReservoirSample>(Allocator::DefaultAllocator(), FIXED_SAMPLE_SIZE, -1);
+	}
+	// adding to the reservoir modifies the chunk, so we add a reference to it instead
+	DataChunk sample_chunk;
+	sample_chunk.InitializeEmpty(chunk.GetTypes());
+	sample_chunk.Reference(chunk);
+	table_sample->AddToReservoir(sample_chunk);
+}
+
+void TableStatistics::MergeSample(TableStatisticsLock &lock, TableStatistics &other) {
+	if (!other.table_sample) {
+		return;
+	}
+	if (!table_sample) {
+		table_sample = std::move(other.table_sample);
+		return;
+	}
+	table_sample->Merge(*other.table_sample);
+	other.table_sample.reset();
+}
+
+unique_ptr<ReservoirSample> TableStatistics::CopySample() {
+	lock_guard<mutex> l(*stats_lock);
+	if (!table_sample) {
+		return nullptr;
+	}
+	return table_sample->Cast<ReservoirSample>().Copy();
+}
+
+idx_t TableStatistics::GetVersion() {
+	lock_guard<mutex> l(*stats_lock);
+	return version;
+}
+
 unique_ptr<BaseStatistics> TableStatistics::CopyStats(idx_t i) {
 	lock_guard<mutex> l(*stats_lock);
 	auto result = column_stats[i]->Statistics().Copy();
@@ -109,6 +157,14 @@ unique_ptr<BaseStatistics> TableStatistics::CopyStats(idx_t i) {
 	return result.ToUnique();
 }
 
+unique_ptr<HistogramStatistics> TableStatistics::CopyHistogram(idx_t i) {
+	lock_guard<mutex> l(*stats_lock);
+	if (!column_stats[i]->HasHistogram()) {
+		return nullptr;
+	}
+	return column_stats[i]->Histogram().Copy();
+}
+
 void TableStatistics::CopyStats(TableStatistics &other) {
 	TableStatisticsLock lock(*stats_lock);
 	CopyStats(lock, other);
@@ -120,22 +176,24 @@ void TableStatistics::CopyStats(TableStatisticsLock &lock, TableStatistics &othe
 	for (auto &stats : column_stats) {
 		other.column_stats.push_back(stats->Copy());
 	}
+	if (table_sample) {
+		other.table_sample = table_sample->Cast<ReservoirSample>().Copy();
+	}
 }
 
 void TableStatistics::Serialize(Serializer &serializer) const {
 	serializer.WriteProperty(100, "column_stats", column_stats);
-	serializer.WritePropertyWithDefault<unique_ptr<BlockingSample>>(101, "table_sample", table_sample, nullptr);
+	// the table sample is not persisted: it is rebuilt from the rows that are appended after the table is loaded
+	serializer.WritePropertyWithDefault<unique_ptr<BlockingSample>>(101, "table_sample", unique_ptr<BlockingSample>(),
+	                                                                nullptr);
 }
 
-void TableStatistics::Deserialize(Deserializer &deserializer, ColumnList &columns) {
-	auto physical_columns = columns.Physical();
-
-	auto iter = physical_columns.begin();
+void TableStatistics::Deserialize(Deserializer &deserializer, const vector<LogicalType> &types) {
 	deserializer.ReadList(100, "column_stats", [&](Deserializer::List &list, idx_t i) {
-		auto &col = *iter;
-		iter.operator++();
-
-		auto type = col.GetType();
+		if (i >= types.size()) { // LCOV_EXCL_START
+			throw IOException("Table statistics column count is not aligned with table column count. Corrupt file?");
+		} // LCOV_EXCL_STOP
+		auto type = types[i];
 		deserializer.Set<LogicalType &>(type);
 
 		column_stats.push_back(list.ReadElement<shared_ptr<ColumnStatistics>>());
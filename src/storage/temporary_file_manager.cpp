@@ -1,17 +1,21 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
 
+#include "miniz.hpp"
+
 namespace duckdb {
 
 //===--------------------------------------------------------------------===//
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t slot_size)
+    : max_index(0), slot_size(slot_size), manager(&manager) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), slot_size(0), manager(nullptr) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -58,7 +62,6 @@ bool BlockIndexManager::HasFreeBlocks() {
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMP_FILE_BLOCK_SIZE = DEFAULT_BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +69,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * slot_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * slot_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -94,11 +97,20 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+static string GetTemporaryFileName(DatabaseInstance &db, idx_t index, idx_t slot_size) {
+	if (slot_size == BufferManager::GetBufferManager(db).GetBlockAllocSize()) {
+		return "duckdb_temp_storage-" + to_string(index) + ".tmp";
+	}
+	// compressed blocks of the same slot size share a file
+	return "duckdb_temp_storage_" + to_string(slot_size / 1024) + "K-" + to_string(index) + ".tmp";
+}
+
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
+                                         idx_t index, TemporaryFileManager &manager, idx_t slot_size)
     : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
-      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+      slot_size(slot_size), path(FileSystem::GetFileSystem(db).JoinPath(
+                                temp_directory, GetTemporaryFileName(db, index, slot_size))),
+      index_manager(manager, slot_size), encryption(manager.GetEncryption()) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -117,17 +129,76 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	return TemporaryFileIndex(file_index, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+//! The size of the header of a compressed block: the size of the compressed data, followed by its synthetic IV if the
+//! block is encrypted
+static idx_t GetCompressedHeaderSize(optional_ptr<BlockEncryption> encryption) {
+	return encryption ? sizeof(idx_t) + sizeof(uint64_t) : sizeof(idx_t);
+}
+
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, block_id_t block_id) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	auto position = GetPositionInFile(index.block_index);
+	if (encryption) {
+		auto encrypted = encryption->EncryptBuffer(Allocator::Get(db), buffer, NumericCast<uint64_t>(block_id));
+		encrypted->Write(*handle, position);
+		return;
+	}
+	buffer.Write(*handle, position);
 }
 
-unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
+void TemporaryFileHandle::WriteCompressedTemporaryFile(data_ptr_t data, idx_t size, TemporaryFileIndex index,
+                                                       block_id_t block_id) {
+	D_ASSERT(size <= slot_size);
+	if (encryption) {
+		auto header_size = GetCompressedHeaderSize(encryption);
+		auto payload = data + header_size;
+		auto synthetic_iv = encryption->Encrypt(payload, payload, size - header_size, NumericCast<uint64_t>(block_id));
+		Store<uint64_t>(synthetic_iv, data + sizeof(idx_t));
+	}
+	// the data is padded to whole sectors, so that writing it with direct I/O does not read-modify-write a sector
+	handle->Write(data, AlignValue<idx_t, Storage::SECTOR_SIZE>(size), GetPositionInFile(index.block_index));
+}
+
+unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(block_id_t block_id, idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(
-	    BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-	    BufferManager::GetBufferManager(db).GetBlockSize(), std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto position = GetPositionInFile(block_index);
+	if (slot_size == buffer_manager.GetBlockAllocSize()) {
+		auto buffer = StandardBufferManager::ReadTemporaryBufferInternal(
+		    buffer_manager, *handle, position, buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+		if (encryption && !encryption->DecryptBuffer(*buffer, NumericCast<uint64_t>(block_id))) {
+			throw IOException("Corrupt encrypted block in temporary file \"%s\"", path);
+		}
+		return buffer;
+	}
+
+	// the block is compressed: read the header, followed by the compressed data itself
+	auto header_size = GetCompressedHeaderSize(encryption);
+	data_t header[sizeof(idx_t) + sizeof(uint64_t)];
+	handle->Read(header, header_size, position);
+	auto compressed_size = Load<idx_t>(header);
+	if (header_size + compressed_size > slot_size) {
+		throw IOException("Corrupt compressed block in temporary file \"%s\"", path);
+	}
+	auto compressed = Allocator::Get(db).Allocate(compressed_size);
+	handle->Read(compressed.get(), compressed_size, position + header_size);
+	if (encryption) {
+		auto synthetic_iv = Load<uint64_t>(header + sizeof(idx_t));
+		if (!encryption->Decrypt(compressed.get(), compressed_size, NumericCast<uint64_t>(block_id), synthetic_iv)) {
+			throw IOException("Corrupt encrypted block in temporary file \"%s\"", path);
+		}
+	}
+
+	auto buffer = buffer_manager.ConstructManagedBuffer(buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	auto uncompressed_size = static_cast<duckdb_miniz::mz_ulong>(buffer->size);
+	auto mz_ret = duckdb_miniz::mz_uncompress(buffer->buffer, &uncompressed_size, compressed.get(),
+	                                          static_cast<duckdb_miniz::mz_ulong>(compressed_size));
+	if (mz_ret != duckdb_miniz::MZ_OK || uncompressed_size != buffer->size) {
+		throw IOException("Failed to decompress block in temporary file \"%s\": %s", path,
+		                  duckdb_miniz::mz_error(mz_ret));
+	}
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -155,6 +226,7 @@ TemporaryFileInformation TemporaryFileHandle::GetTemporaryFile() {
 	TemporaryFileInformation info;
 	info.path = path;
 	info.size = GetPositionInFile(index_manager.GetMaxIndex());
+	info.uncompressed_size = index_manager.GetMaxIndex() * BufferManager::GetBufferManager(db).GetBlockAllocSize();
 	return info;
 }
 
@@ -164,6 +236,10 @@ void TemporaryFileHandle::CreateFileIfNotExists(TemporaryFileLock &) {
 	}
 	auto &fs = FileSystem::GetFileSystem(db);
 	auto open_flags = FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE;
+	if (DBConfig::GetConfig(db).options.use_direct_io) {
+		// blocks are written to aligned slots, so temporary files can bypass the page cache as well
+		open_flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+	}
 	handle = fs.OpenFile(path, open_flags);
 }
 
@@ -181,7 +257,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	return index * slot_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -268,6 +344,14 @@ static idx_t GetDefaultMax(const string &path) {
 
 TemporaryFileManager::TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p)
     : db(db), temp_directory(temp_directory_p), size_on_disk(0), max_swap_space(0) {
+	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
+		compression_skip[i] = 0;
+		compression_backoff[i] = 0;
+	}
+	if (DBConfig::GetConfig(db).options.temp_file_encryption) {
+		// the key only lives in memory, so the temporary files cannot be read by anyone else
+		encryption = BlockEncryption::CreateEphemeral(db);
+	}
 }
 
 TemporaryFileManager::~TemporaryFileManager() {
@@ -277,17 +361,57 @@ TemporaryFileManager::~TemporaryFileManager() {
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
-void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
+idx_t TemporaryFileManager::CompressBuffer(MemoryTag tag, FileBuffer &buffer, AllocatedData &compressed) {
+	if (!DBConfig::GetConfig(db).options.temp_file_compression) {
+		return 0;
+	}
+	auto tag_idx = static_cast<uint8_t>(tag);
+	if (compression_skip[tag_idx] > 0) {
+		// recent blocks of this tag did not compress - don't spend time on compressing this one either
+		compression_skip[tag_idx]--;
+		return 0;
+	}
+
+	auto header_size = GetCompressedHeaderSize(encryption.get());
+	auto source_size = static_cast<duckdb_miniz::mz_ulong>(buffer.size);
+	auto compressed_size = duckdb_miniz::mz_compressBound(source_size);
+	// the compressed data is padded to whole sectors when it is written
+	compressed = Allocator::Get(db).Allocate(AlignValue<idx_t, Storage::SECTOR_SIZE>(header_size + compressed_size));
+	auto mz_ret = duckdb_miniz::mz_compress2(compressed.get() + header_size, &compressed_size, buffer.buffer,
+	                                         source_size, duckdb_miniz::MZ_BEST_SPEED);
+	auto total_size = header_size + static_cast<idx_t>(compressed_size);
+	if (mz_ret != duckdb_miniz::MZ_OK ||
+	    AlignValue<idx_t, COMPRESSED_SLOT_ALIGNMENT>(total_size) >= buffer.AllocSize()) {
+		// the block does not fit in a smaller slot: back off from compressing blocks of this tag
+		auto backoff = MinValue<idx_t>(MaxValue<idx_t>(compression_backoff[tag_idx] * 2, 1), MAX_COMPRESSION_BACKOFF);
+		compression_backoff[tag_idx] = backoff;
+		compression_skip[tag_idx] = backoff;
+		return 0;
+	}
+	compression_backoff[tag_idx] = 0;
+	Store<idx_t>(static_cast<idx_t>(compressed_size), compressed.get());
+	memset(compressed.get() + total_size, 0, AlignValue<idx_t, Storage::SECTOR_SIZE>(total_size) - total_size);
+	return total_size;
+}
+
+void TemporaryFileManager::WriteTemporaryBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
+	AllocatedData compressed;
+	auto compressed_size = CompressBuffer(tag, buffer, compressed);
+	auto slot_size = compressed_size ? AlignValue<idx_t, COMPRESSED_SLOT_ALIGNMENT>(compressed_size)
+	                                 : BufferManager::GetBufferManager(db).GetBlockAllocSize();
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with the same slot size
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -297,7 +421,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this, slot_size);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -308,7 +433,11 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	if (compressed_size) {
+		handle->WriteCompressedTemporaryFile(compressed.get(), compressed_size, index, block_id);
+	} else {
+		handle->WriteTemporaryFile(buffer, index, block_id);
+	}
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -374,7 +503,7 @@ unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
 		index = GetTempBlockIndex(lock, id);
 		handle = GetFileHandle(lock, index.file_index);
 	}
-	auto buffer = handle->ReadTemporaryBuffer(index.block_index, std::move(reusable_buffer));
+	auto buffer = handle->ReadTemporaryBuffer(id, index.block_index, std::move(reusable_buffer));
 	{
 		// remove the block (and potentially erase the temp file)
 		TemporaryManagerLock lock(manager_lock);
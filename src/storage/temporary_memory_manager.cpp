@@ -11,7 +11,7 @@ namespace duckdb {
 TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p,
                                            idx_t minimum_reservation_p)
     : temporary_memory_manager(temporary_memory_manager_p), remaining_size(0),
-      minimum_reservation(minimum_reservation_p), reservation(0), materialization_penalty(1) {
+      minimum_reservation(minimum_reservation_p), reservation(0), materialization_penalty(1), rebalance_generation(0) {
 }
 
 TemporaryMemoryState::~TemporaryMemoryState() {
@@ -66,7 +66,37 @@ idx_t TemporaryMemoryState::GetMaterializationPenalty() const {
 	return materialization_penalty;
 }
 
-TemporaryMemoryManager::TemporaryMemoryManager() : reservation(0), remaining_size(0) {
+void TemporaryMemoryState::SetCostCurve(vector<TemporaryMemoryCost> new_cost_curve) {
+#ifdef DEBUG
+	for (idx_t i = 1; i < new_cost_curve.size(); i++) {
+		D_ASSERT(new_cost_curve[i - 1].reservation < new_cost_curve[i].reservation);
+	}
+#endif
+	auto guard = temporary_memory_manager.Lock();
+	cost_curve = std::move(new_cost_curve);
+}
+
+bool TemporaryMemoryState::CanRebalance() const {
+	return rebalance_generation != temporary_memory_manager.rebalance_generation;
+}
+
+double TemporaryMemoryState::GetExpectedIO(const idx_t for_reservation) const {
+	if (cost_curve.empty()) {
+		// Whatever does not fit is written to and read back from disk
+		const auto size = GetRemainingSize();
+		return for_reservation >= size ? 0 : 2 * static_cast<double>(size - for_reservation);
+	}
+	auto result = cost_curve[0].expected_io;
+	for (auto &point : cost_curve) {
+		if (point.reservation > for_reservation) {
+			break;
+		}
+		result = point.expected_io;
+	}
+	return static_cast<double>(result);
+}
+
+TemporaryMemoryManager::TemporaryMemoryManager() : reservation(0), remaining_size(0), rebalance_generation(0) {
 }
 
 unique_lock<mutex> TemporaryMemoryManager::Lock() {
@@ -152,6 +182,7 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 
 		SetReservation(temporary_memory_state, new_reservation);
 	}
+	temporary_memory_state.rebalance_generation = rebalance_generation.load();
 
 	Verify();
 }
@@ -165,6 +196,10 @@ void TemporaryMemoryManager::SetRemainingSize(TemporaryMemoryState &temporary_me
 
 void TemporaryMemoryManager::SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation) {
 	D_ASSERT(this->reservation >= temporary_memory_state.GetReservation());
+	if (new_reservation < temporary_memory_state.GetReservation()) {
+		// Memory was released, other states may be able to increase their reservation
+		rebalance_generation++;
+	}
 	this->reservation -= temporary_memory_state.GetReservation();
 	temporary_memory_state.reservation = new_reservation;
 	this->reservation += temporary_memory_state.GetReservation();
@@ -215,6 +250,13 @@ static void ComputeDerivatives(const vector<reference<const TemporaryMemoryState
 idx_t TemporaryMemoryManager::ComputeReservation(const TemporaryMemoryState &temporary_memory_state) const {
 	static constexpr idx_t OPTIMIZATION_ITERATIONS_MULTIPLIER = 5;
 
+	for (auto &state : active_states) {
+		if (!state.get().cost_curve.empty()) {
+			// At least one operator reported how its I/O depends on its reservation, use that instead
+			return ComputeReservationFromCostCurves(temporary_memory_state);
+		}
+	}
+
 	// Use vectors for ease
 	optional_idx state_index;
 	vector<reference<const TemporaryMemoryState>> states;
@@ -320,6 +362,68 @@ idx_t TemporaryMemoryManager::ComputeReservation(const TemporaryMemoryState &tem
 	throw InternalException("Did not find state_index in ComputeOptimalReservation");
 }
 
+idx_t TemporaryMemoryManager::ComputeReservationFromCostCurves(
+    const TemporaryMemoryState &temporary_memory_state) const {
+	optional_idx state_index;
+	vector<reference<const TemporaryMemoryState>> states;
+	vector<idx_t> res;
+	idx_t sum_of_initial_res = 0;
+	for (auto &state : active_states) {
+		if (RefersToSameObject(state.get(), temporary_memory_state)) {
+			state_index = states.size();
+		}
+		const auto initial_reservation = ComputeInitialReservation(state);
+		sum_of_initial_res += initial_reservation;
+		states.emplace_back(state);
+		res.push_back(initial_reservation);
+	}
+
+	if (sum_of_initial_res >= memory_limit) {
+		return res[state_index.GetIndex()];
+	}
+	auto remaining_memory = memory_limit - sum_of_initial_res;
+
+	// Repeatedly grow the reservation that saves the most I/O per byte. We consider every point on the cost curves,
+	// not just the next one, so that a state that only benefits from a large increase (e.g., fitting fully in memory)
+	// is not starved by states that benefit a little from small increases
+	while (remaining_memory != 0) {
+		optional_idx best_idx;
+		idx_t best_reservation = 0;
+		double best_ratio = 0;
+		for (idx_t i = 0; i < states.size(); i++) {
+			auto &state = states[i].get();
+			const auto max_reservation = MinValue(state.GetRemainingSize(), res[i] + remaining_memory);
+			if (max_reservation <= res[i]) {
+				continue;
+			}
+			const auto current_io = state.GetExpectedIO(res[i]);
+			auto consider = [&](const idx_t candidate) {
+				if (candidate <= res[i] || candidate > max_reservation) {
+					return;
+				}
+				const auto ratio =
+				    (current_io - state.GetExpectedIO(candidate)) / static_cast<double>(candidate - res[i]);
+				if (ratio > best_ratio) {
+					best_idx = i;
+					best_reservation = candidate;
+					best_ratio = ratio;
+				}
+			};
+			for (auto &point : state.cost_curve) {
+				consider(point.reservation);
+			}
+			consider(max_reservation);
+		}
+		if (!best_idx.IsValid()) {
+			break; // No state can save any more I/O
+		}
+		remaining_memory -= best_reservation - res[best_idx.GetIndex()];
+		res[best_idx.GetIndex()] = best_reservation;
+	}
+
+	return res[state_index.GetIndex()];
+}
+
 void TemporaryMemoryManager::Verify() const {
 #ifdef DEBUG
 	idx_t total_reservation = 0;
@@ -17,6 +17,8 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
@@ -24,25 +26,63 @@
 #include "duckdb/planner/binder.hpp"
 #include "duckdb/planner/expression_binder/index_binder.hpp"
 #include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
+#include "duckdb/storage/block_encryption.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/table/delete_state.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/storage/table/column_data.hpp"
+#include "duckdb/storage/table/row_group_collection.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
 
 namespace duckdb {
 
+//! The inserts into a table that have been deserialized but not yet applied
+struct ReplayTableAppend {
+	explicit ReplayTableAppend(TableCatalogEntry &table) : table(table) {
+	}
+
+	TableCatalogEntry &table;
+	vector<unique_ptr<DataChunk>> chunks;
+	idx_t row_count = 0;
+};
+
 class ReplayState {
 public:
-	ReplayState(AttachedDatabase &db, ClientContext &context) : db(db), context(context), catalog(db.GetCatalog()) {
+	ReplayState(AttachedDatabase &db, ClientContext &context)
+	    : db(db), context(context), catalog(db.GetCatalog()),
+	      encryption(StorageManager::Get(db).GetBlockManager().GetEncryption()) {
+		// with multiple threads, inserts are buffered so they can be applied in parallel - we buffer one row group
+		// per thread to keep the memory usage bounded
+		auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+		max_pending_rows = thread_count > 1 ? thread_count * Storage::ROW_GROUP_SIZE : 0;
 	}
 
 	AttachedDatabase &db;
 	ClientContext &context;
 	Catalog &catalog;
+	//! The encryption of the WAL entries, if the database is encrypted
+	optional_ptr<const BlockEncryption> encryption;
 	optional_ptr<TableCatalogEntry> current_table;
 	MetaBlockPointer checkpoint_id;
 	idx_t wal_version = 1;
+	//! The amount of replayed entries
+	idx_t replayed_entries = 0;
+	//! The amount of row group sized appends that were applied in parallel
+	idx_t parallel_appends = 0;
+
+public:
+	//! Buffers an insert into a table - returns false if inserts are applied directly
+	bool BufferAppend(TableCatalogEntry &table, DataChunk &chunk);
+	//! Applies the buffered inserts to the transaction-local storage of their tables
+	void FlushAppends();
+
+private:
+	//! The buffered inserts, in the order in which the tables were first inserted into
+	vector<unique_ptr<ReplayTableAppend>> pending_appends;
+	reference_map_t<DataTable, idx_t> pending_append_map;
+	idx_t pending_rows = 0;
+	idx_t max_pending_rows;
 };
 
 class WriteAheadLogDeserializer {
@@ -84,6 +124,17 @@ public:
 		auto buffer = unique_ptr<data_t[]>(new data_t[size]);
 		stream.ReadData(buffer.get(), size);
 
+		if (state_p.encryption) {
+			// the entries of an encrypted database store their synthetic IV instead of a checksum
+			auto location = offset | BlockEncryption::WAL_LOCATION_FLAG;
+			if (!state_p.encryption->Decrypt(buffer.get(), size, location, stored_checksum)) {
+				throw IOException("Corrupt WAL file: entry at byte position %llu does not match its synthetic IV after "
+				                  "decryption",
+				                  offset);
+			}
+			return WriteAheadLogDeserializer(state_p, std::move(buffer), size, deserialize_only);
+		}
+
 		// compute and verify the checksum
 		auto computed_checksum = Checksum(buffer.get(), size);
 		if (stored_checksum != computed_checksum) {
@@ -97,10 +148,17 @@ public:
 	bool ReplayEntry() {
 		deserializer.Begin();
 		auto wal_type = deserializer.ReadProperty<WALType>(100, "wal_type");
+		if (!DeserializeOnly()) {
+			state.replayed_entries++;
+		}
 		if (wal_type == WALType::WAL_FLUSH) {
 			deserializer.End();
 			return true;
 		}
+		if (!DeserializeOnly() && wal_type != WALType::USE_TABLE && wal_type != WALType::INSERT_TUPLE) {
+			// any other entry can depend on the inserted rows - apply the buffered inserts first
+			state.FlushAppends();
+		}
 		ReplayEntry(wal_type);
 		deserializer.End();
 		return false;
@@ -170,6 +228,9 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		// WAL is empty
 		return false;
 	}
+	auto start_time = std::chrono::steady_clock::now();
+	WALReplayInfo replay_info;
+	replay_info.wal_size = reader.FileSize();
 
 	con.BeginTransaction();
 	MetaTransaction::Get(*con.context).ModifyDatabase(database);
@@ -221,7 +282,9 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 			// read the current entry
 			auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
 			if (deserializer.ReplayEntry()) {
+				state.FlushAppends();
 				con.Commit();
+				replay_info.replayed_bytes = reader.CurrentOffset();
 				// check if the file is exhausted
 				if (reader.Finished()) {
 					// we finished reading the file: break
@@ -246,9 +309,117 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		con.Query("ROLLBACK");
 		throw;
 	} // LCOV_EXCL_STOP
+	replay_info.replayed_entries = state.replayed_entries;
+	replay_info.parallel_appends = state.parallel_appends;
+	replay_info.duration_ms = NumericCast<idx_t>(
+	    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time).count());
+	database.GetStorageManager().SetWALReplayInfo(replay_info);
 	return false;
 }
 
+//===--------------------------------------------------------------------===//
+// Parallel Appends
+//===--------------------------------------------------------------------===//
+class ReplayAppendTask : public BaseExecutorTask {
+public:
+	ReplayAppendTask(TaskExecutor &executor, RowGroupCollection &collection, vector<unique_ptr<DataChunk>> chunks)
+	    : BaseExecutorTask(executor), collection(collection), chunks(std::move(chunks)) {
+	}
+
+	void ExecuteTask() override {
+		TableAppendState append_state;
+		collection.InitializeAppend(append_state);
+		for (auto &chunk : chunks) {
+			collection.Append(*chunk, append_state);
+		}
+		collection.FinalizeAppend(TransactionData(0, 0), append_state);
+	}
+
+private:
+	RowGroupCollection &collection;
+	vector<unique_ptr<DataChunk>> chunks;
+};
+
+bool ReplayState::BufferAppend(TableCatalogEntry &table, DataChunk &chunk) {
+	if (max_pending_rows == 0) {
+		return false;
+	}
+	auto &storage = table.GetStorage();
+	auto entry = pending_append_map.find(storage);
+	if (entry == pending_append_map.end()) {
+		entry = pending_append_map.insert(make_pair(reference<DataTable>(storage), pending_appends.size())).first;
+		pending_appends.push_back(make_uniq<ReplayTableAppend>(table));
+	}
+	auto &append = *pending_appends[entry->second];
+	auto buffered_chunk = make_uniq<DataChunk>();
+	buffered_chunk->Move(chunk);
+	append.row_count += buffered_chunk->size();
+	pending_rows += buffered_chunk->size();
+	append.chunks.push_back(std::move(buffered_chunk));
+	if (pending_rows >= max_pending_rows) {
+		FlushAppends();
+	}
+	return true;
+}
+
+void ReplayState::FlushAppends() {
+	if (pending_appends.empty()) {
+		return;
+	}
+	vector<unique_ptr<ReplayTableAppend>> appends;
+	std::swap(appends, pending_appends);
+	pending_append_map.clear();
+	pending_rows = 0;
+
+	vector<unique_ptr<BoundConstraint>> bound_constraints;
+	if (appends.size() == 1 && appends[0]->row_count <= Storage::ROW_GROUP_SIZE) {
+		// not enough rows to parallelize: append directly to the transaction-local storage
+		auto &append = *appends[0];
+		LocalAppendState append_state;
+		auto &storage = append.table.GetStorage();
+		storage.InitializeLocalAppend(append_state, append.table, context, bound_constraints);
+		for (auto &chunk : append.chunks) {
+			storage.LocalAppend(append_state, append.table, context, *chunk);
+		}
+		storage.FinalizeLocalAppend(append_state);
+		return;
+	}
+
+	// split the inserts of every table into row group sized collections and fill them in parallel
+	vector<vector<unique_ptr<RowGroupCollection>>> collections(appends.size());
+	TaskExecutor executor(context);
+	for (idx_t append_idx = 0; append_idx < appends.size(); append_idx++) {
+		auto &append = *appends[append_idx];
+		auto &storage = append.table.GetStorage();
+		auto &block_manager = TableIOManager::Get(storage).GetBlockManagerForRowData();
+		idx_t chunk_idx = 0;
+		while (chunk_idx < append.chunks.size()) {
+			vector<unique_ptr<DataChunk>> chunks;
+			idx_t row_count = 0;
+			while (chunk_idx < append.chunks.size() &&
+			       (chunks.empty() || row_count + append.chunks[chunk_idx]->size() <= Storage::ROW_GROUP_SIZE)) {
+				row_count += append.chunks[chunk_idx]->size();
+				chunks.push_back(std::move(append.chunks[chunk_idx++]));
+			}
+			auto collection = make_uniq<RowGroupCollection>(storage.GetDataTableInfo(), block_manager,
+			                                                storage.GetTypes(), NumericCast<idx_t>(MAX_ROW_ID));
+			collection->InitializeEmpty();
+			executor.ScheduleTask(make_uniq<ReplayAppendTask>(executor, *collection, std::move(chunks)));
+			collections[append_idx].push_back(std::move(collection));
+			parallel_appends++;
+		}
+	}
+	executor.WorkOnTasks();
+
+	// merge the collections into the transaction-local storage in the order in which the rows were inserted
+	for (idx_t append_idx = 0; append_idx < appends.size(); append_idx++) {
+		auto &storage = appends[append_idx]->table.GetStorage();
+		for (auto &collection : collections[append_idx]) {
+			storage.LocalMerge(context, *collection);
+		}
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Replay Entries
 //===--------------------------------------------------------------------===//
@@ -651,6 +822,10 @@ void WriteAheadLogDeserializer::ReplayInsert() {
 		throw InternalException("Corrupt WAL: insert without table");
 	}
 
+	// buffer the insert so it can be applied in parallel with inserts into other tables
+	if (state.BufferAppend(*state.current_table, chunk)) {
+		return;
+	}
 	// append to the current table
 	// we don't do any constraint verification here
 	vector<unique_ptr<BoundConstraint>> bound_constraints;
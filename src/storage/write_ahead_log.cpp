@@ -9,7 +9,9 @@
 #include "duckdb/common/serializer/binary_serializer.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
+#include "duckdb/storage/block_encryption.hpp"
 #include "duckdb/storage/index.hpp"
+#include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
 #include "duckdb/storage/table/data_table_info.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
@@ -22,7 +24,7 @@ namespace duckdb {
 const uint64_t WAL_VERSION_NUMBER = 2;
 
 WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path)
-    : database(database), wal_path(wal_path), wal_size(0), initialized(false) {
+    : database(database), wal_path(wal_path), wal_size(0), initialized(false), flushed_commit_sequence(0) {
 }
 
 WriteAheadLog::~WriteAheadLog() {
@@ -43,6 +45,10 @@ BufferedFileWriter &WriteAheadLog::Initialize() {
 	return *writer;
 }
 
+optional_ptr<const BlockEncryption> WriteAheadLog::GetEncryption() {
+	return StorageManager::Get(database).GetBlockManager().GetEncryption();
+}
+
 //! Gets the total bytes written to the WAL since startup
 idx_t WriteAheadLog::GetWALSize() {
 	if (!Initialized()) {
@@ -99,8 +105,17 @@ public:
 		}
 		auto data = memory_stream.GetData();
 		auto size = memory_stream.GetPosition();
-		// compute the checksum over the entry
-		auto checksum = Checksum(data, size);
+		uint64_t checksum;
+		auto encryption = wal.GetEncryption();
+		if (encryption) {
+			// the WAL of an encrypted database is encrypted as well: the entry stores its synthetic IV instead of a
+			// checksum, and the location of the entry is the offset of its data in the WAL file
+			auto location = (stream->GetFileSize() + 2 * sizeof(uint64_t)) | BlockEncryption::WAL_LOCATION_FLAG;
+			checksum = encryption->Encrypt(data, data, size, location);
+		} else {
+			// compute the checksum over the entry
+			checksum = Checksum(data, size);
+		}
 		// write the checksum and the length of the entry
 		stream->Write<uint64_t>(size);
 		stream->Write<uint64_t>(checksum);
@@ -112,7 +127,7 @@ public:
 
 private:
 	WriteAheadLog &wal;
-	optional_ptr<WriteStream> stream;
+	optional_ptr<BufferedFileWriter> stream;
 	MemoryStream memory_stream;
 };
 
@@ -423,4 +438,56 @@ void WriteAheadLog::Flush() {
 	wal_size = writer->GetFileSize();
 }
 
+idx_t WriteAheadLog::FlushCommit() {
+	if (!writer) {
+		return 0;
+	}
+
+	// write an empty entry
+	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
+	serializer.End();
+
+	// hand the commit to the operating system - it is synced to disk in SyncCommit
+	writer->Flush();
+	wal_size = writer->GetFileSize();
+	return ++flushed_commit_sequence;
+}
+
+void WriteAheadLog::SyncCommit(idx_t commit_sequence) {
+	unique_lock<mutex> guard(sync_lock);
+	while (synced_commit_sequence < commit_sequence) {
+		if (sync_in_progress) {
+			// another committer is syncing the WAL - wait for it, and sync ourselves if it did not cover our commit
+			sync_cv.wait(guard);
+			continue;
+		}
+		// sync everything that has been flushed so far, on behalf of all committers that are waiting
+		sync_in_progress = true;
+		idx_t sync_sequence = flushed_commit_sequence;
+		guard.unlock();
+		ErrorData error;
+		try {
+			writer->handle->Sync();
+		} catch (std::exception &ex) {
+			error = ErrorData(ex);
+		}
+		guard.lock();
+		sync_in_progress = false;
+		if (!error.HasError()) {
+			synced_commit_sequence = MaxValue<idx_t>(synced_commit_sequence, sync_sequence);
+		}
+		sync_cv.notify_all();
+		if (error.HasError()) {
+			error.Throw();
+		}
+	}
+}
+
+void WriteAheadLog::SyncCommits() {
+	if (!writer) {
+		return;
+	}
+	SyncCommit(flushed_commit_sequence);
+}
+
 } // namespace duckdb
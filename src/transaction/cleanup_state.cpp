@@ -60,6 +60,8 @@ void CleanupState::CleanupUpdate(UpdateInfo &info) {
 
 void CleanupState::CleanupDelete(DeleteInfo &info) {
 	auto version_table = info.table;
+	// the deletes are visible to all transactions: try to compress the version info of the vector
+	version_table->CleanupDelete(lowest_active_transaction, info.base_row);
 	if (!version_table->HasIndexes()) {
 		// this table has no indexes: no cleanup to be done
 		return;
@@ -192,6 +192,15 @@ bool DuckTransaction::ShouldWriteToWAL(AttachedDatabase &db) {
 	return true;
 }
 
+ErrorData DuckTransaction::PrepareCommit() noexcept {
+	try {
+		storage->PrepareCommit();
+	} catch (std::exception &ex) {
+		return ErrorData(ex);
+	}
+	return ErrorData();
+}
+
 ErrorData DuckTransaction::WriteToWAL(AttachedDatabase &db, unique_ptr<StorageCommitState> &commit_state) noexcept {
 	try {
 		D_ASSERT(ShouldWriteToWAL(db));
@@ -217,7 +226,7 @@ ErrorData DuckTransaction::WriteToWAL(AttachedDatabase &db, unique_ptr<StorageCo
 }
 
 ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit_id,
-                                  unique_ptr<StorageCommitState> commit_state) noexcept {
+                                  optional_ptr<StorageCommitState> commit_state) noexcept {
 	// "checkpoint" parameter indicates if the caller will checkpoint. If checkpoint ==
 	//    true: Then this function will NOT write to the WAL or flush/persist.
 	//          This method only makes commit in memory, expecting caller to checkpoint/flush.
@@ -270,6 +279,31 @@ unique_ptr<StorageLockKey> DuckTransaction::TryGetCheckpointLock() {
 	return transaction_manager.TryUpgradeCheckpointLock(*write_lock);
 }
 
+optional_ptr<CatalogEntry> DuckTransaction::GetCachedCatalogEntry(CatalogSet &set, const string &name,
+                                                                 idx_t set_version) {
+	lock_guard<mutex> l(catalog_cache_lock);
+	auto set_entry = catalog_cache.find(set);
+	if (set_entry == catalog_cache.end()) {
+		return nullptr;
+	}
+	auto entry = set_entry->second.find(name);
+	if (entry == set_entry->second.end() || entry->second.first != set_version) {
+		return nullptr;
+	}
+	return &entry->second.second.get();
+}
+
+void DuckTransaction::CacheCatalogEntry(CatalogSet &set, const string &name, idx_t set_version,
+                                        CatalogEntry &entry) {
+	lock_guard<mutex> l(catalog_cache_lock);
+	auto &set_entries = catalog_cache[set];
+	auto existing = set_entries.find(name);
+	if (existing != set_entries.end()) {
+		set_entries.erase(existing);
+	}
+	set_entries.emplace(name, make_pair(set_version, std::ref(entry)));
+}
+
 shared_ptr<CheckpointLock> DuckTransaction::SharedLockTable(DataTableInfo &info) {
 	lock_guard<mutex> l(active_locks_lock);
 	auto entry = active_locks.find(info);
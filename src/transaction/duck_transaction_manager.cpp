@@ -7,6 +7,7 @@
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/dependency_manager.hpp"
+#include "duckdb/storage/background_checkpointer.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -27,6 +28,7 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : Transacti
 	current_transaction_id = TRANSACTION_ID_START;
 	lowest_active_id = TRANSACTION_ID_START;
 	lowest_active_start = MAX_TRANSACTION_ID;
+	last_change_commit = 0;
 	if (!db.GetCatalog().IsDuckCatalog()) {
 		// Specifically the StorageManager of the DuckCatalog is relied on, with `db.GetStorageManager`
 		throw InternalException("DuckTransactionManager should only be created together with a DuckCatalog");
@@ -190,6 +192,9 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 			lock = checkpoint_lock.TryGetExclusiveLock();
 		}
 	}
+	// finish cleaning up old versions before checkpointing
+	lock_guard<mutex> cleanup_guard(cleanup_lock);
+	CleanupTransactionsInternal();
 	CheckpointOptions options;
 	if (GetLastCommit() > LowestActiveStart()) {
 		// we cannot do a full checkpoint if any transaction needs to read old data
@@ -198,6 +203,51 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 	storage_manager.CreateCheckpoint(options);
 }
 
+bool DuckTransactionManager::TryBackgroundCheckpoint() {
+	auto &storage_manager = db.GetStorageManager();
+	if (storage_manager.InMemory()) {
+		return true;
+	}
+	// write transactions hold a shared checkpoint lock - if any are active we try again later
+	auto lock = checkpoint_lock.TryGetExclusiveLock();
+	if (!lock) {
+		return false;
+	}
+	lock_guard<mutex> cleanup_guard(cleanup_lock);
+	CleanupTransactionsInternal();
+	CheckpointOptions options;
+	{
+		lock_guard<mutex> guard(transaction_lock);
+		if (!active_transactions.empty()) {
+			auto &config = DBConfig::Get(db);
+			if (storage_manager.GetWALSize() <= 2 * config.options.checkpoint_wal_size) {
+				// yield to running queries
+				return false;
+			}
+		}
+		if (GetLastCommit() > LowestActiveStart()) {
+			// we cannot do a full checkpoint if any transaction needs to read old data
+			options.type = CheckpointType::CONCURRENT_CHECKPOINT;
+		}
+	}
+	storage_manager.CreateCheckpoint(options);
+	return true;
+}
+
+void DuckTransactionManager::SyncWAL() {
+	auto &storage_manager = db.GetStorageManager();
+	// the shared checkpoint lock prevents the WAL from being checkpointed and deleted while we sync it
+	auto lock = checkpoint_lock.GetSharedLock();
+	optional_ptr<WriteAheadLog> wal;
+	{
+		lock_guard<mutex> guard(wal_lock);
+		wal = storage_manager.GetWAL();
+	}
+	if (wal) {
+		wal->SyncCommits();
+	}
+}
+
 unique_ptr<StorageLockKey> DuckTransactionManager::SharedCheckpointLock() {
 	return checkpoint_lock.GetSharedLock();
 }
@@ -214,6 +264,8 @@ transaction_t DuckTransactionManager::GetCommitTimestamp() {
 
 ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Transaction &transaction_p) {
 	auto &transaction = transaction_p.Cast<DuckTransaction>();
+	// prepare the commit before we grab the transaction lock, e.g., to write the data of bulk appends
+	auto error = transaction.PrepareCommit();
 	unique_lock<mutex> tlock(transaction_lock);
 	if (!db.IsSystem() && !db.IsTemporary()) {
 		if (transaction.ChangesMade()) {
@@ -228,10 +280,9 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	unique_ptr<StorageLockKey> lock;
 	auto undo_properties = transaction.GetUndoProperties();
 	auto checkpoint_decision = CanCheckpoint(transaction, lock, undo_properties);
-	ErrorData error;
 	unique_ptr<lock_guard<mutex>> held_wal_lock;
 	unique_ptr<StorageCommitState> commit_state;
-	if (!checkpoint_decision.can_checkpoint && transaction.ShouldWriteToWAL(db)) {
+	if (!error.HasError() && !checkpoint_decision.can_checkpoint && transaction.ShouldWriteToWAL(db)) {
 		// if we are committing changes and we are not checkpointing, we need to write to the WAL
 		// since WAL writes can take a long time - we grab the WAL lock here and unlock the transaction lock
 		// read-only transactions can bypass this branch and start/commit while the WAL write is happening
@@ -254,9 +305,12 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	}
 	// obtain a commit id for the transaction
 	transaction_t commit_id = GetCommitTimestamp();
+	if (transaction.ChangesMade()) {
+		last_change_commit = commit_id;
+	}
 	// commit the UndoBuffer of the transaction
 	if (!error.HasError()) {
-		error = transaction.Commit(db, commit_id, std::move(commit_state));
+		error = transaction.Commit(db, commit_id, commit_state.get());
 	}
 	if (error.HasError()) {
 		// commit unsuccessful: rollback the transaction instead
@@ -276,6 +330,22 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		lock.reset();
 	}
 
+	if (commit_state && !error.HasError()) {
+		// wait until the commit is durable without holding the transaction or WAL lock, so that concurrent commits can
+		// be flushed in the meantime and share a single sync of the WAL (group commit)
+		// the transaction is still active and holds its write lock, so the WAL cannot be checkpointed away meanwhile
+		tlock.unlock();
+		held_wal_lock.reset();
+		try {
+			commit_state->SyncCommit();
+		} catch (std::exception &ex) {
+			// the changes are already visible to other transactions, so the commit can no longer be reverted
+			ErrorData sync_error(ex);
+			error = ErrorData(ExceptionType::FATAL, "Failed to sync the WAL after commit: " + sync_error.RawMessage());
+		}
+		tlock.lock();
+	}
+
 	// commit successful: remove the transaction id from the list of active transactions
 	// potentially resulting in garbage collection
 	bool store_transaction = undo_properties.has_updates || undo_properties.has_catalog_changes || error.HasError();
@@ -286,27 +356,87 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		D_ASSERT(lock);
 		// we can unlock the transaction lock while checkpointing
 		tlock.unlock();
+		// finish cleaning up old versions before checkpointing
+		lock_guard<mutex> cleanup_guard(cleanup_lock);
+		CleanupTransactionsInternal();
 		// checkpoint the database to disk
 		CheckpointOptions options;
 		options.action = CheckpointAction::ALWAYS_CHECKPOINT;
 		options.type = checkpoint_decision.type;
 		auto &storage_manager = db.GetStorageManager();
 		storage_manager.CreateCheckpoint(options);
+	} else {
+		tlock.unlock();
+		ScheduleCleanup();
 	}
 	return error;
 }
 
 void DuckTransactionManager::RollbackTransaction(Transaction &transaction_p) {
 	auto &transaction = transaction_p.Cast<DuckTransaction>();
-	// obtain the transaction lock during this function
-	lock_guard<mutex> lock(transaction_lock);
+	{
+		// obtain the transaction lock while rolling back
+		lock_guard<mutex> lock(transaction_lock);
 
-	// rollback the transaction
-	transaction.Rollback();
+		// rollback the transaction
+		transaction.Rollback();
 
-	// remove the transaction id from the list of active transactions
-	// potentially resulting in garbage collection
-	RemoveTransaction(transaction);
+		// remove the transaction id from the list of active transactions
+		// potentially resulting in garbage collection
+		RemoveTransaction(transaction);
+	}
+	ScheduleCleanup();
+}
+
+void DuckTransactionManager::ScheduleCleanup() {
+	{
+		lock_guard<mutex> guard(transaction_lock);
+		if (cleanup_queue.empty()) {
+			return;
+		}
+	}
+	if (!db.IsSystem()) {
+		auto background_checkpointer = db.GetStorageManager().GetBackgroundCheckpointer();
+		if (background_checkpointer && background_checkpointer->NotifyCleanup()) {
+			// the background thread cleans up the transactions
+			return;
+		}
+	}
+	CleanupTransactions();
+}
+
+void DuckTransactionManager::CleanupTransactions() {
+	unique_lock<mutex> cleanup_guard(cleanup_lock, std::try_to_lock);
+	if (!cleanup_guard.owns_lock()) {
+		// another thread is already cleaning up
+		return;
+	}
+	CleanupTransactionsInternal();
+}
+
+void DuckTransactionManager::CleanupTransactionsInternal() {
+	while (true) {
+		PendingCleanup pending;
+		{
+			lock_guard<mutex> guard(transaction_lock);
+			if (cleanup_queue.empty()) {
+				return;
+			}
+			pending = std::move(cleanup_queue.front());
+			cleanup_queue.pop_front();
+		}
+		// clean up the transaction without holding the transaction lock, so that other transactions can start and
+		// commit in the meantime
+		pending.transaction->Cleanup(pending.lowest_active_start);
+		if (!pending.store_transaction) {
+			continue;
+		}
+		// any currently running query can still be using the version information of the transaction - we can only
+		// free it once all queries that are active now have finished
+		lock_guard<mutex> guard(transaction_lock);
+		pending.transaction->highest_active_query = DatabaseManager::Get(db).ActiveQueryNumber();
+		old_transactions.push_back(std::move(pending.transaction));
+	}
 }
 
 void DuckTransactionManager::RemoveTransaction(DuckTransaction &transaction) noexcept {
@@ -350,7 +480,8 @@ void DuckTransactionManager::RemoveTransaction(DuckTransaction &transaction, boo
 			old_transactions.push_back(std::move(current_transaction));
 		}
 	} else if (transaction.ChangesMade()) {
-		transaction.Cleanup(lowest_start_time);
+		// the transaction needs to be cleaned up, but nobody can be using its information afterwards
+		cleanup_queue.push_back(PendingCleanup {std::move(current_transaction), lowest_start_time, false});
 	}
 	// remove the transaction from the set of currently active transactions
 	active_transactions.unsafe_erase_at(t_index);
@@ -372,11 +503,10 @@ void DuckTransactionManager::RemoveTransaction(DuckTransaction &transaction, boo
 			// we can only safely do the actual memory cleanup when all the
 			// currently active queries have finished running! (actually,
 			// when all the currently active scans have finished running...)
-			recently_committed_transactions[i]->Cleanup(lowest_start_time);
-			// store the current highest active query
-			recently_committed_transactions[i]->highest_active_query = current_query;
-			// move it to the list of transactions awaiting GC
-			old_transactions.push_back(std::move(recently_committed_transactions[i]));
+			// the cleanup itself is performed outside of the transaction lock, after which the transaction is moved
+			// to the list of transactions awaiting GC
+			cleanup_queue.push_back(
+			    PendingCleanup {std::move(recently_committed_transactions[i]), lowest_start_time, true});
 		} else {
 			// recently_committed_transactions is ordered on commit_id
 			// implicitly thus if the current one is bigger than
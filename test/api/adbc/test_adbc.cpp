@@ -78,7 +78,7 @@ public:
 	}
 
 	void CreateTable(const string &table_name, ArrowArrayStream &input_data, string schema = "",
-	                 bool temporary = false) {
+	                 bool temporary = false, const char *ingestion_mode = nullptr) {
 		REQUIRE(input_data.release);
 		AdbcStatement adbc_statement;
 		REQUIRE(SUCCESS(AdbcStatementNew(&adbc_connection, &adbc_statement, &adbc_error)));
@@ -103,6 +103,10 @@ public:
 		}
 		REQUIRE(SUCCESS(
 		    AdbcStatementSetOption(&adbc_statement, ADBC_INGEST_OPTION_TARGET_TABLE, table_name.c_str(), &adbc_error)));
+		if (ingestion_mode) {
+			REQUIRE(SUCCESS(
+			    AdbcStatementSetOption(&adbc_statement, ADBC_INGEST_OPTION_MODE, ingestion_mode, &adbc_error)));
+		}
 
 		REQUIRE(SUCCESS(AdbcStatementBindStream(&adbc_statement, &input_data, &adbc_error)));
 		REQUIRE(SUCCESS(AdbcStatementExecuteQuery(&adbc_statement, nullptr, nullptr, &adbc_error)));
@@ -193,6 +197,48 @@ TEST_CASE("ADBC - Test ingestion - Lineitem", "[adbc]") {
 	REQUIRE(db.QueryAndCheck("SELECT l_partkey, l_comment FROM lineitem WHERE l_orderkey=1 ORDER BY l_linenumber"));
 }
 
+TEST_CASE("ADBC - Test ingestion - Modes", "[adbc]") {
+	if (!duckdb_lib) {
+		return;
+	}
+	ADBCTestDatabase db;
+	db.Query("CREATE SCHEMA my_schema;");
+
+	// create_append creates the table if it does not exist yet
+	auto input_data = db.QueryArrow("SELECT range AS i FROM range(10000)");
+	db.CreateTable("my_table", input_data, "my_schema", false, ADBC_INGEST_OPTION_MODE_CREATE_APPEND);
+	REQUIRE(db.Query("SELECT COUNT(*), SUM(i) FROM my_schema.my_table")->GetValue(1, 0) == Value::HUGEINT(49995000));
+
+	// append goes into the table in the target schema
+	input_data = db.QueryArrow("SELECT range AS i FROM range(10000)");
+	db.CreateTable("my_table", input_data, "my_schema", false, ADBC_INGEST_OPTION_MODE_APPEND);
+	// create_append appends if the table exists
+	input_data = db.QueryArrow("SELECT range AS i FROM range(10000)");
+	db.CreateTable("my_table", input_data, "my_schema", false, ADBC_INGEST_OPTION_MODE_CREATE_APPEND);
+	REQUIRE(db.Query("SELECT COUNT(*) FROM my_schema.my_table")->GetValue(0, 0) == Value::BIGINT(30000));
+
+	// replace drops the existing table
+	input_data = db.QueryArrow("SELECT 'duck' AS s");
+	db.CreateTable("my_table", input_data, "my_schema", false, ADBC_INGEST_OPTION_MODE_REPLACE);
+	REQUIRE(db.QueryAndCheck("SELECT * FROM my_schema.my_table"));
+
+	// appending to a table that does not exist is an error
+	input_data = db.QueryArrow("SELECT 42");
+	AdbcStatement adbc_statement;
+	REQUIRE(SUCCESS(AdbcStatementNew(&db.adbc_connection, &adbc_statement, &db.adbc_error)));
+	REQUIRE(SUCCESS(AdbcStatementSetOption(&adbc_statement, ADBC_INGEST_OPTION_TARGET_TABLE, "nonexistent",
+	                                       &db.adbc_error)));
+	REQUIRE(SUCCESS(AdbcStatementSetOption(&adbc_statement, ADBC_INGEST_OPTION_MODE, ADBC_INGEST_OPTION_MODE_APPEND,
+	                                       &db.adbc_error)));
+	REQUIRE(SUCCESS(AdbcStatementBindStream(&adbc_statement, &input_data, &db.adbc_error)));
+	REQUIRE(!SUCCESS(AdbcStatementExecuteQuery(&adbc_statement, nullptr, nullptr, &db.adbc_error)));
+	REQUIRE(db.adbc_error.message);
+	db.adbc_error.release(&db.adbc_error);
+	InitializeADBCError(&db.adbc_error);
+	REQUIRE(SUCCESS(AdbcStatementRelease(&adbc_statement, &db.adbc_error)));
+	db.arrow_stream.release = nullptr;
+}
+
 TEST_CASE("Test Null Error/Database", "[adbc]") {
 	if (!duckdb_lib) {
 		return;
@@ -1,6 +1,8 @@
 #include "capi_tester.hpp"
 #include "duckdb.h"
 
+#include <condition_variable>
+
 using namespace duckdb;
 using namespace std;
 
@@ -28,3 +30,62 @@ TEST_CASE("Test pending statements in C API", "[capi]") {
 	REQUIRE(!result->HasError());
 	REQUIRE(result->Fetch<int64_t>(0, 0) == 499999500000LL);
 }
+
+struct PendingReadyNotifier {
+	std::mutex lock;
+	std::condition_variable cv;
+	bool ready = false;
+
+	static void Notify(void *user_data) {
+		auto &notifier = *reinterpret_cast<PendingReadyNotifier *>(user_data);
+		lock_guard<std::mutex> guard(notifier.lock);
+		notifier.ready = true;
+		notifier.cv.notify_all();
+	}
+
+	bool Wait() {
+		std::unique_lock<std::mutex> guard(lock);
+		auto result = cv.wait_for(guard, std::chrono::seconds(60), [&]() { return ready; });
+		ready = false;
+		return result;
+	}
+};
+
+TEST_CASE("Test asynchronous execution of pending statements in C API", "[capi]") {
+	CAPITester tester;
+	CAPIPrepared prepared;
+	CAPIPending pending;
+	PendingReadyNotifier notifier;
+	duckdb::unique_ptr<CAPIResult> result;
+
+	// the query is executed by the background threads
+	REQUIRE(tester.OpenDatabase(nullptr));
+	REQUIRE_NO_FAIL(tester.Query("SET threads=4"));
+	REQUIRE(prepared.Prepare(tester, "SELECT SUM(i) FROM range(10000000) tbl(i)"));
+	REQUIRE(pending.Pending(prepared));
+	REQUIRE(duckdb_pending_set_ready_callback(pending.pending, PendingReadyNotifier::Notify, &notifier) ==
+	        DuckDBSuccess);
+
+	duckdb_pending_state state;
+	do {
+		REQUIRE(notifier.Wait());
+		state = duckdb_pending_execute_check_state(pending.pending);
+		REQUIRE(state != DUCKDB_PENDING_ERROR);
+	} while (!duckdb_pending_execution_is_finished(state));
+
+	result = pending.Execute();
+	REQUIRE(result);
+	REQUIRE(!result->HasError());
+	REQUIRE(result->Fetch<int64_t>(0, 0) == 49999995000000LL);
+
+	// an interrupted query notifies the caller as well
+	CAPIPending interrupted;
+	REQUIRE(prepared.Prepare(tester, "SELECT SUM(i) FROM range(1000000000000) tbl(i)"));
+	REQUIRE(interrupted.Pending(prepared));
+	REQUIRE(duckdb_pending_set_ready_callback(interrupted.pending, PendingReadyNotifier::Notify, &notifier) ==
+	        DuckDBSuccess);
+	duckdb_interrupt(tester.connection);
+	REQUIRE(notifier.Wait());
+	REQUIRE(duckdb_pending_execute_check_state(interrupted.pending) == DUCKDB_PENDING_ERROR);
+	REQUIRE(duckdb_pending_set_ready_callback(interrupted.pending, nullptr, nullptr) == DuckDBError);
+}
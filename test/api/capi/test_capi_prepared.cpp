@@ -319,6 +319,67 @@ TEST_CASE("Test duckdb_param_type", "[capi]") {
 	duckdb_close(&db);
 }
 
+TEST_CASE("Test batch execution of prepared statements in C API", "[capi]") {
+	duckdb_database db;
+	duckdb_connection conn;
+	duckdb_prepared_statement stmt;
+	duckdb_result result;
+
+	REQUIRE(duckdb_open("", &db) == DuckDBSuccess);
+	REQUIRE(duckdb_connect(db, &conn) == DuckDBSuccess);
+	REQUIRE(duckdb_query(conn, "CREATE TABLE tbl (i INTEGER, s VARCHAR)", nullptr) == DuckDBSuccess);
+
+	duckdb_logical_type types[2] = {duckdb_create_logical_type(DUCKDB_TYPE_INTEGER),
+	                                duckdb_create_logical_type(DUCKDB_TYPE_VARCHAR)};
+	auto chunk = duckdb_create_data_chunk(types, 2);
+	auto int_data = reinterpret_cast<int32_t *>(duckdb_vector_get_data(duckdb_data_chunk_get_vector(chunk, 0)));
+	auto string_vector = duckdb_data_chunk_get_vector(chunk, 1);
+	for (idx_t i = 0; i < 1000; i++) {
+		int_data[i] = int32_t(i);
+		auto str = "value " + std::to_string(i);
+		duckdb_vector_assign_string_element(string_vector, i, str.c_str());
+	}
+	duckdb_data_chunk_set_size(chunk, 1000);
+
+	// a single-row INSERT is executed as one INSERT over all parameter rows
+	REQUIRE(duckdb_prepare(conn, "INSERT INTO tbl VALUES ($1 + 1, $2 || '!')", &stmt) == DuckDBSuccess);
+	REQUIRE(duckdb_execute_prepared_batch(stmt, chunk, &result) == DuckDBSuccess);
+	REQUIRE(duckdb_rows_changed(&result) == 1000);
+	duckdb_destroy_result(&result);
+	duckdb_destroy_prepare(&stmt);
+
+	REQUIRE(duckdb_query(conn, "SELECT COUNT(*), SUM(i), MAX(s) FROM tbl", &result) == DuckDBSuccess);
+	REQUIRE(duckdb_value_int64(&result, 0, 0) == 1000);
+	REQUIRE(duckdb_value_int64(&result, 1, 0) == 500500);
+	auto max_string = duckdb_value_varchar(&result, 2, 0);
+	REQUIRE(string(max_string) == "value 999!");
+	duckdb_free(max_string);
+	duckdb_destroy_result(&result);
+
+	// other statements are executed once per row
+	REQUIRE(duckdb_prepare(conn, "DELETE FROM tbl WHERE i = $1 AND s <> $2", &stmt) == DuckDBSuccess);
+	REQUIRE(duckdb_execute_prepared_batch(stmt, chunk, &result) == DuckDBSuccess);
+	duckdb_destroy_result(&result);
+	duckdb_destroy_prepare(&stmt);
+
+	REQUIRE(duckdb_query(conn, "SELECT COUNT(*) FROM tbl", &result) == DuckDBSuccess);
+	// all rows but the one with i = 1000 were deleted, as the parameters run from 0 to 999
+	REQUIRE(duckdb_value_int64(&result, 0, 0) == 1);
+	duckdb_destroy_result(&result);
+
+	// the number of parameter columns must match
+	REQUIRE(duckdb_prepare(conn, "INSERT INTO tbl VALUES ($1, 'x')", &stmt) == DuckDBSuccess);
+	REQUIRE(duckdb_execute_prepared_batch(stmt, chunk, &result) == DuckDBError);
+	duckdb_destroy_result(&result);
+	duckdb_destroy_prepare(&stmt);
+
+	duckdb_destroy_data_chunk(&chunk);
+	duckdb_destroy_logical_type(&types[0]);
+	duckdb_destroy_logical_type(&types[1]);
+	duckdb_disconnect(&conn);
+	duckdb_close(&db);
+}
+
 TEST_CASE("Test prepared statements with named parameters in C API", "[capi]") {
 	CAPITester tester;
 	duckdb::unique_ptr<CAPIResult> result;
@@ -178,3 +178,60 @@ TEST_CASE("Test query progress and interrupt in C API", "[capi]") {
 		}
 	}
 }
+
+TEST_CASE("Test fetching batches of chunks in C API", "[capi]") {
+	duckdb_database db;
+	duckdb_connection con;
+	duckdb_result result;
+
+	REQUIRE(duckdb_open(nullptr, &db) == DuckDBSuccess);
+	REQUIRE(duckdb_connect(db, &con) == DuckDBSuccess);
+	REQUIRE(duckdb_query(con,
+	                     "SELECT i::BIGINT i, CASE WHEN i % 3 = 0 THEN NULL ELSE i END j FROM range(100000) tbl(i)",
+	                     &result) == DuckDBSuccess);
+
+	idx_t min_rows = 10000;
+	idx_t total = 0;
+	idx_t mismatches = 0;
+	while (true) {
+		auto chunk = duckdb_fetch_chunk_batch(result, min_rows);
+		if (!chunk) {
+			break;
+		}
+		auto size = duckdb_data_chunk_get_size(chunk);
+		REQUIRE(size >= MinValue<idx_t>(min_rows, 100000 - total));
+		REQUIRE(size < min_rows + STANDARD_VECTOR_SIZE);
+
+		// every column is a single contiguous array
+		auto i_data = reinterpret_cast<int64_t *>(duckdb_vector_get_data(duckdb_data_chunk_get_vector(chunk, 0)));
+		auto j_vector = duckdb_data_chunk_get_vector(chunk, 1);
+		auto j_data = reinterpret_cast<int64_t *>(duckdb_vector_get_data(j_vector));
+		auto j_validity = duckdb_vector_get_validity(j_vector);
+		REQUIRE(j_validity);
+		for (idx_t row = 0; row < size; row++) {
+			auto expected = int64_t(total + row);
+			auto is_valid = expected % 3 != 0;
+			if (i_data[row] != expected || duckdb_validity_row_is_valid(j_validity, row) != is_valid ||
+			    (is_valid && j_data[row] != expected)) {
+				mismatches++;
+			}
+		}
+		total += size;
+		duckdb_destroy_data_chunk(&chunk);
+	}
+	REQUIRE(mismatches == 0);
+	REQUIRE(total == 100000);
+	duckdb_destroy_result(&result);
+
+	// batches smaller than a chunk are not split
+	REQUIRE(duckdb_query(con, "SELECT * FROM range(100000)", &result) == DuckDBSuccess);
+	auto chunk = duckdb_fetch_chunk_batch(result, 1);
+	REQUIRE(chunk);
+	REQUIRE(duckdb_data_chunk_get_size(chunk) == STANDARD_VECTOR_SIZE);
+	duckdb_destroy_data_chunk(&chunk);
+	REQUIRE(!duckdb_fetch_chunk_batch(result, 0));
+	duckdb_destroy_result(&result);
+
+	duckdb_disconnect(&con);
+	duckdb_close(&db);
+}
@@ -335,6 +335,30 @@ TEST_CASE("Test fetch API not to completion", "[api]") {
 	db.reset();
 }
 
+TEST_CASE("Test the streaming buffer size of a single result", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	auto result = con.SendQuery("SELECT * FROM range(1000000) tbl(i)");
+	REQUIRE(result->type == QueryResultType::STREAM_RESULT);
+	auto &stream_result = result->Cast<StreamQueryResult>();
+	stream_result.SetStreamingBufferSize(64 * 1024);
+
+	idx_t row_count = 0;
+	while (true) {
+		auto chunk = stream_result.Fetch();
+		if (!chunk) {
+			break;
+		}
+		row_count += chunk->size();
+	}
+	REQUIRE(!stream_result.HasError());
+	REQUIRE(row_count == 1000000);
+	// the small buffer made the query wait for the consumer
+	REQUIRE(stream_result.GetBlockedSinkCount() > 0);
+	REQUIRE(stream_result.GetBlockedSinkTime() >= 0);
+}
+
 TEST_CASE("Test fetch API robustness", "[api]") {
 	auto db = make_uniq<DuckDB>(nullptr);
 	auto conn = make_uniq<Connection>(*db);
@@ -0,0 +1,88 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+//! Waits until the background checkpointer has performed the given amount of checkpoints
+static bool WaitForCheckpoints(Connection &con, idx_t count) {
+	for (idx_t i = 0; i < 200; i++) {
+		auto result = con.Query("SELECT checkpoint_count FROM duckdb_checkpoints() WHERE database_name='db'");
+		if (!result->HasError() && result->RowCount() == 1 &&
+		    result->GetValue(0, 0).GetValue<uint64_t>() >= uint64_t(count)) {
+			return true;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	}
+	return false;
+}
+
+TEST_CASE("Test checkpointing from a background thread", "[api]") {
+	auto db_path = TestCreatePath("db");
+	DeleteDatabase(db_path);
+
+	DBConfig config;
+	config.options.background_checkpoint = true;
+	config.options.checkpoint_wal_size = 1 << 20;
+	{
+		DuckDB db(db_path, &config);
+		Connection con(db);
+
+		auto result = con.Query("SELECT background_checkpointer_running, checkpoint_count FROM duckdb_checkpoints()");
+		REQUIRE(CHECK_COLUMN(result, 0, {true}));
+		REQUIRE(CHECK_COLUMN(result, 1, {0}));
+
+		// commits that exceed the checkpoint threshold leave the checkpoint to the background thread
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT * FROM range(100000) t(i)"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO integers SELECT * FROM range(100000, 200000)"));
+		REQUIRE(WaitForCheckpoints(con, 1));
+
+		result = con.Query("SELECT last_checkpoint_reason, last_error IS NULL FROM duckdb_checkpoints()");
+		REQUIRE(CHECK_COLUMN(result, 0, {"wal_size"}));
+		REQUIRE(CHECK_COLUMN(result, 1, {true}));
+
+		// small commits are checkpointed once the checkpoint interval has elapsed
+		REQUIRE_NO_FAIL(con.Query("SET checkpoint_interval=1"));
+		result = con.Query("SELECT checkpoint_count FROM duckdb_checkpoints()");
+		auto checkpoint_count = result->GetValue(0, 0).GetValue<uint64_t>();
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (42)"));
+		REQUIRE(WaitForCheckpoints(con, checkpoint_count + 1));
+		result = con.Query("SELECT last_checkpoint_reason, wal_size FROM duckdb_checkpoints()");
+		REQUIRE(CHECK_COLUMN(result, 0, {"interval"}));
+		REQUIRE(CHECK_COLUMN(result, 1, {0}));
+
+		// active transactions postpone the checkpoint
+		Connection con2(db);
+		REQUIRE_NO_FAIL(con2.Query("BEGIN TRANSACTION"));
+		REQUIRE_NO_FAIL(con2.Query("SELECT COUNT(*) FROM integers"));
+		result = con.Query("SELECT checkpoint_count FROM duckdb_checkpoints()");
+		checkpoint_count = result->GetValue(0, 0).GetValue<uint64_t>();
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (43)"));
+		std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+		result = con.Query("SELECT checkpoint_count, postponed_count > 0 FROM duckdb_checkpoints()");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::UBIGINT(checkpoint_count)}));
+		REQUIRE(CHECK_COLUMN(result, 1, {true}));
+		REQUIRE_NO_FAIL(con2.Query("COMMIT"));
+		REQUIRE(WaitForCheckpoints(con, checkpoint_count + 1));
+
+		result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {200002}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(19999900000 + 85)}));
+	}
+	// the data survives a restart
+	{
+		DuckDB db(db_path);
+		Connection con(db);
+		auto result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {200002}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(19999900000 + 85)}));
+
+		// without background checkpointing the thread is not started
+		result = con.Query("SELECT background_checkpointer_running FROM duckdb_checkpoints()");
+		REQUIRE(CHECK_COLUMN(result, 0, {false}));
+	}
+	DeleteDatabase(db_path);
+}
@@ -2,6 +2,8 @@
 #include "test_helpers.hpp"
 #include "duckdb/main/appender.hpp"
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/storage/buffer/block_arena.hpp"
+#include "duckdb/storage/storage_info.hpp"
 
 using namespace duckdb;
 using namespace std;
@@ -54,3 +56,55 @@ TEST_CASE("Test using a custom allocator", "[api][.]") {
 	// check that the memory counter usage has decreased after we dropped the table
 	REQUIRE(memory_counter.load() < table_memory_usage);
 }
+
+TEST_CASE("Test allocating blocks from a block arena", "[api]") {
+	auto allocator = BlockArena::CreateAllocator(DEFAULT_BLOCK_ALLOC_SIZE, 2 * DEFAULT_BLOCK_ALLOC_SIZE, true, true);
+	auto &arena = allocator->GetPrivateData()->Cast<BlockArena>();
+
+	// block-sized allocations are served from the arena until it is exhausted
+	auto first = allocator->AllocateData(DEFAULT_BLOCK_ALLOC_SIZE);
+	auto second = allocator->AllocateData(DEFAULT_BLOCK_ALLOC_SIZE);
+	auto third = allocator->AllocateData(DEFAULT_BLOCK_ALLOC_SIZE);
+	auto small = allocator->AllocateData(128);
+#if defined(__linux__) && !defined(DUCKDB_WASM)
+	REQUIRE(arena.Contains(first));
+	REQUIRE(arena.Contains(second));
+#endif
+	REQUIRE(!arena.Contains(third));
+	REQUIRE(!arena.Contains(small));
+
+	// freed blocks are re-used
+	memset(second, 42, DEFAULT_BLOCK_ALLOC_SIZE);
+	allocator->FreeData(second, DEFAULT_BLOCK_ALLOC_SIZE);
+	auto reused = allocator->AllocateData(DEFAULT_BLOCK_ALLOC_SIZE);
+#if defined(__linux__) && !defined(DUCKDB_WASM)
+	REQUIRE(reused == second);
+#endif
+
+	// growing a block moves it out of the arena
+	first[0] = 7;
+	first = allocator->ReallocateData(first, DEFAULT_BLOCK_ALLOC_SIZE, 2 * DEFAULT_BLOCK_ALLOC_SIZE);
+	REQUIRE(!arena.Contains(first));
+	REQUIRE(first[0] == 7);
+
+	allocator->FreeData(first, 2 * DEFAULT_BLOCK_ALLOC_SIZE);
+	allocator->FreeData(reused, DEFAULT_BLOCK_ALLOC_SIZE);
+	allocator->FreeData(third, DEFAULT_BLOCK_ALLOC_SIZE);
+	allocator->FreeData(small, 128);
+}
+
+TEST_CASE("Test a database with a huge page block arena", "[api]") {
+	DBConfig config;
+	config.options.buffer_pool_huge_pages = true;
+	config.options.buffer_pool_prefault = true;
+	config.options.maximum_memory = 64ULL * 1024ULL * 1024ULL;
+	DuckDB db(nullptr, &config);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE tbl AS SELECT i, i::VARCHAR AS s FROM range(1000000) t(i)"));
+	auto result = con.Query("SELECT SUM(i), COUNT(DISTINCT s) FROM tbl");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::HUGEINT(499999500000)}));
+	REQUIRE(CHECK_COLUMN(result, 1, {1000000}));
+	result = con.Query("SELECT current_setting('buffer_pool_huge_pages')");
+	REQUIRE(CHECK_COLUMN(result, 0, {true}));
+	REQUIRE_FAIL(con.Query("SET buffer_pool_huge_pages = false"));
+}
@@ -477,6 +477,31 @@ TEST_CASE("Test ambiguous prepared statement parameter types", "[api]") {
 	REQUIRE(CHECK_COLUMN(result, 0, {"hello"}));
 }
 
+TEST_CASE("Test repeated execution of prepared statements", "[api]") {
+	duckdb::unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE lookup AS SELECT i, 'value ' || i AS s FROM range(1000) t(i)"));
+	auto prep = con.Prepare("SELECT s FROM lookup WHERE i = $1 AND s <> $2");
+	for (int64_t i = 0; i < 1000; i += 7) {
+		result = prep->Execute(i, "none");
+		REQUIRE(CHECK_COLUMN(result, 0, {"value " + to_string(i)}));
+	}
+	// a parameter with a different type rebinds the statement
+	result = prep->Execute((int32_t)42, "none");
+	REQUIRE(CHECK_COLUMN(result, 0, {"value 42"}));
+	// the wrong amount of parameters is still an error after the statement has been executed
+	duckdb::vector<Value> values {Value::BIGINT(42)};
+	REQUIRE_FAIL(prep->Execute(values));
+	values.push_back(Value("none"));
+	values.push_back(Value("none"));
+	REQUIRE_FAIL(prep->Execute(values));
+	values.pop_back();
+	result = prep->Execute(values);
+	REQUIRE(CHECK_COLUMN(result, 0, {"value 42"}));
+}
+
 TEST_CASE("Test prepared statements with SET", "[api]") {
 	duckdb::unique_ptr<QueryResult> result;
 	DuckDB db(nullptr);
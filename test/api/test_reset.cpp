@@ -82,11 +82,16 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"max_temp_directory_size", {"10.0 GiB"}},
 	    {"merge_join_threshold", {73}},
 	    {"nested_loop_join_threshold", {73}},
+	    {"index_join_threshold", {73}},
 	    {"memory_limit", {"4.0 GiB"}},
+	    {"hash_join_build_cache_size", {"4.0 GiB"}},
+	    {"query_memory_limit", {"4.0 GiB"}},
+	    {"session_memory_limit", {"4.0 GiB"}},
 	    {"storage_compatibility_version", {"v0.10.0"}},
 	    {"ordered_aggregate_threshold", {Value::UBIGINT(idx_t(1) << 12)}},
 	    {"null_order", {"nulls_first"}},
 	    {"perfect_ht_threshold", {0}},
+	    {"pipeline_chunk_budget", {"4.0 MiB"}},
 	    {"pivot_filter_threshold", {999}},
 	    {"pivot_limit", {999}},
 	    {"partitioned_write_flush_threshold", {123}},
@@ -94,6 +99,7 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"preserve_insertion_order", {false}},
 	    {"profile_output", {"test"}},
 	    {"profiling_mode", {"detailed"}},
+	    {"query_priority", {"HIGH"}},
 	    {"enable_progress_bar_print", {false}},
 	    {"scalar_subquery_error_on_multiple_rows", {false}},
 	    {"ieee_floating_point_ops", {false}},
@@ -105,6 +111,7 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"http_proxy_username", {"john"}},
 	    {"http_proxy_password", {"doe"}},
 	    {"http_logging_output", {"my_cool_outputfile"}},
+	    {"buffer_eviction_policy", {"TWO_QUEUE"}},
 	    {"allocator_flush_threshold", {"4.0 GiB"}},
 	    {"allocator_bulk_deallocation_flush_threshold", {"4.0 GiB"}}};
 	// Every option that's not excluded has to be part of this map
@@ -142,13 +149,16 @@ bool OptionIsExcludedFromTest(const string &name) {
 	    "allow_unsigned_extensions",  // cant change this while db is running
 	    "allow_community_extensions", // cant change this while db is running
 	    "allow_unredacted_secrets",   // cant change this while db is running
+	    "buffer_pool_huge_pages",     // cant change this while db is running
+	    "buffer_pool_prefault",       // cant change this while db is running
 	    "streaming_buffer_size",
 	    "log_query_path",
 	    "password",
 	    "username",
 	    "user",
-	    "external_threads", // tested in test_threads.cpp
-	    "profiling_output", // just an alias
+	    "external_threads",       // tested in test_threads.cpp
+	    "profiling_output",       // just an alias
+	    "execution_trace_output", // writes a trace file for every query
 	    "duckdb_api",
 	    "custom_user_agent",
 	    "custom_profiling_settings",
@@ -0,0 +1,39 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+TEST_CASE("Test streaming a result through a shared memory stream that is smaller than the result", "[api]") {
+	DuckDB db(nullptr);
+	Connection reader(db);
+	auto path = TestCreatePath("streamed_result.shm");
+	DeleteDatabase(path);
+
+	// the result is far larger than the ring buffer, so the writer has to wait for the reader
+	duckdb::unique_ptr<MaterializedQueryResult> write_result;
+	std::thread writer_thread([&]() {
+		Connection writer(db);
+		write_result = writer.Query("COPY (SELECT i, 'value ' || i AS s FROM range(200000) t(i)) TO '" + path +
+		                            "' (FORMAT shared_memory, BUFFER_SIZE 65536)");
+	});
+
+	duckdb::unique_ptr<MaterializedQueryResult> result;
+	for (idx_t attempt = 0; attempt < 10000; attempt++) {
+		result = reader.Query("SELECT COUNT(*), SUM(i), MAX(s) FROM read_shared_memory('" + path + "')");
+		if (!result->HasError()) {
+			break;
+		}
+		// the writer has not created the stream yet
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	writer_thread.join();
+
+	REQUIRE_NO_FAIL(*write_result);
+	REQUIRE(CHECK_COLUMN(write_result, 0, {200000}));
+	REQUIRE(CHECK_COLUMN(result, 0, {200000}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(19999900000)}));
+	REQUIRE(CHECK_COLUMN(result, 2, {"value 99999"}));
+}
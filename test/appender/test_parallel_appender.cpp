@@ -0,0 +1,130 @@
+#include "catch.hpp"
+#include "duckdb/main/appender.hpp"
+#include "test_helpers.hpp"
+
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+#define PARALLEL_APPEND_THREADS 4
+#define PARALLEL_APPEND_ROWS    150000
+
+static void ParallelAppendRows(LocalParallelAppender *appender, int64_t thread_idx) {
+	for (int64_t i = 0; i < PARALLEL_APPEND_ROWS; i++) {
+		appender->BeginRow();
+		appender->Append<int64_t>(thread_idx * PARALLEL_APPEND_ROWS + i);
+		appender->Append<const char *>(i % 2 == 0 ? "even" : "odd");
+		appender->EndRow();
+	}
+	appender->Close();
+}
+
+TEST_CASE("Test appending to a table from multiple threads", "[appender]") {
+	duckdb::unique_ptr<QueryResult> result;
+	auto db_path = TestCreatePath("parallel_appender.db");
+	DeleteDatabase(db_path);
+	{
+		DuckDB db(db_path);
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE tbl(i BIGINT NOT NULL, s VARCHAR)"));
+
+		ParallelAppender appender(con, "tbl");
+		thread threads[PARALLEL_APPEND_THREADS];
+		for (int64_t t = 0; t < PARALLEL_APPEND_THREADS; t++) {
+			threads[t] = thread(ParallelAppendRows, &appender.CreateLocalAppender(), t);
+		}
+		for (auto &append_thread : threads) {
+			append_thread.join();
+		}
+		// the rows are not visible to other connections before the appender is committed
+		Connection con2(db);
+		result = con2.Query("SELECT COUNT(*) FROM tbl");
+		REQUIRE(CHECK_COLUMN(result, 0, {0}));
+
+		appender.Commit();
+
+		result = con2.Query("SELECT COUNT(*), SUM(i), COUNT(DISTINCT i), COUNT(*) FILTER (s = 'even') FROM tbl");
+		REQUIRE(CHECK_COLUMN(result, 0, {600000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(179999700000)}));
+		REQUIRE(CHECK_COLUMN(result, 2, {600000}));
+		REQUIRE(CHECK_COLUMN(result, 3, {300000}));
+	}
+	{
+		DuckDB db(db_path);
+		Connection con(db);
+		result = con.Query("SELECT COUNT(*), SUM(i) FROM tbl");
+		REQUIRE(CHECK_COLUMN(result, 0, {600000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(179999700000)}));
+	}
+	DeleteDatabase(db_path);
+}
+
+TEST_CASE("Test committing and rolling back parallel appenders", "[appender]") {
+	duckdb::unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER NOT NULL)"));
+
+	// a few rows from multiple appenders
+	{
+		ParallelAppender appender(con, "integers");
+		auto &local1 = appender.CreateLocalAppender();
+		auto &local2 = appender.CreateLocalAppender();
+		local1.AppendRow(1);
+		local2.AppendRow(2);
+		local1.AppendRow(3);
+		appender.Commit();
+		REQUIRE_THROWS(appender.Commit());
+	}
+	result = con.Query("SELECT SUM(i), COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {6}));
+	REQUIRE(CHECK_COLUMN(result, 1, {3}));
+
+	// appenders that are not committed are rolled back
+	{
+		ParallelAppender appender(con, "integers");
+		appender.CreateLocalAppender().AppendRow(4);
+	}
+	{
+		ParallelAppender appender(con, "integers");
+		appender.CreateLocalAppender().AppendRow(5);
+		appender.Rollback();
+		REQUIRE_THROWS(appender.CreateLocalAppender());
+	}
+	result = con.Query("SELECT SUM(i), COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {6}));
+	REQUIRE(CHECK_COLUMN(result, 1, {3}));
+
+	// constraints are verified
+	{
+		ParallelAppender appender(con, "integers");
+		auto &local = appender.CreateLocalAppender();
+		local.AppendRow(7);
+		local.AppendRow(nullptr);
+		REQUIRE_THROWS(appender.Commit());
+	}
+	result = con.Query("SELECT SUM(i), COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {6}));
+	REQUIRE(CHECK_COLUMN(result, 1, {3}));
+
+	// within an explicit transaction the appender does not commit
+	REQUIRE_NO_FAIL(con.Query("BEGIN TRANSACTION"));
+	{
+		ParallelAppender appender(con, "integers");
+		appender.CreateLocalAppender().AppendRow(10);
+		appender.Commit();
+	}
+	result = con.Query("SELECT SUM(i), COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {16}));
+	REQUIRE(CHECK_COLUMN(result, 1, {4}));
+	REQUIRE_NO_FAIL(con.Query("ROLLBACK"));
+
+	result = con.Query("SELECT SUM(i), COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {6}));
+	REQUIRE(CHECK_COLUMN(result, 1, {3}));
+
+	REQUIRE_THROWS(ParallelAppender(con, "nonexistent"));
+	result = con.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {3}));
+}
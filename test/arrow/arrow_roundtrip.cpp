@@ -1,6 +1,9 @@
 #include "catch.hpp"
 
 #include "arrow/arrow_test_helper.hpp"
+#include "duckdb/common/arrow/physical_arrow_stream_collector.hpp"
+#include "duckdb/common/arrow/result_arrow_wrapper.hpp"
+#include "duckdb/main/stream_query_result.hpp"
 
 using namespace duckdb;
 
@@ -144,6 +147,62 @@ TEST_CASE("Test Arrow String View", "[arrow][.]") {
 	    "SELECT NULL UNION SELECT (i*10^i)::varchar str FROM range(10000) tbl(i)");
 }
 
+static unique_ptr<QueryResult> QueryArrowStream(Connection &con, const string &query, idx_t batch_size) {
+	auto &config = ClientConfig::GetConfig(*con.context);
+	ScopedConfigSetting setting(
+	    config,
+	    [&batch_size](ClientConfig &config) {
+		    config.streaming_result_collector = [&batch_size](ClientContext &context, PreparedStatementData &data) {
+			    return PhysicalArrowStreamCollector::Create(context, data, batch_size);
+		    };
+	    },
+	    [](ClientConfig &config) { config.streaming_result_collector = nullptr; });
+	auto result = con.context->Query(query, true);
+	REQUIRE(!result->HasError());
+	REQUIRE(result->type == QueryResultType::STREAM_RESULT);
+	REQUIRE(result->Cast<StreamQueryResult>().IsArrowStream());
+	return result;
+}
+
+TEST_CASE("Test streaming Arrow result collector", "[arrow]") {
+	DuckDB db;
+	Connection con(db);
+	Connection scan_con(db);
+	REQUIRE_NO_FAIL(con.Query("SET threads=4"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE t AS SELECT i, 'thisisalongstring'||i::VARCHAR s, CASE WHEN i%7=0 THEN "
+	                          "NULL ELSE {'i': i, 'b': -i} END st FROM range(300000) tbl(i)"));
+
+	vector<string> queries {"SELECT * FROM t", "SELECT * FROM t WHERE i%3=0", "SELECT i, s FROM t WHERE i < 10"};
+	for (auto preserve_insertion_order : {true, false}) {
+		REQUIRE_NO_FAIL(
+		    con.Query(string("SET preserve_insertion_order=") + (preserve_insertion_order ? "true" : "false")));
+		for (auto &query : queries) {
+			auto wrapper = new ResultArrowArrayStreamWrapper(QueryArrowStream(con, query, 1000), 1000);
+			REQUIRE(ArrowTestHelper::RunArrowComparison(scan_con, query, wrapper->stream));
+		}
+	}
+
+	// when insertion order is preserved, the arrays are streamed in order
+	REQUIRE_NO_FAIL(con.Query("SET preserve_insertion_order=true"));
+	auto result = QueryArrowStream(con, "SELECT i FROM t", 1000);
+	auto &stream_result = result->Cast<StreamQueryResult>();
+	int64_t expected = 0;
+	while (true) {
+		auto array = stream_result.FetchArrowArray();
+		if (!array) {
+			break;
+		}
+		auto &column = *array->arrow_array.children[0];
+		REQUIRE(column.length <= 1000);
+		auto data = reinterpret_cast<const int64_t *>(column.buffers[1]);
+		for (int64_t row = 0; row < column.length; row++) {
+			REQUIRE(data[column.offset + row] == expected++);
+		}
+	}
+	REQUIRE(!stream_result.HasError());
+	REQUIRE(expected == 300000);
+}
+
 TEST_CASE("Test TPCH arrow roundtrip", "[arrow][.]") {
 	DBConfig config;
 	DuckDB db(nullptr, &config);
@@ -0,0 +1,68 @@
+#include "catch.hpp"
+#include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+TEST_CASE("Test that the blocked bloom filter has no false negatives", "[bloom_filter]") {
+	BlockedBloomFilter filter(100000);
+	for (int64_t i = 0; i < 100000; i++) {
+		filter.InsertHash(Hash(i * 7));
+	}
+	for (int64_t i = 0; i < 100000; i++) {
+		REQUIRE(filter.LookupHash(Hash(i * 7)));
+	}
+	// with 16 bits per key the false positive rate should be well below 5%
+	idx_t false_positives = 0;
+	for (int64_t i = 0; i < 100000; i++) {
+		false_positives += filter.LookupHash(Hash(i * 7 + 1));
+	}
+	REQUIRE(false_positives < 5000);
+}
+
+TEST_CASE("Test blocked bloom filter vector lookup", "[bloom_filter]") {
+	BlockedBloomFilter filter(10);
+	Vector keys(LogicalType::BIGINT);
+	auto key_data = FlatVector::GetData<int64_t>(keys);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+		key_data[i] = int64_t(i);
+	}
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(keys, hashes, 10);
+	filter.InsertHashes(hashes, 10);
+
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+		sel.set_index(i, i);
+	}
+	auto count = filter.Lookup(keys, sel, STANDARD_VECTOR_SIZE);
+	REQUIRE(count >= 10);
+	REQUIRE(count < STANDARD_VECTOR_SIZE);
+	for (idx_t i = 0; i < 10; i++) {
+		REQUIRE(sel.get_index(i) == i);
+	}
+}
+
+TEST_CASE("Test blocked bloom filter serialization", "[bloom_filter]") {
+	BlockedBloomFilter filter(1000);
+	for (int64_t i = 0; i < 1000; i++) {
+		filter.InsertHash(Hash(i));
+	}
+	MemoryStream stream;
+	BinarySerializer::Serialize(filter, stream);
+	stream.Rewind();
+	BinaryDeserializer deserializer(stream);
+	deserializer.Begin();
+	auto result = BlockedBloomFilter::Deserialize(deserializer);
+	deserializer.End();
+	REQUIRE(result->GetWordCount() == filter.GetWordCount());
+	REQUIRE(result->GetWords() == filter.GetWords());
+	for (int64_t i = 0; i < 1000; i++) {
+		REQUIRE(result->LookupHash(Hash(i)));
+	}
+}
@@ -38,3 +38,34 @@ TEST_CASE("Checksum tests", "[checksum]") {
 	REQUIRE(c1 != c4);
 	REQUIRE(c1 != c5);
 }
+
+TEST_CASE("CRC32C checksum tests", "[checksum]") {
+	// check the test vector of the CRC32C specification
+	string check_value = "123456789";
+	REQUIRE(CRC32C(const_data_ptr_cast(check_value.c_str()), check_value.size()) == 0xE3069283);
+	REQUIRE(CRC32C(nullptr, 0) == 0);
+
+	// compare the (possibly hardware accelerated) CRC32C with a bitwise implementation for various sizes and offsets
+	vector<uint8_t> buffer(100000);
+	for (size_t i = 0; i < buffer.size(); i++) {
+		buffer[i] = uint8_t((i * 2654435761ULL) >> 13);
+	}
+	for (size_t size : {1, 7, 8, 255, 768, 24575, 24576, 24577, 100000 - 3}) {
+		for (size_t offset : {0, 1, 3}) {
+			if (offset + size > buffer.size()) {
+				continue;
+			}
+			uint32_t expected = 0xFFFFFFFF;
+			for (size_t i = 0; i < size; i++) {
+				expected ^= buffer[offset + i];
+				for (idx_t k = 0; k < 8; k++) {
+					expected = expected & 1 ? (expected >> 1) ^ 0x82F63B78 : expected >> 1;
+				}
+			}
+			expected = ~expected;
+			REQUIRE(CRC32C(buffer.data() + offset, size) == expected);
+			REQUIRE(Checksum(buffer.data() + offset, size, ChecksumType::CRC32C) == expected);
+		}
+	}
+	REQUIRE(Checksum(buffer.data(), buffer.size(), ChecksumType::LEGACY) == Checksum(buffer.data(), buffer.size()));
+}
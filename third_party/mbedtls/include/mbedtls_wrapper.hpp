@@ -23,6 +23,9 @@ public:
 	static bool IsValidSha256Signature(const std::string &pubkey, const std::string &signature,
 	                                   const std::string &sha256_hash);
 	static void Hmac256(const char *key, size_t key_len, const char *message, size_t message_len, char *out);
+	//! Derives a key of SHA256_HASH_LENGTH_BYTES bytes from a password with PBKDF2-HMAC-SHA256 (RFC 8018)
+	static void Pbkdf2Hmac256(const char *password, size_t password_len, const char *salt, size_t salt_len,
+	                          size_t iterations, char *out);
 	static void ToBase16(char *in, char *out, size_t len);
 
 	static constexpr size_t SHA256_HASH_LENGTH_BYTES = 32;
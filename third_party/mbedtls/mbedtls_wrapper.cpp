@@ -15,6 +15,7 @@
 #include "duckdb/common/types/timestamp.hpp"
 #endif
 
+#include <cstring>
 #include <stdexcept>
 
 using namespace std;
@@ -97,6 +98,41 @@ void MbedTlsWrapper::Hmac256(const char *key, size_t key_len, const char *messag
 	mbedtls_md_free(&hmac_ctx);
 }
 
+void MbedTlsWrapper::Pbkdf2Hmac256(const char *password, size_t password_len, const char *salt, size_t salt_len,
+                                   size_t iterations, char *out) {
+	if (iterations == 0) {
+		throw runtime_error("PBKDF2 requires at least one iteration");
+	}
+	mbedtls_md_context_t hmac_ctx;
+	mbedtls_md_init(&hmac_ctx);
+	const mbedtls_md_info_t *md_type = mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
+	if (!md_type || mbedtls_md_setup(&hmac_ctx, md_type, 1) ||
+	    mbedtls_md_hmac_starts(&hmac_ctx, reinterpret_cast<const unsigned char *>(password), password_len)) {
+		mbedtls_md_free(&hmac_ctx);
+		throw runtime_error("failed to init hmac");
+	}
+	// the output is a single block: U_1 = HMAC(password, salt || INT(1)), U_i = HMAC(password, U_{i-1})
+	const unsigned char block_index[4] = {0, 0, 0, 1};
+	unsigned char u[SHA256_HASH_LENGTH_BYTES];
+	unsigned char result[SHA256_HASH_LENGTH_BYTES];
+	bool failed = mbedtls_md_hmac_update(&hmac_ctx, reinterpret_cast<const unsigned char *>(salt), salt_len) ||
+	              mbedtls_md_hmac_update(&hmac_ctx, block_index, sizeof(block_index)) ||
+	              mbedtls_md_hmac_finish(&hmac_ctx, u);
+	memcpy(result, u, SHA256_HASH_LENGTH_BYTES);
+	for (size_t i = 1; i < iterations && !failed; i++) {
+		failed = mbedtls_md_hmac_reset(&hmac_ctx) || mbedtls_md_hmac_update(&hmac_ctx, u, SHA256_HASH_LENGTH_BYTES) ||
+		         mbedtls_md_hmac_finish(&hmac_ctx, u);
+		for (size_t k = 0; k < SHA256_HASH_LENGTH_BYTES; k++) {
+			result[k] ^= u[k];
+		}
+	}
+	mbedtls_md_free(&hmac_ctx);
+	if (failed) {
+		throw runtime_error("PBKDF2 Error");
+	}
+	memcpy(out, result, SHA256_HASH_LENGTH_BYTES);
+}
+
 void MbedTlsWrapper::ToBase16(char *in, char *out, size_t len) {
 	static char const HEX_CODES[] = "0123456789abcdef";
 	size_t i, j;
@@ -384,6 +384,20 @@ public:
 		return compression_;
 	}
 
+	Value min() const {
+		return min_;
+	}
+
+	Value max() const {
+		return max_;
+	}
+
+	// widen the bounds, e.g. with those of a digest that was merged in or serialized
+	void mergeBounds(Value lower, Value upper) {
+		min_ = std::min(min_, lower);
+		max_ = std::max(max_, upper);
+	}
+
 	void add(Value x) {
 		add(x, 1);
 	}
@@ -20,6 +20,9 @@ public:
 	                      const ClientProperties &client_properties, bool pandas = false);
 
 	void Append(DataChunk &chunk);
+	//! Appends all rows of the collection. Must be called holding the GIL, which is released while the columns that
+	//! are not converted to Python objects are converted (in parallel)
+	void Append(ColumnDataCollection &collection);
 
 	py::object ToArray(idx_t col_idx) {
 		return owned_data[col_idx].ToArray();
@@ -30,6 +33,9 @@ public:
 
 private:
 	void Resize(idx_t new_capacity);
+	void AppendColumn(ColumnDataCollection &collection, idx_t col_idx);
+	//! Whether the values of the type are converted to Python objects, which requires holding the GIL
+	static bool RequiresGIL(const LogicalType &type);
 
 private:
 	vector<ArrayWrapper> owned_data;
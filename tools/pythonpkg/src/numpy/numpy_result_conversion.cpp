@@ -1,5 +1,8 @@
 #include "duckdb_python/numpy/array_wrapper.hpp"
 #include "duckdb_python/numpy/numpy_result_conversion.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 
 namespace duckdb {
 
@@ -46,4 +49,95 @@ void NumpyResultConversion::Append(DataChunk &chunk) {
 #endif
 }
 
+bool NumpyResultConversion::RequiresGIL(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+	case LogicalTypeId::BIT:
+	case LogicalTypeId::UUID:
+	case LogicalTypeId::LIST:
+	case LogicalTypeId::ARRAY:
+	case LogicalTypeId::MAP:
+	case LogicalTypeId::UNION:
+	case LogicalTypeId::STRUCT:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void NumpyResultConversion::AppendColumn(ColumnDataCollection &collection, idx_t col_idx) {
+	ColumnDataScanState scan_state;
+	collection.InitializeScan(scan_state, vector<column_t> {col_idx});
+	DataChunk chunk;
+	collection.InitializeScanChunk(scan_state, chunk);
+	auto offset = count;
+	while (collection.Scan(scan_state, chunk)) {
+		owned_data[col_idx].Append(offset, chunk.data[0], chunk.size());
+		offset += chunk.size();
+	}
+}
+
+void NumpyResultConversion::Append(ColumnDataCollection &collection) {
+	if (count + collection.Count() > capacity) {
+		// allocate all the space we need up front: resizing the arrays requires the GIL
+		Resize(count + collection.Count());
+	}
+	vector<idx_t> parallel_columns;
+	vector<idx_t> gil_columns;
+	for (idx_t col_idx = 0; col_idx < owned_data.size(); col_idx++) {
+		if (RequiresGIL(collection.Types()[col_idx])) {
+			gil_columns.push_back(col_idx);
+		} else {
+			parallel_columns.push_back(col_idx);
+		}
+	}
+
+	// every column is written to its own arrays, so the columns can be converted independently
+	atomic<idx_t> next_column(0);
+	mutex error_lock;
+	ErrorData error;
+	auto convert_columns = [&]() {
+		while (true) {
+			auto column_idx = next_column++;
+			if (column_idx >= parallel_columns.size()) {
+				return;
+			}
+			try {
+				AppendColumn(collection, parallel_columns[column_idx]);
+			} catch (std::exception &ex) {
+				lock_guard<mutex> guard(error_lock);
+				error = ErrorData(ex);
+			}
+		}
+	};
+	auto thread_count = MinValue<idx_t>(parallel_columns.size(), MaxValue<idx_t>(thread::hardware_concurrency(), 1));
+	vector<thread> threads;
+	for (idx_t i = 1; i < thread_count; i++) {
+		threads.emplace_back(convert_columns);
+	}
+	// in the meantime, convert the columns that create Python objects on this thread
+	for (auto col_idx : gil_columns) {
+		try {
+			AppendColumn(collection, col_idx);
+		} catch (std::exception &ex) {
+			lock_guard<mutex> guard(error_lock);
+			error = ErrorData(ex);
+			break;
+		}
+	}
+	{
+		py::gil_scoped_release release;
+		convert_columns();
+		for (auto &convert_thread : threads) {
+			convert_thread.join();
+		}
+	}
+	if (error.HasError()) {
+		error.Throw();
+	}
+	count += collection.Count();
+}
+
 } // namespace duckdb
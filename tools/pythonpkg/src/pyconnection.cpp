@@ -5,6 +5,7 @@
 #include "duckdb/common/enums/file_compression_type.hpp"
 #include "duckdb/common/printer.hpp"
 #include "duckdb/common/types.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/function/table/read_csv.hpp"
 #include "duckdb/main/client_config.hpp"
@@ -415,6 +416,57 @@ void DuckDBPyConnection::Initialize(py::handle &m) {
 	DuckDBPyConnection::ImportCache();
 }
 
+//! Transforms a list of positional parameter sets into a single collection that can be executed as one batch
+//! Returns nullptr if the parameter sets cannot be batched, in which case they are executed one by one
+static shared_ptr<ColumnDataCollection> TransformParameterBatch(ClientContext &context, PreparedStatement &prep,
+                                                                const py::list &parameter_sets) {
+	auto parameter_count = prep.named_param_map.size();
+	if (parameter_count == 0) {
+		return nullptr;
+	}
+	vector<vector<Value>> rows;
+	vector<LogicalType> types(parameter_count, LogicalType::SQLNULL);
+	for (auto &parameters : parameter_sets) {
+		auto params = py::reinterpret_borrow<py::object>(parameters);
+		if (params.is_none() || py::is_dict_like(params) || !py::is_list_like(params) ||
+		    py::len(params) != parameter_count) {
+			return nullptr;
+		}
+		auto values = DuckDBPyConnection::TransformPythonParamList(params);
+		for (idx_t col_idx = 0; col_idx < parameter_count; col_idx++) {
+			if (!LogicalType::TryGetMaxLogicalType(context, types[col_idx], values[col_idx].type(), types[col_idx])) {
+				return nullptr;
+			}
+		}
+		rows.push_back(std::move(values));
+	}
+	for (auto &type : types) {
+		if (type.id() == LogicalTypeId::SQLNULL) {
+			// a parameter that is always NULL has no type to bind against
+			return nullptr;
+		}
+	}
+
+	auto &allocator = Allocator::DefaultAllocator();
+	auto collection = make_shared_ptr<ColumnDataCollection>(allocator, types);
+	DataChunk chunk;
+	chunk.Initialize(allocator, types);
+	for (auto &row : rows) {
+		for (idx_t col_idx = 0; col_idx < parameter_count; col_idx++) {
+			chunk.SetValue(col_idx, chunk.size(), row[col_idx]);
+		}
+		chunk.SetCardinality(chunk.size() + 1);
+		if (chunk.size() == STANDARD_VECTOR_SIZE) {
+			collection->Append(chunk);
+			chunk.Reset();
+		}
+	}
+	if (chunk.size() > 0) {
+		collection->Append(chunk);
+	}
+	return collection;
+}
+
 shared_ptr<DuckDBPyConnection> DuckDBPyConnection::ExecuteMany(const py::object &query, py::object params_p) {
 	con.SetResult(nullptr);
 	if (params_p.is_none()) {
@@ -444,6 +496,23 @@ shared_ptr<DuckDBPyConnection> DuckDBPyConnection::ExecuteMany(const py::object
 	}
 
 	unique_ptr<QueryResult> query_result;
+	if (prep->GetStatementType() == StatementType::INSERT_STATEMENT && outer_list.size() > 1) {
+		// Inserts are executed as a single batch over all parameter sets
+		auto batch = TransformParameterBatch(*con.GetConnection().context, *prep, outer_list);
+		if (batch) {
+			{
+				py::gil_scoped_release release;
+				unique_lock<std::mutex> lock(py_connection_lock);
+				query_result = prep->ExecuteBatch(std::move(batch));
+				if (query_result->HasError()) {
+					query_result->ThrowError();
+				}
+			}
+			auto py_result = make_uniq<DuckDBPyResult>(std::move(query_result));
+			con.SetResult(make_uniq<DuckDBPyRelation>(std::move(py_result)));
+			return shared_from_this();
+		}
+	}
 	// Execute once for every set of parameters that are provided
 	for (auto &parameters : outer_list) {
 		auto params = py::reinterpret_borrow<py::object>(parameters);
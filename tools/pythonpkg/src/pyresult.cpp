@@ -228,9 +228,7 @@ py::dict DuckDBPyResult::FetchNumpyInternal(bool stream, idx_t vectors_per_chunk
 
 	if (result->type == QueryResultType::MATERIALIZED_RESULT) {
 		auto &materialized = result->Cast<MaterializedQueryResult>();
-		for (auto &chunk : materialized.Collection().Chunks()) {
-			conversion.Append(chunk);
-		}
+		conversion.Append(materialized.Collection());
 		InsertCategory(materialized, categories);
 		materialized.Collection().Reset();
 	} else {
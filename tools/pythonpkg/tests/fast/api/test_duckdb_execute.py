@@ -75,6 +75,16 @@ class TestDuckDBExecute(object):
         duckdb_cursor.executemany("INSERT into unittest_generator (a) VALUES (?)", gen)
         assert duckdb_cursor.table('unittest_generator').fetchall() == [(1,), (2,), (3,)]
 
+    def test_executemany_batch_insert(self, duckdb_cursor):
+        duckdb_cursor.execute("CREATE TABLE batch_insert (i BIGINT, s VARCHAR);")
+        params = [[i, f'value {i}'] for i in range(5000)]
+        # a parameter that is NULL in some of the sets, and a mix of integer and float values
+        params += [[None, 'null'], [1.5, None]]
+        duckdb_cursor.executemany("INSERT INTO batch_insert VALUES (?, ?)", params)
+        res = duckdb_cursor.execute("SELECT COUNT(*), COUNT(i), SUM(i), COUNT(s) FROM batch_insert").fetchall()
+        assert res == [(5002, 5001, 12497502, 5001)]
+        assert duckdb_cursor.execute("SELECT s FROM batch_insert WHERE i = 4999").fetchall() == [('value 4999',)]
+
     def test_execute_multiple_statements(self, duckdb_cursor):
         pd = pytest.importorskip("pandas")
         df = pd.DataFrame({'a': [5, 6, 7, 8]})
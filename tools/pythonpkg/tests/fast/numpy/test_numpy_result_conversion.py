@@ -0,0 +1,23 @@
+import numpy as np
+import duckdb
+
+
+class TestNumpyResultConversion(object):
+    def test_fetchnumpy_mixed_columns(self, duckdb_cursor):
+        # fixed-width columns are converted in parallel, string columns while holding the GIL
+        columns = ', '.join(f'i + {c} AS c{c}, (i + {c})::VARCHAR AS s{c}, (i + {c})::DOUBLE AS d{c}' for c in range(8))
+        res = duckdb_cursor.sql(f"SELECT {columns} FROM range(10000) tbl(i)").fetchnumpy()
+        for c in range(8):
+            expected = np.arange(c, 10000 + c)
+            assert np.array_equal(res[f'c{c}'], expected)
+            assert np.array_equal(res[f'd{c}'], expected.astype(np.float64))
+            assert list(res[f's{c}']) == [str(v) for v in range(c, 10000 + c)]
+
+    def test_df_nulls(self, duckdb_cursor):
+        df = duckdb_cursor.sql(
+            "SELECT CASE WHEN i % 3 = 0 THEN NULL ELSE i END AS a, i::VARCHAR AS b FROM range(5000) tbl(i)"
+        ).df()
+        assert len(df) == 5000
+        assert df['a'].isna().sum() == 1667
+        assert df['a'][1] == 1
+        assert df['b'][4999] == '4999'
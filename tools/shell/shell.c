@@ -19682,6 +19682,11 @@ int SQLITE_CDECL wmain(int argc, wchar_t **wargv){
   setvbuf(stderr, 0, _IONBF, 0); /* Make sure stderr is unbuffered */
   stdin_is_interactive = isatty(0);
   stdout_is_console = isatty(1);
+  if( !stdout_is_console ){
+    /* Use a large output buffer when stdout is redirected, so that large
+    ** results are written out in big blocks */
+    setvbuf(stdout, 0, _IOFBF, 1<<20);
+  }
 
 #ifdef SQLITE_DEBUG
   registerOomSimulator();
@@ -7,6 +7,7 @@
 #include "duckdb/common/error_data.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/types.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/parser/parser.hpp"
@@ -46,6 +47,13 @@ struct sqlite3_string_buffer {
 	int data_len;
 };
 
+struct sqlite3_text_column {
+	//! The NUL-terminated VARCHAR representations of all rows of the current chunk, stored back-to-back
+	duckdb::unsafe_unique_array<char> data;
+	//! The offset of every row in data, followed by the total size
+	duckdb::unsafe_unique_array<idx_t> offsets;
+};
+
 struct sqlite3_stmt {
 	//! The DB object that this statement belongs to
 	sqlite3 *db;
@@ -63,8 +71,10 @@ struct sqlite3_stmt {
 	duckdb::vector<Value> bound_values;
 	//! Names of the prepared parameters
 	duckdb::vector<string> bound_names;
-	//! The current column values converted to string, used and filled by sqlite3_column_text
+	//! The current column values converted to blob, used and filled by sqlite3_column_blob
 	duckdb::unique_ptr<sqlite3_string_buffer[]> current_text;
+	//! The columns of the current chunk converted to string, used and filled by sqlite3_column_text
+	duckdb::unique_ptr<duckdb::unique_ptr<sqlite3_text_column>[]> current_chunk_text;
 };
 
 void sqlite3_randomness(int N, void *pBuf) {
@@ -312,6 +322,7 @@ int sqlite3_step(sqlite3_stmt *pStmt) {
 			pStmt->prepared = nullptr;
 			return SQLITE_ERROR;
 		}
+		pStmt->current_chunk_text = nullptr;
 
 		pStmt->current_row = -1;
 
@@ -341,6 +352,7 @@ int sqlite3_step(sqlite3_stmt *pStmt) {
 			pStmt->prepared = nullptr;
 			return SQLITE_ERROR;
 		}
+		pStmt->current_chunk_text = nullptr;
 		if (!pStmt->current_chunk || pStmt->current_chunk->size() == 0) {
 			sqlite3_reset(pStmt);
 			return SQLITE_DONE;
@@ -563,27 +575,66 @@ sqlite3_int64 sqlite3_column_int64(sqlite3_stmt *stmt, int iCol) {
 	return BigIntValue::Get(val);
 }
 
+static sqlite3_text_column &sqlite3_column_text_column(sqlite3_stmt *pStmt, int iCol) {
+	if (!pStmt->current_chunk_text) {
+		pStmt->current_chunk_text = duckdb::unique_ptr<duckdb::unique_ptr<sqlite3_text_column>[]>(
+		    new duckdb::unique_ptr<sqlite3_text_column>[pStmt->result->types.size()]);
+	}
+	auto &entry = pStmt->current_chunk_text[iCol];
+	if (entry) {
+		return *entry;
+	}
+	// convert the entire column of the current chunk at once, rather than casting every value separately
+	auto &chunk = *pStmt->current_chunk;
+	auto count = chunk.size();
+	Vector varchar_vector(LogicalType::VARCHAR, count);
+	VectorOperations::Cast(*pStmt->db->con->context, chunk.data[iCol], varchar_vector, count);
+
+	UnifiedVectorFormat format;
+	varchar_vector.ToUnifiedFormat(count, format);
+	auto strings = UnifiedVectorFormat::GetData<string_t>(format);
+	auto column = duckdb::make_uniq<sqlite3_text_column>();
+	column->offsets = duckdb::make_unsafe_uniq_array<idx_t>(count + 1);
+	idx_t total_size = 0;
+	for (idx_t r = 0; r < count; r++) {
+		column->offsets[r] = total_size;
+		auto idx = format.sel->get_index(r);
+		if (format.validity.RowIsValid(idx)) {
+			total_size += strings[idx].GetSize();
+		}
+		total_size++;
+	}
+	column->offsets[count] = total_size;
+	column->data = duckdb::make_unsafe_uniq_array<char>(total_size);
+	for (idx_t r = 0; r < count; r++) {
+		auto idx = format.sel->get_index(r);
+		auto target = column->data.get() + column->offsets[r];
+		if (format.validity.RowIsValid(idx)) {
+			auto size = strings[idx].GetSize();
+			memcpy(target, strings[idx].GetData(), size);
+			target += size;
+		}
+		*target = '\0';
+	}
+	entry = std::move(column);
+	return *entry;
+}
+
 const unsigned char *sqlite3_column_text(sqlite3_stmt *pStmt, int iCol) {
-	Value val;
-	if (!sqlite3_column_has_value(pStmt, iCol, LogicalType::VARCHAR, val)) {
+	if (!pStmt || !pStmt->result || !pStmt->current_chunk) {
+		return nullptr;
+	}
+	if (iCol < 0 || iCol >= (int)pStmt->result->types.size()) {
+		return nullptr;
+	}
+	if (FlatVector::IsNull(pStmt->current_chunk->data[iCol], pStmt->current_row)) {
 		return nullptr;
 	}
 	try {
-		if (!pStmt->current_text) {
-			pStmt->current_text =
-			    duckdb::unique_ptr<sqlite3_string_buffer[]>(new sqlite3_string_buffer[pStmt->result->types.size()]);
-		}
-		auto &entry = pStmt->current_text[iCol];
-		if (!entry.data) {
-			// not initialized yet, convert the value and initialize it
-			auto &str_val = StringValue::Get(val);
-			entry.data = duckdb::make_unsafe_uniq_array<char>(str_val.size() + 1);
-			memcpy(entry.data.get(), str_val.c_str(), str_val.size() + 1);
-			entry.data_len = str_val.length();
-		}
-		return (const unsigned char *)entry.data.get();
+		auto &column = sqlite3_column_text_column(pStmt, iCol);
+		return (const unsigned char *)(column.data.get() + column.offsets[pStmt->current_row]);
 	} catch (...) {
-		// memory error!
+		// conversion or memory error!
 		return nullptr;
 	}
 }
@@ -881,6 +932,7 @@ int sqlite3_reset(sqlite3_stmt *stmt) {
 	if (stmt) {
 		stmt->result = nullptr;
 		stmt->current_chunk = nullptr;
+		stmt->current_chunk_text = nullptr;
 	}
 	return SQLITE_OK;
 }
@@ -1069,21 +1121,20 @@ int sqlite3_column_bytes(sqlite3_stmt *pStmt, int iCol) {
 	if (!pStmt || iCol < 0 || pStmt->result->types.size() <= static_cast<size_t>(iCol))
 		return 0;
 
-	// checks if the current column is initialized
-	if (!pStmt->current_text) {
-		if (!sqlite3_column_text(pStmt, iCol) && !sqlite3_column_blob(pStmt, iCol)) {
-			return 0;
-		}
+	// if the column was fetched as a blob, return the size of the blob
+	if (pStmt->current_text && pStmt->current_text[iCol].data) {
+		return pStmt->current_text[iCol].data_len;
 	}
-	sqlite3_string_buffer *col_text = &pStmt->current_text[iCol];
-	if (!col_text->data) {
-		if (!sqlite3_column_text(pStmt, iCol) && !sqlite3_column_blob(pStmt, iCol)) {
+	if (!sqlite3_column_text(pStmt, iCol)) {
+		if (!sqlite3_column_blob(pStmt, iCol)) {
 			return 0;
 		}
-		col_text = &pStmt->current_text[iCol];
+		return pStmt->current_text[iCol].data_len;
 	}
-
-	return col_text->data_len;
+	auto &offsets = pStmt->current_chunk_text[iCol]->offsets;
+	auto row = NumericCast<idx_t>(pStmt->current_row);
+	// the offsets include the NUL terminator of every row
+	return NumericCast<int>(offsets[row + 1] - offsets[row] - 1);
 }
 
 sqlite3_value *sqlite3_column_value(sqlite3_stmt *, int iCol) {
@@ -336,6 +336,33 @@ TEST_CASE("Test rollback of aborted transaction", "[sqlite3wrapper]") {
 	REQUIRE(db.Execute("START TRANSACTION"));
 }
 
+TEST_CASE("Test sqlite3_column_text over multiple chunks", "[sqlite3wrapper]") {
+	SQLiteDBWrapper db;
+	SQLiteStmtWrapper stmt;
+
+	// open an in-memory db
+	REQUIRE(db.Open(":memory:"));
+	REQUIRE(stmt.Prepare(db.db,
+	                     "SELECT i, CASE WHEN i % 7 = 0 THEN NULL ELSE repeat('x', i % 5) END, 'row ' || i "
+	                     "FROM range(5000) t(i) ORDER BY i",
+	                     -1, nullptr) == SQLITE_OK);
+	int row = 0;
+	while (sqlite3_step(stmt.stmt) == SQLITE_ROW) {
+		REQUIRE(string((const char *)sqlite3_column_text(stmt.stmt, 0)) == to_string(row));
+		REQUIRE(sqlite3_column_bytes(stmt.stmt, 0) == (int)to_string(row).size());
+		if (row % 7 == 0) {
+			REQUIRE(sqlite3_column_text(stmt.stmt, 1) == nullptr);
+			REQUIRE(sqlite3_column_bytes(stmt.stmt, 1) == 0);
+		} else {
+			REQUIRE(string((const char *)sqlite3_column_text(stmt.stmt, 1)) == string(row % 5, 'x'));
+			REQUIRE(sqlite3_column_bytes(stmt.stmt, 1) == row % 5);
+		}
+		REQUIRE(string((const char *)sqlite3_column_text(stmt.stmt, 2)) == "row " + to_string(row));
+		row++;
+	}
+	REQUIRE(row == 5000);
+}
+
 TEST_CASE("Test sqlite3_complete", "[sqlite3wrapper]") {
 	REQUIRE(sqlite3_complete("SELECT $$ this is a dollar quoted string without a marker $$;") == 1);
 	REQUIRE(sqlite3_complete("SELECT $this$is a dollar quoted string$this$;") == 1);